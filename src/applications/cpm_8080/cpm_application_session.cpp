@@ -3,6 +3,7 @@
 #include "crosscutting/util/byte_util.h"
 #include <iostream>
 #include <stdexcept>
+#include <string>
 #include <utility>
 
 namespace emu::applications::cpm::i8080 {
@@ -17,6 +18,7 @@ CpmApplicationSession::CpmApplicationSession(
     , m_is_finished(false)
 {
     setup_cpu();
+    setup_hooks();
 }
 
 void CpmApplicationSession::run()
@@ -25,7 +27,7 @@ void CpmApplicationSession::run()
     m_cpu->start();
 
     while (m_cpu->can_run_next_instruction() && !m_is_finished) {
-        m_cpu->next_instruction();
+        m_hooks.next_instruction(*m_cpu);
     }
 
     m_cpu->stop();
@@ -46,14 +48,6 @@ void CpmApplicationSession::out_changed(u8 port)
 {
     if (port == s_finished_port) {
         m_is_finished = true;
-    } else if (port == s_output_port) {
-        const u8 operation = m_cpu->c();
-
-        if (operation == s_C_WRITE) {
-            c_write(m_cpu->e());
-        } else if (operation == s_C_WRITESTR) {
-            c_writestr(m_cpu->memory(), to_u16(m_cpu->d(), m_cpu->e()));
-        }
     } else {
         throw std::runtime_error("Illegal output port");
     }
@@ -68,6 +62,29 @@ void CpmApplicationSession::setup_cpu()
     m_cpu->add_out_observer(*this);
 }
 
+void CpmApplicationSession::setup_hooks()
+{
+    m_hooks.add_hook(s_bdos_address, [&]() { return bdos(); });
+}
+
+/**
+ * Runs the BDOS call natively, after which the RET at the BDOS call point returns from it.
+ *
+ * @return the cycles of the call, which are none because CP/M programs are not timed
+ */
+cyc CpmApplicationSession::bdos()
+{
+    const u8 operation = m_cpu->c();
+
+    if (operation == s_C_WRITE) {
+        c_write(m_cpu->e());
+    } else if (operation == s_C_WRITESTR) {
+        c_writestr(m_cpu->memory(), to_u16(m_cpu->d(), m_cpu->e()));
+    }
+
+    return 0;
+}
+
 void CpmApplicationSession::c_write(u8 e)
 {
     std::cout << e;
@@ -75,8 +92,11 @@ void CpmApplicationSession::c_write(u8 e)
 
 void CpmApplicationSession::c_writestr(EmulatorMemory<u16, u8> const& memory, u16 address)
 {
+    std::string str;
     do {
-        std::cout << memory.read(address++);
+        str += static_cast<char>(memory.read(address++));
     } while (memory.read(address) != '$');
+
+    std::cout << str;
 }
 }
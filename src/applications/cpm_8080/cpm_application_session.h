@@ -3,6 +3,7 @@
 #include "chips/8080/cpu.h"
 #include "chips/8080/interfaces/out_observer.h"
 #include "crosscutting/memory/emulator_memory.h"
+#include "crosscutting/misc/hook_table.h"
 #include "crosscutting/misc/session.h"
 #include "crosscutting/typedefs.h"
 #include <memory>
@@ -13,6 +14,7 @@ namespace emu::applications::cpm::i8080 {
 using emu::i8080::Cpu;
 using emu::i8080::OutObserver;
 using emu::memory::EmulatorMemory;
+using emu::misc::HookTable;
 using emu::misc::Session;
 
 class CpmApplicationSession
@@ -33,7 +35,7 @@ public:
 
 private:
     static constexpr u8 s_finished_port = 0;
-    static constexpr u8 s_output_port = 1;
+    static constexpr u16 s_bdos_address = 0x0005;
     static constexpr u8 s_C_WRITE = 2;
     static constexpr u8 s_C_WRITESTR = 9;
 
@@ -41,12 +43,17 @@ private:
     EmulatorMemory<u16, u8> m_memory;
     std::string m_loaded_file;
     bool m_is_finished;
+    HookTable m_hooks;
 
     void setup_cpu();
 
+    void setup_hooks();
+
     // CP/M syscalls
     // https://www.seasip.info/Cpm/bdos.html
 
+    cyc bdos();
+
     static void c_write(u8 e);
 
     static void c_writestr(EmulatorMemory<u16, u8> const& memory, u16 address);
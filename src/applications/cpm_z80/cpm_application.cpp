@@ -56,9 +56,12 @@ void CpmApplication::patch_program(EmulatorMemory<u16, u8>& program)
     // Finished with tests:
     program.write(0x0000, 0xd3); // OUT 0x00
 
-    // BDOS call point (0x0005)
-    program.write(0x0005, 0xd3); // OUT 0x01
+    // BDOS call point (0x0005), which is run by a hook in the session
+    program.write(0x0005, 0xc9); // RET
+
+    // The programs take the top of their memory from 0x0006, which is kept at what it was when
+    // the BDOS call point was an OUT 0x01 followed by a RET
     program.write(0x0006, 0x01);
-    program.write(0x0007, 0xc9); // RET
+    program.write(0x0007, 0xc9);
 }
 }
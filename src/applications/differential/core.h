@@ -0,0 +1,55 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <cstddef>
+#include <vector>
+
+namespace emu::applications::differential {
+
+enum class CoreKind {
+    I8080,
+    Z80,
+    LR35902
+};
+
+/**
+ * The registers the cores have in common. The flags are in the layout of the 8080, and only the
+ * flags the cores share are used. The rest of the flag bits are always zero.
+ */
+struct CoreState {
+    static constexpr u8 s_sign = 1 << 7;
+    static constexpr u8 s_zero = 1 << 6;
+    static constexpr u8 s_half_carry = 1 << 4;
+    static constexpr u8 s_parity = 1 << 2;
+    static constexpr u8 s_carry = 1 << 0;
+
+    u16 m_pc;
+    u16 m_sp;
+    u8 m_acc_reg;
+    u8 m_b_reg;
+    u8 m_c_reg;
+    u8 m_d_reg;
+    u8 m_e_reg;
+    u8 m_h_reg;
+    u8 m_l_reg;
+    u8 m_flags;
+};
+
+/**
+ * One of the CPU cores, with a full 64 KiB memory of its own.
+ */
+class Core {
+public:
+    static constexpr std::size_t s_memory_size = 0x10000;
+
+    virtual ~Core() = default;
+
+    virtual void load(CoreState const& state, std::vector<u8> const& memory) = 0;
+
+    virtual void step() = 0;
+
+    [[nodiscard]] virtual CoreState state() const = 0;
+
+    [[nodiscard]] virtual u8 const* memory() const = 0;
+};
+}
@@ -0,0 +1,236 @@
+#include "differential_runner.h"
+#include "crosscutting/util/parallel_util.h"
+#include "lockstep.h"
+#include "program_generator.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <fmt/core.h>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace emu::applications::differential {
+
+using emu::util::parallel::parallel_for_each;
+
+DifferentialRunner::DifferentialRunner(
+    CoreKind first,
+    CoreKind second,
+    u64 program_count,
+    u64 seed,
+    std::size_t max_length,
+    std::vector<u8> corpus)
+    : m_first(first)
+    , m_second(second)
+    , m_program_count(program_count)
+    , m_seed(seed)
+    , m_max_length(max_length)
+    , m_corpus(std::move(corpus))
+{
+}
+
+bool DifferentialRunner::run()
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    Lockstep lockstep(m_first, m_second);
+    const ProgramGenerator generator(lockstep.instructions(), m_max_length, m_corpus);
+
+    std::atomic<u64> programs_run { 0 };
+    std::mutex divergence_mutex;
+    std::optional<Divergence> first_divergence;
+    u64 first_divergent_program = std::numeric_limits<u64>::max();
+
+    // The seed of a program is made from its number, so the programs are the same however the
+    // batches are spread over the threads
+    const u64 batch_count = (m_program_count + s_programs_per_batch - 1) / s_programs_per_batch;
+    const unsigned int thread_count = parallel_for_each(batch_count, [&]() {
+        auto thread_lockstep = std::make_shared<Lockstep>(m_first, m_second);
+        return [&, thread_lockstep](std::size_t batch) {
+            const u64 first_program = s_programs_per_batch * batch;
+            const u64 last_program = std::min(first_program + s_programs_per_batch, m_program_count);
+            for (u64 program = first_program; program < last_program; ++program) {
+                std::optional<Divergence> divergence = thread_lockstep->run(generator.generate((m_seed << 32) ^ (program * 0xd1b54a32d192ed03)));
+                ++programs_run;
+
+                if (divergence.has_value()) {
+                    std::lock_guard<std::mutex> lock(divergence_mutex);
+                    if (program < first_divergent_program) {
+                        first_divergent_program = program;
+                        first_divergence = std::move(divergence);
+                    }
+                    return false;
+                }
+            }
+
+            return true;
+        };
+    });
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << fmt::format(
+        "Ran {} programs of up to {} instructions on {} and {} with {} threads in {:.2f} s ({:.0f} programs per minute)\n",
+        programs_run.load(), m_max_length, name_of(m_first), name_of(m_second), thread_count, seconds,
+        seconds > 0 ? static_cast<double>(programs_run.load()) * 60 / seconds : 0.0);
+
+    if (!first_divergence.has_value()) {
+        std::cout << "The cores agreed on every program\n";
+        return true;
+    }
+
+    print_divergence(minimize(lockstep, first_divergence.value()), first_divergent_program);
+    return false;
+}
+
+std::string DifferentialRunner::name_of(CoreKind core)
+{
+    switch (core) {
+    case CoreKind::I8080:
+        return "8080";
+    case CoreKind::Z80:
+        return "Z80";
+    default:
+        return "LR35902";
+    }
+}
+
+/**
+ * Removes one instruction at a time, and then clears one register at a time, and keeps every
+ * change the cores still disagree after. It doesn't have to be the same disagreement, as long as
+ * there is one, which is how delta debugging usually works.
+ */
+Divergence DifferentialRunner::minimize(Lockstep& lockstep, Divergence divergence)
+{
+    static constexpr std::array<u8 CoreState::*, 8> registers = {
+        &CoreState::m_acc_reg, &CoreState::m_b_reg, &CoreState::m_c_reg, &CoreState::m_d_reg,
+        &CoreState::m_e_reg, &CoreState::m_h_reg, &CoreState::m_l_reg, &CoreState::m_flags
+    };
+
+    bool is_shortened = true;
+    while (is_shortened) {
+        is_shortened = false;
+
+        for (std::size_t i = divergence.m_program.m_instructions.size(); i-- > 0 && divergence.m_program.m_instructions.size() > 1;) {
+            TestProgram candidate = divergence.m_program;
+            candidate.m_instructions.erase(candidate.m_instructions.begin() + static_cast<std::ptrdiff_t>(i));
+
+            if (std::optional<Divergence> shorter = lockstep.run(candidate)) {
+                divergence = std::move(shorter.value());
+                is_shortened = true;
+            }
+        }
+    }
+
+    for (u8 CoreState::*reg : registers) {
+        TestProgram candidate = divergence.m_program;
+        candidate.m_initial_state.*reg = 0;
+
+        if (std::optional<Divergence> simpler = lockstep.run(candidate)) {
+            divergence = std::move(simpler.value());
+        }
+    }
+
+    return divergence;
+}
+
+void DifferentialRunner::print_divergence(Divergence const& divergence, u64 program) const
+{
+    TestProgram const& reproducer = divergence.m_program;
+
+    std::string bytes;
+    for (Instruction const& instruction : reproducer.m_instructions) {
+        for (std::size_t i = 0; i < instruction.m_length; ++i) {
+            bytes += fmt::format("{:02x}", instruction.m_bytes[i]);
+        }
+        bytes += " ";
+    }
+
+    std::cout << fmt::format("\nThe cores disagreed on program {}. A shorter program they disagree on:\n\n", program);
+    std::cout << fmt::format("  Initial state:  {}\n", describe(reproducer.m_initial_state));
+    std::cout << fmt::format("  Program:        {}\n", bytes);
+    std::cout << fmt::format("  Disagreed after {} instructions, on the one at ${:04x}\n", divergence.m_step + 1, divergence.m_before.m_pc);
+    std::cout << fmt::format("  Before:         {}\n", describe(divergence.m_before));
+    std::cout << fmt::format("  {:<16}{}\n", name_of(m_first) + ":", describe(divergence.m_after[0]));
+    std::cout << fmt::format("  {:<16}{}\n", name_of(m_second) + ":", describe(divergence.m_after[1]));
+    std::cout << fmt::format("  Differences:    {}\n", describe_differences(divergence));
+}
+
+std::string DifferentialRunner::describe(CoreState const& state)
+{
+    return fmt::format(
+        "pc=${:04x} sp=${:04x} a=${:02x} b=${:02x} c=${:02x} d=${:02x} e=${:02x} h=${:02x} l=${:02x} f={}",
+        state.m_pc, state.m_sp, state.m_acc_reg, state.m_b_reg, state.m_c_reg, state.m_d_reg, state.m_e_reg,
+        state.m_h_reg, state.m_l_reg, describe_flags(state.m_flags));
+}
+
+std::string DifferentialRunner::describe_differences(Divergence const& divergence) const
+{
+    static constexpr std::array<std::pair<u16 CoreState::*, char const*>, 2> pointers = { {
+        { &CoreState::m_pc, "pc" },
+        { &CoreState::m_sp, "sp" },
+    } };
+    static constexpr std::array<std::pair<u8 CoreState::*, char const*>, 7> registers = { {
+        { &CoreState::m_acc_reg, "a" },
+        { &CoreState::m_b_reg, "b" },
+        { &CoreState::m_c_reg, "c" },
+        { &CoreState::m_d_reg, "d" },
+        { &CoreState::m_e_reg, "e" },
+        { &CoreState::m_h_reg, "h" },
+        { &CoreState::m_l_reg, "l" },
+    } };
+
+    CoreState const& first = divergence.m_after[0];
+    CoreState const& second = divergence.m_after[1];
+    std::vector<std::string> differences;
+
+    for (auto const& [pointer, name] : pointers) {
+        if (first.*pointer != second.*pointer) {
+            differences.emplace_back(name);
+        }
+    }
+    for (auto const& [reg, name] : registers) {
+        if (first.*reg != second.*reg) {
+            differences.emplace_back(name);
+        }
+    }
+
+    const u8 flags = (first.m_flags ^ second.m_flags) & divergence.m_compared_flags;
+    if (flags != 0) {
+        differences.push_back(fmt::format("the flags {} (of the compared {})", describe_flags(flags), describe_flags(divergence.m_compared_flags)));
+    }
+
+    if (divergence.m_memory_difference.has_value()) {
+        differences.push_back(fmt::format("the memory, first at ${:04x}", divergence.m_memory_difference.value()));
+    }
+
+    std::string joined;
+    for (std::string const& difference : differences) {
+        joined += joined.empty() ? difference : ", " + difference;
+    }
+
+    return joined;
+}
+
+std::string DifferentialRunner::describe_flags(u8 flags)
+{
+    static constexpr std::array<std::pair<u8, char>, 5> names = { {
+        { CoreState::s_sign, 'S' },
+        { CoreState::s_zero, 'Z' },
+        { CoreState::s_half_carry, 'H' },
+        { CoreState::s_parity, 'P' },
+        { CoreState::s_carry, 'C' },
+    } };
+
+    std::string described;
+    for (auto const& [flag, name] : names) {
+        described += (flags & flag) != 0 ? name : '-';
+    }
+
+    return described;
+}
+}
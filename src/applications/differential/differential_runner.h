@@ -0,0 +1,58 @@
+#pragma once
+
+#include "core.h"
+#include "crosscutting/typedefs.h"
+#include "test_program.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace emu::applications::differential {
+class Lockstep;
+}
+
+namespace emu::applications::differential {
+
+/**
+ * Runs a lot of programs on two cores in lockstep, spread over one thread per core of the host,
+ * and stops at the first program the cores disagree on. That program is then made as short as
+ * it can be while the cores still disagree, and is printed as a reproducer.
+ */
+class DifferentialRunner {
+public:
+    DifferentialRunner(
+        CoreKind first,
+        CoreKind second,
+        u64 program_count,
+        u64 seed,
+        std::size_t max_length,
+        std::vector<u8> corpus);
+
+    /**
+     * @return true if the cores agreed on every program
+     */
+    bool run();
+
+    static std::string name_of(CoreKind core);
+
+private:
+    static constexpr u64 s_programs_per_batch = 1024;
+
+    CoreKind m_first;
+    CoreKind m_second;
+    u64 m_program_count;
+    u64 m_seed;
+    std::size_t m_max_length;
+    std::vector<u8> m_corpus;
+
+    static Divergence minimize(Lockstep& lockstep, Divergence divergence);
+
+    void print_divergence(Divergence const& divergence, u64 program) const;
+
+    static std::string describe(CoreState const& state);
+
+    [[nodiscard]] std::string describe_differences(Divergence const& divergence) const;
+
+    static std::string describe_flags(u8 flags);
+};
+}
@@ -0,0 +1,75 @@
+#include "i8080_core.h"
+#include "chips/8080/flags.h"
+#include "chips/8080/manual_state.h"
+
+namespace emu::applications::differential {
+
+using emu::i8080::Flags;
+using emu::i8080::ManualState;
+
+I8080Core::I8080Core()
+    : m_memory(create_memory())
+    , m_cpu(m_memory, 0)
+{
+}
+
+EmulatorMemory<u16, u8> I8080Core::create_memory()
+{
+    EmulatorMemory<u16, u8> memory;
+    memory.add(std::vector<u8>(s_memory_size, 0));
+
+    return memory;
+}
+
+void I8080Core::load(CoreState const& state, std::vector<u8> const& memory)
+{
+    m_memory.clear();
+    m_memory.add(memory);
+
+    Flags flags;
+    flags.from_u8(state.m_flags);
+
+    m_cpu.set_state_manually({
+        .m_inte = false,
+        .m_sp = state.m_sp,
+        .m_pc = state.m_pc,
+        .m_acc_reg = state.m_acc_reg,
+        .m_b_reg = state.m_b_reg,
+        .m_c_reg = state.m_c_reg,
+        .m_d_reg = state.m_d_reg,
+        .m_e_reg = state.m_e_reg,
+        .m_h_reg = state.m_h_reg,
+        .m_l_reg = state.m_l_reg,
+        .m_flag_reg = flags,
+    });
+}
+
+void I8080Core::step()
+{
+    m_cpu.next_instruction();
+}
+
+CoreState I8080Core::state() const
+{
+    constexpr u8 shared_flags = CoreState::s_sign | CoreState::s_zero | CoreState::s_half_carry
+        | CoreState::s_parity | CoreState::s_carry;
+
+    return {
+        .m_pc = m_cpu.pc(),
+        .m_sp = m_cpu.sp(),
+        .m_acc_reg = m_cpu.a(),
+        .m_b_reg = m_cpu.b(),
+        .m_c_reg = m_cpu.c(),
+        .m_d_reg = m_cpu.d(),
+        .m_e_reg = m_cpu.e(),
+        .m_h_reg = m_cpu.h(),
+        .m_l_reg = m_cpu.l(),
+        .m_flags = static_cast<u8>(m_cpu.f() & shared_flags),
+    };
+}
+
+u8 const* I8080Core::memory() const
+{
+    return m_memory.begin();
+}
+}
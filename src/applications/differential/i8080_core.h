@@ -0,0 +1,31 @@
+#pragma once
+
+#include "chips/8080/cpu.h"
+#include "core.h"
+#include "crosscutting/memory/emulator_memory.h"
+#include "crosscutting/typedefs.h"
+#include <vector>
+
+namespace emu::applications::differential {
+
+using emu::memory::EmulatorMemory;
+
+class I8080Core : public Core {
+public:
+    I8080Core();
+
+    void load(CoreState const& state, std::vector<u8> const& memory) override;
+
+    void step() override;
+
+    [[nodiscard]] CoreState state() const override;
+
+    [[nodiscard]] u8 const* memory() const override;
+
+private:
+    EmulatorMemory<u16, u8> m_memory;
+    i8080::Cpu m_cpu;
+
+    static EmulatorMemory<u16, u8> create_memory();
+};
+}
@@ -0,0 +1,136 @@
+#include "lockstep.h"
+#include "i8080_core.h"
+#include "lr35902_core.h"
+#include "z80_core.h"
+#include <algorithm>
+#include <cstring>
+
+namespace emu::applications::differential {
+
+Lockstep::Lockstep(CoreKind first, CoreKind second)
+    : m_instructions(first, second)
+    , m_first(create_core(first))
+    , m_second(create_core(second))
+    , m_memory(Core::s_memory_size)
+{
+}
+
+std::unique_ptr<Core> Lockstep::create_core(CoreKind kind)
+{
+    switch (kind) {
+    case CoreKind::I8080:
+        return std::make_unique<I8080Core>();
+    case CoreKind::Z80:
+        return std::make_unique<Z80Core>();
+    default:
+        return std::make_unique<Lr35902Core>();
+    }
+}
+
+SharedInstructions const& Lockstep::instructions() const
+{
+    return m_instructions;
+}
+
+/**
+ * Bytes that look random, so that loads from memory outside the program don't all read the same
+ * value. They're derived from the address, so that a program can be run again without them.
+ */
+std::vector<u8> const& Lockstep::background()
+{
+    static const std::vector<u8> memory = []() {
+        std::vector<u8> bytes(Core::s_memory_size);
+        for (std::size_t address = 0; address < bytes.size(); ++address) {
+            bytes[address] = static_cast<u8>((address * 0x9e3779b1u) >> 24);
+        }
+        return bytes;
+    }();
+
+    return memory;
+}
+
+/**
+ * @param program is the program to run, which has to fit between its PC and the end of memory
+ * @return where the cores stopped agreeing, if they did
+ */
+std::optional<Divergence> Lockstep::run(TestProgram const& program)
+{
+    std::copy(background().begin(), background().end(), m_memory.begin());
+
+    const std::size_t start = program.m_initial_state.m_pc;
+    std::size_t end = start;
+    for (Instruction const& instruction : program.m_instructions) {
+        std::copy_n(instruction.m_bytes.begin(), instruction.m_length, m_memory.begin() + static_cast<std::ptrdiff_t>(end));
+        end += instruction.m_length;
+    }
+
+    CoreState before = program.m_initial_state;
+    before.m_flags &= m_instructions.flags();
+    m_first->load(before, m_memory);
+    m_second->load(before, m_memory);
+
+    u8 known_flags = m_instructions.flags();
+    const std::size_t max_steps = s_steps_per_instruction * program.m_instructions.size();
+
+    for (std::size_t step = 0; step < max_steps; ++step) {
+        const u16 pc = before.m_pc;
+        if (pc < start || pc >= end) {
+            return std::nullopt;
+        }
+
+        InstructionRule const& rule = m_instructions.rule(m_first->memory()[pc]);
+        if (!rule.m_is_shared || pc + rule.m_length > end || (rule.m_read_flags & ~known_flags) != 0) {
+            return std::nullopt;
+        }
+
+        m_first->step();
+        m_second->step();
+        known_flags = (known_flags & rule.m_preserved_flags) | (rule.m_defined_flags & m_instructions.flags());
+
+        const CoreState first_after = m_first->state();
+        const CoreState second_after = m_second->state();
+        const std::optional<u16> memory_difference = find_memory_difference();
+
+        if (!agree(first_after, second_after, known_flags) || memory_difference.has_value()) {
+            return Divergence {
+                .m_program = program,
+                .m_step = step,
+                .m_before = before,
+                .m_after = { first_after, second_after },
+                .m_compared_flags = known_flags,
+                .m_memory_difference = memory_difference,
+            };
+        }
+
+        before = first_after;
+    }
+
+    return std::nullopt;
+}
+
+bool Lockstep::agree(CoreState const& first, CoreState const& second, u8 flags)
+{
+    return first.m_pc == second.m_pc
+        && first.m_sp == second.m_sp
+        && first.m_acc_reg == second.m_acc_reg
+        && first.m_b_reg == second.m_b_reg
+        && first.m_c_reg == second.m_c_reg
+        && first.m_d_reg == second.m_d_reg
+        && first.m_e_reg == second.m_e_reg
+        && first.m_h_reg == second.m_h_reg
+        && first.m_l_reg == second.m_l_reg
+        && (first.m_flags & flags) == (second.m_flags & flags);
+}
+
+std::optional<u16> Lockstep::find_memory_difference() const
+{
+    u8 const* first = m_first->memory();
+    u8 const* second = m_second->memory();
+
+    if (std::memcmp(first, second, Core::s_memory_size) == 0) {
+        return std::nullopt;
+    }
+
+    return static_cast<u16>(std::mismatch(first, first + Core::s_memory_size, second).first - first);
+}
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "core.h"
+#include "crosscutting/typedefs.h"
+#include "shared_instructions.h"
+#include "test_program.h"
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace emu::applications::differential {
+
+/**
+ * Runs a program on two cores at the same time, one instruction at a time, and compares the
+ * registers, the flags and the memory of the cores after every instruction.
+ *
+ * The program ends when the PC leaves it, when it gets to an instruction the cores don't share,
+ * or when it has run for a while without leaving, to stop loops.
+ */
+class Lockstep {
+public:
+    Lockstep(CoreKind first, CoreKind second);
+
+    [[nodiscard]] std::optional<Divergence> run(TestProgram const& program);
+
+    [[nodiscard]] SharedInstructions const& instructions() const;
+
+    /**
+     * @return the memory every program is put into, which is the same for every run
+     */
+    static std::vector<u8> const& background();
+
+private:
+    static constexpr std::size_t s_steps_per_instruction = 4;
+
+    SharedInstructions m_instructions;
+    std::unique_ptr<Core> m_first;
+    std::unique_ptr<Core> m_second;
+    std::vector<u8> m_memory;
+
+    static std::unique_ptr<Core> create_core(CoreKind kind);
+
+    static bool agree(CoreState const& first, CoreState const& second, u8 flags);
+
+    [[nodiscard]] std::optional<u16> find_memory_difference() const;
+};
+}
@@ -0,0 +1,94 @@
+#include "lr35902_core.h"
+#include "chips/lr35902/flags.h"
+#include "chips/lr35902/manual_state.h"
+
+namespace emu::applications::differential {
+
+using emu::lr35902::Flags;
+
+Lr35902Core::Lr35902Core()
+    : m_memory(create_memory())
+    , m_cpu(m_memory, 0)
+{
+}
+
+EmulatorMemory<u16, u8> Lr35902Core::create_memory()
+{
+    EmulatorMemory<u16, u8> memory;
+    memory.add(std::vector<u8>(s_memory_size, 0));
+
+    return memory;
+}
+
+void Lr35902Core::load(CoreState const& state, std::vector<u8> const& memory)
+{
+    m_memory.clear();
+    m_memory.add(memory);
+
+    Flags flags;
+    flags.from_u8(to_lr35902_flags(state.m_flags));
+
+    m_cpu.set_state_manually({
+        .m_ime = false,
+        .m_ie = false,
+        .m_sp = state.m_sp,
+        .m_pc = state.m_pc,
+        .m_acc_reg = state.m_acc_reg,
+        .m_b_reg = state.m_b_reg,
+        .m_c_reg = state.m_c_reg,
+        .m_d_reg = state.m_d_reg,
+        .m_e_reg = state.m_e_reg,
+        .m_h_reg = state.m_h_reg,
+        .m_l_reg = state.m_l_reg,
+        .m_flag_reg = flags,
+    });
+}
+
+void Lr35902Core::step()
+{
+    m_cpu.next_instruction();
+}
+
+CoreState Lr35902Core::state() const
+{
+    return {
+        .m_pc = m_cpu.pc(),
+        .m_sp = m_cpu.sp(),
+        .m_acc_reg = m_cpu.a(),
+        .m_b_reg = m_cpu.b(),
+        .m_c_reg = m_cpu.c(),
+        .m_d_reg = m_cpu.d(),
+        .m_e_reg = m_cpu.e(),
+        .m_h_reg = m_cpu.h(),
+        .m_l_reg = m_cpu.l(),
+        .m_flags = from_lr35902_flags(m_cpu.f()),
+    };
+}
+
+u8 const* Lr35902Core::memory() const
+{
+    return m_memory.begin();
+}
+
+/**
+ * The LR35902 has Z, N, H and C in the upper nibble. It has neither sign nor parity, so those are
+ * dropped, and N is cleared.
+ */
+u8 Lr35902Core::to_lr35902_flags(u8 shared_flags)
+{
+    const u8 z = (shared_flags & CoreState::s_zero) != 0 ? s_zero : 0;
+    const u8 h = (shared_flags & CoreState::s_half_carry) != 0 ? s_half_carry : 0;
+    const u8 c = (shared_flags & CoreState::s_carry) != 0 ? s_carry : 0;
+
+    return z | h | c;
+}
+
+u8 Lr35902Core::from_lr35902_flags(u8 flags)
+{
+    const u8 z = (flags & s_zero) != 0 ? CoreState::s_zero : 0;
+    const u8 h = (flags & s_half_carry) != 0 ? CoreState::s_half_carry : 0;
+    const u8 c = (flags & s_carry) != 0 ? CoreState::s_carry : 0;
+
+    return z | h | c;
+}
+}
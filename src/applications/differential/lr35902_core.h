@@ -0,0 +1,39 @@
+#pragma once
+
+#include "chips/lr35902/cpu.h"
+#include "core.h"
+#include "crosscutting/memory/emulator_memory.h"
+#include "crosscutting/typedefs.h"
+#include <vector>
+
+namespace emu::applications::differential {
+
+using emu::memory::EmulatorMemory;
+
+class Lr35902Core : public Core {
+public:
+    Lr35902Core();
+
+    void load(CoreState const& state, std::vector<u8> const& memory) override;
+
+    void step() override;
+
+    [[nodiscard]] CoreState state() const override;
+
+    [[nodiscard]] u8 const* memory() const override;
+
+private:
+    static constexpr u8 s_zero = 1 << 7;
+    static constexpr u8 s_half_carry = 1 << 5;
+    static constexpr u8 s_carry = 1 << 4;
+
+    EmulatorMemory<u16, u8> m_memory;
+    lr35902::Cpu m_cpu;
+
+    static EmulatorMemory<u16, u8> create_memory();
+
+    static u8 to_lr35902_flags(u8 shared_flags);
+
+    static u8 from_lr35902_flags(u8 flags);
+};
+}
@@ -0,0 +1,110 @@
+#include "program_generator.h"
+#include "shared_instructions.h"
+#include <utility>
+
+namespace emu::applications::differential {
+
+ProgramGenerator::ProgramGenerator(SharedInstructions const& instructions, std::size_t max_length, std::vector<u8> corpus)
+    : m_instructions(instructions)
+    , m_max_length(max_length)
+    , m_corpus(std::move(corpus))
+{
+}
+
+TestProgram ProgramGenerator::generate(u64 seed) const
+{
+    u64 random_state = seed;
+    const std::size_t length = 1 + next_random(random_state) % m_max_length;
+
+    std::vector<Instruction> instructions = corpus_instructions(random_state, length);
+    if (instructions.empty()) {
+        instructions = random_instructions(random_state, length);
+    }
+
+    std::size_t size = 0;
+    for (Instruction const& instruction : instructions) {
+        size += instruction.m_length;
+    }
+
+    const u64 registers = next_random(random_state);
+    const u64 pointers = next_random(random_state);
+
+    return {
+        .m_initial_state = {
+            .m_pc = static_cast<u16>(pointers % (Core::s_memory_size - size + 1)),
+            .m_sp = static_cast<u16>(pointers >> 32),
+            .m_acc_reg = static_cast<u8>(registers),
+            .m_b_reg = static_cast<u8>(registers >> 8),
+            .m_c_reg = static_cast<u8>(registers >> 16),
+            .m_d_reg = static_cast<u8>(registers >> 24),
+            .m_e_reg = static_cast<u8>(registers >> 32),
+            .m_h_reg = static_cast<u8>(registers >> 40),
+            .m_l_reg = static_cast<u8>(registers >> 48),
+            .m_flags = static_cast<u8>((registers >> 56) & m_instructions.flags()),
+        },
+        .m_instructions = std::move(instructions),
+    };
+}
+
+std::vector<Instruction> ProgramGenerator::random_instructions(u64& random_state, std::size_t length) const
+{
+    std::vector<u8> const& opcodes = m_instructions.opcodes();
+    std::vector<Instruction> instructions;
+
+    for (std::size_t i = 0; i < length; ++i) {
+        const u64 random = next_random(random_state);
+        const u8 opcode = opcodes[random % opcodes.size()];
+        instructions.push_back({
+            .m_bytes = { opcode, static_cast<u8>(random >> 32), static_cast<u8>(random >> 40) },
+            .m_length = m_instructions.rule(opcode).m_length,
+        });
+    }
+
+    return instructions;
+}
+
+/**
+ * Decodes the corpus from a random place, until it gets to an instruction that isn't shared. A
+ * few places are tried, since code is often full of instructions only one of the cores has.
+ *
+ * @return the instructions, or nothing if there is no corpus or no place had shared instructions
+ */
+std::vector<Instruction> ProgramGenerator::corpus_instructions(u64& random_state, std::size_t length) const
+{
+    std::vector<Instruction> instructions;
+
+    for (std::size_t attempt = 0; attempt < s_corpus_attempts && instructions.empty() && !m_corpus.empty(); ++attempt) {
+        std::size_t position = next_random(random_state) % m_corpus.size();
+
+        while (instructions.size() < length && position < m_corpus.size()) {
+            InstructionRule const& rule = m_instructions.rule(m_corpus[position]);
+            if (!rule.m_is_shared || position + rule.m_length > m_corpus.size()) {
+                break;
+            }
+
+            Instruction instruction { .m_bytes = { 0, 0, 0 }, .m_length = rule.m_length };
+            for (std::size_t i = 0; i < rule.m_length; ++i) {
+                instruction.m_bytes[i] = m_corpus[position + i];
+            }
+            instructions.push_back(instruction);
+            position += rule.m_length;
+        }
+    }
+
+    return instructions;
+}
+
+/**
+ * SplitMix64, which is fast and needs no more state than one number, so every program can have a
+ * generator of its own that is seeded with the number of the program.
+ */
+u64 ProgramGenerator::next_random(u64& random_state)
+{
+    random_state += 0x9e3779b97f4a7c15;
+    u64 z = random_state;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+
+    return z ^ (z >> 31);
+}
+}
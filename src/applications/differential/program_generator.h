@@ -0,0 +1,38 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include "test_program.h"
+#include <cstddef>
+#include <vector>
+
+namespace emu::applications::differential {
+class SharedInstructions;
+}
+
+namespace emu::applications::differential {
+
+/**
+ * Makes programs out of the instructions two cores share, with registers and flags that are
+ * random. The instructions are either random too, or taken from a corpus of real code, like a
+ * ROM, from a random place in it. The same seed always gives the same program.
+ */
+class ProgramGenerator {
+public:
+    ProgramGenerator(SharedInstructions const& instructions, std::size_t max_length, std::vector<u8> corpus);
+
+    [[nodiscard]] TestProgram generate(u64 seed) const;
+
+private:
+    static constexpr std::size_t s_corpus_attempts = 16;
+
+    SharedInstructions const& m_instructions;
+    std::size_t m_max_length;
+    std::vector<u8> m_corpus;
+
+    [[nodiscard]] std::vector<Instruction> random_instructions(u64& random_state, std::size_t length) const;
+
+    [[nodiscard]] std::vector<Instruction> corpus_instructions(u64& random_state, std::size_t length) const;
+
+    static u64 next_random(u64& random_state);
+};
+}
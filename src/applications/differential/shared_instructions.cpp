@@ -0,0 +1,153 @@
+#include "shared_instructions.h"
+#include <cstddef>
+
+namespace emu::applications::differential {
+
+static constexpr u8 sign = CoreState::s_sign;
+static constexpr u8 zero = CoreState::s_zero;
+static constexpr u8 parity = CoreState::s_parity;
+static constexpr u8 carry = CoreState::s_carry;
+
+/**
+ * The instructions every core has are in the opcodes of the 8080, so the 8080 names are used.
+ * HLT, DAA, IN, OUT, DI, EI, PUSH PSW and the prefixes are left out. DAA on the Z80 and the LR35902
+ * depends on the N flag, which the 8080 doesn't have, and PUSH PSW would write flags that are
+ * allowed to differ into memory.
+ */
+const std::vector<SharedInstructions::InstructionGroup> SharedInstructions::s_groups = {
+    // NOP
+    { { 0x00 }, 1, 0, { "-----", "-----", "n--n-" } },
+    // LXI
+    { { 0x01, 0x11, 0x21, 0x31 }, 3, 0, { "-----", "-----", "n--n-" } },
+    // STAX and LDAX
+    { { 0x02, 0x12, 0x0a, 0x1a }, 1, 0, { "-----", "-----", "n--n-" } },
+    // INX and DCX
+    { { 0x03, 0x13, 0x23, 0x33, 0x0b, 0x1b, 0x2b, 0x3b }, 1, 0, { "-----", "-----", "n--n-" } },
+    // INR
+    { { 0x04, 0x0c, 0x14, 0x1c, 0x24, 0x2c, 0x34, 0x3c }, 1, 0, { "rrhp-", "rrhv-", "nrhn-" } },
+    // DCR
+    { { 0x05, 0x0d, 0x15, 0x1d, 0x25, 0x2d, 0x35, 0x3d }, 1, 0, { "rrxp-", "rrbv-", "nrbn-" } },
+    // MVI
+    { { 0x06, 0x0e, 0x16, 0x1e, 0x26, 0x2e, 0x36, 0x3e }, 2, 0, { "-----", "-----", "n--n-" } },
+    // RLC and RRC
+    { { 0x07, 0x0f }, 1, 0, { "----r", "--0-r", "n00nr" } },
+    // RAL and RAR
+    { { 0x17, 0x1f }, 1, carry, { "----r", "--0-r", "n00nr" } },
+    // DAD
+    { { 0x09, 0x19, 0x29, 0x39 }, 1, 0, { "----r", "--h-r", "n-hnr" } },
+    // SHLD, LHLD, STA and LDA
+    { { 0x22, 0x2a, 0x32, 0x3a }, 3, 0, { "-----", "-----", "" } },
+    // CMA
+    { { 0x2f }, 1, 0, { "-----", "--1--", "n-1n-" } },
+    // STC
+    { { 0x37 }, 1, 0, { "----1", "--0-1", "n-0n1" } },
+    // CMC
+    { { 0x3f }, 1, carry, { "----r", "--c-r", "n-0nr" } },
+    // MOV
+    { { 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+        0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+        0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+        0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f },
+        1, 0, { "-----", "-----", "n--n-" } },
+    // ADD and ADI
+    { { 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87 }, 1, 0, { "rrhpr", "rrhvr", "nrhnr" } },
+    { { 0xc6 }, 2, 0, { "rrhpr", "rrhvr", "nrhnr" } },
+    // ADC and ACI
+    { { 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f }, 1, carry, { "rrhpr", "rrhvr", "nrhnr" } },
+    { { 0xce }, 2, carry, { "rrhpr", "rrhvr", "nrhnr" } },
+    // SUB, SUI, CMP and CPI
+    { { 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+        0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf }, 1, 0, { "rrxpr", "rrbvr", "nrbnr" } },
+    { { 0xd6, 0xfe }, 2, 0, { "rrxpr", "rrbvr", "nrbnr" } },
+    // SBB and SBI
+    { { 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f }, 1, carry, { "rrxpr", "rrbvr", "nrbnr" } },
+    { { 0xde }, 2, carry, { "rrxpr", "rrbvr", "nrbnr" } },
+    // ANA and ANI
+    { { 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7 }, 1, 0, { "rrxp0", "rr1p0", "nr1n0" } },
+    { { 0xe6 }, 2, 0, { "rrxp0", "rr1p0", "nr1n0" } },
+    // XRA, XRI, ORA and ORI
+    { { 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+        0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7 }, 1, 0, { "rr0p0", "rr0p0", "nr0n0" } },
+    { { 0xee, 0xf6 }, 2, 0, { "rr0p0", "rr0p0", "nr0n0" } },
+    // Conditional returns
+    { { 0xc0, 0xc8 }, 1, zero, { "-----", "-----", "n--n-" } },
+    { { 0xd0, 0xd8 }, 1, carry, { "-----", "-----", "n--n-" } },
+    { { 0xe0, 0xe8 }, 1, parity, { "-----", "-----", "" } },
+    { { 0xf0, 0xf8 }, 1, sign, { "-----", "-----", "" } },
+    // Conditional jumps
+    { { 0xc2, 0xca }, 3, zero, { "-----", "-----", "n--n-" } },
+    { { 0xd2, 0xda }, 3, carry, { "-----", "-----", "n--n-" } },
+    { { 0xe2, 0xea }, 3, parity, { "-----", "-----", "" } },
+    { { 0xf2, 0xfa }, 3, sign, { "-----", "-----", "" } },
+    // Conditional calls
+    { { 0xc4, 0xcc }, 3, zero, { "-----", "-----", "n--n-" } },
+    { { 0xd4, 0xdc }, 3, carry, { "-----", "-----", "n--n-" } },
+    { { 0xe4, 0xec }, 3, parity, { "-----", "-----", "" } },
+    { { 0xf4, 0xfc }, 3, sign, { "-----", "-----", "" } },
+    // PUSH and POP, but not of PSW
+    { { 0xc1, 0xd1, 0xe1, 0xc5, 0xd5, 0xe5 }, 1, 0, { "-----", "-----", "n--n-" } },
+    // POP PSW, which has the flags in different bits on the LR35902
+    { { 0xf1 }, 1, 0, { "mmmmm", "mmmmm", "" } },
+    // JMP and CALL
+    { { 0xc3, 0xcd }, 3, 0, { "-----", "-----", "n--n-" } },
+    // RET, RST, PCHL and SPHL
+    { { 0xc9, 0xc7, 0xcf, 0xd7, 0xdf, 0xe7, 0xef, 0xf7, 0xff, 0xe9, 0xf9 }, 1, 0, { "-----", "-----", "n--n-" } },
+    // XTHL and XCHG
+    { { 0xe3, 0xeb }, 1, 0, { "-----", "-----", "" } },
+    // The relative jumps, which the 8080 doesn't have
+    { { 0x18 }, 2, 0, { "", "-----", "n--n-" } },
+    { { 0x20, 0x28 }, 2, zero, { "", "-----", "n--n-" } },
+    { { 0x30, 0x38 }, 2, carry, { "", "-----", "n--n-" } },
+};
+
+SharedInstructions::SharedInstructions(CoreKind first, CoreKind second)
+    : m_flags(flags_of(first) & flags_of(second))
+{
+    for (InstructionGroup const& group : s_groups) {
+        std::string_view const& first_effects = group.m_effects[static_cast<std::size_t>(first)];
+        std::string_view const& second_effects = group.m_effects[static_cast<std::size_t>(second)];
+        if (first_effects.empty() || second_effects.empty()) {
+            continue;
+        }
+
+        InstructionRule rule { .m_is_shared = true, .m_length = group.m_length, .m_read_flags = group.m_read_flags };
+        for (std::size_t i = 0; i < s_flag_order.size(); ++i) {
+            const char first_effect = first_effects[i];
+            const char second_effect = second_effects[i];
+
+            if (first_effect == 'n' || second_effect == 'n') {
+                continue;
+            } else if (first_effect == '-' && second_effect == '-') {
+                rule.m_preserved_flags |= s_flag_order[i];
+            } else if (first_effect == second_effect && first_effect != '-' && first_effect != 'x') {
+                rule.m_defined_flags |= s_flag_order[i];
+            }
+        }
+
+        for (u8 opcode : group.m_opcodes) {
+            m_rules[opcode] = rule;
+            m_opcodes.push_back(opcode);
+        }
+    }
+}
+
+std::vector<u8> const& SharedInstructions::opcodes() const
+{
+    return m_opcodes;
+}
+
+u8 SharedInstructions::flags() const
+{
+    return m_flags;
+}
+
+u8 SharedInstructions::flags_of(CoreKind core)
+{
+    switch (core) {
+    case CoreKind::LR35902:
+        return CoreState::s_zero | CoreState::s_half_carry | CoreState::s_carry;
+    default:
+        return CoreState::s_sign | CoreState::s_zero | CoreState::s_half_carry | CoreState::s_parity | CoreState::s_carry;
+    }
+}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "core.h"
+#include "crosscutting/typedefs.h"
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace emu::applications::differential {
+
+/**
+ * How one opcode is compared when it's run on two cores.
+ */
+struct InstructionRule {
+    bool m_is_shared { false };
+    u8 m_length { 1 };
+    u8 m_defined_flags { 0 };   // Flags both cores set the same way
+    u8 m_preserved_flags { 0 }; // Flags neither core changes
+    u8 m_read_flags { 0 };      // Flags the outcome depends on
+};
+
+/**
+ * The opcodes two cores have in common, and which of the flags they agree on after each of them.
+ *
+ * The cores are only expected to agree where the real CPUs do. The Z80 sets P/V to overflow where
+ * the 8080 sets P to parity, for example, so P isn't compared after an ADD on those two. A flag
+ * the cores disagree on is unknown until an instruction defines it again, and a program stops
+ * before an instruction that reads an unknown flag, like JPE after an ADD.
+ */
+class SharedInstructions {
+public:
+    SharedInstructions(CoreKind first, CoreKind second);
+
+    [[nodiscard]] InstructionRule const& rule(u8 opcode) const
+    {
+        return m_rules[opcode];
+    }
+
+    [[nodiscard]] std::vector<u8> const& opcodes() const;
+
+    /**
+     * @return the flags both cores have, in the layout of CoreState
+     */
+    [[nodiscard]] u8 flags() const;
+
+private:
+    /**
+     * A group of opcodes that work the same way. The effects are one character per flag, in the
+     * order S, Z, H, P and C, with one string per core in the order of CoreKind:
+     *
+     *   - : the flag is left as it was
+     *   n : the core doesn't have the flag
+     *   x : the flag is set in a way no other core sets it
+     *
+     * Any other character is a way of setting the flag, like p for parity and v for overflow. Two
+     * cores agree on a flag if they set it the same way. A core that doesn't have the
+     * instructions at all has an empty string.
+     */
+    struct InstructionGroup {
+        std::vector<u8> m_opcodes;
+        u8 m_length;
+        u8 m_read_flags;
+        std::array<std::string_view, 3> m_effects;
+    };
+
+    static constexpr std::array<u8, 5> s_flag_order = {
+        CoreState::s_sign, CoreState::s_zero, CoreState::s_half_carry, CoreState::s_parity, CoreState::s_carry
+    };
+
+    static const std::vector<InstructionGroup> s_groups;
+
+    std::array<InstructionRule, 256> m_rules;
+    std::vector<u8> m_opcodes;
+    u8 m_flags { 0 };
+
+    static u8 flags_of(CoreKind core);
+};
+}
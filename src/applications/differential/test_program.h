@@ -0,0 +1,38 @@
+#pragma once
+
+#include "core.h"
+#include "crosscutting/typedefs.h"
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace emu::applications::differential {
+
+struct Instruction {
+    std::array<u8, 3> m_bytes;
+    u8 m_length;
+};
+
+/**
+ * A program to run on both cores. It's placed at the PC of the initial state, and the rest of the
+ * memory is the same every time, so the program and the initial state are all it takes to run it
+ * again.
+ */
+struct TestProgram {
+    CoreState m_initial_state;
+    std::vector<Instruction> m_instructions;
+};
+
+/**
+ * Where the cores stopped agreeing, and what they had done up to then.
+ */
+struct Divergence {
+    TestProgram m_program;
+    std::size_t m_step;                     // How many instructions had been run before the one that diverged
+    CoreState m_before;                     // The state of both cores before the instruction that diverged
+    std::array<CoreState, 2> m_after;       // The state of each of the cores after it
+    u8 m_compared_flags;                    // The flags the cores were expected to agree on after it
+    std::optional<u16> m_memory_difference; // The first address the memory differed at, if it did
+};
+}
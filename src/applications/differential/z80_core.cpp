@@ -0,0 +1,76 @@
+#include "z80_core.h"
+#include "chips/z80/flags.h"
+#include "chips/z80/manual_state.h"
+
+namespace emu::applications::differential {
+
+using emu::z80::ManualState;
+
+Z80Core::Z80Core()
+    : m_memory(create_memory())
+    , m_cpu(m_memory, 0)
+{
+}
+
+EmulatorMemory<u16, u8> Z80Core::create_memory()
+{
+    EmulatorMemory<u16, u8> memory;
+    memory.add(std::vector<u8>(s_memory_size, 0));
+
+    return memory;
+}
+
+/**
+ * The Z80 has the flags of the 8080 in the same bits, so the shared flags are used as they are.
+ * The flags only the Z80 has are cleared.
+ */
+void Z80Core::load(CoreState const& state, std::vector<u8> const& memory)
+{
+    m_memory.clear();
+    m_memory.add(memory);
+
+    ManualState manual_state = m_cpu.manual_state();
+    manual_state.m_iff1 = false;
+    manual_state.m_iff2 = false;
+    manual_state.m_sp = state.m_sp;
+    manual_state.m_pc = state.m_pc;
+    manual_state.m_acc_reg = state.m_acc_reg;
+    manual_state.m_b_reg = state.m_b_reg;
+    manual_state.m_c_reg = state.m_c_reg;
+    manual_state.m_d_reg = state.m_d_reg;
+    manual_state.m_e_reg = state.m_e_reg;
+    manual_state.m_h_reg = state.m_h_reg;
+    manual_state.m_l_reg = state.m_l_reg;
+    manual_state.m_flag_reg.from_u8(state.m_flags);
+    m_cpu.set_state_manually(manual_state);
+}
+
+void Z80Core::step()
+{
+    m_cpu.next_instruction();
+}
+
+CoreState Z80Core::state() const
+{
+    constexpr u8 shared_flags = CoreState::s_sign | CoreState::s_zero | CoreState::s_half_carry
+        | CoreState::s_parity | CoreState::s_carry;
+
+    return {
+        .m_pc = m_cpu.pc(),
+        .m_sp = m_cpu.sp(),
+        .m_acc_reg = m_cpu.a(),
+        .m_b_reg = m_cpu.b(),
+        .m_c_reg = m_cpu.c(),
+        .m_d_reg = m_cpu.d(),
+        .m_e_reg = m_cpu.e(),
+        .m_h_reg = m_cpu.h(),
+        .m_l_reg = m_cpu.l(),
+        .m_flags = static_cast<u8>(m_cpu.f() & shared_flags),
+    };
+}
+
+u8 const* Z80Core::memory() const
+{
+    return m_memory.begin();
+}
+}
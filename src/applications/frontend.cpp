@@ -2,20 +2,27 @@
 #include "applications/cpm_8080/cpm_application.h"
 #include "applications/cpm_8080/usage.h"
 #include "applications/cpm_z80/cpm_application.h"
+#include "applications/differential/differential_runner.h"
 #include "applications/game_boy/game_boy.h"
 #include "applications/game_boy/settings.h"
 #include "applications/game_boy/usage.h"
+#include "applications/lmc_application/batch_grader.h"
 #include "applications/lmc_application/lmc_application.h"
 #include "applications/lmc_application/usage.h"
 #include "applications/pacman/pacman.h"
 #include "applications/pacman/settings.h"
 #include "applications/pacman/usage.h"
+#include "applications/single_step/i8080_single_step_core.h"
+#include "applications/single_step/lr35902_single_step_core.h"
+#include "applications/single_step/single_step_runner.h"
+#include "applications/single_step/z80_single_step_core.h"
 #include "applications/space_invaders/settings.h"
 #include "applications/space_invaders/space_invaders.h"
 #include "applications/space_invaders/usage.h"
 #include "applications/synacor_application/synacor_application.h"
 #include "applications/synacor_application/usage.h"
 #include "applications/zxspectrum_48k/formats/z80_format.h"
+#include "applications/zxspectrum_48k/model.h"
 #include "applications/zxspectrum_48k/settings.h"
 #include "applications/zxspectrum_48k/usage.h"
 #include "applications/zxspectrum_48k/zxspectrum_48k.h"
@@ -23,6 +30,7 @@
 #include "chips/lr35902/disassembler.h"
 #include "chips/trivial/synacor/disassembler.h"
 #include "chips/z80/disassembler.h"
+#include "crosscutting/benchmarking/benchmark_runner.h"
 #include "crosscutting/exceptions/invalid_program_arguments_exception.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/misc/emulator.h"
@@ -56,6 +64,12 @@ void Frontend::run(Options const& options)
         disassemble(options);
     } else if (command == "test") {
         test(options);
+    } else if (command == "differential") {
+        differential(options);
+    } else if (command == "single-step") {
+        single_step(options);
+    } else if (command == "benchmark") {
+        benchmark(options);
     } else {
         throw InvalidProgramArgumentsException(
             fmt::format("Unknown command: {}", command),
@@ -234,6 +248,7 @@ void Frontend::test(Options const& options)
             context.addFilter("test-case", "Z80*");
             context.addFilter("test-case", "LMC*");
             context.addFilter("test-case", "Synacor*");
+            context.addFilter("test-case", "AY-3-8912*");
         } else {
             for (std::string& cpu : opts["cpu"]) {
                 context.addFilter("test-case", fmt::format("{}*", cpu).c_str());
@@ -250,6 +265,132 @@ void Frontend::test(Options const& options)
     }
 }
 
+void Frontend::differential(Options const& options)
+{
+    using emu::util::file::read_file_into_vector;
+
+    if (options.is_asking_for_help().first) {
+        print_differential_usage(options.short_executable_name());
+    } else {
+        std::unordered_map<std::string, std::vector<std::string>> opts = options.options();
+        if (!opts.contains("cpu") || opts["cpu"].size() != 2) {
+            throw InvalidProgramArgumentsException(
+                "Two CPUs have to be provided on the following format: --cpu=<CPU> --cpu=<CPU>",
+                Frontend::print_differential_usage);
+        }
+
+        const differential::CoreKind first = differential_core(opts["cpu"][0]);
+        const differential::CoreKind second = differential_core(opts["cpu"][1]);
+        if (first == second) {
+            throw InvalidProgramArgumentsException(
+                "The two CPUs have to be different",
+                Frontend::print_differential_usage);
+        }
+
+        const u64 length = differential_number(options, "length", s_default_differential_length);
+        if (length == 0) {
+            throw InvalidProgramArgumentsException(
+                "A program has to have at least one instruction",
+                Frontend::print_differential_usage);
+        }
+
+        differential::DifferentialRunner runner(
+            first,
+            second,
+            differential_number(options, "programs", s_default_differential_programs),
+            differential_number(options, "seed", s_default_differential_seed),
+            length,
+            options.path().has_value() ? read_file_into_vector(options.path().value()) : std::vector<u8> {});
+
+        exit(runner.run() ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+}
+
+void Frontend::single_step(Options const& options)
+{
+    using namespace single_step;
+
+    if (options.is_asking_for_help().first) {
+        print_single_step_usage(options.short_executable_name());
+    } else {
+        std::unordered_map<std::string, std::vector<std::string>> opts = options.options();
+        if (!opts.contains("cpu") || opts["cpu"].size() != 1) {
+            throw InvalidProgramArgumentsException(
+                "One CPU has to be provided on the following format: --cpu=<CPU>",
+                Frontend::print_single_step_usage);
+        }
+        if (!options.path().has_value()) {
+            throw InvalidProgramArgumentsException(
+                "The path to a test file or a directory of them has to be provided",
+                Frontend::print_single_step_usage);
+        }
+
+        std::function<std::unique_ptr<SingleStepCore>()> create_core;
+        std::string const& cpu = opts["cpu"][0];
+        if (cpu == "8080") {
+            create_core = []() { return std::make_unique<I8080SingleStepCore>(); };
+        } else if (cpu == "Z80") {
+            create_core = []() { return std::make_unique<Z80SingleStepCore>(); };
+        } else if (cpu == "LR35902") {
+            create_core = []() { return std::make_unique<Lr35902SingleStepCore>(); };
+        } else {
+            throw InvalidProgramArgumentsException(
+                fmt::format("Invalid CPU: {}", cpu),
+                Frontend::print_single_step_usage);
+        }
+
+        SingleStepRunner runner(create_core, options.path().value(), !opts.contains("ignore-cycles"));
+
+        exit(runner.run() ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+}
+
+void Frontend::benchmark(Options const& options)
+{
+    using emu::benchmarking::BenchmarkResult;
+    using emu::benchmarking::BenchmarkRunner;
+
+    if (options.is_asking_for_help().first) {
+        print_benchmark_usage(options.short_executable_name());
+    } else {
+        std::unordered_map<std::string, std::vector<std::string>> opts = options.options();
+        for (char const* flag : { "save", "baseline", "threshold" }) {
+            if (opts.contains(flag) && (opts[flag].size() != 1 || opts[flag][0].empty())) {
+                throw InvalidProgramArgumentsException(
+                    fmt::format("The {0} has to be provided once, on the following format: --{0}=<VALUE>", flag),
+                    Frontend::print_benchmark_usage);
+            }
+        }
+
+        u64 threshold = s_default_benchmark_threshold;
+        if (opts.contains("threshold")) {
+            std::string const& value = opts["threshold"][0];
+            if (!std::all_of(value.begin(), value.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+                throw InvalidProgramArgumentsException(
+                    "The threshold has to be provided on the following format: --threshold=<PERCENT>",
+                    Frontend::print_benchmark_usage);
+            }
+            threshold = std::stoull(value);
+        }
+
+        // Read before running, so that a wrong path is found before the benchmarks have taken their time
+        const std::vector<BenchmarkResult> baseline = opts.contains("baseline")
+            ? BenchmarkRunner::load(opts["baseline"][0])
+            : std::vector<BenchmarkResult> {};
+
+        const std::vector<BenchmarkResult> results = BenchmarkRunner(opts["filter"]).run();
+
+        if (opts.contains("save")) {
+            BenchmarkRunner::save(opts["save"][0], results);
+        }
+
+        if (opts.contains("baseline")) {
+            const bool has_no_regressions = BenchmarkRunner::compare(results, baseline, static_cast<double>(threshold), std::cout);
+            exit(has_no_regressions ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+    }
+}
+
 void Frontend::print_run_usage(std::string const& program_name)
 {
     std::cout << "\nUsage: ./" << program_name << " run APPLICATION [FLAGS]\n\n";
@@ -325,6 +466,93 @@ void Frontend::print_test_usage(std::string const& program_name)
     }
 }
 
+void Frontend::print_differential_usage(std::string const& program_name)
+{
+    std::cout << "\nUsage: ./" << program_name << " differential --cpu=<CPU> --cpu=<CPU> [FLAGS] [CORPUS_PATH]\n\n";
+    std::cout << "Run the same programs on two CPUs, one instruction at a time, and stop at the first\n"
+                 "instruction they disagree on. Only the instructions the CPUs share are used, and only\n"
+                 "the flags they set the same way are compared. The programs are random, or taken from\n"
+                 "the file at CORPUS_PATH if it's given.\n\n";
+
+    std::cout << "CPUs:\n";
+
+    for (auto& cpu_description : s_8080_family_cpus) {
+        std::string padding = create_padding(cpu_description.first.size(), s_padding_to_description);
+        std::cout << "  " << cpu_description.first << padding << cpu_description.second << "\n";
+    }
+
+    std::cout << "\nFlags:\n";
+
+    for (auto& flag_description : s_differential_flags) {
+        std::string padding = create_padding(flag_description.first.size(), s_padding_to_description);
+        std::cout << "  " << flag_description.first << padding << flag_description.second << "\n";
+    }
+
+    std::cout << "\nExamples:\n";
+
+    for (auto& example_description : s_differential_examples) {
+        std::cout << "  " << example_description.second << ":\n";
+        std::cout << "    "
+                  << "./" << program_name << " differential " << example_description.first << "\n\n";
+    }
+}
+
+void Frontend::print_single_step_usage(std::string const& program_name)
+{
+    std::cout << "\nUsage: ./" << program_name << " single-step --cpu=<CPU> [FLAGS] PATH\n\n";
+    std::cout << "Run single step tests, which test one instruction at a time against the state before and\n"
+                 "after it. PATH is a JSON file with the tests of one opcode, or a directory of them.\n\n";
+
+    std::cout << "CPUs:\n";
+
+    for (auto& cpu_description : s_8080_family_cpus) {
+        std::string padding = create_padding(cpu_description.first.size(), s_padding_to_description);
+        std::cout << "  " << cpu_description.first << padding << cpu_description.second << "\n";
+    }
+
+    std::cout << "\nFlags:\n";
+
+    for (auto& flag_description : s_single_step_flags) {
+        std::string padding = create_padding(flag_description.first.size(), s_padding_to_description);
+        std::cout << "  " << flag_description.first << padding << flag_description.second << "\n";
+    }
+
+    std::cout << "\nExamples:\n";
+
+    for (auto& example_description : s_single_step_examples) {
+        std::cout << "  " << example_description.second << ":\n";
+        std::cout << "    "
+                  << "./" << program_name << " single-step " << example_description.first << "\n\n";
+    }
+}
+
+void Frontend::print_benchmark_usage(std::string const& program_name)
+{
+    std::cout << "\nUsage: ./" << program_name << " benchmark [FLAGS]\n\n";
+    std::cout << "Run microbenchmarks of the parts of the emulators that are run the most, and print the time\n"
+                 "each of them takes. The results can be stored as a baseline, and a later run can be\n"
+                 "compared with it to find the benchmarks that have become slower.\n\n";
+    std::cout << "benchmarks/baseline.json is recorded from the latest commit. A commit that changes how\n"
+                 "fast the emulators run on purpose has to store a new baseline with --save, so that later\n"
+                 "runs aren't compared with numbers from older code. The times depend on the machine, so\n"
+                 "compare with a baseline that was recorded on the same machine.\n\n";
+
+    std::cout << "Flags:\n";
+
+    for (auto& flag_description : s_benchmark_flags) {
+        std::string padding = create_padding(flag_description.first.size(), s_padding_to_description);
+        std::cout << "  " << flag_description.first << padding << flag_description.second << "\n";
+    }
+
+    std::cout << "\nExamples:\n";
+
+    for (auto& example_description : s_benchmark_examples) {
+        std::cout << "  " << example_description.second << ":\n";
+        std::cout << "    "
+                  << "./" << program_name << " benchmark " << example_description.first << "\n\n";
+    }
+}
+
 std::unique_ptr<Emulator> Frontend::choose_emulator(std::string const& program, Options const& options)
 {
     using namespace applications;
@@ -335,7 +563,11 @@ std::unique_ptr<Emulator> Frontend::choose_emulator(std::string const& program,
             options.gui_type(pacman::print_usage));
     } else if (program == "zx-spectrum-48k") {
         return std::make_unique<zxspectrum_48k::ZxSpectrum48k>(
-            zxspectrum_48k::Settings::from_options(options),
+            zxspectrum_48k::Settings::from_options(options, zxspectrum_48k::Model::_48k),
+            options.gui_type(zxspectrum_48k::print_usage));
+    } else if (program == "zx-spectrum-128k") {
+        return std::make_unique<zxspectrum_48k::ZxSpectrum48k>(
+            zxspectrum_48k::Settings::from_options(options, zxspectrum_48k::Model::_128k),
             options.gui_type(zxspectrum_48k::print_usage));
     } else if (program == "prelim") {
         return std::make_unique<cpm::z80::CpmApplication>("roms/z80/prelim.com");
@@ -360,7 +592,12 @@ std::unique_ptr<Emulator> Frontend::choose_emulator(std::string const& program,
             game_boy::Settings::from_options(options),
             options.gui_type(game_boy::print_usage));
     } else if (program == "lmc_application") {
-        if (options.path().has_value()) {
+        if (options.path().has_value() && options.options().contains("grade")) {
+            return std::make_unique<lmc::BatchGrader>(
+                options.path().value(),
+                lmc_test_vectors_path(options),
+                lmc_instruction_limit(options));
+        } else if (options.path().has_value()) {
             return std::make_unique<lmc::LmcApplication>(
                 options.path().value(),
                 options.gui_type(lmc::print_usage));
@@ -379,6 +616,65 @@ std::unique_ptr<Emulator> Frontend::choose_emulator(std::string const& program,
     }
 }
 
+std::string Frontend::lmc_test_vectors_path(Options const& options)
+{
+    std::vector<std::string> const& paths = options.options().at("grade");
+    if (paths.size() != 1) {
+        throw InvalidProgramArgumentsException(
+            "The test vectors have to be provided on the following format: --grade=<FILE>",
+            lmc::print_usage);
+    }
+
+    return paths[0];
+}
+
+u64 Frontend::lmc_instruction_limit(Options const& options)
+{
+    if (!options.options().contains("max-instructions")) {
+        return s_default_lmc_instruction_limit;
+    }
+
+    std::vector<std::string> const& limits = options.options().at("max-instructions");
+    if (limits.size() != 1 || limits[0].empty() || !std::all_of(limits[0].begin(), limits[0].end(), [](char c) { return c >= '0' && c <= '9'; })) {
+        throw InvalidProgramArgumentsException(
+            "The instruction limit has to be provided on the following format: --max-instructions=<NUMBER>",
+            lmc::print_usage);
+    }
+
+    return std::stoull(limits[0]);
+}
+
+differential::CoreKind Frontend::differential_core(std::string const& cpu)
+{
+    if (cpu == "8080") {
+        return differential::CoreKind::I8080;
+    } else if (cpu == "Z80") {
+        return differential::CoreKind::Z80;
+    } else if (cpu == "LR35902") {
+        return differential::CoreKind::LR35902;
+    } else {
+        throw InvalidProgramArgumentsException(
+            fmt::format("Invalid CPU: {}", cpu),
+            Frontend::print_differential_usage);
+    }
+}
+
+u64 Frontend::differential_number(Options const& options, std::string const& name, u64 default_value)
+{
+    if (!options.options().contains(name)) {
+        return default_value;
+    }
+
+    std::vector<std::string> const& values = options.options().at(name);
+    if (values.size() != 1 || values[0].empty() || !std::all_of(values[0].begin(), values[0].end(), [](char c) { return c >= '0' && c <= '9'; })) {
+        throw InvalidProgramArgumentsException(
+            fmt::format("The {0} has to be provided on the following format: --{0}=<NUMBER>", name),
+            Frontend::print_differential_usage);
+    }
+
+    return std::stoull(values[0]);
+}
+
 bool Frontend::is_supporting(std::string const& program)
 {
     std::vector<std::string> program_names;
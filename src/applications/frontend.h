@@ -2,6 +2,7 @@
 
 #include "applications/cpm_8080/usage.h"
 #include "applications/cpm_z80/usage.h"
+#include "applications/differential/core.h"
 #include "applications/game_boy/usage.h"
 #include "applications/lmc_application/usage.h"
 #include "applications/pacman/usage.h"
@@ -9,6 +10,7 @@
 #include "applications/synacor_application/usage.h"
 #include "applications/zxspectrum_48k/usage.h"
 #include "crosscutting/gui/gui_type.h" // IWYU pragma: keep
+#include "crosscutting/typedefs.h"
 #include <cstddef>
 #include <functional>
 #include <memory>
@@ -39,10 +41,16 @@ public:
 
 private:
     static constexpr std::size_t s_padding_to_description = 22;
+    static constexpr u64 s_default_lmc_instruction_limit = 100000;
+    static constexpr u64 s_default_differential_programs = 1000000;
+    static constexpr u64 s_default_differential_seed = 1;
+    static constexpr u64 s_default_differential_length = 16;
+    static constexpr u64 s_default_benchmark_threshold = 30; // Two runs of the same build can differ by up to 25%
 
     static const inline std::vector<std::pair<std::string, std::string>> s_supported_programs = {
         { "pacman", "Midway Pacman for Z80" },
         { "zx-spectrum-48k", "ZX Spectrum 48k with Z80" },
+        { "zx-spectrum-128k", "ZX Spectrum 128k with Z80" },
         { "prelim", "The prelim CP/M-based test binary for Z80" },
         { "zexall", "The zexall CP/M-based test binary for Z80" },
         { "zexdoc", "The zexdoc CP/M-based test binary for Z80" },
@@ -76,6 +84,9 @@ private:
         { "run", "Run an application" },
         { "disassemble", "Disassemble a binary" },
         { "test", "Run unit tests" },
+        { "differential", "Compare two CPUs on random programs" },
+        { "single-step", "Run single step tests of a CPU" },
+        { "benchmark", "Run microbenchmarks" },
     };
 
     static const inline std::vector<std::pair<std::string, std::string>> s_test_examples = {
@@ -84,9 +95,52 @@ private:
         { "", "All the unit tests are run" },
     };
 
+    static const inline std::vector<std::pair<std::string, std::string>> s_8080_family_cpus = {
+        { "8080", "The Intel 8080 8-bit microprocessor" },
+        { "LR35902", "The LR35902 8-bit microprocessor" },
+        { "Z80", "The Zilog Z80 8-bit microprocessor" },
+    };
+
+    static const inline std::vector<std::pair<std::string, std::string>> s_differential_flags = {
+        { "--cpu", "One of the two CPUs to compare. Has to be given twice." },
+        { "--programs", "How many programs to run. 1000000 is default." },
+        { "--seed", "What the programs are generated from. 1 is default." },
+        { "--length", "The most instructions in a program. 16 is default." },
+    };
+
+    static const inline std::vector<std::pair<std::string, std::string>> s_differential_examples = {
+        { "--cpu=8080 --cpu=Z80", "The 8080 and the Z80 are compared on random programs" },
+        { "--cpu=8080 --cpu=LR35902 roms/8080/TST8080.COM", "The 8080 and the LR35902 are compared on code taken from TST8080.COM" },
+    };
+
+    static const inline std::vector<std::pair<std::string, std::string>> s_single_step_flags = {
+        { "--cpu", "The CPU to test." },
+        { "--ignore-cycles", "Don't compare the number of cycles the instructions take." },
+    };
+
+    static const inline std::vector<std::pair<std::string, std::string>> s_single_step_examples = {
+        { "--cpu=Z80 tests/z80/v1", "Every opcode in tests/z80/v1 is tested on the Z80" },
+        { "--cpu=LR35902 tests/sm83/v1/3c.json", "The tests of one opcode are run on the LR35902" },
+    };
+
+    static const inline std::vector<std::pair<std::string, std::string>> s_benchmark_flags = {
+        { "--filter", "Only run the benchmarks with names that match. * matches anything." },
+        { "--save", "Store the results as a baseline in the given file." },
+        { "--baseline", "Compare the results with the baseline in the given file." },
+        { "--threshold", "How many percent slower than the baseline is a regression. 30 is default." },
+    };
+
+    static const inline std::vector<std::pair<std::string, std::string>> s_benchmark_examples = {
+        { "", "All the benchmarks are run" },
+        { "--filter=Z80*", "The benchmarks of the Z80 are run" },
+        { "--baseline=benchmarks/baseline.json", "The benchmarks are compared with the stored baseline" },
+        { "--save=benchmarks/baseline.json", "The stored baseline is replaced with the results" },
+    };
+
     static const inline std::unordered_map<std::string, std::function<void(std::string const&)>> s_program_usages = {
         { "pacman", pacman::print_usage },
         { "zx-spectrum-48k", zxspectrum_48k::print_usage },
+        { "zx-spectrum-128k", zxspectrum_48k::print_usage },
         { "prelim", cpm::z80::print_usage },
         { "zexall", cpm::z80::print_usage },
         { "zexdoc", cpm::z80::print_usage },
@@ -106,12 +160,32 @@ private:
 
     static void test(Options const& options);
 
+    static void differential(Options const& options);
+
+    static void single_step(Options const& options);
+
+    static void benchmark(Options const& options);
+
     static void print_disassemble_usage(std::string const& program_name);
 
     static void print_test_usage(std::string const& program_name);
 
+    static void print_differential_usage(std::string const& program_name);
+
+    static void print_single_step_usage(std::string const& program_name);
+
+    static void print_benchmark_usage(std::string const& program_name);
+
     static std::unique_ptr<Emulator> choose_emulator(std::string const& program, Options const& options);
 
     static bool is_supporting(std::string const& program);
+
+    static std::string lmc_test_vectors_path(Options const& options);
+
+    static u64 lmc_instruction_limit(Options const& options);
+
+    static differential::CoreKind differential_core(std::string const& cpu);
+
+    static u64 differential_number(Options const& options, std::string const& name, u64 default_value);
 };
 }
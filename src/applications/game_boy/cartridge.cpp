@@ -0,0 +1,376 @@
+#include "cartridge.h"
+#include "crosscutting/exceptions/unsupported_exception.h"
+#include "crosscutting/memory/mapped_file.h"
+#include "crosscutting/memory/mapped_save_file.h"
+#include <algorithm>
+#include <fmt/core.h>
+#include <utility>
+
+namespace emu::applications::game_boy {
+
+using emu::exceptions::UnsupportedException;
+
+Cartridge::Cartridge(std::shared_ptr<MappedFile const> rom, std::string const& save_file)
+    : m_rom_file(std::move(rom))
+    , m_rom(m_rom_file->bytes())
+    , m_rom_bank_0(nullptr)
+    , m_rom_bank_n(nullptr)
+{
+    if (m_rom.size() < 2 * s_rom_bank_size || m_rom.size() % s_rom_bank_size != 0) {
+        const std::size_t number_of_banks = std::max<std::size_t>(2, (m_rom.size() + s_rom_bank_size - 1) / s_rom_bank_size);
+        m_padded_rom.assign(m_rom.begin(), m_rom.end());
+        m_padded_rom.resize(number_of_banks * s_rom_bank_size, 0);
+        m_rom = m_padded_rom;
+    }
+
+    const std::size_t ram_size = parse_header();
+
+    if (m_has_battery) {
+        m_save_file = std::make_unique<MappedSaveFile>(save_file, ram_size + (m_has_rtc ? s_rtc_save_size : 0));
+        m_ram = m_save_file->bytes().first(ram_size);
+    } else {
+        m_ram_without_battery.resize(ram_size, 0);
+        m_ram = m_ram_without_battery;
+    }
+
+    if (ram_size > 0) {
+        m_ram_mask = std::min(ram_size, s_ram_bank_size) - 1;
+    }
+
+    if (m_mbc == Mbc::None) {
+        m_is_ram_enabled = true; // There is no register to enable the RAM with
+    }
+
+    update_rom_banks();
+    update_ram_bank();
+
+    if (m_has_rtc) {
+        load_rtc();
+    }
+}
+
+Cartridge::~Cartridge()
+{
+    if (m_has_rtc && m_save_file) {
+        update_rtc();
+        save_rtc();
+    }
+}
+
+u8 Cartridge::read_rom(u16 address) const
+{
+    if (address < s_address_switchable_rom_bank) {
+        return m_rom_bank_0[address];
+    }
+
+    return m_rom_bank_n[address - s_address_switchable_rom_bank];
+}
+
+u8 const* Cartridge::rom_bank(u16 address) const
+{
+    return address < s_address_switchable_rom_bank ? m_rom_bank_0 : m_rom_bank_n;
+}
+
+void Cartridge::write_rom(u16 address, u8 value)
+{
+    switch (m_mbc) {
+    case Mbc::None:
+        break;
+    case Mbc::Mbc1:
+        write_mbc1(address, value);
+        break;
+    case Mbc::Mbc3:
+        write_mbc3(address, value);
+        break;
+    case Mbc::Mbc5:
+        write_mbc5(address, value);
+        break;
+    }
+}
+
+u8 Cartridge::read_ram(u16 address) const
+{
+    if (!m_is_ram_enabled) {
+        return 0xff;
+    } else if (m_rtc_register != 0) {
+        return m_rtc_latched[m_rtc_register - s_rtc_register_first];
+    } else if (m_ram_bank == nullptr) {
+        return 0xff;
+    }
+
+    return m_ram_bank[(address - s_address_ram_beginning) & m_ram_mask];
+}
+
+void Cartridge::write_ram(u16 address, u8 value)
+{
+    if (!m_is_ram_enabled) {
+        return;
+    } else if (m_rtc_register != 0) {
+        update_rtc();
+        m_rtc[m_rtc_register - s_rtc_register_first] = value;
+        save_rtc();
+    } else if (m_ram_bank != nullptr) {
+        m_ram_bank[(address - s_address_ram_beginning) & m_ram_mask] = value;
+    }
+}
+
+Mbc Cartridge::mbc() const
+{
+    return m_mbc;
+}
+
+std::size_t Cartridge::number_of_rom_banks() const
+{
+    return m_rom.size() / s_rom_bank_size;
+}
+
+std::size_t Cartridge::number_of_ram_banks() const
+{
+    return (m_ram.size() + s_ram_bank_size - 1) / s_ram_bank_size;
+}
+
+std::size_t Cartridge::parse_header()
+{
+    const u8 cartridge_type = m_rom[s_address_cartridge_type];
+
+    switch (cartridge_type) {
+    case 0x00: // ROM only
+    case 0x08: // ROM+RAM
+        m_mbc = Mbc::None;
+        break;
+    case 0x09: // ROM+RAM+BATTERY
+        m_mbc = Mbc::None;
+        m_has_battery = true;
+        break;
+    case 0x01: // MBC1
+    case 0x02: // MBC1+RAM
+        m_mbc = Mbc::Mbc1;
+        break;
+    case 0x03: // MBC1+RAM+BATTERY
+        m_mbc = Mbc::Mbc1;
+        m_has_battery = true;
+        break;
+    case 0x0f: // MBC3+TIMER+BATTERY
+    case 0x10: // MBC3+TIMER+RAM+BATTERY
+        m_mbc = Mbc::Mbc3;
+        m_has_battery = true;
+        m_has_rtc = true;
+        break;
+    case 0x11: // MBC3
+    case 0x12: // MBC3+RAM
+        m_mbc = Mbc::Mbc3;
+        break;
+    case 0x13: // MBC3+RAM+BATTERY
+        m_mbc = Mbc::Mbc3;
+        m_has_battery = true;
+        break;
+    case 0x19: // MBC5
+    case 0x1a: // MBC5+RAM
+    case 0x1c: // MBC5+RUMBLE
+    case 0x1d: // MBC5+RUMBLE+RAM
+        m_mbc = Mbc::Mbc5;
+        break;
+    case 0x1b: // MBC5+RAM+BATTERY
+    case 0x1e: // MBC5+RUMBLE+RAM+BATTERY
+        m_mbc = Mbc::Mbc5;
+        m_has_battery = true;
+        break;
+    default:
+        throw UnsupportedException(fmt::format("Cartridge type ${:02x}", cartridge_type));
+    }
+
+    switch (m_rom[s_address_ram_size]) {
+    case 0x01:
+        return 0x800;
+    case 0x02:
+        return 0x2000;
+    case 0x03:
+        return 0x8000;
+    case 0x04:
+        return 0x20000;
+    case 0x05:
+        return 0x10000;
+    default:
+        return 0;
+    }
+}
+
+void Cartridge::update_rom_banks()
+{
+    std::size_t bank_0 = 0;
+    std::size_t bank_n = m_rom_bank;
+
+    if (m_mbc == Mbc::Mbc1) {
+        bank_n |= static_cast<std::size_t>(m_mbc1_upper_bits) << 5;
+        if (m_is_mbc1_in_advanced_mode) {
+            bank_0 = static_cast<std::size_t>(m_mbc1_upper_bits) << 5;
+        }
+    }
+
+    m_rom_bank_0 = m_rom.data() + (bank_0 % number_of_rom_banks()) * s_rom_bank_size;
+    m_rom_bank_n = m_rom.data() + (bank_n % number_of_rom_banks()) * s_rom_bank_size;
+}
+
+void Cartridge::update_ram_bank()
+{
+    if (m_ram.empty()) {
+        m_ram_bank = nullptr;
+        return;
+    }
+
+    std::size_t bank = m_ram_bank_number;
+
+    if (m_mbc == Mbc::Mbc1) {
+        bank = m_is_mbc1_in_advanced_mode ? m_mbc1_upper_bits : 0;
+    }
+
+    m_ram_bank = m_ram.data() + (bank % number_of_ram_banks()) * s_ram_bank_size;
+}
+
+void Cartridge::write_mbc1(u16 address, u8 value)
+{
+    if (address <= 0x1fff) {
+        m_is_ram_enabled = (value & 0x0f) == s_ram_enable_value;
+    } else if (address <= 0x3fff) {
+        m_rom_bank = value & 0x1f;
+        if (m_rom_bank == 0) {
+            m_rom_bank = 1;
+        }
+        update_rom_banks();
+    } else if (address <= 0x5fff) {
+        m_mbc1_upper_bits = value & 0x03;
+        update_rom_banks();
+        update_ram_bank();
+    } else {
+        m_is_mbc1_in_advanced_mode = (value & 0x01) != 0;
+        update_rom_banks();
+        update_ram_bank();
+    }
+}
+
+void Cartridge::write_mbc3(u16 address, u8 value)
+{
+    if (address <= 0x1fff) {
+        m_is_ram_enabled = (value & 0x0f) == s_ram_enable_value;
+    } else if (address <= 0x3fff) {
+        m_rom_bank = value & 0x7f;
+        if (m_rom_bank == 0) {
+            m_rom_bank = 1;
+        }
+        update_rom_banks();
+    } else if (address <= 0x5fff) {
+        if (m_has_rtc && s_rtc_register_first <= value && value <= s_rtc_register_last) {
+            m_rtc_register = value;
+        } else {
+            m_rtc_register = 0;
+            m_ram_bank_number = value & 0x03;
+            update_ram_bank();
+        }
+    } else {
+        if (m_has_rtc && m_rtc_latch_value == 0x00 && value == 0x01) {
+            update_rtc();
+            m_rtc_latched = m_rtc;
+            save_rtc();
+        }
+        m_rtc_latch_value = value;
+    }
+}
+
+void Cartridge::write_mbc5(u16 address, u8 value)
+{
+    if (address <= 0x1fff) {
+        m_is_ram_enabled = (value & 0x0f) == s_ram_enable_value;
+    } else if (address <= 0x2fff) {
+        m_rom_bank = (m_rom_bank & 0x100) | value;
+        update_rom_banks();
+    } else if (address <= 0x3fff) {
+        m_rom_bank = (m_rom_bank & 0xff) | (static_cast<std::size_t>(value & 0x01) << 8);
+        update_rom_banks();
+    } else if (address <= 0x5fff) {
+        m_ram_bank_number = value & 0x0f;
+        update_ram_bank();
+    }
+}
+
+/**
+ * Brings the clock registers up to date with the time that has passed since they were last
+ * updated. The clock keeps running while the emulator is closed, like on a real cartridge.
+ */
+void Cartridge::update_rtc()
+{
+    const std::time_t now = std::time(nullptr);
+    const std::time_t elapsed = now - m_rtc_timestamp;
+    m_rtc_timestamp = now;
+
+    if ((m_rtc[s_rtc_day_high] & s_rtc_halt_bit) != 0 || elapsed <= 0) {
+        return;
+    }
+
+    const std::time_t seconds = m_rtc[s_rtc_seconds] + elapsed;
+    const std::time_t minutes = m_rtc[s_rtc_minutes] + seconds / 60;
+    const std::time_t hours = m_rtc[s_rtc_hours] + minutes / 60;
+    const std::time_t days = (m_rtc[s_rtc_day_low] | ((m_rtc[s_rtc_day_high] & s_rtc_day_high_bit) << 8)) + hours / 24;
+
+    m_rtc[s_rtc_seconds] = static_cast<u8>(seconds % 60);
+    m_rtc[s_rtc_minutes] = static_cast<u8>(minutes % 60);
+    m_rtc[s_rtc_hours] = static_cast<u8>(hours % 24);
+    m_rtc[s_rtc_day_low] = static_cast<u8>(days & 0xff);
+    m_rtc[s_rtc_day_high] = static_cast<u8>((m_rtc[s_rtc_day_high] & ~s_rtc_day_high_bit) | ((days >> 8) & s_rtc_day_high_bit));
+    if (days > 0x1ff) {
+        m_rtc[s_rtc_day_high] |= s_rtc_day_carry_bit;
+    }
+}
+
+/**
+ * Reads the clock from after the RAM in the save file. It's saved the same way as most other
+ * emulators do it: the registers and the latched registers as 32-bit values, and then the time
+ * they were saved at as a 64-bit value, all little-endian.
+ */
+void Cartridge::load_rtc()
+{
+    if (!m_save_file) {
+        m_rtc_timestamp = std::time(nullptr);
+        return;
+    }
+
+    std::span<u8 const> saved = m_save_file->bytes().subspan(m_ram.size());
+
+    u64 timestamp = 0;
+    for (std::size_t i = 0; i < 8; ++i) {
+        timestamp |= static_cast<u64>(saved[40 + i]) << (8 * i);
+    }
+
+    if (timestamp == 0) { // A new save file
+        m_rtc_timestamp = std::time(nullptr);
+        return;
+    }
+
+    for (std::size_t i = 0; i < m_rtc.size(); ++i) {
+        m_rtc[i] = saved[4 * i];
+        m_rtc_latched[i] = saved[4 * (m_rtc.size() + i)];
+    }
+    m_rtc_timestamp = static_cast<std::time_t>(timestamp);
+
+    update_rtc();
+}
+
+void Cartridge::save_rtc()
+{
+    if (!m_save_file) {
+        return;
+    }
+
+    std::span<u8> saved = m_save_file->bytes().subspan(m_ram.size());
+    std::fill(saved.begin(), saved.end(), 0);
+
+    for (std::size_t i = 0; i < m_rtc.size(); ++i) {
+        saved[4 * i] = m_rtc[i];
+        saved[4 * (m_rtc.size() + i)] = m_rtc_latched[i];
+    }
+
+    const u64 timestamp = static_cast<u64>(m_rtc_timestamp);
+    for (std::size_t i = 0; i < 8; ++i) {
+        saved[40 + i] = static_cast<u8>(timestamp >> (8 * i));
+    }
+}
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <array>
+#include <cstddef>
+#include <ctime>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace emu::memory {
+class MappedFile;
+class MappedSaveFile;
+}
+
+namespace emu::applications::game_boy {
+
+using emu::memory::MappedFile;
+using emu::memory::MappedSaveFile;
+
+/**
+ * The memory bank controller of a cartridge, which switches between the ROM and RAM banks.
+ */
+enum class Mbc {
+    None,
+    Mbc1,
+    Mbc3,
+    Mbc5
+};
+
+/**
+ * A cartridge, with the ROM at $0000-$7fff and the external RAM at $a000-$bfff. Which memory bank
+ * controller it has, and how much RAM, is read from the cartridge header.
+ *
+ * Switching banks only points the bank to somewhere else in the ROM or RAM, so nothing is copied.
+ * Battery-backed RAM is mapped to a save file, and so is the real-time clock of MBC3.
+ */
+class Cartridge {
+public:
+    /**
+     * @param rom is the ROM of the cartridge
+     * @param save_file is where the RAM is saved, if the cartridge has a battery
+     * @throws UnsupportedException if the cartridge has a memory bank controller that isn't supported
+     */
+    Cartridge(std::shared_ptr<MappedFile const> rom, std::string const& save_file);
+
+    ~Cartridge();
+
+    Cartridge(Cartridge const&) = delete;
+
+    Cartridge& operator=(Cartridge const&) = delete;
+
+    /**
+     * @param address is an address in $0000-$7fff
+     * @return the value in the ROM bank that is mapped at the address
+     */
+    [[nodiscard]] u8 read_rom(u16 address) const;
+
+    /**
+     * @param address is an address in $0000-$7fff
+     * @return the ROM bank that is mapped at the address, which only changes when another bank is switched in
+     */
+    [[nodiscard]] u8 const* rom_bank(u16 address) const;
+
+    /**
+     * Writes to the ROM are writes to the registers of the memory bank controller.
+     *
+     * @param address is an address in $0000-$7fff
+     * @param value is the value to write to the register at the address
+     */
+    void write_rom(u16 address, u8 value);
+
+    /**
+     * @param address is an address in $a000-$bfff
+     * @return the value in the RAM bank or clock register that is mapped at the address
+     */
+    [[nodiscard]] u8 read_ram(u16 address) const;
+
+    /**
+     * @param address is an address in $a000-$bfff
+     * @param value is the value to write to the RAM bank or clock register that is mapped at the address
+     */
+    void write_ram(u16 address, u8 value);
+
+    [[nodiscard]] Mbc mbc() const;
+
+    [[nodiscard]] std::size_t number_of_rom_banks() const;
+
+    [[nodiscard]] std::size_t number_of_ram_banks() const;
+
+private:
+    static constexpr u16 s_address_cartridge_type = 0x0147;
+    static constexpr u16 s_address_ram_size = 0x0149;
+
+    static constexpr std::size_t s_rom_bank_size = 0x4000;
+    static constexpr std::size_t s_ram_bank_size = 0x2000;
+    static constexpr u16 s_address_switchable_rom_bank = 0x4000;
+    static constexpr u16 s_address_ram_beginning = 0xa000;
+
+    static constexpr u8 s_ram_enable_value = 0x0a;
+    static constexpr u8 s_rtc_register_first = 0x08;
+    static constexpr u8 s_rtc_register_last = 0x0c;
+    static constexpr std::size_t s_rtc_seconds = 0;
+    static constexpr std::size_t s_rtc_minutes = 1;
+    static constexpr std::size_t s_rtc_hours = 2;
+    static constexpr std::size_t s_rtc_day_low = 3;
+    static constexpr std::size_t s_rtc_day_high = 4;
+    static constexpr u8 s_rtc_day_high_bit = 0x01;
+    static constexpr u8 s_rtc_halt_bit = 0x40;
+    static constexpr u8 s_rtc_day_carry_bit = 0x80;
+    static constexpr std::size_t s_rtc_save_size = 48; // The five registers and the latched ones as u32, and a u64 timestamp
+
+    std::shared_ptr<MappedFile const> m_rom_file;
+    std::vector<u8> m_padded_rom; // Only used when the ROM file isn't a whole number of banks, or less than two
+    std::span<u8 const> m_rom;
+    u8 const* m_rom_bank_0;
+    u8 const* m_rom_bank_n;
+
+    std::unique_ptr<MappedSaveFile> m_save_file;
+    std::vector<u8> m_ram_without_battery;
+    std::span<u8> m_ram;
+    u8* m_ram_bank { nullptr };
+    std::size_t m_ram_mask { 0 };
+
+    Mbc m_mbc { Mbc::None };
+    bool m_has_battery { false };
+    bool m_has_rtc { false };
+
+    bool m_is_ram_enabled { false };
+    std::size_t m_rom_bank { 1 };
+    std::size_t m_ram_bank_number { 0 };
+    u8 m_mbc1_upper_bits { 0 };
+    bool m_is_mbc1_in_advanced_mode { false };
+
+    std::array<u8, 5> m_rtc {};
+    std::array<u8, 5> m_rtc_latched {};
+    std::time_t m_rtc_timestamp { 0 };
+    u8 m_rtc_register { 0 }; // Zero when RAM is mapped instead of a clock register
+    u8 m_rtc_latch_value { 0xff };
+
+    /**
+     * @return the size of the RAM
+     */
+    std::size_t parse_header();
+
+    void update_rom_banks();
+
+    void update_ram_bank();
+
+    void write_mbc1(u16 address, u8 value);
+
+    void write_mbc3(u16 address, u8 value);
+
+    void write_mbc5(u16 address, u8 value);
+
+    void update_rtc();
+
+    void load_rtc();
+
+    void save_rtc();
+};
+}
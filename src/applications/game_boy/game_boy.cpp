@@ -1,7 +1,9 @@
 #include "game_boy.h"
-#include "crosscutting/util/file_util.h"
+#include "cartridge.h"
+#include "crosscutting/memory/mapped_file.h"
 #include "game_boy_session.h"
 #include "gui.h"
+#include "gui_headless.h"
 #include "gui_imgui.h"
 #include "gui_sdl.h"
 #include "input_imgui.h"
@@ -21,11 +23,16 @@ class Session;
 
 namespace emu::applications::game_boy {
 
-using emu::util::file::read_file_into_vector;
+using emu::memory::MappedFile;
 
 GameBoy::GameBoy(Settings const& settings, const GuiType gui_type)
+    : m_settings(settings)
 {
-    if (gui_type == GuiType::DEBUGGING) {
+    if (!m_settings.m_replay_file.empty()) {
+        m_gui = std::make_shared<GuiHeadless>();
+        m_input = std::make_shared<InputSdl>();
+        m_is_starting_paused = false;
+    } else if (gui_type == GuiType::DEBUGGING) {
         m_gui = std::make_shared<GuiImgui>();
         m_input = std::make_shared<InputImgui>();
         m_is_starting_paused = true;
@@ -40,7 +47,7 @@ GameBoy::GameBoy(Settings const& settings, const GuiType gui_type)
 
     load_files();
 
-    m_memory_mapped_io = std::make_shared<MemoryMappedIoForGameBoy>(m_memory, m_timer, m_lcd, settings);
+    m_memory_mapped_io = std::make_shared<MemoryMappedIoForGameBoy>(m_memory, m_cartridge, m_timer, m_lcd, settings);
     m_memory.attach_memory_mapper(m_memory_mapped_io);
     m_gui->attach_memory_mapper(m_memory_mapped_io);
 }
@@ -48,6 +55,7 @@ GameBoy::GameBoy(Settings const& settings, const GuiType gui_type)
 std::unique_ptr<Session> GameBoy::new_session()
 {
     return std::make_unique<GameBoySession>(
+        m_settings,
         m_is_starting_paused,
         m_gui,
         m_lcd,
@@ -67,8 +75,8 @@ std::vector<u8> create_empty_vector(std::size_t size)
 void GameBoy::load_files()
 {
     const std::string directory = "roms/game_boy/";
-    m_memory.add(read_file_into_vector(directory + "06.gb")); // hardcoded tests
-    m_memory.add(create_empty_vector(0xffff - m_memory.size()));
+    m_cartridge = std::make_shared<Cartridge>(std::make_shared<MappedFile const>(directory + "06.gb"), directory + "06.sav"); // hardcoded tests
+    m_memory.add(create_empty_vector(0xffff + 1)); // The cartridge ROM and RAM are read from the cartridge instead
 
     // [0000-3FFF] Cartridge ROM, bank 0
     //      [0000-00FF] BIOS
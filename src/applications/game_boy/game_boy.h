@@ -5,15 +5,16 @@
 #include "crosscutting/misc/emulator.h"
 #include "crosscutting/typedefs.h"
 #include "game_boy_session.h"
+#include "settings.h"
 #include <memory>
 
 namespace emu::applications::game_boy {
 class Audio;
+class Cartridge;
 class Gui;
 class Input;
 class Lcd;
 class MemoryMappedIoForGameBoy;
-class Settings;
 class Timer;
 }
 namespace emu::misc {
@@ -34,6 +35,7 @@ public:
     std::unique_ptr<Session> new_session() override;
 
 private:
+    Settings m_settings;
     EmulatorMemory<u16, u8> m_memory;
     EmulatorMemory<u16, u8> m_color_rom;
     EmulatorMemory<u16, u8> m_palette_rom;
@@ -41,6 +43,7 @@ private:
     EmulatorMemory<u16, u8> m_sprite_rom;
     EmulatorMemory<u16, u8> m_sound_rom1;
     EmulatorMemory<u16, u8> m_sound_rom2;
+    std::shared_ptr<Cartridge> m_cartridge;
     std::shared_ptr<MemoryMappedIoForGameBoy> m_memory_mapped_io;
 
     std::shared_ptr<Timer> m_timer;
@@ -2,12 +2,14 @@
 #include "audio.h"
 #include "chips/lr35902/cpu.h"
 #include "chips/lr35902/disassembler.h"
+#include "crosscutting/debugging/advanced_disassembler.h"
 #include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/debugging/debugger.h"
-#include "crosscutting/debugging/disassembled_line.h"
+#include "crosscutting/debugging/decoded_instruction.h"
 #include "crosscutting/logging/logger.h"
+#include "crosscutting/memory/dirty_ranges.h"
 #include "crosscutting/memory/emulator_memory.h"
-#include "crosscutting/util/string_util.h"
+#include "crosscutting/misc/input_movie.h"
 #include "gui.h"
 #include "gui_request.h"
 #include "interfaces/input.h"
@@ -18,15 +20,15 @@
 #include "lcd_control.h"
 #include "lcd_status.h"
 #include "memory_mapped_io_for_game_boy.h"
+#include "settings.h"
 #include "states/paused_state.h"
 #include "states/running_state.h"
 #include "states/state_context.h"
 #include "states/stepping_state.h"
 #include "states/stopped_state.h"
 #include "timer.h"
-#include <algorithm>
+#include <cstddef>
 #include <iostream>
-#include <iterator>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -34,14 +36,18 @@
 
 namespace emu::applications::game_boy {
 
+using emu::debugger::AdvancedDisassembler;
+using emu::debugger::DisassemblyDebugContainer;
 using emu::debugger::FlagRegisterDebugContainer;
 using emu::debugger::IoDebugContainer;
 using emu::debugger::MemoryDebugContainer;
 using emu::debugger::RegisterDebugContainer;
+using emu::debugger::format_data_byte;
+using emu::debugger::format_instruction;
 using emu::lr35902::Disassembler;
-using emu::util::string::split;
 
 GameBoySession::GameBoySession(
+    Settings const& settings,
     bool is_starting_paused,
     std::shared_ptr<Gui> gui,
     std::shared_ptr<Lcd> lcd,
@@ -59,7 +65,15 @@ GameBoySession::GameBoySession(
     , m_memory(memory)
     , m_logger(std::make_shared<Logger>())
     , m_debugger(std::make_shared<Debugger<u16, 16>>())
+    , m_record_file(settings.m_record_file)
+    , m_governor(Governor(settings.m_replay_file.empty() ? s_tick_limit : 0, sdl_get_ticks_high_performance))
 {
+    if (!settings.m_replay_file.empty()) {
+        m_input_movie = std::make_shared<InputMovie>(settings.m_replay_file);
+    } else if (!settings.m_record_file.empty()) {
+        m_input_movie = std::make_shared<InputMovie>();
+    }
+
     setup_cpu();
     setup_debugging();
 
@@ -85,6 +99,7 @@ GameBoySession::GameBoySession(
         m_debug_container,
         m_outputs_during_cycle,
         m_governor,
+        m_input_movie,
         m_is_in_debug_mode);
     m_state_context->set_running_state(std::make_shared<RunningState>(m_state_context));
     m_state_context->set_paused_state(std::make_shared<PausedState>(m_state_context));
@@ -118,6 +133,10 @@ void GameBoySession::run()
     while (!m_state_context->current_state()->is_exit_state()) {
         m_state_context->current_state()->perform(cycles);
     }
+
+    if (!m_record_file.empty()) {
+        m_input_movie->save(m_record_file);
+    }
 }
 
 void GameBoySession::pause()
@@ -176,8 +195,27 @@ void GameBoySession::setup_debugging()
             { "0", 1 },
             { "0", 0 } }));
     m_debug_container->add_memory(MemoryDebugContainer<u8>(
-        [&]() { return memory(); }));
-    m_debug_container->add_disassembled_program(disassemble_program());
+        [&]() { return memory(); },
+        [&](std::size_t address, u8 value) { m_memory.write(static_cast<u16>(address), value); }));
+    m_advanced_disassembler = std::make_shared<AdvancedDisassembler>(
+        0,
+        0x7fff,
+        [&](u16 address) { return Disassembler::decode(m_memory, address); },
+        std::vector<u16> { 0x0000, 0x0100, 0x0040, 0x0048, 0x0050, 0x0058, 0x0060 }); // The boot ROM, the cartridge entry point and the interrupts
+    m_debug_container->add_disassembly(DisassemblyDebugContainer<u16, u8>(
+        [&]() -> std::vector<u16> const& {
+            track_memory_changes(true); // The disassembly is shown
+            m_advanced_disassembler->add_entry_point(m_cpu->pc());
+            return m_advanced_disassembler->addresses();
+        },
+        [&](EmulatorMemory<u16, u8> const& memory, u16 address) { return Disassembler::decode(memory, address); },
+        [&](EmulatorMemory<u16, u8> const& memory, u16 address, std::string& line) {
+            if (m_advanced_disassembler->is_code(address)) {
+                format_instruction(Disassembler::decode(memory, address), line);
+            } else {
+                format_data_byte(address, memory.read(address), line);
+            }
+        }));
     m_debug_container->add_io(IoDebugContainer<u8>(
         "LCD control",
         [&]() { return true; },
@@ -231,6 +269,28 @@ void GameBoySession::setup_debugging()
     m_gui->attach_logger(m_logger);
 }
 
+/**
+ * Only the disassembly needs to know what has changed in the memory, and marking every write costs
+ * time, so the changes are only tracked while the debugger or the disassembly is in use. The memory
+ * mapper marks the ROM banks it switches in the same dirty ranges. Nothing is known about what
+ * changed in between, so all of the memory is marked when the tracking starts.
+ */
+void GameBoySession::track_memory_changes(bool is_tracking)
+{
+    if (is_tracking == (m_dirty_ranges != nullptr)) {
+        return;
+    }
+
+    if (is_tracking) {
+        m_dirty_ranges = std::make_shared<DirtyRanges>(s_memory_size);
+        m_dirty_ranges->mark(0, s_memory_size - 1);
+    } else {
+        m_dirty_ranges.reset();
+    }
+    m_memory.attach_dirty_ranges(m_dirty_ranges);
+    m_advanced_disassembler->attach_dirty_ranges(m_dirty_ranges);
+}
+
 void GameBoySession::gui_request(GuiRequest request)
 {
     switch (request.m_type) {
@@ -245,6 +305,7 @@ void GameBoySession::gui_request(GuiRequest request)
         break;
     case DEBUG_MODE:
         m_is_in_debug_mode = request.m_payload;
+        track_memory_changes(m_is_in_debug_mode);
         break;
     }
 }
@@ -290,42 +351,10 @@ void GameBoySession::interrupt(Interrupts interrupt)
     m_memory_mapped_io->reset_interrupt(interrupt);
 }
 
-std::vector<u8> GameBoySession::memory()
+std::span<u8 const> GameBoySession::memory()
 {
-    //    std::vector<u8> memory;
-    //    memory.reserve(0xffff);
-    //    for (unsigned int address = 0; address <= 0xffff; ++address) {
-    //        memory.push_back(m_memory_mapped_io->read(address));
-    //    }
-    //    return memory;
-    return { m_memory.begin(), m_memory.end() }; // TODO: Go through the memory mapper
-}
-
-std::vector<DisassembledLine<u16, 16>> GameBoySession::disassemble_program()
-{
-    std::vector<u8> values;
-    values.reserve(0x7fff);
-    for (u16 address = 0; address < 0x7fff; ++address) {
-        values.push_back(m_memory_mapped_io->read(address));
-    }
-
-    EmulatorMemory<u16, u8> sliced_for_disassembly;
-    sliced_for_disassembly.add(values);
+    m_memory_mapped_io->copy(m_debug_memory);
 
-    std::stringstream ss;
-    Disassembler disassembler(sliced_for_disassembly, ss);
-    disassembler.disassemble();
-
-    std::vector<std::string> disassembled_program = split(ss, "\n");
-
-    disassembled_program.erase(
-        std::remove_if(disassembled_program.begin(), disassembled_program.end(), [](std::string const& s) { return s.empty(); }));
-
-    std::vector<DisassembledLine<u16, 16>> lines;
-    std::transform(disassembled_program.begin(), disassembled_program.end(), std::back_inserter(lines),
-        [](std::string const& line) { return DisassembledLine<u16, 16>(line); });
-
-    return lines;
+    return m_debug_memory;
 }
-
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "crosscutting/misc/governor.h"
+#include "crosscutting/misc/port_decoder.h"
 #include "crosscutting/misc/sdl_counter.h"
 #include "crosscutting/misc/session.h"
 #include "crosscutting/typedefs.h"
@@ -13,7 +14,8 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
-#include <unordered_map>
+#include <span>
+#include <string>
 #include <vector>
 
 namespace emu::applications::game_boy {
@@ -22,25 +24,29 @@ class Gui;
 class Input;
 class Lcd;
 class MemoryMappedIoForGameBoy;
+class Settings;
 class StateContext;
 class Timer;
 struct GuiRequest;
 }
 namespace emu::debugger {
+class AdvancedDisassembler;
 template<class A, std::size_t B>
 class Debugger;
 template<class A, class D, std::size_t B>
 class DebugContainer;
-template<class A, std::size_t B>
-class DisassembledLine;
 }
 namespace emu::logging {
 class Logger;
 }
 namespace emu::memory {
+class DirtyRanges;
 template<class A, class D>
 class EmulatorMemory;
 }
+namespace emu::misc {
+class InputMovie;
+}
 namespace emu::lr35902 {
 class Cpu;
 }
@@ -48,13 +54,16 @@ class Cpu;
 namespace emu::applications::game_boy {
 
 using emu::applications::game_boy::GuiObserver;
+using emu::debugger::AdvancedDisassembler;
 using emu::debugger::DebugContainer;
 using emu::debugger::Debugger;
-using emu::debugger::DisassembledLine;
 using emu::logging::Logger;
 using emu::lr35902::Cpu;
+using emu::memory::DirtyRanges;
 using emu::memory::EmulatorMemory;
 using emu::misc::Governor;
+using emu::misc::InputMovie;
+using emu::misc::PortCapture;
 using emu::misc::sdl_get_ticks_high_performance;
 using emu::misc::Session;
 
@@ -65,6 +74,7 @@ class GameBoySession
     , public InterruptObserver {
 public:
     GameBoySession(
+        Settings const& settings,
         bool is_starting_paused,
         std::shared_ptr<Gui> gui,
         std::shared_ptr<Lcd> lcd,
@@ -93,6 +103,7 @@ private:
     static constexpr long double s_tick_limit = 1000.0L / s_fps;
     static constexpr int s_cycles_per_ms = 3072;
     static constexpr long double s_cycles_per_tick = s_cycles_per_ms * s_tick_limit;
+    static constexpr std::size_t s_memory_size = 0xffff + 1;
 
     bool m_is_in_debug_mode { false };
 
@@ -112,9 +123,15 @@ private:
     std::shared_ptr<Logger> m_logger;
     std::shared_ptr<Debugger<u16, 16>> m_debugger;
     std::shared_ptr<DebugContainer<u16, u8, 16>> m_debug_container;
-    std::unordered_map<u8, u8> m_outputs_during_cycle;
+    std::shared_ptr<AdvancedDisassembler> m_advanced_disassembler;
+    std::shared_ptr<DirtyRanges> m_dirty_ranges;
+    PortCapture m_outputs_during_cycle;
+    std::vector<u8> m_debug_memory = std::vector<u8>(0xffff + 1);
+
+    std::shared_ptr<InputMovie> m_input_movie;
+    std::string m_record_file;
 
-    Governor m_governor { Governor(s_tick_limit, sdl_get_ticks_high_performance) };
+    Governor m_governor;
 
     std::shared_ptr<StateContext> m_state_context;
 
@@ -122,8 +139,8 @@ private:
 
     void setup_debugging();
 
-    std::vector<u8> memory();
+    void track_memory_changes(bool is_tracking);
 
-    std::vector<DisassembledLine<u16, 16>> disassemble_program();
+    std::span<u8 const> memory();
 };
 }
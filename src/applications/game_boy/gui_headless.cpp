@@ -0,0 +1,51 @@
+#include "gui_headless.h"
+#include "crosscutting/benchmarking/benchmark.h"
+#include "crosscutting/gui/gui_for_benchmark.h"
+#include "gui.h"
+#include "lcd_control.h"
+#include <vector>
+
+namespace emu::applications::game_boy {
+class GuiObserver;
+}
+
+namespace emu::applications::game_boy {
+
+using emu::benchmarking::pseudo_random_bytes;
+using emu::gui::GuiForBenchmark;
+
+void GuiHeadless::toggle_tile_debug()
+{
+}
+
+void GuiHeadless::toggle_sprite_debug()
+{
+}
+
+void GuiHeadless::update_screen(
+    LcdControl lcd_control,
+    std::vector<u8> const& tile_ram_1,
+    [[maybe_unused]] std::vector<u8> const& tile_ram_2,
+    [[maybe_unused]] std::vector<u8> const& tile_ram_3,
+    [[maybe_unused]] std::vector<u8> const& tile_map_1,
+    [[maybe_unused]] std::vector<u8> const& tile_map_2,
+    std::vector<u8> const& sprite_ram,
+    std::vector<u8> const& palette_ram,
+    [[maybe_unused]] std::string const& game_window_subtitle)
+{
+    print_frame_hash(create_framebuffer(lcd_control, tile_ram_1, sprite_ram, palette_ram));
+}
+
+BENCHMARK("Game Boy: Gui create_framebuffer")
+{
+    GuiForBenchmark<GuiHeadless> gui;
+    gui.attach_memory_mapper(nullptr); // Drawing a frame doesn't use the memory mapper
+    LcdControl lcd_control;
+    lcd_control.update_from_memory(0xff);
+    const std::vector<u8> tile_ram = pseudo_random_bytes(0x800);
+    const std::vector<u8> sprite_ram = pseudo_random_bytes(0xa0);
+    const std::vector<u8> palette_ram = pseudo_random_bytes(0x40);
+
+    gui.run_create_framebuffer(bench, lcd_control, tile_ram, sprite_ram, palette_ram);
+}
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "crosscutting/gui/headless_gui.h"
+#include "crosscutting/typedefs.h"
+#include "gui.h"
+#include <string>
+#include <vector>
+
+namespace emu::applications::game_boy {
+class GuiObserver;
+}
+
+namespace emu::applications::game_boy {
+
+/**
+ * A GUI without a window, used when replaying recorded input. Instead of showing the frames, it
+ * prints the number and a hash of each of them, so that two runs can be compared line by line.
+ */
+class GuiHeadless : public emu::gui::HeadlessGui<Gui, GuiObserver> {
+public:
+    void update_screen(
+        LcdControl lcd_control,
+        std::vector<u8> const& tile_ram_block_1,
+        std::vector<u8> const& tile_ram_block_2,
+        std::vector<u8> const& tile_ram_block_3,
+        std::vector<u8> const& tile_map_1,
+        std::vector<u8> const& tile_map_2,
+        std::vector<u8> const& sprite_ram,
+        std::vector<u8> const& palette_ram,
+        std::string const& game_window_subtitle) override;
+
+    void toggle_tile_debug() override;
+
+    void toggle_sprite_debug() override;
+};
+}
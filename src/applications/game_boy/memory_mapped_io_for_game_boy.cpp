@@ -1,13 +1,16 @@
 #include "memory_mapped_io_for_game_boy.h"
 #include "boot_rom.h"
+#include "cartridge.h"
 #include "chips/z80/util.h"
 #include "crosscutting/memory/emulator_memory.h"
+#include "crosscutting/misc/state_stream.h"
 #include "interrupts.h"
 #include "lcd.h"
 #include "lcd_control.h"
 #include "lcd_status.h"
 #include "settings.h"
 #include "timer.h"
+#include <algorithm>
 #include <array>
 #include <iostream>
 #include <utility>
@@ -22,10 +25,12 @@ using emu::z80::unset_bit_in_memory;
 
 MemoryMappedIoForGameBoy::MemoryMappedIoForGameBoy(
     EmulatorMemory<u16, u8>& memory,
+    std::shared_ptr<Cartridge> cartridge,
     std::shared_ptr<Timer> timer,
     std::shared_ptr<Lcd> lcd,
     [[maybe_unused]] Settings settings)
     : m_memory(memory)
+    , m_cartridge(std::move(cartridge))
     , m_timer(std::move(timer))
     , m_lcd(std::move(lcd))
 {
@@ -40,13 +45,13 @@ MemoryMappedIoForGameBoy::MemoryMappedIoForGameBoy(
 void MemoryMappedIoForGameBoy::write(u16 address, u8 value)
 {
     if (address <= s_address_rom_end) {
-        // Writes to ROM are ignored.
+        write_rom(address, value);
     } else if (s_address_tile_ram_beginning <= address && address <= s_address_tile_ram_end) {
         m_memory.direct_write(address, value);
     } else if (s_address_background_map_beginning <= address && address <= s_address_background_map_end) {
         m_memory.direct_write(address, value);
     } else if (s_address_cartridge_ram_beginning <= address && address <= s_address_cartridge_ram_end) {
-        m_memory.direct_write(address, value);
+        m_cartridge->write_ram(address, value);
     } else if (s_address_working_ram_beginning <= address && address <= s_address_working_ram_end) {
         m_memory.direct_write(address, value);
     } else if (s_address_echo_ram_beginning <= address && address <= s_address_echo_ram_end) {
@@ -118,6 +123,9 @@ void MemoryMappedIoForGameBoy::write(u16 address, u8 value)
     } else if (address == s_address_lcd_window_x_position) {
         m_lcd->m_wx = value;
     } else if (address == s_address_boot_rom_active) {
+        if (m_is_boot_rom_active != (value != 0)) {
+            m_memory.mark_dirty(s_address_rom_beginning, s_address_boot_rom_end);
+        }
         m_is_boot_rom_active = value != 0;
         m_memory.direct_write(address, value);
     } else if (address == s_address_interrupt_enabled_register) {
@@ -140,14 +148,14 @@ u8 MemoryMappedIoForGameBoy::read(u16 address)
         if (address <= s_address_boot_rom_end && m_is_boot_rom_active) {
             return s_boot_rom[address];
         } else {
-            return m_memory.direct_read(address);
+            return m_cartridge->read_rom(address);
         }
     } else if (s_address_tile_ram_beginning <= address && address <= s_address_tile_ram_end) {
         return m_memory.direct_read(address);
     } else if (s_address_background_map_beginning <= address && address <= s_address_background_map_end) {
         return m_memory.direct_read(address);
     } else if (s_address_cartridge_ram_beginning <= address && address <= s_address_cartridge_ram_end) {
-        return m_memory.direct_read(address);
+        return m_cartridge->read_ram(address);
     } else if (s_address_working_ram_beginning <= address && address <= s_address_working_ram_end) {
         return m_memory.direct_read(address);
     } else if (s_address_echo_ram_beginning <= address && address <= s_address_echo_ram_end) {
@@ -287,6 +295,37 @@ bool MemoryMappedIoForGameBoy::is_boot_rom_active() const
     return m_is_boot_rom_active;
 }
 
+void MemoryMappedIoForGameBoy::copy(std::span<u8> memory) const
+{
+    std::copy(m_memory.begin(), m_memory.end(), memory.begin());
+
+    std::copy_n(m_cartridge->rom_bank(s_address_rom_beginning),
+        s_address_switchable_rom_bank_beginning - s_address_rom_beginning,
+        memory.begin() + s_address_rom_beginning);
+    std::copy_n(m_cartridge->rom_bank(s_address_switchable_rom_bank_beginning),
+        s_address_rom_end - s_address_switchable_rom_bank_beginning + 1,
+        memory.begin() + s_address_switchable_rom_bank_beginning);
+    if (m_is_boot_rom_active) {
+        std::copy(s_boot_rom.begin(), s_boot_rom.end(), memory.begin() + s_address_rom_beginning);
+    }
+
+    for (unsigned int address = s_address_cartridge_ram_beginning; address <= s_address_cartridge_ram_end; ++address) {
+        memory[address] = m_cartridge->read_ram(static_cast<u16>(address));
+    }
+}
+
+void MemoryMappedIoForGameBoy::save_input_state(StateWriter& writer) const
+{
+    writer.write(m_p1_button_keys);
+    writer.write(m_p1_direction_keys);
+}
+
+void MemoryMappedIoForGameBoy::load_input_state(StateReader& reader)
+{
+    m_p1_button_keys = reader.read<u8>();
+    m_p1_direction_keys = reader.read<u8>();
+}
+
 void MemoryMappedIoForGameBoy::dma_transfer(u8 value)
 {
     for (u16 dest_address = s_address_object_attribute_memory_beginning, src_address = value << 8;
@@ -296,4 +335,23 @@ void MemoryMappedIoForGameBoy::dma_transfer(u8 value)
     }
 }
 
+/**
+ * Switching ROM banks changes what the CPU sees without anything being written to it, so the
+ * switched banks are marked as changed, for the disassembler.
+ */
+void MemoryMappedIoForGameBoy::write_rom(u16 address, u8 value)
+{
+    u8 const* rom_bank_0 = m_cartridge->rom_bank(s_address_rom_beginning);
+    u8 const* rom_bank_n = m_cartridge->rom_bank(s_address_switchable_rom_bank_beginning);
+
+    m_cartridge->write_rom(address, value);
+
+    if (m_cartridge->rom_bank(s_address_rom_beginning) != rom_bank_0) {
+        m_memory.mark_dirty(s_address_rom_beginning, s_address_switchable_rom_bank_beginning - 1);
+    }
+    if (m_cartridge->rom_bank(s_address_switchable_rom_bank_beginning) != rom_bank_n) {
+        m_memory.mark_dirty(s_address_switchable_rom_bank_beginning, s_address_rom_end);
+    }
+}
+
 }
@@ -5,8 +5,10 @@
 #include "crosscutting/util/byte_util.h"
 #include "interrupts.h"
 #include <memory>
+#include <span>
 
 namespace emu::applications::game_boy {
+class Cartridge;
 class Lcd;
 class Settings;
 class Timer;
@@ -15,17 +17,24 @@ namespace emu::memory {
 template<class A, class D>
 class EmulatorMemory;
 }
+namespace emu::misc {
+class StateReader;
+class StateWriter;
+}
 
 namespace emu::applications::game_boy {
 
 using emu::memory::EmulatorMemory;
 using emu::memory::MemoryMappedIo;
+using emu::misc::StateReader;
+using emu::misc::StateWriter;
 using emu::util::byte::low_nibble;
 
 class MemoryMappedIoForGameBoy : public MemoryMappedIo<u16, u8> {
 public:
     explicit MemoryMappedIoForGameBoy(
         EmulatorMemory<u16, u8>& memory,
+        std::shared_ptr<Cartridge> cartridge,
         std::shared_ptr<Timer> timer,
         std::shared_ptr<Lcd> lcd,
         Settings settings);
@@ -50,6 +59,24 @@ public:
 
     [[nodiscard]] bool is_boot_rom_active() const;
 
+    /**
+     * Copies what the CPU sees at $0000-$ffff for the debugger, with the ROM banks and the
+     * cartridge RAM that are switched in. The registers that aren't kept in memory are left out.
+     *
+     * @param memory is where the memory is copied to, which has to be 64 KB
+     */
+    void copy(std::span<u8> memory) const;
+
+    /**
+     * Saves the state of the buttons, which is what is recorded when recording the input of a
+     * session.
+     *
+     * @param writer is the state to save to
+     */
+    void save_input_state(StateWriter& writer) const;
+
+    void load_input_state(StateReader& reader);
+
 private:
     static constexpr u16 s_interrupt_bit_vblank = 0;
     static constexpr u16 s_interrupt_bit_lcd = 1;
@@ -59,7 +86,9 @@ private:
     static constexpr u16 s_bit_number_select_button_keys = 5;
     static constexpr u16 s_bit_number_select_direction_keys = 4;
 
+    static constexpr u16 s_address_rom_beginning = 0x0000;
     static constexpr u16 s_address_boot_rom_end = 0x00ff;
+    static constexpr u16 s_address_switchable_rom_bank_beginning = 0x4000;
     static constexpr u16 s_address_rom_end = 0x7fff;
     static constexpr u16 s_address_tile_ram_beginning = 0x8000;
     static constexpr u16 s_address_tile_ram_end = 0x97ff;
@@ -142,6 +171,7 @@ private:
     static constexpr u16 s_address_interrupt_enabled_register = 0xffff; // IE
 
     EmulatorMemory<u16, u8>& m_memory;
+    std::shared_ptr<Cartridge> m_cartridge;
     std::shared_ptr<Timer> m_timer;
     std::shared_ptr<Lcd> m_lcd;
 
@@ -155,5 +185,7 @@ private:
     bool m_is_reading_direction_keys { false };
 
     void dma_transfer(u8 value);
+
+    void write_rom(u16 address, u8 value);
 };
 }
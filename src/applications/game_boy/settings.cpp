@@ -27,6 +27,29 @@ Settings Settings::from_options(Options const& options)
 
     std::unordered_map<std::string, std::vector<std::string>> opts = options.options();
 
+    if (opts.contains(s_record_long)) {
+        settings.m_record_file = movie_file(s_record_long, opts.at(s_record_long));
+    }
+
+    if (opts.contains(s_replay_long)) {
+        settings.m_replay_file = movie_file(s_replay_long, opts.at(s_replay_long));
+    }
+
+    if (!settings.m_record_file.empty() && !settings.m_replay_file.empty()) {
+        throw InvalidProgramArgumentsException("Cannot record and replay input at the same time", print_usage);
+    }
+
     return settings;
 }
+
+std::string Settings::movie_file(std::string const& option, std::vector<std::string> const& values)
+{
+    if (values.size() != 1 || values[0].empty()) {
+        throw InvalidProgramArgumentsException(
+            fmt::format(R"(Invalid file passed to the --{0} option. Should be "--{0}=<file>".)", option),
+            print_usage);
+    }
+
+    return values[0];
+}
 }
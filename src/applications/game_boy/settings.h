@@ -2,6 +2,7 @@
 
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 namespace emu::applications {
 class Options;
@@ -11,6 +12,8 @@ namespace emu::applications::game_boy {
 
 class Settings {
 public:
+    std::string m_record_file;
+    std::string m_replay_file;
 
     static Settings from_options(Options const& options);
 
@@ -20,9 +23,14 @@ private:
     static const inline std::string s_debug_scanner_long = "debug-scanner";
 
     static const inline std::string s_gui_short = "g";
+    static const inline std::string s_record_long = "record";
+    static const inline std::string s_replay_long = "replay";
 
     static const inline std::unordered_set<std::string> s_recognized_options = {
-        s_help_short, s_help_long, s_debug_scanner_long, s_gui_short
+        s_help_short, s_help_long, s_debug_scanner_long, s_gui_short,
+        s_record_long, s_replay_long
     };
+
+    static std::string movie_file(std::string const& option, std::vector<std::string> const& values);
 };
 }
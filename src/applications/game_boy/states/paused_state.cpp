@@ -3,6 +3,7 @@
 #include "applications/game_boy/gui_io.h"
 #include "applications/game_boy/interfaces/input.h"
 #include "applications/game_boy/lcd.h"
+#include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/misc/governor.h"
 #include "state_context.h"
@@ -51,6 +52,7 @@ void PausedState::perform([[maybe_unused]] cyc& cycles)
             transition_to_run();
             return;
         }
+        m_ctx->m_debug_container->take_snapshot();
         m_ctx->m_gui->update_screen(m_ctx->m_lcd->lcd_control(),
             tile_ram_block_1(), tile_ram_block_2(), tile_ram_block_3(),
             tile_map_1(), tile_map_2(), sprite_ram(), palette_ram(), s_game_window_subtitle);
@@ -8,18 +8,23 @@
 #include "applications/game_boy/memory_mapped_io_for_game_boy.h"
 #include "applications/game_boy/timer.h"
 #include "chips/lr35902/cpu.h"
+#include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/debugging/debugger.h"
 #include "crosscutting/logging/logger.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/misc/governor.h"
+#include "crosscutting/misc/input_movie.h"
+#include "crosscutting/misc/port_decoder.h"
+#include "crosscutting/misc/state_stream.h"
 #include "crosscutting/typedefs.h"
 #include "state_context.h"
-#include <unordered_map>
 #include <utility>
 
 namespace emu::applications::game_boy {
 
 using emu::misc::Governor;
+using emu::misc::StateReader;
+using emu::misc::StateWriter;
 
 RunningState::RunningState(std::shared_ptr<StateContext> state_context)
     : m_ctx(std::move(state_context))
@@ -67,7 +72,7 @@ void RunningState::perform(cyc& cycles)
             }
         }
 
-        m_ctx->m_input->read(m_ctx->m_gui_io, m_ctx->m_memory_mapped_io);
+        read_input();
         if (m_ctx->m_gui_io.m_is_quitting) {
             m_ctx->m_gui_io.m_is_quitting = false;
             transition_to_stop();
@@ -78,6 +83,7 @@ void RunningState::perform(cyc& cycles)
             return;
         }
 
+        m_ctx->m_debug_container->take_snapshot();
         m_ctx->m_gui->update_screen(m_ctx->m_lcd->lcd_control(),
             tile_ram_block_1(), tile_ram_block_2(), tile_ram_block_3(),
             tile_map_1(), tile_map_2(), sprite_ram(), palette_ram(), s_game_window_subtitle);
@@ -86,6 +92,46 @@ void RunningState::perform(cyc& cycles)
     }
 }
 
+/**
+ * Reads the input once per frame. When recording, the buttons are added to the input movie. When
+ * replaying, the buttons come from the input movie instead of from the player, and the session
+ * stops when the movie is over.
+ */
+void RunningState::read_input()
+{
+    if (is_replaying()) {
+        if (m_ctx->m_input_movie->is_finished()) {
+            m_ctx->m_gui_io.m_is_quitting = true;
+            return;
+        }
+
+        m_input.clear();
+        StateWriter writer(m_input);
+        m_ctx->m_memory_mapped_io->save_input_state(writer);
+
+        if (m_ctx->m_input_movie->replay(m_input)) {
+            StateReader reader(m_input);
+            m_ctx->m_memory_mapped_io->load_input_state(reader);
+        }
+
+        return;
+    }
+
+    m_ctx->m_input->read(m_ctx->m_gui_io, m_ctx->m_memory_mapped_io);
+
+    if (m_ctx->m_input_movie) {
+        m_input.clear();
+        StateWriter writer(m_input);
+        m_ctx->m_memory_mapped_io->save_input_state(writer);
+        m_ctx->m_input_movie->record(m_input);
+    }
+}
+
+bool RunningState::is_replaying() const
+{
+    return m_ctx->m_input_movie && m_ctx->m_input_movie->is_replaying();
+}
+
 void RunningState::update_graphics(cyc cycles)
 {
     if (m_ctx->m_lcd->lcd_control().m_is_ldc_and_ppu_enabled) {
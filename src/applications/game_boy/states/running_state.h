@@ -41,6 +41,12 @@ private:
 
     std::shared_ptr<StateContext> m_ctx;
 
+    std::vector<u8> m_input;
+
+    void read_input();
+
+    [[nodiscard]] bool is_replaying() const;
+
     void update_graphics(cyc cycles);
 
     std::vector<u8> tile_ram_block_1();
@@ -5,7 +5,6 @@
 #include "crosscutting/typedefs.h"
 #include <cstddef>
 #include <memory>
-#include <unordered_map>
 #include <vector>
 
 namespace emu::applications::game_boy {
@@ -36,6 +35,8 @@ class EmulatorMemory;
 }
 namespace emu::misc {
 class Governor;
+class InputMovie;
+class PortCapture;
 }
 
 namespace emu::applications::game_boy {
@@ -43,6 +44,8 @@ namespace emu::applications::game_boy {
 using emu::lr35902::Cpu;
 using emu::memory::EmulatorMemory;
 using emu::misc::Governor;
+using emu::misc::InputMovie;
+using emu::misc::PortCapture;
 
 class StateContext {
 public:
@@ -60,8 +63,9 @@ public:
         std::shared_ptr<Logger> logger,
         std::shared_ptr<Debugger<u16, 16>> debugger,
         std::shared_ptr<DebugContainer<u16, u8, 16>> debug_container,
-        std::unordered_map<u8, u8>& outputs_during_cycle,
+        PortCapture& outputs_during_cycle,
         Governor& governor,
+        std::shared_ptr<InputMovie> input_movie,
         bool& is_in_debug_mode);
 
     bool& m_is_in_debug_mode;
@@ -82,9 +86,10 @@ public:
     std::shared_ptr<Logger> m_logger;
     std::shared_ptr<Debugger<u16, 16>> m_debugger;
     std::shared_ptr<DebugContainer<u16, u8, 16>> m_debug_container;
-    std::unordered_map<u8, u8>& m_outputs_during_cycle;
+    PortCapture& m_outputs_during_cycle;
 
     Governor& m_governor;
+    std::shared_ptr<InputMovie> m_input_movie;
 
     int m_scanline_counter = { 456 };
 
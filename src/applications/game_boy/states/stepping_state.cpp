@@ -5,10 +5,11 @@
 #include "applications/game_boy/interrupts.h"
 #include "applications/game_boy/lcd.h"
 #include "chips/lr35902/cpu.h"
+#include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/memory/emulator_memory.h"
+#include "crosscutting/misc/port_decoder.h"
 #include "crosscutting/typedefs.h"
 #include "state_context.h"
-#include <unordered_map>
 #include <utility>
 
 namespace emu::misc {
@@ -78,6 +79,7 @@ void SteppingState::perform(cyc& cycles)
         transition_to_run();
         return;
     }
+    m_ctx->m_debug_container->take_snapshot();
     m_ctx->m_gui->update_screen(m_ctx->m_lcd->lcd_control(),
         tile_ram_block_1(), tile_ram_block_2(), tile_ram_block_3(),
         tile_map_1(), tile_map_2(), sprite_ram(), palette_ram(), s_game_window_subtitle);
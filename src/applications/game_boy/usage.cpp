@@ -13,9 +13,13 @@ static constexpr std::size_t padding_to_description = 14;
 
 const std::vector<std::pair<std::string, std::string>> supported_flags = {
     { "-g", "ordinary, debugging. ordinary is default." },
+    { "--record", "Record the input to a file, to replay it later." },
+    { "--replay", "Replay recorded input headless, as fast as possible, and print a hash of every frame." }
 };
 const std::vector<std::pair<std::string, std::string>> examples = {
     { "-g debugging", "Running with the debugging GUI" },
+    { "--record=game.inp", "Recording the input to game.inp" },
+    { "--replay=game.inp", "Replaying the input recorded in game.inp" }
 };
 
 void print_usage(std::string const& program_name)
@@ -0,0 +1,129 @@
+#include "batch_grader.h"
+#include "batch_grading_session.h"
+#include "chips/trivial/lmc/assembler/assembler.h"
+#include "crosscutting/exceptions/rom_file_not_found_exception.h"
+#include "crosscutting/util/file_util.h"
+#include <algorithm>
+#include <exception>
+#include <filesystem>
+#include <fmt/core.h>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace emu::applications::lmc {
+
+using emu::exceptions::RomFileNotFoundException;
+using emu::lmc::Assembler;
+using emu::util::file::read_file;
+
+BatchGrader::BatchGrader(std::string const& path, std::string const& test_vectors_path, u64 instruction_limit)
+    : m_test_vectors(read_test_vectors(test_vectors_path))
+    , m_instruction_limit(instruction_limit)
+{
+    load_programs(path);
+}
+
+std::unique_ptr<Session> BatchGrader::new_session()
+{
+    return std::make_unique<BatchGradingSession>(m_programs, m_test_vectors, m_instruction_limit);
+}
+
+void BatchGrader::load_programs(std::string const& path)
+{
+    if (!std::filesystem::exists(path)) {
+        throw RomFileNotFoundException(path);
+    }
+
+    if (!std::filesystem::is_directory(path)) {
+        m_programs.push_back(assemble(path));
+        return;
+    }
+
+    std::vector<std::string> files;
+    for (auto const& entry : std::filesystem::directory_iterator(path)) {
+        if (entry.is_regular_file() && entry.path().extension() == s_program_extension) {
+            files.push_back(entry.path().string());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    for (std::string const& file : files) {
+        m_programs.push_back(assemble(file));
+    }
+}
+
+/**
+ * A program that doesn't assemble fails every test vector, instead of stopping the grading of the
+ * other programs.
+ */
+GradedProgram BatchGrader::assemble(std::string const& file)
+{
+    GradedProgram program { .m_file = file, .m_memory = {}, .m_assembly_error = std::nullopt };
+
+    try {
+        std::vector<Data> code = Assembler::assemble(read_file(file));
+        if (code.size() > s_memory_size) {
+            throw std::runtime_error(fmt::format("The program takes {} mailboxes, but there are only {}", code.size(), s_memory_size));
+        }
+
+        code.resize(s_memory_size, Data(0));
+        program.m_memory.add(code);
+    } catch (std::exception const& ex) {
+        program.m_assembly_error = ex.what();
+    }
+
+    return program;
+}
+
+std::vector<TestVector> BatchGrader::read_test_vectors(std::string const& path)
+{
+    if (!std::filesystem::exists(path)) {
+        throw RomFileNotFoundException(path);
+    }
+
+    std::stringstream file_content = read_file(path);
+    std::vector<TestVector> test_vectors;
+    std::string line;
+
+    for (std::size_t line_number = 1; std::getline(file_content, line); ++line_number) {
+        const std::size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#') {
+            continue;
+        }
+
+        const std::size_t arrow = line.find("->");
+        if (arrow == std::string::npos) {
+            throw std::invalid_argument(fmt::format("Line {} of {} is missing -> between the inputs and the outputs", line_number, path));
+        }
+
+        test_vectors.push_back({
+            .m_line = line_number,
+            .m_inputs = parse_numbers(line.substr(0, arrow), path, line_number),
+            .m_expected_outputs = parse_numbers(line.substr(arrow + 2), path, line_number),
+        });
+    }
+
+    if (test_vectors.empty()) {
+        throw std::invalid_argument(fmt::format("There are no test vectors in {}", path));
+    }
+
+    return test_vectors;
+}
+
+std::vector<Data> BatchGrader::parse_numbers(std::string const& numbers, std::string const& path, std::size_t line)
+{
+    std::vector<Data> parsed;
+    std::istringstream stream(numbers);
+    std::string number;
+
+    while (stream >> number) {
+        if (number.size() > 3 || !std::all_of(number.begin(), number.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+            throw std::invalid_argument(fmt::format("Line {} of {} has {}, which is not a number from 0 to 999", line, path, number));
+        }
+        parsed.emplace_back(std::stoul(number));
+    }
+
+    return parsed;
+}
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "chips/trivial/lmc/usings.h"
+#include "crosscutting/memory/emulator_memory.h"
+#include "crosscutting/misc/emulator.h"
+#include "crosscutting/misc/uinteger.h"
+#include "crosscutting/typedefs.h"
+#include "test_vector.h"
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace emu::misc {
+class Session;
+}
+
+namespace emu::applications::lmc {
+
+using emu::lmc::Address;
+using emu::lmc::Data;
+using emu::memory::EmulatorMemory;
+using emu::misc::Emulator;
+using emu::misc::Session;
+
+/**
+ * A program that has been assembled once, to be run against every test vector.
+ */
+struct GradedProgram {
+    std::string m_file;
+    EmulatorMemory<Address, Data> m_memory;
+    std::optional<std::string> m_assembly_error;
+};
+
+/**
+ * Grades LMC programs without a UI, by running each of them against a file of test vectors. The
+ * path is either one program or a directory of them, so a whole class can be graded at once.
+ */
+class BatchGrader : public Emulator {
+public:
+    BatchGrader(std::string const& path, std::string const& test_vectors_path, u64 instruction_limit);
+
+    std::unique_ptr<Session> new_session() override;
+
+private:
+    static constexpr std::size_t s_memory_size = 100;
+    static constexpr const char* s_program_extension = ".lmc";
+
+    std::vector<GradedProgram> m_programs;
+    std::vector<TestVector> m_test_vectors;
+    u64 m_instruction_limit;
+
+    void load_programs(std::string const& path);
+
+    static GradedProgram assemble(std::string const& file);
+
+    /**
+     * Reads one test vector per line, on the form "1 2 -> 3", which gives the program the inputs 1
+     * and 2 and expects the output 3. Empty lines and lines starting with # are skipped.
+     */
+    static std::vector<TestVector> read_test_vectors(std::string const& path);
+
+    static std::vector<Data> parse_numbers(std::string const& numbers, std::string const& path, std::size_t line);
+};
+}
@@ -0,0 +1,213 @@
+#include "batch_grading_session.h"
+#include "chips/trivial/lmc/cpu.h"
+#include "chips/trivial/lmc/interfaces/in_observer.h"
+#include "chips/trivial/lmc/interfaces/out_observer.h"
+#include "chips/trivial/lmc/out_type.h"
+#include "crosscutting/util/parallel_util.h"
+#include <chrono>
+#include <exception>
+#include <fmt/core.h>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+namespace emu::applications::lmc {
+
+using emu::lmc::Cpu;
+using emu::lmc::InObserver;
+using emu::lmc::OutObserver;
+using emu::lmc::OutType;
+using emu::util::parallel::parallel_for_each;
+
+/**
+ * Gives the program the inputs of a test vector, and collects what it outputs.
+ */
+class HeadlessTerminal
+    : public InObserver
+    , public OutObserver {
+public:
+    HeadlessTerminal(Cpu& cpu, std::vector<Data> const& inputs)
+        : m_cpu(cpu)
+        , m_inputs(inputs)
+    {
+    }
+
+    void in_requested() override
+    {
+        if (m_next_input == m_inputs.size()) {
+            m_is_out_of_input = true;
+            return;
+        }
+
+        m_cpu.input(m_inputs[m_next_input++]);
+    }
+
+    void out_changed(Data acc_reg, [[maybe_unused]] OutType out_type) override
+    {
+        m_outputs.push_back(acc_reg);
+    }
+
+    [[nodiscard]] bool is_out_of_input() const
+    {
+        return m_is_out_of_input;
+    }
+
+    std::vector<Data>& outputs()
+    {
+        return m_outputs;
+    }
+
+private:
+    Cpu& m_cpu;
+    std::vector<Data> const& m_inputs;
+    std::size_t m_next_input { 0 };
+    bool m_is_out_of_input { false };
+    std::vector<Data> m_outputs;
+};
+
+BatchGradingSession::BatchGradingSession(
+    std::vector<GradedProgram> programs,
+    std::vector<TestVector> test_vectors,
+    u64 instruction_limit)
+    : m_programs(std::move(programs))
+    , m_test_vectors(std::move(test_vectors))
+    , m_instruction_limit(instruction_limit)
+{
+}
+
+void BatchGradingSession::run()
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<GradingResult> results(m_programs.size() * m_test_vectors.size());
+
+    // Each run is written to its own element, so the results need no lock
+    parallel_for_each(results.size(), [&](std::size_t run) {
+        results[run] = grade(run);
+    });
+
+    print_report(results, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+}
+
+void BatchGradingSession::pause()
+{
+    throw std::runtime_error("Pause is not implemented for grading");
+}
+
+void BatchGradingSession::stop()
+{
+    throw std::runtime_error("Stop is not implemented for grading");
+}
+
+GradingResult BatchGradingSession::grade(std::size_t run) const
+{
+    GradedProgram const& program = m_programs[run / m_test_vectors.size()];
+    if (program.m_assembly_error.has_value()) {
+        return { .m_outcome = GradingOutcome::Crashed, .m_outputs = {}, .m_error = program.m_assembly_error.value() };
+    }
+
+    return run_program(program.m_memory, m_test_vectors[run % m_test_vectors.size()], m_instruction_limit);
+}
+
+/**
+ * @param memory is a copy of the program's memory, which the run is free to change
+ * @param test_vector is the inputs to give the program and the outputs it has to give back
+ * @param instruction_limit is how many instructions the program can run before it's taken to be
+ *                          stuck in a loop
+ */
+GradingResult BatchGradingSession::run_program(EmulatorMemory<Address, Data> memory, TestVector const& test_vector, u64 instruction_limit)
+{
+    Cpu cpu(memory, Address(0));
+    HeadlessTerminal terminal(cpu, test_vector.m_inputs);
+    cpu.add_in_observer(terminal);
+    cpu.add_out_observer(terminal);
+
+    GradingResult result;
+    try {
+        u64 instructions = 0;
+        while (cpu.can_run_next_instruction() && !terminal.is_out_of_input() && instructions < instruction_limit) {
+            cpu.next_instruction();
+            ++instructions;
+        }
+
+        if (terminal.is_out_of_input()) {
+            result.m_outcome = GradingOutcome::OutOfInput;
+        } else if (cpu.can_run_next_instruction()) {
+            result.m_outcome = GradingOutcome::InstructionLimit;
+        } else if (terminal.outputs() == test_vector.m_expected_outputs) {
+            result.m_outcome = GradingOutcome::Passed;
+        } else {
+            result.m_outcome = GradingOutcome::WrongOutput;
+        }
+    } catch (std::exception const& ex) {
+        result.m_outcome = GradingOutcome::Crashed;
+        result.m_error = ex.what();
+    }
+
+    result.m_outputs = std::move(terminal.outputs());
+    return result;
+}
+
+void BatchGradingSession::print_report(std::vector<GradingResult> const& results, double seconds) const
+{
+    std::size_t programs_passed = 0;
+
+    for (std::size_t program = 0; program < m_programs.size(); ++program) {
+        std::size_t tests_passed = 0;
+        std::vector<std::string> failures;
+
+        for (std::size_t test = 0; test < m_test_vectors.size(); ++test) {
+            GradingResult const& result = results[program * m_test_vectors.size() + test];
+            if (result.m_outcome == GradingOutcome::Passed) {
+                ++tests_passed;
+            } else if (failures.size() < s_max_reported_failures) {
+                failures.push_back(describe(m_test_vectors[test], result));
+            }
+        }
+
+        if (tests_passed == m_test_vectors.size()) {
+            ++programs_passed;
+        }
+
+        std::cout << fmt::format("{}: {}/{} passed\n", m_programs[program].m_file, tests_passed, m_test_vectors.size());
+        for (std::string const& failure : failures) {
+            std::cout << "    " << failure << "\n";
+        }
+    }
+
+    std::cout << fmt::format(
+        "\n{} of {} programs passed all {} test vectors ({} runs in {:.2f} s)\n",
+        programs_passed, m_programs.size(), m_test_vectors.size(), results.size(), seconds);
+}
+
+std::string BatchGradingSession::describe(TestVector const& test_vector, GradingResult const& result)
+{
+    const std::string test = fmt::format("Line {}, inputs [{}]", test_vector.m_line, join(test_vector.m_inputs));
+
+    switch (result.m_outcome) {
+    case GradingOutcome::WrongOutput:
+        return fmt::format("{}: expected [{}], got [{}]", test, join(test_vector.m_expected_outputs), join(result.m_outputs));
+    case GradingOutcome::OutOfInput:
+        return fmt::format("{}: asked for more input than it was given", test);
+    case GradingOutcome::InstructionLimit:
+        return fmt::format("{}: did not halt, so it might be stuck in a loop", test);
+    case GradingOutcome::Crashed:
+        return fmt::format("{}: {}", test, result.m_error);
+    default:
+        return fmt::format("{}: was not run", test);
+    }
+}
+
+std::string BatchGradingSession::join(std::vector<Data> const& values)
+{
+    std::string joined;
+    for (Data const& value : values) {
+        if (!joined.empty()) {
+            joined += " ";
+        }
+        joined += std::to_string(value.underlying());
+    }
+
+    return joined;
+}
+}
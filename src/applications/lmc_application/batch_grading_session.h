@@ -0,0 +1,71 @@
+#pragma once
+
+#include "batch_grader.h"
+#include "chips/trivial/lmc/usings.h"
+#include "crosscutting/memory/emulator_memory.h"
+#include "crosscutting/misc/session.h"
+#include "crosscutting/misc/uinteger.h"
+#include "crosscutting/typedefs.h"
+#include "test_vector.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace emu::applications::lmc {
+
+using emu::lmc::Address;
+using emu::lmc::Data;
+using emu::memory::EmulatorMemory;
+using emu::misc::Session;
+
+enum class GradingOutcome {
+    NotRun,
+    Passed,
+    WrongOutput,
+    OutOfInput,
+    InstructionLimit,
+    Crashed
+};
+
+struct GradingResult {
+    GradingOutcome m_outcome { GradingOutcome::NotRun };
+    std::vector<Data> m_outputs;
+    std::string m_error;
+};
+
+/**
+ * Runs every program against every test vector, spread over one thread per core, and prints a
+ * report of which tests each program failed. Every run has its own copy of the program's memory
+ * and its own CPU, so the runs don't share anything but the programs and test vectors they read.
+ */
+class BatchGradingSession : public Session {
+public:
+    BatchGradingSession(
+        std::vector<GradedProgram> programs,
+        std::vector<TestVector> test_vectors,
+        u64 instruction_limit);
+
+    void run() override;
+
+    void pause() override;
+
+    void stop() override;
+
+private:
+    static constexpr std::size_t s_max_reported_failures = 5;
+
+    std::vector<GradedProgram> m_programs;
+    std::vector<TestVector> m_test_vectors;
+    u64 m_instruction_limit;
+
+    [[nodiscard]] GradingResult grade(std::size_t run) const;
+
+    static GradingResult run_program(EmulatorMemory<Address, Data> memory, TestVector const& test_vector, u64 instruction_limit);
+
+    void print_report(std::vector<GradingResult> const& results, double seconds) const;
+
+    static std::string describe(TestVector const& test_vector, GradingResult const& result);
+
+    static std::string join(std::vector<Data> const& values);
+};
+}
@@ -260,7 +260,7 @@ void LmcApplicationSession::setup_debugging()
     m_ui->attach_logger(m_logger);
 }
 
-std::vector<Data> LmcApplicationSession::memory()
+std::span<Data const> LmcApplicationSession::memory()
 {
     return { m_memory.begin(), m_memory.end() };
 }
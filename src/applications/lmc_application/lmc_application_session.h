@@ -13,6 +13,7 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -119,7 +120,7 @@ private:
 
     void setup_debugging();
 
-    std::vector<Data> memory();
+    std::span<Data const> memory();
 
     void assemble_and_load_request();
 
@@ -6,9 +6,9 @@
 #include <cstring>
 #include <fmt/core.h>
 #include <memory>
+#include <span>
 #include <string>
 #include <utility>
-#include <vector>
 
 namespace emu::applications::lmc {
 
@@ -38,7 +38,8 @@ void LmcMemoryEditor::draw(char const* title, bool* p_open)
         const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg //
             | ImGuiTableFlags_SizingFixedSame | ImGuiTableFlags_NoHostExtendX;
 
-        const std::vector<Data> memory = m_debug_container->memory().value();
+        m_debug_container->request_snapshot();
+        const std::span<Data const> memory = m_debug_container->snapshot().m_memory;
 
         if (ImGui::BeginTable("memory_editor", s_cols, flags)) {
             unsigned int address = 0;
@@ -3,6 +3,7 @@
 #include "applications/lmc_application/interfaces/input.h"
 #include "applications/lmc_application/states/state_context.h"
 #include "applications/lmc_application/ui.h"
+#include "crosscutting/debugging/debug_container.h"
 #include <utility>
 
 namespace emu::misc {
@@ -61,6 +62,7 @@ void RunningAwaitingInputState::perform([[maybe_unused]] cyc& cycles)
         return;
     }
 
+    m_ctx->m_debug_container->take_snapshot();
     m_ctx->m_ui->update_screen(m_ctx->m_is_awaiting_input, s_game_window_subtitle);
 
     if (!m_ctx->m_is_awaiting_input) {
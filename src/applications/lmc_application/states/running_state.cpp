@@ -4,6 +4,7 @@
 #include "applications/lmc_application/states/state_context.h"
 #include "applications/lmc_application/ui.h"
 #include "chips/trivial/lmc/cpu.h"
+#include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/debugging/debugger.h"
 #include "crosscutting/logging/logger.h"
 #include "crosscutting/misc/governor.h"
@@ -92,6 +93,7 @@ void RunningState::perform(cyc& cycles)
             return;
         }
 
+        m_ctx->m_debug_container->take_snapshot();
         m_ctx->m_ui->update_screen(m_ctx->m_is_awaiting_input, s_game_window_subtitle);
 #ifndef __EMSCRIPTEN__
     }
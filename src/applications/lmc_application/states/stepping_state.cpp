@@ -3,6 +3,7 @@
 #include "applications/lmc_application/interfaces/input.h"
 #include "applications/lmc_application/ui.h"
 #include "chips/trivial/lmc/cpu.h"
+#include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/typedefs.h"
 #include "state_context.h"
 #include <utility>
@@ -79,6 +80,7 @@ void SteppingState::perform([[maybe_unused]] cyc& cycles)
         return;
     }
 
+    m_ctx->m_debug_container->take_snapshot();
     m_ctx->m_ui->update_screen(m_ctx->m_is_awaiting_input, s_game_window_subtitle);
 #else
     if (await_input_and_update_debug()) {
@@ -111,6 +113,7 @@ void SteppingState::perform([[maybe_unused]] cyc& cycles)
         return;
     }
 
+    m_ctx->m_debug_container->take_snapshot();
     m_ctx->m_ui->update_screen(m_ctx->m_is_awaiting_input, s_game_window_subtitle);
 #endif
 }
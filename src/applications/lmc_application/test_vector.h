@@ -0,0 +1,20 @@
+#pragma once
+
+#include "chips/trivial/lmc/usings.h"
+#include "crosscutting/misc/uinteger.h"
+#include <cstddef>
+#include <vector>
+
+namespace emu::applications::lmc {
+
+using emu::lmc::Data;
+
+/**
+ * The input a program is given, and the output it has to give back, to pass one test.
+ */
+struct TestVector {
+    std::size_t m_line; // Where in the file of test vectors it was read from
+    std::vector<Data> m_inputs;
+    std::vector<Data> m_expected_outputs;
+};
+}
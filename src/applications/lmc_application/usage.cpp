@@ -9,14 +9,18 @@ namespace emu::applications::lmc {
 
 using emu::util::string::create_padding;
 
-static constexpr std::size_t padding_to_description = 14;
+static constexpr std::size_t padding_to_description = 22;
 
 const std::vector<std::pair<std::string, std::string>> supported_flags = {
-    { "-g", "ordinary, debugging. ordinary is default." }
+    { "-g", "ordinary, debugging. ordinary is default." },
+    { "--grade", "A file of test vectors to grade <file> with, one per line, like \"1 2 -> 3\"." },
+    { "", "<file> can also be a directory, to grade every .lmc file in it." },
+    { "--max-instructions", "When grading, how many instructions a program can run. 100000 is default." }
 };
 const std::vector<std::pair<std::string, std::string>> examples = {
     { "-g debugging add_numbers.lmc", "Running add_numbers.lmc with the debugging GUI" },
-    { "-g ordinary test.lmc", "Running test.lmc in the terminal" }
+    { "-g ordinary test.lmc", "Running test.lmc in the terminal" },
+    { "--grade=tests.txt submissions", "Grading every program in submissions/ with the test vectors in tests.txt" }
 };
 
 void print_usage(std::string const& program_name)
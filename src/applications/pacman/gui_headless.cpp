@@ -0,0 +1,55 @@
+#include "gui_headless.h"
+#include "crosscutting/benchmarking/benchmark.h"
+#include "crosscutting/gui/gui_for_benchmark.h"
+#include "gui.h"
+#include <vector>
+
+namespace emu::applications::pacman {
+class GuiObserver;
+}
+
+namespace emu::applications::pacman {
+
+using emu::benchmarking::pseudo_random_bytes;
+using emu::gui::GuiForBenchmark;
+
+void GuiHeadless::toggle_tile_debug()
+{
+}
+
+void GuiHeadless::toggle_sprite_debug()
+{
+}
+
+void GuiHeadless::update_screen(
+    std::vector<u8> const& tile_ram,
+    std::vector<u8> const& sprite_ram,
+    std::vector<u8> const& palette_ram,
+    bool is_screen_flipped,
+    [[maybe_unused]] std::string const& game_window_subtitle)
+{
+    print_frame_hash(create_framebuffer(tile_ram, sprite_ram, palette_ram, is_screen_flipped));
+}
+
+BENCHMARK("Pacman: Gui create_framebuffer")
+{
+    std::vector<u8> palette_rom = pseudo_random_bytes(256);
+    for (u8& color_idx : palette_rom) {
+        color_idx %= 16;
+    }
+    std::vector<u8> sprite_ram = pseudo_random_bytes(128);
+    for (u8& coordinate : sprite_ram) {
+        coordinate %= 200;
+    }
+
+    GuiForBenchmark<GuiHeadless> gui;
+    gui.load_color_rom(pseudo_random_bytes(32));
+    gui.load_palette_rom(palette_rom);
+    gui.load_tile_rom(pseudo_random_bytes(4096));
+    gui.load_sprite_rom(pseudo_random_bytes(4096));
+    const std::vector<u8> tile_ram = pseudo_random_bytes(1024);
+    const std::vector<u8> palette_ram = pseudo_random_bytes(1024);
+
+    gui.run_create_framebuffer(bench, tile_ram, sprite_ram, palette_ram, false);
+}
+}
@@ -39,6 +39,9 @@ void InputSdl::read(GuiIo& gui_io, std::shared_ptr<MemoryMappedIoForPacman> memo
             break;
         case SDL_KEYUP:
             switch (read_input_event.key.keysym.scancode) {
+            case s_rewind:
+                gui_io.m_is_rewinding = false;
+                break;
             case s_credit:
                 memory_mapped_io->in0_read(7, true);
                 break;
@@ -87,6 +90,9 @@ void InputSdl::read(GuiIo& gui_io, std::shared_ptr<MemoryMappedIoForPacman> memo
             case s_mute:
                 notify_io_observers(IoRequest::TOGGLE_MUTE);
                 break;
+            case s_rewind:
+                gui_io.m_is_rewinding = true;
+                break;
             case s_pause:
                 gui_io.m_is_toggling_pause = true;
                 break;
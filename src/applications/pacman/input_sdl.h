@@ -27,6 +27,7 @@ public:
 private:
     static constexpr SDL_Scancode s_mute = SDL_SCANCODE_M;
     static constexpr SDL_Scancode s_pause = SDL_SCANCODE_PAUSE;
+    static constexpr SDL_Scancode s_rewind = SDL_SCANCODE_PAGEDOWN;
 
     static constexpr SDL_Scancode s_credit = SDL_SCANCODE_X;
     static constexpr SDL_Scancode s_insert_coin_p1 = SDL_SCANCODE_C;
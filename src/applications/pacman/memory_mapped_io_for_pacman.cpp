@@ -1,6 +1,7 @@
 #include "memory_mapped_io_for_pacman.h"
 #include "chips/z80/util.h"
 #include "crosscutting/memory/emulator_memory.h"
+#include "crosscutting/misc/state_stream.h"
 #include "namco_wsg3/voice.h"
 #include "pacman/settings.h"
 
@@ -297,6 +298,48 @@ std::vector<Voice>& MemoryMappedIoForPacman::voices()
     return m_voices;
 }
 
+void MemoryMappedIoForPacman::save_state(StateWriter& writer) const
+{
+    writer.write(m_is_sound_enabled);
+    writer.write(m_is_aux_board_enabled);
+    writer.write(m_is_screen_flipped);
+    writer.write(m_in0_write);
+
+    for (auto const& voice : m_voices) {
+        writer.write(voice.waveform_number());
+        writer.write(voice.frequency());
+        writer.write(voice.volume());
+        writer.write(voice.accumulator());
+    }
+}
+
+void MemoryMappedIoForPacman::load_state(StateReader& reader)
+{
+    m_is_sound_enabled = reader.read<bool>();
+    m_is_aux_board_enabled = reader.read<bool>();
+    m_is_screen_flipped = reader.read<bool>();
+    m_in0_write = reader.read<u8>();
+
+    for (auto& voice : m_voices) {
+        voice.waveform_number(reader.read<u8>());
+        voice.frequency(reader.read<u32>());
+        voice.volume(reader.read<u8>());
+        voice.accumulator(reader.read<u32>());
+    }
+}
+
+void MemoryMappedIoForPacman::save_input_state(StateWriter& writer) const
+{
+    writer.write(m_in0_read);
+    writer.write(m_in1_read);
+}
+
+void MemoryMappedIoForPacman::load_input_state(StateReader& reader)
+{
+    m_in0_read = reader.read<u8>();
+    m_in1_read = reader.read<u8>();
+}
+
 void MemoryMappedIoForPacman::voice1_accumulator(u8 value, u16 address)
 {
     const u8 sample = address - s_address_voice1_sound_beginning;
@@ -14,11 +14,17 @@ namespace emu::memory {
 template<class A, class D>
 class EmulatorMemory;
 }
+namespace emu::misc {
+class StateReader;
+class StateWriter;
+}
 
 namespace emu::applications::pacman {
 
 using emu::memory::EmulatorMemory;
 using emu::memory::MemoryMappedIo;
+using emu::misc::StateReader;
+using emu::misc::StateWriter;
 using emu::util::byte::low_nibble;
 using emu::wsg3::Voice;
 
@@ -52,6 +58,25 @@ public:
 
     std::vector<Voice>& voices();
 
+    /**
+     * Saves the state that is written by the CPU. The inputs are left out, as they follow the
+     * keys that are held down right now and not the state that is being saved.
+     *
+     * @param writer is the state to save to
+     */
+    void save_state(StateWriter& writer) const;
+
+    void load_state(StateReader& reader);
+
+    /**
+     * Saves the inputs, which is what is recorded when recording the input of a session.
+     *
+     * @param writer is the state to save to
+     */
+    void save_input_state(StateWriter& writer) const;
+
+    void load_input_state(StateReader& reader);
+
 private:
     static constexpr unsigned int s_sound_enabled_bit = 0;
 
@@ -1,7 +1,10 @@
 #include "pacman.h"
 #include "audio.h"
-#include "crosscutting/util/file_util.h"
+#include "crosscutting/memory/mapped_file.h"
+#include "crosscutting/misc/startup_cache.h"
+#include "crosscutting/util/hash_util.h"
 #include "gui.h"
+#include "gui_headless.h"
 #include "gui_imgui.h"
 #include "gui_sdl.h"
 #include "input_imgui.h"
@@ -20,11 +23,17 @@ class Session;
 
 namespace emu::applications::pacman {
 
-using emu::util::file::read_file_into_vector;
+using emu::memory::MappedFile;
+using emu::util::hash::fnv1a;
 
 Pacman::Pacman(Settings const& settings, const GuiType gui_type)
+    : m_settings(settings)
 {
-    if (gui_type == GuiType::DEBUGGING) {
+    if (!m_settings.m_replay_file.empty()) {
+        m_gui = std::make_shared<GuiHeadless>();
+        m_input = std::make_shared<InputSdl>();
+        m_is_starting_paused = false;
+    } else if (gui_type == GuiType::DEBUGGING) {
         m_gui = std::make_shared<GuiImgui>();
         m_input = std::make_shared<InputImgui>();
         m_is_starting_paused = true;
@@ -38,17 +47,23 @@ Pacman::Pacman(Settings const& settings, const GuiType gui_type)
 
     m_memory_mapped_io = std::make_shared<MemoryMappedIoForPacman>(m_memory, settings);
     m_memory.attach_memory_mapper(m_memory_mapped_io);
+
+    if (m_settings.m_is_using_startup_cache) {
+        m_startup_cache = std::make_shared<StartupCache>("cache", "pacman", startup_cache_key());
+    }
 }
 
 std::unique_ptr<Session> Pacman::new_session()
 {
     return std::make_unique<PacmanSession>(
+        m_settings,
         m_is_starting_paused,
         m_gui,
         m_input,
         m_audio,
         m_memory_mapped_io,
-        m_memory);
+        m_memory,
+        m_startup_cache);
 }
 
 std::vector<u8> create_empty_vector(std::size_t size)
@@ -60,22 +75,22 @@ std::vector<u8> create_empty_vector(std::size_t size)
 void Pacman::load_files()
 {
     const std::string directory = "roms/z80/pacman/";
-    m_memory.add(read_file_into_vector(directory + "pacman.6e")); // $0000-$0fff: pacman.6e, code
-    m_memory.add(read_file_into_vector(directory + "pacman.6f")); // $1000-$1fff: pacman.6f, code
-    m_memory.add(read_file_into_vector(directory + "pacman.6h")); // $2000-$2fff: pacman.6h, code
-    m_memory.add(read_file_into_vector(directory + "pacman.6j")); // $3000-$3fff: pacman.6j, code
-    m_memory.add(create_empty_vector(0x43ff - 0x4000 + 1));       // $4000-$43ff: tile RAM
-    m_memory.add(create_empty_vector(0x47ff - 0x4400 + 1));       // $4400-$47ff: palette RAM
-    m_memory.add(create_empty_vector(0x4fef - 0x4800 + 1));       // $4800-$4fef: RAM
-    m_memory.add(create_empty_vector(0x4fff - 0x4ff0 + 1));       // $4ff0-$4fff: sprite RAM
-    m_memory.add(create_empty_vector(0x50ff - 0x5000 + 1));       // $5000-$50ff: memory-mapped IO
-
-    m_color_rom.add(read_file_into_vector(directory + "82s123.7f"));   // $0000-$0020: 82s123.7f, colors
-    m_palette_rom.add(read_file_into_vector(directory + "82s126.4a")); // $0000-$00ff: 82s126.4a, palettes
-    m_tile_rom.add(read_file_into_vector(directory + "pacman.5e"));    // $0000-$0fff: pacman.5e, tiles
-    m_sprite_rom.add(read_file_into_vector(directory + "pacman.5f"));  // $0000-$0fff: pacman.5f, sprites
-    m_sound_rom1.add(read_file_into_vector(directory + "82s126.1m"));  // $0000-$00ff: 82s126.1m, sound 1
-    m_sound_rom2.add(read_file_into_vector(directory + "82s126.3m"));  // $0000-$00ff: 82s126.3m, sound 2
+    m_memory.add(MappedFile(directory + "pacman.6e").bytes()); // $0000-$0fff: pacman.6e, code
+    m_memory.add(MappedFile(directory + "pacman.6f").bytes()); // $1000-$1fff: pacman.6f, code
+    m_memory.add(MappedFile(directory + "pacman.6h").bytes()); // $2000-$2fff: pacman.6h, code
+    m_memory.add(MappedFile(directory + "pacman.6j").bytes()); // $3000-$3fff: pacman.6j, code
+    m_memory.add(create_empty_vector(0x43ff - 0x4000 + 1));    // $4000-$43ff: tile RAM
+    m_memory.add(create_empty_vector(0x47ff - 0x4400 + 1));    // $4400-$47ff: palette RAM
+    m_memory.add(create_empty_vector(0x4fef - 0x4800 + 1));    // $4800-$4fef: RAM
+    m_memory.add(create_empty_vector(0x4fff - 0x4ff0 + 1));    // $4ff0-$4fff: sprite RAM
+    m_memory.add(create_empty_vector(0x50ff - 0x5000 + 1));    // $5000-$50ff: memory-mapped IO
+
+    m_color_rom.add_read_only(std::make_shared<MappedFile const>(directory + "82s123.7f"));   // $0000-$0020: 82s123.7f, colors
+    m_palette_rom.add_read_only(std::make_shared<MappedFile const>(directory + "82s126.4a")); // $0000-$00ff: 82s126.4a, palettes
+    m_tile_rom.add_read_only(std::make_shared<MappedFile const>(directory + "pacman.5e"));    // $0000-$0fff: pacman.5e, tiles
+    m_sprite_rom.add_read_only(std::make_shared<MappedFile const>(directory + "pacman.5f"));  // $0000-$0fff: pacman.5f, sprites
+    m_sound_rom1.add_read_only(std::make_shared<MappedFile const>(directory + "82s126.1m"));  // $0000-$00ff: 82s126.1m, sound 1
+    m_sound_rom2.add_read_only(std::make_shared<MappedFile const>(directory + "82s126.3m"));  // $0000-$00ff: 82s126.3m, sound 2
 
     m_gui->load_color_rom({ m_color_rom.begin(), m_color_rom.end() });
     m_gui->load_palette_rom({ m_palette_rom.begin(), m_palette_rom.end() });
@@ -86,4 +101,26 @@ void Pacman::load_files()
     std::vector<u8> sound_rom2 = { m_sound_rom2.begin(), m_sound_rom2.end() };
     m_audio = std::make_shared<Audio>(sound_rom1, sound_rom2);
 }
+
+/**
+ * The state after the RAM and ROM test depends on the code ROMs and on the dipswitches, which the
+ * game reads while starting up. The graphics and sound ROMs aren't seen by the CPU, so they are
+ * left out.
+ */
+u64 Pacman::startup_cache_key()
+{
+    const std::vector<u8> dipswitches = {
+        static_cast<u8>(m_settings.m_number_of_lives),
+        static_cast<u8>(m_settings.m_bonus_life_at),
+        static_cast<u8>(m_settings.m_coins_per_game),
+        static_cast<u8>(m_settings.m_difficulty),
+        static_cast<u8>(m_settings.m_ghost_names),
+        static_cast<u8>(m_settings.m_board_test),
+        static_cast<u8>(m_settings.m_cabinet_mode)
+    };
+
+    const u64 code_hash = fnv1a(m_memory.begin(), s_address_code_end + 1);
+
+    return fnv1a(dipswitches.data(), dipswitches.size(), code_hash);
+}
 }
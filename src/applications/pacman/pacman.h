@@ -5,6 +5,8 @@
 #include "crosscutting/misc/emulator.h"
 #include "crosscutting/typedefs.h"
 #include "pacman_session.h"
+#include "settings.h"
+#include <cstddef>
 #include <memory>
 
 namespace emu::applications::pacman {
@@ -12,16 +14,17 @@ class Audio;
 class Gui;
 class Input;
 class MemoryMappedIoForPacman;
-class Settings;
 }
 namespace emu::misc {
 class Session;
+class StartupCache;
 }
 
 namespace emu::applications::pacman {
 
 using emu::gui::GuiType;
 using emu::misc::Emulator;
+using emu::misc::StartupCache;
 
 class Pacman : public Emulator {
 public:
@@ -32,6 +35,9 @@ public:
     std::unique_ptr<Session> new_session() override;
 
 private:
+    static constexpr std::size_t s_address_code_end = 0x3fff;
+
+    Settings m_settings;
     EmulatorMemory<u16, u8> m_memory;
     EmulatorMemory<u16, u8> m_color_rom;
     EmulatorMemory<u16, u8> m_palette_rom;
@@ -40,6 +46,7 @@ private:
     EmulatorMemory<u16, u8> m_sound_rom1;
     EmulatorMemory<u16, u8> m_sound_rom2;
     std::shared_ptr<MemoryMappedIoForPacman> m_memory_mapped_io;
+    std::shared_ptr<StartupCache> m_startup_cache;
 
     std::shared_ptr<Gui> m_gui;
     std::shared_ptr<Input> m_input;
@@ -47,5 +54,7 @@ private:
     bool m_is_starting_paused;
 
     void load_files();
+
+    u64 startup_cache_key();
 };
 }
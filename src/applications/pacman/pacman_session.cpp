@@ -3,26 +3,29 @@
 #include "chips/z80/cpu.h"
 #include "chips/z80/disassembler.h"
 #include "chips/z80/interrupt_mode.h"
+#include "crosscutting/debugging/advanced_disassembler.h"
 #include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/debugging/debugger.h"
-#include "crosscutting/debugging/disassembled_line.h"
+#include "crosscutting/debugging/decoded_instruction.h"
 #include "crosscutting/logging/logger.h"
 #include "crosscutting/memory/emulator_memory.h"
-#include "crosscutting/util/string_util.h"
+#include "crosscutting/misc/input_movie.h"
+#include "crosscutting/misc/startup_cache.h"
+#include "crosscutting/util/byte_util.h"
 #include "gui.h"
 #include "gui_request.h"
 #include "interfaces/input.h"
 #include "interfaces/state.h"
 #include "key_request.h"
 #include "memory_mapped_io_for_pacman.h"
+#include "settings.h"
 #include "states/paused_state.h"
 #include "states/running_state.h"
 #include "states/state_context.h"
 #include "states/stepping_state.h"
 #include "states/stopped_state.h"
-#include <algorithm>
+#include <cstddef>
 #include <iostream>
-#include <iterator>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -31,21 +34,27 @@
 
 namespace emu::applications::pacman {
 
+using emu::debugger::AdvancedDisassembler;
+using emu::debugger::DisassemblyDebugContainer;
 using emu::debugger::FlagRegisterDebugContainer;
 using emu::debugger::IoDebugContainer;
 using emu::debugger::MemoryDebugContainer;
 using emu::debugger::RegisterDebugContainer;
-using emu::util::string::split;
+using emu::debugger::format_data_byte;
+using emu::debugger::format_instruction;
+using emu::util::byte::low_byte;
 using emu::z80::Disassembler;
 using emu::z80::InterruptMode;
 
 PacmanSession::PacmanSession(
+    Settings const& settings,
     bool is_starting_paused,
     std::shared_ptr<Gui> gui,
     std::shared_ptr<Input> input,
     std::shared_ptr<Audio> audio,
     std::shared_ptr<MemoryMappedIoForPacman> memory_mapped_io,
-    EmulatorMemory<u16, u8>& memory)
+    EmulatorMemory<u16, u8>& memory,
+    std::shared_ptr<StartupCache> startup_cache)
     : m_memory_mapped_io(std::move(memory_mapped_io))
     , m_gui(std::move(gui))
     , m_input(std::move(input))
@@ -53,7 +62,15 @@ PacmanSession::PacmanSession(
     , m_memory(memory)
     , m_logger(std::make_shared<Logger>())
     , m_debugger(std::make_shared<Debugger<u16, 16>>())
+    , m_record_file(settings.m_record_file)
+    , m_governor(Governor(settings.m_replay_file.empty() ? s_tick_limit : 0, sdl_get_ticks_high_performance))
 {
+    if (!settings.m_replay_file.empty()) {
+        m_input_movie = std::make_shared<InputMovie>(settings.m_replay_file);
+    } else if (!settings.m_record_file.empty()) {
+        m_input_movie = std::make_shared<InputMovie>();
+    }
+
     setup_cpu();
     setup_debugging();
 
@@ -74,12 +91,19 @@ PacmanSession::PacmanSession(
         m_debug_container,
         m_outputs_during_cycle,
         m_governor,
+        m_rewind_buffer,
+        m_input_movie,
         m_is_in_debug_mode);
-    m_state_context->set_running_state(std::make_shared<RunningState>(m_state_context));
+    auto running_state = std::make_shared<RunningState>(m_state_context, settings.m_run_ahead_frames);
+    m_state_context->set_running_state(running_state);
     m_state_context->set_paused_state(std::make_shared<PausedState>(m_state_context));
     m_state_context->set_stepping_state(std::make_shared<SteppingState>(m_state_context));
     m_state_context->set_stopped_state(std::make_shared<StoppedState>(m_state_context));
 
+    if (startup_cache) {
+        start_from_startup_cache(*startup_cache, *running_state);
+    }
+
     if (is_starting_paused) {
         m_state_context->change_state(m_state_context->paused_state());
     } else {
@@ -103,6 +127,10 @@ void PacmanSession::run()
     while (!m_state_context->current_state()->is_exit_state()) {
         m_state_context->current_state()->perform(cycles);
     }
+
+    if (!m_record_file.empty()) {
+        m_input_movie->save(m_record_file);
+    }
 }
 
 void PacmanSession::pause()
@@ -228,8 +256,26 @@ void PacmanSession::setup_debugging()
             { "start 2 (AL)", 6 },
             { "cocktail (AL)", 7 } }));
     m_debug_container->add_memory(MemoryDebugContainer<u8>(
-        [&]() { return memory(); }));
-    m_debug_container->add_disassembled_program(disassemble_program());
+        [&]() { return memory(); },
+        [&](std::size_t address, u8 value) { m_memory.write(static_cast<u16>(address), value); }));
+    m_advanced_disassembler = std::make_shared<AdvancedDisassembler>(
+        0,
+        0x3fff,
+        [&](u16 address) { return Disassembler::decode(m_memory, address); },
+        std::vector<u16> { 0x0000, 0x0038, 0x0066 }); // The reset vector, the IM 1 interrupt and NMI. The IM 2 handlers are found when they run
+    m_debug_container->add_disassembly(DisassemblyDebugContainer<u16, u8>(
+        [&]() -> std::vector<u16> const& {
+            m_advanced_disassembler->add_entry_point(m_cpu->pc());
+            return m_advanced_disassembler->addresses();
+        },
+        [&](EmulatorMemory<u16, u8> const& memory, u16 address) { return Disassembler::decode(memory, address); },
+        [&](EmulatorMemory<u16, u8> const& memory, u16 address, std::string& line) {
+            if (m_advanced_disassembler->is_code(address)) {
+                format_instruction(Disassembler::decode(memory, address), line);
+            } else {
+                format_data_byte(address, memory.read(address), line);
+            }
+        }));
     m_debug_container->add_tilemap(m_gui->tiles());
     m_debug_container->add_spritemap(m_gui->sprites());
     m_debug_container->add_waveforms(m_audio->waveforms());
@@ -239,6 +285,36 @@ void PacmanSession::setup_debugging()
     m_gui->attach_logger(m_logger);
 }
 
+/**
+ * Skips the RAM and ROM test by restoring the state the game had right after it the last time. If
+ * nothing is cached yet, the test is run right away, as fast as possible, and the state at the end
+ * of it is cached for the next launch.
+ */
+void PacmanSession::start_from_startup_cache(StartupCache const& startup_cache, RunningState& running_state)
+{
+    std::vector<u8> initial_state;
+    running_state.save_state(initial_state);
+
+    std::vector<u8> state;
+    if (startup_cache.load(state) && state.size() == initial_state.size()) {
+        running_state.load_state(state);
+        m_logger->info("Restored the startup state from %s", startup_cache.path().c_str());
+        return;
+    }
+
+    if (!running_state.run_until_ready(s_max_startup_frames)) {
+        m_logger->info("The game was not ready after %u frames, so the startup state is not cached", s_max_startup_frames);
+        return;
+    }
+
+    running_state.save_state(state);
+    if (startup_cache.store(state)) {
+        m_logger->info("Cached the startup state in %s", startup_cache.path().c_str());
+    } else {
+        m_logger->info("Could not cache the startup state in %s", startup_cache.path().c_str());
+    }
+}
+
 void PacmanSession::gui_request(GuiRequest request)
 {
     switch (request.m_type) {
@@ -259,13 +335,11 @@ void PacmanSession::gui_request(GuiRequest request)
 
 void PacmanSession::out_changed(u16 port)
 {
-    if (!m_outputs_during_cycle.contains(port)) {
-        m_outputs_during_cycle[port] = m_cpu->a();
-    } else {
-        m_outputs_during_cycle[port] |= m_cpu->a();
-    }
+    const u8 decoded_port = low_byte(port); // Only the low byte of the port is decoded
 
-    if (port == s_out_port_vblank_interrupt_return) {
+    m_outputs_during_cycle.capture(decoded_port, m_cpu->a());
+
+    if (decoded_port == s_out_port_vblank_interrupt_return) {
         m_vblank_interrupt_return = m_cpu->a();
     } else {
         throw std::runtime_error("Illegal output port for Pacman");
@@ -289,28 +363,8 @@ void PacmanSession::key_pressed(IoRequest request)
     }
 }
 
-std::vector<u8> PacmanSession::memory()
+std::span<u8 const> PacmanSession::memory()
 {
     return { m_memory.begin(), m_memory.end() };
 }
-
-std::vector<DisassembledLine<u16, 16>> PacmanSession::disassemble_program()
-{
-    EmulatorMemory<u16, u8> sliced_for_disassembly = m_memory.slice(0, 0x3fff);
-
-    std::stringstream ss;
-    Disassembler disassembler(sliced_for_disassembly, ss);
-    disassembler.disassemble();
-
-    std::vector<std::string> disassembled_program = split(ss, "\n");
-
-    disassembled_program.erase(
-        std::remove_if(disassembled_program.begin(), disassembled_program.end(), [](std::string const& s) { return s.empty(); }));
-
-    std::vector<DisassembledLine<u16, 16>> lines;
-    std::transform(disassembled_program.begin(), disassembled_program.end(), std::back_inserter(lines),
-        [](std::string const& line) { return DisassembledLine<u16, 16>(line); });
-
-    return lines;
-}
 }
@@ -2,6 +2,8 @@
 
 #include "chips/z80/interfaces/out_observer.h"
 #include "crosscutting/misc/governor.h"
+#include "crosscutting/misc/port_decoder.h"
+#include "crosscutting/misc/rewind_buffer.h"
 #include "crosscutting/misc/sdl_counter.h"
 #include "crosscutting/misc/session.h"
 #include "crosscutting/typedefs.h"
@@ -12,7 +14,8 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
-#include <unordered_map>
+#include <span>
+#include <string>
 #include <vector>
 
 namespace emu::applications::pacman {
@@ -20,16 +23,17 @@ class Audio;
 class Gui;
 class Input;
 class MemoryMappedIoForPacman;
+class RunningState;
+class Settings;
 class StateContext;
 struct GuiRequest;
 }
 namespace emu::debugger {
+class AdvancedDisassembler;
 template<class A, std::size_t B>
 class Debugger;
 template<class A, class D, std::size_t B>
 class DebugContainer;
-template<class A, std::size_t B>
-class DisassembledLine;
 }
 namespace emu::logging {
 class Logger;
@@ -38,6 +42,10 @@ namespace emu::memory {
 template<class A, class D>
 class EmulatorMemory;
 }
+namespace emu::misc {
+class InputMovie;
+class StartupCache;
+}
 namespace emu::z80 {
 class Cpu;
 class InObserver;
@@ -46,14 +54,18 @@ class InObserver;
 namespace emu::applications::pacman {
 
 using emu::applications::pacman::GuiObserver;
+using emu::debugger::AdvancedDisassembler;
 using emu::debugger::DebugContainer;
 using emu::debugger::Debugger;
-using emu::debugger::DisassembledLine;
 using emu::logging::Logger;
 using emu::memory::EmulatorMemory;
 using emu::misc::Governor;
+using emu::misc::InputMovie;
+using emu::misc::PortCapture;
+using emu::misc::RewindBuffer;
 using emu::misc::sdl_get_ticks_high_performance;
 using emu::misc::Session;
+using emu::misc::StartupCache;
 using emu::z80::Cpu;
 using emu::z80::InObserver;
 using emu::z80::OutObserver;
@@ -65,12 +77,14 @@ class PacmanSession
     , public KeyObserver {
 public:
     PacmanSession(
+        Settings const& settings,
         bool is_starting_paused,
         std::shared_ptr<Gui> gui,
         std::shared_ptr<Input> input,
         std::shared_ptr<Audio> audio,
         std::shared_ptr<MemoryMappedIoForPacman> memory_mapped_io,
-        EmulatorMemory<u16, u8>& memory);
+        EmulatorMemory<u16, u8>& memory,
+        std::shared_ptr<StartupCache> startup_cache);
 
     ~PacmanSession() override;
 
@@ -89,9 +103,12 @@ public:
 private:
     static constexpr long double s_fps = 60.0L;
     static constexpr long double s_tick_limit = 1000.0L / s_fps;
+    static constexpr std::size_t s_rewind_memory_cap = 4 * 1024 * 1024;
+    static constexpr std::size_t s_rewind_keyframe_interval = static_cast<std::size_t>(s_fps);
     static constexpr int s_cycles_per_ms = 3072;
     static constexpr long double s_cycles_per_tick = s_cycles_per_ms * s_tick_limit;
     static constexpr int s_out_port_vblank_interrupt_return = 0;
+    static constexpr unsigned int s_max_startup_frames = static_cast<unsigned int>(30 * s_fps);
 
     bool m_is_in_debug_mode { false };
 
@@ -109,9 +126,14 @@ private:
     std::shared_ptr<Logger> m_logger;
     std::shared_ptr<Debugger<u16, 16>> m_debugger;
     std::shared_ptr<DebugContainer<u16, u8, 16>> m_debug_container;
-    std::unordered_map<u8, u8> m_outputs_during_cycle;
+    std::shared_ptr<AdvancedDisassembler> m_advanced_disassembler;
+    PortCapture m_outputs_during_cycle;
+
+    std::shared_ptr<InputMovie> m_input_movie;
+    std::string m_record_file;
 
-    Governor m_governor { Governor(s_tick_limit, sdl_get_ticks_high_performance) };
+    Governor m_governor;
+    RewindBuffer m_rewind_buffer { RewindBuffer(s_rewind_memory_cap, s_rewind_keyframe_interval) };
 
     std::shared_ptr<StateContext> m_state_context;
 
@@ -119,8 +141,8 @@ private:
 
     void setup_debugging();
 
-    std::vector<u8> memory();
+    void start_from_startup_cache(StartupCache const& startup_cache, RunningState& running_state);
 
-    std::vector<DisassembledLine<u16, 16>> disassemble_program();
+    std::span<u8 const> memory();
 };
 }
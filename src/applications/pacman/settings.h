@@ -2,6 +2,7 @@
 
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 namespace emu::applications {
 class Options;
@@ -60,6 +61,11 @@ public:
     BoardTest m_board_test;
     CabinetMode m_cabinet_mode;
 
+    unsigned int m_run_ahead_frames;
+    bool m_is_using_startup_cache;
+    std::string m_record_file;
+    std::string m_replay_file;
+
     static Settings from_options(Options const& options);
 
 private:
@@ -69,9 +75,20 @@ private:
 
     static const inline std::string s_dipswitch_short = "d";
     static const inline std::string s_gui_short = "g";
+    static const inline std::string s_run_ahead_long = "run-ahead";
+    static const inline std::string s_startup_cache_long = "startup-cache";
+    static const inline std::string s_record_long = "record";
+    static const inline std::string s_replay_long = "replay";
+
+    static constexpr unsigned int s_max_run_ahead_frames = 4;
 
     static const inline std::unordered_set<std::string> s_recognized_options = {
-        s_help_short, s_help_long, s_debug_scanner_long, s_dipswitch_short, s_gui_short
+        s_help_short, s_help_long, s_debug_scanner_long, s_dipswitch_short, s_gui_short, s_run_ahead_long,
+        s_startup_cache_long, s_record_long, s_replay_long
     };
+
+    static unsigned int run_ahead_frames(std::vector<std::string> const& values);
+
+    static std::string movie_file(std::string const& option, std::vector<std::string> const& values);
 };
 }
@@ -1,4 +1,5 @@
 #include "paused_state.h"
+#include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/misc/governor.h"
 #include "pacman/gui.h"
@@ -51,6 +52,7 @@ void PausedState::perform([[maybe_unused]] cyc& cycles)
             transition_to_run();
             return;
         }
+        m_ctx->m_debug_container->take_snapshot();
         m_ctx->m_gui->update_screen(tile_ram(), sprite_ram(), palette_ram(), m_ctx->m_memory_mapped_io->is_screen_flipped(), s_game_window_subtitle);
     }
 }
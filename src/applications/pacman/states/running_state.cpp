@@ -5,21 +5,28 @@
 #include "applications/pacman/interfaces/input.h"
 #include "applications/pacman/memory_mapped_io_for_pacman.h"
 #include "chips/z80/cpu.h"
+#include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/debugging/debugger.h"
 #include "crosscutting/logging/logger.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/misc/governor.h"
+#include "crosscutting/misc/input_movie.h"
+#include "crosscutting/misc/port_decoder.h"
+#include "crosscutting/misc/rewind_buffer.h"
+#include "crosscutting/misc/state_stream.h"
 #include "crosscutting/typedefs.h"
 #include "state_context.h"
-#include <unordered_map>
 #include <utility>
 
 namespace emu::applications::pacman {
 
 using emu::misc::Governor;
+using emu::misc::StateReader;
+using emu::misc::StateWriter;
 
-RunningState::RunningState(std::shared_ptr<StateContext> state_context)
+RunningState::RunningState(std::shared_ptr<StateContext> state_context, unsigned int run_ahead_frames)
     : m_ctx(std::move(state_context))
+    , m_run_ahead_frames(run_ahead_frames)
 {
 }
 
@@ -52,6 +59,16 @@ void RunningState::perform(cyc& cycles)
     m_ctx->m_outputs_during_cycle.clear();
 
     if (m_ctx->m_governor.is_time_to_update()) {
+        if (!m_ctx->m_input_movie) {
+            if (m_ctx->m_gui_io.m_is_rewinding) {
+                rewind();
+                return;
+            }
+
+            save_state(m_state);
+            m_ctx->m_rewind_buffer.push(m_state);
+        }
+
         cycles = 0;
         while (cycles < static_cast<cyc>(s_cycles_per_tick)) {
             cycles += m_ctx->m_cpu->next_instruction();
@@ -65,7 +82,7 @@ void RunningState::perform(cyc& cycles)
         if (m_ctx->m_memory_mapped_io->is_interrupt_enabled()) {
             m_ctx->m_cpu->interrupt(m_ctx->m_vblank_interrupt_return);
 
-            m_ctx->m_input->read(m_ctx->m_gui_io, m_ctx->m_memory_mapped_io);
+            read_input();
             if (m_ctx->m_gui_io.m_is_quitting) {
                 m_ctx->m_gui_io.m_is_quitting = false;
                 transition_to_stop();
@@ -75,12 +92,156 @@ void RunningState::perform(cyc& cycles)
                 transition_to_pause();
                 return;
             }
-            m_ctx->m_gui->update_screen(tile_ram(), sprite_ram(), palette_ram(), m_ctx->m_memory_mapped_io->is_screen_flipped(), s_game_window_subtitle);
-            m_ctx->m_audio->handle_sound(m_ctx->m_memory_mapped_io->is_sound_enabled(), m_ctx->m_memory_mapped_io->voices());
+            if (m_run_ahead_frames > 0) {
+                run_ahead();
+            } else {
+                m_ctx->m_debug_container->take_snapshot();
+                m_ctx->m_gui->update_screen(tile_ram(), sprite_ram(), palette_ram(), m_ctx->m_memory_mapped_io->is_screen_flipped(), s_game_window_subtitle);
+            }
+            if (!is_replaying()) {
+                m_ctx->m_audio->handle_sound(m_ctx->m_memory_mapped_io->is_sound_enabled(), m_ctx->m_memory_mapped_io->voices());
+            }
         }
     }
 }
 
+/**
+ * Reads the input once per frame. When recording, the input is added to the input movie. When
+ * replaying, the input comes from the input movie instead of from the player, and the session
+ * stops when the movie is over.
+ */
+void RunningState::read_input()
+{
+    if (is_replaying()) {
+        if (m_ctx->m_input_movie->is_finished()) {
+            m_ctx->m_gui_io.m_is_quitting = true;
+            return;
+        }
+
+        m_input.clear();
+        StateWriter writer(m_input);
+        m_ctx->m_memory_mapped_io->save_input_state(writer);
+
+        if (m_ctx->m_input_movie->replay(m_input)) {
+            StateReader reader(m_input);
+            m_ctx->m_memory_mapped_io->load_input_state(reader);
+        }
+
+        return;
+    }
+
+    m_ctx->m_input->read(m_ctx->m_gui_io, m_ctx->m_memory_mapped_io);
+
+    if (m_ctx->m_input_movie) {
+        m_input.clear();
+        StateWriter writer(m_input);
+        m_ctx->m_memory_mapped_io->save_input_state(writer);
+        m_ctx->m_input_movie->record(m_input);
+    }
+}
+
+bool RunningState::is_replaying() const
+{
+    return m_ctx->m_input_movie && m_ctx->m_input_movie->is_replaying();
+}
+
+void RunningState::rewind()
+{
+    if (m_ctx->m_rewind_buffer.pop(m_state)) {
+        load_state(m_state);
+    }
+
+    m_ctx->m_input->read(m_ctx->m_gui_io, m_ctx->m_memory_mapped_io);
+    if (m_ctx->m_gui_io.m_is_quitting) {
+        m_ctx->m_gui_io.m_is_quitting = false;
+        transition_to_stop();
+        return;
+    } else if (m_ctx->m_gui_io.m_is_toggling_pause) {
+        m_ctx->m_gui_io.m_is_toggling_pause = false;
+        transition_to_pause();
+        return;
+    }
+
+    m_ctx->m_debug_container->take_snapshot();
+    m_ctx->m_gui->update_screen(tile_ram(), sprite_ram(), palette_ram(), m_ctx->m_memory_mapped_io->is_screen_flipped(), s_game_window_subtitle);
+}
+
+/**
+ * Emulates a few frames ahead, shows the last of them and goes back to where it was. The game gets
+ * to react to the input that is held down right now before it is shown, which hides the frames of
+ * lag between the game reading the input and drawing the result.
+ */
+void RunningState::run_ahead()
+{
+    save_state(m_run_ahead_state);
+
+    for (unsigned int frame = 0; frame < m_run_ahead_frames; ++frame) {
+        run_frame_headless();
+    }
+
+    m_ctx->m_debug_container->take_snapshot();
+    m_ctx->m_gui->update_screen(tile_ram(), sprite_ram(), palette_ram(), m_ctx->m_memory_mapped_io->is_screen_flipped(), s_game_window_subtitle);
+
+    load_state(m_run_ahead_state);
+}
+
+/**
+ * Emulates one frame without breakpoints, input, sound or rendering. Starts and ends right after
+ * the VBLANK interrupt, which is where run_ahead is called from.
+ */
+void RunningState::run_frame_headless()
+{
+    cyc cycles = 0;
+    while (cycles < static_cast<cyc>(s_cycles_per_tick)) {
+        cycles += m_ctx->m_cpu->next_instruction();
+    }
+
+    if (m_ctx->m_memory_mapped_io->is_interrupt_enabled()) {
+        m_ctx->m_cpu->interrupt(m_ctx->m_vblank_interrupt_return);
+    }
+}
+
+/**
+ * Emulates headless until the game has finished its RAM and ROM test and has turned on the VBLANK
+ * interrupt. That is the first point where there is anything to show, and is where the startup
+ * cache is made.
+ *
+ * @param max_frames is the number of frames to give up after
+ * @return true if the game got ready within max_frames, false otherwise
+ */
+bool RunningState::run_until_ready(unsigned int max_frames)
+{
+    for (unsigned int frame = 0; frame < max_frames; ++frame) {
+        if (m_ctx->m_memory_mapped_io->is_interrupt_enabled()) {
+            return true;
+        }
+
+        run_frame_headless();
+    }
+
+    return m_ctx->m_memory_mapped_io->is_interrupt_enabled();
+}
+
+void RunningState::save_state(std::vector<u8>& state)
+{
+    state.clear();
+
+    StateWriter writer(state);
+    m_ctx->m_cpu->save_state(writer);
+    m_ctx->m_memory.save_state(writer, s_address_ram_beginning, m_ctx->m_memory.size());
+    m_ctx->m_memory_mapped_io->save_state(writer);
+    writer.write(m_ctx->m_vblank_interrupt_return);
+}
+
+void RunningState::load_state(std::vector<u8> const& state)
+{
+    StateReader reader(state);
+    m_ctx->m_cpu->load_state(reader);
+    m_ctx->m_memory.load_state(reader, s_address_ram_beginning, m_ctx->m_memory.size());
+    m_ctx->m_memory_mapped_io->load_state(reader);
+    m_ctx->m_vblank_interrupt_return = reader.read<u8>();
+}
+
 std::vector<u8> RunningState::tile_ram()
 {
     return { m_ctx->m_memory.begin() + 0x4000, m_ctx->m_memory.begin() + 0x43ff + 1 };
@@ -2,6 +2,7 @@
 
 #include "applications/pacman//interfaces/state.h"
 #include "crosscutting/typedefs.h"
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
@@ -15,7 +16,7 @@ namespace emu::applications::pacman {
 class RunningState : public State {
 
 public:
-    explicit RunningState(std::shared_ptr<StateContext> state_context);
+    RunningState(std::shared_ptr<StateContext> state_context, unsigned int run_ahead_frames);
 
     bool is_exit_state() override;
 
@@ -29,6 +30,12 @@ public:
 
     void perform(cyc& cycles) override;
 
+    bool run_until_ready(unsigned int max_frames);
+
+    void save_state(std::vector<u8>& state);
+
+    void load_state(std::vector<u8> const& state);
+
 private:
     static inline std::string s_game_window_subtitle = "";
 
@@ -39,8 +46,28 @@ private:
     static constexpr long double s_cycles_per_tick = s_cycles_per_ms * s_tick_limit;
     // Game loop - end
 
+    // Rewind - begin
+    static constexpr std::size_t s_address_ram_beginning = 0x4000;
+    // Rewind - end
+
     std::shared_ptr<StateContext> m_ctx;
 
+    unsigned int m_run_ahead_frames;
+
+    std::vector<u8> m_state;
+    std::vector<u8> m_run_ahead_state;
+    std::vector<u8> m_input;
+
+    void read_input();
+
+    [[nodiscard]] bool is_replaying() const;
+
+    void rewind();
+
+    void run_ahead();
+
+    void run_frame_headless();
+
     std::vector<u8> tile_ram();
 
     std::vector<u8> sprite_ram();
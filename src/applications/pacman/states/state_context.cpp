@@ -22,8 +22,10 @@ StateContext::StateContext(
     std::shared_ptr<Logger> logger,
     std::shared_ptr<Debugger<u16, 16>> debugger,
     std::shared_ptr<DebugContainer<u16, u8, 16>> debug_container,
-    std::unordered_map<u8, u8>& outputs_during_cycle,
+    PortCapture& outputs_during_cycle,
     Governor& governor,
+    RewindBuffer& rewind_buffer,
+    std::shared_ptr<InputMovie> input_movie,
     bool& is_in_debug_mode)
     : m_is_in_debug_mode(is_in_debug_mode)
     , m_gui_io(gui_io)
@@ -39,6 +41,8 @@ StateContext::StateContext(
     , m_debug_container(std::move(debug_container))
     , m_outputs_during_cycle(outputs_during_cycle)
     , m_governor(governor)
+    , m_rewind_buffer(rewind_buffer)
+    , m_input_movie(std::move(input_movie))
 {
 }
 
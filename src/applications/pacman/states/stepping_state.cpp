@@ -5,10 +5,11 @@
 #include "applications/pacman/interfaces/input.h"
 #include "applications/pacman/memory_mapped_io_for_pacman.h"
 #include "chips/z80/cpu.h"
+#include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/memory/emulator_memory.h"
+#include "crosscutting/misc/port_decoder.h"
 #include "crosscutting/typedefs.h"
 #include "state_context.h"
-#include <unordered_map>
 #include <utility>
 
 namespace emu::misc {
@@ -79,6 +80,7 @@ void SteppingState::perform(cyc& cycles)
             transition_to_run();
             return;
         }
+        m_ctx->m_debug_container->take_snapshot();
         m_ctx->m_gui->update_screen(tile_ram(), sprite_ram(), palette_ram(), m_ctx->m_memory_mapped_io->is_screen_flipped(), s_game_window_subtitle);
         m_ctx->m_audio->handle_sound(m_ctx->m_memory_mapped_io->is_sound_enabled(), m_ctx->m_memory_mapped_io->voices());
     }
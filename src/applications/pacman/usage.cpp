@@ -9,11 +9,15 @@ namespace emu::applications::pacman {
 
 using emu::util::string::create_padding;
 
-static constexpr std::size_t padding_to_description = 14;
+static constexpr std::size_t padding_to_description = 18;
 
 const std::vector<std::pair<std::string, std::string>> supported_flags = {
     { "-g", "ordinary, debugging. ordinary is default." },
-    { "-d", "Dipswitches. See description below." }
+    { "-d", "Dipswitches. See description below." },
+    { "--run-ahead", "Frames to run ahead of the screen to hide input lag: 0 to 4. 0 is default." },
+    { "--startup-cache", "Skip the RAM and ROM test by restoring the state cached by an earlier launch." },
+    { "--record", "Record the input to a file, to replay it later." },
+    { "--replay", "Replay recorded input headless, as fast as possible, and print a hash of every frame." }
 };
 const std::vector<std::pair<std::string, std::string>> supported_dipswitches = {
     { "n", "Number of lives: 1, 2, 3 or 5. 3 is default." },
@@ -26,7 +30,11 @@ const std::vector<std::pair<std::string, std::string>> supported_dipswitches = {
 };
 const std::vector<std::pair<std::string, std::string>> examples = {
     { "-g debugging -d b=20000 -d g=alternate", "Running with the debugging GUI, bonus life at 20000 and alternate ghost names" },
-    { "-d m=table -d d=hard -c=free", "Running with table cabinet mode, difficulty hard and playing for free" }
+    { "-d m=table -d d=hard -c=free", "Running with table cabinet mode, difficulty hard and playing for free" },
+    { "--run-ahead=2", "Running two frames ahead, which removes two frames of input lag" },
+    { "--startup-cache", "Running the RAM and ROM test once, and starting right after it on later launches" },
+    { "--record=game.inp", "Recording the input to game.inp" },
+    { "--replay=game.inp", "Replaying the input recorded in game.inp" }
 };
 
 void print_usage(std::string const& program_name)
@@ -0,0 +1,82 @@
+#include "i8080_single_step_core.h"
+#include "chips/8080/flags.h"
+#include "chips/8080/manual_state.h"
+#include "single_step_test.h"
+#include <vector>
+
+namespace emu::applications::single_step {
+
+using emu::i8080::Flags;
+
+I8080SingleStepCore::I8080SingleStepCore()
+    : m_memory(create_memory())
+    , m_cpu(m_memory, 0)
+{
+}
+
+EmulatorMemory<u16, u8> I8080SingleStepCore::create_memory()
+{
+    EmulatorMemory<u16, u8> memory;
+    memory.add(std::vector<u8>(s_memory_size, 0));
+
+    return memory;
+}
+
+void I8080SingleStepCore::load(CpuState const& state)
+{
+    Flags flags;
+    flags.from_u8(static_cast<u8>(state.get(Register::F)));
+
+    m_cpu.set_state_manually({
+        .m_inte = state.get(Register::Inte) != 0,
+        .m_sp = state.get(Register::Sp),
+        .m_pc = state.get(Register::Pc),
+        .m_acc_reg = static_cast<u8>(state.get(Register::A)),
+        .m_b_reg = static_cast<u8>(state.get(Register::B)),
+        .m_c_reg = static_cast<u8>(state.get(Register::C)),
+        .m_d_reg = static_cast<u8>(state.get(Register::D)),
+        .m_e_reg = static_cast<u8>(state.get(Register::E)),
+        .m_h_reg = static_cast<u8>(state.get(Register::H)),
+        .m_l_reg = static_cast<u8>(state.get(Register::L)),
+        .m_flag_reg = flags,
+    });
+}
+
+void I8080SingleStepCore::save(CpuState& state) const
+{
+    state.set(Register::Pc, m_cpu.pc());
+    state.set(Register::Sp, m_cpu.sp());
+    state.set(Register::A, m_cpu.a());
+    state.set(Register::B, m_cpu.b());
+    state.set(Register::C, m_cpu.c());
+    state.set(Register::D, m_cpu.d());
+    state.set(Register::E, m_cpu.e());
+    state.set(Register::F, m_cpu.f());
+    state.set(Register::H, m_cpu.h());
+    state.set(Register::L, m_cpu.l());
+    state.set(Register::Inte, m_cpu.is_inta() ? 1 : 0);
+}
+
+cyc I8080SingleStepCore::step()
+{
+    return m_cpu.next_instruction();
+}
+
+/**
+ * The 8080 only has 256 ports, so the port is the low byte of the address bus.
+ */
+void I8080SingleStepCore::input(u16 port, u8 value)
+{
+    m_cpu.input(static_cast<u8>(port), value);
+}
+
+EmulatorMemory<u16, u8>& I8080SingleStepCore::memory()
+{
+    return m_memory;
+}
+
+cyc I8080SingleStepCore::cycles_per_entry() const
+{
+    return 1;
+}
+}
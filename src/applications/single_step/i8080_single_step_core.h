@@ -0,0 +1,32 @@
+#pragma once
+
+#include "chips/8080/cpu.h"
+#include "crosscutting/memory/emulator_memory.h"
+#include "crosscutting/typedefs.h"
+#include "single_step_core.h"
+
+namespace emu::applications::single_step {
+
+class I8080SingleStepCore : public SingleStepCore {
+public:
+    I8080SingleStepCore();
+
+    void load(CpuState const& state) override;
+
+    void save(CpuState& state) const override;
+
+    cyc step() override;
+
+    void input(u16 port, u8 value) override;
+
+    EmulatorMemory<u16, u8>& memory() override;
+
+    [[nodiscard]] cyc cycles_per_entry() const override;
+
+private:
+    EmulatorMemory<u16, u8> m_memory;
+    i8080::Cpu m_cpu;
+
+    static EmulatorMemory<u16, u8> create_memory();
+};
+}
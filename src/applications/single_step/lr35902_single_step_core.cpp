@@ -0,0 +1,85 @@
+#include "lr35902_single_step_core.h"
+#include "chips/lr35902/flags.h"
+#include "chips/lr35902/manual_state.h"
+#include "single_step_test.h"
+#include <vector>
+
+namespace emu::applications::single_step {
+
+using emu::lr35902::Flags;
+
+Lr35902SingleStepCore::Lr35902SingleStepCore()
+    : m_memory(create_memory())
+    , m_cpu(m_memory, 0)
+{
+}
+
+EmulatorMemory<u16, u8> Lr35902SingleStepCore::create_memory()
+{
+    EmulatorMemory<u16, u8> memory;
+    memory.add(std::vector<u8>(s_memory_size, 0));
+
+    return memory;
+}
+
+void Lr35902SingleStepCore::load(CpuState const& state)
+{
+    Flags flags;
+    flags.from_u8(static_cast<u8>(state.get(Register::F)));
+
+    m_cpu.set_state_manually({
+        .m_ime = state.get(Register::Ime) != 0,
+        .m_ie = false,
+        .m_sp = state.get(Register::Sp),
+        .m_pc = state.get(Register::Pc),
+        .m_acc_reg = static_cast<u8>(state.get(Register::A)),
+        .m_b_reg = static_cast<u8>(state.get(Register::B)),
+        .m_c_reg = static_cast<u8>(state.get(Register::C)),
+        .m_d_reg = static_cast<u8>(state.get(Register::D)),
+        .m_e_reg = static_cast<u8>(state.get(Register::E)),
+        .m_h_reg = static_cast<u8>(state.get(Register::H)),
+        .m_l_reg = static_cast<u8>(state.get(Register::L)),
+        .m_flag_reg = flags,
+    });
+}
+
+void Lr35902SingleStepCore::save(CpuState& state) const
+{
+    state.set(Register::Pc, m_cpu.pc());
+    state.set(Register::Sp, m_cpu.sp());
+    state.set(Register::A, m_cpu.a());
+    state.set(Register::B, m_cpu.b());
+    state.set(Register::C, m_cpu.c());
+    state.set(Register::D, m_cpu.d());
+    state.set(Register::E, m_cpu.e());
+    state.set(Register::F, m_cpu.f());
+    state.set(Register::H, m_cpu.h());
+    state.set(Register::L, m_cpu.l());
+    state.set(Register::Ime, m_cpu.ime() ? 1 : 0);
+}
+
+cyc Lr35902SingleStepCore::step()
+{
+    return m_cpu.next_instruction();
+}
+
+/**
+ * The LR35902 has no ports. Its IO is mapped into memory, where the tests put it.
+ */
+void Lr35902SingleStepCore::input([[maybe_unused]] u16 port, [[maybe_unused]] u8 value)
+{
+}
+
+EmulatorMemory<u16, u8>& Lr35902SingleStepCore::memory()
+{
+    return m_memory;
+}
+
+/**
+ * The tests have one entry per machine cycle, and a machine cycle is four clock cycles.
+ */
+cyc Lr35902SingleStepCore::cycles_per_entry() const
+{
+    return 4;
+}
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "crosscutting/memory/emulator_memory.h"
+#include "crosscutting/typedefs.h"
+#include <cstddef>
+
+namespace emu::applications::single_step {
+struct CpuState;
+}
+
+namespace emu::applications::single_step {
+
+using emu::memory::EmulatorMemory;
+
+/**
+ * A CPU core with a full 64 KiB memory of its own, which the state of a test can be put into.
+ */
+class SingleStepCore {
+public:
+    static constexpr std::size_t s_memory_size = 0x10000;
+
+    virtual ~SingleStepCore() = default;
+
+    /**
+     * Sets the registers. Registers that the state doesn't have are set to zero.
+     */
+    virtual void load(CpuState const& state) = 0;
+
+    /**
+     * Sets the registers the core has in the state.
+     */
+    virtual void save(CpuState& state) const = 0;
+
+    virtual cyc step() = 0;
+
+    virtual void input(u16 port, u8 value) = 0;
+
+    virtual EmulatorMemory<u16, u8>& memory() = 0;
+
+    /**
+     * @return how many of the cycles the core counts that one entry in the list of bus cycles is
+     */
+    [[nodiscard]] virtual cyc cycles_per_entry() const = 0;
+};
+}
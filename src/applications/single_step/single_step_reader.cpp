@@ -0,0 +1,144 @@
+#include "single_step_reader.h"
+#include "single_step_test.h"
+#include <algorithm>
+#include <cstdint>
+#include <fmt/core.h>
+#include <stdexcept>
+#include <string>
+
+namespace emu::applications::single_step {
+
+SingleStepReader::SingleStepReader(std::istream& stream)
+    : m_reader(stream)
+{
+}
+
+bool SingleStepReader::next(SingleStepTest& test)
+{
+    if (!m_has_begun) {
+        expect(m_reader.next(), JsonToken::BeginArray);
+        m_has_begun = true;
+    }
+
+    const JsonToken token = m_reader.next();
+    if (token == JsonToken::EndArray) {
+        return false;
+    }
+    expect(token, JsonToken::BeginObject);
+
+    test.m_name.clear();
+    test.m_initial.clear();
+    test.m_final.clear();
+    test.m_cycles = 0;
+    test.m_port_inputs.clear();
+
+    for (JsonToken key = m_reader.next(); key != JsonToken::EndObject; key = m_reader.next()) {
+        std::string const& name = m_reader.text();
+
+        if (name == "name") {
+            expect(m_reader.next(), JsonToken::String);
+            test.m_name = m_reader.text();
+        } else if (name == "initial") {
+            read_state(test.m_initial);
+        } else if (name == "final") {
+            read_state(test.m_final);
+        } else if (name == "cycles") {
+            test.m_cycles = count_elements();
+        } else if (name == "ports") {
+            read_pairs(test.m_port_inputs);
+        } else {
+            m_reader.skip(m_reader.next());
+        }
+    }
+
+    return true;
+}
+
+void SingleStepReader::read_state(CpuState& state)
+{
+    expect(m_reader.next(), JsonToken::BeginObject);
+
+    for (JsonToken key = m_reader.next(); key != JsonToken::EndObject; key = m_reader.next()) {
+        std::string const& name = m_reader.text();
+
+        if (name == "ram") {
+            read_pairs(state.m_ram);
+            continue;
+        }
+
+        auto const found = std::find(register_names.begin(), register_names.end(), name);
+        if (found == register_names.end()) {
+            m_reader.skip(m_reader.next());
+        } else {
+            const auto reg = static_cast<Register>(found - register_names.begin());
+            expect(m_reader.next(), JsonToken::Number);
+            state.set(reg, read_number());
+        }
+    }
+}
+
+/**
+ * Reads a list of [address, value] pairs. The lists of ports also say if the port is read or
+ * written, as a third element, and only the ports that are read are kept.
+ */
+void SingleStepReader::read_pairs(std::vector<std::pair<u16, u8>>& pairs)
+{
+    expect(m_reader.next(), JsonToken::BeginArray);
+
+    for (JsonToken token = m_reader.next(); token != JsonToken::EndArray; token = m_reader.next()) {
+        expect(token, JsonToken::BeginArray);
+
+        expect(m_reader.next(), JsonToken::Number);
+        const u16 address = read_number();
+        expect(m_reader.next(), JsonToken::Number);
+        const u16 value = read_number();
+        if (value > UINT8_MAX) {
+            throw std::runtime_error(fmt::format("{} doesn't fit in a byte", value));
+        }
+
+        bool is_read = true;
+        for (JsonToken rest = m_reader.next(); rest != JsonToken::EndArray; rest = m_reader.next()) {
+            if (rest == JsonToken::String && m_reader.text() == "w") {
+                is_read = false;
+            }
+            m_reader.skip(rest);
+        }
+
+        if (is_read) {
+            pairs.emplace_back(address, static_cast<u8>(value));
+        }
+    }
+}
+
+std::size_t SingleStepReader::count_elements()
+{
+    expect(m_reader.next(), JsonToken::BeginArray);
+
+    std::size_t count = 0;
+    for (JsonToken token = m_reader.next(); token != JsonToken::EndArray; token = m_reader.next()) {
+        m_reader.skip(token);
+        ++count;
+    }
+
+    return count;
+}
+
+u16 SingleStepReader::read_number()
+{
+    const i64 value = m_reader.integer();
+    if (value < 0 || value > UINT16_MAX) {
+        throw std::runtime_error(fmt::format("{} doesn't fit in a register or an address", value));
+    }
+
+    return static_cast<u16>(value);
+}
+
+void SingleStepReader::expect(JsonToken actual, JsonToken expected) const
+{
+    if (actual != expected) {
+        throw std::runtime_error(fmt::format(
+            "The test file isn't on the single step format. Expected token {}, but got {}",
+            static_cast<int>(expected), static_cast<int>(actual)));
+    }
+}
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "crosscutting/misc/json_reader.h"
+#include "crosscutting/typedefs.h"
+#include <cstddef>
+#include <istream>
+#include <utility>
+#include <vector>
+
+namespace emu::applications::single_step {
+struct CpuState;
+struct SingleStepTest;
+}
+
+namespace emu::applications::single_step {
+
+using emu::misc::JsonReader;
+using emu::misc::JsonToken;
+
+/**
+ * Reads the tests of a single step test file one at a time. A file is an array of tests, each on
+ * the form:
+ *
+ *   { "name": "...", "initial": { "pc": 1, ..., "ram": [[address, value], ...] },
+ *     "final": { ... }, "cycles": [...], "ports": [[port, value, "r"], ...] }
+ */
+class SingleStepReader {
+public:
+    explicit SingleStepReader(std::istream& stream);
+
+    /**
+     * @param test is where the test is read into, so that its memory can be used again
+     * @return false if there are no more tests
+     */
+    bool next(SingleStepTest& test);
+
+private:
+    JsonReader m_reader;
+    bool m_has_begun { false };
+
+    void read_state(CpuState& state);
+
+    void read_pairs(std::vector<std::pair<u16, u8>>& pairs);
+
+    std::size_t count_elements();
+
+    u16 read_number();
+
+    void expect(JsonToken actual, JsonToken expected) const;
+};
+}
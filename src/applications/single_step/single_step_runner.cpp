@@ -0,0 +1,194 @@
+#include "single_step_runner.h"
+#include "crosscutting/exceptions/rom_file_not_found_exception.h"
+#include "crosscutting/util/parallel_util.h"
+#include "single_step_core.h"
+#include "single_step_reader.h"
+#include "single_step_test.h"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <fmt/core.h>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <utility>
+
+namespace emu::applications::single_step {
+
+using emu::exceptions::RomFileNotFoundException;
+using emu::util::parallel::parallel_for_each;
+
+SingleStepRunner::SingleStepRunner(
+    std::function<std::unique_ptr<SingleStepCore>()> create_core,
+    std::string const& path,
+    bool is_checking_cycles)
+    : m_create_core(std::move(create_core))
+    , m_is_checking_cycles(is_checking_cycles)
+{
+    if (!std::filesystem::exists(path)) {
+        throw RomFileNotFoundException(path);
+    }
+
+    if (!std::filesystem::is_directory(path)) {
+        m_files.push_back(path);
+        return;
+    }
+
+    for (auto const& entry : std::filesystem::directory_iterator(path)) {
+        if (entry.is_regular_file() && entry.path().extension() == s_test_extension) {
+            m_files.push_back(entry.path().string());
+        }
+    }
+    std::sort(m_files.begin(), m_files.end());
+}
+
+bool SingleStepRunner::run()
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<OpcodeResult> results(m_files.size());
+
+    // Each file is written to its own result, so the results need no lock
+    parallel_for_each(m_files.size(), [&]() {
+        std::shared_ptr<SingleStepCore> core = m_create_core();
+        return [&, core](std::size_t file) {
+            results[file] = run_file(*core, m_files[file]);
+            return true;
+        };
+    });
+
+    print_report(results, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+    return std::all_of(results.begin(), results.end(), [](OpcodeResult const& result) {
+        return result.m_failures == 0 && !result.m_error.has_value();
+    });
+}
+
+OpcodeResult SingleStepRunner::run_file(SingleStepCore& core, std::string const& file) const
+{
+    OpcodeResult result;
+    result.m_opcode = std::filesystem::path(file).stem().string();
+
+    try {
+        std::ifstream stream(file, std::ios::binary);
+        if (!stream) {
+            throw RomFileNotFoundException(file);
+        }
+
+        SingleStepReader reader(stream);
+        SingleStepTest test;
+        CpuState actual;
+
+        while (reader.next(test)) {
+            ++result.m_tests;
+
+            if (std::optional<std::string> failure = run_test(core, test, actual)) {
+                ++result.m_failures;
+                if (result.m_failure_descriptions.size() < s_max_reported_failures) {
+                    result.m_failure_descriptions.push_back(std::move(failure.value()));
+                }
+            }
+        }
+    } catch (std::exception const& ex) {
+        result.m_error = ex.what();
+    }
+
+    return result;
+}
+
+/**
+ * Only the memory the test gives is compared, and it's cleared again afterwards, so that the next
+ * test starts with memory that is all zeros.
+ *
+ * @return a description of what was wrong, if the test failed
+ */
+std::optional<std::string> SingleStepRunner::run_test(SingleStepCore& core, SingleStepTest const& test, CpuState& actual) const
+{
+    EmulatorMemory<u16, u8>& memory = core.memory();
+
+    for (auto const& [address, value] : test.m_initial.m_ram) {
+        memory.write(address, value);
+    }
+    for (auto const& [port, value] : test.m_port_inputs) {
+        core.input(port, value);
+    }
+    core.load(test.m_initial);
+
+    std::vector<std::string> problems;
+    try {
+        const cyc cycles = core.step();
+
+        actual.clear();
+        core.save(actual);
+        for (std::size_t i = 0; i < register_names.size(); ++i) {
+            const auto reg = static_cast<Register>(i);
+            if (test.m_final.has(reg) && actual.has(reg) && test.m_final.get(reg) != actual.get(reg)) {
+                problems.push_back(fmt::format("{} is ${:x} instead of ${:x}", register_names[i], actual.get(reg), test.m_final.get(reg)));
+            }
+        }
+
+        for (auto const& [address, value] : test.m_final.m_ram) {
+            const u8 actual_value = memory.read(address);
+            if (actual_value != value) {
+                problems.push_back(fmt::format("${:04x} is ${:02x} instead of ${:02x}", address, actual_value, value));
+            }
+        }
+
+        const cyc expected_cycles = test.m_cycles * core.cycles_per_entry();
+        if (m_is_checking_cycles && test.m_cycles != 0 && cycles != expected_cycles) {
+            problems.push_back(fmt::format("took {} cycles instead of {}", cycles, expected_cycles));
+        }
+    } catch (std::exception const& ex) {
+        problems.emplace_back(ex.what());
+    }
+
+    for (auto const& [address, value] : test.m_initial.m_ram) {
+        memory.write(address, 0);
+    }
+    for (auto const& [address, value] : test.m_final.m_ram) {
+        memory.write(address, 0);
+    }
+
+    if (problems.empty()) {
+        return std::nullopt;
+    }
+
+    std::string description = test.m_name + ":";
+    for (std::size_t i = 0; i < problems.size(); ++i) {
+        description += (i == 0 ? " " : ", ") + problems[i];
+    }
+
+    return description;
+}
+
+void SingleStepRunner::print_report(std::vector<OpcodeResult> const& results, double seconds) const
+{
+    std::size_t tests = 0;
+    std::size_t failures = 0;
+    std::size_t opcodes_passed = 0;
+
+    for (OpcodeResult const& result : results) {
+        tests += result.m_tests;
+        failures += result.m_failures;
+
+        if (result.m_error.has_value()) {
+            std::cout << fmt::format("{}: {} of {} failed before the file stopped with: {}\n", result.m_opcode, result.m_failures, result.m_tests, result.m_error.value());
+        } else if (result.m_failures != 0) {
+            std::cout << fmt::format("{}: {} of {} failed\n", result.m_opcode, result.m_failures, result.m_tests);
+        } else {
+            ++opcodes_passed;
+            continue;
+        }
+
+        for (std::string const& description : result.m_failure_descriptions) {
+            std::cout << "    " << description << "\n";
+        }
+    }
+
+    std::cout << fmt::format(
+        "\n{} of {} opcodes passed. {} of {} tests passed, in {:.2f} s ({:.0f} tests per second)\n",
+        opcodes_passed, results.size(), tests - failures, tests, seconds,
+        seconds > 0 ? static_cast<double>(tests) / seconds : 0.0);
+}
+}
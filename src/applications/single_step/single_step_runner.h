@@ -0,0 +1,62 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace emu::applications::single_step {
+class SingleStepCore;
+struct SingleStepTest;
+struct CpuState;
+}
+
+namespace emu::applications::single_step {
+
+/**
+ * The outcome of the tests of one file, which is one opcode.
+ */
+struct OpcodeResult {
+    std::string m_opcode;
+    std::size_t m_tests { 0 };
+    std::size_t m_failures { 0 };
+    std::vector<std::string> m_failure_descriptions;
+    std::optional<std::string> m_error;
+};
+
+/**
+ * Runs single step tests, where every test is one instruction with the state before and after
+ * it. The tests come in one JSON file per opcode, and the files are spread over one thread per
+ * core of the host. Each file is streamed through, one test at a time, so the size of the files
+ * doesn't matter.
+ */
+class SingleStepRunner {
+public:
+    SingleStepRunner(
+        std::function<std::unique_ptr<SingleStepCore>()> create_core,
+        std::string const& path,
+        bool is_checking_cycles);
+
+    /**
+     * @return true if every test passed
+     */
+    bool run();
+
+private:
+    static constexpr std::size_t s_max_reported_failures = 3;
+    static constexpr const char* s_test_extension = ".json";
+
+    std::function<std::unique_ptr<SingleStepCore>()> m_create_core;
+    std::vector<std::string> m_files;
+    bool m_is_checking_cycles;
+
+    [[nodiscard]] OpcodeResult run_file(SingleStepCore& core, std::string const& file) const;
+
+    [[nodiscard]] std::optional<std::string> run_test(SingleStepCore& core, SingleStepTest const& test, CpuState& actual) const;
+
+    void print_report(std::vector<OpcodeResult> const& results, double seconds) const;
+};
+}
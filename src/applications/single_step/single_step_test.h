@@ -0,0 +1,90 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace emu::applications::single_step {
+
+enum class Register {
+    Pc,
+    Sp,
+    A,
+    B,
+    C,
+    D,
+    E,
+    F,
+    H,
+    L,
+    I,
+    R,
+    Ix,
+    Iy,
+    AfPrime,
+    BcPrime,
+    DePrime,
+    HlPrime,
+    Iff1,
+    Iff2,
+    Im,
+    Ime,
+    Inte
+};
+
+/**
+ * The names of the registers in the JSON, in the order of Register. Registers that none of the
+ * cores have, like WZ and Q of the Z80, are left out and skipped when they are read.
+ */
+inline constexpr std::array<std::string_view, 23> register_names = {
+    "pc", "sp", "a", "b", "c", "d", "e", "f", "h", "l", "i", "r", "ix", "iy",
+    "af_", "bc_", "de_", "hl_", "iff1", "iff2", "im", "ime", "inte"
+};
+
+/**
+ * The registers and memory of a CPU, as given by a test. A test only has the registers of the CPU
+ * it's for, so every register is marked as present or not.
+ */
+struct CpuState {
+    std::array<u16, register_names.size()> m_registers {};
+    u32 m_present { 0 };
+    std::vector<std::pair<u16, u8>> m_ram;
+
+    [[nodiscard]] bool has(Register reg) const
+    {
+        return (m_present & (1u << static_cast<unsigned int>(reg))) != 0;
+    }
+
+    [[nodiscard]] u16 get(Register reg) const
+    {
+        return m_registers[static_cast<std::size_t>(reg)];
+    }
+
+    void set(Register reg, u16 value)
+    {
+        m_registers[static_cast<std::size_t>(reg)] = value;
+        m_present |= 1u << static_cast<unsigned int>(reg);
+    }
+
+    void clear()
+    {
+        m_present = 0;
+        m_ram.clear();
+    }
+};
+
+/**
+ * One instruction, with the state before and after it, and the bus cycles it takes.
+ */
+struct SingleStepTest {
+    std::string m_name;
+    CpuState m_initial;
+    CpuState m_final;
+    std::size_t m_cycles { 0 };                    // How many entries the list of bus cycles has
+    std::vector<std::pair<u16, u8>> m_port_inputs; // What the ports the instruction reads have on them
+};
+}
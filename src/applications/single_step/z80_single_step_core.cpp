@@ -0,0 +1,105 @@
+#include "z80_single_step_core.h"
+#include "chips/z80/interrupt_mode.h"
+#include "chips/z80/manual_state.h"
+#include "crosscutting/util/byte_util.h"
+#include "single_step_test.h"
+#include <vector>
+
+namespace emu::applications::single_step {
+
+using emu::util::byte::high_byte;
+using emu::util::byte::low_byte;
+using emu::util::byte::to_u16;
+using emu::z80::InterruptMode;
+using emu::z80::ManualState;
+
+Z80SingleStepCore::Z80SingleStepCore()
+    : m_memory(create_memory())
+    , m_cpu(m_memory, 0)
+{
+}
+
+EmulatorMemory<u16, u8> Z80SingleStepCore::create_memory()
+{
+    EmulatorMemory<u16, u8> memory;
+    memory.add(std::vector<u8>(s_memory_size, 0));
+
+    return memory;
+}
+
+void Z80SingleStepCore::load(CpuState const& state)
+{
+    ManualState manual_state = m_cpu.manual_state();
+    manual_state.m_iff1 = state.get(Register::Iff1) != 0;
+    manual_state.m_iff2 = state.get(Register::Iff2) != 0;
+    manual_state.m_sp = state.get(Register::Sp);
+    manual_state.m_pc = state.get(Register::Pc);
+    manual_state.m_acc_reg = static_cast<u8>(state.get(Register::A));
+    manual_state.m_acc_p_reg = high_byte(state.get(Register::AfPrime));
+    manual_state.m_b_reg = static_cast<u8>(state.get(Register::B));
+    manual_state.m_b_p_reg = high_byte(state.get(Register::BcPrime));
+    manual_state.m_c_reg = static_cast<u8>(state.get(Register::C));
+    manual_state.m_c_p_reg = low_byte(state.get(Register::BcPrime));
+    manual_state.m_d_reg = static_cast<u8>(state.get(Register::D));
+    manual_state.m_d_p_reg = high_byte(state.get(Register::DePrime));
+    manual_state.m_e_reg = static_cast<u8>(state.get(Register::E));
+    manual_state.m_e_p_reg = low_byte(state.get(Register::DePrime));
+    manual_state.m_h_reg = static_cast<u8>(state.get(Register::H));
+    manual_state.m_h_p_reg = high_byte(state.get(Register::HlPrime));
+    manual_state.m_l_reg = static_cast<u8>(state.get(Register::L));
+    manual_state.m_l_p_reg = low_byte(state.get(Register::HlPrime));
+    manual_state.m_ix_reg = state.get(Register::Ix);
+    manual_state.m_iy_reg = state.get(Register::Iy);
+    manual_state.m_i_reg = static_cast<u8>(state.get(Register::I));
+    manual_state.m_r_reg = static_cast<u8>(state.get(Register::R));
+    manual_state.m_flag_reg.from_u8(static_cast<u8>(state.get(Register::F)));
+    manual_state.m_flag_p_reg.from_u8(low_byte(state.get(Register::AfPrime)));
+    manual_state.m_interrupt_mode = static_cast<InterruptMode>(state.get(Register::Im) % 3);
+    m_cpu.set_state_manually(manual_state);
+}
+
+void Z80SingleStepCore::save(CpuState& state) const
+{
+    state.set(Register::Pc, m_cpu.pc());
+    state.set(Register::Sp, m_cpu.sp());
+    state.set(Register::A, m_cpu.a());
+    state.set(Register::B, m_cpu.b());
+    state.set(Register::C, m_cpu.c());
+    state.set(Register::D, m_cpu.d());
+    state.set(Register::E, m_cpu.e());
+    state.set(Register::F, m_cpu.f());
+    state.set(Register::H, m_cpu.h());
+    state.set(Register::L, m_cpu.l());
+    state.set(Register::I, m_cpu.i());
+    state.set(Register::R, m_cpu.r());
+    state.set(Register::Ix, m_cpu.ix());
+    state.set(Register::Iy, m_cpu.iy());
+    state.set(Register::AfPrime, to_u16(m_cpu.a_p(), m_cpu.f_p()));
+    state.set(Register::BcPrime, to_u16(m_cpu.b_p(), m_cpu.c_p()));
+    state.set(Register::DePrime, to_u16(m_cpu.d_p(), m_cpu.e_p()));
+    state.set(Register::HlPrime, to_u16(m_cpu.h_p(), m_cpu.l_p()));
+    state.set(Register::Iff1, m_cpu.iff1() ? 1 : 0);
+    state.set(Register::Iff2, m_cpu.iff2() ? 1 : 0);
+    state.set(Register::Im, static_cast<u16>(m_cpu.interrupt_mode()));
+}
+
+cyc Z80SingleStepCore::step()
+{
+    return m_cpu.next_instruction();
+}
+
+void Z80SingleStepCore::input(u16 port, u8 value)
+{
+    m_cpu.input(port, value);
+}
+
+EmulatorMemory<u16, u8>& Z80SingleStepCore::memory()
+{
+    return m_memory;
+}
+
+cyc Z80SingleStepCore::cycles_per_entry() const
+{
+    return 1;
+}
+}
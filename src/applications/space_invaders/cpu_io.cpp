@@ -1,4 +1,5 @@
 #include "cpu_io.h"
+#include "crosscutting/misc/state_stream.h"
 #include "space_invaders/settings.h"
 
 namespace emu::applications::space_invaders {
@@ -34,4 +35,18 @@ void CpuIo::set_dipswitches(Settings const& settings)
         break;
     }
 }
+
+void CpuIo::save_input_state(StateWriter& writer) const
+{
+    writer.write(m_in_port0);
+    writer.write(m_in_port1);
+    writer.write(m_in_port2);
+}
+
+void CpuIo::load_input_state(StateReader& reader)
+{
+    m_in_port0 = reader.read<u8>();
+    m_in_port1 = reader.read<u8>();
+    m_in_port2 = reader.read<u8>();
+}
 }
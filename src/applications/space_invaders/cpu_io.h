@@ -6,10 +6,16 @@
 namespace emu::applications::space_invaders {
 class Settings;
 }
+namespace emu::misc {
+class StateReader;
+class StateWriter;
+}
 
 namespace emu::applications::space_invaders {
 
 using emu::i8080::ShiftRegister;
+using emu::misc::StateReader;
+using emu::misc::StateWriter;
 
 class CpuIo {
 public:
@@ -17,6 +23,15 @@ public:
 
     void set_dipswitches(Settings const& settings);
 
+    /**
+     * Saves the input ports, which is what is recorded when recording the input of a session.
+     *
+     * @param writer is the state to save to
+     */
+    void save_input_state(StateWriter& writer) const;
+
+    void load_input_state(StateReader& reader);
+
     u8 m_in_port0;
     u8 m_in_port1;
     u8 m_in_port2;
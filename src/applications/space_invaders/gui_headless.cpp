@@ -0,0 +1,28 @@
+#include "gui_headless.h"
+#include "crosscutting/benchmarking/benchmark.h"
+#include "crosscutting/gui/gui_for_benchmark.h"
+#include "gui.h"
+#include <vector>
+
+namespace emu::applications::space_invaders {
+class GuiObserver;
+}
+
+namespace emu::applications::space_invaders {
+
+using emu::benchmarking::pseudo_random_bytes;
+using emu::gui::GuiForBenchmark;
+
+void GuiHeadless::update_screen(std::vector<u8> const& vram, [[maybe_unused]] std::string const& game_window_subtitle)
+{
+    print_frame_hash(create_framebuffer(vram));
+}
+
+BENCHMARK("Space Invaders: Gui create_framebuffer")
+{
+    GuiForBenchmark<GuiHeadless> gui;
+    const std::vector<u8> vram = pseudo_random_bytes(0x1c00);
+
+    gui.run_create_framebuffer(bench, vram);
+}
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "crosscutting/gui/headless_gui.h"
+#include "crosscutting/typedefs.h"
+#include "gui.h"
+#include <string>
+#include <vector>
+
+namespace emu::applications::space_invaders {
+class GuiObserver;
+}
+
+namespace emu::applications::space_invaders {
+
+/**
+ * A GUI without a window, used when replaying recorded input. Instead of showing the frames, it
+ * prints the number and a hash of each of them, so that two runs can be compared line by line.
+ */
+class GuiHeadless : public emu::gui::HeadlessGui<Gui, GuiObserver> {
+public:
+    void update_screen(std::vector<u8> const& vram, std::string const& game_window_subtitle) override;
+};
+}
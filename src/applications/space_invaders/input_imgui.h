@@ -28,6 +28,7 @@ public:
 private:
     static constexpr SDL_Scancode s_mute = SDL_SCANCODE_M;
     static constexpr SDL_Scancode s_pause = SDL_SCANCODE_PAUSE;
+    static constexpr SDL_Scancode s_rewind = SDL_SCANCODE_PAGEDOWN;
     static constexpr SDL_Scancode s_step_instruction = SDL_SCANCODE_F7;
     static constexpr SDL_Scancode s_step_cycle = SDL_SCANCODE_F8;
     static constexpr SDL_Scancode s_continue_running = SDL_SCANCODE_F9;
@@ -64,6 +64,9 @@ void InputSdl::read(CpuIo& cpu_io, GuiIo& gui_io)
             break;
         case SDL_KEYUP:
             switch (read_input_event.key.keysym.scancode) {
+            case s_rewind:
+                gui_io.m_is_rewinding = false;
+                break;
             case s_insert_coin:
                 unset_bit(cpu_io.m_in_port1, 0);
                 break;
@@ -103,6 +106,9 @@ void InputSdl::read(CpuIo& cpu_io, GuiIo& gui_io)
             case s_mute:
                 notify_io_observers(TOGGLE_MUTE);
                 break;
+            case s_rewind:
+                gui_io.m_is_rewinding = true;
+                break;
             case s_pause:
                 gui_io.m_is_toggling_pause = true;
                 break;
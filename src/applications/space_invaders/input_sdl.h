@@ -28,6 +28,7 @@ public:
 private:
     static constexpr SDL_Scancode s_mute = SDL_SCANCODE_M;
     static constexpr SDL_Scancode s_pause = SDL_SCANCODE_PAUSE;
+    static constexpr SDL_Scancode s_rewind = SDL_SCANCODE_PAGEDOWN;
 
     static constexpr SDL_Scancode s_insert_coin = SDL_SCANCODE_C;
     static constexpr SDL_Scancode s_tilt = SDL_SCANCODE_T;
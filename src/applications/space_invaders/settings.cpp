@@ -2,6 +2,7 @@
 #include "crosscutting/exceptions/invalid_program_arguments_exception.h"
 #include "options.h"
 #include "usage.h"
+#include <cctype>
 #include <fmt/core.h>
 #include <functional>
 #include <sstream>
@@ -25,7 +26,10 @@ Settings Settings::from_options(Options const& options)
     Settings settings {
         .m_number_of_lives = NumberOfLives::Three,
         .m_bonus_life_at = BonusLifeAt::_1500,
-        .m_coin_info = CoinInfo::On
+        .m_coin_info = CoinInfo::On,
+        .m_run_ahead_frames = 0,
+        .m_record_file = "",
+        .m_replay_file = ""
     };
 
     std::unordered_map<std::string, std::vector<std::string>> opts = options.options();
@@ -79,6 +83,47 @@ Settings Settings::from_options(Options const& options)
         }
     }
 
+    if (opts.contains(s_run_ahead_long)) {
+        settings.m_run_ahead_frames = run_ahead_frames(opts[s_run_ahead_long]);
+    }
+
+    if (opts.contains(s_record_long)) {
+        settings.m_record_file = movie_file(s_record_long, opts.at(s_record_long));
+    }
+
+    if (opts.contains(s_replay_long)) {
+        settings.m_replay_file = movie_file(s_replay_long, opts.at(s_replay_long));
+    }
+
+    if (!settings.m_record_file.empty() && !settings.m_replay_file.empty()) {
+        throw InvalidProgramArgumentsException("Cannot record and replay input at the same time", print_usage);
+    }
+
     return settings;
 }
+
+unsigned int Settings::run_ahead_frames(std::vector<std::string> const& values)
+{
+    if (values.size() != 1 || values[0].size() != 1 || !std::isdigit(values[0][0])
+        || static_cast<unsigned int>(values[0][0] - '0') > s_max_run_ahead_frames) {
+        throw InvalidProgramArgumentsException(
+            fmt::format(
+                R"(Invalid number of frames passed to the --run-ahead option. Should be "--run-ahead=0", ..., "--run-ahead={}".)",
+                s_max_run_ahead_frames),
+            print_usage);
+    }
+
+    return static_cast<unsigned int>(values[0][0] - '0');
+}
+
+std::string Settings::movie_file(std::string const& option, std::vector<std::string> const& values)
+{
+    if (values.size() != 1 || values[0].empty()) {
+        throw InvalidProgramArgumentsException(
+            fmt::format(R"(Invalid file passed to the --{0} option. Should be "--{0}=<file>".)", option),
+            print_usage);
+    }
+
+    return values[0];
+}
 }
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 namespace emu::applications {
 class Options;
@@ -32,6 +33,10 @@ public:
     BonusLifeAt m_bonus_life_at;
     CoinInfo m_coin_info;
 
+    unsigned int m_run_ahead_frames;
+    std::string m_record_file;
+    std::string m_replay_file;
+
     static Settings from_options(Options const& options);
 
 private:
@@ -41,9 +46,19 @@ private:
 
     static const inline std::string s_dipswitch_short = "d";
     static const inline std::string s_gui_short = "g";
+    static const inline std::string s_run_ahead_long = "run-ahead";
+    static const inline std::string s_record_long = "record";
+    static const inline std::string s_replay_long = "replay";
+
+    static constexpr unsigned int s_max_run_ahead_frames = 4;
 
     static const inline std::unordered_set<std::string> s_recognized_options = {
-        s_help_short, s_help_long, s_debug_scanner_long, s_dipswitch_short, s_gui_short
+        s_help_short, s_help_long, s_debug_scanner_long, s_dipswitch_short, s_gui_short, s_run_ahead_long,
+        s_record_long, s_replay_long
     };
+
+    static unsigned int run_ahead_frames(std::vector<std::string> const& values);
+
+    static std::string movie_file(std::string const& option, std::vector<std::string> const& values);
 };
 }
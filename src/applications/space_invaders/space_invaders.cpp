@@ -1,5 +1,6 @@
 #include "space_invaders.h"
-#include "crosscutting/util/file_util.h"
+#include "crosscutting/memory/mapped_file.h"
+#include "gui_headless.h"
 #include "gui_imgui.h"
 #include "gui_sdl.h"
 #include "input_imgui.h"
@@ -19,12 +20,16 @@ class Session;
 
 namespace emu::applications::space_invaders {
 
-using emu::util::file::read_file_into_vector;
+using emu::memory::MappedFile;
 
 SpaceInvaders::SpaceInvaders(Settings const& settings, const GuiType gui_type)
     : m_settings(settings)
 {
-    if (gui_type == GuiType::DEBUGGING) {
+    if (!m_settings.m_replay_file.empty()) {
+        m_gui = std::make_shared<GuiHeadless>();
+        m_input = std::make_shared<InputSdl>();
+        m_is_starting_paused = false;
+    } else if (gui_type == GuiType::DEBUGGING) {
         m_gui = std::make_shared<GuiImgui>();
         m_input = std::make_shared<InputImgui>();
         m_is_starting_paused = true;
@@ -54,11 +59,11 @@ std::vector<u8> create_empty_vector(std::size_t size)
 void SpaceInvaders::load_files()
 {
     const std::string directory = "roms/8080/space_invaders/";
-    m_memory.add(read_file_into_vector(directory + "invaders.h")); // $0000-$07ff: invaders.h
-    m_memory.add(read_file_into_vector(directory + "invaders.g")); // $0800-$0fff: invaders.g
-    m_memory.add(read_file_into_vector(directory + "invaders.f")); // $1000-$17ff: invaders.f
-    m_memory.add(read_file_into_vector(directory + "invaders.e")); // $1800-$1fff: invaders.e
-    m_memory.add(create_empty_vector(0x23ff - 0x2000 + 1));        // $2000-$23ff: work RAM
-    m_memory.add(create_empty_vector(0x3fff - 0x2400 + 1));        // $2400-$3fff: video RAM
+    m_memory.add(MappedFile(directory + "invaders.h").bytes()); // $0000-$07ff: invaders.h
+    m_memory.add(MappedFile(directory + "invaders.g").bytes()); // $0800-$0fff: invaders.g
+    m_memory.add(MappedFile(directory + "invaders.f").bytes()); // $1000-$17ff: invaders.f
+    m_memory.add(MappedFile(directory + "invaders.e").bytes()); // $1800-$1fff: invaders.e
+    m_memory.add(create_empty_vector(0x23ff - 0x2000 + 1));     // $2000-$23ff: work RAM
+    m_memory.add(create_empty_vector(0x3fff - 0x2400 + 1));     // $2400-$3fff: video RAM
 }
 }
@@ -4,42 +4,41 @@
 #include "chips/8080/disassembler.h"
 #include "chips/8080/shift_register.h"
 #include "cpu_io.h"
+#include "crosscutting/debugging/advanced_disassembler.h"
 #include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/debugging/debugger.h"
-#include "crosscutting/debugging/disassembled_line.h"
+#include "crosscutting/debugging/decoded_instruction.h"
 #include "crosscutting/logging/logger.h"
 #include "crosscutting/memory/emulator_memory.h"
-#include "crosscutting/util/string_util.h"
+#include "crosscutting/misc/input_movie.h"
 #include "gui.h"
 #include "gui_request.h"
 #include "interfaces/input.h"
 #include "interfaces/state.h"
 #include "key_request.h"
+#include "settings.h"
 #include "states/paused_state.h"
 #include "states/running_state.h"
 #include "states/state_context.h"
 #include "states/stepping_state.h"
 #include "states/stopped_state.h"
-#include <algorithm>
+#include <cstddef>
 #include <iostream>
-#include <iterator>
-#include <stdexcept>
 #include <string>
 #include <tuple>
 #include <utility>
 
-namespace emu::applications::space_invaders {
-class Settings;
-}
-
 namespace emu::applications::space_invaders {
 
+using emu::debugger::AdvancedDisassembler;
+using emu::debugger::DisassemblyDebugContainer;
 using emu::debugger::FlagRegisterDebugContainer;
 using emu::debugger::IoDebugContainer;
 using emu::debugger::MemoryDebugContainer;
 using emu::debugger::RegisterDebugContainer;
+using emu::debugger::format_data_byte;
+using emu::debugger::format_instruction;
 using emu::i8080::Disassembler;
-using emu::util::string::split;
 
 SpaceInvadersSession::SpaceInvadersSession(
     Settings const& settings,
@@ -47,13 +46,23 @@ SpaceInvadersSession::SpaceInvadersSession(
     std::shared_ptr<Gui> gui,
     std::shared_ptr<Input> input,
     EmulatorMemory<u16, u8>& memory)
-    : m_gui(std::move(gui))
+    : m_is_replaying(!settings.m_replay_file.empty())
+    , m_gui(std::move(gui))
     , m_input(std::move(input))
     , m_memory(memory)
     , m_logger(std::make_shared<Logger>())
     , m_debugger(std::make_shared<Debugger<u16, 16>>())
+    , m_record_file(settings.m_record_file)
+    , m_governor(Governor(m_is_replaying ? 0 : s_tick_limit, sdl_get_ticks_high_performance))
 {
+    if (m_is_replaying) {
+        m_input_movie = std::make_shared<InputMovie>(settings.m_replay_file);
+    } else if (!settings.m_record_file.empty()) {
+        m_input_movie = std::make_shared<InputMovie>();
+    }
+
     setup_cpu();
+    setup_ports();
     setup_debugging();
     m_cpu_io.set_dipswitches(settings);
 
@@ -72,8 +81,11 @@ SpaceInvadersSession::SpaceInvadersSession(
         m_debug_container,
         m_outputs_during_cycle,
         m_governor,
-        m_is_in_debug_mode);
-    m_state_context->set_running_state(std::make_shared<RunningState>(m_state_context));
+        m_rewind_buffer,
+        m_input_movie,
+        m_is_in_debug_mode,
+        m_is_running_ahead);
+    m_state_context->set_running_state(std::make_shared<RunningState>(m_state_context, settings.m_run_ahead_frames));
     m_state_context->set_paused_state(std::make_shared<PausedState>(m_state_context));
     m_state_context->set_stepping_state(std::make_shared<SteppingState>(m_state_context));
     m_state_context->set_stopped_state(std::make_shared<StoppedState>(m_state_context));
@@ -102,6 +114,10 @@ void SpaceInvadersSession::run()
     while (!m_state_context->current_state()->is_exit_state()) {
         m_state_context->current_state()->perform(cycles);
     }
+
+    if (!m_record_file.empty()) {
+        m_input_movie->save(m_record_file);
+    }
 }
 
 void SpaceInvadersSession::pause()
@@ -124,6 +140,20 @@ void SpaceInvadersSession::setup_cpu()
     m_cpu->add_in_observer(*this);
 }
 
+void SpaceInvadersSession::setup_ports()
+{
+    m_in_port_decoder.add(Device::InPort0, s_port_mask, s_in_port_unused);
+    m_in_port_decoder.add(Device::InPort1, s_port_mask, s_in_port_1);
+    m_in_port_decoder.add(Device::InPort2, s_port_mask, s_in_port_2);
+    m_in_port_decoder.add(Device::ShiftRegister, s_port_mask, s_in_port_read_shift);
+
+    m_out_port_decoder.add(Device::ShiftOffset, s_port_mask, s_out_port_shift_offset);
+    m_out_port_decoder.add(Device::Sound1, s_port_mask, s_out_port_sound_1);
+    m_out_port_decoder.add(Device::DoShift, s_port_mask, s_out_port_do_shift);
+    m_out_port_decoder.add(Device::Sound2, s_port_mask, s_out_port_sound_2);
+    m_out_port_decoder.add(Device::Watchdog, s_port_mask, s_out_port_watchdog);
+}
+
 void SpaceInvadersSession::setup_debugging()
 {
     m_debug_container = std::make_shared<DebugContainer<u16, u8, 16>>();
@@ -179,8 +209,26 @@ void SpaceInvadersSession::setup_debugging()
             { "fleet_movement_4", 3 },
             { "ufo_hit", 4 } }));
     m_debug_container->add_memory(MemoryDebugContainer<u8>(
-        [&]() { return memory(); }));
-    m_debug_container->add_disassembled_program(disassemble_program());
+        [&]() { return memory(); },
+        [&](std::size_t address, u8 value) { m_memory.write(static_cast<u16>(address), value); }));
+    m_advanced_disassembler = std::make_shared<AdvancedDisassembler>(
+        0,
+        0x1fff,
+        [&](u16 address) { return Disassembler::decode(m_memory, address); },
+        std::vector<u16> { 0x0000, 0x0008, 0x0010 }); // The reset vector and the two interrupts
+    m_debug_container->add_disassembly(DisassemblyDebugContainer<u16, u8>(
+        [&]() -> std::vector<u16> const& {
+            m_advanced_disassembler->add_entry_point(m_cpu->pc());
+            return m_advanced_disassembler->addresses();
+        },
+        [&](EmulatorMemory<u16, u8> const& memory, u16 address) { return Disassembler::decode(memory, address); },
+        [&](EmulatorMemory<u16, u8> const& memory, u16 address, std::string& line) {
+            if (m_advanced_disassembler->is_code(address)) {
+                format_instruction(Disassembler::decode(memory, address), line);
+            } else {
+                format_data_byte(address, memory.read(address), line);
+            }
+        }));
 
     m_gui->attach_debugger(m_debugger);
     m_gui->attach_debug_container(m_debug_container);
@@ -207,49 +255,48 @@ void SpaceInvadersSession::gui_request(GuiRequest request)
 
 void SpaceInvadersSession::in_requested(u8 port)
 {
-    switch (port) {
-    case s_in_port_unused:
-        m_cpu->input(s_in_port_unused, m_cpu_io.m_in_port0);
+    switch (m_in_port_decoder.decode(port)) {
+    case Device::InPort0:
+        m_cpu->input(port, m_cpu_io.m_in_port0);
         break;
-    case s_in_port_1:
-        m_cpu->input(s_in_port_1, m_cpu_io.m_in_port1);
+    case Device::InPort1:
+        m_cpu->input(port, m_cpu_io.m_in_port1);
         break;
-    case s_in_port_2:
-        m_cpu->input(s_in_port_2, m_cpu_io.m_in_port2);
+    case Device::InPort2:
+        m_cpu->input(port, m_cpu_io.m_in_port2);
         break;
-    case s_in_port_read_shift:
-        m_cpu->input(s_in_port_read_shift, m_cpu_io.m_shift_register.read());
+    case Device::ShiftRegister:
+        m_cpu->input(port, m_cpu_io.m_shift_register.read());
         break;
     default:
-        throw std::runtime_error("Illegal input port for Space Invaders");
+        break;
     }
 }
 
 void SpaceInvadersSession::out_changed(u8 port)
 {
-    if (!m_outputs_during_cycle.contains(port)) {
-        m_outputs_during_cycle[port] = m_cpu->a();
-    } else {
-        m_outputs_during_cycle[port] |= m_cpu->a();
-    }
+    m_outputs_during_cycle.capture(port, m_cpu->a());
 
-    switch (port) {
-    case s_out_port_shift_offset:
+    switch (m_out_port_decoder.decode(port)) {
+    case Device::ShiftOffset:
         m_cpu_io.m_shift_register.change_offset(m_cpu->a());
         break;
-    case s_out_port_sound_1:
-        m_audio.play_sound_port_1(m_cpu->a());
+    case Device::Sound1:
+        if (!m_is_running_ahead && !m_is_replaying) {
+            m_audio.play_sound_port_1(m_cpu->a());
+        }
         break;
-    case s_out_port_do_shift:
+    case Device::DoShift:
         m_cpu_io.m_shift_register.shift(m_cpu->a());
         break;
-    case s_out_port_sound_2:
-        m_audio.play_sound_port_2(m_cpu->a());
-        break;
-    case s_out_port_watchdog:
+    case Device::Sound2:
+        if (!m_is_running_ahead && !m_is_replaying) {
+            m_audio.play_sound_port_2(m_cpu->a());
+        }
         break;
+    case Device::Watchdog:
     default:
-        throw std::runtime_error("Illegal output port for Space Invaders");
+        break;
     }
 }
 
@@ -264,28 +311,8 @@ void SpaceInvadersSession::key_pressed(KeyRequest request)
     }
 }
 
-std::vector<u8> SpaceInvadersSession::memory()
-{
-    return { m_memory.begin(), m_memory.begin() + 0x3fff + 1 };
-}
-
-std::vector<DisassembledLine<u16, 16>> SpaceInvadersSession::disassemble_program()
+std::span<u8 const> SpaceInvadersSession::memory()
 {
-    EmulatorMemory<u16, u8> sliced_for_disassembly = m_memory.slice(0, 0x2000);
-
-    std::stringstream ss;
-    Disassembler disassembler(sliced_for_disassembly, ss);
-    disassembler.disassemble();
-
-    std::vector<std::string> disassembled_program = split(ss, "\n");
-
-    disassembled_program.erase(
-        std::remove_if(disassembled_program.begin(), disassembled_program.end(), [](std::string const& s) { return s.empty(); }));
-
-    std::vector<DisassembledLine<u16, 16>> lines;
-    std::transform(disassembled_program.begin(), disassembled_program.end(), std::back_inserter(lines),
-        [](std::string const& line) { return DisassembledLine<u16, 16>(line); });
-
-    return lines;
+    return { m_memory.begin(), 0x3fff + 1 };
 }
 }
@@ -5,6 +5,8 @@
 #include "chips/8080/interfaces/out_observer.h"
 #include "cpu_io.h"
 #include "crosscutting/misc/governor.h"
+#include "crosscutting/misc/port_decoder.h"
+#include "crosscutting/misc/rewind_buffer.h"
 #include "crosscutting/misc/sdl_counter.h"
 #include "crosscutting/misc/session.h"
 #include "crosscutting/typedefs.h"
@@ -15,7 +17,8 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
-#include <unordered_map>
+#include <span>
+#include <string>
 #include <vector>
 
 namespace emu::applications::space_invaders {
@@ -26,12 +29,11 @@ class StateContext;
 struct GuiRequest;
 }
 namespace emu::debugger {
+class AdvancedDisassembler;
 template<class A, class D, std::size_t B>
 class DebugContainer;
 template<class A, std::size_t B>
 class Debugger;
-template<class A, std::size_t B>
-class DisassembledLine;
 }
 namespace emu::i8080 {
 class Cpu;
@@ -43,18 +45,25 @@ namespace emu::memory {
 template<class A, class D>
 class EmulatorMemory;
 }
+namespace emu::misc {
+class InputMovie;
+}
 
 namespace emu::applications::space_invaders {
 
+using emu::debugger::AdvancedDisassembler;
 using emu::debugger::DebugContainer;
 using emu::debugger::Debugger;
-using emu::debugger::DisassembledLine;
 using emu::i8080::Cpu;
 using emu::i8080::InObserver;
 using emu::i8080::OutObserver;
 using emu::logging::Logger;
 using emu::memory::EmulatorMemory;
 using emu::misc::Governor;
+using emu::misc::InputMovie;
+using emu::misc::PortCapture;
+using emu::misc::PortDecoder;
+using emu::misc::RewindBuffer;
 using emu::misc::sdl_get_ticks_high_performance;
 using emu::misc::Session;
 
@@ -92,6 +101,8 @@ private:
     // Game loop - begin
     static constexpr long double s_fps = 60.0L;
     static constexpr long double s_tick_limit = 1000.0L / s_fps;
+    static constexpr std::size_t s_rewind_memory_cap = 4 * 1024 * 1024;
+    static constexpr std::size_t s_rewind_keyframe_interval = static_cast<std::size_t>(s_fps);
     // Game loop - end
 
     // IO - begin
@@ -105,12 +116,31 @@ private:
     static constexpr u8 s_out_port_do_shift = 4;
     static constexpr u8 s_out_port_sound_2 = 5;
     static constexpr u8 s_out_port_watchdog = 6;
+
+    static constexpr u8 s_port_mask = 0b00000111; // Only A0-A2 are decoded
     // IO - end
 
+    enum class Device {
+        None,
+        InPort0,
+        InPort1,
+        InPort2,
+        ShiftRegister,
+        ShiftOffset,
+        Sound1,
+        DoShift,
+        Sound2,
+        Watchdog
+    };
+
     bool m_is_in_debug_mode { false };
+    bool m_is_running_ahead { false };
+    bool m_is_replaying;
 
     CpuIo m_cpu_io { CpuIo(0, 0b00001000, 0) };
     GuiIo m_gui_io;
+    PortDecoder<Device> m_in_port_decoder { Device::None };
+    PortDecoder<Device> m_out_port_decoder { Device::None };
     std::shared_ptr<Gui> m_gui;
     std::shared_ptr<Input> m_input;
     std::shared_ptr<Cpu> m_cpu;
@@ -121,18 +151,23 @@ private:
     std::shared_ptr<Logger> m_logger;
     std::shared_ptr<Debugger<u16, 16>> m_debugger;
     std::shared_ptr<DebugContainer<u16, u8, 16>> m_debug_container;
-    std::unordered_map<u8, u8> m_outputs_during_cycle;
+    std::shared_ptr<AdvancedDisassembler> m_advanced_disassembler;
+    PortCapture m_outputs_during_cycle;
 
-    Governor m_governor { Governor(s_tick_limit, sdl_get_ticks_high_performance) };
+    std::shared_ptr<InputMovie> m_input_movie;
+    std::string m_record_file;
+
+    Governor m_governor;
+    RewindBuffer m_rewind_buffer { RewindBuffer(s_rewind_memory_cap, s_rewind_keyframe_interval) };
 
     std::shared_ptr<StateContext> m_state_context;
 
     void setup_cpu();
 
-    void setup_debugging();
+    void setup_ports();
 
-    std::vector<u8> memory();
+    void setup_debugging();
 
-    std::vector<DisassembledLine<u16, 16>> disassemble_program();
+    std::span<u8 const> memory();
 };
 }
@@ -3,6 +3,7 @@
 #include "applications/space_invaders/gui_io.h"
 #include "applications/space_invaders/interfaces/input.h"
 #include "applications/space_invaders/states/state_context.h"
+#include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/misc/governor.h"
 #include <utility>
@@ -51,6 +52,7 @@ void PausedState::perform([[maybe_unused]] cyc& cycles)
             return;
         }
 
+        m_ctx->m_debug_container->take_snapshot();
         m_ctx->m_gui->update_screen(vram(), s_game_window_subtitle);
     }
 }
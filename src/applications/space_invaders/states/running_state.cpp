@@ -1,23 +1,31 @@
 #include "running_state.h"
 #include "chips/8080/cpu.h"
+#include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/debugging/debugger.h"
 #include "crosscutting/logging/logger.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/misc/governor.h"
+#include "crosscutting/misc/input_movie.h"
+#include "crosscutting/misc/port_decoder.h"
+#include "crosscutting/misc/rewind_buffer.h"
+#include "crosscutting/misc/state_stream.h"
 #include "crosscutting/typedefs.h"
+#include "space_invaders/cpu_io.h"
 #include "space_invaders/gui.h"
 #include "space_invaders/gui_io.h"
 #include "space_invaders/interfaces/input.h"
 #include "space_invaders/states/state_context.h"
-#include <unordered_map>
 #include <utility>
 
 namespace emu::applications::space_invaders {
 
 using emu::misc::Governor;
+using emu::misc::StateReader;
+using emu::misc::StateWriter;
 
-RunningState::RunningState(std::shared_ptr<StateContext> state_context)
+RunningState::RunningState(std::shared_ptr<StateContext> state_context, unsigned int run_ahead_frames)
     : m_ctx(std::move(state_context))
+    , m_run_ahead_frames(run_ahead_frames)
 {
 }
 
@@ -50,6 +58,16 @@ void RunningState::perform(cyc& cycles)
     m_ctx->m_outputs_during_cycle.clear();
 
     if (m_ctx->m_governor.is_time_to_update()) {
+        if (!m_ctx->m_input_movie) {
+            if (m_ctx->m_gui_io.m_is_rewinding) {
+                rewind();
+                return;
+            }
+
+            save_state(m_state);
+            m_ctx->m_rewind_buffer.push(m_state);
+        }
+
         cycles = 0;
         while (cycles < static_cast<cyc>(s_cycles_per_tick / 2)) {
             cycles += m_ctx->m_cpu->next_instruction();
@@ -74,7 +92,7 @@ void RunningState::perform(cyc& cycles)
             }
         }
 
-        m_ctx->m_input->read(m_ctx->m_cpu_io, m_ctx->m_gui_io);
+        read_input();
         if (m_ctx->m_gui_io.m_is_quitting) {
             m_ctx->m_gui_io.m_is_quitting = false;
             transition_to_stop();
@@ -85,7 +103,12 @@ void RunningState::perform(cyc& cycles)
             return;
         }
 
-        m_ctx->m_gui->update_screen(vram(), s_game_window_subtitle);
+        if (m_run_ahead_frames > 0) {
+            run_ahead();
+        } else {
+            m_ctx->m_debug_container->take_snapshot();
+            m_ctx->m_gui->update_screen(vram(), s_game_window_subtitle);
+        }
 
         if (m_ctx->m_cpu->is_inta()) {
             m_ctx->m_cpu->interrupt(s_rst_2_i8080);
@@ -93,6 +116,131 @@ void RunningState::perform(cyc& cycles)
     }
 }
 
+/**
+ * Reads the input once per frame. When recording, the input is added to the input movie. When
+ * replaying, the input comes from the input movie instead of from the player, and the session
+ * stops when the movie is over.
+ */
+void RunningState::read_input()
+{
+    if (is_replaying()) {
+        if (m_ctx->m_input_movie->is_finished()) {
+            m_ctx->m_gui_io.m_is_quitting = true;
+            return;
+        }
+
+        m_input.clear();
+        StateWriter writer(m_input);
+        m_ctx->m_cpu_io.save_input_state(writer);
+
+        if (m_ctx->m_input_movie->replay(m_input)) {
+            StateReader reader(m_input);
+            m_ctx->m_cpu_io.load_input_state(reader);
+        }
+
+        return;
+    }
+
+    m_ctx->m_input->read(m_ctx->m_cpu_io, m_ctx->m_gui_io);
+
+    if (m_ctx->m_input_movie) {
+        m_input.clear();
+        StateWriter writer(m_input);
+        m_ctx->m_cpu_io.save_input_state(writer);
+        m_ctx->m_input_movie->record(m_input);
+    }
+}
+
+bool RunningState::is_replaying() const
+{
+    return m_ctx->m_input_movie && m_ctx->m_input_movie->is_replaying();
+}
+
+void RunningState::rewind()
+{
+    if (m_ctx->m_rewind_buffer.pop(m_state)) {
+        load_state(m_state);
+    }
+
+    m_ctx->m_input->read(m_ctx->m_cpu_io, m_ctx->m_gui_io);
+    if (m_ctx->m_gui_io.m_is_quitting) {
+        m_ctx->m_gui_io.m_is_quitting = false;
+        transition_to_stop();
+        return;
+    } else if (m_ctx->m_gui_io.m_is_toggling_pause) {
+        m_ctx->m_gui_io.m_is_toggling_pause = false;
+        transition_to_pause();
+        return;
+    }
+
+    m_ctx->m_debug_container->take_snapshot();
+    m_ctx->m_gui->update_screen(vram(), s_game_window_subtitle);
+}
+
+/**
+ * Emulates a few frames ahead, shows the last of them and goes back to where it was. The game gets
+ * to react to the input that is held down right now before it is shown, which hides the frames of
+ * lag between the game reading the input and drawing the result.
+ */
+void RunningState::run_ahead()
+{
+    save_state(m_run_ahead_state);
+
+    m_ctx->m_is_running_ahead = true;
+    for (unsigned int frame = 0; frame < m_run_ahead_frames; ++frame) {
+        run_frame_headless();
+    }
+    m_ctx->m_is_running_ahead = false;
+
+    m_ctx->m_debug_container->take_snapshot();
+    m_ctx->m_gui->update_screen(vram(), s_game_window_subtitle);
+
+    load_state(m_run_ahead_state);
+}
+
+/**
+ * Emulates one frame without breakpoints, input, sound or rendering. Starts and ends right before
+ * the end-of-screen interrupt, which is where run_ahead is called from.
+ */
+void RunningState::run_frame_headless()
+{
+    if (m_ctx->m_cpu->is_inta()) {
+        m_ctx->m_cpu->interrupt(s_rst_2_i8080);
+    }
+
+    cyc cycles = 0;
+    while (cycles < static_cast<cyc>(s_cycles_per_tick / 2)) {
+        cycles += m_ctx->m_cpu->next_instruction();
+    }
+
+    if (m_ctx->m_cpu->is_inta()) {
+        m_ctx->m_cpu->interrupt(s_rst_1_i8080);
+    }
+
+    cycles = 0;
+    while (cycles < static_cast<cyc>(s_cycles_per_tick / 2)) {
+        cycles += m_ctx->m_cpu->next_instruction();
+    }
+}
+
+void RunningState::save_state(std::vector<u8>& state)
+{
+    state.clear();
+
+    StateWriter writer(state);
+    m_ctx->m_cpu->save_state(writer);
+    m_ctx->m_memory.save_state(writer, s_address_ram_beginning, m_ctx->m_memory.size());
+    m_ctx->m_cpu_io.m_shift_register.save_state(writer);
+}
+
+void RunningState::load_state(std::vector<u8> const& state)
+{
+    StateReader reader(state);
+    m_ctx->m_cpu->load_state(reader);
+    m_ctx->m_memory.load_state(reader, s_address_ram_beginning, m_ctx->m_memory.size());
+    m_ctx->m_cpu_io.m_shift_register.load_state(reader);
+}
+
 std::vector<u8> RunningState::vram()
 {
     return { m_ctx->m_memory.begin() + 0x2400, m_ctx->m_memory.begin() + 0x3fff + 1 };
@@ -2,6 +2,7 @@
 
 #include "crosscutting/typedefs.h"
 #include "space_invaders/interfaces/state.h"
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
@@ -29,7 +30,7 @@ using emu::misc::Governor;
 class RunningState : public State {
 
 public:
-    explicit RunningState(std::shared_ptr<StateContext> state_context);
+    RunningState(std::shared_ptr<StateContext> state_context, unsigned int run_ahead_frames);
 
     bool is_exit_state() override;
 
@@ -56,8 +57,32 @@ private:
     static constexpr unsigned int s_rst_1_i8080 = 0xcf;
     static constexpr unsigned int s_rst_2_i8080 = 0xd7;
 
+    // Rewind - begin
+    static constexpr std::size_t s_address_ram_beginning = 0x2000;
+    // Rewind - end
+
     std::shared_ptr<StateContext> m_ctx;
 
+    unsigned int m_run_ahead_frames;
+
+    std::vector<u8> m_state;
+    std::vector<u8> m_run_ahead_state;
+    std::vector<u8> m_input;
+
+    void read_input();
+
+    [[nodiscard]] bool is_replaying() const;
+
+    void rewind();
+
+    void run_ahead();
+
+    void run_frame_headless();
+
+    void save_state(std::vector<u8>& state);
+
+    void load_state(std::vector<u8> const& state);
+
     std::vector<u8> vram();
 };
 
@@ -20,10 +20,14 @@ StateContext::StateContext(
     std::shared_ptr<Logger> logger,
     std::shared_ptr<Debugger<u16, 16>> debugger,
     std::shared_ptr<DebugContainer<u16, u8, 16>> debug_container,
-    std::unordered_map<u8, u8>& outputs_during_cycle,
+    PortCapture& outputs_during_cycle,
     Governor& governor,
-    bool& is_in_debug_mode)
+    RewindBuffer& rewind_buffer,
+    std::shared_ptr<InputMovie> input_movie,
+    bool& is_in_debug_mode,
+    bool& is_running_ahead)
     : m_is_in_debug_mode(is_in_debug_mode)
+    , m_is_running_ahead(is_running_ahead)
     , m_cpu_io(cpu_io)
     , m_gui_io(gui_io)
     , m_gui(std::move(gui))
@@ -35,6 +39,8 @@ StateContext::StateContext(
     , m_debug_container(std::move(debug_container))
     , m_outputs_during_cycle(outputs_during_cycle)
     , m_governor(governor)
+    , m_rewind_buffer(rewind_buffer)
+    , m_input_movie(std::move(input_movie))
 {
 }
 
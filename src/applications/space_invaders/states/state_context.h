@@ -4,7 +4,6 @@
 #include "crosscutting/typedefs.h"
 #include <cstddef>
 #include <memory>
-#include <unordered_map>
 
 namespace emu::applications::space_invaders {
 class CpuIo;
@@ -30,6 +29,9 @@ class EmulatorMemory;
 }
 namespace emu::misc {
 class Governor;
+class InputMovie;
+class PortCapture;
+class RewindBuffer;
 }
 
 namespace emu::applications::space_invaders {
@@ -37,6 +39,9 @@ namespace emu::applications::space_invaders {
 using emu::i8080::Cpu;
 using emu::memory::EmulatorMemory;
 using emu::misc::Governor;
+using emu::misc::InputMovie;
+using emu::misc::PortCapture;
+using emu::misc::RewindBuffer;
 
 class StateContext {
 public:
@@ -50,11 +55,15 @@ public:
         std::shared_ptr<Logger> logger,
         std::shared_ptr<Debugger<u16, 16>> debugger,
         std::shared_ptr<DebugContainer<u16, u8, 16>> debug_container,
-        std::unordered_map<u8, u8>& outputs_during_cycle,
+        PortCapture& outputs_during_cycle,
         Governor& governor,
-        bool& is_in_debug_mode);
+        RewindBuffer& rewind_buffer,
+        std::shared_ptr<InputMovie> input_movie,
+        bool& is_in_debug_mode,
+        bool& is_running_ahead);
 
     bool& m_is_in_debug_mode;
+    bool& m_is_running_ahead;
 
     CpuIo& m_cpu_io;
     GuiIo& m_gui_io;
@@ -67,9 +76,11 @@ public:
     std::shared_ptr<Logger> m_logger;
     std::shared_ptr<Debugger<u16, 16>> m_debugger;
     std::shared_ptr<DebugContainer<u16, u8, 16>> m_debug_container;
-    std::unordered_map<u8, u8>& m_outputs_during_cycle;
+    PortCapture& m_outputs_during_cycle;
 
     Governor& m_governor;
+    RewindBuffer& m_rewind_buffer;
+    std::shared_ptr<InputMovie> m_input_movie;
 
     void change_state(std::shared_ptr<State> new_state);
 
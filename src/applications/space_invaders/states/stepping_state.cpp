@@ -3,10 +3,11 @@
 #include "applications/space_invaders/interfaces/input.h"
 #include "applications/space_invaders/states/state_context.h"
 #include "chips/8080/cpu.h"
+#include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/memory/emulator_memory.h"
+#include "crosscutting/misc/port_decoder.h"
 #include "crosscutting/typedefs.h"
 #include "space_invaders/gui.h"
-#include <unordered_map>
 #include <utility>
 
 namespace emu::applications::space_invaders {
@@ -85,6 +86,7 @@ void SteppingState::perform(cyc& cycles)
         return;
     }
 
+    m_ctx->m_debug_container->take_snapshot();
     m_ctx->m_gui->update_screen(vram(), s_game_window_subtitle);
 
     if (m_ctx->m_cpu->is_inta()) {
@@ -13,7 +13,10 @@ static constexpr std::size_t padding_to_description = 14;
 
 const std::vector<std::pair<std::string, std::string>> supported_flags = {
     { "-g", "ordinary, debugging. ordinary is default." },
-    { "-d", "Dipswitches. See description below." }
+    { "-d", "Dipswitches. See description below." },
+    { "--run-ahead", "Frames to run ahead of the screen to hide input lag: 0 to 4. 0 is default." },
+    { "--record", "Record the input to a file, to replay it later." },
+    { "--replay", "Replay recorded input headless, as fast as possible, and print a hash of every frame." }
 };
 const std::vector<std::pair<std::string, std::string>> supported_dipswitches = {
     { "n", "Number of lives: 3, 4, 5 or 6. 3 is default." },
@@ -22,7 +25,10 @@ const std::vector<std::pair<std::string, std::string>> supported_dipswitches = {
 };
 const std::vector<std::pair<std::string, std::string>> examples = {
     { "-g debugging -d b=1000", "Running with the debugging GUI and bonus life at 1000" },
-    { "-d c=off -d n=6", "Coins not needed (this might not work) and 6 lives" }
+    { "-d c=off -d n=6", "Coins not needed (this might not work) and 6 lives" },
+    { "--run-ahead=1", "Running one frame ahead, which removes one frame of input lag" },
+    { "--record=game.inp", "Recording the input to game.inp" },
+    { "--replay=game.inp", "Replaying the input recorded in game.inp" }
 };
 
 void print_usage(std::string const& program_name)
@@ -4,9 +4,11 @@
 #include "applications/synacor_application/states/state_context.h"
 #include "applications/synacor_application/ui.h"
 #include "chips/trivial/synacor/cpu.h"
+#include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/debugging/debugger.h"
 #include "crosscutting/logging/logger.h"
 #include "crosscutting/misc/governor.h"
+#include "crosscutting/misc/hook_table.h"
 #include <utility>
 
 namespace emu::applications::synacor {
@@ -53,7 +55,7 @@ void RunningState::perform(cyc& cycles)
         cycles = 0;
         while (cycles < static_cast<cyc>(s_cycles_per_tick) && !m_ctx->m_is_awaiting_input) {
             if (m_ctx->m_cpu->can_run_next_instruction()) {
-                m_ctx->m_cpu->next_instruction();
+                m_ctx->m_hooks.next_instruction(*m_ctx->m_cpu);
             } else {
                 if (m_ctx->m_is_only_run_once) {
                     transition_to_stop();
@@ -90,6 +92,7 @@ void RunningState::perform(cyc& cycles)
             return;
         }
 
+        m_ctx->m_debug_container->take_snapshot();
         m_ctx->m_ui->update_screen(m_ctx->m_is_awaiting_input, s_game_window_subtitle);
     }
 }
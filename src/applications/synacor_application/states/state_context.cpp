@@ -26,6 +26,7 @@ class EmulatorMemory;
 }
 namespace emu::misc {
 class Governor;
+class HookTable;
 }
 
 namespace emu::applications::synacor {
@@ -37,6 +38,7 @@ StateContext::StateContext(
     std::shared_ptr<Ui> ui,
     std::shared_ptr<Input> input,
     std::shared_ptr<Cpu> cpu,
+    HookTable& hooks,
     EmulatorMemory<Address, RawData>& memory,
     std::shared_ptr<Logger> logger,
     std::shared_ptr<Debugger<Address, 16>> debugger,
@@ -52,6 +54,7 @@ StateContext::StateContext(
     , m_ui(std::move(ui))
     , m_input(std::move(input))
     , m_cpu(std::move(cpu))
+    , m_hooks(hooks)
     , m_memory(memory)
     , m_logger(std::move(logger))
     , m_debugger(std::move(debugger))
@@ -28,12 +28,14 @@ class EmulatorMemory;
 }
 namespace emu::misc {
 class Governor;
+class HookTable;
 }
 
 namespace emu::applications::synacor {
 
 using emu::memory::EmulatorMemory;
 using emu::misc::Governor;
+using emu::misc::HookTable;
 using emu::synacor::Cpu;
 using emu::synacor::RawData;
 
@@ -44,6 +46,7 @@ public:
         std::shared_ptr<Ui> ui,
         std::shared_ptr<Input> input,
         std::shared_ptr<Cpu> cpu,
+        HookTable& hooks,
         EmulatorMemory<Address, RawData>& memory,
         std::shared_ptr<Logger> logger,
         std::shared_ptr<Debugger<Address, 16>> debugger,
@@ -61,6 +64,7 @@ public:
     std::shared_ptr<Ui> m_ui;
     std::shared_ptr<Input> m_input;
     std::shared_ptr<Cpu> m_cpu;
+    HookTable& m_hooks;
 
     EmulatorMemory<Address, RawData>& m_memory;
 
@@ -3,6 +3,8 @@
 #include "applications/synacor_application/interfaces/input.h"
 #include "applications/synacor_application/ui.h"
 #include "chips/trivial/synacor/cpu.h"
+#include "crosscutting/debugging/debug_container.h"
+#include "crosscutting/misc/hook_table.h"
 #include "crosscutting/typedefs.h"
 #include "state_context.h"
 #include <utility>
@@ -58,7 +60,7 @@ void SteppingState::perform([[maybe_unused]] cyc& cycles)
     cycles = 0;
     while (cycles < static_cast<cyc>(s_cycles_per_tick)) {
         if (m_ctx->m_cpu->can_run_next_instruction()) {
-            m_ctx->m_cpu->next_instruction();
+            m_ctx->m_hooks.next_instruction(*m_ctx->m_cpu);
         } else {
             transition_to_pause();
             return;
@@ -81,6 +83,7 @@ void SteppingState::perform([[maybe_unused]] cyc& cycles)
         return;
     }
 
+    m_ctx->m_debug_container->take_snapshot();
     m_ctx->m_ui->update_screen(m_ctx->m_is_awaiting_input, s_game_window_subtitle);
 }
 
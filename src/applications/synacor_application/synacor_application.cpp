@@ -39,9 +39,6 @@ SynacorApplication::SynacorApplication(const GuiType gui_type)
         m_input = std::make_shared<InputImgui>();
         m_is_starting_paused = false;
     }
-
-    m_memory_mapped_io = std::make_shared<MemoryMapForSynacorApplication>(m_memory);
-    m_memory.attach_memory_mapper(m_memory_mapped_io);
 }
 
 std::unique_ptr<Session> SynacorApplication::new_session()
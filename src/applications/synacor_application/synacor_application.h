@@ -6,7 +6,6 @@
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/misc/emulator.h"
 #include "crosscutting/misc/uinteger.h"
-#include "memory_map_for_synacor_application.h"
 #include <cstddef>
 #include <memory>
 #include <string>
@@ -46,7 +45,6 @@ private:
     EmulatorMemory<Address, RawData> m_memory;
     std::shared_ptr<Ui> m_gui;
     std::shared_ptr<Input> m_input;
-    std::shared_ptr<MemoryMapForSynacorApplication> m_memory_mapped_io;
     bool m_is_starting_paused;
     std::string m_loaded_file;
     std::string m_file_content;
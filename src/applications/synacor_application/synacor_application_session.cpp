@@ -2,6 +2,7 @@
 #include "chips/trivial/synacor/cpu.h"
 #include "chips/trivial/synacor/disassembler.h"
 #include "chips/trivial/synacor/usings.h"
+#include "chips/trivial/synacor/words.h"
 #include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/debugging/debugger.h"
 #include "crosscutting/debugging/disassembled_line.h"
@@ -37,10 +38,41 @@ using emu::debugger::RegisterDebugContainer;
 using emu::synacor::Address;
 using emu::synacor::Data;
 using emu::synacor::Disassembler;
+using emu::synacor::memory_size;
 using emu::synacor::RawData;
+using emu::synacor::value_mask;
 using emu::util::byte::to_u16;
 using emu::util::string::split;
 
+/**
+ * The function the teleporter check works out, which is Ackermann's function with the eighth
+ * register in place of 1 in f(m, 0). The routine recurses far too deep to finish, so the function is
+ * worked out here one row of m at a time, each row from the one before.
+ *
+ * @param m is the first argument, in r0
+ * @param n is the second argument, in r1
+ * @param r7 is the eighth register
+ * @return f(m, n)
+ */
+static u16 teleporter_check_function(u16 m, u16 n, u16 r7)
+{
+    std::vector<u16> row(memory_size);
+    for (std::size_t i = 0; i < row.size(); ++i) {
+        row[i] = static_cast<u16>((i + 1) & value_mask); // f(0, n) = n + 1
+    }
+
+    std::vector<u16> next_row(memory_size);
+    for (u16 i = 0; i < m; ++i) {
+        next_row[0] = row[r7]; // f(m, 0) = f(m - 1, r7)
+        for (std::size_t j = 1; j < next_row.size(); ++j) {
+            next_row[j] = row[next_row[j - 1]]; // f(m, n) = f(m - 1, f(m, n - 1))
+        }
+        row.swap(next_row);
+    }
+
+    return row[n];
+}
+
 SynacorApplicationSession::SynacorApplicationSession(
     bool is_only_run_once,
     bool is_starting_paused,
@@ -59,6 +91,7 @@ SynacorApplicationSession::SynacorApplicationSession(
     , m_debugger(std::make_shared<Debugger<Address, 16>>())
 {
     setup_cpu();
+    setup_hooks();
     setup_debugging();
 
     m_ui->add_ui_observer(*this);
@@ -68,6 +101,7 @@ SynacorApplicationSession::SynacorApplicationSession(
         m_ui,
         m_input,
         m_cpu,
+        m_hooks,
         m_memory,
         m_logger,
         m_debugger,
@@ -171,17 +205,22 @@ void SynacorApplicationSession::setup_cpu()
     m_cpu->add_in_observer(*this);
 }
 
+void SynacorApplicationSession::setup_hooks()
+{
+    m_hooks.add_hook(s_address_teleporter_check, [&]() { return teleporter_check(); });
+}
+
 void SynacorApplicationSession::setup_debugging()
 {
     m_debug_container = std::make_shared<DebugContainer<Address, RawData, 16>>();
-        m_debug_container->add_register(RegisterDebugContainer<RawData>("R0", [&]() { return m_memory.read(Address(32768)); }));
-        m_debug_container->add_register(RegisterDebugContainer<RawData>("R1", [&]() { return m_memory.read(Address(32769)); }));
-        m_debug_container->add_register(RegisterDebugContainer<RawData>("R2", [&]() { return m_memory.read(Address(32770)); }));
-        m_debug_container->add_register(RegisterDebugContainer<RawData>("R3", [&]() { return m_memory.read(Address(32771)); }));
-        m_debug_container->add_register(RegisterDebugContainer<RawData>("R4", [&]() { return m_memory.read(Address(32772)); }));
-        m_debug_container->add_register(RegisterDebugContainer<RawData>("R5", [&]() { return m_memory.read(Address(32773)); }));
-        m_debug_container->add_register(RegisterDebugContainer<RawData>("R6", [&]() { return m_memory.read(Address(32774)); }));
-        m_debug_container->add_register(RegisterDebugContainer<RawData>("R7", [&]() { return m_memory.read(Address(32775)); }));
+    m_debug_container->add_register(RegisterDebugContainer<RawData>("R0", [&]() { return m_cpu->register_value(0); }));
+    m_debug_container->add_register(RegisterDebugContainer<RawData>("R1", [&]() { return m_cpu->register_value(1); }));
+    m_debug_container->add_register(RegisterDebugContainer<RawData>("R2", [&]() { return m_cpu->register_value(2); }));
+    m_debug_container->add_register(RegisterDebugContainer<RawData>("R3", [&]() { return m_cpu->register_value(3); }));
+    m_debug_container->add_register(RegisterDebugContainer<RawData>("R4", [&]() { return m_cpu->register_value(4); }));
+    m_debug_container->add_register(RegisterDebugContainer<RawData>("R5", [&]() { return m_cpu->register_value(5); }));
+    m_debug_container->add_register(RegisterDebugContainer<RawData>("R6", [&]() { return m_cpu->register_value(6); }));
+    m_debug_container->add_register(RegisterDebugContainer<RawData>("R7", [&]() { return m_cpu->register_value(7); }));
     m_debug_container->add_pc([&]() { return m_cpu->pc(); });
 //    m_debug_container->add_memory(MemoryDebugContainer<Data>([&]() { return memory(); }));
     m_debug_container->add_disassembled_program(disassemble_program());
@@ -192,15 +231,28 @@ void SynacorApplicationSession::setup_debugging()
     m_ui->attach_logger(m_logger);
 }
 
+/**
+ * The CPU runs on its own copy of the program, which the program changes while it runs, so the
+ * memory is read from the CPU and not from the memory the program was loaded into.
+ */
 std::vector<RawData> SynacorApplicationSession::memory()
 {
-    return { m_memory.begin(), m_memory.end() };
+    std::vector<RawData> words;
+    words.reserve(memory_size);
+    for (std::size_t address = 0; address < memory_size; ++address) {
+        words.push_back(m_cpu->word(address));
+    }
+
+    return words;
 }
 
 std::vector<DisassembledLine<Address, 16>> SynacorApplicationSession::disassemble_program()
 {
+        EmulatorMemory<Address, RawData> memory;
+        memory.add(this->memory());
+
         std::stringstream ss;
-        Disassembler disassembler(m_memory, ss);
+        Disassembler disassembler(memory, ss);
         disassembler.disassemble();
 
         std::vector<std::string> disassembled_program = split(ss, "\n");
@@ -215,4 +267,33 @@ std::vector<DisassembledLine<Address, 16>> SynacorApplicationSession::disassembl
         return lines;
 }
 
+/**
+ * Runs the teleporter check in place of the routine, if the routine is there. The program decrypts
+ * itself while it runs, so it's compared with what the CPU has, and not with the loaded program.
+ *
+ * @return the cycles of the routine, which are not counted
+ */
+cyc SynacorApplicationSession::teleporter_check()
+{
+    for (std::size_t i = 0; i < s_teleporter_check.size(); ++i) {
+        if (m_cpu->word(s_address_teleporter_check + i) != RawData(s_teleporter_check[i])) {
+            return 0;
+        }
+    }
+
+    const auto m = static_cast<u16>(m_cpu->register_value(0).underlying());
+    const auto n = static_cast<u16>(m_cpu->register_value(1).underlying());
+    const auto r7 = static_cast<u16>(m_cpu->register_value(7).underlying());
+    const u64 key = (static_cast<u64>(r7) << 32) | (static_cast<u64>(m) << 16) | n;
+    const u16 result = m_teleporter_check_results.find_or_compute(key, [&]() {
+        return teleporter_check_function(m, n, r7);
+    });
+
+    // The routine returns with r1 as it was in its last f(0, n)
+    m_cpu->set_register_value(0, RawData(result));
+    m_cpu->set_register_value(1, RawData((result - 1) & value_mask));
+    m_cpu->return_from_routine();
+
+    return 0;
+}
 }
@@ -5,11 +5,14 @@
 #include "chips/trivial/synacor/usings.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/misc/governor.h"
+#include "crosscutting/misc/hook_table.h"
 #include "crosscutting/misc/sdl_counter.h"
 #include "crosscutting/misc/session.h"
 #include "crosscutting/misc/uinteger.h"
+#include "crosscutting/typedefs.h"
 #include "gui_io.h"
 #include "interfaces/ui_observer.h"
+#include <array>
 #include <cstddef>
 #include <functional>
 #include <memory>
@@ -46,6 +49,8 @@ using emu::debugger::DisassembledLine;
 using emu::logging::Logger;
 using emu::memory::EmulatorMemory;
 using emu::misc::Governor;
+using emu::misc::HookTable;
+using emu::misc::RoutineMemo;
 using emu::misc::sdl_get_ticks_high_performance;
 using emu::misc::Session;
 using emu::misc::UInteger;
@@ -93,6 +98,27 @@ private:
     static constexpr long double s_cycles_per_tick = s_cycles_per_ms * s_tick_limit;
     // Game loop - end
 
+    // The routine the teleporter uses to check the eighth register
+    static constexpr u16 s_address_teleporter_check = 6027;
+    static constexpr std::array<u16, 41> s_teleporter_check = {
+        7, 32768, 6035, // JT r0 6035
+        9, 32768, 32769, 1, // ADD r0 r1 1
+        18, // RET
+        7, 32769, 6048, // JT r1 6048
+        9, 32768, 32768, 32767, // ADD r0 r0 32767
+        1, 32769, 32775, // SET r1 r7
+        17, 6027, // CALL 6027
+        18, // RET
+        2, 32768, // PUSH r0
+        9, 32769, 32769, 32767, // ADD r1 r1 32767
+        17, 6027, // CALL 6027
+        1, 32769, 32768, // SET r1 r0
+        3, 32768, // POP r0
+        9, 32768, 32768, 32767, // ADD r0 r0 32767
+        17, 6027, // CALL 6027
+        18 // RET
+    };
+
     bool m_is_only_run_once { false };
     bool m_is_in_debug_mode { false };
     bool m_is_awaiting_input { false };
@@ -107,6 +133,8 @@ private:
     std::shared_ptr<Logger> m_logger;
     std::shared_ptr<Debugger<Address, 16>> m_debugger;
     std::shared_ptr<DebugContainer<Address, RawData, 16>> m_debug_container;
+    HookTable m_hooks;
+    RoutineMemo<u64, u16> m_teleporter_check_results;
 
     Governor m_governor { Governor(s_tick_limit, sdl_get_ticks_high_performance) };
 
@@ -114,6 +142,8 @@ private:
 
     void setup_cpu();
 
+    void setup_hooks();
+
     void setup_debugging();
 
     std::vector<RawData> memory();
@@ -121,5 +151,7 @@ private:
     void input_from_terminal(Data input);
 
     std::vector<DisassembledLine<Address, 16>> disassemble_program();
+
+    cyc teleporter_check();
 };
 }
@@ -1,13 +1,17 @@
 #include "audio.h"
+#include "chips/ay_3_8912/ay_3_8912.h"
 #include <SDL.h>
 #include <SDL_error.h>
 #include <SDL_log.h>
-#include <SDL_stdinc.h>
+#include <algorithm>
 #include <cstdlib>
+#include <utility>
 
 namespace emu::applications::zxspectrum_48k {
 
-Audio::Audio()
+Audio::Audio(cyc t_states_per_frame, std::shared_ptr<Ay38912> sound_chip)
+    : m_sound_chip(std::move(sound_chip))
+    , m_beeper(t_states_per_frame * s_fps, s_sdl_frequency)
 {
     if (SDL_Init(SDL_INIT_AUDIO) != 0) {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "error initializing SDL audio: %s", SDL_GetError());
@@ -22,8 +26,8 @@ Audio::Audio()
         .samples = 1024,
         .padding = 0,
         .size = 0,
-        .callback = forward_callback,
-        .userdata = this
+        .callback = nullptr,
+        .userdata = nullptr
     };
     m_audio_device = SDL_OpenAudioDevice(
         nullptr,
@@ -45,35 +49,49 @@ Audio::~Audio()
     SDL_QuitSubSystem(SDL_INIT_AUDIO);
 }
 
-void Audio::beep()
+void Audio::beep(bool is_ear_on, bool is_mic_on, cyc t_state)
 {
-}
+    const float level = (is_ear_on ? s_ear_level : 0) + (is_mic_on ? s_mic_level : 0);
 
-void Audio::toggle_mute()
-{
-    m_is_muted = !m_is_muted;
+    if (level != m_beeper_level) {
+        m_beeper_edges.push_back({ .m_t_state = t_state, .m_level = level });
+        m_beeper_level = level;
+    }
 }
 
-void Audio::generate_audio(u8* stream, int len)
+void Audio::render_frame(cyc t_states)
 {
-    [[maybe_unused]] auto* stream16 = (i16*)stream;
-    [[maybe_unused]] int samples = static_cast<int>(len / sizeof(i16));
+    m_samples.clear();
 
-    SDL_memset(stream, 0, len); // no sound
+    for (BeeperEdge const& edge : m_beeper_edges) {
+        m_beeper.add_step(edge.m_t_state, edge.m_level - m_rendered_beeper_level);
+        m_rendered_beeper_level = edge.m_level;
+    }
+    m_beeper_edges.clear();
+    m_beeper.end_block(t_states, m_samples);
 
-    //    play(ufo_sound, samples, stream16, m_ufo_x, dummy);
-}
+    if (m_sound_chip) {
+        m_sound_chip_samples.clear();
+        m_sound_chip->render(t_states / s_t_states_per_sound_chip_cycle, m_sound_chip_samples);
 
-void Audio::play(std::vector<double> sound, int samples, i16* stream16, std::size_t& x, bool& is_sound_on) const
-{
-    for (int i = 0; i < samples; i++) {
-        if (x < sound.size()) {
-            stream16[i] += static_cast<i16>(sound[x++] * m_volume * !m_is_muted);
-        } else {
-            is_sound_on = false;
-            x = 0;
-            break;
+        // Both run at the rate of the frames, so they only differ by the sample that is left over
+        const std::size_t number_of_samples = std::min(m_samples.size(), m_sound_chip_samples.size());
+        for (std::size_t i = 0; i < number_of_samples; ++i) {
+            m_samples[i] = static_cast<i16>(std::clamp(m_samples[i] + m_sound_chip_samples[i], -32768, 32767));
         }
     }
+
+    if (m_is_muted) {
+        std::fill(m_samples.begin(), m_samples.end(), 0);
+    }
+
+    if (SDL_GetQueuedAudioSize(m_audio_device) < s_max_queued_bytes) {
+        SDL_QueueAudio(m_audio_device, m_samples.data(), static_cast<u32>(m_samples.size() * sizeof(i16)));
+    }
+}
+
+void Audio::toggle_mute()
+{
+    m_is_muted = !m_is_muted;
 }
 }
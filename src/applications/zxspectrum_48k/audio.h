@@ -1,39 +1,78 @@
 #pragma once
 
+#include "crosscutting/audio/blep_synthesizer.h"
 #include "crosscutting/typedefs.h"
 #include <SDL_audio.h>
 #include <cstddef>
+#include <memory>
 #include <vector>
 
+namespace emu::ay {
+class Ay38912;
+}
+
 namespace emu::applications::zxspectrum_48k {
 
+using emu::audio::BlepSynthesizer;
+using emu::ay::Ay38912;
+
+/**
+ * The sound of the beeper and, on the 128K, the AY-3-8912. The beeper edges are timestamped with
+ * the T-state they happen at, and are turned into samples once per frame together with the sound
+ * chip, so the sound is as exact as the timing of the OUTs, without sampling the port every cycle.
+ */
 class Audio {
 public:
-    Audio();
+    static constexpr int s_sdl_frequency = 44100;
+    static constexpr int s_fps = 50;
+    static constexpr cyc s_t_states_per_sound_chip_cycle = 2;
+
+    /**
+     * @param t_states_per_frame is the length of a frame, which gives the clock of the beeper
+     * @param sound_chip is the AY-3-8912 of the 128K, or nullptr on the 48K
+     */
+    Audio(cyc t_states_per_frame, std::shared_ptr<Ay38912> sound_chip);
 
     ~Audio();
 
-    void beep();
+    /**
+     * Called on every OUT to the ULA. Only the changes of the EAR and MIC bits are kept.
+     *
+     * @param is_ear_on is the EAR bit, which drives the speaker
+     * @param is_mic_on is the MIC bit, which is heard faintly through the speaker
+     * @param t_state is when the OUT happens, in T-states since the start of the frame
+     */
+    void beep(bool is_ear_on, bool is_mic_on, cyc t_state);
+
+    /**
+     * Renders the sound of the frame that just ran, and queues it for playing.
+     *
+     * @param t_states is the length of the frame, in T-states
+     */
+    void render_frame(cyc t_states);
 
     void toggle_mute();
 
 private:
-    static constexpr int s_sdl_frequency = 44100;
-    static constexpr int s_fps = 50;
-
-    unsigned int m_volume = 5000;
+    static constexpr float s_ear_level = 8000;
+    static constexpr float s_mic_level = 800;
+    static constexpr u32 s_max_queued_bytes = 4 * (s_sdl_frequency / s_fps) * sizeof(i16); // Drops frames rather than lag behind
 
     SDL_AudioDeviceID m_audio_device;
+    std::shared_ptr<Ay38912> m_sound_chip;
+    std::vector<i16> m_samples;
+    std::vector<i16> m_sound_chip_samples;
 
-    bool m_is_muted { false };
-
-    void generate_audio(u8* stream, int len);
+    struct BeeperEdge {
+        cyc m_t_state;
+        float m_level;
+    };
 
-    void play(std::vector<double> sound, int samples, i16* stream16, std::size_t& x, bool& is_sound_on) const;
+    BlepSynthesizer m_beeper;
+    std::vector<BeeperEdge> m_beeper_edges;
+    float m_beeper_level { 0 };          // The level after the last edge
+    float m_rendered_beeper_level { 0 }; // The level after the last edge that has been rendered
 
-    static void forward_callback(void* userdata, u8* stream, int len)
-    {
-        static_cast<Audio*>(userdata)->generate_audio(stream, len);
-    }
+    bool m_is_muted { false };
 };
 }
@@ -1,44 +1,196 @@
 #include "cpu_io.h"
-#include <iterator>
+#include "crosscutting/misc/state_stream.h"
+#include "crosscutting/util/byte_util.h"
+#include <cctype>
+#include <utility>
 
 namespace emu::applications::zxspectrum_48k {
 
+using emu::util::byte::high_byte;
+using emu::util::byte::is_bit_set;
+using emu::util::byte::set_bit;
+
 u8 CpuIo::border_color()
 {
     return m_out_port0xfe & s_border_color_mask;
 }
 
-void CpuIo::add_key_canceler(std::function<void()> const& cancel_func)
+void CpuIo::tap_key(std::size_t row, unsigned int bit)
 {
-    m_cancel_last_keypress.emplace_back(s_count_before_key_cancel, cancel_func);
+    set_bit(m_tapped_keys[row], bit);
+    m_reads_before_release = s_reads_before_release;
+}
+
+void CpuIo::tap_character(char character, bool is_shift_pressed)
+{
+    const char lower_case_character = static_cast<char>(std::tolower(static_cast<unsigned char>(character)));
+
+    for (std::size_t row = 0; row < s_key_characters.size(); ++row) {
+        for (std::size_t column = 0; column < s_key_characters[row].size(); ++column) {
+            const auto bit = static_cast<unsigned int>(column);
+
+            if (s_key_characters[row][column] == lower_case_character) {
+                if (is_shift_pressed) {
+                    set_bit(m_released_keys[s_shift_row], s_shift_bit);
+                }
+                if (std::isupper(static_cast<unsigned char>(character))) {
+                    tap_key(s_shift_row, s_shift_bit);
+                }
+                tap_key(row, bit);
+                return;
+            }
+
+            if (s_symbol_shifted_key_characters[row][column] == character) {
+                if (is_shift_pressed) {
+                    set_bit(m_released_keys[s_shift_row], s_shift_bit);
+                }
+                tap_key(s_symbol_shift_row, s_symbol_shift_bit);
+                tap_key(row, bit);
+                return;
+            }
+        }
+    }
+}
+
+void CpuIo::release_tapped_keys()
+{
+    m_tapped_keys.fill(0);
+    m_released_keys.fill(0);
+    m_reads_before_release = 0;
+}
+
+/**
+ * Only the characters the Spectrum has are typed, and new lines are typed as ENTER. The keywords
+ * are typed as their tokens, except inside strings and REM statements, since the 48K editor doesn't
+ * turn what is typed into keywords the way the 128K editor does.
+ */
+void CpuIo::type_text(std::string_view text)
+{
+    bool is_in_string = false;
+    bool is_in_rem = false;
+
+    for (std::size_t position = 0; position < text.size();) {
+        const char character = text[position];
+
+        if (character == '\n') {
+            m_typed_text.push_back(s_code_enter);
+            is_in_string = false;
+            is_in_rem = false;
+            ++position;
+            continue;
+        }
+
+        if (!is_in_string && !is_in_rem) {
+            if (auto const [token, length] = keyword_at(text, position); length > 0) {
+                m_typed_text.push_back(token);
+                is_in_rem = token == s_token_rem;
+                position += length;
+                continue;
+            }
+        }
+
+        if (character == '"') {
+            is_in_string = !is_in_string;
+        }
+
+        if (character == '\t') {
+            m_typed_text.push_back(' ');
+        } else if (character == '`') {
+            m_typed_text.push_back(s_code_pound);
+        } else if (' ' <= character && character <= '~') {
+            m_typed_text.push_back(static_cast<u8>(character));
+        }
+        ++position;
+    }
+}
+
+bool CpuIo::is_typing_text() const
+{
+    return !m_typed_text.empty();
+}
+
+void CpuIo::stop_typing_text()
+{
+    m_typed_text.clear();
+}
+
+u8 CpuIo::next_typed_character()
+{
+    const u8 character = m_typed_text.front();
+    m_typed_text.pop_front();
+
+    return character;
 }
 
 u8 CpuIo::keyboard_input(u16 port)
 {
-    const u8 value = m_keyboard.at(port);
+    const u8 value = std::as_const(*this).keyboard_input(port);
 
-    reset_key_presses();
+    if (m_reads_before_release > 0 && --m_reads_before_release == 0) {
+        release_tapped_keys();
+    }
 
     return value;
 }
 
 u8 CpuIo::keyboard_input(u16 port) const
 {
-    return m_keyboard.at(port);
+    const u8 selected_rows = high_byte(port);
+
+    u8 value = 0xff;
+    for (std::size_t row = 0; row < m_keyboard.size(); ++row) {
+        if (!is_bit_set(selected_rows, static_cast<unsigned int>(row))) {
+            value &= keyboard_row(row);
+        }
+    }
+
+    return value;
+}
+
+void CpuIo::save_input_state(StateWriter& writer) const
+{
+    for (std::size_t row = 0; row < m_keyboard.size(); ++row) {
+        writer.write(keyboard_row(row));
+    }
+}
+
+void CpuIo::load_input_state(StateReader& reader)
+{
+    for (u8& keys : m_keyboard) {
+        keys = reader.read<u8>();
+    }
+    release_tapped_keys();
+}
+
+u8 CpuIo::keyboard_row(std::size_t row) const
+{
+    return static_cast<u8>((m_keyboard[row] | m_released_keys[row]) & ~m_tapped_keys[row]);
 }
 
-void CpuIo::reset_key_presses()
+std::pair<u8, std::size_t> CpuIo::keyword_at(std::string_view text, std::size_t position)
 {
-    auto to_cancel = std::begin(m_cancel_last_keypress);
+    auto const is_part_of_name = [](char character) {
+        return std::isalnum(static_cast<unsigned char>(character)) != 0 || character == '$';
+    };
+
+    if (position > 0 && is_part_of_name(text[position - 1]) && is_part_of_name(text[position])) {
+        return { 0, 0 };
+    }
 
-    while (to_cancel != std::end(m_cancel_last_keypress)) {
-        if (to_cancel->first == 0) {
-            to_cancel->second();
-            to_cancel = m_cancel_last_keypress.erase(to_cancel);
-        } else {
-            to_cancel->first--;
-            ++to_cancel;
+    std::pair<u8, std::size_t> longest = { 0, 0 };
+    for (std::size_t i = 0; i < s_keywords.size(); ++i) {
+        const std::string_view keyword = s_keywords[i];
+        if (!text.substr(position).starts_with(keyword) || keyword.size() <= longest.second) {
+            continue;
+        }
+
+        const std::size_t end = position + keyword.size();
+        const bool is_name_going_on = end < text.size() && is_part_of_name(keyword.back()) && is_part_of_name(text[end]);
+        if (!is_name_going_on) {
+            longest = { static_cast<u8>(s_code_first_token + i), keyword.size() };
         }
     }
+
+    return longest;
 }
 }
@@ -1,43 +1,176 @@
 #pragma once
 
 #include "crosscutting/typedefs.h"
-#include <functional>
-#include <unordered_map>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <deque>
+#include <string_view>
 #include <utility>
-#include <vector>
+
+namespace emu::misc {
+class StateReader;
+class StateWriter;
+}
 
 namespace emu::applications::zxspectrum_48k {
 
+using emu::misc::StateReader;
+using emu::misc::StateWriter;
+
 class CpuIo {
 public:
     u8 m_out_port0xfe { 0x00 };
 
-    std::unordered_map<u16, u8> m_keyboard = {
-        { 0xfefe, 0xff }, // SHIFT, Z, X, C, V
-        { 0xfdfe, 0xff }, // A, S, D, F, G
-        { 0xfbfe, 0xff }, // Q, W, E, R, T
-        { 0xf7fe, 0xff }, // 1, 2, 3, 4, 5
-        { 0xeffe, 0xff }, // 0, 9, 8, 7, 6
-        { 0xdffe, 0xff }, // P, O, I, U, Y
-        { 0xbffe, 0xff }, // ENTER, L, K, J, H
-        { 0x7ffe, 0xff }  // SPACE, SYM, M, N, B
+    /**
+     * The keyboard matrix, one half-row of five keys per element, where a reset bit is a pressed key.
+     * The half-rows are in the order of the address lines that select them, see row().
+     */
+    std::array<u8, 8> m_keyboard = {
+        0xff, // SHIFT, Z, X, C, V
+        0xff, // A, S, D, F, G
+        0xff, // Q, W, E, R, T
+        0xff, // 1, 2, 3, 4, 5
+        0xff, // 0, 9, 8, 7, 6
+        0xff, // P, O, I, U, Y
+        0xff, // ENTER, L, K, J, H
+        0xff  // SPACE, SYM, M, N, B
     };
 
-    std::vector<std::pair<unsigned int, std::function<void()>>> m_cancel_last_keypress;
+    /**
+     * @param port is the port that reads a single half-row, like 0xfefe
+     * @return the index of the half-row in the keyboard matrix
+     */
+    static constexpr std::size_t row(u16 port)
+    {
+        return static_cast<std::size_t>(std::countr_one(static_cast<u8>(port >> 8)));
+    }
 
     u8 border_color();
 
-    void add_key_canceler(std::function<void()> const& cancel_func);
+    /**
+     * Presses a key for the next few keyboard reads, which is long enough for the ROM to see it.
+     *
+     * @param row is the half-row of the key
+     * @param bit is the bit of the key in the half-row
+     */
+    void tap_key(std::size_t row, unsigned int bit);
+
+    /**
+     * Presses the keys that type the character for the next few keyboard reads, with SYMBOL SHIFT
+     * for the symbols and SHIFT for the capital letters.
+     *
+     * @param character is the character to type
+     * @param is_shift_pressed is true if SHIFT is held, which is then released while the character is typed
+     */
+    void tap_character(char character, bool is_shift_pressed);
+
+    void release_tapped_keys();
+
+    /**
+     * Queues text to be typed into the BASIC editor, where the keywords are turned into their tokens
+     * like the 48K wants them. Unlike tap_character(), the text is not typed on the keyboard but
+     * handed to the ROM a character at a time, as fast as the editor takes them.
+     *
+     * @param text is the text to type, typically a BASIC listing
+     */
+    void type_text(std::string_view text);
+
+    [[nodiscard]] bool is_typing_text() const;
+
+    void stop_typing_text();
+
+    /**
+     * @return the character code of the next character of the typed text, which is removed from the queue
+     */
+    u8 next_typed_character();
 
     u8 keyboard_input(u16 port);
 
-    u8 keyboard_input(u16 port) const;
+    /**
+     * Every bit of the high byte of the port that is reset selects a half-row, and the half-rows that
+     * are selected are read together. Loaders often read the port with all the half-rows selected.
+     *
+     * @param port is the port that is read
+     * @return the keys that are pressed in the selected half-rows
+     */
+    [[nodiscard]] u8 keyboard_input(u16 port) const;
+
+    /**
+     * Saves the keyboard rows, which is what is recorded when recording the input of a session.
+     *
+     * @param writer is the state to save to
+     */
+    void save_input_state(StateWriter& writer) const;
+
+    void load_input_state(StateReader& reader);
 
 private:
     static constexpr u8 s_border_color_mask = 0b00000111;
 
-    static constexpr unsigned int s_count_before_key_cancel = 10;
+    static constexpr unsigned int s_reads_before_release = 10;
+
+    static constexpr std::size_t s_shift_row = 0;
+    static constexpr unsigned int s_shift_bit = 0;
+    static constexpr std::size_t s_symbol_shift_row = 7;
+    static constexpr unsigned int s_symbol_shift_bit = 1;
+
+    static constexpr u8 s_code_enter = 0x0d;
+    static constexpr u8 s_code_pound = 0x60;
+    static constexpr u8 s_code_first_token = 0xa5;
+
+    /*
+     * The characters of the keys, and of the keys together with SYMBOL SHIFT, in the same order as the
+     * keyboard matrix. The shift keys, and the keys that only give a keyword, are \0.
+     */
+    static constexpr std::array<std::array<char, 5>, 8> s_key_characters = { {
+        { '\0', 'z', 'x', 'c', 'v' },
+        { 'a', 's', 'd', 'f', 'g' },
+        { 'q', 'w', 'e', 'r', 't' },
+        { '1', '2', '3', '4', '5' },
+        { '0', '9', '8', '7', '6' },
+        { 'p', 'o', 'i', 'u', 'y' },
+        { '\n', 'l', 'k', 'j', 'h' },
+        { ' ', '\0', 'm', 'n', 'b' },
+    } };
+    static constexpr std::array<std::array<char, 5>, 8> s_symbol_shifted_key_characters = { {
+        { '\0', ':', '\0', '?', '/' },
+        { '~', '|', '\\', '{', '}' },
+        { '\0', '\0', '\0', '<', '>' },
+        { '!', '@', '#', '$', '%' },
+        { '_', ')', '(', '\'', '&' },
+        { '"', ';', '\0', ']', '[' },
+        { '\0', '=', '+', '-', '^' },
+        { '\0', '\0', '.', ',', '*' },
+    } };
+
+    /*
+     * The keywords of the 48K, where the first one is token 0xa5.
+     */
+    static constexpr std::array<std::string_view, 91> s_keywords = {
+        "RND", "INKEY$", "PI", "FN", "POINT", "SCREEN$", "ATTR", "AT", "TAB", "VAL$", "CODE",
+        "VAL", "LEN", "SIN", "COS", "TAN", "ASN", "ACS", "ATN", "LN", "EXP", "INT", "SQR", "SGN",
+        "ABS", "PEEK", "IN", "USR", "STR$", "CHR$", "NOT", "BIN", "OR", "AND", "<=", ">=", "<>",
+        "LINE", "THEN", "TO", "STEP", "DEF FN", "CAT", "FORMAT", "MOVE", "ERASE", "OPEN #",
+        "CLOSE #", "MERGE", "VERIFY", "BEEP", "CIRCLE", "INK", "PAPER", "FLASH", "BRIGHT",
+        "INVERSE", "OVER", "OUT", "LPRINT", "LLIST", "STOP", "READ", "DATA", "RESTORE", "NEW",
+        "BORDER", "CONTINUE", "DIM", "REM", "FOR", "GO TO", "GO SUB", "INPUT", "LOAD", "LIST",
+        "LET", "PAUSE", "NEXT", "POKE", "PRINT", "PLOT", "RUN", "SAVE", "RANDOMIZE", "IF", "CLS",
+        "DRAW", "CLEAR", "RETURN", "COPY"
+    };
+    static constexpr u8 s_token_rem = 0xea;
+
+    std::array<u8, 8> m_tapped_keys {};   // A set bit is a key that is pressed, unlike in m_keyboard
+    std::array<u8, 8> m_released_keys {}; // A set bit is a key that is released even though it is held
+    unsigned int m_reads_before_release { 0 };
+
+    std::deque<u8> m_typed_text;
+
+    [[nodiscard]] u8 keyboard_row(std::size_t row) const;
 
-    void reset_key_presses();
+    /**
+     * @return the token of the keyword at the position in the text, and the length of the keyword, or zero if there is none
+     */
+    static std::pair<u8, std::size_t> keyword_at(std::string_view text, std::size_t position);
 };
 }
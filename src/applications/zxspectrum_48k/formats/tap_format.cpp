@@ -0,0 +1,36 @@
+#include "tap_format.h"
+#include "crosscutting/util/byte_util.h"
+#include "crosscutting/util/file_util.h"
+#include <fmt/core.h>
+#include <stdexcept>
+#include <utility>
+
+namespace emu::applications::zxspectrum_48k {
+
+using emu::util::byte::to_u16;
+using emu::util::file::read_file_into_vector;
+
+TapFormat::TapFormat(std::string const& file_path)
+{
+    const std::vector<u8> raw_data = read_file_into_vector(file_path);
+
+    for (std::size_t position = 0; position + 2 <= raw_data.size();) {
+        const std::size_t length = to_u16(raw_data[position + 1], raw_data[position]);
+        position += 2;
+
+        if (position + length > raw_data.size()) {
+            throw std::invalid_argument(fmt::format("The block at {} goes past the end of {}", position - 2, file_path));
+        }
+
+        m_blocks.push_back(TapeBlock::standard(
+            std::vector<u8>(raw_data.begin() + static_cast<std::ptrdiff_t>(position), raw_data.begin() + static_cast<std::ptrdiff_t>(position + length)),
+            TapeBlock::s_standard_pause_ms));
+        position += length;
+    }
+}
+
+std::vector<TapeBlock> const& TapFormat::blocks() const
+{
+    return m_blocks;
+}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include "tape_block.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace emu::applications::zxspectrum_48k {
+
+/**
+ * The .tap format, which is the blocks the ROM saves, one after the other, each with its length in
+ * front. Every block is played with the timings of the ROM.
+ *
+ * Format description (https://sinclair.wiki.zxnet.co.uk/wiki/TAP_format):
+ *
+ *        Offset  Length  Description
+ *        ---------------------------
+ *        0       2       Length of the block, n
+ *        2       n       The flag byte, the bytes and the checksum of the block
+ */
+class TapFormat {
+public:
+    /**
+     * @param file_path is the path to the .tap file
+     * @throws std::invalid_argument if a block goes past the end of the file
+     */
+    explicit TapFormat(std::string const& file_path);
+
+    [[nodiscard]] std::vector<TapeBlock> const& blocks() const;
+
+private:
+    std::vector<TapeBlock> m_blocks;
+};
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <utility>
+#include <vector>
+
+namespace emu::applications::zxspectrum_48k {
+
+/**
+ * A block on a tape, as the pulses it's played as. Every kind of block in the tape formats is one of
+ * these, where the parts that a kind of block doesn't have are empty. A pure tone only has a pilot,
+ * a pulse sequence only has pulses, a pause only has a pause and so on.
+ *
+ * The pulse lengths are in T-states of the 48K.
+ */
+struct TapeBlock {
+    static constexpr u16 s_standard_pilot_pulse_length = 2168;
+    static constexpr u16 s_standard_pilot_pulses_header = 8063;
+    static constexpr u16 s_standard_pilot_pulses_data = 3223;
+    static constexpr u16 s_standard_sync1_pulse_length = 667;
+    static constexpr u16 s_standard_sync2_pulse_length = 735;
+    static constexpr u16 s_standard_zero_pulse_length = 855;
+    static constexpr u16 s_standard_one_pulse_length = 1710;
+    static constexpr u16 s_standard_pause_ms = 1000;
+    static constexpr u8 s_first_data_flag = 0x80; // Lower flags are headers, which have a longer pilot
+
+    u16 m_pilot_pulse_length { 0 };
+    u16 m_number_of_pilot_pulses { 0 };
+    std::vector<u16> m_pulses;
+    u16 m_zero_pulse_length { 0 };
+    u16 m_one_pulse_length { 0 };
+    u8 m_used_bits_in_last_byte { 8 };
+    std::vector<u8> m_data;
+    u16 m_pause_ms { 0 };
+    bool m_is_stopping_the_tape { false };
+    bool m_is_standard { false }; // Has the timings of the ROM, so it can be loaded by trapping the ROM
+
+    /**
+     * @param data is the flag byte, the bytes and the checksum of the block
+     * @param pause_ms is the pause after the block, in milliseconds
+     * @return a block that the ROM saves and loads
+     */
+    static TapeBlock standard(std::vector<u8> data, u16 pause_ms)
+    {
+        const bool is_header = !data.empty() && data[0] < s_first_data_flag;
+
+        return {
+            .m_pilot_pulse_length = s_standard_pilot_pulse_length,
+            .m_number_of_pilot_pulses = is_header ? s_standard_pilot_pulses_header : s_standard_pilot_pulses_data,
+            .m_pulses = { s_standard_sync1_pulse_length, s_standard_sync2_pulse_length },
+            .m_zero_pulse_length = s_standard_zero_pulse_length,
+            .m_one_pulse_length = s_standard_one_pulse_length,
+            .m_used_bits_in_last_byte = 8,
+            .m_data = std::move(data),
+            .m_pause_ms = pause_ms,
+            .m_is_stopping_the_tape = false,
+            .m_is_standard = true
+        };
+    }
+};
+}
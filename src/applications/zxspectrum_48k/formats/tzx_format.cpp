@@ -0,0 +1,195 @@
+#include "tzx_format.h"
+#include "crosscutting/exceptions/unsupported_exception.h"
+#include "crosscutting/util/byte_util.h"
+#include "crosscutting/util/file_util.h"
+#include "crosscutting/util/string_util.h"
+#include <fmt/core.h>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace emu::applications::zxspectrum_48k {
+
+using emu::exceptions::UnsupportedException;
+using emu::util::byte::to_u16;
+using emu::util::file::read_file_into_vector;
+using emu::util::string::hexify;
+
+TzxFormat::TzxFormat(std::string const& file_path)
+    : m_file_path(file_path)
+    , m_raw_data(read_file_into_vector(file_path))
+{
+    constexpr std::string_view signature = "ZXTape!";
+
+    if (m_raw_data.size() < s_header_size
+        || std::string_view(reinterpret_cast<char const*>(m_raw_data.data()), signature.size()) != signature
+        || m_raw_data[signature.size()] != s_end_of_text_marker) {
+        throw std::invalid_argument(fmt::format("{} is not a .tzx file", file_path));
+    }
+
+    m_byte_counter = s_header_size;
+
+    std::size_t loop_start = 0;
+    u16 loop_repetitions = 0;
+    while (m_byte_counter < m_raw_data.size()) {
+        parse_block(get_next_byte(), loop_start, loop_repetitions);
+    }
+}
+
+std::vector<TapeBlock> const& TzxFormat::blocks() const
+{
+    return m_blocks;
+}
+
+void TzxFormat::parse_block(u8 id, std::size_t& loop_start, u16& loop_repetitions)
+{
+    switch (id) {
+    case s_id_standard_speed_data: {
+        const u16 pause_ms = get_next_word();
+        m_blocks.push_back(TapeBlock::standard(get_next_bytes(get_next_word()), pause_ms));
+        break;
+    }
+    case s_id_turbo_speed_data: {
+        TapeBlock block;
+        block.m_pilot_pulse_length = get_next_word();
+        const u16 sync1_pulse_length = get_next_word();
+        const u16 sync2_pulse_length = get_next_word();
+        block.m_pulses = { sync1_pulse_length, sync2_pulse_length };
+        block.m_zero_pulse_length = get_next_word();
+        block.m_one_pulse_length = get_next_word();
+        block.m_number_of_pilot_pulses = get_next_word();
+        block.m_used_bits_in_last_byte = get_next_byte();
+        block.m_pause_ms = get_next_word();
+        block.m_data = get_next_bytes(get_next_u24());
+        m_blocks.push_back(std::move(block));
+        break;
+    }
+    case s_id_pure_tone: {
+        TapeBlock block;
+        block.m_pilot_pulse_length = get_next_word();
+        block.m_number_of_pilot_pulses = get_next_word();
+        m_blocks.push_back(std::move(block));
+        break;
+    }
+    case s_id_pulse_sequence: {
+        TapeBlock block;
+        const u8 number_of_pulses = get_next_byte();
+        for (u8 i = 0; i < number_of_pulses; ++i) {
+            block.m_pulses.push_back(get_next_word());
+        }
+        m_blocks.push_back(std::move(block));
+        break;
+    }
+    case s_id_pure_data: {
+        TapeBlock block;
+        block.m_zero_pulse_length = get_next_word();
+        block.m_one_pulse_length = get_next_word();
+        block.m_used_bits_in_last_byte = get_next_byte();
+        block.m_pause_ms = get_next_word();
+        block.m_data = get_next_bytes(get_next_u24());
+        m_blocks.push_back(std::move(block));
+        break;
+    }
+    case s_id_pause: {
+        TapeBlock block;
+        block.m_pause_ms = get_next_word();
+        block.m_is_stopping_the_tape = block.m_pause_ms == 0;
+        m_blocks.push_back(std::move(block));
+        break;
+    }
+    case s_id_stop_the_tape_if_48k: {
+        skip(get_next_u32());
+        TapeBlock block;
+        block.m_is_stopping_the_tape = true;
+        m_blocks.push_back(std::move(block));
+        break;
+    }
+    case s_id_loop_start:
+        loop_start = m_blocks.size();
+        loop_repetitions = get_next_word();
+        break;
+    case s_id_loop_end: {
+        const std::vector<TapeBlock> loop(m_blocks.begin() + static_cast<std::ptrdiff_t>(loop_start), m_blocks.end());
+        for (u16 repetition = 1; repetition < loop_repetitions; ++repetition) {
+            m_blocks.insert(m_blocks.end(), loop.begin(), loop.end());
+        }
+        break;
+    }
+    case s_id_group_start:
+    case s_id_text_description:
+        skip(get_next_byte());
+        break;
+    case s_id_group_end:
+        break;
+    case s_id_message:
+        get_next_byte(); // The time to show the message for
+        skip(get_next_byte());
+        break;
+    case s_id_archive_info:
+        skip(get_next_word());
+        break;
+    case s_id_hardware_type:
+        skip(3 * static_cast<std::size_t>(get_next_byte()));
+        break;
+    case s_id_custom_info:
+        skip(16); // The identification string
+        skip(get_next_u32());
+        break;
+    case s_id_set_signal_level:
+        skip(get_next_u32());
+        break;
+    case s_id_glue:
+        skip(9);
+        break;
+    default:
+        throw UnsupportedException(fmt::format("TZX block {} in {}", hexify(id), m_file_path));
+    }
+}
+
+std::vector<u8> TzxFormat::get_next_bytes(std::size_t length)
+{
+    if (m_byte_counter + length > m_raw_data.size()) {
+        throw std::invalid_argument(fmt::format("A block goes past the end of {}", m_file_path));
+    }
+
+    const auto first = m_raw_data.begin() + static_cast<std::ptrdiff_t>(m_byte_counter);
+    m_byte_counter += length;
+
+    return { first, first + static_cast<std::ptrdiff_t>(length) };
+}
+
+u8 TzxFormat::get_next_byte()
+{
+    if (m_byte_counter >= m_raw_data.size()) {
+        throw std::invalid_argument(fmt::format("A block goes past the end of {}", m_file_path));
+    }
+
+    return m_raw_data[m_byte_counter++];
+}
+
+u16 TzxFormat::get_next_word()
+{
+    const u8 low = get_next_byte();
+
+    return to_u16(get_next_byte(), low);
+}
+
+std::size_t TzxFormat::get_next_u24()
+{
+    const std::size_t low = get_next_word();
+
+    return low | (static_cast<std::size_t>(get_next_byte()) << 16);
+}
+
+std::size_t TzxFormat::get_next_u32()
+{
+    const std::size_t low = get_next_word();
+
+    return low | (static_cast<std::size_t>(get_next_word()) << 16);
+}
+
+void TzxFormat::skip(std::size_t length)
+{
+    get_next_bytes(length);
+}
+}
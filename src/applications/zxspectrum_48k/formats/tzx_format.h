@@ -0,0 +1,82 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include "tape_block.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace emu::applications::zxspectrum_48k {
+
+/**
+ * The .tzx format, which describes a tape as pulses, so that turbo and custom loaders can be
+ * stored as well as the blocks the ROM saves.
+ *
+ * Format description (https://worldofspectrum.net/TZXformat.html):
+ *
+ *        Offset  Length  Description
+ *        ---------------------------
+ *        0       7       "ZXTape!"
+ *        7       1       0x1a
+ *        8       1       Major version number
+ *        9       1       Minor version number
+ *        10      -       The blocks, each starting with its ID
+ *
+ * The blocks with the pulses are kept, the loops are unrolled and the blocks that only have
+ * information for the user are skipped.
+ */
+class TzxFormat {
+public:
+    /**
+     * @param file_path is the path to the .tzx file
+     * @throws std::invalid_argument if the file isn't a .tzx file, or a block goes past the end of the file
+     * @throws UnsupportedException if the file has a kind of block that isn't supported
+     */
+    explicit TzxFormat(std::string const& file_path);
+
+    [[nodiscard]] std::vector<TapeBlock> const& blocks() const;
+
+private:
+    static constexpr std::size_t s_header_size = 10;
+    static constexpr u8 s_end_of_text_marker = 0x1a;
+
+    static constexpr u8 s_id_standard_speed_data = 0x10;
+    static constexpr u8 s_id_turbo_speed_data = 0x11;
+    static constexpr u8 s_id_pure_tone = 0x12;
+    static constexpr u8 s_id_pulse_sequence = 0x13;
+    static constexpr u8 s_id_pure_data = 0x14;
+    static constexpr u8 s_id_pause = 0x20;
+    static constexpr u8 s_id_group_start = 0x21;
+    static constexpr u8 s_id_group_end = 0x22;
+    static constexpr u8 s_id_loop_start = 0x24;
+    static constexpr u8 s_id_loop_end = 0x25;
+    static constexpr u8 s_id_stop_the_tape_if_48k = 0x2a;
+    static constexpr u8 s_id_set_signal_level = 0x2b;
+    static constexpr u8 s_id_text_description = 0x30;
+    static constexpr u8 s_id_message = 0x31;
+    static constexpr u8 s_id_archive_info = 0x32;
+    static constexpr u8 s_id_hardware_type = 0x33;
+    static constexpr u8 s_id_custom_info = 0x35;
+    static constexpr u8 s_id_glue = 0x5a;
+
+    std::string m_file_path;
+    std::vector<u8> m_raw_data;
+    std::size_t m_byte_counter { 0 };
+
+    std::vector<TapeBlock> m_blocks;
+
+    void parse_block(u8 id, std::size_t& loop_start, u16& loop_repetitions);
+
+    std::vector<u8> get_next_bytes(std::size_t length);
+
+    u8 get_next_byte();
+
+    u16 get_next_word();
+
+    std::size_t get_next_u24();
+
+    std::size_t get_next_u32();
+
+    void skip(std::size_t length);
+};
+}
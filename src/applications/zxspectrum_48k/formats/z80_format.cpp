@@ -1,6 +1,9 @@
 #include "z80_format.h"
 #include "applications/zxspectrum_48k/interfaces/format.h"
 #include "applications/zxspectrum_48k/joystick_type.h"
+#include "applications/zxspectrum_48k/memory_map_for_zxspectrum_128k.h"
+#include "applications/zxspectrum_48k/model.h"
+#include "chips/ay_3_8912/ay_3_8912.h"
 #include "chips/z80/flags.h"
 #include "chips/z80/interrupt_mode.h"
 #include "chips/z80/manual_state.h"
@@ -12,6 +15,7 @@
 #include "crosscutting/util/file_util.h"
 #include "crosscutting/util/string_util.h"
 #include <fmt/core.h>
+#include <algorithm>
 #include <iostream>
 #include <stdexcept>
 #include <string>
@@ -180,6 +184,21 @@ void Z80Format::print_header()
     }
 }
 
+Model Z80Format::model() const
+{
+    if (m_version == Z80FormatVersion::v1) {
+        return Model::_48k;
+    }
+
+    switch (m_hardware_mode) {
+    case HardwareMode::_128k:
+    case HardwareMode::_128k_If1:
+        return Model::_128k;
+    default:
+        return Model::_48k;
+    }
+}
+
 ManualState Z80Format::to_cpu_state()
 {
     return {
@@ -222,6 +241,29 @@ void Z80Format::to_memory(EmulatorMemory<u16, u8>& memory)
     }
 }
 
+void Z80Format::to_memory(MemoryMapForZxSpectrum128k& memory_map)
+{
+    if (model() != Model::_128k) {
+        throw std::invalid_argument("Only 128k snapshots can be put into the memory of a 128k");
+    }
+
+    while (m_byte_counter < m_raw_data.size()) {
+        read_block_v2(memory_map);
+    }
+
+    memory_map.page(m_byte_35);
+}
+
+void Z80Format::to_sound_chip(Ay38912& sound_chip)
+{
+    for (std::size_t i = 0; i < m_sound_chip_registers.size(); ++i) {
+        sound_chip.select_register(static_cast<u8>(i));
+        sound_chip.write_register(m_sound_chip_registers[i], 0);
+    }
+
+    sound_chip.select_register(m_last_out_0xfffd);
+}
+
 void Z80Format::read_block_v1(EmulatorMemory<u16, u8>& memory)
 {
     std::vector<u8> output;
@@ -268,12 +310,7 @@ void Z80Format::read_block_v1(EmulatorMemory<u16, u8>& memory)
 void Z80Format::read_block_v2(EmulatorMemory<u16, u8>& memory)
 {
     std::vector<u8> output;
-
-    //    std::cout << "Reading a block with:\n";
-    const u16 length_of_compressed_data = get_next_word();
-    const u8 page_number = get_next_byte();
-    //    std::cout << "\tLength: " << hexify(length_of_compressed_data) << "\n";
-    //    std::cout << "\tPage number: " << hexify(page_number) << "\n\n";
+    const u8 page_number = decompress_block_v2(output);
 
     u16 offset;
     switch (page_number) {
@@ -290,6 +327,34 @@ void Z80Format::read_block_v2(EmulatorMemory<u16, u8>& memory)
         throw std::invalid_argument("Page has to be 4, 5 or 8.");
     }
 
+    for (std::size_t j = offset, k = 0; k < output.size(); ++j, ++k) {
+        memory.write(j, output[k]);
+    }
+}
+
+/**
+ * Pages 3-10 are RAM banks 0-7 in 128k snapshots.
+ */
+void Z80Format::read_block_v2(MemoryMapForZxSpectrum128k& memory_map)
+{
+    std::vector<u8> output;
+    const u8 page_number = decompress_block_v2(output);
+
+    if (page_number < s_first_128k_ram_page || page_number > s_last_128k_ram_page) {
+        throw std::invalid_argument(fmt::format("Page has to be between {} and {} in 128k snapshots.", s_first_128k_ram_page, s_last_128k_ram_page));
+    }
+
+    std::ranges::copy(output, memory_map.ram_bank(page_number - s_first_128k_ram_page).begin());
+}
+
+u8 Z80Format::decompress_block_v2(std::vector<u8>& output)
+{
+    //    std::cout << "Reading a block with:\n";
+    const u16 length_of_compressed_data = get_next_word();
+    const u8 page_number = get_next_byte();
+    //    std::cout << "\tLength: " << hexify(length_of_compressed_data) << "\n";
+    //    std::cout << "\tPage number: " << hexify(page_number) << "\n\n";
+
     // We disregard the compression bool in the v1 header when using v2 block parsing.
     bool is_compressed = length_of_compressed_data != 0xffff;
 
@@ -310,16 +375,14 @@ void Z80Format::read_block_v2(EmulatorMemory<u16, u8>& memory)
         }
     }
 
-    if (output.size() != 0x4000) {
+    if (output.size() != s_page_size) {
         throw std::invalid_argument(
             fmt::format(
                 "Output size is wrong when reading z80 format. Was {} but should be 0x4000",
                 hexify(static_cast<u16>(output.size()))));
     }
 
-    for (std::size_t j = offset, k = 0; k < output.size(); ++j, ++k) {
-        memory.write(j, output[k]);
-    }
+    return page_number;
 }
 
 void Z80Format::parse()
@@ -409,11 +472,14 @@ void Z80Format::parse_v2()
     m_pc = get_next_word();
     m_hardware_mode = parse_hardware_mode(get_next_byte());
 
-    if (m_hardware_mode != HardwareMode::_48k && m_hardware_mode != HardwareMode::_48k_If1) {
+    if (m_hardware_mode != HardwareMode::_48k && m_hardware_mode != HardwareMode::_48k_If1
+        && m_hardware_mode != HardwareMode::_128k && m_hardware_mode != HardwareMode::_128k_If1) {
         throw UnsupportedException(
-            fmt::format("Only hardware modes {} and {} are supported, but {} was provided",
+            fmt::format("Only hardware modes {}, {}, {} and {} are supported, but {} was provided",
                 s_hardware_mode_as_string.at(HardwareMode::_48k),
                 s_hardware_mode_as_string.at(HardwareMode::_48k_If1),
+                s_hardware_mode_as_string.at(HardwareMode::_128k),
+                s_hardware_mode_as_string.at(HardwareMode::_128k_If1),
                 s_hardware_mode_as_string.at(m_hardware_mode)));
     }
 
@@ -12,7 +12,9 @@
 #include <vector>
 
 namespace emu::applications::zxspectrum_48k {
+class MemoryMapForZxSpectrum128k;
 enum class JoystickType;
+enum class Model;
 }
 namespace emu::z80 {
 struct ManualState;
@@ -60,10 +62,16 @@ public:
 
     void print_header() override;
 
+    [[nodiscard]] Model model() const override;
+
     ManualState to_cpu_state() override;
 
     void to_memory(EmulatorMemory<u16, u8>& memory) override;
 
+    void to_memory(MemoryMapForZxSpectrum128k& memory_map) override;
+
+    void to_sound_chip(Ay38912& sound_chip) override;
+
 private:
     static constexpr std::size_t s_header_size_v1 = 30;
     static constexpr std::size_t s_header_size_additional_v2 = 23;
@@ -71,6 +79,9 @@ private:
     static constexpr std::size_t s_header_size_additional_v3_2 = 55;
     static constexpr std::size_t s_number_of_sound_registers = 16;
     static constexpr std::size_t s_number_of_keyboard_mappings = 5;
+    static constexpr std::size_t s_page_size = 0x4000;
+    static constexpr u8 s_first_128k_ram_page = 3;
+    static constexpr u8 s_last_128k_ram_page = 10;
 
     Z80FormatVersion m_version { Z80FormatVersion::Unknown };
 
@@ -227,6 +238,16 @@ private:
 
     void read_block_v2(EmulatorMemory<u16, u8>& memory);
 
+    void read_block_v2(MemoryMapForZxSpectrum128k& memory_map);
+
+    /**
+     * Reads the next block of memory, and decompresses it if it's compressed.
+     *
+     * @param output is where the 16 KB of the block are put
+     * @return the page number of the block
+     */
+    u8 decompress_block_v2(std::vector<u8>& output);
+
     void parse();
 
     void parse_v1();
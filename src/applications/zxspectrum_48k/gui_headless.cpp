@@ -0,0 +1,39 @@
+#include "gui_headless.h"
+#include "crosscutting/benchmarking/benchmark.h"
+#include "crosscutting/gui/gui_for_benchmark.h"
+#include "gui.h"
+#include <vector>
+
+namespace emu::applications::zxspectrum_48k {
+class CpuIo;
+class GuiObserver;
+}
+
+namespace emu::applications::zxspectrum_48k {
+
+using emu::benchmarking::pseudo_random_bytes;
+using emu::gui::GuiForBenchmark;
+
+void GuiHeadless::attach_cpu_io([[maybe_unused]] CpuIo const* cpu_io)
+{
+}
+
+void GuiHeadless::update_screen(
+    std::vector<u8> const& vram,
+    std::vector<u8> const& color_ram,
+    u8 border_color,
+    [[maybe_unused]] std::string const& game_window_subtitle)
+{
+    print_frame_hash(create_framebuffer(vram, color_ram, border_color));
+}
+
+BENCHMARK("ZX Spectrum 48K: Gui create_framebuffer")
+{
+    GuiForBenchmark<GuiHeadless> gui;
+    gui.create_table();
+    const std::vector<u8> vram = pseudo_random_bytes(0x1800);
+    const std::vector<u8> color_ram = pseudo_random_bytes(0x300);
+
+    gui.run_create_framebuffer(bench, vram, color_ram, 1);
+}
+}
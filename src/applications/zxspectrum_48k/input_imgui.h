@@ -3,7 +3,6 @@
 #include "interfaces/input.h"
 #include "key_request.h"
 #include <SDL_scancode.h>
-#include <string>
 #include <vector>
 
 namespace emu::applications::zxspectrum_48k {
@@ -28,7 +27,9 @@ public:
 
 private:
     static constexpr SDL_Scancode s_mute = SDL_SCANCODE_SCROLLLOCK;
+    static constexpr SDL_Scancode s_paste = SDL_SCANCODE_INSERT;
     static constexpr SDL_Scancode s_pause = SDL_SCANCODE_PAUSE;
+    static constexpr SDL_Scancode s_rewind = SDL_SCANCODE_PAGEDOWN;
     static constexpr SDL_Scancode s_step_instruction = SDL_SCANCODE_F7;
     static constexpr SDL_Scancode s_step_cycle = SDL_SCANCODE_F8;
     static constexpr SDL_Scancode s_continue_running = SDL_SCANCODE_F9;
@@ -84,9 +85,5 @@ private:
     std::vector<KeyObserver*> m_io_observers;
 
     void notify_io_observers(KeyRequest request);
-
-    void cancel_shift(CpuIo& cpu_io);
-
-    void handle_text(CpuIo& cpu_io, std::string text, bool is_shift_pressed);
 };
 }
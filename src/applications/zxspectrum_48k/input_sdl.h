@@ -3,8 +3,6 @@
 #include "interfaces/input.h"
 #include "key_request.h"
 #include <SDL_scancode.h>
-#include <functional>
-#include <string>
 #include <vector>
 
 namespace emu::applications::zxspectrum_48k {
@@ -29,7 +27,9 @@ public:
 
 private:
     static constexpr SDL_Scancode s_mute = SDL_SCANCODE_SCROLLLOCK;
+    static constexpr SDL_Scancode s_paste = SDL_SCANCODE_INSERT;
     static constexpr SDL_Scancode s_pause = SDL_SCANCODE_PAUSE;
+    static constexpr SDL_Scancode s_rewind = SDL_SCANCODE_PAGEDOWN;
 
     static constexpr unsigned int s_SHIFT_bit = 0;
     static constexpr unsigned int s_Z_bit = 1;
@@ -81,12 +81,6 @@ private:
 
     std::vector<KeyObserver*> m_io_observers;
 
-    std::vector<std::function<void()>> m_cancel_last_keypress;
-
     void notify_io_observers(KeyRequest request);
-
-    void cancel_shift(CpuIo& cpu_io);
-
-    void handle_text(CpuIo& cpu_io, std::string text, bool is_shift_pressed);
 };
 }
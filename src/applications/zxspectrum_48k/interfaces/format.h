@@ -3,8 +3,17 @@
 #include "chips/z80/manual_state.h"
 #include "crosscutting/memory/emulator_memory.h"
 
+namespace emu::ay {
+class Ay38912;
+}
+namespace emu::applications::zxspectrum_48k {
+class MemoryMapForZxSpectrum128k;
+enum class Model;
+}
+
 namespace emu::applications::zxspectrum_48k {
 
+using emu::ay::Ay38912;
 using emu::memory::EmulatorMemory;
 using emu::z80::ManualState;
 
@@ -14,8 +23,27 @@ public:
 
     virtual void print_header() = 0;
 
+    /**
+     * @return the model the snapshot was taken on
+     */
+    [[nodiscard]] virtual Model model() const = 0;
+
     virtual ManualState to_cpu_state() = 0;
 
     virtual void to_memory(EmulatorMemory<u16, u8>& memory) = 0;
+
+    /**
+     * Puts the RAM banks of a 128K snapshot into the banks, and pages them the way they were paged.
+     *
+     * @param memory_map is the memory of the 128K
+     */
+    virtual void to_memory(MemoryMapForZxSpectrum128k& memory_map) = 0;
+
+    /**
+     * Puts the registers of the sound chip into the sound chip, if the snapshot has them.
+     *
+     * @param sound_chip is the AY-3-8912 of the 128K
+     */
+    virtual void to_sound_chip(Ay38912& sound_chip) = 0;
 };
 }
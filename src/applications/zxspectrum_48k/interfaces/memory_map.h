@@ -0,0 +1,74 @@
+#pragma once
+
+#include "crosscutting/memory/memory_mapped_io.h"
+#include "crosscutting/typedefs.h"
+#include <cstddef>
+#include <memory>
+#include <span>
+
+namespace emu::memory {
+class DirtyRanges;
+}
+namespace emu::misc {
+class StateReader;
+class StateWriter;
+}
+
+namespace emu::applications::zxspectrum_48k {
+
+using emu::memory::DirtyRanges;
+using emu::memory::MemoryMappedIo;
+using emu::misc::StateReader;
+using emu::misc::StateWriter;
+
+/**
+ * What the CPU sees at $0000-$ffff. The 48K has the same memory there all the time, while the 128K
+ * pages its RAM banks and ROMs in and out through a port.
+ */
+class MemoryMap : public MemoryMappedIo<u16, u8> {
+public:
+    static constexpr std::size_t s_screen_size = 0x1b00;
+    static constexpr std::size_t s_pixels_size = 0x1800;
+
+    /**
+     * @return the screen the ULA draws, which is the pixels followed by the attributes
+     */
+    [[nodiscard]] virtual std::span<u8 const> screen() const = 0;
+
+    /**
+     * Reads without the ULA seeing it, so the debugger can look at the memory without affecting the timing.
+     *
+     * @param address is the address to read from
+     * @return the value the CPU would read at the address
+     */
+    [[nodiscard]] virtual u8 peek(u16 address) const = 0;
+
+    /**
+     * Copies what the CPU sees at $0000-$ffff, without the ULA seeing it, for the debugger.
+     *
+     * @param memory is where the memory is copied to, which has to be 64 KB
+     */
+    virtual void copy(std::span<u8> memory) const = 0;
+
+    /**
+     * Called for every OUT the CPU does.
+     *
+     * @param port is the port written to
+     * @param value is the value written
+     * @return true if the port is the one the paging is controlled through
+     */
+    virtual bool out_changed(u16 port, u8 value) = 0;
+
+    virtual void save_state(StateWriter& writer) const = 0;
+
+    virtual void load_state(StateReader& reader) = 0;
+
+    /**
+     * Paging and restoring a state change what the CPU sees without the CPU writing to it, so the
+     * addresses that change that way are marked here. What the CPU writes is marked by the memory.
+     *
+     * @param dirty_ranges is where the changed addresses are marked
+     */
+    virtual void attach_dirty_ranges(std::shared_ptr<DirtyRanges> dirty_ranges) = 0;
+};
+}
@@ -0,0 +1,148 @@
+#include "memory_map_for_zxspectrum_128k.h"
+#include "crosscutting/memory/dirty_ranges.h"
+#include "crosscutting/memory/mapped_file.h"
+#include "crosscutting/misc/state_stream.h"
+#include "crosscutting/util/byte_util.h"
+#include "ula_timing.h"
+#include <algorithm>
+#include <cstddef>
+#include <fmt/core.h>
+#include <stdexcept>
+#include <utility>
+
+namespace emu::applications::zxspectrum_48k {
+
+using emu::util::byte::is_bit_set;
+
+MemoryMapForZxSpectrum128k::MemoryMapForZxSpectrum128k(std::shared_ptr<MappedFile const> rom, std::shared_ptr<UlaTiming> ula_timing)
+    : m_rom_file(std::move(rom))
+    , m_rom(m_rom_file->bytes())
+    , m_ram(s_number_of_ram_banks * s_bank_size, 0)
+    , m_ula_timing(std::move(ula_timing))
+{
+    if (m_rom.size() != s_number_of_roms * s_bank_size) {
+        throw std::invalid_argument(
+            fmt::format("The 128K ROM has to be {} bytes, but was {} bytes", s_number_of_roms * s_bank_size, m_rom.size()));
+    }
+
+    update_slots();
+}
+
+void MemoryMapForZxSpectrum128k::write(u16 address, u8 value)
+{
+    m_ula_timing->memory_access(address, value);
+
+    u8* slot = m_write_slots[address >> s_slot_shift];
+    if (slot != nullptr) {
+        slot[address & s_address_in_slot_mask] = value;
+    }
+}
+
+u8 MemoryMapForZxSpectrum128k::read(u16 address)
+{
+    const u8 value = m_read_slots[address >> s_slot_shift][address & s_address_in_slot_mask];
+
+    m_ula_timing->memory_access(address, value);
+
+    return value;
+}
+
+std::span<u8 const> MemoryMapForZxSpectrum128k::screen() const
+{
+    return { m_screen, s_screen_size };
+}
+
+u8 MemoryMapForZxSpectrum128k::peek(u16 address) const
+{
+    return m_read_slots[address >> s_slot_shift][address & s_address_in_slot_mask];
+}
+
+void MemoryMapForZxSpectrum128k::copy(std::span<u8> memory) const
+{
+    for (std::size_t slot = 0; slot < s_number_of_slots; ++slot) {
+        std::copy_n(m_read_slots[slot], s_bank_size, memory.begin() + static_cast<std::ptrdiff_t>(slot * s_bank_size));
+    }
+}
+
+bool MemoryMapForZxSpectrum128k::out_changed(u16 port, u8 value)
+{
+    if ((port & s_paging_port_mask) != 0) {
+        return false;
+    }
+
+    page(value);
+
+    return true;
+}
+
+void MemoryMapForZxSpectrum128k::save_state(StateWriter& writer) const
+{
+    writer.write(m_ram.data(), m_ram.size());
+    writer.write(m_last_page);
+}
+
+void MemoryMapForZxSpectrum128k::load_state(StateReader& reader)
+{
+    reader.read(m_ram.data(), m_ram.size());
+    m_last_page = reader.read<u8>();
+    update_slots();
+
+    if (m_dirty_ranges) {
+        m_dirty_ranges->mark(0, s_number_of_slots * s_bank_size - 1);
+    }
+}
+
+void MemoryMapForZxSpectrum128k::attach_dirty_ranges(std::shared_ptr<DirtyRanges> dirty_ranges)
+{
+    m_dirty_ranges = std::move(dirty_ranges);
+}
+
+std::span<u8> MemoryMapForZxSpectrum128k::ram_bank(std::size_t bank)
+{
+    return { ram_bank_pointer(bank), s_bank_size };
+}
+
+void MemoryMapForZxSpectrum128k::page(u8 value)
+{
+    if (is_bit_set(m_last_page, s_lock_bit)) {
+        return;
+    }
+
+    const std::array<u8 const*, s_number_of_slots> read_slots = m_read_slots;
+
+    m_last_page = value;
+    update_slots();
+
+    if (m_dirty_ranges) {
+        for (std::size_t slot = 0; slot < s_number_of_slots; ++slot) {
+            if (m_read_slots[slot] != read_slots[slot]) {
+                m_dirty_ranges->mark(slot * s_bank_size, (slot + 1) * s_bank_size - 1);
+            }
+        }
+    }
+}
+
+void MemoryMapForZxSpectrum128k::update_slots()
+{
+    const std::size_t bank_at_0xc000 = m_last_page & s_ram_bank_mask;
+
+    m_read_slots[0] = m_rom.data() + (is_bit_set(m_last_page, s_rom_bit) ? s_bank_size : 0);
+    m_write_slots[0] = nullptr;
+    m_write_slots[1] = ram_bank_pointer(s_bank_at_0x4000);
+    m_write_slots[2] = ram_bank_pointer(s_bank_at_0x8000);
+    m_write_slots[3] = ram_bank_pointer(bank_at_0xc000);
+    for (std::size_t slot = 1; slot < s_number_of_slots; ++slot) {
+        m_read_slots[slot] = m_write_slots[slot];
+    }
+
+    m_screen = ram_bank_pointer(is_bit_set(m_last_page, s_shadow_screen_bit) ? s_shadow_screen_bank : s_screen_bank);
+
+    // The odd banks are the ones the ULA shares with the CPU
+    m_ula_timing->set_is_top_slot_contended(bank_at_0xc000 % 2 == 1);
+}
+
+u8* MemoryMapForZxSpectrum128k::ram_bank_pointer(std::size_t bank)
+{
+    return m_ram.data() + bank * s_bank_size;
+}
+}
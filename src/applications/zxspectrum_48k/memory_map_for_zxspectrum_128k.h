@@ -0,0 +1,107 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include "interfaces/memory_map.h"
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace emu::applications::zxspectrum_48k {
+class UlaTiming;
+}
+namespace emu::memory {
+class MappedFile;
+}
+
+namespace emu::applications::zxspectrum_48k {
+
+using emu::memory::MappedFile;
+
+/**
+ * The memory of the 128K, which is two ROMs and eight RAM banks of 16 KB each. The address space is
+ * four slots of 16 KB. $0000-$3fff has one of the ROMs, $4000-$7fff has bank 5 and $8000-$bfff
+ * has bank 2, while any of the banks can be paged in at $c000-$ffff by writing to port $7ffd.
+ *
+ * Paging only points the slots to other banks, so nothing is copied.
+ */
+class MemoryMapForZxSpectrum128k : public MemoryMap {
+public:
+    /**
+     * @param rom is the two ROMs, the 128K editor followed by 48K BASIC
+     * @param ula_timing is told about every access, and about which bank is paged in at $c000-$ffff
+     * @throws std::invalid_argument if the ROM file isn't two ROMs
+     */
+    MemoryMapForZxSpectrum128k(std::shared_ptr<MappedFile const> rom, std::shared_ptr<UlaTiming> ula_timing);
+
+    void write(u16 address, u8 value) override;
+
+    u8 read(u16 address) override;
+
+    [[nodiscard]] std::span<u8 const> screen() const override;
+
+    [[nodiscard]] u8 peek(u16 address) const override;
+
+    void copy(std::span<u8> memory) const override;
+
+    bool out_changed(u16 port, u8 value) override;
+
+    void save_state(StateWriter& writer) const override;
+
+    void load_state(StateReader& reader) override;
+
+    void attach_dirty_ranges(std::shared_ptr<DirtyRanges> dirty_ranges) override;
+
+    /**
+     * @param bank is the number of the RAM bank, 0-7
+     * @return the RAM bank
+     */
+    [[nodiscard]] std::span<u8> ram_bank(std::size_t bank);
+
+    /**
+     * Pages the same way as a write to port $7ffd, which is ignored when the paging has been locked.
+     *
+     * Bit 0-2: The RAM bank at $c000-$ffff
+     * Bit 3:   1=The screen is in bank 7 instead of bank 5
+     * Bit 4:   1=48K BASIC instead of the 128K editor at $0000-$3fff
+     * Bit 5:   1=Lock the paging until the next reset
+     *
+     * @param value is the value written to the port
+     */
+    void page(u8 value);
+
+private:
+    static constexpr std::size_t s_bank_size = 0x4000;
+    static constexpr std::size_t s_number_of_slots = 4;
+    static constexpr std::size_t s_number_of_roms = 2;
+    static constexpr std::size_t s_number_of_ram_banks = 8;
+    static constexpr std::size_t s_bank_at_0x4000 = 5;
+    static constexpr std::size_t s_bank_at_0x8000 = 2;
+    static constexpr std::size_t s_screen_bank = 5;
+    static constexpr std::size_t s_shadow_screen_bank = 7;
+    static constexpr unsigned int s_slot_shift = 14;
+    static constexpr u16 s_address_in_slot_mask = 0x3fff;
+
+    static constexpr u16 s_paging_port_mask = 0x8002; // The port is decoded as any port with A15 and A1 reset
+    static constexpr u8 s_ram_bank_mask = 0b00000111;
+    static constexpr unsigned int s_shadow_screen_bit = 3;
+    static constexpr unsigned int s_rom_bit = 4;
+    static constexpr unsigned int s_lock_bit = 5;
+
+    std::shared_ptr<MappedFile const> m_rom_file;
+    std::span<u8 const> m_rom;
+    std::vector<u8> m_ram;
+    std::shared_ptr<UlaTiming> m_ula_timing;
+
+    std::array<u8 const*, s_number_of_slots> m_read_slots {};
+    std::array<u8*, s_number_of_slots> m_write_slots {}; // nullptr when the slot has ROM
+    u8 const* m_screen { nullptr };
+    u8 m_last_page { 0 };
+    std::shared_ptr<DirtyRanges> m_dirty_ranges;
+
+    void update_slots();
+
+    [[nodiscard]] u8* ram_bank_pointer(std::size_t bank);
+};
+}
@@ -1,10 +1,15 @@
 #include "memory_map_for_zxspectrum_48k.h"
 #include "crosscutting/memory/emulator_memory.h"
+#include "crosscutting/misc/state_stream.h"
+#include "ula_timing.h"
+#include <algorithm>
+#include <utility>
 
 namespace emu::applications::zxspectrum_48k {
 
-MemoryMapForZxSpectrum48k::MemoryMapForZxSpectrum48k(EmulatorMemory<u16, u8>& memory)
+MemoryMapForZxSpectrum48k::MemoryMapForZxSpectrum48k(EmulatorMemory<u16, u8>& memory, std::shared_ptr<UlaTiming> ula_timing)
     : m_memory(memory)
+    , m_ula_timing(std::move(ula_timing))
 {
 }
 
@@ -16,6 +21,8 @@ MemoryMapForZxSpectrum48k::MemoryMapForZxSpectrum48k(EmulatorMemory<u16, u8>& me
  */
 void MemoryMapForZxSpectrum48k::write(u16 address, u8 value)
 {
+    m_ula_timing->memory_access(address, value);
+
     if (address <= s_address_rom_end) {
     } else {
         m_memory.direct_write(address, value);
@@ -29,7 +36,50 @@ void MemoryMapForZxSpectrum48k::write(u16 address, u8 value)
  * @return the value in memory at the given address
  */
 u8 MemoryMapForZxSpectrum48k::read(u16 address)
+{
+    const u8 value = m_memory.direct_read(address);
+
+    m_ula_timing->memory_access(address, value);
+
+    return value;
+}
+
+std::span<u8 const> MemoryMapForZxSpectrum48k::screen() const
+{
+    return { m_memory.begin() + s_address_screen, s_screen_size };
+}
+
+u8 MemoryMapForZxSpectrum48k::peek(u16 address) const
 {
     return m_memory.direct_read(address);
 }
+
+void MemoryMapForZxSpectrum48k::copy(std::span<u8> memory) const
+{
+    std::copy_n(m_memory.begin(), memory.size(), memory.begin());
+}
+
+bool MemoryMapForZxSpectrum48k::out_changed([[maybe_unused]] u16 port, [[maybe_unused]] u8 value)
+{
+    return false;
+}
+
+void MemoryMapForZxSpectrum48k::save_state(StateWriter& writer) const
+{
+    m_memory.save_state(writer, s_address_ram_beginning, m_memory.size());
+}
+
+void MemoryMapForZxSpectrum48k::load_state(StateReader& reader)
+{
+    m_memory.load_state(reader, s_address_ram_beginning, m_memory.size());
+}
+
+/**
+ * Nothing is paged, and the RAM is restored through the memory, which marks what it restores
+ * itself.
+ */
+void MemoryMapForZxSpectrum48k::attach_dirty_ranges(std::shared_ptr<DirtyRanges> dirty_ranges)
+{
+    m_memory.attach_dirty_ranges(std::move(dirty_ranges));
+}
 }
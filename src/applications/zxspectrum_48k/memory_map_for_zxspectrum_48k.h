@@ -1,9 +1,14 @@
 #pragma once
 
-#include "crosscutting/memory/memory_mapped_io.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
+#include "interfaces/memory_map.h"
+#include <memory>
+#include <span>
 
+namespace emu::applications::zxspectrum_48k {
+class UlaTiming;
+}
 namespace emu::memory {
 template<class A, class D>
 class EmulatorMemory;
@@ -12,21 +17,37 @@ class EmulatorMemory;
 namespace emu::applications::zxspectrum_48k {
 
 using emu::memory::EmulatorMemory;
-using emu::memory::MemoryMappedIo;
 using emu::util::byte::low_nibble;
 
-class MemoryMapForZxSpectrum48k : public MemoryMappedIo<u16, u8> {
+class MemoryMapForZxSpectrum48k : public MemoryMap {
 public:
-    explicit MemoryMapForZxSpectrum48k(EmulatorMemory<u16, u8>& memory);
+    MemoryMapForZxSpectrum48k(EmulatorMemory<u16, u8>& memory, std::shared_ptr<UlaTiming> ula_timing);
 
     void write(u16 address, u8 value) override;
 
     u8 read(u16 address) override;
 
+    [[nodiscard]] std::span<u8 const> screen() const override;
+
+    [[nodiscard]] u8 peek(u16 address) const override;
+
+    void copy(std::span<u8> memory) const override;
+
+    bool out_changed(u16 port, u8 value) override;
+
+    void save_state(StateWriter& writer) const override;
+
+    void load_state(StateReader& reader) override;
+
+    void attach_dirty_ranges(std::shared_ptr<DirtyRanges> dirty_ranges) override;
+
 private:
     static constexpr u16 s_address_rom_end = 0x3fff;
+    static constexpr u16 s_address_ram_beginning = 0x4000;
     static constexpr u16 s_address_ram_end = 0xff57;
+    static constexpr u16 s_address_screen = 0x4000;
 
     EmulatorMemory<u16, u8>& m_memory;
+    std::shared_ptr<UlaTiming> m_ula_timing;
 };
 }
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+namespace emu::applications::zxspectrum_48k {
+
+enum class Model {
+    _48k,
+    _128k
+};
+
+static const inline std::unordered_map<Model, std::string> s_model_as_string = {
+    { Model::_48k, "48K" },
+    { Model::_128k, "128K" }
+};
+
+}
@@ -14,7 +14,7 @@ namespace emu::applications::zxspectrum_48k {
 
 using emu::exceptions::InvalidProgramArgumentsException;
 
-Settings Settings::from_options(Options const& options)
+Settings Settings::from_options(Options const& options, Model model)
 {
     for (auto const& opt : options.options()) {
         if (!s_recognized_options.contains(opt.first)) {
@@ -23,8 +23,12 @@ Settings Settings::from_options(Options const& options)
     }
 
     Settings settings {
+        .m_model = model,
         .m_snapshot_file = "",
-        .m_is_only_printing_header = false
+        .m_is_only_printing_header = false,
+        .m_is_using_startup_cache = false,
+        .m_record_file = "",
+        .m_replay_file = ""
     };
 
     const std::optional<std::string> path = options.path();
@@ -39,6 +43,33 @@ Settings Settings::from_options(Options const& options)
         settings.m_is_only_printing_header = true;
     }
 
+    if (opts.contains("startup-cache")) {
+        settings.m_is_using_startup_cache = true;
+    }
+
+    if (opts.contains(s_record_long)) {
+        settings.m_record_file = movie_file(s_record_long, opts.at(s_record_long));
+    }
+
+    if (opts.contains(s_replay_long)) {
+        settings.m_replay_file = movie_file(s_replay_long, opts.at(s_replay_long));
+    }
+
+    if (!settings.m_record_file.empty() && !settings.m_replay_file.empty()) {
+        throw InvalidProgramArgumentsException("Cannot record and replay input at the same time", print_usage);
+    }
+
     return settings;
 }
+
+std::string Settings::movie_file(std::string const& option, std::vector<std::string> const& values)
+{
+    if (values.size() != 1 || values[0].empty()) {
+        throw InvalidProgramArgumentsException(
+            fmt::format(R"(Invalid file passed to the --{0} option. Should be "--{0}=<file>".)", option),
+            print_usage);
+    }
+
+    return values[0];
+}
 }
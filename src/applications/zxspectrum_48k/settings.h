@@ -1,7 +1,9 @@
 #pragma once
 
+#include "model.h"
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 namespace emu::applications {
 class Options;
@@ -11,10 +13,18 @@ namespace emu::applications::zxspectrum_48k {
 
 class Settings {
 public:
+    Model m_model;
     std::string m_snapshot_file;
     bool m_is_only_printing_header;
+    bool m_is_using_startup_cache;
+    std::string m_record_file;
+    std::string m_replay_file;
 
-    static Settings from_options(Options const& options);
+    /**
+     * @param options are the program arguments
+     * @param model is the model to emulate, unless a snapshot of another model is loaded
+     */
+    static Settings from_options(Options const& options, Model model);
 
 private:
     static const inline std::string s_help_short = "h";
@@ -23,10 +33,16 @@ private:
 
     static const inline std::string s_print_header_long = "print-header";
     static const inline std::string s_gui_short = "g";
+    static const inline std::string s_startup_cache_long = "startup-cache";
+    static const inline std::string s_record_long = "record";
+    static const inline std::string s_replay_long = "replay";
 
     static const inline std::unordered_set<std::string> s_recognized_options = {
         s_help_short, s_help_long, s_debug_scanner_long,
-        s_print_header_long, s_gui_short
+        s_print_header_long, s_gui_short, s_startup_cache_long,
+        s_record_long, s_replay_long
     };
+
+    static std::string movie_file(std::string const& option, std::vector<std::string> const& values);
 };
 }
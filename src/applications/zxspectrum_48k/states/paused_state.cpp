@@ -3,9 +3,11 @@
 #include "applications/zxspectrum_48k/gui.h"
 #include "applications/zxspectrum_48k/gui_io.h"
 #include "applications/zxspectrum_48k/interfaces/input.h"
+#include "applications/zxspectrum_48k/interfaces/memory_map.h"
 #include "applications/zxspectrum_48k/states/state_context.h"
-#include "crosscutting/memory/emulator_memory.h"
+#include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/misc/governor.h"
+#include <span>
 #include <utility>
 
 namespace emu::applications::zxspectrum_48k {
@@ -52,18 +54,21 @@ void PausedState::perform([[maybe_unused]] cyc& cycles)
             return;
         }
 
+        m_ctx->m_debug_container->take_snapshot();
         m_ctx->m_gui->update_screen(vram(), color_ram(), m_ctx->m_cpu_io.border_color(), s_game_window_subtitle);
     }
 }
 
 std::vector<u8> PausedState::vram()
 {
-    return { m_ctx->m_memory.begin() + 0x4000, m_ctx->m_memory.begin() + 0x57ff + 1 };
+    const std::span<u8 const> screen = m_ctx->m_memory_map->screen();
+    return { screen.begin(), screen.begin() + MemoryMap::s_pixels_size };
 }
 
 std::vector<u8> PausedState::color_ram()
 {
-    return { m_ctx->m_memory.begin() + 0x5800, m_ctx->m_memory.begin() + 0x5aff + 1 };
+    const std::span<u8 const> screen = m_ctx->m_memory_map->screen();
+    return { screen.begin() + MemoryMap::s_pixels_size, screen.end() };
 }
 
 }
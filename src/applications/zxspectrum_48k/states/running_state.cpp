@@ -1,21 +1,36 @@
 #include "running_state.h"
+#include "applications/zxspectrum_48k/audio.h"
 #include "applications/zxspectrum_48k/cpu_io.h"
 #include "applications/zxspectrum_48k/gui.h"
 #include "applications/zxspectrum_48k/gui_io.h"
 #include "applications/zxspectrum_48k/interfaces/input.h"
+#include "applications/zxspectrum_48k/interfaces/memory_map.h"
 #include "applications/zxspectrum_48k/states/state_context.h"
+#include "applications/zxspectrum_48k/tape.h"
+#include "applications/zxspectrum_48k/ula_timing.h"
 #include "chips/z80/cpu.h"
+#include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/debugging/debugger.h"
 #include "crosscutting/logging/logger.h"
-#include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/misc/governor.h"
+#include "crosscutting/misc/hook_table.h"
+#include "crosscutting/misc/input_movie.h"
+#include "crosscutting/misc/port_decoder.h"
+#include "crosscutting/misc/rewind_buffer.h"
+#include "crosscutting/misc/state_stream.h"
 #include "crosscutting/typedefs.h"
-#include <unordered_map>
+#include "crosscutting/util/byte_util.h"
+#include <cstddef>
+#include <span>
 #include <utility>
 
 namespace emu::applications::zxspectrum_48k {
 
 using emu::misc::Governor;
+using emu::misc::StateReader;
+using emu::misc::StateWriter;
+using emu::util::byte::is_bit_set;
+using emu::util::byte::set_bit;
 
 RunningState::RunningState(std::shared_ptr<StateContext> state_context)
     : m_ctx(std::move(state_context))
@@ -50,10 +65,38 @@ void RunningState::perform(cyc& cycles)
 {
     m_ctx->m_outputs_during_cycle.clear();
 
-    if (m_ctx->m_governor.is_time_to_update()) {
+    // Runs as fast as it can while the tape plays or text is typed, instead of in real time
+    const bool is_unthrottled = (m_ctx->m_tape && m_ctx->m_tape->is_playing()) || m_ctx->m_cpu_io.is_typing_text();
+
+    if (is_unthrottled || m_ctx->m_governor.is_time_to_update()) {
+        if (!m_ctx->m_input_movie) {
+            if (m_ctx->m_gui_io.m_is_rewinding) {
+                rewind();
+                return;
+            }
+
+            save_state(m_state);
+            m_ctx->m_rewind_buffer.push(m_state);
+        }
+
         cycles = 0;
-        while (cycles < static_cast<cyc>(s_cycles_per_tick)) {
-            cycles += m_ctx->m_cpu->next_instruction();
+        m_ctx->m_ula_timing->start_frame();
+        while (!m_ctx->m_ula_timing->is_frame_finished()) {
+            if (m_ctx->m_ula_timing->is_interrupt_requested() && m_ctx->m_cpu->is_inta() && !m_ctx->m_cpu->is_interrupted()) {
+                m_ctx->m_cpu->interrupt(s_rst_7_z80);
+            }
+
+            if (m_ctx->m_cpu_io.is_typing_text()) {
+                type_next_character();
+            }
+
+            m_ctx->m_ula_timing->start_instruction();
+            const cyc instruction_cycles = m_ctx->m_ula_timing->finish_instruction(m_ctx->m_hooks.next_instruction(*m_ctx->m_cpu));
+            cycles += instruction_cycles;
+            if (m_ctx->m_tape) {
+                m_ctx->m_tape->advance(instruction_cycles);
+            }
+
             if (m_ctx->m_is_in_debug_mode && m_ctx->m_debugger->has_breakpoint(m_ctx->m_cpu->pc())) {
                 m_ctx->m_logger->info("Breakpoint hit: 0x%04x", m_ctx->m_cpu->pc());
                 transition_to_step();
@@ -61,7 +104,14 @@ void RunningState::perform(cyc& cycles)
             }
         }
 
-        m_ctx->m_input->read(m_ctx->m_cpu_io, m_ctx->m_gui_io);
+        m_ctx->m_audio.render_frame(m_ctx->m_ula_timing->t_states_per_frame());
+
+        if (m_ctx->m_cpu_io.is_typing_text() && ++m_frames_without_typing > s_max_frames_without_typing) {
+            m_ctx->m_logger->info("The BASIC editor did not take the typed text, so the rest of it is thrown away");
+            m_ctx->m_cpu_io.stop_typing_text();
+        }
+
+        read_input();
         if (m_ctx->m_gui_io.m_is_quitting) {
             m_ctx->m_gui_io.m_is_quitting = false;
             transition_to_stop();
@@ -72,22 +122,159 @@ void RunningState::perform(cyc& cycles)
             return;
         }
 
-        m_ctx->m_gui->update_screen(vram(), color_ram(), m_ctx->m_cpu_io.border_color(), s_game_window_subtitle);
+        if (!is_unthrottled || m_ctx->m_governor.is_time_to_update()) {
+            m_ctx->m_debug_container->take_snapshot();
+            m_ctx->m_gui->update_screen(vram(), color_ram(), m_ctx->m_cpu_io.border_color(), s_game_window_subtitle);
+        }
+    }
+}
+
+/**
+ * Reads the input once per frame. When recording, the keyboard is added to the input movie. When
+ * replaying, the keyboard comes from the input movie instead of from the player, and the session
+ * stops when the movie is over.
+ */
+void RunningState::read_input()
+{
+    if (is_replaying()) {
+        if (m_ctx->m_input_movie->is_finished()) {
+            m_ctx->m_gui_io.m_is_quitting = true;
+            return;
+        }
+
+        m_input.clear();
+        StateWriter writer(m_input);
+        m_ctx->m_cpu_io.save_input_state(writer);
 
-        if (m_ctx->m_cpu->is_inta()) {
-            m_ctx->m_cpu->interrupt(s_rst_7_z80);
+        if (m_ctx->m_input_movie->replay(m_input)) {
+            StateReader reader(m_input);
+            m_ctx->m_cpu_io.load_input_state(reader);
         }
+
+        return;
     }
+
+    m_ctx->m_input->read(m_ctx->m_cpu_io, m_ctx->m_gui_io);
+
+    if (m_ctx->m_input_movie) {
+        m_input.clear();
+        StateWriter writer(m_input);
+        m_ctx->m_cpu_io.save_input_state(writer);
+        m_ctx->m_input_movie->record(m_input);
+    }
+}
+
+/**
+ * Hands the next character of the typed text to KEY-INPUT, the same way the keyboard interrupt does
+ * when a new key is pressed. The editor calls KEY-INPUT in a loop while it waits for a key, so the
+ * text is typed as fast as the editor can take it, and not at the pace of the keyboard scanning.
+ */
+void RunningState::type_next_character()
+{
+    if (m_ctx->m_cpu->pc() != s_address_key_input) {
+        return;
+    }
+
+    for (std::size_t i = 0; i < s_key_input_beginning.size(); ++i) {
+        if (m_ctx->m_memory_map->peek(static_cast<u16>(s_address_key_input + i)) != s_key_input_beginning[i]) {
+            return;
+        }
+    }
+
+    u8 flags = m_ctx->m_memory_map->peek(s_address_flags);
+    if (is_bit_set(flags, s_flags_new_key_bit)) {
+        return;
+    }
+
+    m_frames_without_typing = 0;
+
+    set_bit(flags, s_flags_new_key_bit);
+    m_ctx->m_memory_map->write(s_address_last_k, m_ctx->m_cpu_io.next_typed_character());
+    m_ctx->m_memory_map->write(s_address_flags, flags);
+}
+
+bool RunningState::is_replaying() const
+{
+    return m_ctx->m_input_movie && m_ctx->m_input_movie->is_replaying();
+}
+
+void RunningState::rewind()
+{
+    if (m_ctx->m_rewind_buffer.pop(m_state)) {
+        load_state(m_state);
+    }
+
+    m_ctx->m_input->read(m_ctx->m_cpu_io, m_ctx->m_gui_io);
+    if (m_ctx->m_gui_io.m_is_quitting) {
+        m_ctx->m_gui_io.m_is_quitting = false;
+        transition_to_stop();
+        return;
+    } else if (m_ctx->m_gui_io.m_is_toggling_pause) {
+        m_ctx->m_gui_io.m_is_toggling_pause = false;
+        transition_to_pause();
+        return;
+    }
+
+    m_ctx->m_debug_container->take_snapshot();
+    m_ctx->m_gui->update_screen(vram(), color_ram(), m_ctx->m_cpu_io.border_color(), s_game_window_subtitle);
+}
+
+/**
+ * Emulates headless until the ROM has cleared and tested the RAM, set up the system variables and
+ * is waiting for a key press in the BASIC editor. That is where the startup cache is made.
+ *
+ * @param max_frames is the number of frames to give up after
+ * @return true if the BASIC editor was reached within max_frames, false otherwise
+ */
+bool RunningState::run_until_ready(unsigned int max_frames)
+{
+    for (unsigned int frame = 0; frame < max_frames; ++frame) {
+        m_ctx->m_ula_timing->start_frame();
+        while (!m_ctx->m_ula_timing->is_frame_finished()) {
+            if (m_ctx->m_cpu->pc() == s_address_wait_key) {
+                return true;
+            }
+
+            if (m_ctx->m_ula_timing->is_interrupt_requested() && m_ctx->m_cpu->is_inta() && !m_ctx->m_cpu->is_interrupted()) {
+                m_ctx->m_cpu->interrupt(s_rst_7_z80);
+            }
+
+            m_ctx->m_ula_timing->start_instruction();
+            m_ctx->m_ula_timing->finish_instruction(m_ctx->m_cpu->next_instruction());
+        }
+    }
+
+    return false;
+}
+
+void RunningState::save_state(std::vector<u8>& state)
+{
+    state.clear();
+
+    StateWriter writer(state);
+    m_ctx->m_cpu->save_state(writer);
+    m_ctx->m_memory_map->save_state(writer);
+    writer.write(m_ctx->m_cpu_io.m_out_port0xfe);
+}
+
+void RunningState::load_state(std::vector<u8> const& state)
+{
+    StateReader reader(state);
+    m_ctx->m_cpu->load_state(reader);
+    m_ctx->m_memory_map->load_state(reader);
+    m_ctx->m_cpu_io.m_out_port0xfe = reader.read<u8>();
 }
 
 std::vector<u8> RunningState::vram()
 {
-    return { m_ctx->m_memory.begin() + 0x4000, m_ctx->m_memory.begin() + 0x57ff + 1 };
+    const std::span<u8 const> screen = m_ctx->m_memory_map->screen();
+    return { screen.begin(), screen.begin() + MemoryMap::s_pixels_size };
 }
 
 std::vector<u8> RunningState::color_ram()
 {
-    return { m_ctx->m_memory.begin() + 0x5800, m_ctx->m_memory.begin() + 0x5aff + 1 };
+    const std::span<u8 const> screen = m_ctx->m_memory_map->screen();
+    return { screen.begin() + MemoryMap::s_pixels_size, screen.end() };
 }
 
 }
@@ -2,6 +2,8 @@
 
 #include "crosscutting/typedefs.h"
 #include "zxspectrum_48k/interfaces/state.h"
+#include <array>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
@@ -43,19 +45,45 @@ public:
 
     void perform(cyc& cycles) override;
 
+    bool run_until_ready(unsigned int max_frames);
+
+    void save_state(std::vector<u8>& state);
+
+    void load_state(std::vector<u8> const& state);
+
 private:
     static inline std::string s_game_window_subtitle = "";
     static constexpr unsigned int s_rst_7_z80 = 0xff;
 
-    // Game loop - begin
-    static constexpr long double s_fps = 50.0L;
-    static constexpr long double s_tick_limit = 1000.0L / s_fps;
-    static constexpr int s_cycles_per_ms = 3500;
-    static constexpr long double s_cycles_per_tick = s_cycles_per_ms * s_tick_limit;
-    // Game loop - end
+    // The ROM routine that waits for a key press in the BASIC editor
+    static constexpr u16 s_address_wait_key = 0x15d4;
+
+    // The ROM routine the editor calls to get the last key, which begins with BIT 3,(TV-FLAG)
+    static constexpr u16 s_address_key_input = 0x10a8;
+    static constexpr std::array<u8, 4> s_key_input_beginning = { 0xfd, 0xcb, 0x02, 0x5e };
+
+    static constexpr u16 s_address_last_k = 0x5c08;
+    static constexpr u16 s_address_flags = 0x5c3b;
+    static constexpr unsigned int s_flags_new_key_bit = 5;
+
+    // Typing is given up when the editor hasn't taken a character for this long, like when a program runs
+    static constexpr unsigned int s_max_frames_without_typing = 250;
 
     std::shared_ptr<StateContext> m_ctx;
 
+    std::vector<u8> m_state;
+    std::vector<u8> m_input;
+
+    unsigned int m_frames_without_typing { 0 };
+
+    void read_input();
+
+    void type_next_character();
+
+    [[nodiscard]] bool is_replaying() const;
+
+    void rewind();
+
     std::vector<u8> vram();
 
     std::vector<u8> color_ram();
@@ -16,12 +16,18 @@ StateContext::StateContext(
     std::shared_ptr<Gui> gui,
     std::shared_ptr<Input> input,
     std::shared_ptr<Cpu> cpu,
-    EmulatorMemory<u16, u8>& memory,
+    std::shared_ptr<MemoryMap> memory_map,
+    std::shared_ptr<UlaTiming> ula_timing,
+    Audio& audio,
+    std::shared_ptr<Tape> tape,
+    HookTable& hooks,
     std::shared_ptr<Logger> logger,
     std::shared_ptr<Debugger<u16, 16>> debugger,
     std::shared_ptr<DebugContainer<u16, u8, 16>> debug_container,
-    std::unordered_map<u8, u8>& outputs_during_cycle,
+    PortCapture& outputs_during_cycle,
     Governor& governor,
+    RewindBuffer& rewind_buffer,
+    std::shared_ptr<InputMovie> input_movie,
     bool& is_in_debug_mode)
     : m_is_in_debug_mode(is_in_debug_mode)
     , m_cpu_io(cpu_io)
@@ -29,12 +35,18 @@ StateContext::StateContext(
     , m_gui(std::move(gui))
     , m_input(std::move(input))
     , m_cpu(std::move(cpu))
-    , m_memory(memory)
+    , m_memory_map(std::move(memory_map))
+    , m_ula_timing(std::move(ula_timing))
+    , m_audio(audio)
+    , m_tape(std::move(tape))
+    , m_hooks(hooks)
     , m_logger(std::move(logger))
     , m_debugger(std::move(debugger))
     , m_debug_container(std::move(debug_container))
     , m_outputs_during_cycle(outputs_during_cycle)
     , m_governor(governor)
+    , m_rewind_buffer(rewind_buffer)
+    , m_input_movie(std::move(input_movie))
 {
 }
 
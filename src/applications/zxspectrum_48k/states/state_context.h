@@ -4,13 +4,16 @@
 #include "crosscutting/typedefs.h"
 #include <cstddef>
 #include <memory>
-#include <unordered_map>
 
 namespace emu::applications::zxspectrum_48k {
+class Audio;
 class CpuIo;
 class GuiIo;
 class Input;
+class MemoryMap;
 class State;
+class Tape;
+class UlaTiming;
 }
 namespace emu::debugger {
 template<class A, class D, std::size_t B>
@@ -24,19 +27,22 @@ class Cpu;
 namespace emu::logging {
 class Logger;
 }
-namespace emu::memory {
-template<class A, class D>
-class EmulatorMemory;
-}
 namespace emu::misc {
 class Governor;
+class HookTable;
+class InputMovie;
+class PortCapture;
+class RewindBuffer;
 }
 
 namespace emu::applications::zxspectrum_48k {
 
 using emu::z80::Cpu;
-using emu::memory::EmulatorMemory;
 using emu::misc::Governor;
+using emu::misc::HookTable;
+using emu::misc::InputMovie;
+using emu::misc::PortCapture;
+using emu::misc::RewindBuffer;
 
 class StateContext {
 public:
@@ -46,12 +52,18 @@ public:
         std::shared_ptr<Gui> gui,
         std::shared_ptr<Input> input,
         std::shared_ptr<Cpu> cpu,
-        EmulatorMemory<u16, u8>& memory,
+        std::shared_ptr<MemoryMap> memory_map,
+        std::shared_ptr<UlaTiming> ula_timing,
+        Audio& audio,
+        std::shared_ptr<Tape> tape,
+        HookTable& hooks,
         std::shared_ptr<Logger> logger,
         std::shared_ptr<Debugger<u16, 16>> debugger,
         std::shared_ptr<DebugContainer<u16, u8, 16>> debug_container,
-        std::unordered_map<u8, u8>& outputs_during_cycle,
+        PortCapture& outputs_during_cycle,
         Governor& governor,
+        RewindBuffer& rewind_buffer,
+        std::shared_ptr<InputMovie> input_movie,
         bool& is_in_debug_mode);
 
     bool& m_is_in_debug_mode;
@@ -62,14 +74,20 @@ public:
     std::shared_ptr<Input> m_input;
     std::shared_ptr<Cpu> m_cpu;
 
-    EmulatorMemory<u16, u8>& m_memory;
+    std::shared_ptr<MemoryMap> m_memory_map;
+    std::shared_ptr<UlaTiming> m_ula_timing;
+    Audio& m_audio;
+    std::shared_ptr<Tape> m_tape;
+    HookTable& m_hooks;
 
     std::shared_ptr<Logger> m_logger;
     std::shared_ptr<Debugger<u16, 16>> m_debugger;
     std::shared_ptr<DebugContainer<u16, u8, 16>> m_debug_container;
-    std::unordered_map<u8, u8>& m_outputs_during_cycle;
+    PortCapture& m_outputs_during_cycle;
 
     Governor& m_governor;
+    RewindBuffer& m_rewind_buffer;
+    std::shared_ptr<InputMovie> m_input_movie;
 
     void change_state(std::shared_ptr<State> new_state);
 
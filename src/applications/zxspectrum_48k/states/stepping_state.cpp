@@ -3,11 +3,15 @@
 #include "applications/zxspectrum_48k/gui.h"
 #include "applications/zxspectrum_48k/gui_io.h"
 #include "applications/zxspectrum_48k/interfaces/input.h"
+#include "applications/zxspectrum_48k/interfaces/memory_map.h"
 #include "applications/zxspectrum_48k/states/state_context.h"
+#include "applications/zxspectrum_48k/ula_timing.h"
 #include "chips/z80/cpu.h"
-#include "crosscutting/memory/emulator_memory.h"
+#include "crosscutting/debugging/debug_container.h"
+#include "crosscutting/misc/hook_table.h"
+#include "crosscutting/misc/port_decoder.h"
 #include "crosscutting/typedefs.h"
-#include <unordered_map>
+#include <span>
 #include <utility>
 
 namespace emu::applications::zxspectrum_48k {
@@ -52,8 +56,14 @@ void SteppingState::perform(cyc& cycles)
     }
 
     cycles = 0;
-    while (cycles < static_cast<cyc>(s_cycles_per_tick)) {
-        cycles += m_ctx->m_cpu->next_instruction();
+    m_ctx->m_ula_timing->start_frame();
+    while (!m_ctx->m_ula_timing->is_frame_finished()) {
+        if (m_ctx->m_ula_timing->is_interrupt_requested() && m_ctx->m_cpu->is_inta() && !m_ctx->m_cpu->is_interrupted()) {
+            m_ctx->m_cpu->interrupt(s_rst_7_z80);
+        }
+
+        m_ctx->m_ula_timing->start_instruction();
+        cycles += m_ctx->m_ula_timing->finish_instruction(m_ctx->m_hooks.next_instruction(*m_ctx->m_cpu));
         if (!m_is_stepping_cycle) {
             if (await_input_and_update_debug()) {
                 return;
@@ -72,12 +82,9 @@ void SteppingState::perform(cyc& cycles)
         return;
     }
 
+    m_ctx->m_debug_container->take_snapshot();
     m_ctx->m_gui->update_screen(vram(), color_ram(), m_ctx->m_cpu_io.border_color(), s_game_window_subtitle);
 
-    if (m_ctx->m_cpu->is_inta()) {
-        m_ctx->m_cpu->interrupt(s_rst_7_z80);
-    }
-
     m_is_stepping_cycle = false;
 }
 
@@ -115,12 +122,14 @@ bool SteppingState::await_input_and_update_debug()
 
 std::vector<u8> SteppingState::vram()
 {
-    return { m_ctx->m_memory.begin() + 0x4000, m_ctx->m_memory.begin() + 0x57ff + 1 };
+    const std::span<u8 const> screen = m_ctx->m_memory_map->screen();
+    return { screen.begin(), screen.begin() + MemoryMap::s_pixels_size };
 }
 
 std::vector<u8> SteppingState::color_ram()
 {
-    return { m_ctx->m_memory.begin() + 0x5800, m_ctx->m_memory.begin() + 0x5aff + 1 };
+    const std::span<u8 const> screen = m_ctx->m_memory_map->screen();
+    return { screen.begin() + MemoryMap::s_pixels_size, screen.end() };
 }
 
 }
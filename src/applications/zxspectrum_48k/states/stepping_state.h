@@ -47,13 +47,6 @@ private:
     static inline std::string s_game_window_subtitle = "Stepping";
     static constexpr unsigned int s_rst_7_z80 = 0xff;
 
-    // Game loop - begin
-    static constexpr long double s_fps = 50.0L;
-    static constexpr long double s_tick_limit = 1000.0L / s_fps;
-    static constexpr int s_cycles_per_ms = 3500;
-    static constexpr long double s_cycles_per_tick = s_cycles_per_ms * s_tick_limit;
-    // Game loop - end
-
     bool m_is_stepping_cycle { false };
 
     std::shared_ptr<StateContext> m_ctx;
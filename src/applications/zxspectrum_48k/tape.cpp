@@ -0,0 +1,211 @@
+#include "tape.h"
+#include "chips/z80/cpu.h"
+#include "chips/z80/manual_state.h"
+#include "crosscutting/util/byte_util.h"
+#include "interfaces/memory_map.h"
+#include <utility>
+
+namespace emu::applications::zxspectrum_48k {
+
+using emu::util::byte::high_byte;
+using emu::util::byte::is_bit_set;
+using emu::util::byte::low_byte;
+using emu::util::byte::to_u16;
+using emu::z80::ManualState;
+
+Tape::Tape(std::vector<TapeBlock> blocks, cyc t_states_per_ms)
+    : m_blocks(std::move(blocks))
+    , m_t_states_per_ms(t_states_per_ms)
+{
+    start_block(0);
+}
+
+/**
+ * LD-BYTES is entered with the flag byte to look for in A, the address in IX, the length in DE and
+ * carry set to load or reset to verify. The block is loaded, and the CPU continues at SA/LD-RET,
+ * which LD-BYTES returns through. It restores the border, enables the interrupts and returns to the
+ * caller with carry set if the block was loaded, and reset if it was not.
+ */
+bool Tape::ld_bytes(Cpu& cpu, MemoryMap& memory_map)
+{
+    if (m_phase == Phase::Finished) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < s_ld_bytes_beginning.size(); ++i) {
+        if (memory_map.peek(static_cast<u16>(s_address_ld_bytes + i)) != s_ld_bytes_beginning[i]) {
+            return false; // Another ROM is paged in
+        }
+    }
+
+    m_is_playing = true; // The tape may not have been started yet, or have been stopped by a block that says so
+
+    TapeBlock const& block = m_blocks[m_block_index];
+    if (!block.m_is_standard || m_phase != Phase::Pilot) {
+        return false; // The ROM loads it from the pulses
+    }
+
+    ManualState state = cpu.manual_state();
+    const bool is_loading = state.m_flag_reg.is_carry_flag_set();
+    u16 address = state.m_ix_reg;
+    u16 length = to_u16(state.m_d_reg, state.m_e_reg);
+
+    bool is_ok = !block.m_data.empty() && block.m_data[0] == state.m_acc_reg;
+    if (is_ok) {
+        u8 parity = block.m_data[0];
+        std::size_t index = 1;
+        for (; length > 0 && index < block.m_data.size(); ++index, --length, ++address) {
+            const u8 value = block.m_data[index];
+            parity ^= value;
+            if (is_loading) {
+                memory_map.write(address, value);
+            } else if (memory_map.peek(address) != value) {
+                is_ok = false;
+                break;
+            }
+        }
+
+        if (length == 0 && index < block.m_data.size()) {
+            parity ^= block.m_data[index]; // The checksum
+        } else {
+            is_ok = false;
+        }
+
+        is_ok = is_ok && parity == 0;
+    }
+
+    state.m_ix_reg = address;
+    state.m_d_reg = high_byte(length);
+    state.m_e_reg = low_byte(length);
+    if (is_ok) {
+        state.m_flag_reg.set_carry_flag();
+    } else {
+        state.m_flag_reg.clear_carry_flag();
+    }
+    state.m_pc = s_address_sa_ld_ret;
+    cpu.set_state_manually(state);
+
+    m_t_states_into_pulse = 0;
+    start_block(m_block_index + 1);
+
+    return true;
+}
+
+void Tape::advance(cyc t_states)
+{
+    if (!m_is_playing) {
+        return;
+    }
+
+    m_t_states_into_pulse += t_states;
+    while (m_is_playing && m_t_states_into_pulse >= m_pulse_length) {
+        m_t_states_into_pulse -= m_pulse_length;
+        next_pulse();
+    }
+}
+
+bool Tape::is_playing() const
+{
+    return m_is_playing;
+}
+
+bool Tape::ear() const
+{
+    return m_ear;
+}
+
+/**
+ * The tape goes on playing from one block to the next, and only stops when a block says so.
+ */
+void Tape::start_block(std::size_t block_index)
+{
+    bool is_stopped = false;
+    while (block_index < m_blocks.size() && m_blocks[block_index].m_is_stopping_the_tape) {
+        is_stopped = true;
+        ++block_index;
+    }
+
+    m_block_index = block_index;
+    m_pulse_index = 0;
+    m_is_second_half_of_bit = false;
+    m_pulse_length = 0;
+
+    if (block_index >= m_blocks.size()) {
+        m_phase = Phase::Finished;
+        m_is_playing = false;
+        return;
+    }
+
+    m_phase = Phase::Pilot;
+    if (is_stopped) {
+        m_is_playing = false;
+    }
+}
+
+void Tape::next_pulse()
+{
+    if (m_phase == Phase::Finished) {
+        m_is_playing = false;
+        return;
+    }
+
+    TapeBlock const& block = m_blocks[m_block_index];
+
+    switch (m_phase) {
+    case Phase::Pilot:
+        if (m_pulse_index < block.m_number_of_pilot_pulses) {
+            ++m_pulse_index;
+            start_pulse(block.m_pilot_pulse_length);
+            return;
+        }
+        m_phase = Phase::Pulses;
+        m_pulse_index = 0;
+        [[fallthrough]];
+    case Phase::Pulses:
+        if (m_pulse_index < block.m_pulses.size()) {
+            start_pulse(block.m_pulses[m_pulse_index++]);
+            return;
+        }
+        m_phase = Phase::Data;
+        m_pulse_index = 0;
+        [[fallthrough]];
+    case Phase::Data:
+        if (m_pulse_index < number_of_bits(block)) { // Every bit is two pulses
+            const bool is_one = is_bit_set(block.m_data[m_pulse_index / 8], 7 - static_cast<unsigned int>(m_pulse_index % 8));
+            if (m_is_second_half_of_bit) {
+                ++m_pulse_index;
+            }
+            m_is_second_half_of_bit = !m_is_second_half_of_bit;
+            start_pulse(is_one ? block.m_one_pulse_length : block.m_zero_pulse_length);
+            return;
+        }
+        m_phase = Phase::Pause;
+        if (block.m_pause_ms > 0) {
+            m_ear = false;
+            m_pulse_length = block.m_pause_ms * m_t_states_per_ms;
+            return;
+        }
+        [[fallthrough]];
+    case Phase::Pause:
+        start_block(m_block_index + 1);
+        return;
+    case Phase::Finished:
+        return;
+    }
+}
+
+void Tape::start_pulse(cyc length)
+{
+    m_ear = !m_ear;
+    m_pulse_length = length;
+}
+
+std::size_t Tape::number_of_bits(TapeBlock const& block) const
+{
+    if (block.m_data.empty()) {
+        return 0;
+    }
+
+    return (block.m_data.size() - 1) * 8 + block.m_used_bits_in_last_byte;
+}
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include "formats/tape_block.h"
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace emu::z80 {
+class Cpu;
+}
+
+namespace emu::applications::zxspectrum_48k {
+class MemoryMap;
+}
+
+namespace emu::applications::zxspectrum_48k {
+
+using emu::z80::Cpu;
+
+/**
+ * A tape in the tape recorder. Every block is played as pulses on the EAR bit, like a real tape,
+ * so both the ROM and the program's own loaders can read it. The tape starts playing when the ROM
+ * first waits for it in LD-BYTES, and the emulation runs as fast as it can while it plays, so the
+ * blocks load in seconds.
+ *
+ * When the ROM calls LD-BYTES while the pilot of a standard block is playing, the pulses are
+ * skipped, and the block is written straight into memory. The CPU then returns from the routine
+ * as if the block had been loaded, and the tape goes on with the next block.
+ */
+class Tape {
+public:
+    static constexpr u16 s_address_ld_bytes = 0x0556;
+
+    /**
+     * @param blocks are the blocks on the tape
+     * @param t_states_per_ms is the clock rate of the machine, which the pauses are played at
+     */
+    Tape(std::vector<TapeBlock> blocks, cyc t_states_per_ms);
+
+    /**
+     * Starts the tape, and loads the block in place of LD-BYTES if the ROM with LD-BYTES is paged
+     * in and the pilot of a standard block is playing. To be run by a hook at s_address_ld_bytes.
+     *
+     * @param cpu is the CPU, which gets the registers LD-BYTES returns with
+     * @param memory_map is where the block is loaded to
+     * @return true if the block was loaded
+     */
+    bool ld_bytes(Cpu& cpu, MemoryMap& memory_map);
+
+    /**
+     * Plays the tape for a while, if it's playing.
+     *
+     * @param t_states is how long to play for
+     */
+    void advance(cyc t_states);
+
+    /**
+     * @return true while the tape plays pulses, which is when the emulation should run at full speed
+     */
+    [[nodiscard]] bool is_playing() const;
+
+    /**
+     * @return the level of the signal from the tape, which is read from bit 6 of port $fe
+     */
+    [[nodiscard]] bool ear() const;
+
+private:
+    static constexpr u16 s_address_sa_ld_ret = 0x053f;
+    static constexpr std::array<u8, 4> s_ld_bytes_beginning = { 0x14, 0x08, 0x15, 0xf3 }; // INC D, EX AF,AF', DEC D, DI
+
+    enum class Phase {
+        Pilot,
+        Pulses,
+        Data,
+        Pause,
+        Finished
+    };
+
+    std::vector<TapeBlock> m_blocks;
+    std::size_t m_block_index { 0 };
+    cyc m_t_states_per_ms;
+
+    bool m_is_playing { false };
+    bool m_ear { false };
+    Phase m_phase { Phase::Finished };
+    std::size_t m_pulse_index { 0 }; // Into the pilot, the pulses or the bits of the data
+    bool m_is_second_half_of_bit { false };
+    cyc m_pulse_length { 0 };
+    cyc m_t_states_into_pulse { 0 };
+
+    void start_block(std::size_t block_index);
+
+    void next_pulse();
+
+    void start_pulse(cyc length);
+
+    [[nodiscard]] std::size_t number_of_bits(TapeBlock const& block) const;
+};
+}
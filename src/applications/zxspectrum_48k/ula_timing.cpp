@@ -0,0 +1,158 @@
+#include "ula_timing.h"
+#include "crosscutting/util/byte_util.h"
+#include <array>
+
+namespace emu::applications::zxspectrum_48k {
+
+using emu::util::byte::is_bit_set;
+
+/**
+ * The ULA reads two bytes of pixels and two bytes of attributes for every 8 pixels. The CPU is held
+ * for 6 T-states at the first T-state of that, then 5, 4 and so on down to 0, and isn't held for the
+ * last 2 T-states. This repeats for the 128 T-states each line of the screen takes to draw.
+ */
+template<cyc t_states_per_frame, cyc t_states_per_line, cyc first_contended_t_state>
+static constexpr std::array<u8, t_states_per_frame> make_contention_delays()
+{
+    constexpr std::array<u8, 8> pattern = { 6, 5, 4, 3, 2, 1, 0, 0 };
+
+    std::array<u8, t_states_per_frame> delays {};
+
+    for (cyc line = 0; line < UlaTiming::s_number_of_contended_lines; ++line) {
+        const cyc line_start = first_contended_t_state + line * t_states_per_line;
+        for (cyc t_state = 0; t_state < UlaTiming::s_contended_t_states_per_line; ++t_state) {
+            delays[line_start + t_state] = pattern[t_state % pattern.size()];
+        }
+    }
+
+    return delays;
+}
+
+static constexpr std::array<u8, UlaTiming::s_t_states_per_frame_48k> s_contention_delays_48k = make_contention_delays<
+    UlaTiming::s_t_states_per_frame_48k,
+    UlaTiming::s_t_states_per_line_48k,
+    UlaTiming::s_first_contended_t_state_48k>();
+
+static constexpr std::array<u8, UlaTiming::s_t_states_per_frame_128k> s_contention_delays_128k = make_contention_delays<
+    UlaTiming::s_t_states_per_frame_128k,
+    UlaTiming::s_t_states_per_line_128k,
+    UlaTiming::s_first_contended_t_state_128k>();
+
+UlaTiming::UlaTiming(Model model)
+    : m_contention_delays(model == Model::_128k ? std::span<u8 const>(s_contention_delays_128k) : std::span<u8 const>(s_contention_delays_48k))
+    , m_t_states_per_frame(model == Model::_128k ? s_t_states_per_frame_128k : s_t_states_per_frame_48k)
+    , m_interrupt_length(model == Model::_128k ? s_interrupt_length_128k : s_interrupt_length_48k)
+{
+}
+
+bool UlaTiming::is_frame_finished() const
+{
+    return m_frame_t_state >= m_t_states_per_frame;
+}
+
+void UlaTiming::start_frame()
+{
+    m_frame_t_state %= m_t_states_per_frame;
+}
+
+bool UlaTiming::is_interrupt_requested() const
+{
+    return m_frame_t_state < m_interrupt_length;
+}
+
+void UlaTiming::start_instruction()
+{
+    m_instruction_t_state = m_frame_t_state;
+    m_wait_states = 0;
+    m_is_opcode_fetch = true;
+    m_is_after_index_prefix = false;
+}
+
+cyc UlaTiming::finish_instruction(cyc cycles)
+{
+    m_frame_t_state += cycles + m_wait_states;
+
+    return cycles + m_wait_states;
+}
+
+void UlaTiming::memory_access(u16 address, u8 value)
+{
+    if (is_contended(address)) {
+        contend();
+    }
+
+    if (m_is_opcode_fetch) {
+        m_instruction_t_state += s_t_states_per_opcode_fetch;
+        // A prefix is followed by another opcode fetch, except CB after DD or FD, which is followed by the displacement
+        m_is_opcode_fetch = value == s_prefix_ix || value == s_prefix_iy || value == s_prefix_extended
+            || (value == s_prefix_bits && !m_is_after_index_prefix);
+        m_is_after_index_prefix = value == s_prefix_ix || value == s_prefix_iy;
+    } else {
+        m_instruction_t_state += s_t_states_per_memory_access;
+    }
+}
+
+/**
+ * Whether an IO access is contended depends on if the high byte of the port looks like an address
+ * in contended memory, because the ULA sees it on the address bus, and on if the port is decoded
+ * by the ULA, which it is when the lowest bit is reset. An IO access takes 4 T-states in total.
+ */
+void UlaTiming::io_access(u16 port)
+{
+    const bool is_high_byte_contended = is_contended(static_cast<u16>(port & 0xff00));
+    const bool is_ula_port = !is_bit_set(port, 0);
+
+    if (is_high_byte_contended) {
+        contend();
+        m_instruction_t_state += 1;
+        if (is_ula_port) {
+            contend();
+            m_instruction_t_state += 3;
+        } else {
+            for (int i = 0; i < 3; ++i) {
+                contend();
+                m_instruction_t_state += 1;
+            }
+        }
+    } else if (is_ula_port) {
+        m_instruction_t_state += 1;
+        contend();
+        m_instruction_t_state += 3;
+    } else {
+        m_instruction_t_state += 4;
+    }
+}
+
+void UlaTiming::set_is_top_slot_contended(bool is_contended)
+{
+    m_is_top_slot_contended = is_contended;
+}
+
+cyc UlaTiming::frame_t_state() const
+{
+    return m_frame_t_state;
+}
+
+cyc UlaTiming::t_states_per_frame() const
+{
+    return m_t_states_per_frame;
+}
+
+cyc UlaTiming::contention_delay(cyc t_state) const
+{
+    return m_contention_delays[t_state % m_t_states_per_frame];
+}
+
+bool UlaTiming::is_contended(u16 address) const
+{
+    return (s_address_contended_beginning <= address && address <= s_address_contended_end)
+        || (m_is_top_slot_contended && address >= s_address_top_slot_beginning);
+}
+
+void UlaTiming::contend()
+{
+    const cyc delay = contention_delay(m_instruction_t_state);
+    m_instruction_t_state += delay;
+    m_wait_states += delay;
+}
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include "model.h"
+#include <span>
+
+namespace emu::applications::zxspectrum_48k {
+
+/**
+ * The timing of the ULA. The ULA has priority over the CPU when both want the memory at
+ * $4000-$7fff, and the IO ports it decodes, while it draws the screen. The CPU is then held until
+ * the ULA is done, which is called contention. The 128K also contends the odd RAM banks when they
+ * are paged in at $c000-$ffff, and has slightly longer lines and frames than the 48K.
+ *
+ * The delay only depends on where in the frame the access happens, so it's looked up in a table
+ * with one entry per T-state. The memory mapper and the IO observers tell about every access, and
+ * the T-states in an instruction are counted from the start of the instruction and the accesses
+ * so far.
+ */
+class UlaTiming {
+public:
+    static constexpr cyc s_t_states_per_frame_48k = 69888;
+    static constexpr cyc s_t_states_per_line_48k = 224;
+    static constexpr cyc s_first_contended_t_state_48k = 14335;
+    static constexpr cyc s_interrupt_length_48k = 32;
+    static constexpr cyc s_t_states_per_ms_48k = 3500;
+
+    static constexpr cyc s_t_states_per_frame_128k = 70908;
+    static constexpr cyc s_t_states_per_line_128k = 228;
+    static constexpr cyc s_first_contended_t_state_128k = 14361;
+    static constexpr cyc s_interrupt_length_128k = 36;
+    static constexpr cyc s_t_states_per_ms_128k = 3547;
+
+    static constexpr cyc s_number_of_contended_lines = 192;
+    static constexpr cyc s_contended_t_states_per_line = 128;
+
+    explicit UlaTiming(Model model);
+
+    /**
+     * @return true when the frame is over, and the next one should be started
+     */
+    [[nodiscard]] bool is_frame_finished() const;
+
+    /**
+     * Starts the next frame. The T-states that the last instruction ran past the end of the frame
+     * are carried over, so no time is lost.
+     */
+    void start_frame();
+
+    /**
+     * @return true when the ULA holds the interrupt line, which it does for the first 32 T-states
+     *         of every frame on the 48K and 36 on the 128K. The CPU misses the interrupt if it has
+     *         interrupts disabled all that time.
+     */
+    [[nodiscard]] bool is_interrupt_requested() const;
+
+    void start_instruction();
+
+    /**
+     * @param cycles is the number of T-states the instruction takes without contention
+     * @return the number of T-states the instruction took with contention
+     */
+    cyc finish_instruction(cyc cycles);
+
+    /**
+     * Called for every memory read and write the CPU does.
+     *
+     * @param address is the address being accessed
+     * @param value is the value being read or written, which tells if a prefix was fetched
+     */
+    void memory_access(u16 address, u8 value);
+
+    /**
+     * Called for every IN and OUT the CPU does.
+     *
+     * @param port is the port being accessed
+     */
+    void io_access(u16 port);
+
+    /**
+     * Called by the 128K memory mapper when a RAM bank is paged in at $c000-$ffff.
+     *
+     * @param is_contended is true if the bank that was paged in is contended
+     */
+    void set_is_top_slot_contended(bool is_contended);
+
+    [[nodiscard]] cyc frame_t_state() const;
+
+    [[nodiscard]] cyc t_states_per_frame() const;
+
+    /**
+     * @param t_state is a T-state in the frame
+     * @return the number of T-states an access to contended memory is delayed by at the T-state
+     */
+    [[nodiscard]] cyc contention_delay(cyc t_state) const;
+
+private:
+    static constexpr u16 s_address_contended_beginning = 0x4000;
+    static constexpr u16 s_address_contended_end = 0x7fff;
+    static constexpr u16 s_address_top_slot_beginning = 0xc000;
+    static constexpr cyc s_t_states_per_opcode_fetch = 4;
+    static constexpr cyc s_t_states_per_memory_access = 3;
+    static constexpr u8 s_prefix_bits = 0xcb;
+    static constexpr u8 s_prefix_ix = 0xdd;
+    static constexpr u8 s_prefix_extended = 0xed;
+    static constexpr u8 s_prefix_iy = 0xfd;
+
+    std::span<u8 const> m_contention_delays;
+    cyc m_t_states_per_frame;
+    cyc m_interrupt_length;
+    bool m_is_top_slot_contended { false };
+
+    cyc m_frame_t_state { 0 };
+    cyc m_instruction_t_state { 0 };
+    cyc m_wait_states { 0 };
+    bool m_is_opcode_fetch { false };
+    bool m_is_after_index_prefix { false };
+
+    [[nodiscard]] bool is_contended(u16 address) const;
+
+    void contend();
+};
+}
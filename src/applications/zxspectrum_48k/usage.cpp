@@ -13,18 +13,27 @@ static constexpr std::size_t padding_to_description = 20;
 
 const std::vector<std::pair<std::string, std::string>> supported_flags = {
     { "-g", "ordinary, debugging. ordinary is default." },
-    { "--print-header", "Print header of snapshot or tape file." }
+    { "--print-header", "Print header of a .z80 snapshot." },
+    { "--startup-cache", "Skip the RAM test by restoring the state cached by an earlier launch. Ignored when loading a snapshot, and on the 128K." },
+    { "--record", "Record the input to a file, to replay it later." },
+    { "--replay", "Replay recorded input headless, as fast as possible, and print a hash of every frame." }
 };
 const std::vector<std::pair<std::string, std::string>> examples = {
     { "-g debugging", "Running with the debugging GUI, starting with the system ROM only" },
     { "-g debugging mygame.z80", "Running with the debugging GUI, loading and starting mygame.z80 immediately" },
-    { "--print-header mygame.z80", "Print the header of mygame.z80" }
+    { "mygame128.z80", "Running a 128K snapshot, which runs on a 128K even with zx-spectrum-48k" },
+    { "mygame.tzx", "Putting mygame.tzx in the tape recorder, to be loaded with LOAD \"\" (.tap works too)" },
+    { "--print-header mygame.z80", "Print the header of mygame.z80" },
+    { "--startup-cache", "Running the RAM test once, and starting in BASIC right away on later launches" },
+    { "--record=game.inp", "Recording the input to game.inp" },
+    { "--replay=game.inp", "Replaying the input recorded in game.inp" }
 };
 
 void print_usage(std::string const& program_name)
 {
-    std::cout << "\nUsage: ./" << program_name << " run zx-spectrum-48k [FLAGS] [snapshot-or-tape-file]\n\n";
-    std::cout << "Run SX Spectrum 48K on the Z80 CPU\n\n";
+    std::cout << "\nUsage: ./" << program_name << " run zx-spectrum-48k [FLAGS] [snapshot-or-tape-file]\n";
+    std::cout << "       ./" << program_name << " run zx-spectrum-128k [FLAGS] [snapshot-or-tape-file]\n\n";
+    std::cout << "Run SX Spectrum 48K or 128K on the Z80 CPU. The model follows the snapshot when one is loaded.\n\n";
 
     std::cout << "Flags:\n";
 
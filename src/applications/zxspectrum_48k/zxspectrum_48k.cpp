@@ -1,17 +1,33 @@
 #include "zxspectrum_48k.h"
-#include "crosscutting/util/file_util.h"
+#include "audio.h"
+#include "chips/ay_3_8912/ay_3_8912.h"
+#include "crosscutting/memory/mapped_file.h"
+#include "crosscutting/exceptions/unsupported_exception.h"
+#include "crosscutting/misc/startup_cache.h"
+#include "crosscutting/util/hash_util.h"
+#include "formats/tap_format.h"
+#include "formats/tzx_format.h"
 #include "formats/z80_format.h"
 #include "gui.h"
+#include "gui_headless.h"
 #include "gui_imgui.h"
 #include "gui_sdl.h"
 #include "input_imgui.h"
 #include "input_sdl.h"
 #include "interfaces/format.h"
+#include "interfaces/memory_map.h"
+#include "memory_map_for_zxspectrum_128k.h"
 #include "memory_map_for_zxspectrum_48k.h"
+#include "model.h"
 #include "settings.h"
+#include "tape.h"
+#include "ula_timing.h"
 #include "zxspectrum_48k_print_header_session.h"
 #include "zxspectrum_48k_session.h"
+#include <algorithm>
+#include <cctype>
 #include <cstddef>
+#include <filesystem>
 #include <string>
 #include <utility>
 #include <vector>
@@ -22,10 +38,13 @@ class Session;
 
 namespace emu::applications::zxspectrum_48k {
 
-using emu::util::file::read_file_into_vector;
+using emu::exceptions::UnsupportedException;
+using emu::memory::MappedFile;
+using emu::util::hash::fnv1a;
 
 ZxSpectrum48k::ZxSpectrum48k(Settings settings, const GuiType gui_type)
     : m_settings(std::move(settings))
+    , m_model(m_settings.m_model)
 {
     if (m_settings.m_is_only_printing_header) {
         setup_printing_session();
@@ -34,14 +53,34 @@ ZxSpectrum48k::ZxSpectrum48k(Settings settings, const GuiType gui_type)
     }
 }
 
+/**
+ * @param path is the path to the file that is loaded
+ * @return the extension of the file in lower case, like ".tap"
+ */
+static std::string extension(std::string const& path)
+{
+    std::string extension = std::filesystem::path(path).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return std::tolower(c); });
+
+    return extension;
+}
+
 void ZxSpectrum48k::setup_printing_session()
 {
+    if (extension(m_settings.m_snapshot_file) != ".z80") {
+        throw UnsupportedException("Only the header of .z80 snapshots can be printed");
+    }
+
     m_format = std::make_shared<Z80Format>(m_settings.m_snapshot_file);
 }
 
 void ZxSpectrum48k::setup_ordinary_session(const GuiType gui_type)
 {
-    if (gui_type == GuiType::DEBUGGING) {
+    if (!m_settings.m_replay_file.empty()) {
+        m_gui = std::make_shared<GuiHeadless>();
+        m_input = std::make_shared<InputSdl>();
+        m_is_starting_paused = false;
+    } else if (gui_type == GuiType::DEBUGGING) {
         m_gui = std::make_shared<GuiImgui>();
         m_input = std::make_shared<InputImgui>();
         m_is_starting_paused = true;
@@ -51,25 +90,84 @@ void ZxSpectrum48k::setup_ordinary_session(const GuiType gui_type)
         m_is_starting_paused = false;
     }
 
-    load_files();
-
     if (!m_settings.m_snapshot_file.empty()) {
-        load_snapshot();
+        load_snapshot_or_tape();
     }
 
-    m_memory_mapped_io = std::make_shared<MemoryMapForZxSpectrum48k>(m_memory);
-    m_memory.attach_memory_mapper(m_memory_mapped_io);
+    m_ula_timing = std::make_shared<UlaTiming>(m_model);
+
+    if (m_model == Model::_128k) {
+        setup_128k();
+    } else {
+        setup_48k();
+    }
+
+    m_memory.attach_memory_mapper(m_memory_map);
     m_gui->create_table();
 }
 
+/**
+ * Tapes are put in the tape recorder of a machine that has started up like normal, so they are
+ * loaded with LOAD "". Snapshots replace the machine, including which model it is.
+ */
+void ZxSpectrum48k::load_snapshot_or_tape()
+{
+    const std::string file_extension = extension(m_settings.m_snapshot_file);
+    const cyc t_states_per_ms = m_model == Model::_128k ? UlaTiming::s_t_states_per_ms_128k : UlaTiming::s_t_states_per_ms_48k;
+
+    if (file_extension == ".tap") {
+        m_tape = std::make_shared<Tape>(TapFormat(m_settings.m_snapshot_file).blocks(), t_states_per_ms);
+    } else if (file_extension == ".tzx") {
+        m_tape = std::make_shared<Tape>(TzxFormat(m_settings.m_snapshot_file).blocks(), t_states_per_ms);
+    } else {
+        m_format = std::make_shared<Z80Format>(m_settings.m_snapshot_file);
+        m_model = m_format->model();
+    }
+}
+
+void ZxSpectrum48k::setup_48k()
+{
+    load_files();
+
+    if (m_format) {
+        m_format->to_memory(m_memory);
+    } else if (m_settings.m_is_using_startup_cache) {
+        const u64 rom_hash = fnv1a(m_memory.begin(), s_address_rom_end + 1);
+        m_startup_cache = std::make_shared<StartupCache>("cache", "zxspectrum_48k", rom_hash);
+    }
+
+    m_memory_map = std::make_shared<MemoryMapForZxSpectrum48k>(m_memory, m_ula_timing);
+}
+
+/**
+ * The banks are in the memory map, so the memory only tells the CPU how large the address space is.
+ * The startup cache only knows where the 48K ROM waits for a key, so it's not used on the 128K.
+ */
+void ZxSpectrum48k::setup_128k()
+{
+    m_memory.add(std::vector<u8>(s_memory_size, 0));
+
+    auto memory_map = std::make_shared<MemoryMapForZxSpectrum128k>(
+        std::make_shared<MappedFile const>("roms/z80/zxspectrum_128k/128k.rom"),
+        m_ula_timing);
+    m_sound_chip = std::make_shared<Ay38912>(s_sound_chip_frequency_128k, Audio::s_sdl_frequency);
+
+    if (m_format) {
+        m_format->to_memory(*memory_map);
+        m_format->to_sound_chip(*m_sound_chip);
+    }
+
+    m_memory_map = memory_map;
+}
+
 std::unique_ptr<Session> ZxSpectrum48k::new_session()
 {
     if (m_settings.m_is_only_printing_header) {
         return std::make_unique<ZxSpectrum48kPrintHeaderSession>(m_format);
-    } else if (!m_settings.m_snapshot_file.empty()) {
-        return std::make_unique<ZxSpectrum48kSession>(m_settings, m_is_starting_paused, m_gui, m_input, m_memory, m_format->to_cpu_state());
+    } else if (m_format) {
+        return std::make_unique<ZxSpectrum48kSession>(m_settings, m_is_starting_paused, m_gui, m_input, m_memory, m_memory_map, m_ula_timing, m_sound_chip, m_tape, m_format->to_cpu_state());
     } else {
-        return std::make_unique<ZxSpectrum48kSession>(m_settings, m_is_starting_paused, m_gui, m_input, m_memory);
+        return std::make_unique<ZxSpectrum48kSession>(m_settings, m_is_starting_paused, m_gui, m_input, m_memory, m_memory_map, m_ula_timing, m_sound_chip, m_tape, m_startup_cache);
     }
 }
 
@@ -82,20 +180,13 @@ std::vector<u8> create_empty_vector(std::size_t size)
 void ZxSpectrum48k::load_files()
 {
     const std::string directory = "roms/z80/zxspectrum_48k/";
-    m_memory.add(read_file_into_vector(directory + "48k.rom")); // $0000-$3fff: 48k.rom
-    m_memory.add(create_empty_vector(0x57ff - 0x4000 + 1));     // $4000-$57ff: video RAM
-    m_memory.add(create_empty_vector(0x5aff - 0x5800 + 1));     // $5800-$5aff: video RAM (color data)
-    m_memory.add(create_empty_vector(0x5bff - 0x5b00 + 1));     // $5b00-$5bff: printer buffer
-    m_memory.add(create_empty_vector(0x5cbf - 0x5c00 + 1));     // $5c00-$5cbf: system variables
-    m_memory.add(create_empty_vector(0x5cca - 0x5cc0 + 1));     // $5cc0-$5cca: reserved
-    m_memory.add(create_empty_vector(0xff57 - 0x5ccb + 1));     // $5ccb-$ff57: RAM
-    m_memory.add(create_empty_vector(0xffff - 0xff58 + 1));     // $ff58-$ffff: reserved
-}
-
-void ZxSpectrum48k::load_snapshot()
-{
-
-    m_format = std::make_shared<Z80Format>(m_settings.m_snapshot_file);
-    m_format->to_memory(m_memory);
+    m_memory.add(MappedFile(directory + "48k.rom").bytes()); // $0000-$3fff: 48k.rom
+    m_memory.add(create_empty_vector(0x57ff - 0x4000 + 1));  // $4000-$57ff: video RAM
+    m_memory.add(create_empty_vector(0x5aff - 0x5800 + 1));  // $5800-$5aff: video RAM (color data)
+    m_memory.add(create_empty_vector(0x5bff - 0x5b00 + 1));  // $5b00-$5bff: printer buffer
+    m_memory.add(create_empty_vector(0x5cbf - 0x5c00 + 1));  // $5c00-$5cbf: system variables
+    m_memory.add(create_empty_vector(0x5cca - 0x5cc0 + 1));  // $5cc0-$5cca: reserved
+    m_memory.add(create_empty_vector(0xff57 - 0x5ccb + 1));  // $5ccb-$ff57: RAM
+    m_memory.add(create_empty_vector(0xffff - 0xff58 + 1));  // $ff58-$ffff: reserved
 }
 }
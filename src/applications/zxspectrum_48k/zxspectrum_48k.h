@@ -1,27 +1,37 @@
 #pragma once
 
+#include "audio.h"
 #include "crosscutting/gui/gui_type.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/misc/emulator.h"
 #include "crosscutting/typedefs.h"
 #include "settings.h"
+#include "ula_timing.h"
 #include "zxspectrum_48k_session.h"
+#include <cstddef>
 #include <memory>
 
+namespace emu::ay {
+class Ay38912;
+}
 namespace emu::applications::zxspectrum_48k {
 class Format;
 class Gui;
 class Input;
-class MemoryMapForZxSpectrum48k;
+class MemoryMap;
+class Tape;
 }
 namespace emu::misc {
 class Session;
+class StartupCache;
 }
 
 namespace emu::applications::zxspectrum_48k {
 
+using emu::ay::Ay38912;
 using emu::gui::GuiType;
 using emu::misc::Emulator;
+using emu::misc::StartupCache;
 
 class ZxSpectrum48k : public Emulator {
 public:
@@ -32,20 +42,33 @@ public:
     std::unique_ptr<Session> new_session() override;
 
 private:
+    static constexpr std::size_t s_address_rom_end = 0x3fff;
+    static constexpr std::size_t s_memory_size = 0xffff + 1;
+    static constexpr u32 s_sound_chip_frequency_128k = static_cast<u32>(UlaTiming::s_t_states_per_frame_128k * Audio::s_fps / Audio::s_t_states_per_sound_chip_cycle); // Half the CPU clock, at the speed frames are run at
+
     Settings m_settings;
     EmulatorMemory<u16, u8> m_memory;
     std::shared_ptr<Gui> m_gui;
     std::shared_ptr<Input> m_input;
     bool m_is_starting_paused;
-    std::shared_ptr<MemoryMapForZxSpectrum48k> m_memory_mapped_io;
+    Model m_model;
+    std::shared_ptr<UlaTiming> m_ula_timing;
+    std::shared_ptr<MemoryMap> m_memory_map;
+    std::shared_ptr<Ay38912> m_sound_chip; // Only on the 128K
     std::shared_ptr<Format> m_format;
+    std::shared_ptr<Tape> m_tape;
+    std::shared_ptr<StartupCache> m_startup_cache;
 
     void setup_printing_session();
 
     void setup_ordinary_session(const GuiType gui_type);
 
-    void load_files();
+    void load_snapshot_or_tape();
 
-    void load_snapshot();
+    void setup_48k();
+
+    void setup_128k();
+
+    void load_files();
 };
 }
@@ -1,30 +1,39 @@
 #include "zxspectrum_48k_session.h"
 #include "audio.h"
+#include "chips/ay_3_8912/ay_3_8912.h"
 #include "chips/z80/cpu.h"
 #include "chips/z80/disassembler.h"
 #include "chips/z80/interrupt_mode.h"
 #include "chips/z80/manual_state.h"
 #include "cpu_io.h"
+#include "crosscutting/debugging/advanced_disassembler.h"
 #include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/debugging/debugger.h"
-#include "crosscutting/debugging/disassembled_line.h"
+#include "crosscutting/debugging/decoded_instruction.h"
 #include "crosscutting/logging/logger.h"
+#include "crosscutting/memory/dirty_ranges.h"
 #include "crosscutting/memory/emulator_memory.h"
+#include "crosscutting/misc/input_movie.h"
+#include "crosscutting/misc/startup_cache.h"
 #include "crosscutting/util/byte_util.h"
 #include "crosscutting/util/string_util.h"
 #include "gui.h"
 #include "gui_request.h"
 #include "interfaces/input.h"
+#include "interfaces/memory_map.h"
 #include "interfaces/state.h"
 #include "key_request.h"
+#include "settings.h"
 #include "states/paused_state.h"
 #include "states/running_state.h"
 #include "states/state_context.h"
 #include "states/stepping_state.h"
 #include "states/stopped_state.h"
-#include <algorithm>
+#include "tape.h"
+#include "ula_timing.h"
+#include <cstddef>
+#include <cstdint>
 #include <iosfwd>
-#include <iterator>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -36,31 +45,57 @@ class Settings;
 
 namespace emu::applications::zxspectrum_48k {
 
+using emu::debugger::AdvancedDisassembler;
+using emu::debugger::DisassemblyDebugContainer;
 using emu::debugger::FlagRegisterDebugContainer;
 using emu::debugger::IoDebugContainer;
 using emu::debugger::MemoryDebugContainer;
 using emu::debugger::RegisterDebugContainer;
+using emu::debugger::format_data_byte;
+using emu::debugger::format_instruction;
 using emu::util::byte::high_byte;
 using emu::util::byte::is_bit_set;
+using emu::util::byte::low_byte;
 using emu::util::byte::to_u16;
+using emu::util::byte::unset_bit;
 using emu::util::string::hexify;
-using emu::util::string::split;
 using emu::z80::Disassembler;
 using emu::z80::InterruptMode;
 
 ZxSpectrum48kSession::ZxSpectrum48kSession(
-    [[maybe_unused]] Settings const& settings,
+    Settings const& settings,
     bool is_starting_paused,
     std::shared_ptr<Gui> gui,
     std::shared_ptr<Input> input,
-    EmulatorMemory<u16, u8>& memory)
-    : m_gui(std::move(gui))
+    EmulatorMemory<u16, u8>& memory,
+    std::shared_ptr<MemoryMap> memory_map,
+    std::shared_ptr<UlaTiming> ula_timing,
+    std::shared_ptr<Ay38912> sound_chip,
+    std::shared_ptr<Tape> tape,
+    std::shared_ptr<StartupCache> startup_cache)
+    : m_is_replaying(!settings.m_replay_file.empty())
+    , m_gui(std::move(gui))
     , m_input(std::move(input))
+    , m_audio(ula_timing->t_states_per_frame(), sound_chip)
     , m_memory(memory)
+    , m_memory_map(std::move(memory_map))
+    , m_ula_timing(std::move(ula_timing))
+    , m_sound_chip(std::move(sound_chip))
+    , m_tape(std::move(tape))
     , m_logger(std::make_shared<Logger>())
     , m_debugger(std::make_shared<Debugger<u16, 16>>())
+    , m_record_file(settings.m_record_file)
+    , m_governor(Governor(m_is_replaying ? 0 : s_tick_limit, sdl_get_ticks_high_performance))
 {
+    if (m_is_replaying) {
+        m_input_movie = std::make_shared<InputMovie>(settings.m_replay_file);
+    } else if (!settings.m_record_file.empty()) {
+        m_input_movie = std::make_shared<InputMovie>();
+    }
+
     setup_cpu();
+    setup_ports();
+    setup_hooks();
     setup_debugging();
 
     m_gui->add_gui_observer(*this);
@@ -72,18 +107,29 @@ ZxSpectrum48kSession::ZxSpectrum48kSession(
         m_gui,
         m_input,
         m_cpu,
-        m_memory,
+        m_memory_map,
+        m_ula_timing,
+        m_audio,
+        m_tape,
+        m_hooks,
         m_logger,
         m_debugger,
         m_debug_container,
         m_outputs_during_cycle,
         m_governor,
+        m_rewind_buffer,
+        m_input_movie,
         m_is_in_debug_mode);
-    m_state_context->set_running_state(std::make_shared<RunningState>(m_state_context));
+    auto running_state = std::make_shared<RunningState>(m_state_context);
+    m_state_context->set_running_state(running_state);
     m_state_context->set_paused_state(std::make_shared<PausedState>(m_state_context));
     m_state_context->set_stepping_state(std::make_shared<SteppingState>(m_state_context));
     m_state_context->set_stopped_state(std::make_shared<StoppedState>(m_state_context));
 
+    if (startup_cache) {
+        start_from_startup_cache(*startup_cache, *running_state);
+    }
+
     if (is_starting_paused) {
         m_state_context->change_state(m_state_context->paused_state());
     } else {
@@ -97,8 +143,12 @@ ZxSpectrum48kSession::ZxSpectrum48kSession(
     std::shared_ptr<Gui> gui,
     std::shared_ptr<Input> input,
     EmulatorMemory<u16, u8>& memory,
+    std::shared_ptr<MemoryMap> memory_map,
+    std::shared_ptr<UlaTiming> ula_timing,
+    std::shared_ptr<Ay38912> sound_chip,
+    std::shared_ptr<Tape> tape,
     ManualState initial_cpu_state)
-    : ZxSpectrum48kSession(settings, is_starting_paused, std::move(gui), std::move(input), memory)
+    : ZxSpectrum48kSession(settings, is_starting_paused, std::move(gui), std::move(input), memory, std::move(memory_map), std::move(ula_timing), std::move(sound_chip), std::move(tape), nullptr)
 {
     m_cpu->set_state_manually(initial_cpu_state);
 }
@@ -120,6 +170,10 @@ void ZxSpectrum48kSession::run()
     while (!m_state_context->current_state()->is_exit_state()) {
         m_state_context->current_state()->perform(cycles);
     }
+
+    if (!m_record_file.empty()) {
+        m_input_movie->save(m_record_file);
+    }
 }
 
 void ZxSpectrum48kSession::pause()
@@ -142,6 +196,26 @@ void ZxSpectrum48kSession::setup_cpu()
     m_cpu->add_in_observer(*this);
 }
 
+/**
+ * The ULA only looks at A0, and the sound chip of the 128K at A15, A14 and A1, so every port that
+ * matches is theirs. The paging port of the 128K is decoded by the memory map.
+ */
+void ZxSpectrum48kSession::setup_ports()
+{
+    m_port_decoder.add(Device::Ula, s_ula_port_mask, s_ula_port);
+    if (m_sound_chip) {
+        m_port_decoder.add(Device::SoundChipRegister, s_sound_chip_port_mask, s_sound_chip_register_port);
+        m_port_decoder.add(Device::SoundChipData, s_sound_chip_port_mask, s_sound_chip_data_port);
+    }
+}
+
+void ZxSpectrum48kSession::setup_hooks()
+{
+    if (m_tape) {
+        m_hooks.add_hook(Tape::s_address_ld_bytes, [&]() { return ld_bytes(); });
+    }
+}
+
 void ZxSpectrum48kSession::setup_debugging()
 {
     m_debug_container = std::make_shared<DebugContainer<u16, u8, 16>>();
@@ -185,7 +259,7 @@ void ZxSpectrum48kSession::setup_debugging()
     m_debug_container->add_io(IoDebugContainer<u8>(
         "LAST-K",
         [&]() { return true; },
-        [&]() { return memory().at(0x5c08); }));
+        [&]() { return m_memory_map->peek(s_address_last_k); }));
     m_debug_container->add_io(IoDebugContainer<u8>(
         "IFF1",
         [&]() { return true; },
@@ -195,8 +269,27 @@ void ZxSpectrum48kSession::setup_debugging()
         [&]() { return true; },
         [&]() { return m_cpu->iff2() ? 1 : 0; }));
     m_debug_container->add_memory(MemoryDebugContainer<u8>(
-        [&]() { return memory(); }));
-    m_debug_container->add_disassembled_program(disassemble_program());
+        [&]() { return memory(); },
+        [&](std::size_t address, u8 value) { m_memory.write(static_cast<u16>(address), value); }));
+    m_advanced_disassembler = std::make_shared<AdvancedDisassembler>(
+        0,
+        0xffff,
+        [&](u16 address) { return Disassembler::decode(m_memory, address); },
+        std::vector<u16> { 0x0000, 0x0038, 0x0066 }); // The reset vector, the IM 1 interrupt and NMI
+    m_debug_container->add_disassembly(DisassemblyDebugContainer<u16, u8>(
+        [&]() -> std::vector<u16> const& {
+            track_memory_changes(true); // The disassembly is shown
+            m_advanced_disassembler->add_entry_point(m_cpu->pc());
+            return m_advanced_disassembler->addresses();
+        },
+        [&](EmulatorMemory<u16, u8> const& memory, u16 address) { return Disassembler::decode(memory, address); },
+        [&](EmulatorMemory<u16, u8> const& memory, u16 address, std::string& line) {
+            if (m_advanced_disassembler->is_code(address)) {
+                format_instruction(Disassembler::decode(memory, address), line);
+            } else {
+                format_data_byte(address, memory.read(address), line);
+            }
+        }));
 
     m_gui->attach_debugger(m_debugger);
     m_gui->attach_debug_container(m_debug_container);
@@ -204,6 +297,58 @@ void ZxSpectrum48kSession::setup_debugging()
     m_gui->attach_logger(m_logger);
 }
 
+/**
+ * Only the disassembly needs to know what has changed in the memory, and marking every write costs
+ * time, so the changes are only tracked while the debugger or the disassembly is in use. Nothing is
+ * known about what changed in between, so all of the memory is marked when the tracking starts.
+ */
+void ZxSpectrum48kSession::track_memory_changes(bool is_tracking)
+{
+    if (is_tracking == (m_dirty_ranges != nullptr)) {
+        return;
+    }
+
+    if (is_tracking) {
+        m_dirty_ranges = std::make_shared<DirtyRanges>(s_memory_size);
+        m_dirty_ranges->mark(0, s_memory_size - 1);
+    } else {
+        m_dirty_ranges.reset();
+    }
+    m_memory.attach_dirty_ranges(m_dirty_ranges);
+    m_memory_map->attach_dirty_ranges(m_dirty_ranges);
+    m_advanced_disassembler->attach_dirty_ranges(m_dirty_ranges);
+}
+
+/**
+ * Skips the RAM test and the rest of the startup by restoring the state the machine had when it
+ * reached the BASIC editor the last time. If nothing is cached yet, the startup is run right away,
+ * as fast as possible, and the state in the BASIC editor is cached for the next launch.
+ */
+void ZxSpectrum48kSession::start_from_startup_cache(StartupCache const& startup_cache, RunningState& running_state)
+{
+    std::vector<u8> initial_state;
+    running_state.save_state(initial_state);
+
+    std::vector<u8> state;
+    if (startup_cache.load(state) && state.size() == initial_state.size()) {
+        running_state.load_state(state);
+        m_logger->info("Restored the startup state from %s", startup_cache.path().c_str());
+        return;
+    }
+
+    if (!running_state.run_until_ready(s_max_startup_frames)) {
+        m_logger->info("The BASIC editor was not reached after %u frames, so the startup state is not cached", s_max_startup_frames);
+        return;
+    }
+
+    running_state.save_state(state);
+    if (startup_cache.store(state)) {
+        m_logger->info("Cached the startup state in %s", startup_cache.path().c_str());
+    } else {
+        m_logger->info("Could not cache the startup state in %s", startup_cache.path().c_str());
+    }
+}
+
 void ZxSpectrum48kSession::gui_request(GuiRequest request)
 {
     switch (request.m_type) {
@@ -218,38 +363,61 @@ void ZxSpectrum48kSession::gui_request(GuiRequest request)
         break;
     case DEBUG_MODE:
         m_is_in_debug_mode = request.m_payload;
+        track_memory_changes(m_is_in_debug_mode);
         break;
     }
 }
 
 void ZxSpectrum48kSession::in_requested(u16 port)
 {
-    // Should take 12.5 cycles instead of 11, when accessing 0xFE.
-    if (!is_bit_set(port, 0)) {
-        m_cpu->input(port, m_cpu_io.keyboard_input(port));
+    m_ula_timing->io_access(port);
+
+    switch (m_port_decoder.decode(port)) {
+    case Device::Ula: {
+        u8 value = m_cpu_io.keyboard_input(port);
+        if (m_tape && !m_tape->ear()) {
+            unset_bit(value, s_ear_bit);
+        }
+        m_cpu->input(port, value);
+        break;
+    }
+    case Device::SoundChipRegister:
+        m_cpu->input(port, m_sound_chip->read_register());
+        break;
+    case Device::SoundChipData:
+    case Device::None:
+        break;
     }
 }
 
 void ZxSpectrum48kSession::out_changed(u16 port)
 {
-    if (!m_outputs_during_cycle.contains(port)) {
-        m_outputs_during_cycle[port] = m_cpu->a();
-    } else {
-        m_outputs_during_cycle[port] |= m_cpu->a();
+    m_ula_timing->io_access(port);
+
+    m_outputs_during_cycle.capture(low_byte(port), m_cpu->a());
+
+    if (m_memory_map->out_changed(port, m_cpu->a())) {
+        return;
     }
 
-    switch (port) { // NOLINT
-    case s_port_0xfe:
+    switch (m_port_decoder.decode(port)) {
+    case Device::Ula:
         m_cpu_io.m_out_port0xfe = m_cpu->a();
-        if (is_bit_set(m_cpu_io.m_out_port0xfe, s_mic_bit)) {
-            // MIC out
-        }
-        if (is_bit_set(m_cpu_io.m_out_port0xfe, s_beep_bit)) {
-            m_audio.beep();
+        if (!m_is_replaying) {
+            m_audio.beep(
+                is_bit_set(m_cpu_io.m_out_port0xfe, s_beep_bit),
+                is_bit_set(m_cpu_io.m_out_port0xfe, s_mic_bit),
+                m_ula_timing->frame_t_state());
         }
         break;
-    default:
-        throw std::runtime_error("Illegal output port for ZX Spectrum 48k");
+    case Device::SoundChipRegister:
+        m_sound_chip->select_register(m_cpu->a());
+        break;
+    case Device::SoundChipData:
+        m_sound_chip->write_register(m_cpu->a(), m_ula_timing->frame_t_state() / Audio::s_t_states_per_sound_chip_cycle);
+        break;
+    case Device::None:
+        break;
     }
 }
 
@@ -264,28 +432,38 @@ void ZxSpectrum48kSession::key_pressed(KeyRequest request)
     }
 }
 
-std::vector<u8> ZxSpectrum48kSession::memory()
+/**
+ * The 128K pages its memory, so what the CPU sees is copied into a buffer that stays the same
+ * between frames, which is what the debugger looks at.
+ */
+std::span<u8 const> ZxSpectrum48kSession::memory()
 {
-    return { m_memory.begin(), m_memory.end() };
+    m_memory_map->copy(m_debug_memory);
+
+    return m_debug_memory;
 }
 
-std::vector<DisassembledLine<u16, 16>> ZxSpectrum48kSession::disassemble_program()
+/**
+ * Loads the next block from the tape in place of LD-BYTES. The block is written past the CPU, so
+ * where it was loaded to is marked here for the disassembler.
+ *
+ * @return the cycles of LD-BYTES, which are none because the block is loaded at once
+ */
+cyc ZxSpectrum48kSession::ld_bytes()
 {
-    EmulatorMemory<u16, u8> sliced_for_disassembly = m_memory.slice(0, 0x4000);
-
-    std::stringstream ss;
-    Disassembler disassembler(sliced_for_disassembly, ss);
-    disassembler.disassemble();
-
-    std::vector<std::string> disassembled_program = split(ss, "\n");
-
-    disassembled_program.erase(
-        std::remove_if(disassembled_program.begin(), disassembled_program.end(), [](std::string const& s) { return s.empty(); }));
+    const u16 first = m_cpu->ix();
+    if (!m_tape->ld_bytes(*m_cpu, *m_memory_map) || m_cpu->ix() == first) {
+        return 0;
+    }
 
-    std::vector<DisassembledLine<u16, 16>> lines;
-    std::transform(disassembled_program.begin(), disassembled_program.end(), std::back_inserter(lines),
-        [](std::string const& line) { return DisassembledLine<u16, 16>(line); });
+    const u16 last = static_cast<u16>(m_cpu->ix() - 1);
+    if (first <= last) {
+        m_memory.mark_dirty(first, last);
+    } else { // The block was loaded past the end of the memory
+        m_memory.mark_dirty(first, UINT16_MAX);
+        m_memory.mark_dirty(0, last);
+    }
 
-    return lines;
+    return 0;
 }
 }
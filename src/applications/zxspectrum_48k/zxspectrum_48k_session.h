@@ -5,6 +5,9 @@
 #include "chips/z80/interfaces/out_observer.h"
 #include "cpu_io.h"
 #include "crosscutting/misc/governor.h"
+#include "crosscutting/misc/hook_table.h"
+#include "crosscutting/misc/port_decoder.h"
+#include "crosscutting/misc/rewind_buffer.h"
 #include "crosscutting/misc/sdl_counter.h"
 #include "crosscutting/misc/session.h"
 #include "crosscutting/typedefs.h"
@@ -15,23 +18,30 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
-#include <unordered_map>
+#include <span>
+#include <string>
 #include <vector>
 
+namespace emu::ay {
+class Ay38912;
+}
 namespace emu::applications::zxspectrum_48k {
 class Gui;
 class Input;
+class MemoryMap;
+class RunningState;
 class Settings;
 class StateContext;
+class Tape;
+class UlaTiming;
 struct GuiRequest;
 }
 namespace emu::debugger {
+class AdvancedDisassembler;
 template<class A, class D, std::size_t B>
 class DebugContainer;
 template<class A, std::size_t B>
 class Debugger;
-template<class A, std::size_t B>
-class DisassembledLine;
 }
 namespace emu::z80 {
 class Cpu;
@@ -41,20 +51,33 @@ namespace emu::logging {
 class Logger;
 }
 namespace emu::memory {
+class DirtyRanges;
 template<class A, class D>
 class EmulatorMemory;
 }
+namespace emu::misc {
+class InputMovie;
+class StartupCache;
+}
 
 namespace emu::applications::zxspectrum_48k {
 
+using emu::ay::Ay38912;
+using emu::debugger::AdvancedDisassembler;
 using emu::debugger::DebugContainer;
 using emu::debugger::Debugger;
-using emu::debugger::DisassembledLine;
 using emu::logging::Logger;
+using emu::memory::DirtyRanges;
 using emu::memory::EmulatorMemory;
 using emu::misc::Governor;
+using emu::misc::HookTable;
+using emu::misc::InputMovie;
+using emu::misc::PortCapture;
+using emu::misc::PortDecoder;
+using emu::misc::RewindBuffer;
 using emu::misc::sdl_get_ticks_high_performance;
 using emu::misc::Session;
+using emu::misc::StartupCache;
 using emu::z80::Cpu;
 using emu::z80::InObserver;
 using emu::z80::OutObserver;
@@ -72,7 +95,12 @@ public:
         bool is_starting_paused,
         std::shared_ptr<Gui> gui,
         std::shared_ptr<Input> input,
-        EmulatorMemory<u16, u8>& memory);
+        EmulatorMemory<u16, u8>& memory,
+        std::shared_ptr<MemoryMap> memory_map,
+        std::shared_ptr<UlaTiming> ula_timing,
+        std::shared_ptr<Ay38912> sound_chip,
+        std::shared_ptr<Tape> tape,
+        std::shared_ptr<StartupCache> startup_cache);
 
     ZxSpectrum48kSession(
         Settings const& settings,
@@ -80,6 +108,10 @@ public:
         std::shared_ptr<Gui> gui,
         std::shared_ptr<Input> input,
         EmulatorMemory<u16, u8>& memory,
+        std::shared_ptr<MemoryMap> memory_map,
+        std::shared_ptr<UlaTiming> ula_timing,
+        std::shared_ptr<Ay38912> sound_chip,
+        std::shared_ptr<Tape> tape,
         ManualState initial_cpu_state);
 
     ~ZxSpectrum48kSession() override;
@@ -102,40 +134,81 @@ private:
     // Game loop - begin
     static constexpr long double s_fps = 50.0L;
     static constexpr long double s_tick_limit = 1000.0L / s_fps;
+    static constexpr std::size_t s_rewind_memory_cap = 4 * 1024 * 1024;
+    static constexpr std::size_t s_rewind_keyframe_interval = static_cast<std::size_t>(s_fps);
+    static constexpr unsigned int s_max_startup_frames = static_cast<unsigned int>(10 * s_fps);
     // Game loop - end
 
     // IO - begin
     static constexpr u8 s_port_0xfe = 0xfe;
+    static constexpr u16 s_ula_port_mask = 0x0001; // The ULA answers every even port
+    static constexpr u16 s_ula_port = 0x0000;
+    static constexpr u16 s_sound_chip_port_mask = 0xc002;
+    static constexpr u16 s_sound_chip_register_port = 0xc000; // $fffd
+    static constexpr u16 s_sound_chip_data_port = 0x8000;     // $bffd
     static constexpr unsigned int s_mic_bit = 3;
     static constexpr unsigned int s_beep_bit = 4;
+    static constexpr unsigned int s_ear_bit = 6;
     // IO - end
 
+    static constexpr std::size_t s_memory_size = 0xffff + 1;
+    static constexpr u16 s_address_last_k = 0x5c08;
+
+    enum class Device {
+        None,
+        Ula,
+        SoundChipRegister,
+        SoundChipData
+    };
+
     bool m_is_in_debug_mode { false };
+    bool m_is_replaying;
 
     CpuIo m_cpu_io;
     GuiIo m_gui_io;
+    PortDecoder<Device> m_port_decoder { Device::None };
     std::shared_ptr<Gui> m_gui;
     std::shared_ptr<Input> m_input;
     std::shared_ptr<Cpu> m_cpu;
     Audio m_audio;
 
     EmulatorMemory<u16, u8>& m_memory;
+    std::shared_ptr<MemoryMap> m_memory_map;
+    std::shared_ptr<UlaTiming> m_ula_timing;
+    std::shared_ptr<Ay38912> m_sound_chip;
+    std::shared_ptr<Tape> m_tape;
+    HookTable m_hooks;
 
     std::shared_ptr<Logger> m_logger;
     std::shared_ptr<Debugger<u16, 16>> m_debugger;
     std::shared_ptr<DebugContainer<u16, u8, 16>> m_debug_container;
-    std::unordered_map<u8, u8> m_outputs_during_cycle;
+    std::shared_ptr<AdvancedDisassembler> m_advanced_disassembler;
+    std::shared_ptr<DirtyRanges> m_dirty_ranges;
+    PortCapture m_outputs_during_cycle;
+    std::vector<u8> m_debug_memory = std::vector<u8>(s_memory_size);
 
-    Governor m_governor { Governor(s_tick_limit, sdl_get_ticks_high_performance) };
+    std::shared_ptr<InputMovie> m_input_movie;
+    std::string m_record_file;
+
+    Governor m_governor;
+    RewindBuffer m_rewind_buffer { RewindBuffer(s_rewind_memory_cap, s_rewind_keyframe_interval) };
 
     std::shared_ptr<StateContext> m_state_context;
 
     void setup_cpu();
 
+    void setup_ports();
+
+    void setup_hooks();
+
     void setup_debugging();
 
-    std::vector<u8> memory();
+    void track_memory_changes(bool is_tracking);
+
+    void start_from_startup_cache(StartupCache const& startup_cache, RunningState& running_state);
+
+    std::span<u8 const> memory();
 
-    std::vector<DisassembledLine<u16, 16>> disassemble_program();
+    cyc ld_bytes();
 };
 }
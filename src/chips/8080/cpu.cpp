@@ -1,17 +1,23 @@
 #include "cpu.h"
+#include "crosscutting/benchmarking/benchmark.h"
 #include "crosscutting/exceptions/unrecognized_opcode_exception.h"
 #include "crosscutting/memory/emulator_memory.h"
+#include "crosscutting/misc/state_stream.h"
 #include "crosscutting/util/byte_util.h"
 #include "crosscutting/util/string_util.h"
 #include "instructions/instructions.h"
 #include "interfaces/in_observer.h"
 #include "interfaces/out_observer.h"
+#include "manual_state.h"
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <string>
+#include <vector>
 
 namespace emu::i8080 {
 
+using emu::benchmarking::Bench;
 using emu::exceptions::UnrecognizedOpcodeException;
 using emu::util::byte::to_u16;
 using emu::util::string::hexify;
@@ -30,13 +36,6 @@ Cpu::Cpu(
     , m_opcode(0)
     , m_sp(0)
     , m_pc(initial_pc)
-    , m_acc_reg(0)
-    , m_b_reg(0)
-    , m_c_reg(0)
-    , m_d_reg(0)
-    , m_e_reg(0)
-    , m_h_reg(0)
-    , m_l_reg(0)
 {
 }
 
@@ -77,14 +76,7 @@ bool Cpu::can_run_next_instruction() const
 
 void Cpu::reset_state()
 {
-    m_b_reg = 0;
-    m_c_reg = 0;
-    m_d_reg = 0;
-    m_e_reg = 0;
-    m_h_reg = 0;
-    m_l_reg = 0;
-    m_acc_reg = 0;
-    m_flag_reg.reset();
+    m_registers.reset();
     m_pc = 0;
     m_sp = 0;
     m_is_halted = false;
@@ -104,6 +96,62 @@ void Cpu::stop()
     reset_state();
 }
 
+void Cpu::set_state_manually(ManualState manual_state)
+{
+    m_is_halted = false;
+    m_inte = manual_state.m_inte;
+    m_sp = manual_state.m_sp;
+    m_pc = manual_state.m_pc;
+    m_registers.a() = manual_state.m_acc_reg;
+    m_registers.b() = manual_state.m_b_reg;
+    m_registers.c() = manual_state.m_c_reg;
+    m_registers.d() = manual_state.m_d_reg;
+    m_registers.e() = manual_state.m_e_reg;
+    m_registers.h() = manual_state.m_h_reg;
+    m_registers.l() = manual_state.m_l_reg;
+    m_registers.f().from_u8(manual_state.m_flag_reg.to_u8());
+}
+
+void Cpu::save_state(StateWriter& writer) const
+{
+    writer.write(m_is_halted);
+    writer.write(m_inte);
+    writer.write(m_is_interrupted);
+    writer.write(m_instruction_from_interruptor);
+    writer.write(m_sp);
+    writer.write(m_pc);
+    writer.write(m_registers.a());
+    writer.write(m_registers.b());
+    writer.write(m_registers.c());
+    writer.write(m_registers.d());
+    writer.write(m_registers.e());
+    writer.write(m_registers.h());
+    writer.write(m_registers.l());
+    writer.write(m_registers.f().to_u8());
+    writer.write(m_io_in.data(), m_io_in.size());
+    writer.write(m_io_out.data(), m_io_out.size());
+}
+
+void Cpu::load_state(StateReader& reader)
+{
+    m_is_halted = reader.read<bool>();
+    m_inte = reader.read<bool>();
+    m_is_interrupted = reader.read<bool>();
+    m_instruction_from_interruptor = reader.read<u8>();
+    m_sp = reader.read<u16>();
+    m_pc = reader.read<u16>();
+    m_registers.a() = reader.read<u8>();
+    m_registers.b() = reader.read<u8>();
+    m_registers.c() = reader.read<u8>();
+    m_registers.d() = reader.read<u8>();
+    m_registers.e() = reader.read<u8>();
+    m_registers.h() = reader.read<u8>();
+    m_registers.l() = reader.read<u8>();
+    m_registers.f().from_u8(reader.read<u8>());
+    reader.read(m_io_in.data(), m_io_in.size());
+    reader.read(m_io_out.data(), m_io_out.size());
+}
+
 void Cpu::interrupt(u8 instruction_to_perform)
 {
     m_is_interrupted = true;
@@ -140,145 +188,145 @@ cyc Cpu::next_instruction()
         nop(cycles);
         break;
     case LXI_B:
-        lxi(m_b_reg, m_c_reg, get_next_word(), cycles);
+        lxi(m_registers, RegisterPair::BC, get_next_word(), cycles);
         break;
     case STAX_B:
-        stax(m_acc_reg, m_b_reg, m_c_reg, m_memory, cycles);
+        stax(m_registers.a(), m_registers.b(), m_registers.c(), m_memory, cycles);
         break;
     case INX_B:
-        inx(m_b_reg, m_c_reg, cycles);
+        inx(m_registers, RegisterPair::BC, cycles);
         break;
     case INR_B:
-        inr_r(m_b_reg, m_flag_reg, cycles);
+        inr_r(m_registers.b(), m_registers.f(), cycles);
         break;
     case DCR_B:
-        dcr_r(m_b_reg, m_flag_reg, cycles);
+        dcr_r(m_registers.b(), m_registers.f(), cycles);
         break;
     case MVI_B:
-        mvi_r(m_b_reg, get_next_byte(), cycles);
+        mvi_r(m_registers.b(), get_next_byte(), cycles);
         break;
     case RLC_B:
-        rlc(m_acc_reg, m_flag_reg, cycles);
+        rlc(m_registers.a(), m_registers.f(), cycles);
         break;
     case UNUSED_NOP_1:
         unused_1(m_opcode, cycles);
         break;
     case DAD_B:
-        dad(m_h_reg, m_l_reg, to_u16(m_b_reg, m_c_reg), m_flag_reg, cycles);
+        dad(m_registers.h(), m_registers.l(), m_registers.bc(), m_registers.f(), cycles);
         break;
     case LDAX_B:
-        ldax(m_acc_reg, m_b_reg, m_c_reg, m_memory, cycles);
+        ldax(m_registers.a(), m_registers.b(), m_registers.c(), m_memory, cycles);
         break;
     case DCX_B:
-        dcx(m_b_reg, m_c_reg, cycles);
+        dcx(m_registers, RegisterPair::BC, cycles);
         break;
     case INR_C:
-        inr_r(m_c_reg, m_flag_reg, cycles);
+        inr_r(m_registers.c(), m_registers.f(), cycles);
         break;
     case DCR_C:
-        dcr_r(m_c_reg, m_flag_reg, cycles);
+        dcr_r(m_registers.c(), m_registers.f(), cycles);
         break;
     case MVI_C:
-        mvi_r(m_c_reg, get_next_byte(), cycles);
+        mvi_r(m_registers.c(), get_next_byte(), cycles);
         break;
     case RRC:
-        rrc(m_acc_reg, m_flag_reg, cycles);
+        rrc(m_registers.a(), m_registers.f(), cycles);
         break;
     case UNUSED_NOP_2:
         unused_1(m_opcode, cycles);
         break;
     case LXI_D:
-        lxi(m_d_reg, m_e_reg, get_next_word(), cycles);
+        lxi(m_registers, RegisterPair::DE, get_next_word(), cycles);
         break;
     case STAX_D:
-        stax(m_acc_reg, m_d_reg, m_e_reg, m_memory, cycles);
+        stax(m_registers.a(), m_registers.d(), m_registers.e(), m_memory, cycles);
         break;
     case INX_D:
-        inx(m_d_reg, m_e_reg, cycles);
+        inx(m_registers, RegisterPair::DE, cycles);
         break;
     case INR_D:
-        inr_r(m_d_reg, m_flag_reg, cycles);
+        inr_r(m_registers.d(), m_registers.f(), cycles);
         break;
     case DCR_D:
-        dcr_r(m_d_reg, m_flag_reg, cycles);
+        dcr_r(m_registers.d(), m_registers.f(), cycles);
         break;
     case MVI_D:
-        mvi_r(m_d_reg, get_next_byte(), cycles);
+        mvi_r(m_registers.d(), get_next_byte(), cycles);
         break;
     case RAL:
-        ral(m_acc_reg, m_flag_reg, cycles);
+        ral(m_registers.a(), m_registers.f(), cycles);
         break;
     case UNUSED_NOP_3:
         unused_1(m_opcode, cycles);
         break;
     case DAD_D:
-        dad(m_h_reg, m_l_reg, to_u16(m_d_reg, m_e_reg), m_flag_reg, cycles);
+        dad(m_registers.h(), m_registers.l(), m_registers.de(), m_registers.f(), cycles);
         break;
     case LDAX_D:
-        ldax(m_acc_reg, m_d_reg, m_e_reg, m_memory, cycles);
+        ldax(m_registers.a(), m_registers.d(), m_registers.e(), m_memory, cycles);
         break;
     case DCX_D:
-        dcx(m_d_reg, m_e_reg, cycles);
+        dcx(m_registers, RegisterPair::DE, cycles);
         break;
     case INR_E:
-        inr_r(m_e_reg, m_flag_reg, cycles);
+        inr_r(m_registers.e(), m_registers.f(), cycles);
         break;
     case DCR_E:
-        dcr_r(m_e_reg, m_flag_reg, cycles);
+        dcr_r(m_registers.e(), m_registers.f(), cycles);
         break;
     case MVI_E:
-        mvi_r(m_e_reg, get_next_byte(), cycles);
+        mvi_r(m_registers.e(), get_next_byte(), cycles);
         break;
     case RAR:
-        rar(m_acc_reg, m_flag_reg, cycles);
+        rar(m_registers.a(), m_registers.f(), cycles);
         break;
     case UNUSED_NOP_4:
         unused_1(m_opcode, cycles);
         break;
     case LXI_H:
-        lxi(m_h_reg, m_l_reg, get_next_word(), cycles);
+        lxi(m_registers, RegisterPair::HL, get_next_word(), cycles);
         break;
     case SHLD:
-        shld(m_l_reg, m_h_reg, m_memory, get_next_word(), cycles);
+        shld(m_registers.l(), m_registers.h(), m_memory, get_next_word(), cycles);
         break;
     case INX_H:
-        inx(m_h_reg, m_l_reg, cycles);
+        inx(m_registers, RegisterPair::HL, cycles);
         break;
     case INR_H:
-        inr_r(m_h_reg, m_flag_reg, cycles);
+        inr_r(m_registers.h(), m_registers.f(), cycles);
         break;
     case DCR_H:
-        dcr_r(m_h_reg, m_flag_reg, cycles);
+        dcr_r(m_registers.h(), m_registers.f(), cycles);
         break;
     case MVI_H:
-        mvi_r(m_h_reg, get_next_byte(), cycles);
+        mvi_r(m_registers.h(), get_next_byte(), cycles);
         break;
     case DAA:
-        daa(m_acc_reg, m_flag_reg, cycles);
+        daa(m_registers.a(), m_registers.f(), cycles);
         break;
     case UNUSED_NOP_5:
         unused_1(m_opcode, cycles);
         break;
     case DAD_H:
-        dad(m_h_reg, m_l_reg, to_u16(m_h_reg, m_l_reg), m_flag_reg, cycles);
+        dad(m_registers.h(), m_registers.l(), m_registers.hl(), m_registers.f(), cycles);
         break;
     case LHLD:
-        lhld(m_l_reg, m_h_reg, m_memory, get_next_word(), cycles);
+        lhld(m_registers.l(), m_registers.h(), m_memory, get_next_word(), cycles);
         break;
     case DCX_H:
-        dcx(m_h_reg, m_l_reg, cycles);
+        dcx(m_registers, RegisterPair::HL, cycles);
         break;
     case INR_L:
-        inr_r(m_l_reg, m_flag_reg, cycles);
+        inr_r(m_registers.l(), m_registers.f(), cycles);
         break;
     case DCR_L:
-        dcr_r(m_l_reg, m_flag_reg, cycles);
+        dcr_r(m_registers.l(), m_registers.f(), cycles);
         break;
     case MVI_L:
-        mvi_r(m_l_reg, get_next_byte(), cycles);
+        mvi_r(m_registers.l(), get_next_byte(), cycles);
         break;
     case CMA:
-        cma(m_acc_reg, cycles);
+        cma(m_registers.a(), cycles);
         break;
     case UNUSED_NOP_6:
         unused_1(m_opcode, cycles);
@@ -287,625 +335,625 @@ cyc Cpu::next_instruction()
         lxi_sp(m_sp, get_next_word(), cycles);
         break;
     case STA:
-        sta(m_acc_reg, m_memory, get_next_word(), cycles);
+        sta(m_registers.a(), m_memory, get_next_word(), cycles);
         break;
     case INX_SP:
         inx_sp(m_sp, cycles);
         break;
     case INR_M:
-        inr_m(m_memory, address_in_HL(), m_flag_reg, cycles);
+        inr_m(m_memory, address_in_HL(), m_registers.f(), cycles);
         break;
     case DCR_M:
-        dcr_m(m_memory, address_in_HL(), m_flag_reg, cycles);
+        dcr_m(m_memory, address_in_HL(), m_registers.f(), cycles);
         break;
     case MVI_M:
         mvi_m(m_memory, address_in_HL(), get_next_byte(), cycles);
         break;
     case STC:
-        stc(m_flag_reg, cycles);
+        stc(m_registers.f(), cycles);
         break;
     case UNUSED_NOP_7:
         unused_1(m_opcode, cycles);
         break;
     case DAD_SP:
-        dad(m_h_reg, m_l_reg, m_sp, m_flag_reg, cycles);
+        dad(m_registers.h(), m_registers.l(), m_sp, m_registers.f(), cycles);
         break;
     case LDA:
-        lda(m_acc_reg, m_memory, get_next_word(), cycles);
+        lda(m_registers.a(), m_memory, get_next_word(), cycles);
         break;
     case DCX_SP:
         dcx_sp(m_sp, cycles);
         break;
     case INR_A:
-        inr_r(m_acc_reg, m_flag_reg, cycles);
+        inr_r(m_registers.a(), m_registers.f(), cycles);
         break;
     case DCR_A:
-        dcr_r(m_acc_reg, m_flag_reg, cycles);
+        dcr_r(m_registers.a(), m_registers.f(), cycles);
         break;
     case MVI_A:
-        mvi_r(m_acc_reg, get_next_byte(), cycles);
+        mvi_r(m_registers.a(), get_next_byte(), cycles);
         break;
     case CMC:
-        cmc(m_flag_reg, cycles);
+        cmc(m_registers.f(), cycles);
         break;
     case MOV_B_B:
-        mov_r_r(m_b_reg, m_b_reg, cycles);
+        mov_r_r(m_registers.b(), m_registers.b(), cycles);
         break;
     case MOV_B_C:
-        mov_r_r(m_b_reg, m_c_reg, cycles);
+        mov_r_r(m_registers.b(), m_registers.c(), cycles);
         break;
     case MOV_B_D:
-        mov_r_r(m_b_reg, m_d_reg, cycles);
+        mov_r_r(m_registers.b(), m_registers.d(), cycles);
         break;
     case MOV_B_E:
-        mov_r_r(m_b_reg, m_e_reg, cycles);
+        mov_r_r(m_registers.b(), m_registers.e(), cycles);
         break;
     case MOV_B_H:
-        mov_r_r(m_b_reg, m_h_reg, cycles);
+        mov_r_r(m_registers.b(), m_registers.h(), cycles);
         break;
     case MOV_B_L:
-        mov_r_r(m_b_reg, m_l_reg, cycles);
+        mov_r_r(m_registers.b(), m_registers.l(), cycles);
         break;
     case MOV_B_M:
-        mov_r_m(m_b_reg, m_memory.read(address_in_HL()), cycles);
+        mov_r_m(m_registers.b(), m_memory.read(address_in_HL()), cycles);
         break;
     case MOV_B_A:
-        mov_r_r(m_b_reg, m_acc_reg, cycles);
+        mov_r_r(m_registers.b(), m_registers.a(), cycles);
         break;
     case MOV_C_B:
-        mov_r_r(m_c_reg, m_b_reg, cycles);
+        mov_r_r(m_registers.c(), m_registers.b(), cycles);
         break;
     case MOV_C_C:
-        mov_r_r(m_c_reg, m_c_reg, cycles);
+        mov_r_r(m_registers.c(), m_registers.c(), cycles);
         break;
     case MOV_C_D:
-        mov_r_r(m_c_reg, m_d_reg, cycles);
+        mov_r_r(m_registers.c(), m_registers.d(), cycles);
         break;
     case MOV_C_E:
-        mov_r_r(m_c_reg, m_e_reg, cycles);
+        mov_r_r(m_registers.c(), m_registers.e(), cycles);
         break;
     case MOV_C_H:
-        mov_r_r(m_c_reg, m_h_reg, cycles);
+        mov_r_r(m_registers.c(), m_registers.h(), cycles);
         break;
     case MOV_C_L:
-        mov_r_r(m_c_reg, m_l_reg, cycles);
+        mov_r_r(m_registers.c(), m_registers.l(), cycles);
         break;
     case MOV_C_M:
-        mov_r_m(m_c_reg, m_memory.read(address_in_HL()), cycles);
+        mov_r_m(m_registers.c(), m_memory.read(address_in_HL()), cycles);
         break;
     case MOV_C_A:
-        mov_r_r(m_c_reg, m_acc_reg, cycles);
+        mov_r_r(m_registers.c(), m_registers.a(), cycles);
         break;
     case MOV_D_B:
-        mov_r_r(m_d_reg, m_b_reg, cycles);
+        mov_r_r(m_registers.d(), m_registers.b(), cycles);
         break;
     case MOV_D_C:
-        mov_r_r(m_d_reg, m_c_reg, cycles);
+        mov_r_r(m_registers.d(), m_registers.c(), cycles);
         break;
     case MOV_D_D:
-        mov_r_r(m_d_reg, m_d_reg, cycles);
+        mov_r_r(m_registers.d(), m_registers.d(), cycles);
         break;
     case MOV_D_E:
-        mov_r_r(m_d_reg, m_e_reg, cycles);
+        mov_r_r(m_registers.d(), m_registers.e(), cycles);
         break;
     case MOV_D_H:
-        mov_r_r(m_d_reg, m_h_reg, cycles);
+        mov_r_r(m_registers.d(), m_registers.h(), cycles);
         break;
     case MOV_D_L:
-        mov_r_r(m_d_reg, m_l_reg, cycles);
+        mov_r_r(m_registers.d(), m_registers.l(), cycles);
         break;
     case MOV_D_M:
-        mov_r_m(m_d_reg, m_memory.read(address_in_HL()), cycles);
+        mov_r_m(m_registers.d(), m_memory.read(address_in_HL()), cycles);
         break;
     case MOV_D_A:
-        mov_r_r(m_d_reg, m_acc_reg, cycles);
+        mov_r_r(m_registers.d(), m_registers.a(), cycles);
         break;
     case MOV_E_B:
-        mov_r_r(m_e_reg, m_b_reg, cycles);
+        mov_r_r(m_registers.e(), m_registers.b(), cycles);
         break;
     case MOV_E_C:
-        mov_r_r(m_e_reg, m_c_reg, cycles);
+        mov_r_r(m_registers.e(), m_registers.c(), cycles);
         break;
     case MOV_E_D:
-        mov_r_r(m_e_reg, m_d_reg, cycles);
+        mov_r_r(m_registers.e(), m_registers.d(), cycles);
         break;
     case MOV_E_E:
-        mov_r_r(m_e_reg, m_e_reg, cycles);
+        mov_r_r(m_registers.e(), m_registers.e(), cycles);
         break;
     case MOV_E_H:
-        mov_r_r(m_e_reg, m_h_reg, cycles);
+        mov_r_r(m_registers.e(), m_registers.h(), cycles);
         break;
     case MOV_E_L:
-        mov_r_r(m_e_reg, m_l_reg, cycles);
+        mov_r_r(m_registers.e(), m_registers.l(), cycles);
         break;
     case MOV_E_M:
-        mov_r_m(m_e_reg, m_memory.read(address_in_HL()), cycles);
+        mov_r_m(m_registers.e(), m_memory.read(address_in_HL()), cycles);
         break;
     case MOV_E_A:
-        mov_r_r(m_e_reg, m_acc_reg, cycles);
+        mov_r_r(m_registers.e(), m_registers.a(), cycles);
         break;
     case MOV_H_B:
-        mov_r_r(m_h_reg, m_b_reg, cycles);
+        mov_r_r(m_registers.h(), m_registers.b(), cycles);
         break;
     case MOV_H_C:
-        mov_r_r(m_h_reg, m_c_reg, cycles);
+        mov_r_r(m_registers.h(), m_registers.c(), cycles);
         break;
     case MOV_H_D:
-        mov_r_r(m_h_reg, m_d_reg, cycles);
+        mov_r_r(m_registers.h(), m_registers.d(), cycles);
         break;
     case MOV_H_E:
-        mov_r_r(m_h_reg, m_e_reg, cycles);
+        mov_r_r(m_registers.h(), m_registers.e(), cycles);
         break;
     case MOV_H_H:
-        mov_r_r(m_h_reg, m_h_reg, cycles);
+        mov_r_r(m_registers.h(), m_registers.h(), cycles);
         break;
     case MOV_H_L:
-        mov_r_r(m_h_reg, m_l_reg, cycles);
+        mov_r_r(m_registers.h(), m_registers.l(), cycles);
         break;
     case MOV_H_M:
-        mov_r_m(m_h_reg, m_memory.read(address_in_HL()), cycles);
+        mov_r_m(m_registers.h(), m_memory.read(address_in_HL()), cycles);
         break;
     case MOV_H_A:
-        mov_r_r(m_h_reg, m_acc_reg, cycles);
+        mov_r_r(m_registers.h(), m_registers.a(), cycles);
         break;
     case MOV_L_B:
-        mov_r_r(m_l_reg, m_b_reg, cycles);
+        mov_r_r(m_registers.l(), m_registers.b(), cycles);
         break;
     case MOV_L_C:
-        mov_r_r(m_l_reg, m_c_reg, cycles);
+        mov_r_r(m_registers.l(), m_registers.c(), cycles);
         break;
     case MOV_L_D:
-        mov_r_r(m_l_reg, m_d_reg, cycles);
+        mov_r_r(m_registers.l(), m_registers.d(), cycles);
         break;
     case MOV_L_E:
-        mov_r_r(m_l_reg, m_e_reg, cycles);
+        mov_r_r(m_registers.l(), m_registers.e(), cycles);
         break;
     case MOV_L_H:
-        mov_r_r(m_l_reg, m_h_reg, cycles);
+        mov_r_r(m_registers.l(), m_registers.h(), cycles);
         break;
     case MOV_L_L:
-        mov_r_r(m_l_reg, m_l_reg, cycles);
+        mov_r_r(m_registers.l(), m_registers.l(), cycles);
         break;
     case MOV_L_M:
-        mov_r_m(m_l_reg, m_memory.read(address_in_HL()), cycles);
+        mov_r_m(m_registers.l(), m_memory.read(address_in_HL()), cycles);
         break;
     case MOV_L_A:
-        mov_r_r(m_l_reg, m_acc_reg, cycles);
+        mov_r_r(m_registers.l(), m_registers.a(), cycles);
         break;
     case MOV_M_B:
-        mov_m_r(m_memory, address_in_HL(), m_b_reg, cycles);
+        mov_m_r(m_memory, address_in_HL(), m_registers.b(), cycles);
         break;
     case MOV_M_C:
-        mov_m_r(m_memory, address_in_HL(), m_c_reg, cycles);
+        mov_m_r(m_memory, address_in_HL(), m_registers.c(), cycles);
         break;
     case MOV_M_D:
-        mov_m_r(m_memory, address_in_HL(), m_d_reg, cycles);
+        mov_m_r(m_memory, address_in_HL(), m_registers.d(), cycles);
         break;
     case MOV_M_E:
-        mov_m_r(m_memory, address_in_HL(), m_e_reg, cycles);
+        mov_m_r(m_memory, address_in_HL(), m_registers.e(), cycles);
         break;
     case MOV_M_H:
-        mov_m_r(m_memory, address_in_HL(), m_h_reg, cycles);
+        mov_m_r(m_memory, address_in_HL(), m_registers.h(), cycles);
         break;
     case MOV_M_L:
-        mov_m_r(m_memory, address_in_HL(), m_l_reg, cycles);
+        mov_m_r(m_memory, address_in_HL(), m_registers.l(), cycles);
         break;
     case HLT:
         hlt(m_is_halted, cycles);
         break;
     case MOV_M_A:
-        mov_m_r(m_memory, address_in_HL(), m_acc_reg, cycles);
+        mov_m_r(m_memory, address_in_HL(), m_registers.a(), cycles);
         break;
     case MOV_A_B:
-        mov_r_r(m_acc_reg, m_b_reg, cycles);
+        mov_r_r(m_registers.a(), m_registers.b(), cycles);
         break;
     case MOV_A_C:
-        mov_r_r(m_acc_reg, m_c_reg, cycles);
+        mov_r_r(m_registers.a(), m_registers.c(), cycles);
         break;
     case MOV_A_D:
-        mov_r_r(m_acc_reg, m_d_reg, cycles);
+        mov_r_r(m_registers.a(), m_registers.d(), cycles);
         break;
     case MOV_A_E:
-        mov_r_r(m_acc_reg, m_e_reg, cycles);
+        mov_r_r(m_registers.a(), m_registers.e(), cycles);
         break;
     case MOV_A_H:
-        mov_r_r(m_acc_reg, m_h_reg, cycles);
+        mov_r_r(m_registers.a(), m_registers.h(), cycles);
         break;
     case MOV_A_L:
-        mov_r_r(m_acc_reg, m_l_reg, cycles);
+        mov_r_r(m_registers.a(), m_registers.l(), cycles);
         break;
     case MOV_A_M:
-        mov_r_m(m_acc_reg, m_memory.read(address_in_HL()), cycles);
+        mov_r_m(m_registers.a(), m_memory.read(address_in_HL()), cycles);
         break;
     case MOV_A_A:
-        mov_r_r(m_acc_reg, m_acc_reg, cycles);
+        mov_r_r(m_registers.a(), m_registers.a(), cycles);
         break;
     case ADD_B:
-        add_r(m_acc_reg, m_b_reg, m_flag_reg, cycles);
+        add_r(m_registers.a(), m_registers.b(), m_registers.f(), cycles);
         break;
     case ADD_C:
-        add_r(m_acc_reg, m_c_reg, m_flag_reg, cycles);
+        add_r(m_registers.a(), m_registers.c(), m_registers.f(), cycles);
         break;
     case ADD_D:
-        add_r(m_acc_reg, m_d_reg, m_flag_reg, cycles);
+        add_r(m_registers.a(), m_registers.d(), m_registers.f(), cycles);
         break;
     case ADD_E:
-        add_r(m_acc_reg, m_e_reg, m_flag_reg, cycles);
+        add_r(m_registers.a(), m_registers.e(), m_registers.f(), cycles);
         break;
     case ADD_H:
-        add_r(m_acc_reg, m_h_reg, m_flag_reg, cycles);
+        add_r(m_registers.a(), m_registers.h(), m_registers.f(), cycles);
         break;
     case ADD_L:
-        add_r(m_acc_reg, m_l_reg, m_flag_reg, cycles);
+        add_r(m_registers.a(), m_registers.l(), m_registers.f(), cycles);
         break;
     case ADD_M:
-        add_m(m_acc_reg, m_memory.read(address_in_HL()), m_flag_reg, cycles);
+        add_m(m_registers.a(), m_memory.read(address_in_HL()), m_registers.f(), cycles);
         break;
     case ADD_A:
-        add_r(m_acc_reg, m_acc_reg, m_flag_reg, cycles);
+        add_r(m_registers.a(), m_registers.a(), m_registers.f(), cycles);
         break;
     case ADC_B:
-        adc_r(m_acc_reg, m_b_reg, m_flag_reg, cycles);
+        adc_r(m_registers.a(), m_registers.b(), m_registers.f(), cycles);
         break;
     case ADC_C:
-        adc_r(m_acc_reg, m_c_reg, m_flag_reg, cycles);
+        adc_r(m_registers.a(), m_registers.c(), m_registers.f(), cycles);
         break;
     case ADC_D:
-        adc_r(m_acc_reg, m_d_reg, m_flag_reg, cycles);
+        adc_r(m_registers.a(), m_registers.d(), m_registers.f(), cycles);
         break;
     case ADC_E:
-        adc_r(m_acc_reg, m_e_reg, m_flag_reg, cycles);
+        adc_r(m_registers.a(), m_registers.e(), m_registers.f(), cycles);
         break;
     case ADC_H:
-        adc_r(m_acc_reg, m_h_reg, m_flag_reg, cycles);
+        adc_r(m_registers.a(), m_registers.h(), m_registers.f(), cycles);
         break;
     case ADC_L:
-        adc_r(m_acc_reg, m_l_reg, m_flag_reg, cycles);
+        adc_r(m_registers.a(), m_registers.l(), m_registers.f(), cycles);
         break;
     case ADC_M:
-        adc_m(m_acc_reg, m_memory.read(address_in_HL()), m_flag_reg, cycles);
+        adc_m(m_registers.a(), m_memory.read(address_in_HL()), m_registers.f(), cycles);
         break;
     case ADC_A:
-        adc_r(m_acc_reg, m_acc_reg, m_flag_reg, cycles);
+        adc_r(m_registers.a(), m_registers.a(), m_registers.f(), cycles);
         break;
     case SUB_B:
-        sub_r(m_acc_reg, m_b_reg, m_flag_reg, cycles);
+        sub_r(m_registers.a(), m_registers.b(), m_registers.f(), cycles);
         break;
     case SUB_C:
-        sub_r(m_acc_reg, m_c_reg, m_flag_reg, cycles);
+        sub_r(m_registers.a(), m_registers.c(), m_registers.f(), cycles);
         break;
     case SUB_D:
-        sub_r(m_acc_reg, m_d_reg, m_flag_reg, cycles);
+        sub_r(m_registers.a(), m_registers.d(), m_registers.f(), cycles);
         break;
     case SUB_E:
-        sub_r(m_acc_reg, m_e_reg, m_flag_reg, cycles);
+        sub_r(m_registers.a(), m_registers.e(), m_registers.f(), cycles);
         break;
     case SUB_H:
-        sub_r(m_acc_reg, m_h_reg, m_flag_reg, cycles);
+        sub_r(m_registers.a(), m_registers.h(), m_registers.f(), cycles);
         break;
     case SUB_L:
-        sub_r(m_acc_reg, m_l_reg, m_flag_reg, cycles);
+        sub_r(m_registers.a(), m_registers.l(), m_registers.f(), cycles);
         break;
     case SUB_M:
-        sub_m(m_acc_reg, m_memory.read(address_in_HL()), m_flag_reg, cycles);
+        sub_m(m_registers.a(), m_memory.read(address_in_HL()), m_registers.f(), cycles);
         break;
     case SUB_A:
-        sub_r(m_acc_reg, m_acc_reg, m_flag_reg, cycles);
+        sub_r(m_registers.a(), m_registers.a(), m_registers.f(), cycles);
         break;
     case SBB_B:
-        sbb_r(m_acc_reg, m_b_reg, m_flag_reg, cycles);
+        sbb_r(m_registers.a(), m_registers.b(), m_registers.f(), cycles);
         break;
     case SBB_C:
-        sbb_r(m_acc_reg, m_c_reg, m_flag_reg, cycles);
+        sbb_r(m_registers.a(), m_registers.c(), m_registers.f(), cycles);
         break;
     case SBB_D:
-        sbb_r(m_acc_reg, m_d_reg, m_flag_reg, cycles);
+        sbb_r(m_registers.a(), m_registers.d(), m_registers.f(), cycles);
         break;
     case SBB_E:
-        sbb_r(m_acc_reg, m_e_reg, m_flag_reg, cycles);
+        sbb_r(m_registers.a(), m_registers.e(), m_registers.f(), cycles);
         break;
     case SBB_H:
-        sbb_r(m_acc_reg, m_h_reg, m_flag_reg, cycles);
+        sbb_r(m_registers.a(), m_registers.h(), m_registers.f(), cycles);
         break;
     case SBB_L:
-        sbb_r(m_acc_reg, m_l_reg, m_flag_reg, cycles);
+        sbb_r(m_registers.a(), m_registers.l(), m_registers.f(), cycles);
         break;
     case SBB_M:
-        sbb_m(m_acc_reg, m_memory.read(address_in_HL()), m_flag_reg, cycles);
+        sbb_m(m_registers.a(), m_memory.read(address_in_HL()), m_registers.f(), cycles);
         break;
     case SBB_A:
-        sbb_r(m_acc_reg, m_acc_reg, m_flag_reg, cycles);
+        sbb_r(m_registers.a(), m_registers.a(), m_registers.f(), cycles);
         break;
     case ANA_B:
-        ana_r(m_acc_reg, m_b_reg, m_flag_reg, cycles);
+        ana_r(m_registers.a(), m_registers.b(), m_registers.f(), cycles);
         break;
     case ANA_C:
-        ana_r(m_acc_reg, m_c_reg, m_flag_reg, cycles);
+        ana_r(m_registers.a(), m_registers.c(), m_registers.f(), cycles);
         break;
     case ANA_D:
-        ana_r(m_acc_reg, m_d_reg, m_flag_reg, cycles);
+        ana_r(m_registers.a(), m_registers.d(), m_registers.f(), cycles);
         break;
     case ANA_E:
-        ana_r(m_acc_reg, m_e_reg, m_flag_reg, cycles);
+        ana_r(m_registers.a(), m_registers.e(), m_registers.f(), cycles);
         break;
     case ANA_H:
-        ana_r(m_acc_reg, m_h_reg, m_flag_reg, cycles);
+        ana_r(m_registers.a(), m_registers.h(), m_registers.f(), cycles);
         break;
     case ANA_L:
-        ana_r(m_acc_reg, m_l_reg, m_flag_reg, cycles);
+        ana_r(m_registers.a(), m_registers.l(), m_registers.f(), cycles);
         break;
     case ANA_M:
-        ana_m(m_acc_reg, m_memory.read(address_in_HL()), m_flag_reg, cycles);
+        ana_m(m_registers.a(), m_memory.read(address_in_HL()), m_registers.f(), cycles);
         break;
     case ANA_A:
-        ana_r(m_acc_reg, m_acc_reg, m_flag_reg, cycles);
+        ana_r(m_registers.a(), m_registers.a(), m_registers.f(), cycles);
         break;
     case XRA_B:
-        xra_r(m_acc_reg, m_b_reg, m_flag_reg, cycles);
+        xra_r(m_registers.a(), m_registers.b(), m_registers.f(), cycles);
         break;
     case XRA_C:
-        xra_r(m_acc_reg, m_c_reg, m_flag_reg, cycles);
+        xra_r(m_registers.a(), m_registers.c(), m_registers.f(), cycles);
         break;
     case XRA_D:
-        xra_r(m_acc_reg, m_d_reg, m_flag_reg, cycles);
+        xra_r(m_registers.a(), m_registers.d(), m_registers.f(), cycles);
         break;
     case XRA_E:
-        xra_r(m_acc_reg, m_e_reg, m_flag_reg, cycles);
+        xra_r(m_registers.a(), m_registers.e(), m_registers.f(), cycles);
         break;
     case XRA_H:
-        xra_r(m_acc_reg, m_h_reg, m_flag_reg, cycles);
+        xra_r(m_registers.a(), m_registers.h(), m_registers.f(), cycles);
         break;
     case XRA_L:
-        xra_r(m_acc_reg, m_l_reg, m_flag_reg, cycles);
+        xra_r(m_registers.a(), m_registers.l(), m_registers.f(), cycles);
         break;
     case XRA_M:
-        xra_m(m_acc_reg, m_memory.read(address_in_HL()), m_flag_reg, cycles);
+        xra_m(m_registers.a(), m_memory.read(address_in_HL()), m_registers.f(), cycles);
         break;
     case XRA_A:
-        xra_r(m_acc_reg, m_acc_reg, m_flag_reg, cycles);
+        xra_r(m_registers.a(), m_registers.a(), m_registers.f(), cycles);
         break;
     case ORA_B:
-        ora_r(m_acc_reg, m_b_reg, m_flag_reg, cycles);
+        ora_r(m_registers.a(), m_registers.b(), m_registers.f(), cycles);
         break;
     case ORA_C:
-        ora_r(m_acc_reg, m_c_reg, m_flag_reg, cycles);
+        ora_r(m_registers.a(), m_registers.c(), m_registers.f(), cycles);
         break;
     case ORA_D:
-        ora_r(m_acc_reg, m_d_reg, m_flag_reg, cycles);
+        ora_r(m_registers.a(), m_registers.d(), m_registers.f(), cycles);
         break;
     case ORA_E:
-        ora_r(m_acc_reg, m_e_reg, m_flag_reg, cycles);
+        ora_r(m_registers.a(), m_registers.e(), m_registers.f(), cycles);
         break;
     case ORA_H:
-        ora_r(m_acc_reg, m_h_reg, m_flag_reg, cycles);
+        ora_r(m_registers.a(), m_registers.h(), m_registers.f(), cycles);
         break;
     case ORA_L:
-        ora_r(m_acc_reg, m_l_reg, m_flag_reg, cycles);
+        ora_r(m_registers.a(), m_registers.l(), m_registers.f(), cycles);
         break;
     case ORA_M:
-        ora_m(m_acc_reg, m_memory.read(address_in_HL()), m_flag_reg, cycles);
+        ora_m(m_registers.a(), m_memory.read(address_in_HL()), m_registers.f(), cycles);
         break;
     case ORA_A:
-        ora_r(m_acc_reg, m_acc_reg, m_flag_reg, cycles);
+        ora_r(m_registers.a(), m_registers.a(), m_registers.f(), cycles);
         break;
     case CMP_B:
-        cmp_r(m_acc_reg, m_b_reg, m_flag_reg, cycles);
+        cmp_r(m_registers.a(), m_registers.b(), m_registers.f(), cycles);
         break;
     case CMP_C:
-        cmp_r(m_acc_reg, m_c_reg, m_flag_reg, cycles);
+        cmp_r(m_registers.a(), m_registers.c(), m_registers.f(), cycles);
         break;
     case CMP_D:
-        cmp_r(m_acc_reg, m_d_reg, m_flag_reg, cycles);
+        cmp_r(m_registers.a(), m_registers.d(), m_registers.f(), cycles);
         break;
     case CMP_E:
-        cmp_r(m_acc_reg, m_e_reg, m_flag_reg, cycles);
+        cmp_r(m_registers.a(), m_registers.e(), m_registers.f(), cycles);
         break;
     case CMP_H:
-        cmp_r(m_acc_reg, m_h_reg, m_flag_reg, cycles);
+        cmp_r(m_registers.a(), m_registers.h(), m_registers.f(), cycles);
         break;
     case CMP_L:
-        cmp_r(m_acc_reg, m_l_reg, m_flag_reg, cycles);
+        cmp_r(m_registers.a(), m_registers.l(), m_registers.f(), cycles);
         break;
     case CMP_M:
-        cmp_m(m_acc_reg, m_memory.read(address_in_HL()), m_flag_reg, cycles);
+        cmp_m(m_registers.a(), m_memory.read(address_in_HL()), m_registers.f(), cycles);
         break;
     case CMP_A:
-        cmp_r(m_acc_reg, m_acc_reg, m_flag_reg, cycles);
+        cmp_r(m_registers.a(), m_registers.a(), m_registers.f(), cycles);
         break;
     case RNZ:
-        rnz(m_pc, m_sp, m_memory, m_flag_reg, cycles);
+        rnz(m_pc, m_sp, m_memory, m_registers.f(), cycles);
         break;
     case POP_B:
-        pop(m_b_reg, m_c_reg, m_sp, m_memory, cycles);
+        pop(m_registers, RegisterPair::BC, m_sp, m_memory, cycles);
         break;
     case JNZ:
-        jnz(m_pc, get_next_word(), m_flag_reg, cycles);
+        jnz(m_pc, get_next_word(), m_registers.f(), cycles);
         break;
     case JMP:
         jmp(m_pc, get_next_word(), cycles);
         break;
     case CNZ:
-        cnz(m_pc, m_sp, m_memory, get_next_word(), m_flag_reg, cycles);
+        cnz(m_pc, m_sp, m_memory, get_next_word(), m_registers.f(), cycles);
         break;
     case PUSH_B:
-        push(m_b_reg, m_c_reg, m_sp, m_memory, cycles);
+        push(m_registers, RegisterPair::BC, m_sp, m_memory, cycles);
         break;
     case ADI:
-        adi(m_acc_reg, get_next_byte(), m_flag_reg, cycles);
+        adi(m_registers.a(), get_next_byte(), m_registers.f(), cycles);
         break;
     case RST_0:
         rst_0(m_pc, m_sp, m_memory, cycles);
         break;
     case RZ:
-        rz(m_pc, m_sp, m_memory, m_flag_reg, cycles);
+        rz(m_pc, m_sp, m_memory, m_registers.f(), cycles);
         break;
     case RET:
         ret(m_pc, m_sp, m_memory, cycles);
         break;
     case JZ:
-        jz(m_pc, get_next_word(), m_flag_reg, cycles);
+        jz(m_pc, get_next_word(), m_registers.f(), cycles);
         break;
     case UNUSED_JMP_1:
         unused_3(m_opcode, m_pc, cycles);
         break;
     case CZ:
-        cz(m_pc, m_sp, m_memory, get_next_word(), m_flag_reg, cycles);
+        cz(m_pc, m_sp, m_memory, get_next_word(), m_registers.f(), cycles);
         break;
     case CALL:
         call(m_pc, m_sp, m_memory, get_next_word(), cycles);
         break;
     case ACI:
-        aci(m_acc_reg, get_next_byte(), m_flag_reg, cycles);
+        aci(m_registers.a(), get_next_byte(), m_registers.f(), cycles);
         break;
     case RST_1:
         rst_1(m_pc, m_sp, m_memory, cycles);
         break;
     case RNC:
-        rnc(m_pc, m_sp, m_memory, m_flag_reg, cycles);
+        rnc(m_pc, m_sp, m_memory, m_registers.f(), cycles);
         break;
     case POP_D:
-        pop(m_d_reg, m_e_reg, m_sp, m_memory, cycles);
+        pop(m_registers, RegisterPair::DE, m_sp, m_memory, cycles);
         break;
     case JNC:
-        jnc(m_pc, get_next_word(), m_flag_reg, cycles);
+        jnc(m_pc, get_next_word(), m_registers.f(), cycles);
         break;
     case OUT: {
         NextByte args = get_next_byte();
-        out(m_acc_reg, args, m_io_out, cycles);
+        out(m_registers.a(), args, m_io_out, cycles);
         notify_out_observers(args.farg);
         break;
     }
     case CNC:
-        cnc(m_pc, m_sp, m_memory, get_next_word(), m_flag_reg, cycles);
+        cnc(m_pc, m_sp, m_memory, get_next_word(), m_registers.f(), cycles);
         break;
     case PUSH_D:
-        push(m_d_reg, m_e_reg, m_sp, m_memory, cycles);
+        push(m_registers, RegisterPair::DE, m_sp, m_memory, cycles);
         break;
     case SUI:
-        sui(m_acc_reg, get_next_byte(), m_flag_reg, cycles);
+        sui(m_registers.a(), get_next_byte(), m_registers.f(), cycles);
         break;
     case RST_2:
         rst_2(m_pc, m_sp, m_memory, cycles);
         break;
     case RC:
-        rc(m_pc, m_sp, m_memory, m_flag_reg, cycles);
+        rc(m_pc, m_sp, m_memory, m_registers.f(), cycles);
         break;
     case UNUSED_RET_1:
         unused_1(m_opcode, cycles);
         break;
     case JC:
-        jc(m_pc, get_next_word(), m_flag_reg, cycles);
+        jc(m_pc, get_next_word(), m_registers.f(), cycles);
         break;
     case IN: {
         NextByte args = get_next_byte();
         notify_in_observers(args.farg);
-        in(m_acc_reg, args, m_io_in, cycles);
+        in(m_registers.a(), args, m_io_in, cycles);
         break;
     }
     case CC:
-        cc(m_pc, m_sp, m_memory, get_next_word(), m_flag_reg, cycles);
+        cc(m_pc, m_sp, m_memory, get_next_word(), m_registers.f(), cycles);
         break;
     case UNUSED_CALL_1:
         unused_3(m_opcode, m_pc, cycles);
         break;
     case SBI:
-        sbi(m_acc_reg, get_next_byte(), m_flag_reg, cycles);
+        sbi(m_registers.a(), get_next_byte(), m_registers.f(), cycles);
         break;
     case RST_3:
         rst_3(m_pc, m_sp, m_memory, cycles);
         break;
     case RPO:
-        rpo(m_pc, m_sp, m_memory, m_flag_reg, cycles);
+        rpo(m_pc, m_sp, m_memory, m_registers.f(), cycles);
         break;
     case POP_H:
-        pop(m_h_reg, m_l_reg, m_sp, m_memory, cycles);
+        pop(m_registers, RegisterPair::HL, m_sp, m_memory, cycles);
         break;
     case JPO:
-        jpo(m_pc, get_next_word(), m_flag_reg, cycles);
+        jpo(m_pc, get_next_word(), m_registers.f(), cycles);
         break;
     case XTHL:
-        xthl(m_sp, m_memory, m_h_reg, m_l_reg, cycles);
+        xthl(m_sp, m_memory, m_registers.h(), m_registers.l(), cycles);
         break;
     case CPO:
-        cpo(m_pc, m_sp, m_memory, get_next_word(), m_flag_reg, cycles);
+        cpo(m_pc, m_sp, m_memory, get_next_word(), m_registers.f(), cycles);
         break;
     case PUSH_H:
-        push(m_h_reg, m_l_reg, m_sp, m_memory, cycles);
+        push(m_registers, RegisterPair::HL, m_sp, m_memory, cycles);
         break;
     case ANI:
-        ani(m_acc_reg, get_next_byte(), m_flag_reg, cycles);
+        ani(m_registers.a(), get_next_byte(), m_registers.f(), cycles);
         break;
     case RST_4:
         rst_4(m_pc, m_sp, m_memory, cycles);
         break;
     case RPE:
-        rpe(m_pc, m_sp, m_memory, m_flag_reg, cycles);
+        rpe(m_pc, m_sp, m_memory, m_registers.f(), cycles);
         break;
     case PCHL:
         pchl(m_pc, address_in_HL(), cycles);
         break;
     case JPE:
-        jpe(m_pc, get_next_word(), m_flag_reg, cycles);
+        jpe(m_pc, get_next_word(), m_registers.f(), cycles);
         break;
     case XCHG:
-        xchg(m_h_reg, m_l_reg, m_d_reg, m_e_reg, cycles);
+        xchg(m_registers, cycles);
         break;
     case CPE:
-        cpe(m_pc, m_sp, m_memory, get_next_word(), m_flag_reg, cycles);
+        cpe(m_pc, m_sp, m_memory, get_next_word(), m_registers.f(), cycles);
         break;
     case UNUSED_CALL_2:
         unused_3(m_opcode, m_pc, cycles);
         break;
     case XRI:
-        xri(m_acc_reg, get_next_byte(), m_flag_reg, cycles);
+        xri(m_registers.a(), get_next_byte(), m_registers.f(), cycles);
         break;
     case RST_5:
         rst_5(m_pc, m_sp, m_memory, cycles);
         break;
     case RP:
-        rp(m_pc, m_sp, m_memory, m_flag_reg, cycles);
+        rp(m_pc, m_sp, m_memory, m_registers.f(), cycles);
         break;
     case POP_PSW:
-        pop_psw(m_flag_reg, m_acc_reg, m_sp, m_memory, cycles);
+        pop_psw(m_registers.f(), m_registers.a(), m_sp, m_memory, cycles);
         break;
     case JP:
-        jp(m_pc, get_next_word(), m_flag_reg, cycles);
+        jp(m_pc, get_next_word(), m_registers.f(), cycles);
         break;
     case DI:
         di(m_inte, cycles);
         break;
     case CP:
-        cp(m_pc, m_sp, m_memory, get_next_word(), m_flag_reg, cycles);
+        cp(m_pc, m_sp, m_memory, get_next_word(), m_registers.f(), cycles);
         break;
     case PUSH_PSW:
-        push_psw(m_flag_reg, m_acc_reg, m_sp, m_memory, cycles);
+        push_psw(m_registers.f(), m_registers.a(), m_sp, m_memory, cycles);
         break;
     case ORI:
-        ori(m_acc_reg, get_next_byte(), m_flag_reg, cycles);
+        ori(m_registers.a(), get_next_byte(), m_registers.f(), cycles);
         break;
     case RST_6:
         rst_6(m_pc, m_sp, m_memory, cycles);
         break;
     case RM:
-        rm(m_pc, m_sp, m_memory, m_flag_reg, cycles);
+        rm(m_pc, m_sp, m_memory, m_registers.f(), cycles);
         break;
     case SPHL:
         sphl(m_sp, address_in_HL(), cycles);
         break;
     case JM:
-        jm(m_pc, get_next_word(), m_flag_reg, cycles);
+        jm(m_pc, get_next_word(), m_registers.f(), cycles);
         break;
     case EI:
         ei(m_inte, cycles);
         break;
     case CM:
-        cm(m_pc, m_sp, m_memory, get_next_word(), m_flag_reg, cycles);
+        cm(m_pc, m_sp, m_memory, get_next_word(), m_registers.f(), cycles);
         break;
     case UNUSED_CALL_3:
         unused_3(m_opcode, m_pc, cycles);
         break;
     case CPI:
-        cpi(m_acc_reg, get_next_byte(), m_flag_reg, cycles);
+        cpi(m_registers.a(), get_next_byte(), m_registers.f(), cycles);
         break;
     case RST_7:
         rst_7(m_pc, m_sp, m_memory, cycles);
@@ -934,7 +982,7 @@ NextWord Cpu::get_next_word()
 
 u16 Cpu::address_in_HL() const
 {
-    return to_u16(m_h_reg, m_l_reg);
+    return m_registers.hl();
 }
 
 EmulatorMemory<u16, u8>& Cpu::memory()
@@ -954,42 +1002,42 @@ u16 Cpu::sp() const
 
 u8 Cpu::a() const
 {
-    return m_acc_reg;
+    return m_registers.a();
 }
 
 u8 Cpu::b() const
 {
-    return m_b_reg;
+    return m_registers.b();
 }
 
 u8 Cpu::c() const
 {
-    return m_c_reg;
+    return m_registers.c();
 }
 
 u8 Cpu::d() const
 {
-    return m_d_reg;
+    return m_registers.d();
 }
 
 u8 Cpu::e() const
 {
-    return m_e_reg;
+    return m_registers.e();
 }
 
 u8 Cpu::h() const
 {
-    return m_h_reg;
+    return m_registers.h();
 }
 
 u8 Cpu::l() const
 {
-    return m_l_reg;
+    return m_registers.l();
 }
 
 u8 Cpu::f() const
 {
-    return m_flag_reg.to_u8();
+    return m_registers.f().to_u8();
 }
 
 bool Cpu::is_interrupted() const
@@ -1016,18 +1064,93 @@ void Cpu::print_debug()
     std::cout << "pc=" << hexify(m_pc)
               << ",sp=" << hexify(m_sp)
               << ",op=" << hexify(m_opcode)
-              << ",a=" << hexify(m_acc_reg)
-              << ",b=" << hexify(m_b_reg)
-              << ",c=" << hexify(m_c_reg)
-              << ",d=" << hexify(m_d_reg)
-              << ",e=" << hexify(m_e_reg)
-              << ",h=" << hexify(m_h_reg)
-              << ",l=" << hexify(m_l_reg)
-              << ",ca=" << m_flag_reg.is_carry_flag_set()
-              << ",pa=" << m_flag_reg.is_parity_flag_set()
-              << ",ac=" << m_flag_reg.is_aux_carry_flag_set()
-              << ",z=" << m_flag_reg.is_zero_flag_set()
-              << ",s=" << m_flag_reg.is_sign_flag_set()
+              << ",a=" << hexify(m_registers.a())
+              << ",b=" << hexify(m_registers.b())
+              << ",c=" << hexify(m_registers.c())
+              << ",d=" << hexify(m_registers.d())
+              << ",e=" << hexify(m_registers.e())
+              << ",h=" << hexify(m_registers.h())
+              << ",l=" << hexify(m_registers.l())
+              << ",ca=" << m_registers.f().is_carry_flag_set()
+              << ",pa=" << m_registers.f().is_parity_flag_set()
+              << ",ac=" << m_registers.f().is_aux_carry_flag_set()
+              << ",z=" << m_registers.f().is_zero_flag_set()
+              << ",s=" << m_registers.f().is_sign_flag_set()
               << "\n";
 }
+
+/**
+ * Runs a program one instruction at a time. The program is repeated until it fills the memory, so
+ * that the program counter wraps around to the beginning instead of running out of instructions,
+ * which means that the size of the program has to be a power of two.
+ */
+static void run_instructions_for_benchmark(Bench& bench, std::vector<u8> const& program)
+{
+    std::vector<u8> contents;
+    while (contents.size() < UINT16_MAX + 1) {
+        contents.insert(contents.end(), program.begin(), program.end());
+    }
+
+    EmulatorMemory<u16, u8> memory;
+    memory.add(contents);
+    Cpu cpu(memory, 0);
+
+    bench.run([&]() {
+        cpu.next_instruction();
+    });
+}
+
+BENCHMARK("8080: next_instruction, register loads")
+{
+    const std::vector<u8> program = {
+        0x41, // MOV B,C
+        0x4a, // MOV C,D
+        0x53, // MOV D,E
+        0x5c, // MOV E,H
+    };
+
+    run_instructions_for_benchmark(bench, program);
+}
+
+BENCHMARK("8080: next_instruction, arithmetic and logic")
+{
+    const std::vector<u8> program = {
+        0x80, // ADD B
+        0x91, // SUB C
+        0xa2, // ANA D
+        0xab, // XRA E
+        0xb4, // ORA H
+        0xbd, // CMP L
+        0x3c, // INR A
+        0x05, // DCR B
+    };
+
+    run_instructions_for_benchmark(bench, program);
+}
+
+BENCHMARK("8080: next_instruction, memory access")
+{
+    const std::vector<u8> program = {
+        0x7e, // MOV A,M, where HL is 0, so the opcode itself is read
+        0x77, // MOV M,A, which writes the same opcode back
+    };
+
+    run_instructions_for_benchmark(bench, program);
+}
+
+/**
+ * Jumps, calls and returns in a loop that never leaves the beginning of the program.
+ */
+BENCHMARK("8080: next_instruction, jumps and calls")
+{
+    const std::vector<u8> program = {
+        0xc3, 0x03, 0x00,                   // 0x0000: JMP 0x0003
+        0xcd, 0x09, 0x00,                   // 0x0003: CALL 0x0009
+        0xc3, 0x00, 0x00,                   // 0x0006: JMP 0x0000
+        0xc9,                               // 0x0009: RET
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // Never run, but makes the size a power of two
+    };
+
+    run_instructions_for_benchmark(bench, program);
+}
 }
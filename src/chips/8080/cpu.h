@@ -3,7 +3,7 @@
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/memory/next_word.h"
 #include "crosscutting/typedefs.h"
-#include "flags.h"
+#include "register_file.h"
 #include <cstddef>
 #include <vector>
 
@@ -12,17 +12,24 @@ class InObserver;
 }
 namespace emu::i8080 {
 class OutObserver;
+struct ManualState;
 }
 namespace emu::memory {
 template<class A, class D>
 class EmulatorMemory;
 }
+namespace emu::misc {
+class StateReader;
+class StateWriter;
+}
 
 namespace emu::i8080 {
 
 using emu::memory::EmulatorMemory;
 using emu::memory::NextByte;
 using emu::memory::NextWord;
+using emu::misc::StateReader;
+using emu::misc::StateWriter;
 
 class Cpu {
 public:
@@ -42,6 +49,12 @@ public:
 
     void stop();
 
+    void set_state_manually(ManualState new_state);
+
+    void save_state(StateWriter& writer) const;
+
+    void load_state(StateReader& reader);
+
     void add_out_observer(OutObserver& observer);
 
     void remove_out_observer(OutObserver* observer);
@@ -98,14 +111,7 @@ private:
     u8 m_opcode;
     u16 m_sp;
     u16 m_pc;
-    u8 m_acc_reg;
-    u8 m_b_reg;
-    u8 m_c_reg;
-    u8 m_d_reg;
-    u8 m_e_reg;
-    u8 m_h_reg;
-    u8 m_l_reg;
-    Flags m_flag_reg;
+    RegisterFile m_registers;
 
     std::vector<OutObserver*> m_out_observers;
     std::vector<InObserver*> m_in_observers;
@@ -1,826 +1,497 @@
 #include "disassembler.h"
-#include "crosscutting/exceptions/unrecognized_opcode_exception.h"
+#include "crosscutting/benchmarking/benchmark.h"
 #include "crosscutting/memory/emulator_memory.h"
-#include "crosscutting/util/string_util.h"
+#include "crosscutting/util/byte_util.h"
+#include "doctest.h"
 #include "instructions/instructions.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <vector>
 
 namespace emu::i8080 {
 
-using emu::exceptions::UnrecognizedOpcodeException;
-using emu::util::string::hexify_wo_0x;
+using emu::benchmarking::do_not_optimize;
+using emu::benchmarking::pseudo_random_bytes;
+using emu::debugger::ControlFlow;
+using emu::debugger::format_instruction;
+using emu::util::byte::to_u16;
 
-Disassembler::Disassembler(EmulatorMemory<u16, u8>& memory, std::ostream& ostream)
+// The length of each instruction in bytes, indexed by opcode
+static constexpr std::array<u8, 256> s_instruction_lengths = {
+    1, 3, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+    1, 3, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+    1, 3, 3, 1, 1, 1, 2, 1, 1, 1, 3, 1, 1, 1, 2, 1,
+    1, 3, 3, 1, 1, 1, 2, 1, 1, 1, 3, 1, 1, 1, 2, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 3, 3, 3, 1, 2, 1, 1, 1, 3, 3, 3, 3, 2, 1,
+    1, 1, 3, 2, 3, 1, 2, 1, 1, 1, 3, 2, 3, 3, 2, 1,
+    1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 3, 2, 1,
+    1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 3, 2, 1
+};
+
+// The mnemonic of each instruction, indexed by opcode
+// The operands are placeholders that are filled in from the bytes of the instruction, as
+// described in DecodedInstruction, and nullptr is an opcode that isn't an instruction
+static constexpr std::array<char const*, 256> s_mnemonics = {
+    "NOP", // 00
+    "LXI B,%w1", // 01
+    "STAX B", // 02
+    "INX B", // 03
+    "INR B", // 04
+    "DCR B", // 05
+    "MVI B,%b1", // 06
+    "RLC B", // 07
+    "*NOP", // 08
+    "DAD B", // 09
+    "LDAX B", // 0a
+    "DCX B", // 0b
+    "INR C", // 0c
+    "DCR C", // 0d
+    "MVI C,%b1", // 0e
+    "RRC", // 0f
+    "*NOP", // 10
+    "LXI D,%w1", // 11
+    "STAX D", // 12
+    "INX D", // 13
+    "INR D", // 14
+    "DCR D", // 15
+    "MVI D,%b1", // 16
+    "RAL", // 17
+    "*NOP", // 18
+    "DAD D", // 19
+    "LDAX D", // 1a
+    "DCX D", // 1b
+    "INR E", // 1c
+    "DCR E", // 1d
+    "MVI E,%b1", // 1e
+    "RAR", // 1f
+    "*NOP", // 20
+    "LXI H,%w1", // 21
+    "SHLD %w1", // 22
+    "INX H", // 23
+    "INR H", // 24
+    "DCR H", // 25
+    "MVI H,%b1", // 26
+    "DAA", // 27
+    "*NOP", // 28
+    "DAD H", // 29
+    "LHLD %w1", // 2a
+    "DCX H", // 2b
+    "INR L", // 2c
+    "DCR L", // 2d
+    "MVI L,%b1", // 2e
+    "CMA", // 2f
+    "*NOP", // 30
+    "LXI SP,%w1", // 31
+    "STA %w1", // 32
+    "INX SP", // 33
+    "INR M", // 34
+    "DCR M", // 35
+    "MVI M,%b1", // 36
+    "STC", // 37
+    "*NOP", // 38
+    "DAD SP", // 39
+    "LDA %w1", // 3a
+    "DCX SP", // 3b
+    "INR A", // 3c
+    "DCR A", // 3d
+    "MVI A,%b1", // 3e
+    "CMC", // 3f
+    "MOV B,B", // 40
+    "MOV B,C", // 41
+    "MOV B,D", // 42
+    "MOV B,E", // 43
+    "MOV B,H", // 44
+    "MOV B,L", // 45
+    "MOV B,M", // 46
+    "MOV B,A", // 47
+    "MOV C,B", // 48
+    "MOV C,C", // 49
+    "MOV C,D", // 4a
+    "MOV C,E", // 4b
+    "MOV C,H", // 4c
+    "MOV C,L", // 4d
+    "MOV C,M", // 4e
+    "MOV C,A", // 4f
+    "MOV D,B", // 50
+    "MOV D,C", // 51
+    "MOV D,D", // 52
+    "MOV D,E", // 53
+    "MOV D,H", // 54
+    "MOV D,L", // 55
+    "MOV D,M", // 56
+    "MOV D,A", // 57
+    "MOV E,B", // 58
+    "MOV E,C", // 59
+    "MOV E,D", // 5a
+    "MOV E,E", // 5b
+    "MOV E,H", // 5c
+    "MOV E,L", // 5d
+    "MOV E,M", // 5e
+    "MOV E,A", // 5f
+    "MOV H,B", // 60
+    "MOV H,C", // 61
+    "MOV H,D", // 62
+    "MOV H,E", // 63
+    "MOV H,H", // 64
+    "MOV H,L", // 65
+    "MOV H,M", // 66
+    "MOV H,A", // 67
+    "MOV L,B", // 68
+    "MOV L,C", // 69
+    "MOV L,D", // 6a
+    "MOV L,E", // 6b
+    "MOV L,H", // 6c
+    "MOV L,L", // 6d
+    "MOV L,M", // 6e
+    "MOV L,A", // 6f
+    "MOV M,B", // 70
+    "MOV M,C", // 71
+    "MOV M,D", // 72
+    "MOV M,E", // 73
+    "MOV M,H", // 74
+    "MOV M,L", // 75
+    "HLT", // 76
+    "MOV M,A", // 77
+    "MOV A,B", // 78
+    "MOV A,C", // 79
+    "MOV A,D", // 7a
+    "MOV A,E", // 7b
+    "MOV A,H", // 7c
+    "MOV A,L", // 7d
+    "MOV A,M", // 7e
+    "MOV A,A", // 7f
+    "ADD B", // 80
+    "ADD C", // 81
+    "ADD D", // 82
+    "ADD E", // 83
+    "ADD H", // 84
+    "ADD L", // 85
+    "ADD M", // 86
+    "ADD A", // 87
+    "ADC B", // 88
+    "ADC C", // 89
+    "ADC D", // 8a
+    "ADC E", // 8b
+    "ADC H", // 8c
+    "ADC L", // 8d
+    "ADC M", // 8e
+    "ADC A", // 8f
+    "SUB B", // 90
+    "SUB C", // 91
+    "SUB D", // 92
+    "SUB E", // 93
+    "SUB H", // 94
+    "SUB L", // 95
+    "SUB M", // 96
+    "SUB A", // 97
+    "SBB B", // 98
+    "SBB C", // 99
+    "SBB D", // 9a
+    "SBB E", // 9b
+    "SBB H", // 9c
+    "SBB L", // 9d
+    "SBB M", // 9e
+    "SBB A", // 9f
+    "ANA B", // a0
+    "ANA C", // a1
+    "ANA D", // a2
+    "ANA E", // a3
+    "ANA H", // a4
+    "ANA L", // a5
+    "ANA M", // a6
+    "ANA A", // a7
+    "XRA B", // a8
+    "XRA C", // a9
+    "XRA D", // aa
+    "XRA E", // ab
+    "XRA H", // ac
+    "XRA L", // ad
+    "XRA M", // ae
+    "XRA A", // af
+    "ORA B", // b0
+    "ORA C", // b1
+    "ORA D", // b2
+    "ORA E", // b3
+    "ORA H", // b4
+    "ORA L", // b5
+    "ORA M", // b6
+    "ORA A", // b7
+    "CMP B", // b8
+    "CMP C", // b9
+    "CMP D", // ba
+    "CMP E", // bb
+    "CMP H", // bc
+    "CMP L", // bd
+    "CMP M", // be
+    "CMP A", // bf
+    "RNZ", // c0
+    "POP B", // c1
+    "JNZ %w1", // c2
+    "JMP %w1", // c3
+    "CNZ %w1", // c4
+    "PUSH B", // c5
+    "ADI %b1", // c6
+    "RST 0", // c7
+    "RZ", // c8
+    "RET", // c9
+    "JZ %w1", // ca
+    "*JMP %w1", // cb
+    "CZ %w1", // cc
+    "CALL %w1", // cd
+    "ACI %b1", // ce
+    "RST 1", // cf
+    "RNC", // d0
+    "POP D", // d1
+    "JZ %w1", // d2
+    "OUT %b1", // d3
+    "CNC %w1", // d4
+    "PUSH D", // d5
+    "SUI %b1", // d6
+    "RST 2", // d7
+    "RC", // d8
+    "*RET", // d9
+    "JC %w1", // da
+    "IN %b1", // db
+    "CC %w1", // dc
+    "*CALL %w1", // dd
+    "SBI %b1", // de
+    "RST 3", // df
+    "RPO", // e0
+    "POP H", // e1
+    "JPO %w1", // e2
+    "XTHL", // e3
+    "CPO %w1", // e4
+    "PUSH H", // e5
+    "ANI %b1", // e6
+    "RST 4", // e7
+    "RPE", // e8
+    "PCHL", // e9
+    "JPE %w1", // ea
+    "XCHG", // eb
+    "CPE %w1", // ec
+    "*CALL %w1", // ed
+    "XRI %b1", // ee
+    "RST 5", // ef
+    "RP", // f0
+    "POP PSW", // f1
+    "JP %w1", // f2
+    "DI", // f3
+    "CP %w1", // f4
+    "PUSH PSW", // f5
+    "ORI %b1", // f6
+    "RST 6", // f7
+    "RM", // f8
+    "SPHL", // f9
+    "JM %w1", // fa
+    "EI", // fb
+    "CM %w1", // fc
+    "*CALL %w1", // fd
+    "CPI %b1", // fe
+    "RST 7", // ff
+};
+
+Disassembler::Disassembler(EmulatorMemory<u16, u8> const& memory, std::ostream& ostream)
     : m_memory(memory)
     , m_memory_size(memory.size())
-    , m_pc(0)
-    , m_opcode(0)
     , m_ostream(ostream)
 {
 }
 
 void Disassembler::disassemble()
 {
-    while (m_pc < m_memory_size) {
-        print_next_instruction();
+    std::string line;
+    for (std::size_t address = 0; address < m_memory_size;) {
+        const DecodedInstruction<u16, u8> instruction = decode(m_memory, static_cast<u16>(address));
+        format_instruction(instruction, line);
+        line.push_back('\n');
+        m_ostream << line;
+
+        // An opcode that isn't an instruction is listed as a data byte, so the next line is the next byte
+        address += instruction.m_mnemonic == nullptr ? 1 : instruction.m_length;
     }
 }
 
-void Disassembler::print_next_instruction()
+DecodedInstruction<u16, u8> Disassembler::decode(EmulatorMemory<u16, u8> const& memory, u16 address)
 {
-    m_ostream << hexify_wo_0x(m_pc, 4) << "\t\t";
+    const u8 opcode = memory.read(address);
+    DecodedInstruction<u16, u8> instruction {
+        .m_address = address,
+        .m_length = s_instruction_lengths[opcode],
+        .m_bytes = {},
+        .m_mnemonic = s_mnemonics[opcode]
+    };
 
-    m_opcode = get_next_byte().farg;
+    for (std::size_t i = 0; i < instruction.m_length; ++i) {
+        instruction.m_bytes[i] = memory.read(static_cast<u16>(address + i));
+    }
 
-    switch (m_opcode) {
-    case NOP:
-        print_nop(m_ostream);
-        break;
-    case LXI_B:
-        print_lxi(m_ostream, "B", get_next_word());
-        break;
-    case STAX_B:
-        print_stax(m_ostream, "B");
-        break;
-    case INX_B:
-        print_inx(m_ostream, "B");
-        break;
-    case INR_B:
-        print_inr(m_ostream, "B");
-        break;
-    case DCR_B:
-        print_dcr(m_ostream, "B");
-        break;
-    case MVI_B:
-        print_mvi(m_ostream, "B", get_next_byte());
-        break;
-    case RLC_B:
-        print_rlc(m_ostream, "B");
-        break;
-    case UNUSED_NOP_1:
-        print_unused_nop(m_ostream);
-        break;
-    case DAD_B:
-        print_dad(m_ostream, "B");
-        break;
-    case LDAX_B:
-        print_ldax(m_ostream, "B");
-        break;
-    case DCX_B:
-        print_dcx(m_ostream, "B");
-        break;
-    case INR_C:
-        print_inr(m_ostream, "C");
-        break;
-    case DCR_C:
-        print_dcr(m_ostream, "C");
-        break;
-    case MVI_C:
-        print_mvi(m_ostream, "C", get_next_byte());
-        break;
-    case RRC:
-        print_rrc(m_ostream);
-        break;
-    case UNUSED_NOP_2:
-        print_unused_nop(m_ostream);
-        break;
-    case LXI_D:
-        print_lxi(m_ostream, "D", get_next_word());
-        break;
-    case STAX_D:
-        print_stax(m_ostream, "D");
-        break;
-    case INX_D:
-        print_inx(m_ostream, "D");
-        break;
-    case INR_D:
-        print_inr(m_ostream, "D");
-        break;
-    case DCR_D:
-        print_dcr(m_ostream, "D");
-        break;
-    case MVI_D:
-        print_mvi(m_ostream, "D", get_next_byte());
-        break;
-    case RAL:
-        print_ral(m_ostream);
-        break;
-    case UNUSED_NOP_3:
-        print_unused_nop(m_ostream);
-        break;
-    case DAD_D:
-        print_dad(m_ostream, "D");
-        break;
-    case LDAX_D:
-        print_ldax(m_ostream, "D");
-        break;
-    case DCX_D:
-        print_dcx(m_ostream, "D");
-        break;
-    case INR_E:
-        print_inr(m_ostream, "E");
-        break;
-    case DCR_E:
-        print_dcr(m_ostream, "E");
-        break;
-    case MVI_E:
-        print_mvi(m_ostream, "E", get_next_byte());
-        break;
-    case RAR:
-        print_rar(m_ostream);
-        break;
-    case UNUSED_NOP_4:
-        print_unused_nop(m_ostream);
-        break;
-    case LXI_H:
-        print_lxi(m_ostream, "H", get_next_word());
-        break;
-    case SHLD:
-        print_shld(m_ostream, get_next_word());
-        break;
-    case INX_H:
-        print_inx(m_ostream, "H");
-        break;
-    case INR_H:
-        print_inr(m_ostream, "H");
-        break;
-    case DCR_H:
-        print_dcr(m_ostream, "H");
-        break;
-    case MVI_H:
-        print_mvi(m_ostream, "H", get_next_byte());
-        break;
-    case DAA:
-        print_daa(m_ostream);
-        break;
-    case UNUSED_NOP_5:
-        print_unused_nop(m_ostream);
-        break;
-    case DAD_H:
-        print_dad(m_ostream, "H");
-        break;
-    case LHLD:
-        print_lhld(m_ostream, get_next_word());
-        break;
-    case DCX_H:
-        print_dcx(m_ostream, "H");
-        break;
-    case INR_L:
-        print_inr(m_ostream, "L");
-        break;
-    case DCR_L:
-        print_dcr(m_ostream, "L");
-        break;
-    case MVI_L:
-        print_mvi(m_ostream, "L", get_next_byte());
-        break;
-    case CMA:
-        print_cma(m_ostream);
-        break;
-    case UNUSED_NOP_6:
-        print_unused_nop(m_ostream);
-        break;
-    case LXI_SP:
-        print_lxi(m_ostream, "SP", get_next_word());
-        break;
-    case STA:
-        print_sta(m_ostream, get_next_word());
-        break;
-    case INX_SP:
-        print_inx(m_ostream, "SP");
-        break;
-    case INR_M:
-        print_inr(m_ostream, "M");
-        break;
-    case DCR_M:
-        print_dcr(m_ostream, "M");
-        break;
-    case MVI_M:
-        print_mvi(m_ostream, "M", get_next_byte());
-        break;
-    case STC:
-        print_stc(m_ostream);
-        break;
-    case UNUSED_NOP_7:
-        print_unused_nop(m_ostream);
-        break;
-    case DAD_SP:
-        print_dad(m_ostream, "SP");
-        break;
-    case LDA:
-        print_lda(m_ostream, get_next_word());
-        break;
-    case DCX_SP:
-        print_dcx(m_ostream, "SP");
-        break;
-    case INR_A:
-        print_inr(m_ostream, "A");
-        break;
-    case DCR_A:
-        print_dcr(m_ostream, "A");
-        break;
-    case MVI_A:
-        print_mvi(m_ostream, "A", get_next_byte());
-        break;
-    case CMC:
-        print_cmc(m_ostream);
-        break;
-    case MOV_B_B:
-        print_mov(m_ostream, "B", "B");
-        break;
-    case MOV_B_C:
-        print_mov(m_ostream, "B", "C");
-        break;
-    case MOV_B_D:
-        print_mov(m_ostream, "B", "D");
-        break;
-    case MOV_B_E:
-        print_mov(m_ostream, "B", "E");
-        break;
-    case MOV_B_H:
-        print_mov(m_ostream, "B", "H");
-        break;
-    case MOV_B_L:
-        print_mov(m_ostream, "B", "L");
-        break;
-    case MOV_B_M:
-        print_mov(m_ostream, "B", "M");
-        break;
-    case MOV_B_A:
-        print_mov(m_ostream, "B", "A");
-        break;
-    case MOV_C_B:
-        print_mov(m_ostream, "C", "B");
-        break;
-    case MOV_C_C:
-        print_mov(m_ostream, "C", "C");
-        break;
-    case MOV_C_D:
-        print_mov(m_ostream, "C", "D");
-        break;
-    case MOV_C_E:
-        print_mov(m_ostream, "C", "E");
-        break;
-    case MOV_C_H:
-        print_mov(m_ostream, "C", "H");
-        break;
-    case MOV_C_L:
-        print_mov(m_ostream, "C", "L");
-        break;
-    case MOV_C_M:
-        print_mov(m_ostream, "C", "M");
-        break;
-    case MOV_C_A:
-        print_mov(m_ostream, "C", "A");
-        break;
-    case MOV_D_B:
-        print_mov(m_ostream, "D", "B");
-        break;
-    case MOV_D_C:
-        print_mov(m_ostream, "D", "C");
-        break;
-    case MOV_D_D:
-        print_mov(m_ostream, "D", "D");
-        break;
-    case MOV_D_E:
-        print_mov(m_ostream, "D", "E");
-        break;
-    case MOV_D_H:
-        print_mov(m_ostream, "D", "H");
-        break;
-    case MOV_D_L:
-        print_mov(m_ostream, "D", "L");
-        break;
-    case MOV_D_M:
-        print_mov(m_ostream, "D", "M");
-        break;
-    case MOV_D_A:
-        print_mov(m_ostream, "D", "A");
-        break;
-    case MOV_E_B:
-        print_mov(m_ostream, "E", "B");
-        break;
-    case MOV_E_C:
-        print_mov(m_ostream, "E", "C");
-        break;
-    case MOV_E_D:
-        print_mov(m_ostream, "E", "D");
-        break;
-    case MOV_E_E:
-        print_mov(m_ostream, "E", "E");
-        break;
-    case MOV_E_H:
-        print_mov(m_ostream, "E", "H");
-        break;
-    case MOV_E_L:
-        print_mov(m_ostream, "E", "L");
-        break;
-    case MOV_E_M:
-        print_mov(m_ostream, "E", "M");
-        break;
-    case MOV_E_A:
-        print_mov(m_ostream, "E", "A");
-        break;
-    case MOV_H_B:
-        print_mov(m_ostream, "H", "B");
-        break;
-    case MOV_H_C:
-        print_mov(m_ostream, "H", "C");
-        break;
-    case MOV_H_D:
-        print_mov(m_ostream, "H", "D");
-        break;
-    case MOV_H_E:
-        print_mov(m_ostream, "H", "E");
-        break;
-    case MOV_H_H:
-        print_mov(m_ostream, "H", "H");
-        break;
-    case MOV_H_L:
-        print_mov(m_ostream, "H", "L");
-        break;
-    case MOV_H_M:
-        print_mov(m_ostream, "H", "M");
-        break;
-    case MOV_H_A:
-        print_mov(m_ostream, "H", "A");
-        break;
-    case MOV_L_B:
-        print_mov(m_ostream, "L", "B");
-        break;
-    case MOV_L_C:
-        print_mov(m_ostream, "L", "C");
-        break;
-    case MOV_L_D:
-        print_mov(m_ostream, "L", "D");
-        break;
-    case MOV_L_E:
-        print_mov(m_ostream, "L", "E");
-        break;
-    case MOV_L_H:
-        print_mov(m_ostream, "L", "H");
-        break;
-    case MOV_L_L:
-        print_mov(m_ostream, "L", "L");
-        break;
-    case MOV_L_M:
-        print_mov(m_ostream, "L", "M");
-        break;
-    case MOV_L_A:
-        print_mov(m_ostream, "L", "A");
-        break;
-    case MOV_M_B:
-        print_mov(m_ostream, "M", "B");
-        break;
-    case MOV_M_C:
-        print_mov(m_ostream, "M", "C");
-        break;
-    case MOV_M_D:
-        print_mov(m_ostream, "M", "D");
-        break;
-    case MOV_M_E:
-        print_mov(m_ostream, "M", "E");
-        break;
-    case MOV_M_H:
-        print_mov(m_ostream, "M", "H");
-        break;
-    case MOV_M_L:
-        print_mov(m_ostream, "M", "L");
-        break;
-    case HLT:
-        print_hlt(m_ostream);
-        break;
-    case MOV_M_A:
-        print_mov(m_ostream, "M", "A");
-        break;
-    case MOV_A_B:
-        print_mov(m_ostream, "A", "B");
-        break;
-    case MOV_A_C:
-        print_mov(m_ostream, "A", "C");
-        break;
-    case MOV_A_D:
-        print_mov(m_ostream, "A", "D");
-        break;
-    case MOV_A_E:
-        print_mov(m_ostream, "A", "E");
-        break;
-    case MOV_A_H:
-        print_mov(m_ostream, "A", "H");
-        break;
-    case MOV_A_L:
-        print_mov(m_ostream, "A", "L");
-        break;
-    case MOV_A_M:
-        print_mov(m_ostream, "A", "M");
-        break;
-    case MOV_A_A:
-        print_mov(m_ostream, "A", "A");
-        break;
-    case ADD_B:
-        print_add(m_ostream, "B");
-        break;
-    case ADD_C:
-        print_add(m_ostream, "C");
-        break;
-    case ADD_D:
-        print_add(m_ostream, "D");
-        break;
-    case ADD_E:
-        print_add(m_ostream, "E");
-        break;
-    case ADD_H:
-        print_add(m_ostream, "H");
-        break;
-    case ADD_L:
-        print_add(m_ostream, "L");
-        break;
-    case ADD_M:
-        print_add(m_ostream, "M");
-        break;
-    case ADD_A:
-        print_add(m_ostream, "A");
-        break;
-    case ADC_B:
-        print_adc(m_ostream, "B");
-        break;
-    case ADC_C:
-        print_adc(m_ostream, "C");
-        break;
-    case ADC_D:
-        print_adc(m_ostream, "D");
-        break;
-    case ADC_E:
-        print_adc(m_ostream, "E");
-        break;
-    case ADC_H:
-        print_adc(m_ostream, "H");
-        break;
-    case ADC_L:
-        print_adc(m_ostream, "L");
-        break;
-    case ADC_M:
-        print_adc(m_ostream, "M");
-        break;
-    case ADC_A:
-        print_adc(m_ostream, "A");
-        break;
-    case SUB_B:
-        print_sub(m_ostream, "B");
-        break;
-    case SUB_C:
-        print_sub(m_ostream, "C");
-        break;
-    case SUB_D:
-        print_sub(m_ostream, "D");
-        break;
-    case SUB_E:
-        print_sub(m_ostream, "E");
-        break;
-    case SUB_H:
-        print_sub(m_ostream, "H");
-        break;
-    case SUB_L:
-        print_sub(m_ostream, "L");
-        break;
-    case SUB_M:
-        print_sub(m_ostream, "M");
-        break;
-    case SUB_A:
-        print_sub(m_ostream, "A");
-        break;
-    case SBB_B:
-        print_sbb(m_ostream, "B");
-        break;
-    case SBB_C:
-        print_sbb(m_ostream, "C");
-        break;
-    case SBB_D:
-        print_sbb(m_ostream, "D");
-        break;
-    case SBB_E:
-        print_sbb(m_ostream, "E");
-        break;
-    case SBB_H:
-        print_sbb(m_ostream, "H");
-        break;
-    case SBB_L:
-        print_sbb(m_ostream, "L");
-        break;
-    case SBB_M:
-        print_sbb(m_ostream, "M");
-        break;
-    case SBB_A:
-        print_sbb(m_ostream, "A");
-        break;
-    case ANA_B:
-        print_ana(m_ostream, "B");
-        break;
-    case ANA_C:
-        print_ana(m_ostream, "C");
-        break;
-    case ANA_D:
-        print_ana(m_ostream, "D");
-        break;
-    case ANA_E:
-        print_ana(m_ostream, "E");
-        break;
-    case ANA_H:
-        print_ana(m_ostream, "H");
-        break;
-    case ANA_L:
-        print_ana(m_ostream, "L");
-        break;
-    case ANA_M:
-        print_ana(m_ostream, "M");
-        break;
-    case ANA_A:
-        print_ana(m_ostream, "A");
-        break;
-    case XRA_B:
-        print_xra(m_ostream, "B");
-        break;
-    case XRA_C:
-        print_xra(m_ostream, "C");
-        break;
-    case XRA_D:
-        print_xra(m_ostream, "D");
-        break;
-    case XRA_E:
-        print_xra(m_ostream, "E");
-        break;
-    case XRA_H:
-        print_xra(m_ostream, "H");
-        break;
-    case XRA_L:
-        print_xra(m_ostream, "L");
-        break;
-    case XRA_M:
-        print_xra(m_ostream, "M");
-        break;
-    case XRA_A:
-        print_xra(m_ostream, "A");
-        break;
-    case ORA_B:
-        print_ora(m_ostream, "B");
-        break;
-    case ORA_C:
-        print_ora(m_ostream, "C");
-        break;
-    case ORA_D:
-        print_ora(m_ostream, "D");
-        break;
-    case ORA_E:
-        print_ora(m_ostream, "E");
-        break;
-    case ORA_H:
-        print_ora(m_ostream, "H");
-        break;
-    case ORA_L:
-        print_ora(m_ostream, "L");
-        break;
-    case ORA_M:
-        print_ora(m_ostream, "M");
-        break;
-    case ORA_A:
-        print_ora(m_ostream, "A");
-        break;
-    case CMP_B:
-        print_cmp(m_ostream, "B");
-        break;
-    case CMP_C:
-        print_cmp(m_ostream, "C");
-        break;
-    case CMP_D:
-        print_cmp(m_ostream, "D");
-        break;
-    case CMP_E:
-        print_cmp(m_ostream, "E");
-        break;
-    case CMP_H:
-        print_cmp(m_ostream, "H");
-        break;
-    case CMP_L:
-        print_cmp(m_ostream, "L");
-        break;
-    case CMP_M:
-        print_cmp(m_ostream, "M");
-        break;
-    case CMP_A:
-        print_cmp(m_ostream, "A");
-        break;
-    case RNZ:
-        print_rnz(m_ostream);
-        break;
-    case POP_B:
-        print_pop(m_ostream, "B");
-        break;
-    case JNZ:
-        print_jnz(m_ostream, get_next_word());
-        break;
+    decode_control_flow(instruction);
+
+    return instruction;
+}
+
+void Disassembler::decode_control_flow(DecodedInstruction<u16, u8>& instruction)
+{
+    const u8 opcode = instruction.m_bytes[0];
+    const u16 word = to_u16(instruction.m_bytes[2], instruction.m_bytes[1]);
+
+    switch (opcode) {
     case JMP:
-        print_jmp(m_ostream, get_next_word());
-        break;
-    case CNZ:
-        print_cnz(m_ostream, get_next_word());
-        break;
-    case PUSH_B:
-        print_push(m_ostream, "B");
-        break;
-    case ADI:
-        print_adi(m_ostream, get_next_byte());
-        break;
-    case RST_0:
-        print_rst(m_ostream, 0);
-        break;
-    case RZ:
-        print_rz(m_ostream);
-        break;
-    case RET:
-        print_ret(m_ostream);
-        break;
-    case JZ:
-        print_jz(m_ostream, get_next_word());
-        break;
     case UNUSED_JMP_1:
-        print_unused_jmp(m_ostream, get_next_word());
-        break;
-    case CZ:
-        print_cz(m_ostream, get_next_word());
-        break;
-    case CALL:
-        print_call(m_ostream, get_next_word());
-        break;
-    case ACI:
-        print_aci(m_ostream, get_next_byte());
-        break;
-    case RST_1:
-        print_rst(m_ostream, 1);
-        break;
-    case RNC:
-        print_rnc(m_ostream);
-        break;
-    case POP_D:
-        print_pop(m_ostream, "D");
+        instruction.m_control_flow = ControlFlow::Jump;
+        instruction.m_target = word;
         break;
+    case JNZ:
+    case JZ:
     case JNC:
-        print_jnc(m_ostream, get_next_word());
-        break;
-    case OUT:
-        print_out(m_ostream, get_next_byte());
-        break;
-    case CNC:
-        print_cnc(m_ostream, get_next_word());
-        break;
-    case PUSH_D:
-        print_push(m_ostream, "D");
-        break;
-    case SUI:
-        print_sui(m_ostream, get_next_byte());
-        break;
-    case RST_2:
-        print_rst(m_ostream, 2);
-        break;
-    case RC:
-        print_rc(m_ostream);
-        break;
-    case UNUSED_RET_1:
-        print_unused_ret(m_ostream);
-        break;
     case JC:
-        print_jc(m_ostream, get_next_word());
-        break;
-    case IN:
-        print_in(m_ostream, get_next_byte());
-        break;
-    case CC:
-        print_cc(m_ostream, get_next_word());
-        break;
-    case UNUSED_CALL_1:
-        print_unused_call(m_ostream, get_next_word());
-        break;
-    case SBI:
-        print_sbi(m_ostream, get_next_byte());
-        break;
-    case RST_3:
-        print_rst(m_ostream, 3);
-        break;
-    case RPO:
-        print_rpo(m_ostream);
-        break;
-    case POP_H:
-        print_pop(m_ostream, "H");
-        break;
     case JPO:
-        print_jpo(m_ostream, get_next_word());
-        break;
-    case XTHL:
-        print_xthl(m_ostream);
-        break;
-    case CPO:
-        print_cpo(m_ostream, get_next_word());
-        break;
-    case PUSH_H:
-        print_push(m_ostream, "H");
-        break;
-    case ANI:
-        print_ani(m_ostream, get_next_byte());
-        break;
-    case RST_4:
-        print_rst(m_ostream, 4);
-        break;
-    case RPE:
-        print_rpe(m_ostream);
-        break;
-    case PCHL:
-        print_pchl(m_ostream);
-        break;
     case JPE:
-        print_jpe(m_ostream, get_next_word());
-        break;
-    case XCHG:
-        print_xchg(m_ostream);
-        break;
-    case CPE:
-        print_cpe(m_ostream, get_next_word());
-        break;
-    case UNUSED_CALL_2:
-        print_unused_call(m_ostream, get_next_word());
-        break;
-    case XRI:
-        print_xri(m_ostream, get_next_byte());
-        break;
-    case RST_5:
-        print_rst(m_ostream, 5);
-        break;
-    case RP:
-        print_rp(m_ostream);
-        break;
-    case POP_PSW:
-        print_pop(m_ostream, "PSW");
-        break;
     case JP:
-        print_jp(m_ostream, get_next_word());
-        break;
-    case DI:
-        print_di(m_ostream);
+    case JM:
+        instruction.m_control_flow = ControlFlow::ConditionalJump;
+        instruction.m_target = word;
         break;
+    case CALL:
+    case UNUSED_CALL_1:
+    case UNUSED_CALL_2:
+    case UNUSED_CALL_3:
+    case CNZ:
+    case CZ:
+    case CNC:
+    case CC:
+    case CPO:
+    case CPE:
     case CP:
-        print_cp(m_ostream, get_next_word());
-        break;
-    case PUSH_PSW:
-        print_push(m_ostream, "PSW");
-        break;
-    case ORI:
-        print_ori(m_ostream, get_next_byte());
+    case CM:
+        instruction.m_control_flow = ControlFlow::Call;
+        instruction.m_target = word;
         break;
+    case RST_0:
+    case RST_1:
+    case RST_2:
+    case RST_3:
+    case RST_4:
+    case RST_5:
     case RST_6:
-        print_rst(m_ostream, 6);
+    case RST_7:
+        instruction.m_control_flow = ControlFlow::Call;
+        instruction.m_target = opcode & 0x38;
         break;
+    case RNZ:
+    case RZ:
+    case RNC:
+    case RC:
+    case RPO:
+    case RPE:
+    case RP:
     case RM:
-        print_rm(m_ostream);
-        break;
-    case SPHL:
-        print_sphl(m_ostream);
+        instruction.m_control_flow = ControlFlow::ConditionalReturn;
         break;
-    case JM:
-        print_jm(m_ostream, get_next_word());
-        break;
-    case EI:
-        print_ei(m_ostream);
-        break;
-    case CM:
-        print_cm(m_ostream, get_next_word());
-        break;
-    case UNUSED_CALL_3:
-        print_unused_call(m_ostream, get_next_word());
-        break;
-    case CPI:
-        print_cpi(m_ostream, get_next_byte());
+    case RET:
+    case UNUSED_RET_1:
+        instruction.m_control_flow = ControlFlow::Return;
         break;
-    case RST_7:
-        print_rst(m_ostream, 7);
+    case PCHL:
+        instruction.m_control_flow = ControlFlow::IndirectJump;
         break;
     default:
-        throw UnrecognizedOpcodeException(m_opcode);
+        break;
     }
-
-    m_ostream << "\n";
 }
 
-NextByte Disassembler::get_next_byte()
+TEST_CASE("8080: Disassembler")
 {
-    return {
-        .farg = m_memory.read(m_pc++)
-    };
+    SUBCASE("should only refer to the bytes of the instruction in the mnemonics")
+    {
+        for (unsigned int opcode = 0; opcode <= 0xff; ++opcode) {
+            EmulatorMemory<u16, u8> memory;
+            memory.add({ static_cast<u8>(opcode), 0x00, 0x00 });
+
+            DecodedInstruction<u16, u8> instruction = Disassembler::decode(memory, 0);
+            std::string line;
+            format_instruction(instruction, line);
+
+            std::fill(instruction.m_bytes.begin() + static_cast<std::ptrdiff_t>(instruction.m_length), instruction.m_bytes.end(), 0xff);
+            std::string line_with_other_bytes_after;
+            format_instruction(instruction, line_with_other_bytes_after);
+
+            CHECK_EQ(line, line_with_other_bytes_after);
+        }
+    }
+
+    SUBCASE("should list one line per instruction")
+    {
+        EmulatorMemory<u16, u8> memory;
+        memory.add({ LXI_B, 0x34, 0x12, MVI_M, 0xff, NOP });
+        std::stringstream ss;
+
+        Disassembler(memory, ss).disassemble();
+
+        CHECK_EQ("0000\t\tLXI B,1234\n0003\t\tMVI M,ff\n0005\t\tNOP\n", ss.str());
+    }
+
+    SUBCASE("should fill in the operands when the instruction is formatted")
+    {
+        EmulatorMemory<u16, u8> memory;
+        memory.add({ LXI_B, 0x34, 0x12, MVI_M, 0xff });
+        std::string line;
+
+        format_instruction(Disassembler::decode(memory, 0), line);
+        CHECK_EQ("0000\t\tLXI B,1234", line);
+        format_instruction(Disassembler::decode(memory, 3), line);
+        CHECK_EQ("0003\t\tMVI M,ff", line);
+    }
+
+    SUBCASE("should decode where the execution continues after jumps, calls and returns")
+    {
+        EmulatorMemory<u16, u8> memory;
+        memory.add({ JMP, 0x34, 0x12, JNZ, 0x10, 0x00, CALL, 0x00, 0x20, RST_1, RNZ, RET, PCHL, NOP });
+
+        CHECK_EQ(ControlFlow::Jump, Disassembler::decode(memory, 0).m_control_flow);
+        CHECK_EQ(0x1234, Disassembler::decode(memory, 0).m_target);
+        CHECK_EQ(ControlFlow::ConditionalJump, Disassembler::decode(memory, 3).m_control_flow);
+        CHECK_EQ(0x0010, Disassembler::decode(memory, 3).m_target);
+        CHECK_EQ(ControlFlow::Call, Disassembler::decode(memory, 6).m_control_flow);
+        CHECK_EQ(0x2000, Disassembler::decode(memory, 6).m_target);
+        CHECK_EQ(ControlFlow::Call, Disassembler::decode(memory, 9).m_control_flow);
+        CHECK_EQ(0x0008, Disassembler::decode(memory, 9).m_target);
+        CHECK_EQ(ControlFlow::ConditionalReturn, Disassembler::decode(memory, 10).m_control_flow);
+        CHECK_EQ(ControlFlow::Return, Disassembler::decode(memory, 11).m_control_flow);
+        CHECK_EQ(ControlFlow::IndirectJump, Disassembler::decode(memory, 12).m_control_flow);
+        CHECK_EQ(ControlFlow::Sequential, Disassembler::decode(memory, 13).m_control_flow);
+    }
 }
 
-NextWord Disassembler::get_next_word()
+/**
+ * The ROM is filled with pseudo-random bytes, so that every kind of instruction is disassembled.
+ * The last bytes are zero, so that no instruction is cut off by the end of the ROM.
+ */
+BENCHMARK("8080: Disassembler, 16 KB ROM")
 {
-    return {
-        .farg = m_memory.read(m_pc++),
-        .sarg = m_memory.read(m_pc++)
-    };
+    std::vector<u8> rom = pseudo_random_bytes(16 * 1024);
+    std::fill(rom.end() - 4, rom.end(), 0);
+
+    EmulatorMemory<u16, u8> memory;
+    memory.add(rom);
+
+    bench.run([&]() {
+        std::stringstream ss;
+        Disassembler disassembler(memory, ss);
+        disassembler.disassemble();
+        do_not_optimize(ss);
+    });
 }
 }
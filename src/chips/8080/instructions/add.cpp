@@ -5,8 +5,6 @@
 #include "instruction_util.h"
 #include "instructions.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
@@ -57,12 +55,6 @@ void add_m(u8& acc_reg, u8 value_in_memory, Flags& flag_reg, cyc& cycles)
     cycles = 7;
 }
 
-void print_add(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "ADD "
-            << reg;
-}
-
 TEST_CASE("8080: ADD")
 {
     cyc cycles = 0;
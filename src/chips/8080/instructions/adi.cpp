@@ -1,16 +1,12 @@
 #include "chips/8080/flags.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
 using emu::memory::NextByte;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Add immediate
@@ -40,12 +36,6 @@ void adi(u8& acc_reg, NextByte const& args, Flags& flag_reg, cyc& cycles)
     cycles = 7;
 }
 
-void print_adi(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "ADI "
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("8080: ADI")
 {
     cyc cycles = 0;
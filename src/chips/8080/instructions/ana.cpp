@@ -5,8 +5,6 @@
 #include "doctest.h"
 #include "instructions.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
@@ -76,12 +74,6 @@ void ana_m(u8& acc_reg, u8 value_in_memory, Flags& flag_reg, cyc& cycles)
     cycles = 7;
 }
 
-void print_ana(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "ANA "
-            << reg;
-}
-
 TEST_CASE("8080: ANA")
 {
     cyc cycles = 0;
@@ -2,17 +2,13 @@
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
 using emu::memory::NextByte;
 using emu::util::byte::is_bit_set;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * And immediate with accumulator
@@ -52,12 +48,6 @@ void ani(u8& acc_reg, NextByte const& args, Flags& flag_reg, cyc& cycles)
     cycles = 7;
 }
 
-void print_ani(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "ANI "
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("8080: ANI")
 {
     cyc cycles = 0;
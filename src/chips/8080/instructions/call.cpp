@@ -1,17 +1,13 @@
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/memory/next_word.h"
 #include "crosscutting/typedefs.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
-#include <iostream>
-#include <string>
 #include <vector>
 
 namespace emu::i8080 {
 
 using emu::memory::NextWord;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Call
@@ -35,13 +31,6 @@ void call(u16& pc, u16& sp, EmulatorMemory<u16, u8>& memory, NextWord const& arg
     cycles = 17;
 }
 
-void print_call(std::ostream& ostream, NextWord const& args)
-{
-    ostream << "CALL "
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("8080: CALL")
 {
     cyc cycles = 0;
@@ -1,7 +1,6 @@
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
 #include <cstdint>
-#include <iostream>
 
 namespace emu::i8080 {
 /**
@@ -23,11 +22,6 @@ void cma(u8& acc_reg, cyc& cycles)
     cycles = 4;
 }
 
-void print_cma(std::ostream& ostream)
-{
-    ostream << "CMA";
-}
-
 TEST_CASE("8080: CMA")
 {
     cyc cycles = 0;
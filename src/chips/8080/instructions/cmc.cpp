@@ -1,7 +1,6 @@
 #include "chips/8080/flags.h"
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::i8080 {
 /**
@@ -23,11 +22,6 @@ void cmc(Flags& flag_reg, cyc& cycles)
     cycles = 4;
 }
 
-void print_cmc(std::ostream& ostream)
-{
-    ostream << "CMC";
-}
-
 TEST_CASE("8080: CMC")
 {
     cyc cycles = 0;
@@ -2,8 +2,6 @@
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
@@ -61,11 +59,6 @@ void cmp_m(u8& acc_reg, u8 value_in_memory, Flags& flag_reg, cyc& cycles)
     cycles = 7;
 }
 
-void print_cmp(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "CMP " << reg;
-}
-
 TEST_CASE("8080: CMP")
 {
     cyc cycles = 0;
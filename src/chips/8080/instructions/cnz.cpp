@@ -3,18 +3,14 @@
 #include "crosscutting/memory/next_word.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
-#include <iostream>
-#include <string>
 #include <vector>
 
 namespace emu::i8080 {
 
 using emu::memory::NextWord;
 using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Call if not zero
@@ -44,13 +40,6 @@ void cnz(u16& pc, u16& sp, EmulatorMemory<u16, u8>& memory, NextWord const& args
     cycles += 11;
 }
 
-void print_cnz(std::ostream& ostream, NextWord const& args)
-{
-    ostream << "CNZ "
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("8080: CNZ")
 {
     cyc cycles = 0;
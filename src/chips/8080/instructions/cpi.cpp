@@ -1,16 +1,12 @@
 #include "chips/8080/flags.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
 using emu::memory::NextByte;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Compare immediate with accumulator
@@ -39,12 +35,6 @@ void cpi(u8& acc_reg, NextByte const& args, Flags& flag_reg, cyc& cycles)
     cycles = 7;
 }
 
-void print_cpi(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "CPI "
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("8080: CPI")
 {
     cyc cycles = 0;
@@ -3,18 +3,14 @@
 #include "crosscutting/memory/next_word.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
-#include <iostream>
-#include <string>
 #include <vector>
 
 namespace emu::i8080 {
 
 using emu::memory::NextWord;
 using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Call if zero
@@ -45,13 +41,6 @@ void cz(u16& pc, u16& sp, EmulatorMemory<u16, u8>& memory, NextWord const& args,
     cycles += 11;
 }
 
-void print_cz(std::ostream& ostream, NextWord const& args)
-{
-    ostream << "CZ "
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("8080: CZ")
 {
     cyc cycles = 0;
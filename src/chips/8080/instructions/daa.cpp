@@ -2,7 +2,6 @@
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
 #include "instruction_util.h"
-#include <iostream>
 
 namespace emu::i8080 {
 /**
@@ -46,11 +45,6 @@ void daa(u8& acc_reg, Flags& flag_reg, cyc& cycles)
     cycles = 4;
 }
 
-void print_daa(std::ostream& ostream)
-{
-    ostream << "DAA";
-}
-
 TEST_CASE("8080: DAA")
 {
     cyc cycles = 0;
@@ -3,8 +3,6 @@
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
@@ -39,12 +37,6 @@ void dad(u8& h_reg, u8& l_reg, u16 value_to_add, Flags& flag_reg, cyc& cycles)
     cycles = 10;
 }
 
-void print_dad(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "DAD "
-            << reg;
-}
-
 TEST_CASE("8080: DAD")
 {
     cyc cycles = 0;
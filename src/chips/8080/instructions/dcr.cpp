@@ -2,8 +2,6 @@
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
@@ -65,12 +63,6 @@ void dcr_m(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc& c
     cycles = 10;
 }
 
-void print_dcr(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "DCR "
-            << reg;
-}
-
 TEST_CASE("8080: DCR")
 {
     cyc cycles = 0;
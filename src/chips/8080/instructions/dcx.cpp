@@ -1,16 +1,10 @@
+#include "chips/8080/register_file.h"
 #include "crosscutting/typedefs.h"
-#include "crosscutting/util/byte_util.h"
 #include "doctest.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
-using emu::util::byte::high_byte;
-using emu::util::byte::low_byte;
-using emu::util::byte::to_u16;
-
 /**
  * Decrement register pair
  * <ul>
@@ -20,17 +14,13 @@ using emu::util::byte::to_u16;
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param reg1 is the first register in the register pair, which will be mutated
- * @param reg2 is the second register in the register pair, which will be mutated
+ * @param registers is the register file, which will be mutated
+ * @param rp is the register pair to decrement
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void dcx(u8& reg1, u8& reg2, cyc& cycles)
+void dcx(RegisterFile& registers, RegisterPair rp, cyc& cycles)
 {
-    u16 val = to_u16(reg1, reg2);
-    --val;
-
-    reg2 = low_byte(val);
-    reg1 = high_byte(val);
+    registers.set_pair(rp, registers.pair(rp) - 1);
 
     cycles = 5;
 }
@@ -54,35 +44,24 @@ void dcx_sp(u16& sp, cyc& cycles)
     cycles = 5;
 }
 
-void print_dcx(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "DCX "
-            << reg;
-}
-
 TEST_CASE("8080: DCX")
 {
     cyc cycles = 0;
-    u8 reg1 = UINT8_MAX;
-    u8 reg2 = UINT8_MAX;
-    u8 expected_reg1 = UINT8_MAX;
-    u8 expected_reg2;
+    RegisterFile registers;
     u16 sp = UINT16_MAX;
 
     SUBCASE("should decrease register pair")
     {
-        for (int i = UINT16_MAX; i > UINT16_MAX; --i) {
-            if (reg2 == 0 && i != 0) {
-                --expected_reg1;
-            }
-
-            expected_reg2 = i - 1;
+        registers.set_pair(RegisterPair::DE, UINT16_MAX);
 
-            dcx(reg1, reg2, cycles);
+        for (int expected = UINT16_MAX - 1; expected >= 0; --expected) {
+            dcx(registers, RegisterPair::DE, cycles);
 
-            CHECK_EQ(expected_reg1, reg1);
-            CHECK_EQ(expected_reg2, reg2);
+            CHECK_EQ(expected, registers.de());
         }
+
+        CHECK_EQ(0, registers.bc());
+        CHECK_EQ(0, registers.hl());
     }
 
     SUBCASE("should decrease SP")
@@ -99,7 +78,7 @@ TEST_CASE("8080: DCX")
     {
         cycles = 0;
 
-        dcx(reg1, reg2, cycles);
+        dcx(registers, RegisterPair::BC, cycles);
 
         CHECK_EQ(5, cycles);
 
@@ -1,6 +1,5 @@
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::i8080 {
 /**
@@ -22,11 +21,6 @@ void di(bool& inte, cyc& cycles)
     cycles = 4;
 }
 
-void print_di(std::ostream& ostream)
-{
-    ostream << "DI";
-}
-
 TEST_CASE("8080: DI")
 {
     cyc cycles = 0;
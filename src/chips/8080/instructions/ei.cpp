@@ -1,6 +1,5 @@
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::i8080 {
 /**
@@ -22,11 +21,6 @@ void ei(bool& inte, cyc& cycles)
     cycles = 4;
 }
 
-void print_ei(std::ostream& ostream)
-{
-    ostream << "EI";
-}
-
 TEST_CASE("8080: EI")
 {
     cyc cycles = 0;
@@ -1,6 +1,5 @@
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::i8080 {
 /**
@@ -22,11 +21,6 @@ void hlt(bool& is_halted, cyc& cycles)
     cycles = 7;
 }
 
-void print_hlt(std::ostream& ostream)
-{
-    ostream << "HLT";
-}
-
 TEST_CASE("8080: HLT")
 {
     cyc cycles = 0;
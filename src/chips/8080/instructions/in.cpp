@@ -1,15 +1,11 @@
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 #include <vector>
 
 namespace emu::i8080 {
 
 using emu::memory::NextByte;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Input from port
@@ -32,12 +28,6 @@ void in(u8& acc_reg, NextByte const& args, std::vector<u8> io, cyc& cycles)
     cycles = 10;
 }
 
-void print_in(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "IN "
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("8080: IN")
 {
     cyc cycles = 0;
@@ -3,8 +3,6 @@
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
@@ -66,12 +64,6 @@ void inr_m(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc& c
     cycles = 10;
 }
 
-void print_inr(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "INR "
-            << reg;
-}
-
 TEST_CASE("8080: INR")
 {
     cyc cycles = 0;
@@ -1,11 +1,11 @@
 #pragma once
 
 #include "chips/8080/flags.h"
+#include "chips/8080/register_file.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/memory/next_word.h"
 #include "crosscutting/typedefs.h"
-#include <string>
 #include <vector>
 
 // @formatter:off
@@ -300,7 +300,7 @@ void daa(u8& acc_reg, Flags& flag_reg, cyc& cycles);
 void dad(u8& h_reg, u8& l_reg, u16 value, Flags& flag_reg, cyc& cycles);
 void dcr_r(u8& reg, Flags& flag_reg, cyc& cycles);
 void dcr_m(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc& cycles);
-void dcx(u8& reg1, u8& reg2, cyc& cycles);
+void dcx(RegisterFile& registers, RegisterPair rp, cyc& cycles);
 void dcx_sp(u16& sp, cyc& cycles);
 void di(bool& inte, cyc& cycles);
 void ei(bool& inte, cyc& cycles);
@@ -308,7 +308,7 @@ void hlt(bool& stopped, cyc& cycles);
 void in(u8& acc_reg, NextByte const& args, std::vector<u8> io, cyc& cycles);
 void inr_r(u8& reg, Flags& flag_reg, cyc& cycles);
 void inr_m(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc& cycles);
-void inx(u8& reg1, u8& reg2, cyc& cycles);
+void inx(RegisterFile& registers, RegisterPair rp, cyc& cycles);
 void inx_sp(u16& sp, cyc& cycles);
 void jc(u16& pc, NextWord const& args, Flags const& flag_reg, cyc& cycles);
 void jm(u16& pc, NextWord const& args, Flags const& flag_reg, cyc& cycles);
@@ -322,7 +322,7 @@ void jz(u16& pc, NextWord const& args, Flags const& flag_reg, cyc& cycles);
 void lda(u8& acc_reg, EmulatorMemory<u16, u8> const& memory, NextWord const& args, cyc& cycles);
 void ldax(u8& acc_reg, u8 reg1, u8 reg2, EmulatorMemory<u16, u8> const& memory, cyc& cycles);
 void lhld(u8& l_reg, u8& h_reg, EmulatorMemory<u16, u8> const& memory, NextWord const& args, cyc& cycles);
-void lxi(u8& reg1, u8& reg2, NextWord const& args, cyc& cycles);
+void lxi(RegisterFile& registers, RegisterPair rp, NextWord const& args, cyc& cycles);
 void lxi_sp(u16& sp, NextWord const& args, cyc& cycles);
 void mov_r_r(u8& to, u8 value, cyc& cycles);
 void mov_r_m(u8& to, u8 value_in_memory, cyc& cycles);
@@ -335,9 +335,9 @@ void ora_m(u8& acc_reg, u8 value_in_memory, Flags& flag_reg, cyc& cycles);
 void ori(u8& acc_reg, NextByte const& args, Flags& flag_reg, cyc& cycles);
 void out(u8 acc_reg, NextByte const& args, std::vector<u8>& io, cyc& cycles);
 void pchl(u16& pc, u16 address, cyc& cycles);
-void pop(u8& reg1, u8& reg2, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles);
+void pop(RegisterFile& registers, RegisterPair rp, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles);
 void pop_psw(Flags& flag_reg, u8& acc_reg, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles);
-void push(u8 reg1, u8 reg2, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles);
+void push(RegisterFile const& registers, RegisterPair rp, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles);
 void push_psw(Flags const& flag_reg, u8 acc_reg, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles);
 void ral(u8& acc_reg, Flags& flag_reg, cyc& cycles);
 void rar(u8& acc_reg, Flags& flag_reg, cyc& cycles);
@@ -373,93 +373,10 @@ void sub_m(u8& acc_reg, u8 value_in_memory, Flags& flag_reg, cyc& cycles);
 void sui(u8& acc_reg, NextByte const& args, Flags& flag_reg, cyc& cycles);
 void unused_1(u8 opcode, cyc& cycles);
 void unused_3(u8 opcode, u16& pc, cyc& cycles);
-void xchg(u8& h_reg, u8& l_reg, u8& d_reg, u8& e_reg, cyc& cycles);
+void xchg(RegisterFile& registers, cyc& cycles);
 void xra_r(u8& acc_reg, u8 value, Flags& flag_reg, cyc& cycles);
 void xra_m(u8& acc_reg, u8 value_in_memory, Flags& flag_reg, cyc& cycles);
 void xri(u8& acc_reg, NextByte const& args, Flags& flag_reg, cyc& cycles);
 void xthl(u16 sp, EmulatorMemory<u16, u8>& memory, u8& h_reg, u8& l_reg, cyc& cycles);
-
-void print_aci(std::ostream& ostream, NextByte const& args);
-void print_adc(std::ostream& ostream, std::string const& reg);
-void print_add(std::ostream& ostream, std::string const& reg);
-void print_adi(std::ostream& ostream, NextByte const& args);
-void print_ana(std::ostream& ostream, std::string const& reg);
-void print_ani(std::ostream& ostream, NextByte const& args);
-void print_call(std::ostream& ostream, NextWord const& args);
-void print_cc(std::ostream& ostream, NextWord const& args);
-void print_cm(std::ostream& ostream, NextWord const& args);
-void print_cma(std::ostream& ostream);
-void print_cmc(std::ostream& ostream);
-void print_cmp(std::ostream& ostream, std::string const& reg);
-void print_cnc(std::ostream& ostream, NextWord const& args);
-void print_cnz(std::ostream& ostream, NextWord const& args);
-void print_cp(std::ostream& ostream, NextWord const& args);
-void print_cpe(std::ostream& ostream, NextWord const& args);
-void print_cpi(std::ostream& ostream, NextByte const& args);
-void print_cpo(std::ostream& ostream, NextWord const& args);
-void print_cz(std::ostream& ostream, NextWord const& args);
-void print_daa(std::ostream& ostream);
-void print_dad(std::ostream& ostream, std::string const& reg);
-void print_di(std::ostream& ostream);
-void print_dcr(std::ostream& ostream, std::string const& reg);
-void print_dcx(std::ostream& ostream, std::string const& reg);
-void print_ei(std::ostream& ostream);
-void print_hlt(std::ostream& ostream);
-void print_in(std::ostream& ostream, NextByte const& args);
-void print_jc(std::ostream& ostream, NextWord const& args);
-void print_jz(std::ostream& ostream, NextWord const& args);
-void print_jm(std::ostream& ostream, NextWord const& args);
-void print_jmp(std::ostream& ostream, NextWord const& args);
-void print_jnc(std::ostream& ostream, NextWord const& args);
-void print_jnz(std::ostream& ostream, NextWord const& args);
-void print_jp(std::ostream& ostream, NextWord const& args);
-void print_jpe(std::ostream& ostream, NextWord const& args);
-void print_jpo(std::ostream& ostream, NextWord const& args);
-void print_lda(std::ostream& ostream, NextWord const& args);
-void print_ldax(std::ostream& ostream, std::string const& reg);
-void print_lhld(std::ostream& ostream, NextWord const& args);
-void print_lxi(std::ostream& ostream, std::string const& reg, NextWord const& args);
-void print_inr(std::ostream& ostream, std::string const& reg);
-void print_inx(std::ostream& ostream, std::string const& reg);
-void print_mvi(std::ostream& ostream, std::string const& reg, NextByte const& args);
-void print_mov(std::ostream& ostream, std::string const& reg1, std::string const& reg2);
-void print_nop(std::ostream& ostream);
-void print_ora(std::ostream& ostream, std::string const& reg);
-void print_ori(std::ostream& ostream, NextByte const& args);
-void print_pchl(std::ostream& ostream);
-void print_pop(std::ostream& ostream, std::string const& reg);
-void print_push(std::ostream& ostream, std::string const& reg);
-void print_out(std::ostream& ostream, NextByte const& args);
-void print_ral(std::ostream& ostream);
-void print_rar(std::ostream& ostream);
-void print_rc(std::ostream& ostream);
-void print_ret(std::ostream& ostream);
-void print_rlc(std::ostream& ostream, std::string const& reg);
-void print_rm(std::ostream& ostream);
-void print_rnc(std::ostream& ostream);
-void print_rnz(std::ostream& ostream);
-void print_rp(std::ostream& ostream);
-void print_rpe(std::ostream& ostream);
-void print_rpo(std::ostream& ostream);
-void print_rst(std::ostream& ostream, int number);
-void print_rrc(std::ostream& ostream);
-void print_rz(std::ostream& ostream);
-void print_sbb(std::ostream& ostream, std::string const& reg);
-void print_sbi(std::ostream& ostream, NextByte const& args);
-void print_shld(std::ostream& ostream, NextWord const& args);
-void print_sphl(std::ostream& ostream);
-void print_sta(std::ostream& ostream, NextWord const& args);
-void print_stax(std::ostream& ostream, std::string const& reg);
-void print_stc(std::ostream& ostream);
-void print_sub(std::ostream& ostream, std::string const& reg);
-void print_sui(std::ostream& ostream, NextByte const& args);
-void print_unused_nop(std::ostream& ostream);
-void print_unused_jmp(std::ostream& ostream, NextWord const& args);
-void print_unused_ret(std::ostream& ostream);
-void print_unused_call(std::ostream& ostream, NextWord const& args);
-void print_xchg(std::ostream& ostream);
-void print_xra(std::ostream& ostream, std::string const& reg);
-void print_xri(std::ostream& ostream, NextByte const& args);
-void print_xthl(std::ostream& ostream);
 }
 // @formatter:on
@@ -1,16 +1,10 @@
+#include "chips/8080/register_file.h"
 #include "crosscutting/typedefs.h"
-#include "crosscutting/util/byte_util.h"
 #include "doctest.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
-using emu::util::byte::high_byte;
-using emu::util::byte::low_byte;
-using emu::util::byte::to_u16;
-
 /**
  * Increment register pair
  * <ul>
@@ -20,17 +14,13 @@ using emu::util::byte::to_u16;
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param reg1 is the first register in the register pair, which will be mutated
- * @param reg2 is the second register in the register pair, which will be mutated
+ * @param registers is the register file, which will be mutated
+ * @param rp is the register pair to increment
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void inx(u8& reg1, u8& reg2, cyc& cycles)
+void inx(RegisterFile& registers, RegisterPair rp, cyc& cycles)
 {
-    u16 val = to_u16(reg1, reg2);
-    ++val;
-
-    reg2 = low_byte(val);
-    reg1 = high_byte(val);
+    registers.set_pair(rp, registers.pair(rp) + 1);
 
     cycles = 5;
 }
@@ -54,17 +44,10 @@ void inx_sp(u16& sp, cyc& cycles)
     cycles = 5;
 }
 
-void print_inx(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "INX "
-            << reg;
-}
-
 TEST_CASE("8080: INX")
 {
     cyc cycles = 0;
-    u8 reg1 = 0;
-    u8 reg2 = 0;
+    RegisterFile registers;
     u8 expected_reg1 = 0;
     u8 expected_reg2;
     u16 sp = 0;
@@ -72,16 +55,16 @@ TEST_CASE("8080: INX")
     SUBCASE("should increase register pair")
     {
         for (int i = 0; i < UINT16_MAX; ++i) {
-            inx(reg1, reg2, cycles);
+            inx(registers, RegisterPair::BC, cycles);
 
-            if (reg2 % (UINT8_MAX + 1) == 0 && i != 0) {
+            if (registers.c() % (UINT8_MAX + 1) == 0 && i != 0) {
                 ++expected_reg1;
             }
 
             expected_reg2 = i + 1;
 
-            CHECK_EQ(expected_reg1, reg1);
-            CHECK_EQ(expected_reg2, reg2);
+            CHECK_EQ(expected_reg1, registers.b());
+            CHECK_EQ(expected_reg2, registers.c());
         }
     }
 
@@ -100,7 +83,7 @@ TEST_CASE("8080: INX")
     {
         cycles = 0;
 
-        inx(reg1, reg2, cycles);
+        inx(registers, RegisterPair::HL, cycles);
 
         CHECK_EQ(5, cycles);
 
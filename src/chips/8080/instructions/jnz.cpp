@@ -2,16 +2,12 @@
 #include "crosscutting/memory/next_word.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
 using emu::memory::NextWord;
 using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Jump if not zero
@@ -36,13 +32,6 @@ void jnz(u16& pc, NextWord const& args, Flags const& flag_reg, cyc& cycles)
     cycles = 10;
 }
 
-void print_jnz(std::ostream& ostream, NextWord const& args)
-{
-    ostream << "JNZ "
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("8080: JNZ")
 {
     cyc cycles = 0;
@@ -2,16 +2,12 @@
 #include "crosscutting/memory/next_word.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
 using emu::memory::NextWord;
 using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Jump if positive
@@ -36,13 +32,6 @@ void jp(u16& pc, NextWord const& args, Flags const& flag_reg, cyc& cycles)
     cycles = 10;
 }
 
-void print_jp(std::ostream& ostream, NextWord const& args)
-{
-    ostream << "JP "
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("8080: JP")
 {
     cyc cycles = 0;
@@ -2,8 +2,6 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 #include <vector>
 
 namespace emu::i8080 {
@@ -33,12 +31,6 @@ void ldax(u8& acc_reg, u8 reg1, u8 reg2, EmulatorMemory<u16, u8> const& memory,
     cycles = 7;
 }
 
-void print_ldax(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "LDAX "
-            << reg;
-}
-
 TEST_CASE("8080: LDAX")
 {
     cyc cycles = 0;
@@ -1,16 +1,13 @@
+#include "chips/8080/register_file.h"
 #include "crosscutting/memory/next_word.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
 using emu::memory::NextWord;
 using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Load register pair immediate
@@ -21,15 +18,14 @@ using emu::util::string::hexify_wo_0x;
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param reg1 is the first register to load into, which will be mutated
- * @param reg2 is the second register to load into, which will be mutated
+ * @param registers is the register file, which will be mutated
+ * @param rp is the register pair to load into
  * @param args contains value to load into the registers
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void lxi(u8& reg1, u8& reg2, NextWord const& args, cyc& cycles)
+void lxi(RegisterFile& registers, RegisterPair rp, NextWord const& args, cyc& cycles)
 {
-    reg1 = args.sarg;
-    reg2 = args.farg;
+    registers.set_pair(rp, to_u16(args.sarg, args.farg));
 
     cycles = 10;
 }
@@ -54,28 +50,21 @@ void lxi_sp(u16& sp, NextWord const& args, cyc& cycles)
     cycles = 10;
 }
 
-void print_lxi(std::ostream& ostream, std::string const& reg, NextWord const& args)
-{
-    ostream << "LXI "
-            << reg << ","
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("8080: LXI")
 {
     cyc cycles = 0;
     u16 sp = 0xe;
-    u8 reg1 = 0xe;
-    u8 reg2 = 0;
+    RegisterFile registers;
     NextWord args = { .farg = 0x12, .sarg = 0x3a };
 
     SUBCASE("should load immediate into register pair")
     {
-        lxi(reg1, reg2, args, cycles);
+        lxi(registers, RegisterPair::DE, args, cycles);
 
-        CHECK_EQ(args.sarg, reg1);
-        CHECK_EQ(args.farg, reg2);
+        CHECK_EQ(args.sarg, registers.d());
+        CHECK_EQ(args.farg, registers.e());
+        CHECK_EQ(0, registers.bc());
+        CHECK_EQ(0, registers.hl());
     }
 
     SUBCASE("should load immediate into SP")
@@ -89,7 +78,7 @@ TEST_CASE("8080: LXI")
     {
         cycles = 0;
 
-        lxi(reg1, reg2, args, cycles);
+        lxi(registers, RegisterPair::BC, args, cycles);
 
         CHECK_EQ(10, cycles);
     }
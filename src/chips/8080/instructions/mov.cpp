@@ -2,8 +2,6 @@
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
 #include "instructions.h"
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
@@ -79,13 +77,6 @@ void mov_m_r(EmulatorMemory<u16, u8>& memory, u16 address, u8 new_value, cyc& cy
     cycles = 7;
 }
 
-void print_mov(std::ostream& ostream, std::string const& reg1, std::string const& reg2)
-{
-    ostream << "MOV "
-            << reg1 << ","
-            << reg2;
-}
-
 TEST_CASE("8080: MOV")
 {
     cyc cycles = 0;
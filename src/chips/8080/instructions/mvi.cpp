@@ -1,16 +1,12 @@
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
 using emu::memory::EmulatorMemory;
 using emu::memory::NextByte;
-using emu::util::string::hexify_wo_0x;
 
 void mvi(u8& reg, NextByte const& args)
 {
@@ -62,13 +58,6 @@ void mvi_m(EmulatorMemory<u16, u8>& memory, u16 address, NextByte const& args, c
     cycles = 10;
 }
 
-void print_mvi(std::ostream& ostream, std::string const& reg, NextByte const& args)
-{
-    ostream << "MVI "
-            << reg << ","
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("8080: MVI")
 {
     cyc cycles = 0;
@@ -1,6 +1,5 @@
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::i8080 {
 /**
@@ -18,11 +17,6 @@ void nop(cyc& cycles)
     cycles = 4;
 }
 
-void print_nop(std::ostream& ostream)
-{
-    ostream << "NOP";
-}
-
 TEST_CASE("8080: NOP")
 {
     cyc cycles = 0;
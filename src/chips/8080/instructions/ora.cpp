@@ -4,8 +4,6 @@
 #include "doctest.h"
 #include "instructions.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
@@ -67,12 +65,6 @@ void ora_m(u8& acc_reg, u8 value_in_memory, Flags& flag_reg, cyc& cycles)
     cycles = 7;
 }
 
-void print_ora(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "ORA "
-            << reg;
-}
-
 TEST_CASE("8080: ORA")
 {
     cyc cycles = 0;
@@ -1,16 +1,12 @@
 #include "chips/8080/flags.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
 using emu::memory::NextByte;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Or immediate with accumulator
@@ -44,12 +40,6 @@ void ori(u8& acc_reg, NextByte const& args, Flags& flag_reg, cyc& cycles)
     cycles = 7;
 }
 
-void print_ori(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "ORI "
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("8080: ORI")
 {
     cyc cycles = 0;
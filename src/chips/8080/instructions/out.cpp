@@ -1,15 +1,11 @@
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 #include <vector>
 
 namespace emu::i8080 {
 
 using emu::memory::NextByte;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Output to port
@@ -32,12 +28,6 @@ void out(u8 acc_reg, NextByte const& args, std::vector<u8>& io, cyc& cycles)
     cycles = 10;
 }
 
-void print_out(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "OUT "
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("8080: OUT")
 {
     cyc cycles = 0;
@@ -1,6 +1,5 @@
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::i8080 {
 /**
@@ -23,11 +22,6 @@ void pchl(u16& pc, u16 address, cyc& cycles)
     cycles = 5;
 }
 
-void print_pchl(std::ostream& ostream)
-{
-    ostream << "PCHL";
-}
-
 TEST_CASE("8080: PCHL")
 {
     cyc cycles = 0;
@@ -1,14 +1,15 @@
 #include "chips/8080/flags.h"
+#include "chips/8080/register_file.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/typedefs.h"
+#include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 #include <vector>
 
 namespace emu::i8080 {
 
 using emu::memory::EmulatorMemory;
+using emu::util::byte::to_u16;
 
 /**
  * Pop
@@ -19,16 +20,18 @@ using emu::memory::EmulatorMemory;
  *   <li>Condition bits affected: carry, auxiliary carry, zero, sign, parity</li>
  * </ul>
  *
- * @param reg1 is the first register to pop to, which will be mutated
- * @param reg2 is the second register to pop to, which will be mutated
+ * @param registers is the register file, which will be mutated
+ * @param rp is the register pair to pop to
  * @param sp is the stack pointer, which will be mutated
  * @param memory is the memory
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void pop(u8& reg1, u8& reg2, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles)
+void pop(RegisterFile& registers, RegisterPair rp, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles)
 {
-    reg2 = memory.read(sp++);
-    reg1 = memory.read(sp++);
+    const u8 lo = memory.read(sp++);
+    const u8 hi = memory.read(sp++);
+
+    registers.set_pair(rp, to_u16(hi, lo));
 
     cycles = 10;
 }
@@ -55,12 +58,6 @@ void pop_psw(Flags& flag_reg, u8& acc_reg, u16& sp, EmulatorMemory<u16, u8> cons
     cycles = 10;
 }
 
-void print_pop(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "POP "
-            << reg;
-}
-
 TEST_CASE("8080: POP")
 {
     cyc cycles = 0;
@@ -70,14 +67,15 @@ TEST_CASE("8080: POP")
 
     SUBCASE("should pop register from stack")
     {
-        u8 reg1 = 0xaa;
-        u8 reg2 = 0xbb;
+        RegisterFile registers;
         u16 sp = 0x03;
 
-        pop(reg1, reg2, sp, memory, cycles);
+        pop(registers, RegisterPair::HL, sp, memory, cycles);
 
-        CHECK_EQ(memory.read(0x03), reg2);
-        CHECK_EQ(memory.read(0x04), reg1);
+        CHECK_EQ(memory.read(0x03), registers.l());
+        CHECK_EQ(memory.read(0x04), registers.h());
+        CHECK_EQ(0, registers.bc());
+        CHECK_EQ(0, registers.de());
         CHECK_EQ(0x05, sp);
     }
 
@@ -102,11 +100,10 @@ TEST_CASE("8080: POP")
     {
         cycles = 0;
 
-        u8 reg1 = 0;
-        u8 reg2 = 0;
+        RegisterFile registers;
         u16 sp = 0x03;
 
-        pop(reg1, reg2, sp, memory, cycles);
+        pop(registers, RegisterPair::BC, sp, memory, cycles);
 
         CHECK_EQ(10, cycles);
     }
@@ -1,14 +1,16 @@
 #include "chips/8080/flags.h"
+#include "chips/8080/register_file.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/typedefs.h"
+#include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 #include <vector>
 
 namespace emu::i8080 {
 
 using emu::memory::EmulatorMemory;
+using emu::util::byte::high_byte;
+using emu::util::byte::low_byte;
 
 /**
  * Push
@@ -19,16 +21,17 @@ using emu::memory::EmulatorMemory;
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param reg1 is the first register to place in memory
- * @param reg2 is the second register to place in memory
+ * @param registers is the register file
+ * @param rp is the register pair to place in memory
  * @param sp is the stack pointer, which will be mutated
  * @param memory is the memory, which will be mutated
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void push(u8 reg1, u8 reg2, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles)
+void push(RegisterFile const& registers, RegisterPair rp, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles)
 {
-    memory.write(--sp, reg1);
-    memory.write(--sp, reg2);
+    const u16 value = registers.pair(rp);
+    memory.write(--sp, high_byte(value));
+    memory.write(--sp, low_byte(value));
 
     cycles = 11;
 }
@@ -56,29 +59,24 @@ void push_psw(Flags const& flag_reg, u8 acc_reg, u16& sp, EmulatorMemory<u16, u8
     cycles = 11;
 }
 
-void print_push(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "PUSH "
-            << reg;
-}
-
 TEST_CASE("8080: PUSH")
 {
     cyc cycles = 0;
 
     SUBCASE("should push registers onto the stack")
     {
-        u8 reg1 = 0xaa;
-        u8 reg2 = 0xbb;
+        RegisterFile registers;
+        registers.d() = 0xaa;
+        registers.e() = 0xbb;
         u16 sp = 0x03;
 
         EmulatorMemory<u16, u8> memory;
         memory.add(std::vector<u8> { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 });
 
-        push(reg1, reg2, sp, memory, cycles);
+        push(registers, RegisterPair::DE, sp, memory, cycles);
 
-        CHECK_EQ(reg1, memory.read(0x2));
-        CHECK_EQ(reg2, memory.read(0x1));
+        CHECK_EQ(0xaa, memory.read(0x2));
+        CHECK_EQ(0xbb, memory.read(0x1));
         CHECK_EQ(0x01, sp);
     }
 
@@ -107,14 +105,13 @@ TEST_CASE("8080: PUSH")
     {
         cycles = 0;
 
-        u8 reg1 = 0;
-        u8 reg2 = 0;
+        const RegisterFile registers;
         u16 sp = 0x03;
 
         EmulatorMemory<u16, u8> memory;
         memory.add(std::vector<u8> { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 });
 
-        push(reg1, reg2, sp, memory, cycles);
+        push(registers, RegisterPair::BC, sp, memory, cycles);
 
         CHECK_EQ(11, cycles);
     }
@@ -4,7 +4,6 @@
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
 
 namespace emu::i8080 {
 
@@ -40,11 +39,6 @@ void ral(u8& acc_reg, Flags& flag_reg, cyc& cycles)
     cycles = 4;
 }
 
-void print_ral(std::ostream& ostream)
-{
-    ostream << "RAL";
-}
-
 TEST_CASE("8080: RAL")
 {
     cyc cycles = 0;
@@ -3,7 +3,6 @@
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
 #include "instruction_util.h"
-#include <iostream>
 #include <vector>
 
 namespace emu::i8080 {
@@ -35,11 +34,6 @@ void rc(u16& pc, u16& sp, EmulatorMemory<u16, u8> const& memory, Flags const& fl
     cycles += 5;
 }
 
-void print_rc(std::ostream& ostream)
-{
-    ostream << "RC";
-}
-
 TEST_CASE("8080: RC")
 {
     cyc cycles = 0;
@@ -2,7 +2,6 @@
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
 #include "instruction_util.h"
-#include <iostream>
 #include <vector>
 
 namespace emu::i8080 {
@@ -28,11 +27,6 @@ void ret(u16& pc, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles)
     cycles = 10;
 }
 
-void print_ret(std::ostream& ostream)
-{
-    ostream << "RET";
-}
-
 TEST_CASE("8080: RET")
 {
     cyc cycles = 0;
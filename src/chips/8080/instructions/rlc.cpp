@@ -4,8 +4,6 @@
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
@@ -39,12 +37,6 @@ void rlc(u8& acc_reg, Flags& flag_reg, cyc& cycles)
     cycles = 4;
 }
 
-void print_rlc(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "RLC "
-            << reg;
-}
-
 TEST_CASE("8080: RLC")
 {
     cyc cycles = 0;
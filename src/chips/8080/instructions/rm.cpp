@@ -4,7 +4,6 @@
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
-#include <iostream>
 #include <vector>
 
 namespace emu::i8080 {
@@ -39,11 +38,6 @@ void rm(u16& pc, u16& sp, EmulatorMemory<u16, u8>& memory, Flags const& flag_reg
     cycles += 5;
 }
 
-void print_rm(std::ostream& ostream)
-{
-    ostream << "RM";
-}
-
 TEST_CASE("8080: RM")
 {
     cyc cycles = 0;
@@ -4,7 +4,6 @@
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
-#include <iostream>
 #include <vector>
 
 namespace emu::i8080 {
@@ -39,11 +38,6 @@ void rp(u16& pc, u16& sp, EmulatorMemory<u16, u8> const& memory, Flags const& fl
     cycles += 5;
 }
 
-void print_rp(std::ostream& ostream)
-{
-    ostream << "RP";
-}
-
 TEST_CASE("8080: RP")
 {
     cyc cycles = 0;
@@ -4,7 +4,6 @@
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
 
 namespace emu::i8080 {
 
@@ -38,11 +37,6 @@ void rrc(u8& acc_reg, Flags& flag_reg, cyc& cycles)
     cycles = 4;
 }
 
-void print_rrc(std::ostream& ostream)
-{
-    ostream << "RRC";
-}
-
 TEST_CASE("8080: RRC")
 {
     cyc cycles = 0;
@@ -3,7 +3,6 @@
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
-#include <iostream>
 #include <vector>
 
 namespace emu::i8080 {
@@ -172,12 +171,6 @@ void rst_7(u16& pc, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles)
     rst(pc, 0x38, sp, memory, cycles);
 }
 
-void print_rst(std::ostream& ostream, int number)
-{
-    ostream << "RST "
-            << number;
-}
-
 TEST_CASE("8080: RST")
 {
     SUBCASE("should push PC onto the stack and change to the new PC -- 0")
@@ -4,8 +4,6 @@
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
@@ -56,12 +54,6 @@ void sbb_m(u8& acc_reg, u8 value_in_memory, Flags& flag_reg, cyc& cycles)
     cycles = 7;
 }
 
-void print_sbb(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "SBB "
-            << reg;
-}
-
 TEST_CASE("8080: SBB")
 {
     cyc cycles = 0;
@@ -1,7 +1,6 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::i8080 {
 
@@ -27,11 +26,6 @@ void sphl(u16& sp, u16 address_in_hl, cyc& cycles)
     cycles = 5;
 }
 
-void print_sphl(std::ostream& ostream)
-{
-    ostream << "SPHL";
-}
-
 TEST_CASE("8080: SPHL")
 {
     cyc cycles = 0;
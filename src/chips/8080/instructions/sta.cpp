@@ -2,10 +2,7 @@
 #include "crosscutting/memory/next_word.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 #include <vector>
 
 namespace emu::i8080 {
@@ -13,7 +10,6 @@ namespace emu::i8080 {
 using emu::memory::EmulatorMemory;
 using emu::memory::NextWord;
 using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Store accumulator direct
@@ -38,13 +34,6 @@ void sta(u8& acc_reg, EmulatorMemory<u16, u8>& memory, NextWord const& args, cyc
     cycles = 13;
 }
 
-void print_sta(std::ostream& ostream, NextWord const& args)
-{
-    ostream << "STA "
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("8080: STA")
 {
     cyc cycles = 0;
@@ -2,8 +2,6 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 #include <vector>
 
 namespace emu::i8080 {
@@ -35,12 +33,6 @@ void stax(u8 acc_reg, u8 reg1, u8 reg2, EmulatorMemory<u16, u8>& memory, cyc& cy
     cycles = 7;
 }
 
-void print_stax(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "STAX "
-            << reg;
-}
-
 TEST_CASE("8080: STAX")
 {
     cyc cycles = 0;
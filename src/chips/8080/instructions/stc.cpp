@@ -1,7 +1,6 @@
 #include "chips/8080/flags.h"
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::i8080 {
 /**
@@ -23,11 +22,6 @@ void stc(Flags& flag_reg, cyc& cycles)
     cycles = 4;
 }
 
-void print_stc(std::ostream& ostream)
-{
-    ostream << "STC";
-}
-
 TEST_CASE("8080: STC")
 {
     cyc cycles = 0;
@@ -1,17 +1,13 @@
 #include "chips/8080/flags.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
 using emu::memory::NextByte;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Subtract immediate
@@ -34,12 +30,6 @@ void sui(u8& acc_reg, NextByte const& args, Flags& flag_reg, cyc& cycles)
     cycles = 7;
 }
 
-void print_sui(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "SUI "
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("8080: SUI")
 {
     cyc cycles = 0;
@@ -2,13 +2,10 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/string_util.h"
 #include <iostream>
-#include <string>
 
 namespace emu::i8080 {
 
-using emu::memory::NextWord;
 using emu::util::string::hexify;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Unused instruction of size 1
@@ -32,28 +29,4 @@ void unused_3(u8 opcode, u16& pc, cyc& cycles)
     unused_1(opcode, cycles);
     pc += 2;
 }
-
-void print_unused_nop(std::ostream& ostream)
-{
-    ostream << "*NOP";
-}
-
-void print_unused_jmp(std::ostream& ostream, NextWord const& args)
-{
-    ostream << "*JMP "
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg);
-}
-
-void print_unused_ret(std::ostream& ostream)
-{
-    ostream << "*RET";
-}
-
-void print_unused_call(std::ostream& ostream, NextWord const& args)
-{
-    ostream << "*CALL "
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg);
-}
 }
@@ -1,6 +1,6 @@
+#include "chips/8080/register_file.h"
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::i8080 {
 /**
@@ -12,58 +12,44 @@ namespace emu::i8080 {
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param h_reg is the H register, which will be mutated
- * @param l_reg is the L register, which will be mutated
- * @param d_reg is the D register, which will be mutated
- * @param e_reg is the E register, which will be mutated
+ * @param registers is the register file, which will be mutated
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void xchg(u8& h_reg, u8& l_reg, u8& d_reg, u8& e_reg, cyc& cycles)
+void xchg(RegisterFile& registers, cyc& cycles)
 {
-    const u8 h = h_reg;
-    const u8 l = l_reg;
-    h_reg = d_reg;
-    l_reg = e_reg;
-    d_reg = h;
-    e_reg = l;
+    const u16 de = registers.de();
+    registers.set_pair(RegisterPair::DE, registers.hl());
+    registers.set_pair(RegisterPair::HL, de);
 
     cycles = 4;
 }
 
-void print_xchg(std::ostream& ostream)
-{
-    ostream << "XCHG";
-}
-
 TEST_CASE("8080: XCHG")
 {
     cyc cycles = 0;
 
     SUBCASE("should exchange HL with DE")
     {
-        u8 h_reg = 0x11;
-        u8 l_reg = 0x22;
-        u8 d_reg = 0x33;
-        u8 e_reg = 0x44;
+        RegisterFile registers;
+        registers.set_pair(RegisterPair::HL, 0x1122);
+        registers.set_pair(RegisterPair::DE, 0x3344);
 
-        xchg(h_reg, l_reg, d_reg, e_reg, cycles);
+        xchg(registers, cycles);
 
-        CHECK_EQ(0x33, h_reg);
-        CHECK_EQ(0x44, l_reg);
-        CHECK_EQ(0x11, d_reg);
-        CHECK_EQ(0x22, e_reg);
+        CHECK_EQ(0x33, registers.h());
+        CHECK_EQ(0x44, registers.l());
+        CHECK_EQ(0x11, registers.d());
+        CHECK_EQ(0x22, registers.e());
     }
 
     SUBCASE("should use 4 cycles")
     {
         cycles = 0;
 
-        u8 h_reg = 0x11;
-        u8 l_reg = 0x22;
-        u8 d_reg = 0;
-        u8 e_reg = 0;
+        RegisterFile registers;
+        registers.set_pair(RegisterPair::HL, 0x1122);
 
-        xchg(h_reg, l_reg, d_reg, e_reg, cycles);
+        xchg(registers, cycles);
 
         CHECK_EQ(4, cycles);
     }
@@ -2,7 +2,6 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::i8080 {
 
@@ -44,11 +43,6 @@ void xthl(u16 sp, EmulatorMemory<u16, u8>& memory, u8& h_reg, u8& l_reg, cyc& cy
     cycles = 18;
 }
 
-void print_xthl(std::ostream& ostream)
-{
-    ostream << "XTHL";
-}
-
 TEST_CASE("8080: XTHL")
 {
     cyc cycles = 0;
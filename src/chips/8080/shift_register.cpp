@@ -1,4 +1,5 @@
 #include "shift_register.h"
+#include "crosscutting/misc/state_stream.h"
 
 namespace emu::i8080 {
 
@@ -25,4 +26,16 @@ u8 ShiftRegister::read() const
     u16 result = m_value << m_offset;
     return (result & 0xff00) >> 8;
 }
+
+void ShiftRegister::save_state(StateWriter& writer) const
+{
+    writer.write(m_value);
+    writer.write(m_offset);
+}
+
+void ShiftRegister::load_state(StateReader& reader)
+{
+    m_value = reader.read<u16>();
+    m_offset = reader.read<u8>();
+}
 }
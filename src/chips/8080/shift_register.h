@@ -2,8 +2,16 @@
 
 #include "crosscutting/typedefs.h"
 
+namespace emu::misc {
+class StateReader;
+class StateWriter;
+}
+
 namespace emu::i8080 {
 
+using emu::misc::StateReader;
+using emu::misc::StateWriter;
+
 class ShiftRegister {
 
 public:
@@ -15,6 +23,10 @@ public:
 
     [[nodiscard]] u8 read() const;
 
+    void save_state(StateWriter& writer) const;
+
+    void load_state(StateReader& reader);
+
 private:
     u16 m_value;
     u8 m_offset;
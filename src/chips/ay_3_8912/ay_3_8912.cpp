@@ -0,0 +1,264 @@
+#include "ay_3_8912.h"
+#include "crosscutting/util/byte_util.h"
+#include "doctest.h"
+#include <algorithm>
+
+namespace emu::ay {
+
+using emu::util::byte::is_bit_set;
+using emu::util::byte::to_u16;
+
+Ay38912::Ay38912(u32 clock_frequency, u32 sample_rate)
+    : m_clock_frequency(clock_frequency)
+    , m_sample_rate(sample_rate)
+{
+}
+
+void Ay38912::select_register(u8 register_number)
+{
+    m_selected_register = register_number & (s_number_of_registers - 1);
+}
+
+u8 Ay38912::selected_register() const
+{
+    return m_selected_register;
+}
+
+u8 Ay38912::read_register() const
+{
+    return m_registers[m_selected_register];
+}
+
+void Ay38912::write_register(u8 value, cyc clock_cycle)
+{
+    const u8 masked_value = value & s_register_masks[m_selected_register];
+
+    m_registers[m_selected_register] = masked_value;
+    m_writes.push_back({ .m_clock_cycle = clock_cycle, .m_register = m_selected_register, .m_value = masked_value });
+}
+
+void Ay38912::render(cyc clock_cycles, std::vector<i16>& output)
+{
+    const cyc end = m_clock_cycles_left_over + clock_cycles;
+    auto write = m_writes.begin();
+
+    cyc clock_cycle = 0;
+    for (; clock_cycle + s_clock_cycles_per_step <= end; clock_cycle += s_clock_cycles_per_step) {
+        while (write != m_writes.end() && write->m_clock_cycle <= clock_cycle) {
+            apply(*write);
+            ++write;
+        }
+
+        step();
+
+        m_sum += mix();
+        ++m_steps_in_sum;
+
+        // The samples are the average of the steps since the last sample
+        m_sample_phase += static_cast<u64>(m_sample_rate) * s_clock_cycles_per_step;
+        if (m_sample_phase >= m_clock_frequency) {
+            m_sample_phase -= m_clock_frequency;
+            output.push_back(static_cast<i16>(m_sum / static_cast<float>(m_steps_in_sum) * s_max_amplitude));
+            m_sum = 0;
+            m_steps_in_sum = 0;
+        }
+    }
+
+    for (; write != m_writes.end(); ++write) {
+        apply(*write);
+    }
+
+    m_writes.clear();
+    m_clock_cycles_left_over = end - clock_cycle;
+}
+
+void Ay38912::apply(Write const& write)
+{
+    m_rendered_registers[write.m_register] = write.m_value;
+
+    if (write.m_register == s_register_envelope_shape) {
+        m_envelope_attack = is_bit_set(write.m_value, s_envelope_attack_bit) ? 0x0f : 0x00;
+        if (is_bit_set(write.m_value, s_envelope_continue_bit)) {
+            m_is_envelope_hold = is_bit_set(write.m_value, s_envelope_hold_bit);
+            m_is_envelope_alternating = is_bit_set(write.m_value, s_envelope_alternate_bit);
+        } else { // Goes to 0 and stays there after the first cycle
+            m_is_envelope_hold = true;
+            m_is_envelope_alternating = m_envelope_attack != 0;
+        }
+        m_envelope_step = 0x0f;
+        m_envelope_counter = 0;
+        m_is_envelope_holding = false;
+    }
+}
+
+void Ay38912::step()
+{
+    for (std::size_t channel = 0; channel < s_number_of_channels; ++channel) {
+        if (++m_tone_counters[channel] >= tone_period(channel)) {
+            m_tone_counters[channel] = 0;
+            m_tone_outputs[channel] = !m_tone_outputs[channel];
+        }
+    }
+
+    m_is_noise_step = !m_is_noise_step;
+    if (!m_is_noise_step) {
+        return;
+    }
+
+    const u16 noise_period = std::max<u16>(1, m_rendered_registers[s_register_noise_period]);
+    if (++m_noise_counter >= noise_period) {
+        m_noise_counter = 0;
+        // 17-bit LFSR with taps at bit 0 and 3
+        const u32 feedback = (m_noise_shift_register ^ (m_noise_shift_register >> 3)) & 1;
+        m_noise_shift_register = (m_noise_shift_register >> 1) | (feedback << 16);
+    }
+
+    const u32 envelope_period = std::max<u32>(1, to_u16(m_rendered_registers[s_register_envelope_period_coarse], m_rendered_registers[s_register_envelope_period_fine]));
+    if (++m_envelope_counter >= envelope_period) {
+        m_envelope_counter = 0;
+        step_envelope();
+    }
+}
+
+void Ay38912::step_envelope()
+{
+    if (m_is_envelope_holding) {
+        return;
+    }
+
+    if (--m_envelope_step < 0) {
+        if (m_is_envelope_alternating) {
+            m_envelope_attack ^= 0x0f;
+        }
+
+        if (m_is_envelope_hold) {
+            m_is_envelope_holding = true;
+            m_envelope_step = 0;
+        } else {
+            m_envelope_step = 0x0f;
+        }
+    }
+}
+
+/**
+ * A channel is high when both its tone and the noise are high, or disabled in the mixer. A channel
+ * with both disabled is always high, which is how samples are played by writing to the amplitude.
+ */
+float Ay38912::mix() const
+{
+    const u8 mixer = m_rendered_registers[s_register_mixer];
+    const bool is_noise_high = (m_noise_shift_register & 1) != 0;
+
+    float level = 0;
+    for (std::size_t channel = 0; channel < s_number_of_channels; ++channel) {
+        const bool is_tone_passing = m_tone_outputs[channel] || is_bit_set(mixer, static_cast<unsigned int>(channel));
+        const bool is_noise_passing = is_noise_high || is_bit_set(mixer, static_cast<unsigned int>(channel + s_number_of_channels));
+        if (is_tone_passing && is_noise_passing) {
+            const u8 amplitude = m_rendered_registers[s_register_amplitude_a + channel];
+            level += s_levels[is_bit_set(amplitude, s_envelope_mode_bit) ? envelope_level() : amplitude & 0x0f];
+        }
+    }
+
+    return level;
+}
+
+u16 Ay38912::tone_period(std::size_t channel) const
+{
+    const u16 period = to_u16(m_rendered_registers[2 * channel + 1], m_rendered_registers[2 * channel]);
+
+    return std::max<u16>(1, period);
+}
+
+u8 Ay38912::envelope_level() const
+{
+    return static_cast<u8>(m_envelope_step ^ m_envelope_attack) & 0x0f;
+}
+
+static void write_for_test(Ay38912& ay, u8 register_number, u8 value, cyc clock_cycle = 0)
+{
+    ay.select_register(register_number);
+    ay.write_register(value, clock_cycle);
+}
+
+TEST_CASE("AY-3-8912")
+{
+    // One step per sample, so the samples are not averaged
+    constexpr u32 clock_frequency = 1000000;
+    constexpr u32 sample_rate = clock_frequency / 8;
+
+    Ay38912 ay(clock_frequency, sample_rate);
+    std::vector<i16> samples;
+
+    SUBCASE("should only keep the bits of the registers that exist")
+    {
+        write_for_test(ay, 1, 0xff);
+        write_for_test(ay, 7, 0xff);
+
+        ay.select_register(1);
+        CHECK_EQ(0x0f, ay.read_register());
+        ay.select_register(7);
+        CHECK_EQ(0xff, ay.read_register());
+    }
+
+    SUBCASE("should toggle the tone every period")
+    {
+        write_for_test(ay, 0, 10);         // Tone A period
+        write_for_test(ay, 7, 0b00111110); // Only tone A
+        write_for_test(ay, 8, 15);         // Max amplitude on A
+
+        ay.render(8 * 1000, samples);
+
+        REQUIRE_EQ(1000, samples.size());
+        std::size_t number_of_toggles = 0;
+        for (std::size_t i = 1; i < samples.size(); ++i) {
+            number_of_toggles += samples[i] != samples[i - 1] ? 1 : 0;
+        }
+        CHECK_EQ(100, number_of_toggles);
+    }
+
+    SUBCASE("should apply the writes at their timestamps")
+    {
+        write_for_test(ay, 7, 0xff);
+        write_for_test(ay, 8, 15, 8 * 100);
+
+        ay.render(8 * 200, samples);
+
+        REQUIRE_EQ(200, samples.size());
+        CHECK_EQ(0, samples[99]);
+        CHECK_GT(samples[100], 0);
+        CHECK_EQ(samples[100], samples[199]);
+    }
+
+    SUBCASE("should hold the envelope at the top after rising once with shape 1101")
+    {
+        write_for_test(ay, 7, 0xff);
+        write_for_test(ay, 8, 0x10); // Envelope on A
+        write_for_test(ay, 11, 1);   // The envelope steps every other sample
+        write_for_test(ay, 13, 0b1101);
+
+        ay.render(8 * 100, samples);
+
+        CHECK_LT(samples[1], samples[20]);
+        CHECK_EQ(samples[40], samples[99]);
+
+        samples.clear();
+        write_for_test(ay, 8, 15);
+        ay.render(8 * 10, samples);
+
+        CHECK_EQ(samples[9], samples[0]); // Max amplitude equals the top of the envelope
+    }
+
+    SUBCASE("should average the steps down to the sample rate")
+    {
+        Ay38912 decimating_ay(clock_frequency, sample_rate / 4);
+        write_for_test(decimating_ay, 0, 2);
+        write_for_test(decimating_ay, 7, 0b00111110);
+        write_for_test(decimating_ay, 8, 15);
+
+        decimating_ay.render(8 * 400, samples);
+
+        REQUIRE_EQ(100, samples.size());
+        CHECK_EQ(samples[10], samples[50]); // High half of the time in every sample
+    }
+}
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace emu::ay {
+
+/**
+ * The AY-3-8912 sound generator, with three square wave channels, a noise generator and an
+ * envelope generator, which are mixed to one mono output.
+ *
+ * The writes to the registers are timestamped and queued, and the sound is rendered a whole block
+ * at a time. The generators are stepped at an eighth of the clock, where every tone can change,
+ * and the result is averaged down to the sample rate of the host, which filters away what is
+ * above the sample rate. This costs little, since nothing is done per emulated CPU cycle.
+ */
+class Ay38912 {
+public:
+    static constexpr std::size_t s_number_of_registers = 16;
+
+    /**
+     * @param clock_frequency is the frequency of the clock of the chip, in Hz
+     * @param sample_rate is the sample rate of the rendered audio, in Hz
+     */
+    Ay38912(u32 clock_frequency, u32 sample_rate);
+
+    void select_register(u8 register_number);
+
+    [[nodiscard]] u8 selected_register() const;
+
+    /**
+     * @return the value of the selected register, which is the last value written to it
+     */
+    [[nodiscard]] u8 read_register() const;
+
+    /**
+     * Writes to the selected register. The sound changes when the block with the write is rendered.
+     *
+     * @param value is the value to write
+     * @param clock_cycle is when the write happens, in clock cycles since the start of the block
+     */
+    void write_register(u8 value, cyc clock_cycle);
+
+    /**
+     * Renders a block, with the writes done during the block applied at their timestamps.
+     *
+     * @param clock_cycles is the length of the block, in clock cycles
+     * @param output is where the samples are appended
+     */
+    void render(cyc clock_cycles, std::vector<i16>& output);
+
+private:
+    static constexpr cyc s_clock_cycles_per_step = 8;
+    static constexpr std::size_t s_number_of_channels = 3;
+    static constexpr std::size_t s_number_of_levels = 16;
+    static constexpr u32 s_noise_seed = 1;
+    static constexpr i16 s_max_amplitude = 8000; // Per channel, so there's room for the beeper
+
+    static constexpr u8 s_register_noise_period = 6;
+    static constexpr u8 s_register_mixer = 7;
+    static constexpr u8 s_register_amplitude_a = 8;
+    static constexpr u8 s_register_envelope_period_fine = 11;
+    static constexpr u8 s_register_envelope_period_coarse = 12;
+    static constexpr u8 s_register_envelope_shape = 13;
+
+    static constexpr u8 s_envelope_mode_bit = 4;
+    static constexpr u8 s_envelope_hold_bit = 0;
+    static constexpr u8 s_envelope_alternate_bit = 1;
+    static constexpr u8 s_envelope_attack_bit = 2;
+    static constexpr u8 s_envelope_continue_bit = 3;
+
+    // Which bits of each register are there
+    static constexpr std::array<u8, s_number_of_registers> s_register_masks = {
+        0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x1f, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0xff, 0x0f, 0xff, 0xff
+    };
+
+    // The DAC is logarithmic, with about 3 dB between the levels
+    static constexpr std::array<float, s_number_of_levels> s_levels = {
+        0.0f, 0.00999f, 0.01445f, 0.02106f, 0.03070f, 0.04555f, 0.06450f, 0.10736f,
+        0.12659f, 0.20499f, 0.29221f, 0.37284f, 0.49253f, 0.63532f, 0.80558f, 1.0f
+    };
+
+    struct Write {
+        cyc m_clock_cycle;
+        u8 m_register;
+        u8 m_value;
+    };
+
+    u32 m_clock_frequency;
+    u32 m_sample_rate;
+
+    std::array<u8, s_number_of_registers> m_registers {};
+    u8 m_selected_register { 0 };
+    std::vector<Write> m_writes;
+
+    // The registers as far as the sound has been rendered
+    std::array<u8, s_number_of_registers> m_rendered_registers {};
+
+    std::array<u16, s_number_of_channels> m_tone_counters {};
+    std::array<bool, s_number_of_channels> m_tone_outputs {};
+    u16 m_noise_counter { 0 };
+    u32 m_noise_shift_register { s_noise_seed };
+    bool m_is_noise_step { false }; // The noise and envelope generators are stepped at half the rate of the tones
+    u32 m_envelope_counter { 0 };
+    int m_envelope_step { 0 };
+    u8 m_envelope_attack { 0 };
+    bool m_is_envelope_holding { false };
+    bool m_is_envelope_alternating { false };
+    bool m_is_envelope_hold { false };
+
+    cyc m_clock_cycles_left_over { 0 };
+    float m_sum { 0 };
+    u32 m_steps_in_sum { 0 };
+    u64 m_sample_phase { 0 };
+
+    void apply(Write const& write);
+
+    void step();
+
+    void step_envelope();
+
+    [[nodiscard]] float mix() const;
+
+    [[nodiscard]] u16 tone_period(std::size_t channel) const;
+
+    [[nodiscard]] u8 envelope_level() const;
+};
+}
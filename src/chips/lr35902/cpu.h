@@ -3,7 +3,7 @@
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/memory/next_word.h"
 #include "crosscutting/typedefs.h"
-#include "flags.h"
+#include "register_file.h"
 #include <cstddef>
 
 namespace emu::memory {
@@ -84,15 +84,7 @@ private:
 //    u16 m_sp { 0xffff };
     u16 m_sp { 0 };
     u16 m_pc;
-//    u8 m_acc_reg { 0xff }; // TODO: real value
-    u8 m_acc_reg { 0 };
-    u8 m_b_reg { 0 };
-    u8 m_c_reg { 0 };
-    u8 m_d_reg { 0 };
-    u8 m_e_reg { 0 };
-    u8 m_h_reg { 0 };
-    u8 m_l_reg { 0 };
-    Flags m_flag_reg;
+    RegisterFile m_registers;
 
     void next_bits_instruction(u8 bits_opcode, cyc& cycles);
 
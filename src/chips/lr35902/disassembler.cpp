@@ -1,1768 +1,930 @@
 #include "disassembler.h"
+#include "crosscutting/benchmarking/benchmark.h"
 #include "crosscutting/memory/emulator_memory.h"
-#include "crosscutting/util/string_util.h"
+#include "crosscutting/util/byte_util.h"
+#include "doctest.h"
 #include "instructions/instructions.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <vector>
 
 namespace emu::lr35902 {
 
-using emu::util::string::hexify;
-using emu::util::string::hexify_wo_0x;
+using emu::benchmarking::do_not_optimize;
+using emu::benchmarking::pseudo_random_bytes;
+using emu::debugger::ControlFlow;
+using emu::debugger::format_instruction;
+using emu::util::byte::to_u16;
 
-Disassembler::Disassembler(EmulatorMemory<u16, u8>& memory, std::ostream& ostream)
-    : m_memory(memory)
-    , m_memory_size(memory.size())
-    , m_pc(0)
-    , m_opcode(0)
-    , m_ostream(ostream)
-{
-}
-
-void Disassembler::disassemble()
-{
-    while (m_pc < m_memory_size) {
-        print_next_instruction();
-    }
-}
-
-void Disassembler::print_next_instruction()
-{
-    m_ostream << hexify_wo_0x(m_pc, 4) << "\t\t";
-
-    m_opcode = get_next_byte().farg;
-
-    if (0x0104 <= m_pc && m_pc <= 0x014f + 1) {
-        print_cartridge_header();
-        return;
-    }
-
-    switch (m_opcode) {
-    case NOP:
-        print_nop(m_ostream);
-        break;
-    case LD_BC_nn:
-        print_ld_dd_nn(m_ostream, "BC", get_next_word());
-        break;
-    case LD_MBC_A:
-        print_ld(m_ostream, "(BC)", "A");
-        break;
-    case INC_BC:
-        print_inc(m_ostream, "BC");
-        break;
-    case INC_B:
-        print_inc(m_ostream, "B");
-        break;
-    case DEC_B:
-        print_dec(m_ostream, "B");
-        break;
-    case LD_B_n:
-        print_ld(m_ostream, "B", get_next_byte());
-        break;
-    case RLCA:
-        print_rlca(m_ostream);
-        break;
-    case LD_Mnn_SP:
-        print_ld(m_ostream, get_next_word(), "SP");
-        break;
-    case ADD_HL_BC:
-        print_add(m_ostream, "HL", "BC");
-        break;
-    case LD_A_MBC:
-        print_ld(m_ostream, "A", "(BC)");
-        break;
-    case DEC_BC:
-        print_dec(m_ostream, "BC");
-        break;
-    case INC_C:
-        print_inc(m_ostream, "C");
-        break;
-    case DEC_C:
-        print_dec(m_ostream, "C");
-        break;
-    case LD_C_n:
-        print_ld(m_ostream, "C", get_next_byte());
-        break;
-    case RRCA:
-        print_rrca(m_ostream);
-        break;
-    case STOP_0:
-        print_stop(m_ostream);
-        break;
-    case LD_DE_nn:
-        print_ld_dd_nn(m_ostream, "DE", get_next_word());
-        break;
-    case LD_MDE_A:
-        print_ld(m_ostream, "(DE)", "A");
-        break;
-    case INC_DE:
-        print_inc(m_ostream, "DE");
-        break;
-    case INC_D:
-        print_inc(m_ostream, "D");
-        break;
-    case DEC_D:
-        print_dec(m_ostream, "D");
-        break;
-    case LD_D_n:
-        print_ld(m_ostream, "D", get_next_byte());
-        break;
-    case RLA:
-        print_rla(m_ostream);
-        break;
-    case JR_e:
-        print_jr(m_ostream, get_next_byte());
-        break;
-    case ADD_HL_DE:
-        print_add(m_ostream, "HL", "DE");
-        break;
-    case LD_A_MDE:
-        print_ld(m_ostream, "A", "(DE)");
-        break;
-    case DEC_DE:
-        print_dec(m_ostream, "D");
-        break;
-    case INC_E:
-        print_inc(m_ostream, "E");
-        break;
-    case DEC_E:
-        print_dec(m_ostream, "E");
-        break;
-    case LD_E_n:
-        print_ld(m_ostream, "E", get_next_byte());
-        break;
-    case RRA:
-        print_rra(m_ostream);
-        break;
-    case JR_NZ_e:
-        print_jr(m_ostream, "NZ", get_next_byte());
-        break;
-    case LD_HL_nn:
-        print_ld_dd_nn(m_ostream, "HL", get_next_word());
-        break;
-    case LD_MHLp_A:
-        print_ld(m_ostream, "(HL+)", "A");
-        break;
-    case INC_HL:
-        print_inc(m_ostream, "HL");
-        break;
-    case INC_H:
-        print_inc(m_ostream, "H");
-        break;
-    case DEC_H:
-        print_dec(m_ostream, "H");
-        break;
-    case LD_H_n:
-        print_ld(m_ostream, "H", get_next_byte());
-        break;
-    case DAA:
-        print_daa(m_ostream);
-        break;
-    case JR_Z_e:
-        print_jr(m_ostream, "Z", get_next_byte());
-        break;
-    case ADD_HL_HL:
-        print_add(m_ostream, "HL", "HL");
-        break;
-    case LD_A_MHLp:
-        print_ld(m_ostream, "A", "(HL+)");
-        break;
-    case DEC_HL:
-        print_dec(m_ostream, "HL");
-        break;
-    case INC_L:
-        print_inc(m_ostream, "L");
-        break;
-    case DEC_L:
-        print_dec(m_ostream, "L");
-        break;
-    case LD_L_n:
-        print_ld(m_ostream, "L", get_next_byte());
-        break;
-    case CPL:
-        print_cpl(m_ostream);
-        break;
-    case JR_NC_e:
-        print_jr(m_ostream, "NC", get_next_byte());
-        break;
-    case LD_SP_nn:
-        print_ld_dd_nn(m_ostream, "SP", get_next_word());
-        break;
-    case LH_MHLm_A:
-        print_ld(m_ostream, "(HL-)", "A");
-        break;
-    case INC_SP:
-        print_inc(m_ostream, "SP");
-        break;
-    case INC_MHL:
-        print_inc(m_ostream, "(HL)");
-        break;
-    case DEC_MHL:
-        print_dec(m_ostream, "(HL)");
-        break;
-    case LD_MHL_n:
-        print_ld(m_ostream, "(HL)", get_next_byte());
-        break;
-    case SCF:
-        print_scf(m_ostream);
-        break;
-    case JR_C_e:
-        print_jr(m_ostream, "C", get_next_byte());
-        break;
-    case ADD_HL_SP:
-        print_add(m_ostream, "HL", "SP");
-        break;
-    case LD_A_MHLm:
-        print_ld(m_ostream, "A", get_next_word());
-        break;
-    case DEC_SP:
-        print_dec(m_ostream, "SP");
-        break;
-    case INC_A:
-        print_inc(m_ostream, "A");
-        break;
-    case DEC_A:
-        print_dec(m_ostream, "A");
-        break;
-    case LD_A_n:
-        print_ld(m_ostream, "A", get_next_byte());
-        break;
-    case CCF:
-        print_ccf(m_ostream);
-        break;
-    case LD_B_B:
-        print_ld(m_ostream, "B", "B");
-        break;
-    case LD_B_C:
-        print_ld(m_ostream, "B", "C");
-        break;
-    case LD_B_D:
-        print_ld(m_ostream, "B", "D");
-        break;
-    case LD_B_E:
-        print_ld(m_ostream, "B", "E");
-        break;
-    case LD_B_H:
-        print_ld(m_ostream, "B", "H");
-        break;
-    case LD_B_L:
-        print_ld(m_ostream, "B", "L");
-        break;
-    case LD_B_MHL:
-        print_ld(m_ostream, "B", "(HL)");
-        break;
-    case LD_B_A:
-        print_ld(m_ostream, "B", "A");
-        break;
-    case LD_C_B:
-        print_ld(m_ostream, "C", "B");
-        break;
-    case LD_C_C:
-        print_ld(m_ostream, "C", "C");
-        break;
-    case LD_C_D:
-        print_ld(m_ostream, "C", "D");
-        break;
-    case LD_C_E:
-        print_ld(m_ostream, "C", "E");
-        break;
-    case LD_C_H:
-        print_ld(m_ostream, "C", "H");
-        break;
-    case LD_C_L:
-        print_ld(m_ostream, "C", "L");
-        break;
-    case LD_C_MHL:
-        print_ld(m_ostream, "C", "(HL)");
-        break;
-    case LD_C_A:
-        print_ld(m_ostream, "C", "A");
-        break;
-    case LD_D_B:
-        print_ld(m_ostream, "D", "B");
-        break;
-    case LD_D_C:
-        print_ld(m_ostream, "D", "C");
-        break;
-    case LD_D_D:
-        print_ld(m_ostream, "D", "D");
-        break;
-    case LD_D_E:
-        print_ld(m_ostream, "D", "E");
-        break;
-    case LD_D_H:
-        print_ld(m_ostream, "D", "H");
-        break;
-    case LD_D_L:
-        print_ld(m_ostream, "D", "L");
-        break;
-    case LD_D_MHL:
-        print_ld(m_ostream, "D", "(HL)");
-        break;
-    case LD_D_A:
-        print_ld(m_ostream, "D", "A");
-        break;
-    case LD_E_B:
-        print_ld(m_ostream, "E", "B");
-        break;
-    case LD_E_C:
-        print_ld(m_ostream, "E", "C");
-        break;
-    case LD_E_D:
-        print_ld(m_ostream, "E", "D");
-        break;
-    case LD_E_E:
-        print_ld(m_ostream, "E", "E");
-        break;
-    case LD_E_H:
-        print_ld(m_ostream, "E", "H");
-        break;
-    case LD_E_L:
-        print_ld(m_ostream, "E", "L");
-        break;
-    case LD_E_MHL:
-        print_ld(m_ostream, "E", "(HL)");
-        break;
-    case LD_E_A:
-        print_ld(m_ostream, "E", "A");
-        break;
-    case LD_H_B:
-        print_ld(m_ostream, "H", "B");
-        break;
-    case LD_H_C:
-        print_ld(m_ostream, "H", "C");
-        break;
-    case LD_H_D:
-        print_ld(m_ostream, "H", "D");
-        break;
-    case LD_H_E:
-        print_ld(m_ostream, "H", "E");
-        break;
-    case LD_H_H:
-        print_ld(m_ostream, "H", "H");
-        break;
-    case LD_H_L:
-        print_ld(m_ostream, "H", "L");
-        break;
-    case LD_H_MHL:
-        print_ld(m_ostream, "H", "(HL)");
-        break;
-    case LD_H_A:
-        print_ld(m_ostream, "H", "A");
-        break;
-    case LD_L_B:
-        print_ld(m_ostream, "L", "B");
-        break;
-    case LD_L_C:
-        print_ld(m_ostream, "L", "C");
-        break;
-    case LD_L_D:
-        print_ld(m_ostream, "L", "D");
-        break;
-    case LD_L_E:
-        print_ld(m_ostream, "L", "E");
-        break;
-    case LD_L_H:
-        print_ld(m_ostream, "L", "H");
-        break;
-    case LD_L_L:
-        print_ld(m_ostream, "L", "L");
-        break;
-    case LD_L_MHL:
-        print_ld(m_ostream, "L", "(HL)");
-        break;
-    case LD_L_A:
-        print_ld(m_ostream, "L", "A");
-        break;
-    case LD_MHL_B:
-        print_ld(m_ostream, "(HL)", "B");
-        break;
-    case LD_MHL_C:
-        print_ld(m_ostream, "(HL)", "C");
-        break;
-    case LD_MHL_D:
-        print_ld(m_ostream, "(HL)", "D");
-        break;
-    case LD_MHL_E:
-        print_ld(m_ostream, "(HL)", "E");
-        break;
-    case LD_MHL_H:
-        print_ld(m_ostream, "(HL)", "H");
-        break;
-    case LD_MHL_L:
-        print_ld(m_ostream, "(HL)", "L");
-        break;
-    case HALT:
-        print_halt(m_ostream);
-        break;
-    case LD_MHL_A:
-        print_ld(m_ostream, "(HL)", "A");
-        break;
-    case LD_A_B:
-        print_ld(m_ostream, "A", "B");
-        break;
-    case LD_A_C:
-        print_ld(m_ostream, "A", "C");
-        break;
-    case LD_A_D:
-        print_ld(m_ostream, "A", "D");
-        break;
-    case LD_A_E:
-        print_ld(m_ostream, "A", "E");
-        break;
-    case LD_A_H:
-        print_ld(m_ostream, "A", "H");
-        break;
-    case LD_A_L:
-        print_ld(m_ostream, "A", "L");
-        break;
-    case LD_A_MHL:
-        print_ld(m_ostream, "A", "(HL)");
-        break;
-    case LD_A_A:
-        print_ld(m_ostream, "A", "A");
-        break;
-    case ADD_A_B:
-        print_add(m_ostream, "A", "B");
-        break;
-    case ADD_A_C:
-        print_add(m_ostream, "A", "C");
-        break;
-    case ADD_A_D:
-        print_add(m_ostream, "A", "D");
-        break;
-    case ADD_A_E:
-        print_add(m_ostream, "A", "E");
-        break;
-    case ADD_A_H:
-        print_add(m_ostream, "A", "H");
-        break;
-    case ADD_A_L:
-        print_add(m_ostream, "A", "L");
-        break;
-    case ADD_A_MHL:
-        print_add(m_ostream, "A", "(HL)");
-        break;
-    case ADD_A_A:
-        print_add(m_ostream, "A", "A");
-        break;
-    case ADC_A_B:
-        print_adc_r_s(m_ostream, "A", "B");
-        break;
-    case ADC_A_C:
-        print_adc_r_s(m_ostream, "A", "C");
-        break;
-    case ADC_A_D:
-        print_adc_r_s(m_ostream, "A", "D");
-        break;
-    case ADC_A_E:
-        print_adc_r_s(m_ostream, "A", "E");
-        break;
-    case ADC_A_H:
-        print_adc_r_s(m_ostream, "A", "H");
-        break;
-    case ADC_A_L:
-        print_adc_r_s(m_ostream, "A", "L");
-        break;
-    case ADC_A_MHL:
-        print_adc_r_s(m_ostream, "A", "(HL)");
-        break;
-    case ADC_A_A:
-        print_adc_r_s(m_ostream, "A", "A");
-        break;
-    case SUB_B:
-        print_sub(m_ostream, "B");
-        break;
-    case SUB_C:
-        print_sub(m_ostream, "C");
-        break;
-    case SUB_D:
-        print_sub(m_ostream, "D");
-        break;
-    case SUB_E:
-        print_sub(m_ostream, "E");
-        break;
-    case SUB_H:
-        print_sub(m_ostream, "H");
-        break;
-    case SUB_L:
-        print_sub(m_ostream, "L");
-        break;
-    case SUB_MHL:
-        print_sub(m_ostream, "(HL)");
-        break;
-    case SUB_A:
-        print_sub(m_ostream, "A");
-        break;
-    case SBC_A_B:
-        print_sbc_r_s(m_ostream, "A", "B");
-        break;
-    case SBC_A_C:
-        print_sbc_r_s(m_ostream, "A", "C");
-        break;
-    case SBC_A_D:
-        print_sbc_r_s(m_ostream, "A", "D");
-        break;
-    case SBC_A_E:
-        print_sbc_r_s(m_ostream, "A", "E");
-        break;
-    case SBC_A_H:
-        print_sbc_r_s(m_ostream, "A", "H");
-        break;
-    case SBC_A_L:
-        print_sbc_r_s(m_ostream, "A", "L");
-        break;
-    case SBC_A_MHL:
-        print_sbc_r_s(m_ostream, "A", "(HL)");
-        break;
-    case SBC_A_A:
-        print_sbc_r_s(m_ostream, "A", "A");
-        break;
-    case AND_B:
-        print_and_r(m_ostream, "B");
-        break;
-    case AND_C:
-        print_and_r(m_ostream, "C");
-        break;
-    case AND_D:
-        print_and_r(m_ostream, "D");
-        break;
-    case AND_E:
-        print_and_r(m_ostream, "E");
-        break;
-    case AND_H:
-        print_and_r(m_ostream, "H");
-        break;
-    case AND_L:
-        print_and_r(m_ostream, "L");
-        break;
-    case AND_MHL:
-        print_and_r(m_ostream, "(HL)");
-        break;
-    case AND_A:
-        print_and_r(m_ostream, "A");
-        break;
-    case XOR_B:
-        print_xor_r(m_ostream, "B");
-        break;
-    case XOR_C:
-        print_xor_r(m_ostream, "C");
-        break;
-    case XOR_D:
-        print_xor_r(m_ostream, "D");
-        break;
-    case XOR_E:
-        print_xor_r(m_ostream, "E");
-        break;
-    case XOR_H:
-        print_xor_r(m_ostream, "H");
-        break;
-    case XOR_L:
-        print_xor_r(m_ostream, "L");
-        break;
-    case XOR_MHL:
-        print_xor_r(m_ostream, "(HL)");
-        break;
-    case XOR_A:
-        print_xor_r(m_ostream, "A");
-        break;
-    case OR_B:
-        print_or_r(m_ostream, "B");
-        break;
-    case OR_C:
-        print_or_r(m_ostream, "C");
-        break;
-    case OR_D:
-        print_or_r(m_ostream, "D");
-        break;
-    case OR_E:
-        print_or_r(m_ostream, "E");
-        break;
-    case OR_H:
-        print_or_r(m_ostream, "H");
-        break;
-    case OR_L:
-        print_or_r(m_ostream, "L");
-        break;
-    case OR_MHL:
-        print_or_r(m_ostream, "(HL)");
-        break;
-    case OR_A:
-        print_or_r(m_ostream, "A");
-        break;
-    case CP_B:
-        print_cp(m_ostream, "B");
-        break;
-    case CP_C:
-        print_cp(m_ostream, "C");
-        break;
-    case CP_D:
-        print_cp(m_ostream, "D");
-        break;
-    case CP_E:
-        print_cp(m_ostream, "E");
-        break;
-    case CP_H:
-        print_cp(m_ostream, "H");
-        break;
-    case CP_L:
-        print_cp(m_ostream, "L");
-        break;
-    case CP_MHL:
-        print_cp(m_ostream, "(HL)");
-        break;
-    case CP_A:
-        print_cp(m_ostream, "A");
-        break;
-    case RET_NZ:
-        print_ret(m_ostream, "NZ");
-        break;
-    case POP_BC:
-        print_pop(m_ostream, "BC");
-        break;
-    case JP_NZ:
-        print_jp_cc_nn(m_ostream, get_next_word(), "NZ");
-        break;
-    case JP:
-        print_jp_nn(m_ostream, get_next_word());
-        break;
-    case CALL_NZ:
-        print_call_cc_nn(m_ostream, get_next_word(), "NZ");
-        break;
-    case PUSH_BC:
-        print_push(m_ostream, "BC");
-        break;
-    case ADD_A_n:
-        print_add_r_n(m_ostream, "A", get_next_byte());
-        break;
-    case RST_0:
-        print_rst(m_ostream, 0);
-        break;
-    case RET_Z:
-        print_ret(m_ostream, "Z");
-        break;
-    case RET:
-        print_ret(m_ostream);
-        break;
-    case JP_Z:
-        print_jp_cc_nn(m_ostream, get_next_word(), "Z");
-        break;
-    case BITS:
-        print_next_bits_instruction(get_next_byte().farg);
-        break;
-    case CALL_Z:
-        print_call_cc_nn(m_ostream, get_next_word(), "Z");
-        break;
-    case CALL:
-        print_call_nn(m_ostream, get_next_word());
-        break;
-    case ADC_A_n:
-        print_adc_r_n(m_ostream, "A", get_next_byte());
-        break;
-    case RST_1:
-        print_rst(m_ostream, 1);
-        break;
-    case RET_NC:
-        print_ret(m_ostream, "NZ");
-        break;
-    case POP_DE:
-        print_pop(m_ostream, "DE");
-        break;
-    case JP_NC:
-        print_jp_cc_nn(m_ostream, get_next_word(), "NC");
-        break;
-    case CALL_NC:
-        print_call_cc_nn(m_ostream, get_next_word(), "NC");
-        break;
-    case PUSH_DE:
-        print_push(m_ostream, "DE");
-        break;
-    case SUB_n:
-        print_sub(m_ostream, get_next_byte());
-        break;
-    case RST_2:
-        print_rst(m_ostream, 2);
-        break;
-    case RET_C:
-        print_ret(m_ostream, "C");
-        break;
-    case RETI:
-        print_reti(m_ostream);
-        break;
-    case JP_C:
-        print_jp_cc_nn(m_ostream, get_next_word(), "C");
-        break;
-    case CALL_C:
-        print_call_cc_nn(m_ostream, get_next_word(), "C");
-        break;
-    case SBC_A_n:
-        print_sbc_r_n(m_ostream, "A", get_next_byte());
-        break;
-    case RST_3:
-        print_rst(m_ostream, 3);
-        break;
-    case LDH_Mn_A:
-        print_ldh_Mn_A(m_ostream, get_next_byte());
-        break;
-    case POP_HL:
-        print_pop(m_ostream, "HL");
-        break;
-    case LD_MC_A:
-        print_ld(m_ostream, "(C)", "A");
-        break;
-    case PUSH_HL:
-        print_push(m_ostream, "HL");
-        break;
-    case AND_n:
-        print_and_n(m_ostream, get_next_byte());
-        break;
-    case RST_4:
-        print_rst(m_ostream, 4);
-        break;
-    case ADD_SP_n:
-        print_add_r_n(m_ostream, "SP", get_next_byte());
-        break;
-    case JP_MHL:
-        print_jp_Mss(m_ostream, "HL");
-        break;
-    case LD_Mnn_A:
-        print_ld_Mnn_dd(m_ostream, get_next_word(), "A");
-        break;
-    case XOR_n:
-        print_xor_n(m_ostream, get_next_byte());
-        break;
-    case RST_5:
-        print_rst(m_ostream, 5);
-        break;
-    case LDH_A_Mn:
-        print_ldh_A_Mn(m_ostream, get_next_byte());
-        break;
-    case POP_AF:
-        print_pop(m_ostream, "AF");
-        break;
-    case LD_A_MC:
-        print_ld(m_ostream, "A", "(C)");
-        break;
-    case DI:
-        print_di(m_ostream);
-        break;
-    case PUSH_AF:
-        print_push(m_ostream, "AF");
-        break;
-    case OR_n:
-        print_or_n(m_ostream, get_next_byte());
-        break;
-    case RST_6:
-        print_rst(m_ostream, 6);
-        break;
-    case LD_HL_SPpn:
-        print_ld_HL_sp_p_n(m_ostream, get_next_byte());
-        break;
-    case LD_SP_HL:
-        print_ld(m_ostream, "SP", "HL");
-        break;
-    case LD_A_Mnn:
-        print_ld(m_ostream, "A", get_next_word());
-        break;
-    case EI:
-        print_ei(m_ostream);
-        break;
-    case CP_n:
-        print_cp(m_ostream, get_next_byte());
-        break;
-    case RST_7:
-        print_rst(m_ostream, 7);
-        break;
-    default:
-        m_ostream << "db " << hexify_wo_0x(m_opcode);
-        break;
-    }
-
-    m_ostream << "\n";
-}
-
-void Disassembler::print_next_bits_instruction(u8 bits_opcode)
-{
-    switch (bits_opcode) {
-    case RLC_B:
-        print_rlc(m_ostream, "B");
-        break;
-    case RLC_C:
-        print_rlc(m_ostream, "C");
-        break;
-    case RLC_D:
-        print_rlc(m_ostream, "D");
-        break;
-    case RLC_E:
-        print_rlc(m_ostream, "E");
-        break;
-    case RLC_H:
-        print_rlc(m_ostream, "H");
-        break;
-    case RLC_L:
-        print_rlc(m_ostream, "L");
-        break;
-    case RLC_MHL:
-        print_rlc(m_ostream, "(HL)");
-        break;
-    case RLC_A:
-        print_rlc(m_ostream, "A");
-        break;
-    case RRC_B:
-        print_rrc(m_ostream, "B");
-        break;
-    case RRC_C:
-        print_rrc(m_ostream, "C");
-        break;
-    case RRC_D:
-        print_rrc(m_ostream, "D");
-        break;
-    case RRC_E:
-        print_rrc(m_ostream, "E");
-        break;
-    case RRC_H:
-        print_rrc(m_ostream, "H");
-        break;
-    case RRC_L:
-        print_rrc(m_ostream, "L");
-        break;
-    case RRC_MHL:
-        print_rrc(m_ostream, "(HL)");
-        break;
-    case RRC_A:
-        print_rrc(m_ostream, "A");
-        break;
-    case RL_B:
-        print_rl(m_ostream, "B");
-        break;
-    case RL_C:
-        print_rl(m_ostream, "C");
-        break;
-    case RL_D:
-        print_rl(m_ostream, "D");
-        break;
-    case RL_E:
-        print_rl(m_ostream, "E");
-        break;
-    case RL_H:
-        print_rl(m_ostream, "H");
-        break;
-    case RL_L:
-        print_rl(m_ostream, "L");
-        break;
-    case RL_MHL:
-        print_rl(m_ostream, "(HL)");
-        break;
-    case RL_A:
-        print_rl(m_ostream, "A");
-        break;
-    case RR_B:
-        print_rr(m_ostream, "B");
-        break;
-    case RR_C:
-        print_rr(m_ostream, "C");
-        break;
-    case RR_D:
-        print_rr(m_ostream, "D");
-        break;
-    case RR_E:
-        print_rr(m_ostream, "E");
-        break;
-    case RR_H:
-        print_rr(m_ostream, "H");
-        break;
-    case RR_L:
-        print_rr(m_ostream, "L");
-        break;
-    case RR_MHL:
-        print_rr(m_ostream, "(HL)");
-        break;
-    case RR_A:
-        print_rr(m_ostream, "A");
-        break;
-    case SLA_B:
-        print_sla(m_ostream, "B");
-        break;
-    case SLA_C:
-        print_sla(m_ostream, "C");
-        break;
-    case SLA_D:
-        print_sla(m_ostream, "D");
-        break;
-    case SLA_E:
-        print_sla(m_ostream, "E");
-        break;
-    case SLA_H:
-        print_sla(m_ostream, "H");
-        break;
-    case SLA_L:
-        print_sla(m_ostream, "L");
-        break;
-    case SLA_MHL:
-        print_sla(m_ostream, "(HL)");
-        break;
-    case SLA_A:
-        print_sla(m_ostream, "A");
-        break;
-    case SRA_B:
-        print_sra(m_ostream, "B");
-        break;
-    case SRA_C:
-        print_sra(m_ostream, "C");
-        break;
-    case SRA_D:
-        print_sra(m_ostream, "D");
-        break;
-    case SRA_E:
-        print_sra(m_ostream, "E");
-        break;
-    case SRA_H:
-        print_sra(m_ostream, "H");
-        break;
-    case SRA_L:
-        print_sra(m_ostream, "L");
-        break;
-    case SRA_MHL:
-        print_sra(m_ostream, "(HL)");
-        break;
-    case SRA_A:
-        print_sra(m_ostream, "A");
-        break;
-    case SWAP_B:
-        print_swap(m_ostream, "B");
-        break;
-    case SWAP_C:
-        print_swap(m_ostream, "C");
-        break;
-    case SWAP_D:
-        print_swap(m_ostream, "D");
-        break;
-    case SWAP_E:
-        print_swap(m_ostream, "E");
-        break;
-    case SWAP_H:
-        print_swap(m_ostream, "H");
-        break;
-    case SWAP_L:
-        print_swap(m_ostream, "L");
-        break;
-    case SWAP_MHL:
-        print_swap(m_ostream, "(HL)");
-        break;
-    case SWAP_A:
-        print_swap(m_ostream, "A");
-        break;
-    case SRL_B:
-        print_srl(m_ostream, "B");
-        break;
-    case SRL_C:
-        print_srl(m_ostream, "C");
-        break;
-    case SRL_D:
-        print_srl(m_ostream, "D");
-        break;
-    case SRL_E:
-        print_srl(m_ostream, "E");
-        break;
-    case SRL_H:
-        print_srl(m_ostream, "H");
-        break;
-    case SRL_L:
-        print_srl(m_ostream, "L");
-        break;
-    case SRL_MHL:
-        print_srl(m_ostream, "(HL)");
-        break;
-    case SRL_A:
-        print_srl(m_ostream, "A");
-        break;
-    case BIT_0_B:
-        print_bit(m_ostream, 0, "B");
-        break;
-    case BIT_0_C:
-        print_bit(m_ostream, 0, "C");
-        break;
-    case BIT_0_D:
-        print_bit(m_ostream, 0, "D");
-        break;
-    case BIT_0_E:
-        print_bit(m_ostream, 0, "E");
-        break;
-    case BIT_0_H:
-        print_bit(m_ostream, 0, "H");
-        break;
-    case BIT_0_L:
-        print_bit(m_ostream, 0, "L");
-        break;
-    case BIT_0_MHL:
-        print_bit(m_ostream, 0, "(HL)");
-        break;
-    case BIT_0_A:
-        print_bit(m_ostream, 0, "A");
-        break;
-    case BIT_1_B:
-        print_bit(m_ostream, 1, "B");
-        break;
-    case BIT_1_C:
-        print_bit(m_ostream, 1, "C");
-        break;
-    case BIT_1_D:
-        print_bit(m_ostream, 1, "D");
-        break;
-    case BIT_1_E:
-        print_bit(m_ostream, 1, "E");
-        break;
-    case BIT_1_H:
-        print_bit(m_ostream, 1, "H");
-        break;
-    case BIT_1_L:
-        print_bit(m_ostream, 1, "L");
-        break;
-    case BIT_1_MHL:
-        print_bit(m_ostream, 1, "(HL)");
-        break;
-    case BIT_1_A:
-        print_bit(m_ostream, 1, "A");
-        break;
-    case BIT_2_B:
-        print_bit(m_ostream, 2, "B");
-        break;
-    case BIT_2_C:
-        print_bit(m_ostream, 2, "C");
-        break;
-    case BIT_2_D:
-        print_bit(m_ostream, 2, "D");
-        break;
-    case BIT_2_E:
-        print_bit(m_ostream, 2, "E");
-        break;
-    case BIT_2_H:
-        print_bit(m_ostream, 2, "H");
-        break;
-    case BIT_2_L:
-        print_bit(m_ostream, 2, "L");
-        break;
-    case BIT_2_MHL:
-        print_bit(m_ostream, 2, "(HL)");
-        break;
-    case BIT_2_A:
-        print_bit(m_ostream, 2, "A");
-        break;
-    case BIT_3_B:
-        print_bit(m_ostream, 3, "B");
-        break;
-    case BIT_3_C:
-        print_bit(m_ostream, 3, "C");
-        break;
-    case BIT_3_D:
-        print_bit(m_ostream, 3, "D");
-        break;
-    case BIT_3_E:
-        print_bit(m_ostream, 3, "E");
-        break;
-    case BIT_3_H:
-        print_bit(m_ostream, 3, "H");
-        break;
-    case BIT_3_L:
-        print_bit(m_ostream, 3, "L");
-        break;
-    case BIT_3_MHL:
-        print_bit(m_ostream, 3, "(HL)");
-        break;
-    case BIT_3_A:
-        print_bit(m_ostream, 3, "A");
-        break;
-    case BIT_4_B:
-        print_bit(m_ostream, 4, "B");
-        break;
-    case BIT_4_C:
-        print_bit(m_ostream, 4, "C");
-        break;
-    case BIT_4_D:
-        print_bit(m_ostream, 4, "D");
-        break;
-    case BIT_4_E:
-        print_bit(m_ostream, 4, "E");
-        break;
-    case BIT_4_H:
-        print_bit(m_ostream, 4, "H");
-        break;
-    case BIT_4_L:
-        print_bit(m_ostream, 4, "L");
-        break;
-    case BIT_4_MHL:
-        print_bit(m_ostream, 4, "(HL)");
-        break;
-    case BIT_4_A:
-        print_bit(m_ostream, 4, "A");
-        break;
-    case BIT_5_B:
-        print_bit(m_ostream, 5, "B");
-        break;
-    case BIT_5_C:
-        print_bit(m_ostream, 5, "C");
-        break;
-    case BIT_5_D:
-        print_bit(m_ostream, 5, "D");
-        break;
-    case BIT_5_E:
-        print_bit(m_ostream, 5, "E");
-        break;
-    case BIT_5_H:
-        print_bit(m_ostream, 5, "H");
-        break;
-    case BIT_5_L:
-        print_bit(m_ostream, 5, "L");
-        break;
-    case BIT_5_MHL:
-        print_bit(m_ostream, 5, "(HL)");
-        break;
-    case BIT_5_A:
-        print_bit(m_ostream, 5, "A");
-        break;
-    case BIT_6_B:
-        print_bit(m_ostream, 6, "B");
-        break;
-    case BIT_6_C:
-        print_bit(m_ostream, 6, "C");
-        break;
-    case BIT_6_D:
-        print_bit(m_ostream, 6, "D");
-        break;
-    case BIT_6_E:
-        print_bit(m_ostream, 6, "E");
-        break;
-    case BIT_6_H:
-        print_bit(m_ostream, 6, "H");
-        break;
-    case BIT_6_L:
-        print_bit(m_ostream, 6, "L");
-        break;
-    case BIT_6_MHL:
-        print_bit(m_ostream, 6, "(HL)");
-        break;
-    case BIT_6_A:
-        print_bit(m_ostream, 6, "A");
-        break;
-    case BIT_7_B:
-        print_bit(m_ostream, 7, "B");
-        break;
-    case BIT_7_C:
-        print_bit(m_ostream, 7, "C");
-        break;
-    case BIT_7_D:
-        print_bit(m_ostream, 7, "D");
-        break;
-    case BIT_7_E:
-        print_bit(m_ostream, 7, "E");
-        break;
-    case BIT_7_H:
-        print_bit(m_ostream, 7, "H");
-        break;
-    case BIT_7_L:
-        print_bit(m_ostream, 7, "L");
-        break;
-    case BIT_7_MHL:
-        print_bit(m_ostream, 7, "(HL)");
-        break;
-    case BIT_7_A:
-        print_bit(m_ostream, 7, "A");
-        break;
-    case RES_0_B:
-        print_res(m_ostream, 0, "B");
-        break;
-    case RES_0_C:
-        print_res(m_ostream, 0, "C");
-        break;
-    case RES_0_D:
-        print_res(m_ostream, 0, "D");
-        break;
-    case RES_0_E:
-        print_res(m_ostream, 0, "E");
-        break;
-    case RES_0_H:
-        print_res(m_ostream, 0, "H");
-        break;
-    case RES_0_L:
-        print_res(m_ostream, 0, "L");
-        break;
-    case RES_0_MHL:
-        print_res(m_ostream, 0, "(HL)");
-        break;
-    case RES_0_A:
-        print_res(m_ostream, 0, "A");
-        break;
-    case RES_1_B:
-        print_res(m_ostream, 1, "B");
-        break;
-    case RES_1_C:
-        print_res(m_ostream, 1, "C");
-        break;
-    case RES_1_D:
-        print_res(m_ostream, 1, "D");
-        break;
-    case RES_1_E:
-        print_res(m_ostream, 1, "E");
-        break;
-    case RES_1_H:
-        print_res(m_ostream, 1, "H");
-        break;
-    case RES_1_L:
-        print_res(m_ostream, 1, "L");
-        break;
-    case RES_1_MHL:
-        print_res(m_ostream, 1, "(HL)");
-        break;
-    case RES_1_A:
-        print_res(m_ostream, 1, "A");
-        break;
-    case RES_2_B:
-        print_res(m_ostream, 2, "B");
-        break;
-    case RES_2_C:
-        print_res(m_ostream, 2, "C");
-        break;
-    case RES_2_D:
-        print_res(m_ostream, 2, "D");
-        break;
-    case RES_2_E:
-        print_res(m_ostream, 2, "E");
-        break;
-    case RES_2_H:
-        print_res(m_ostream, 2, "H");
-        break;
-    case RES_2_L:
-        print_res(m_ostream, 2, "L");
-        break;
-    case RES_2_MHL:
-        print_res(m_ostream, 2, "(HL)");
-        break;
-    case RES_2_A:
-        print_res(m_ostream, 2, "A");
-        break;
-    case RES_3_B:
-        print_res(m_ostream, 3, "B");
-        break;
-    case RES_3_C:
-        print_res(m_ostream, 3, "C");
-        break;
-    case RES_3_D:
-        print_res(m_ostream, 3, "D");
-        break;
-    case RES_3_E:
-        print_res(m_ostream, 3, "E");
-        break;
-    case RES_3_H:
-        print_res(m_ostream, 3, "H");
-        break;
-    case RES_3_L:
-        print_res(m_ostream, 3, "L");
-        break;
-    case RES_3_MHL:
-        print_res(m_ostream, 3, "(HL)");
-        break;
-    case RES_3_A:
-        print_res(m_ostream, 3, "A");
-        break;
-    case RES_4_B:
-        print_res(m_ostream, 4, "B");
-        break;
-    case RES_4_C:
-        print_res(m_ostream, 4, "C");
-        break;
-    case RES_4_D:
-        print_res(m_ostream, 4, "D");
-        break;
-    case RES_4_E:
-        print_res(m_ostream, 4, "E");
-        break;
-    case RES_4_H:
-        print_res(m_ostream, 4, "H");
-        break;
-    case RES_4_L:
-        print_res(m_ostream, 4, "L");
-        break;
-    case RES_4_MHL:
-        print_res(m_ostream, 4, "(HL)");
-        break;
-    case RES_4_A:
-        print_res(m_ostream, 4, "A");
-        break;
-    case RES_5_B:
-        print_res(m_ostream, 5, "B");
-        break;
-    case RES_5_C:
-        print_res(m_ostream, 5, "C");
-        break;
-    case RES_5_D:
-        print_res(m_ostream, 5, "D");
-        break;
-    case RES_5_E:
-        print_res(m_ostream, 5, "E");
-        break;
-    case RES_5_H:
-        print_res(m_ostream, 5, "H");
-        break;
-    case RES_5_L:
-        print_res(m_ostream, 5, "L");
-        break;
-    case RES_5_MHL:
-        print_res(m_ostream, 5, "(HL)");
-        break;
-    case RES_5_A:
-        print_res(m_ostream, 5, "A");
-        break;
-    case RES_6_B:
-        print_res(m_ostream, 6, "B");
-        break;
-    case RES_6_C:
-        print_res(m_ostream, 6, "C");
-        break;
-    case RES_6_D:
-        print_res(m_ostream, 6, "D");
-        break;
-    case RES_6_E:
-        print_res(m_ostream, 6, "E");
-        break;
-    case RES_6_H:
-        print_res(m_ostream, 6, "H");
-        break;
-    case RES_6_L:
-        print_res(m_ostream, 6, "L");
-        break;
-    case RES_6_MHL:
-        print_res(m_ostream, 6, "(HL)");
-        break;
-    case RES_6_A:
-        print_res(m_ostream, 6, "A");
-        break;
-    case RES_7_B:
-        print_res(m_ostream, 7, "B");
-        break;
-    case RES_7_C:
-        print_res(m_ostream, 7, "C");
-        break;
-    case RES_7_D:
-        print_res(m_ostream, 7, "D");
-        break;
-    case RES_7_E:
-        print_res(m_ostream, 7, "E");
-        break;
-    case RES_7_H:
-        print_res(m_ostream, 7, "H");
-        break;
-    case RES_7_L:
-        print_res(m_ostream, 7, "L");
-        break;
-    case RES_7_MHL:
-        print_res(m_ostream, 7, "(HL)");
-        break;
-    case RES_7_A:
-        print_res(m_ostream, 7, "A");
-        break;
-    case SET_0_B:
-        print_set(m_ostream, 0, "B");
-        break;
-    case SET_0_C:
-        print_set(m_ostream, 0, "C");
-        break;
-    case SET_0_D:
-        print_set(m_ostream, 0, "D");
-        break;
-    case SET_0_E:
-        print_set(m_ostream, 0, "E");
-        break;
-    case SET_0_H:
-        print_set(m_ostream, 0, "H");
-        break;
-    case SET_0_L:
-        print_set(m_ostream, 0, "L");
-        break;
-    case SET_0_MHL:
-        print_set(m_ostream, 0, "(HL)");
-        break;
-    case SET_0_A:
-        print_set(m_ostream, 0, "A");
-        break;
-    case SET_1_B:
-        print_set(m_ostream, 1, "B");
-        break;
-    case SET_1_C:
-        print_set(m_ostream, 1, "C");
-        break;
-    case SET_1_D:
-        print_set(m_ostream, 1, "D");
-        break;
-    case SET_1_E:
-        print_set(m_ostream, 1, "E");
-        break;
-    case SET_1_H:
-        print_set(m_ostream, 1, "H");
-        break;
-    case SET_1_L:
-        print_set(m_ostream, 1, "L");
-        break;
-    case SET_1_MHL:
-        print_set(m_ostream, 1, "(HL)");
-        break;
-    case SET_1_A:
-        print_set(m_ostream, 1, "A");
-        break;
-    case SET_2_B:
-        print_set(m_ostream, 2, "B");
-        break;
-    case SET_2_C:
-        print_set(m_ostream, 2, "C");
-        break;
-    case SET_2_D:
-        print_set(m_ostream, 2, "D");
-        break;
-    case SET_2_E:
-        print_set(m_ostream, 2, "E");
-        break;
-    case SET_2_H:
-        print_set(m_ostream, 2, "H");
-        break;
-    case SET_2_L:
-        print_set(m_ostream, 2, "L");
-        break;
-    case SET_2_MHL:
-        print_set(m_ostream, 2, "(HL)");
-        break;
-    case SET_2_A:
-        print_set(m_ostream, 2, "A");
-        break;
-    case SET_3_B:
-        print_set(m_ostream, 3, "B");
-        break;
-    case SET_3_C:
-        print_set(m_ostream, 3, "C");
-        break;
-    case SET_3_D:
-        print_set(m_ostream, 3, "D");
-        break;
-    case SET_3_E:
-        print_set(m_ostream, 3, "E");
-        break;
-    case SET_3_H:
-        print_set(m_ostream, 3, "H");
-        break;
-    case SET_3_L:
-        print_set(m_ostream, 3, "L");
-        break;
-    case SET_3_MHL:
-        print_set(m_ostream, 3, "(HL)");
-        break;
-    case SET_3_A:
-        print_set(m_ostream, 3, "A");
-        break;
-    case SET_4_B:
-        print_set(m_ostream, 4, "B");
-        break;
-    case SET_4_C:
-        print_set(m_ostream, 4, "C");
-        break;
-    case SET_4_D:
-        print_set(m_ostream, 4, "D");
-        break;
-    case SET_4_E:
-        print_set(m_ostream, 4, "E");
-        break;
-    case SET_4_H:
-        print_set(m_ostream, 4, "H");
-        break;
-    case SET_4_L:
-        print_set(m_ostream, 4, "L");
-        break;
-    case SET_4_MHL:
-        print_set(m_ostream, 4, "(HL)");
-        break;
-    case SET_4_A:
-        print_set(m_ostream, 4, "A");
-        break;
-    case SET_5_B:
-        print_set(m_ostream, 5, "B");
-        break;
-    case SET_5_C:
-        print_set(m_ostream, 5, "C");
-        break;
-    case SET_5_D:
-        print_set(m_ostream, 5, "D");
-        break;
-    case SET_5_E:
-        print_set(m_ostream, 5, "E");
-        break;
-    case SET_5_H:
-        print_set(m_ostream, 5, "H");
-        break;
-    case SET_5_L:
-        print_set(m_ostream, 5, "L");
-        break;
-    case SET_5_MHL:
-        print_set(m_ostream, 5, "(HL)");
-        break;
-    case SET_5_A:
-        print_set(m_ostream, 5, "A");
-        break;
-    case SET_6_B:
-        print_set(m_ostream, 6, "B");
-        break;
-    case SET_6_C:
-        print_set(m_ostream, 6, "C");
-        break;
-    case SET_6_D:
-        print_set(m_ostream, 6, "D");
-        break;
-    case SET_6_E:
-        print_set(m_ostream, 6, "E");
-        break;
-    case SET_6_H:
-        print_set(m_ostream, 6, "H");
-        break;
-    case SET_6_L:
-        print_set(m_ostream, 6, "L");
-        break;
-    case SET_6_MHL:
-        print_set(m_ostream, 6, "(HL)");
-        break;
-    case SET_6_A:
-        print_set(m_ostream, 6, "A");
-        break;
-    case SET_7_B:
-        print_set(m_ostream, 7, "B");
-        break;
-    case SET_7_C:
-        print_set(m_ostream, 7, "C");
-        break;
-    case SET_7_D:
-        print_set(m_ostream, 7, "D");
-        break;
-    case SET_7_E:
-        print_set(m_ostream, 7, "E");
-        break;
-    case SET_7_H:
-        print_set(m_ostream, 7, "H");
-        break;
-    case SET_7_L:
-        print_set(m_ostream, 7, "L");
-        break;
-    case SET_7_MHL:
-        print_set(m_ostream, 7, "(HL)");
-        break;
-    case SET_7_A:
-        print_set(m_ostream, 7, "A");
-        break;
-    default:
-        m_ostream << "db " << hexify_wo_0x(bits_opcode);
-        break;
-    }
+// The length of each unprefixed instruction in bytes, indexed by opcode
+static constexpr std::array<u8, 256> s_instruction_lengths = {
+    1, 3, 1, 1, 1, 1, 2, 1, 3, 1, 1, 1, 1, 1, 2, 1,
+    1, 3, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1,
+    2, 3, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1,
+    2, 3, 1, 1, 1, 1, 2, 1, 2, 1, 3, 1, 1, 1, 2, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 3, 3, 3, 1, 2, 1, 1, 1, 3, 2, 3, 3, 2, 1,
+    1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 1, 2, 1,
+    2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 3, 1, 1, 1, 2, 1,
+    2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 3, 1, 1, 1, 2, 1
+};
+
+// The mnemonic of each unprefixed instruction, indexed by opcode
+// The operands are placeholders that are filled in from the bytes of the instruction, as
+// described in DecodedInstruction, and nullptr is an opcode that isn't an instruction
+static constexpr std::array<char const*, 256> s_mnemonics = {
+    "NOP", // 00
+    "LD BC,%w1", // 01
+    "LD (BC),A", // 02
+    "INC BC", // 03
+    "INC B", // 04
+    "DEC B", // 05
+    "LD B,%b1", // 06
+    "RLCA", // 07
+    "LD (%w1),SP", // 08
+    "ADD HL, BC", // 09
+    "LD A,(BC)", // 0a
+    "DEC BC", // 0b
+    "INC C", // 0c
+    "DEC C", // 0d
+    "LD C,%b1", // 0e
+    "RRCA", // 0f
+    "STOP 0", // 10
+    "LD DE,%w1", // 11
+    "LD (DE),A", // 12
+    "INC DE", // 13
+    "INC D", // 14
+    "DEC D", // 15
+    "LD D,%b1", // 16
+    "RLA", // 17
+    "JR %s1", // 18
+    "ADD HL, DE", // 19
+    "LD A,(DE)", // 1a
+    "DEC D", // 1b
+    "INC E", // 1c
+    "DEC E", // 1d
+    "LD E,%b1", // 1e
+    "RRA", // 1f
+    "JR NZ, %s1", // 20
+    "LD HL,%w1", // 21
+    "LD (HL+),A", // 22
+    "INC HL", // 23
+    "INC H", // 24
+    "DEC H", // 25
+    "LD H,%b1", // 26
+    "DAA", // 27
+    "JR Z, %s1", // 28
+    "ADD HL, HL", // 29
+    "LD A,(HL+)", // 2a
+    "DEC HL", // 2b
+    "INC L", // 2c
+    "DEC L", // 2d
+    "LD L,%b1", // 2e
+    "CPL", // 2f
+    "JR NC, %s1", // 30
+    "LD SP,%w1", // 31
+    "LD (HL-),A", // 32
+    "INC SP", // 33
+    "INC (HL)", // 34
+    "DEC (HL)", // 35
+    "LD (HL),%b1", // 36
+    "SCF", // 37
+    "JR C, %s1", // 38
+    "ADD HL, SP", // 39
+    "LD A,(%w1)", // 3a
+    "DEC SP", // 3b
+    "INC A", // 3c
+    "DEC A", // 3d
+    "LD A,%b1", // 3e
+    "CCF", // 3f
+    "LD B,B", // 40
+    "LD B,C", // 41
+    "LD B,D", // 42
+    "LD B,E", // 43
+    "LD B,H", // 44
+    "LD B,L", // 45
+    "LD B,(HL)", // 46
+    "LD B,A", // 47
+    "LD C,B", // 48
+    "LD C,C", // 49
+    "LD C,D", // 4a
+    "LD C,E", // 4b
+    "LD C,H", // 4c
+    "LD C,L", // 4d
+    "LD C,(HL)", // 4e
+    "LD C,A", // 4f
+    "LD D,B", // 50
+    "LD D,C", // 51
+    "LD D,D", // 52
+    "LD D,E", // 53
+    "LD D,H", // 54
+    "LD D,L", // 55
+    "LD D,(HL)", // 56
+    "LD D,A", // 57
+    "LD E,B", // 58
+    "LD E,C", // 59
+    "LD E,D", // 5a
+    "LD E,E", // 5b
+    "LD E,H", // 5c
+    "LD E,L", // 5d
+    "LD E,(HL)", // 5e
+    "LD E,A", // 5f
+    "LD H,B", // 60
+    "LD H,C", // 61
+    "LD H,D", // 62
+    "LD H,E", // 63
+    "LD H,H", // 64
+    "LD H,L", // 65
+    "LD H,(HL)", // 66
+    "LD H,A", // 67
+    "LD L,B", // 68
+    "LD L,C", // 69
+    "LD L,D", // 6a
+    "LD L,E", // 6b
+    "LD L,H", // 6c
+    "LD L,L", // 6d
+    "LD L,(HL)", // 6e
+    "LD L,A", // 6f
+    "LD (HL),B", // 70
+    "LD (HL),C", // 71
+    "LD (HL),D", // 72
+    "LD (HL),E", // 73
+    "LD (HL),H", // 74
+    "LD (HL),L", // 75
+    "HALT", // 76
+    "LD (HL),A", // 77
+    "LD A,B", // 78
+    "LD A,C", // 79
+    "LD A,D", // 7a
+    "LD A,E", // 7b
+    "LD A,H", // 7c
+    "LD A,L", // 7d
+    "LD A,(HL)", // 7e
+    "LD A,A", // 7f
+    "ADD A, B", // 80
+    "ADD A, C", // 81
+    "ADD A, D", // 82
+    "ADD A, E", // 83
+    "ADD A, H", // 84
+    "ADD A, L", // 85
+    "ADD A, (HL)", // 86
+    "ADD A, A", // 87
+    "ADC A, B", // 88
+    "ADC A, C", // 89
+    "ADC A, D", // 8a
+    "ADC A, E", // 8b
+    "ADC A, H", // 8c
+    "ADC A, L", // 8d
+    "ADC A, (HL)", // 8e
+    "ADC A, A", // 8f
+    "SUB B", // 90
+    "SUB C", // 91
+    "SUB D", // 92
+    "SUB E", // 93
+    "SUB H", // 94
+    "SUB L", // 95
+    "SUB (HL)", // 96
+    "SUB A", // 97
+    "SBC A, B", // 98
+    "SBC A, C", // 99
+    "SBC A, D", // 9a
+    "SBC A, E", // 9b
+    "SBC A, H", // 9c
+    "SBC A, L", // 9d
+    "SBC A, (HL)", // 9e
+    "SBC A, A", // 9f
+    "AND B", // a0
+    "AND C", // a1
+    "AND D", // a2
+    "AND E", // a3
+    "AND H", // a4
+    "AND L", // a5
+    "AND (HL)", // a6
+    "AND A", // a7
+    "XOR B", // a8
+    "XOR C", // a9
+    "XOR D", // aa
+    "XOR E", // ab
+    "XOR H", // ac
+    "XOR L", // ad
+    "XOR (HL)", // ae
+    "XOR A", // af
+    "OR B", // b0
+    "OR C", // b1
+    "OR D", // b2
+    "OR E", // b3
+    "OR H", // b4
+    "OR L", // b5
+    "OR (HL)", // b6
+    "OR A", // b7
+    "CP B", // b8
+    "CP C", // b9
+    "CP D", // ba
+    "CP E", // bb
+    "CP H", // bc
+    "CP L", // bd
+    "CP (HL)", // be
+    "CP A", // bf
+    "RET NZ", // c0
+    "POP BC", // c1
+    "JP NZ,%w1", // c2
+    "JP %w1", // c3
+    "CALL NZ, %w1", // c4
+    "PUSH BC", // c5
+    "ADD A, %b1", // c6
+    "RST 0", // c7
+    "RET Z", // c8
+    "RET", // c9
+    "JP Z,%w1", // ca
+    nullptr, // cb, the prefix of the bit instructions
+    "CALL Z, %w1", // cc
+    "CALL %w1", // cd
+    "ADC A, %b1", // ce
+    "RST 1", // cf
+    "RET NZ", // d0
+    "POP DE", // d1
+    "JP NC,%w1", // d2
+    nullptr, // d3
+    "CALL NC, %w1", // d4
+    "PUSH DE", // d5
+    "SUB %b1", // d6
+    "RST 2", // d7
+    "RET C", // d8
+    "RETI", // d9
+    "JP C,%w1", // da
+    nullptr, // db
+    "CALL C, %w1", // dc
+    nullptr, // dd
+    "SBC A, %b1", // de
+    "RST 3", // df
+    "LDH (%b1), A", // e0
+    "POP HL", // e1
+    "LD (C),A", // e2
+    nullptr, // e3
+    nullptr, // e4
+    "PUSH HL", // e5
+    "AND %b1", // e6
+    "RST 4", // e7
+    "ADD SP, %b1", // e8
+    "JP (HL)", // e9
+    "LD (%w1),A", // ea
+    nullptr, // eb
+    nullptr, // ec
+    nullptr, // ed
+    "XOR %b1", // ee
+    "RST 5", // ef
+    "LDH A,(%b1)", // f0
+    "POP AF", // f1
+    "LD A,(C)", // f2
+    "DI", // f3
+    nullptr, // f4
+    "PUSH AF", // f5
+    "OR %b1", // f6
+    "RST 6", // f7
+    "LD HL,SP+%b1", // f8
+    "LD SP,HL", // f9
+    "LD A,(%w1)", // fa
+    "EI", // fb
+    nullptr, // fc
+    nullptr, // fd
+    "CP %b1", // fe
+    "RST 7", // ff
+};
+
+// The mnemonic of each bit instruction, after the CB prefix, indexed by opcode
+static constexpr std::array<char const*, 256> s_bits_mnemonics = {
+    "RLC B", // 00
+    "RLC C", // 01
+    "RLC D", // 02
+    "RLC E", // 03
+    "RLC H", // 04
+    "RLC L", // 05
+    "RLC (HL)", // 06
+    "RLC A", // 07
+    "RLC B", // 08
+    "RLC C", // 09
+    "RLC D", // 0a
+    "RLC E", // 0b
+    "RLC H", // 0c
+    "RLC L", // 0d
+    "RLC (HL)", // 0e
+    "RLC A", // 0f
+    "RL B", // 10
+    "RL C", // 11
+    "RL D", // 12
+    "RL E", // 13
+    "RL H", // 14
+    "RL L", // 15
+    "RL (HL)", // 16
+    "RL A", // 17
+    "RR B", // 18
+    "RR C", // 19
+    "RR D", // 1a
+    "RR E", // 1b
+    "RR H", // 1c
+    "RR L", // 1d
+    "RR (HL)", // 1e
+    "RR A", // 1f
+    "SLA B", // 20
+    "SLA C", // 21
+    "SLA D", // 22
+    "SLA E", // 23
+    "SLA H", // 24
+    "SLA L", // 25
+    "SLA (HL)", // 26
+    "SLA A", // 27
+    "SRA B", // 28
+    "SRA C", // 29
+    "SRA D", // 2a
+    "SRA E", // 2b
+    "SRA H", // 2c
+    "SRA L", // 2d
+    "SRA (HL)", // 2e
+    "SRA A", // 2f
+    "SWAP B", // 30
+    "SWAP C", // 31
+    "SWAP D", // 32
+    "SWAP E", // 33
+    "SWAP H", // 34
+    "SWAP L", // 35
+    "SWAP (HL)", // 36
+    "SWAP A", // 37
+    "SRL B", // 38
+    "SRL C", // 39
+    "SRL D", // 3a
+    "SRL E", // 3b
+    "SRL H", // 3c
+    "SRL L", // 3d
+    "SRL (HL)", // 3e
+    "SRL A", // 3f
+    "BIT 0, B", // 40
+    "BIT 0, C", // 41
+    "BIT 0, D", // 42
+    "BIT 0, E", // 43
+    "BIT 0, H", // 44
+    "BIT 0, L", // 45
+    "BIT 0, (HL)", // 46
+    "BIT 0, A", // 47
+    "BIT 1, B", // 48
+    "BIT 1, C", // 49
+    "BIT 1, D", // 4a
+    "BIT 1, E", // 4b
+    "BIT 1, H", // 4c
+    "BIT 1, L", // 4d
+    "BIT 1, (HL)", // 4e
+    "BIT 1, A", // 4f
+    "BIT 2, B", // 50
+    "BIT 2, C", // 51
+    "BIT 2, D", // 52
+    "BIT 2, E", // 53
+    "BIT 2, H", // 54
+    "BIT 2, L", // 55
+    "BIT 2, (HL)", // 56
+    "BIT 2, A", // 57
+    "BIT 3, B", // 58
+    "BIT 3, C", // 59
+    "BIT 3, D", // 5a
+    "BIT 3, E", // 5b
+    "BIT 3, H", // 5c
+    "BIT 3, L", // 5d
+    "BIT 3, (HL)", // 5e
+    "BIT 3, A", // 5f
+    "BIT 4, B", // 60
+    "BIT 4, C", // 61
+    "BIT 4, D", // 62
+    "BIT 4, E", // 63
+    "BIT 4, H", // 64
+    "BIT 4, L", // 65
+    "BIT 4, (HL)", // 66
+    "BIT 4, A", // 67
+    "BIT 5, B", // 68
+    "BIT 5, C", // 69
+    "BIT 5, D", // 6a
+    "BIT 5, E", // 6b
+    "BIT 5, H", // 6c
+    "BIT 5, L", // 6d
+    "BIT 5, (HL)", // 6e
+    "BIT 5, A", // 6f
+    "BIT 6, B", // 70
+    "BIT 6, C", // 71
+    "BIT 6, D", // 72
+    "BIT 6, E", // 73
+    "BIT 6, H", // 74
+    "BIT 6, L", // 75
+    "BIT 6, (HL)", // 76
+    "BIT 6, A", // 77
+    "BIT 7, B", // 78
+    "BIT 7, C", // 79
+    "BIT 7, D", // 7a
+    "BIT 7, E", // 7b
+    "BIT 7, H", // 7c
+    "BIT 7, L", // 7d
+    "BIT 7, (HL)", // 7e
+    "BIT 7, A", // 7f
+    "RES 0, B", // 80
+    "RES 0, C", // 81
+    "RES 0, D", // 82
+    "RES 0, E", // 83
+    "RES 0, H", // 84
+    "RES 0, L", // 85
+    "RES 0, (HL)", // 86
+    "RES 0, A", // 87
+    "RES 1, B", // 88
+    "RES 1, C", // 89
+    "RES 1, D", // 8a
+    "RES 1, E", // 8b
+    "RES 1, H", // 8c
+    "RES 1, L", // 8d
+    "RES 1, (HL)", // 8e
+    "RES 1, A", // 8f
+    "RES 2, B", // 90
+    "RES 2, C", // 91
+    "RES 2, D", // 92
+    "RES 2, E", // 93
+    "RES 2, H", // 94
+    "RES 2, L", // 95
+    "RES 2, (HL)", // 96
+    "RES 2, A", // 97
+    "RES 3, B", // 98
+    "RES 3, C", // 99
+    "RES 3, D", // 9a
+    "RES 3, E", // 9b
+    "RES 3, H", // 9c
+    "RES 3, L", // 9d
+    "RES 3, (HL)", // 9e
+    "RES 3, A", // 9f
+    "RES 4, B", // a0
+    "RES 4, C", // a1
+    "RES 4, D", // a2
+    "RES 4, E", // a3
+    "RES 4, H", // a4
+    "RES 4, L", // a5
+    "RES 4, (HL)", // a6
+    "RES 4, A", // a7
+    "RES 5, B", // a8
+    "RES 5, C", // a9
+    "RES 5, D", // aa
+    "RES 5, E", // ab
+    "RES 5, H", // ac
+    "RES 5, L", // ad
+    "RES 5, (HL)", // ae
+    "RES 5, A", // af
+    "RES 6, B", // b0
+    "RES 6, C", // b1
+    "RES 6, D", // b2
+    "RES 6, E", // b3
+    "RES 6, H", // b4
+    "RES 6, L", // b5
+    "RES 6, (HL)", // b6
+    "RES 6, A", // b7
+    "RES 7, B", // b8
+    "RES 7, C", // b9
+    "RES 7, D", // ba
+    "RES 7, E", // bb
+    "RES 7, H", // bc
+    "RES 7, L", // bd
+    "RES 7, (HL)", // be
+    "RES 7, A", // bf
+    "SET 0, B", // c0
+    "SET 0, C", // c1
+    "SET 0, D", // c2
+    "SET 0, E", // c3
+    "SET 0, H", // c4
+    "SET 0, L", // c5
+    "SET 0, (HL)", // c6
+    "SET 0, A", // c7
+    "SET 1, B", // c8
+    "SET 1, C", // c9
+    "SET 1, D", // ca
+    "SET 1, E", // cb
+    "SET 1, H", // cc
+    "SET 1, L", // cd
+    "SET 1, (HL)", // ce
+    "SET 1, A", // cf
+    "SET 2, B", // d0
+    "SET 2, C", // d1
+    "SET 2, D", // d2
+    "SET 2, E", // d3
+    "SET 2, H", // d4
+    "SET 2, L", // d5
+    "SET 2, (HL)", // d6
+    "SET 2, A", // d7
+    "SET 3, B", // d8
+    "SET 3, C", // d9
+    "SET 3, D", // da
+    "SET 3, E", // db
+    "SET 3, H", // dc
+    "SET 3, L", // dd
+    "SET 3, (HL)", // de
+    "SET 3, A", // df
+    "SET 4, B", // e0
+    "SET 4, C", // e1
+    "SET 4, D", // e2
+    "SET 4, E", // e3
+    "SET 4, H", // e4
+    "SET 4, L", // e5
+    "SET 4, (HL)", // e6
+    "SET 4, A", // e7
+    "SET 5, B", // e8
+    "SET 5, C", // e9
+    "SET 5, D", // ea
+    "SET 5, E", // eb
+    "SET 5, H", // ec
+    "SET 5, L", // ed
+    "SET 5, (HL)", // ee
+    "SET 5, A", // ef
+    "SET 6, B", // f0
+    "SET 6, C", // f1
+    "SET 6, D", // f2
+    "SET 6, E", // f3
+    "SET 6, H", // f4
+    "SET 6, L", // f5
+    "SET 6, (HL)", // f6
+    "SET 6, A", // f7
+    "SET 7, B", // f8
+    "SET 7, C", // f9
+    "SET 7, D", // fa
+    "SET 7, E", // fb
+    "SET 7, H", // fc
+    "SET 7, L", // fd
+    "SET 7, (HL)", // fe
+    "SET 7, A", // ff
+};
+
+/**
+ * @return true if the address is in the cartridge header, which is disassembled as data
+ */
+static bool is_in_cartridge_header(u16 address)
+{
+    return 0x0104 <= address && address <= 0x014f;
 }
 
-void Disassembler::print_cartridge_header()
+/**
+ * @return the description of a byte in the cartridge header, which is put after the byte in the listing
+ */
+static char const* describe_cartridge_header(u16 address, u8 value)
 {
-    if (0x0104 <= m_pc && m_pc <= 0x0133 + 1) { // Nintendo logo
-        m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Nintendo logo)\n";
-    } else if (0x0134 <= m_pc && m_pc <= 0x0142 + 1) { // Title
-        m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Title)\n";
-    } else if (0x0143 + 1 == m_pc) { // Color / not color
-        m_ostream << "db " << hexify_wo_0x(m_opcode) << (m_opcode == 0x80 ? " (color GB)\n" : " (not color GB)\n");
-    } else if (0x0144 <= m_pc && m_pc <= 0x0145 + 1) { // New licensee code
-        m_ostream << "db " << hexify_wo_0x(m_opcode) << " (New licensee code)\n";
-    } else if (0x0146 + 1 == m_pc) { // GB / SGB indicator
-        m_ostream << "db " << hexify_wo_0x(m_opcode) << (m_opcode == 0x03 ? " (SGB)\n" : " (GB)\n");
-    } else if (0x0147 + 1 == m_pc) { // Cartridge type
-        switch (m_opcode) {
+    if (0x0104 <= address && address <= 0x0133) { // Nintendo logo
+        return " (Nintendo logo)";
+    } else if (0x0134 <= address && address <= 0x0142) { // Title
+        return " (Title)";
+    } else if (address == 0x0143) { // Color / not color
+        return value == 0x80 ? " (color GB)" : " (not color GB)";
+    } else if (0x0144 <= address && address <= 0x0145) { // New licensee code
+        return " (New licensee code)";
+    } else if (address == 0x0146) { // GB / SGB indicator
+        return value == 0x03 ? " (SGB)" : " (GB)";
+    } else if (address == 0x0147) { // Cartridge type
+        switch (value) {
         case 0x00:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: ROM ONLY)\n";
-            break;
+            return " (Cartridge type: ROM ONLY)";
         case 0x01:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MBC1)\n";
-            break;
+            return " (Cartridge type: MBC1)";
         case 0x02:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MBC1+RAM)\n";
-            break;
+            return " (Cartridge type: MBC1+RAM)";
         case 0x03:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MBC1+RAM+BATTERY)\n";
-            break;
+            return " (Cartridge type: MBC1+RAM+BATTERY)";
         case 0x05:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MBC2)\n";
-            break;
+            return " (Cartridge type: MBC2)";
         case 0x06:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MBC2+BATTERY)\n";
-            break;
+            return " (Cartridge type: MBC2+BATTERY)";
         case 0x08:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: ROM+RAM)\n";
-            break;
+            return " (Cartridge type: ROM+RAM)";
         case 0x09:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: ROM+RAM+BATTER)\n";
-            break;
+            return " (Cartridge type: ROM+RAM+BATTER)";
         case 0x0b:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MMM01)\n";
-            break;
+            return " (Cartridge type: MMM01)";
         case 0x0c:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MMM01+RAM)\n";
-            break;
+            return " (Cartridge type: MMM01+RAM)";
         case 0x0d:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MMM01+RAM+BATTERY)\n";
-            break;
+            return " (Cartridge type: MMM01+RAM+BATTERY)";
         case 0x0f:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MBC3+TIMER+BATTERY)\n";
-            break;
+            return " (Cartridge type: MBC3+TIMER+BATTERY)";
         case 0x10:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MBC3+TIMER+RAM+BATTERY)\n";
-            break;
+            return " (Cartridge type: MBC3+TIMER+RAM+BATTERY)";
         case 0x11:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MBC3)\n";
-            break;
+            return " (Cartridge type: MBC3)";
         case 0x12:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MBC3+RAM)\n";
-            break;
+            return " (Cartridge type: MBC3+RAM)";
         case 0x13:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MBC3+RAM+BATTERY)\n";
-            break;
+            return " (Cartridge type: MBC3+RAM+BATTERY)";
         case 0x19:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MBC5)\n";
-            break;
+            return " (Cartridge type: MBC5)";
         case 0x1a:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MBC5+RAM)\n";
-            break;
+            return " (Cartridge type: MBC5+RAM)";
         case 0x1b:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MBC5+RAM+BATTERY)\n";
-            break;
+            return " (Cartridge type: MBC5+RAM+BATTERY)";
         case 0x1c:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MBC5+RUMBLE)\n";
-            break;
+            return " (Cartridge type: MBC5+RUMBLE)";
         case 0x1d:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MBC5+RUMBLE+RAM)\n";
-            break;
+            return " (Cartridge type: MBC5+RUMBLE+RAM)";
         case 0x1e:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MBC5+RUMBLE+RAM+BATTERY)\n";
-            break;
+            return " (Cartridge type: MBC5+RUMBLE+RAM+BATTERY)";
         case 0x20:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MBC6)\n";
-            break;
+            return " (Cartridge type: MBC6)";
         case 0x22:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: MBC7+SENSOR+RUMBLE+RAM+BATTERY)\n";
-            break;
+            return " (Cartridge type: MBC7+SENSOR+RUMBLE+RAM+BATTERY)";
         case 0xfc:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: POCKET CAMERA)\n";
-            break;
+            return " (Cartridge type: POCKET CAMERA)";
         case 0xfd:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: BANDAI TAMA5)\n";
-            break;
+            return " (Cartridge type: BANDAI TAMA5)";
         case 0xfe:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: HuC3)\n";
-            break;
+            return " (Cartridge type: HuC3)";
         case 0xff:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: HuC1+RAM+BATTERY)\n";
-            break;
+            return " (Cartridge type: HuC1+RAM+BATTERY)";
         default:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Cartridge type: Unknown)\n";
-            break;
+            return " (Cartridge type: Unknown)";
         }
-    } else if (0x0148 + 1 == m_pc) { // ROM size
-        switch (m_opcode) {
+    } else if (address == 0x0148) { // ROM size
+        switch (value) {
         case 0x00:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (ROM size: 32KByte (no ROM banking))\n";
-            break;
+            return " (ROM size: 32KByte (no ROM banking))";
         case 0x01:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (ROM size: 64KByte (4 banks))\n";
-            break;
+            return " (ROM size: 64KByte (4 banks))";
         case 0x02:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (ROM size: 128KByte (8 banks))\n";
-            break;
+            return " (ROM size: 128KByte (8 banks))";
         case 0x03:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (ROM size: 256KByte (16 banks))\n";
-            break;
+            return " (ROM size: 256KByte (16 banks))";
         case 0x04:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (ROM size: 512KByte (32 banks))\n";
-            break;
+            return " (ROM size: 512KByte (32 banks))";
         case 0x05:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (ROM size: 1MByte (64 banks)  - only 63 banks used by MBC1)\n";
-            break;
+            return " (ROM size: 1MByte (64 banks)  - only 63 banks used by MBC1)";
         case 0x06:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (ROM size: 2MByte (128 banks) - only 125 banks used by MBC1)\n";
-            break;
+            return " (ROM size: 2MByte (128 banks) - only 125 banks used by MBC1)";
         case 0x07:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (ROM size: 4MByte (256 banks))\n";
-            break;
+            return " (ROM size: 4MByte (256 banks))";
         case 0x08:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (ROM size: 8MByte (512 banks))\n";
-            break;
+            return " (ROM size: 8MByte (512 banks))";
         case 0x52:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (ROM size: 1.1MByte (72 banks))\n";
-            break;
+            return " (ROM size: 1.1MByte (72 banks))";
         case 0x53:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (ROM size: 1.2MByte (80 banks))\n";
-            break;
+            return " (ROM size: 1.2MByte (80 banks))";
         case 0x54:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (ROM size: 1.5MByte (96 banks))\n";
-            break;
+            return " (ROM size: 1.5MByte (96 banks))";
         default:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (ROM size: Unknown)\n";
-            break;
+            return " (ROM size: Unknown)";
         }
-    } else if (0x0149 + 1 == m_pc) { // RAM size
-        switch (m_opcode) {
+    } else if (address == 0x0149) { // RAM size
+        switch (value) {
         case 0x00:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (RAM size: None)\n";
-            break;
+            return " (RAM size: None)";
         case 0x01:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (RAM size: 2 KBytes)\n";
-            break;
+            return " (RAM size: 2 KBytes)";
         case 0x02:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (RAM size: 8 KBytes)\n";
-            break;
+            return " (RAM size: 8 KBytes)";
         case 0x03:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (RAM size: 32 KBytes (4 banks of 8KBytes each))\n";
-            break;
+            return " (RAM size: 32 KBytes (4 banks of 8KBytes each))";
         case 0x04:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (RAM size: 128 KBytes (16 banks of 8KBytes each))\n";
-            break;
+            return " (RAM size: 128 KBytes (16 banks of 8KBytes each))";
         case 0x05:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (RAM size: 64 KBytes (8 banks of 8KBytes each))\n";
-            break;
+            return " (RAM size: 64 KBytes (8 banks of 8KBytes each))";
         default:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (RAM size: Unknown)\n";
-            break;
+            return " (RAM size: Unknown)";
         }
-    } else if (0x014a + 1 == m_pc) { // Destination code
-        switch (m_opcode) {
+    } else if (address == 0x014a) { // Destination code
+        switch (value) {
         case 0x00:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Destination code: Japanese)\n";
-            break;
+            return " (Destination code: Japanese)";
         case 0x01:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Destination code: Non-Japanese)\n";
-            break;
+            return " (Destination code: Non-Japanese)";
         default:
-            m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Destination code: Unknown)\n";
-            break;
+            return " (Destination code: Unknown)";
+        }
+    } else if (address == 0x014b) { // Old licensee code
+        return " (Old licensee code)";
+    } else if (address == 0x014c) { // Mask ROM version number
+        return " (Mask ROM version number)";
+    } else if (address == 0x014d) { // Header checksum
+        return " (Header checksum)";
+    } else if (0x014e <= address && address <= 0x014f) { // Global checksum
+        return " (Global checksum)";
+    } else {
+        return " (Description not implemented yet)";
+    }
+}
+
+Disassembler::Disassembler(EmulatorMemory<u16, u8> const& memory, std::ostream& ostream)
+    : m_memory(memory)
+    , m_memory_size(memory.size())
+    , m_ostream(ostream)
+{
+}
+
+void Disassembler::disassemble()
+{
+    std::string line;
+    for (std::size_t address = 0; address < m_memory_size;) {
+        const DecodedInstruction<u16, u8> instruction = decode(m_memory, static_cast<u16>(address));
+        format_instruction(instruction, line);
+        if (is_in_cartridge_header(instruction.m_address)) {
+            line.append(describe_cartridge_header(instruction.m_address, instruction.m_bytes[0]));
         }
-    } else if (0x014b + 1 == m_pc) { // Old licensee code
-        m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Old licensee code)\n";
-    } else if (0x014c + 1 == m_pc) { // Mask ROM version number
-        m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Mask ROM version number)\n";
-    } else if (0x014d + 1 == m_pc) { // Header checksum
-        m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Header checksum)\n";
-    } else if (0x014e <= m_pc && m_pc <= 0x014f + 1) { // Global checksum
-        m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Global checksum)\n";
+        line.push_back('\n');
+        m_ostream << line;
+
+        // An opcode that isn't an instruction is listed as a data byte, so the next line is the next byte
+        address += instruction.m_mnemonic == nullptr ? 1 : instruction.m_length;
+    }
+}
+
+DecodedInstruction<u16, u8> Disassembler::decode(EmulatorMemory<u16, u8> const& memory, u16 address)
+{
+    DecodedInstruction<u16, u8> instruction { .m_address = address, .m_length = 0, .m_bytes = {} };
+
+    const u8 opcode = memory.read(address);
+    if (is_in_cartridge_header(address)) {
+        instruction.m_length = 1;
+    } else if (opcode == BITS) {
+        instruction.m_length = 2;
+        instruction.m_mnemonic = s_bits_mnemonics[memory.read(static_cast<u16>(address + 1))];
     } else {
-        m_ostream << "db " << hexify_wo_0x(m_opcode) << " (Description not implemented yet)\n";
+        instruction.m_length = s_instruction_lengths[opcode];
+        instruction.m_mnemonic = s_mnemonics[opcode];
+    }
+
+    for (std::size_t i = 0; i < instruction.m_length; ++i) {
+        instruction.m_bytes[i] = memory.read(static_cast<u16>(address + i));
+    }
+
+    decode_control_flow(instruction);
+
+    return instruction;
+}
+
+void Disassembler::decode_control_flow(DecodedInstruction<u16, u8>& instruction)
+{
+    const u8 opcode = instruction.m_bytes[0];
+    const u16 word = to_u16(instruction.m_bytes[2], instruction.m_bytes[1]);
+    const u16 relative = static_cast<u16>(instruction.m_address + 2 + static_cast<i8>(instruction.m_bytes[1]));
+
+    switch (opcode) {
+    case JP:
+        instruction.m_control_flow = ControlFlow::Jump;
+        instruction.m_target = word;
+        break;
+    case JR_e:
+        instruction.m_control_flow = ControlFlow::Jump;
+        instruction.m_target = relative;
+        break;
+    case JP_NZ:
+    case JP_Z:
+    case JP_NC:
+    case JP_C:
+        instruction.m_control_flow = ControlFlow::ConditionalJump;
+        instruction.m_target = word;
+        break;
+    case JR_NZ_e:
+    case JR_Z_e:
+    case JR_NC_e:
+    case JR_C_e:
+        instruction.m_control_flow = ControlFlow::ConditionalJump;
+        instruction.m_target = relative;
+        break;
+    case CALL:
+    case CALL_NZ:
+    case CALL_Z:
+    case CALL_NC:
+    case CALL_C:
+        instruction.m_control_flow = ControlFlow::Call;
+        instruction.m_target = word;
+        break;
+    case RST_0:
+    case RST_1:
+    case RST_2:
+    case RST_3:
+    case RST_4:
+    case RST_5:
+    case RST_6:
+    case RST_7:
+        instruction.m_control_flow = ControlFlow::Call;
+        instruction.m_target = opcode & 0x38;
+        break;
+    case RET_NZ:
+    case RET_Z:
+    case RET_NC:
+    case RET_C:
+        instruction.m_control_flow = ControlFlow::ConditionalReturn;
+        break;
+    case RET:
+    case RETI:
+        instruction.m_control_flow = ControlFlow::Return;
+        break;
+    case JP_MHL:
+        instruction.m_control_flow = ControlFlow::IndirectJump;
+        break;
+    default:
+        break;
     }
 }
 
-NextByte Disassembler::get_next_byte()
+TEST_CASE("LR35902: Disassembler")
 {
-    return {
-        .farg = m_memory.read(m_pc++)
-    };
+    SUBCASE("should only refer to the bytes of the instruction in the mnemonics")
+    {
+        for (auto const& prefix : std::vector<std::vector<u8>> { {}, { BITS } }) {
+            for (unsigned int opcode = 0; opcode <= 0xff; ++opcode) {
+                std::vector<u8> program = prefix;
+                program.push_back(opcode);
+                program.resize(8, 0);
+                EmulatorMemory<u16, u8> memory;
+                memory.add(program);
+
+                DecodedInstruction<u16, u8> instruction = Disassembler::decode(memory, 0);
+                std::string line;
+                format_instruction(instruction, line);
+
+                std::fill(instruction.m_bytes.begin() + static_cast<std::ptrdiff_t>(instruction.m_length), instruction.m_bytes.end(), 0xff);
+                std::string line_with_other_bytes_after;
+                format_instruction(instruction, line_with_other_bytes_after);
+
+                CHECK_EQ(line, line_with_other_bytes_after);
+            }
+        }
+    }
+
+    SUBCASE("should list one line per instruction")
+    {
+        EmulatorMemory<u16, u8> memory;
+        memory.add({ LD_BC_nn, 0x34, 0x12, 0xd3, NOP });
+        std::stringstream ss;
+
+        Disassembler(memory, ss).disassemble();
+
+        CHECK_EQ("0000\t\tLD BC,1234\n0003\t\tdb d3\n0004\t\tNOP\n", ss.str());
+    }
+
+    SUBCASE("should describe the bytes in the cartridge header")
+    {
+        std::vector<u8> rom(0x0148, NOP);
+        rom[0x0147] = 0x01;
+        EmulatorMemory<u16, u8> memory;
+        memory.add(rom);
+        std::stringstream ss;
+
+        Disassembler(memory, ss).disassemble();
+
+        const std::string listing = ss.str();
+        CHECK_NE(std::string::npos, listing.find("0103\t\tNOP\n0104\t\tdb 00 (Nintendo logo)\n"));
+        CHECK_NE(std::string::npos, listing.find("0147\t\tdb 01 (Cartridge type: MBC1)\n"));
+    }
+
+    SUBCASE("should fill in the operands when the instruction is formatted")
+    {
+        EmulatorMemory<u16, u8> memory;
+        memory.add({ LD_BC_nn, 0x34, 0x12, JR_NZ_e, 0xfc });
+        std::string line;
+
+        format_instruction(Disassembler::decode(memory, 0), line);
+        CHECK_EQ("0000\t\tLD BC,1234", line);
+        format_instruction(Disassembler::decode(memory, 3), line);
+        CHECK_EQ("0003\t\tJR NZ, -04", line);
+    }
+
+    SUBCASE("should decode where the execution continues after jumps, calls and returns")
+    {
+        EmulatorMemory<u16, u8> memory;
+        memory.add({ JR_NZ_e, 0xfc, RETI, JP, 0x50, 0x01, RST_2, RET_C, JP_MHL });
+
+        CHECK_EQ(ControlFlow::ConditionalJump, Disassembler::decode(memory, 0).m_control_flow);
+        CHECK_EQ(0xfffe, Disassembler::decode(memory, 0).m_target);
+        CHECK_EQ(ControlFlow::Return, Disassembler::decode(memory, 2).m_control_flow);
+        CHECK_EQ(ControlFlow::Jump, Disassembler::decode(memory, 3).m_control_flow);
+        CHECK_EQ(0x0150, Disassembler::decode(memory, 3).m_target);
+        CHECK_EQ(ControlFlow::Call, Disassembler::decode(memory, 6).m_control_flow);
+        CHECK_EQ(0x0010, Disassembler::decode(memory, 6).m_target);
+        CHECK_EQ(ControlFlow::ConditionalReturn, Disassembler::decode(memory, 7).m_control_flow);
+        CHECK_EQ(ControlFlow::IndirectJump, Disassembler::decode(memory, 8).m_control_flow);
+    }
 }
 
-NextWord Disassembler::get_next_word()
+/**
+ * The ROM is filled with pseudo-random bytes, so that every kind of instruction is disassembled.
+ * The last bytes are zero, so that no instruction is cut off by the end of the ROM.
+ */
+BENCHMARK("LR35902: Disassembler, 16 KB ROM")
 {
-    return {
-        .farg = m_memory.read(m_pc++),
-        .sarg = m_memory.read(m_pc++)
-    };
+    std::vector<u8> rom = pseudo_random_bytes(16 * 1024);
+    std::fill(rom.end() - 4, rom.end(), 0);
+
+    EmulatorMemory<u16, u8> memory;
+    memory.add(rom);
+
+    bench.run([&]() {
+        std::stringstream ss;
+        Disassembler disassembler(memory, ss);
+        disassembler.disassemble();
+        do_not_optimize(ss);
+    });
 }
 }
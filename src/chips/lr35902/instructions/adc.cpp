@@ -2,12 +2,9 @@
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::lr35902 {
 
@@ -15,7 +12,6 @@ using emu::memory::NextByte;
 using emu::util::byte::high_byte;
 using emu::util::byte::low_byte;
 using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 void adc(u8& acc_reg, u8 value, Flags& flag_reg)
 {
@@ -119,22 +115,6 @@ void adc_hl_ss(u8& h_reg, u8& l_reg, u16 value, Flags& flag_reg, cyc& cycles)
 
 /******************************** END OF FUNCTIONS FOR UNDOCUMENTED INSTRUCTIONS **********************************/
 
-void print_adc_r_s(std::ostream& ostream, std::string const& dest, std::string const& src)
-{
-    ostream << "ADC "
-            << dest
-            << ", "
-            << src;
-}
-
-void print_adc_r_n(std::ostream& ostream, std::string const& reg, NextByte const& args)
-{
-    ostream << "ADC "
-            << reg
-            << ", "
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("LR35902: ADC (8-bit)")
 {
     u8 acc_reg = 0;
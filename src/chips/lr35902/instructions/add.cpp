@@ -2,12 +2,9 @@
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::lr35902 {
 
@@ -15,7 +12,6 @@ using emu::memory::NextByte;
 using emu::util::byte::high_byte;
 using emu::util::byte::low_byte;
 using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 void add(u8& acc_reg, u8 value, Flags& flag_reg)
 {
@@ -148,22 +144,6 @@ void add_SP_n(u16& sp, NextByte value, Flags& flag_reg, cyc& cycles)
     cycles = 16;
 }
 
-void print_add(std::ostream& ostream, std::string const& dest, std::string const& src)
-{
-    ostream << "ADD "
-            << dest
-            << ", "
-            << src;
-}
-
-void print_add_r_n(std::ostream& ostream, std::string const& reg, NextByte const& args)
-{
-    ostream << "ADD "
-            << reg
-            << ", "
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("LR35902: ADD")
 {
     u8 acc_reg = 0;
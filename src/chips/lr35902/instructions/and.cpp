@@ -1,11 +1,8 @@
 #include "chips/lr35902/flags.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::memory {
 template<class A, class D>
@@ -16,7 +13,6 @@ namespace emu::lr35902 {
 
 using emu::memory::EmulatorMemory;
 using emu::memory::NextByte;
-using emu::util::string::hexify_wo_0x;
 
 void and_(u8& acc_reg, u8 value, Flags& flag_reg)
 {
@@ -93,18 +89,6 @@ void and_MHL(u8& acc_reg, u8 value, Flags& flag_reg, cyc& cycles)
 
 /******************************** END OF FUNCTIONS FOR UNDOCUMENTED INSTRUCTIONS **********************************/
 
-void print_and_r(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "AND "
-            << reg;
-}
-
-void print_and_n(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "AND "
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("LR35902: AND")
 {
     u8 acc_reg = 0;
@@ -5,14 +5,11 @@
 #include "doctest.h"
 #include <cassert>
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::lr35902 {
 
 using emu::memory::EmulatorMemory;
 using emu::util::byte::is_bit_set;
-using emu::util::byte::set_bit;
 
 void bit(unsigned int bit_number, u8 reg, Flags& flag_reg)
 {
@@ -77,16 +74,6 @@ void bit_MHL(unsigned int bit_number, u16 hl_reg, EmulatorMemory<u16, u8> const&
     cycles = 12;
 }
 
-void print_bit(std::ostream& ostream, unsigned int bit_number, std::string const& src)
-{
-    assert(bit_number < 8);
-
-    ostream << "BIT "
-            << bit_number
-            << ", "
-            << src;
-}
-
 TEST_CASE("LR35902: BIT r")
 {
     cyc cycles = 0;
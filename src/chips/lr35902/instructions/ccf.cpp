@@ -2,12 +2,9 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::lr35902 {
 
-using emu::util::byte::is_bit_set;
-
 /**
  * Complement carry flag
  * <ul>
@@ -35,11 +32,6 @@ void ccf(Flags& flag_reg, cyc& cycles)
     cycles = 4;
 }
 
-void print_ccf(std::ostream& ostream)
-{
-    ostream << "CCF";
-}
-
 TEST_CASE("LR35902: CCF")
 {
     cyc cycles = 0;
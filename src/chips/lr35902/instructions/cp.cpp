@@ -2,18 +2,13 @@
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::lr35902 {
 
 using emu::memory::NextByte;
-using emu::util::byte::is_bit_set;
-using emu::util::string::hexify_wo_0x;
 
 void cp(u8& acc_reg, u8 value, Flags& flag_reg)
 {
@@ -85,18 +80,6 @@ void cp_MHL(u8& acc_reg, u8 value, Flags& flag_reg, cyc& cycles)
     cycles = 7;
 }
 
-void print_cp(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "CP "
-            << reg;
-}
-
-void print_cp(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "CP "
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("LR35902: CP")
 {
     u8 acc_reg = 0;
@@ -3,12 +3,9 @@
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
 #include <cstdint>
-#include <iostream>
 
 namespace emu::lr35902 {
 
-using emu::util::byte::is_bit_set;
-
 /**
  * Complement accumulator
  * <ul>
@@ -32,11 +29,6 @@ void cpl(u8& acc_reg, Flags& flag_reg, cyc& cycles)
     cycles = 4;
 }
 
-void print_cpl(std::ostream& ostream)
-{
-    ostream << "CPL";
-}
-
 TEST_CASE("LR35902: CPL")
 {
     SUBCASE("should complement the accumulator and always set half carry and add/subtract flags")
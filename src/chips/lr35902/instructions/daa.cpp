@@ -3,12 +3,9 @@
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
-#include <iostream>
 
 namespace emu::lr35902 {
 
-using emu::util::byte::is_bit_set;
-
 /**
  * Decimal adjust accumulator
  * <ul>
@@ -62,11 +59,6 @@ void daa(u8& acc_reg, Flags& flag_reg, cyc& cycles)
     cycles = 4;
 }
 
-void print_daa(std::ostream& ostream)
-{
-    ostream << "DAA";
-}
-
 TEST_CASE("LR35902: DAA")
 {
     cyc cycles = 0;
@@ -1,4 +1,5 @@
 #include "chips/lr35902/flags.h"
+#include "chips/lr35902/register_file.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
@@ -6,16 +7,10 @@
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::lr35902 {
 
-using emu::memory::NextByte;
 using emu::util::byte::borrow_from;
-using emu::util::byte::high_byte;
-using emu::util::byte::low_byte;
-using emu::util::byte::to_u16;
 
 void dec_u8(u8& reg, Flags& flag_reg)
 {
@@ -81,17 +76,13 @@ void dec_MHL(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc&
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param reg1 is the first register in the register pair, which will be mutated
- * @param reg2 is the second register in the register pair, which will be mutated
+ * @param registers is the register file, which will be mutated
+ * @param ss is the register pair to decrement
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void dec_ss(u8& reg1, u8& reg2, cyc& cycles)
+void dec_ss(RegisterFile& registers, RegisterPair ss, cyc& cycles)
 {
-    u16 val = to_u16(reg1, reg2);
-    --val;
-
-    reg2 = low_byte(val);
-    reg1 = high_byte(val);
+    registers.set_pair(ss, registers.pair(ss) - 1);
 
     cycles = 6;
 }
@@ -115,12 +106,6 @@ void dec_sp(u16& sp, cyc& cycles)
     cycles = 6;
 }
 
-void print_dec(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "DEC "
-            << reg;
-}
-
 TEST_CASE("LR35902: DEC (8-bit)")
 {
     SUBCASE("should decrease value by 1")
@@ -156,14 +141,31 @@ TEST_CASE("LR35902: DEC r")
 
 TEST_CASE("LR35902: DEC ss")
 {
+    SUBCASE("should decrease register pair")
+    {
+        cyc cycles = 0;
+        RegisterFile registers;
+        registers.set_pair(RegisterPair::DE, 0x1200);
+
+        dec_ss(registers, RegisterPair::DE, cycles);
+
+        CHECK_EQ(0x11, registers.d());
+        CHECK_EQ(0xff, registers.e());
+        CHECK_EQ(0, registers.bc());
+        CHECK_EQ(0, registers.hl());
+
+        dec_ss(registers, RegisterPair::BC, cycles);
+
+        CHECK_EQ(UINT16_MAX, registers.bc());
+    }
+
     SUBCASE("should use 6 cycles")
     {
         cyc cycles = 0;
-        u8 reg1 = UINT8_MAX;
-        u8 reg2 = UINT8_MAX;
+        RegisterFile registers;
         u16 sp = UINT8_MAX;
 
-        dec_ss(reg1, reg2, cycles);
+        dec_ss(registers, RegisterPair::BC, cycles);
 
         CHECK_EQ(6, cycles);
 
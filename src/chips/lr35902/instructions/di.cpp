@@ -1,6 +1,5 @@
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::lr35902 {
 
@@ -23,11 +22,6 @@ void di(bool& ime, cyc& cycles)
     cycles = 4;
 }
 
-void print_di(std::ostream& ostream)
-{
-    ostream << "DI";
-}
-
 TEST_CASE("LR35902: DI")
 {
     cyc cycles = 0;
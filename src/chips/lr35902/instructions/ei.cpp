@@ -1,6 +1,5 @@
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::lr35902 {
 
@@ -23,11 +22,6 @@ void ei(bool& ime, cyc& cycles)
     cycles = 4;
 }
 
-void print_ei(std::ostream& ostream)
-{
-    ostream << "EI";
-}
-
 TEST_CASE("LR35902: EI")
 {
     cyc cycles = 0;
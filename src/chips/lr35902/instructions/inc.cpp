@@ -1,21 +1,14 @@
 #include "chips/lr35902/flags.h"
+#include "chips/lr35902/register_file.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
-#include "crosscutting/util/byte_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::lr35902 {
 
-using emu::memory::NextByte;
-using emu::util::byte::high_byte;
-using emu::util::byte::low_byte;
-using emu::util::byte::to_u16;
-
 void inc(u8& reg, Flags& flag_reg)
 {
     bool const old_carry = flag_reg.is_carry_flag_set();
@@ -101,17 +94,13 @@ void inc_MHL(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc&
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param reg1 is the first register in the register pair, which will be mutated
- * @param reg2 is the second register in the register pair, which will be mutated
+ * @param registers is the register file, which will be mutated
+ * @param ss is the register pair to increment
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void inc_ss(u8& reg1, u8& reg2, cyc& cycles)
+void inc_ss(RegisterFile& registers, RegisterPair ss, cyc& cycles)
 {
-    u16 val = to_u16(reg1, reg2);
-    ++val;
-
-    reg2 = low_byte(val);
-    reg1 = high_byte(val);
+    registers.set_pair(ss, registers.pair(ss) + 1);
 
     cycles = 6;
 }
@@ -135,19 +124,6 @@ void inc_sp(u16& sp, cyc& cycles)
     cycles = 6;
 }
 
-void print_inc(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "INC "
-            << reg;
-}
-
-void print_inc_undocumented(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "INC "
-            << reg
-            << "*";
-}
-
 TEST_CASE("LR35902: INC")
 {
     SUBCASE("should increase register or memory")
@@ -260,8 +236,7 @@ TEST_CASE("LR35902: INC r")
 TEST_CASE("LR35902: INC ss")
 {
     cyc cycles = 0;
-    u8 reg1 = 0;
-    u8 reg2 = 0;
+    RegisterFile registers;
     u8 expected_reg1 = 0;
     u8 expected_reg2;
     u16 sp = 0;
@@ -269,19 +244,30 @@ TEST_CASE("LR35902: INC ss")
     SUBCASE("should increase register pair")
     {
         for (int i = 0; i < UINT16_MAX; ++i) {
-            inc_ss(reg1, reg2, cycles);
+            inc_ss(registers, RegisterPair::BC, cycles);
 
-            if (reg2 % (UINT8_MAX + 1) == 0 && i != 0) {
+            if (registers.c() % (UINT8_MAX + 1) == 0 && i != 0) {
                 ++expected_reg1;
             }
 
             expected_reg2 = i + 1;
 
-            CHECK_EQ(expected_reg1, reg1);
-            CHECK_EQ(expected_reg2, reg2);
+            CHECK_EQ(expected_reg1, registers.b());
+            CHECK_EQ(expected_reg2, registers.c());
         }
     }
 
+    SUBCASE("should only increase the given register pair")
+    {
+        registers.set_pair(RegisterPair::HL, UINT16_MAX);
+
+        inc_ss(registers, RegisterPair::HL, cycles);
+
+        CHECK_EQ(0, registers.hl());
+        CHECK_EQ(0, registers.bc());
+        CHECK_EQ(0, registers.de());
+    }
+
     SUBCASE("should increase SP")
     {
         for (u16 expected_sp = 0; expected_sp < UINT16_MAX; ++expected_sp) {
@@ -297,7 +283,7 @@ TEST_CASE("LR35902: INC ss")
     {
         cycles = 0;
 
-        inc_ss(reg1, reg2, cycles);
+        inc_ss(registers, RegisterPair::DE, cycles);
 
         CHECK_EQ(6, cycles);
 
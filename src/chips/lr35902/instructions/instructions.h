@@ -1,11 +1,11 @@
 #pragma once
 
 #include "chips/lr35902/flags.h"
+#include "chips/lr35902/register_file.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/memory/next_word.h"
 #include "crosscutting/typedefs.h"
-#include <string>
 #include <vector>
 
 // @formatter:off
@@ -547,14 +547,14 @@ void cp_MHL(u8& acc_reg, u8 value, Flags& flag_reg, cyc& cycles);
 void cpl(u8& acc_reg, Flags& flag_reg, cyc& cycles);
 void daa(u8& acc_reg, Flags& flag_reg, cyc& cycles);
 void dec_r(u8& reg, Flags& flag_reg, cyc& cycles);
-void dec_ss(u8& reg1, u8& reg2, cyc& cycles);
+void dec_ss(RegisterFile& registers, RegisterPair ss, cyc& cycles);
 void dec_sp(u16& sp, cyc& cycles);
 void dec_MHL(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc& cycles);
 void di(bool& ime, cyc& cycles);
 void ei(bool& ime, cyc& cycles);
 void halt(bool& is_halted, cyc& cycles);
 void inc_r(u8& reg, Flags& flag_reg, cyc& cycles);
-void inc_ss(u8& reg1, u8& reg2, cyc& cycles);
+void inc_ss(RegisterFile& registers, RegisterPair ss, cyc& cycles);
 void inc_MHL(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc& cycles);
 void inc_sp(u16& sp, cyc& cycles);
 void jp(u16& pc, NextWord const& args, cyc& cycles);
@@ -576,7 +576,7 @@ void ld_A_Mnn(u8& reg, EmulatorMemory<u16, u8> const& memory, NextWord const& ar
 void ld_A_MC(u8& acc_reg, u8 c_reg, EmulatorMemory<u16, u8> const& memory, cyc& cycles);
 void ld_HL_Mnn(u8& h_reg, u8& l_reg, EmulatorMemory<u16, u8> const& memory, NextWord const& args, cyc& cycles);
 void ld_HL_SP_p_n(u8& h_reg, u8& l_reg, u16 sp, NextByte const& args, Flags& flag_reg, cyc& cycles);
-void ld_dd_nn(u8& reg1, u8& reg2, NextWord const& args, cyc& cycles);
+void ld_dd_nn(RegisterFile& registers, RegisterPair dd, NextWord const& args, cyc& cycles);
 void ld_MHL_n(EmulatorMemory<u16, u8>& memory, u16 address, NextByte const& args, cyc& cycles);
 void ld_MHL_r(EmulatorMemory<u16, u8>& memory, u16 address, u8 value, cyc& cycles);
 void ld_Mnn_A(u8 acc_reg, EmulatorMemory<u16, u8>& memory, NextWord const& args, cyc& cycles);
@@ -598,9 +598,9 @@ void nop(cyc& cycles);
 void or_r(u8& acc_reg, u8 value, Flags& flag_reg, cyc& cycles);
 void or_n(u8& acc_reg, NextByte const& args, Flags& flag_reg, cyc& cycles);
 void or_MHL(u8& acc_reg, u8 value, Flags& flag_reg, cyc& cycles);
-void pop(u8& reg1, u8& reg2, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles);
+void pop(RegisterFile& registers, RegisterPair qq, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles);
 void pop_af(Flags& flag_reg, u8& acc_reg, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles);
-void push_qq(u8 reg1, u8 reg2, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles);
+void push_qq(RegisterFile const& registers, RegisterPair qq, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles);
 void push_af(Flags const& flag_reg, u8 acc_reg, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles);
 void res_r(unsigned int bit_number, u8& reg, cyc& cycles);
 void res_MHL(unsigned int bit_number, u16 hl_reg, EmulatorMemory<u16, u8>& memory, cyc& cycles);
@@ -652,70 +652,5 @@ void swap_MHL(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc
 void xor_n(u8& acc_reg, NextByte const& args, Flags& flag_reg, cyc& cycles);
 void xor_r(u8& acc_reg, u8 value, Flags& flag_reg, cyc& cycles);
 void xor_MHL(u8& acc_reg, u8 value, Flags& flag_reg, cyc& cycles);
-
-void print_adc_r_s(std::ostream& ostream, std::string const& dest, std::string const& src);
-void print_adc_r_n(std::ostream& ostream, std::string const& reg, NextByte const& args);
-void print_add(std::ostream& ostream, std::string const& dest, std::string const& src);
-void print_add_r_n(std::ostream& ostream, std::string const& reg, NextByte const& args);
-void print_and_r(std::ostream& ostream, std::string const& reg);
-void print_and_n(std::ostream& ostream, NextByte const& args);
-void print_bit(std::ostream& ostream, unsigned int bit_number, std::string const& src);
-void print_call_nn(std::ostream& ostream, NextWord const& args);
-void print_call_cc_nn(std::ostream& ostream, NextWord const& args, std::string const& condition);
-void print_ccf(std::ostream& ostream);
-void print_cp(std::ostream& ostream, std::string const& reg);
-void print_cp(std::ostream& ostream, NextByte const& args);
-void print_cpl(std::ostream& ostream);
-void print_daa(std::ostream& ostream);
-void print_di(std::ostream& ostream);
-void print_dec(std::ostream& ostream, std::string const& reg);
-void print_ei(std::ostream& ostream);
-void print_halt(std::ostream& ostream);
-void print_inc(std::ostream& ostream, std::string const& reg);
-void print_jp_nn(std::ostream& ostream, NextWord const& args);
-void print_jp_cc_nn(std::ostream& ostream, NextWord const& args, std::string const& condition);
-void print_jp_Mss(std::ostream& ostream, std::string const& reg);
-void print_jr(std::ostream& ostream, NextByte const& args);
-void print_jr(std::ostream& ostream, std::string const& condition, NextByte const& args);
-void print_ld(std::ostream& ostream, std::string const& dest, std::string const& src);
-void print_ld(std::ostream& ostream, std::string const& dest, NextByte const& args);
-void print_ld(std::ostream& ostream, std::string const& dest, NextWord const& args);
-void print_ld(std::ostream& ostream, NextWord const& args, std::string const& src);
-void print_ld_dd_nn(std::ostream& ostream, std::string const& reg, NextWord const& args);
-void print_ld_Mnn_dd(std::ostream& ostream, NextWord const& args, std::string const& src);
-void print_ld_HL_sp_p_n(std::ostream& ostream, NextByte const& args);
-void print_ldh_A_Mn(std::ostream& ostream, NextByte const& args);
-void print_ldh_Mn_A(std::ostream& ostream, NextByte const& args);
-void print_nop(std::ostream& ostream);
-void print_or_r(std::ostream& ostream, std::string const& reg);
-void print_or_n(std::ostream& ostream, NextByte const& args);
-void print_pop(std::ostream& ostream, std::string const& reg);
-void print_push(std::ostream& ostream, std::string const& reg);
-void print_res(std::ostream& ostream, unsigned int bit_number, std::string const& src);
-void print_ret(std::ostream& ostream);
-void print_ret(std::ostream& ostream, std::string const& condition);
-void print_reti(std::ostream& ostream);
-void print_rla(std::ostream& ostream);
-void print_rl(std::ostream& ostream, std::string const& reg);
-void print_rlc(std::ostream& ostream, std::string const& reg);
-void print_rlca(std::ostream& ostream);
-void print_rst(std::ostream& ostream, int number);
-void print_rr(std::ostream& ostream, std::string const& reg);
-void print_rra(std::ostream& ostream);
-void print_rrc(std::ostream& ostream, std::string const& reg);
-void print_rrca(std::ostream& ostream);
-void print_sbc_r_s(std::ostream& ostream, std::string const& dest, std::string const& src);
-void print_sbc_r_n(std::ostream& ostream, std::string const& reg, NextByte const& args);
-void print_scf(std::ostream& ostream);
-void print_set(std::ostream& ostream, unsigned int bit_number, std::string const& src);
-void print_sla(std::ostream& ostream, std::string const& reg);
-void print_sra(std::ostream& ostream, std::string const& reg);
-void print_srl(std::ostream& ostream, std::string const& reg);
-void print_stop(std::ostream& ostream);
-void print_sub(std::ostream& ostream, std::string const& reg);
-void print_sub(std::ostream& ostream, NextByte const& args);
-void print_swap(std::ostream& ostream, std::string const& reg);
-void print_xor_r(std::ostream& ostream, std::string const& reg);
-void print_xor_n(std::ostream& ostream, NextByte const& args);
 }
 // @formatter:on
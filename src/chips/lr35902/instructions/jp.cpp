@@ -2,16 +2,12 @@
 #include "crosscutting/memory/next_word.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 
 namespace emu::lr35902 {
 
 using emu::memory::NextWord;
 using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Jump
@@ -145,30 +141,6 @@ void jp_hl(u16& pc, u16 address, cyc& cycles)
     cycles = 4;
 }
 
-void print_jp_nn(std::ostream& ostream, NextWord const& args)
-{
-    ostream << "JP "
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg);
-}
-
-void print_jp_cc_nn(std::ostream& ostream, NextWord const& args, std::string const& condition)
-{
-    ostream << "JP "
-            << condition
-            << ","
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg);
-}
-
-void print_jp_Mss(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "JP "
-            << "("
-            << reg
-            << ")";
-}
-
 TEST_CASE("LR35902: JP")
 {
     cyc cycles = 0;
@@ -1,14 +1,12 @@
 #include "chips/lr35902/flags.h"
+#include "chips/lr35902/register_file.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/memory/next_word.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
-#include <iostream>
-#include <string>
 #include <vector>
 
 namespace emu::lr35902 {
@@ -19,7 +17,6 @@ using emu::memory::NextWord;
 using emu::util::byte::high_byte;
 using emu::util::byte::low_byte;
 using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 void ld(u8& to, u8 value)
 {
@@ -300,15 +297,14 @@ void ld_HL_SP_p_n(u8& h_reg, u8& l_reg, u16 sp, NextByte const& args, Flags& fla
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param reg1 is the first register to load into, which will be mutated
- * @param reg2 is the second register to load into, which will be mutated
+ * @param registers is the register file, which will be mutated
+ * @param dd is the register pair to load into
  * @param args contains value to load into the registers
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void ld_dd_nn(u8& reg1, u8& reg2, NextWord const& args, cyc& cycles)
+void ld_dd_nn(RegisterFile& registers, RegisterPair dd, NextWord const& args, cyc& cycles)
 {
-    reg1 = args.sarg;
-    reg2 = args.farg;
+    registers.set_pair(dd, to_u16(args.sarg, args.farg));
 
     cycles = 10;
 }
@@ -608,63 +604,6 @@ void ld_A_MHLm(u8& acc_reg, EmulatorMemory<u16, u8> const& memory, u8& h_reg, u8
     cycles = 8;
 }
 
-void print_ld(std::ostream& ostream, std::string const& dest, std::string const& src)
-{
-    ostream << "LD "
-            << dest
-            << ","
-            << src;
-}
-
-void print_ld(std::ostream& ostream, std::string const& dest, NextByte const& args)
-{
-    ostream << "LD "
-            << dest
-            << ","
-            << hexify_wo_0x(args.farg);
-}
-
-void print_ld(std::ostream& ostream, std::string const& dest, NextWord const& args)
-{
-    ostream << "LD "
-            << dest
-            << ",("
-            << hexify_wo_0x(to_u16(args.sarg, args.farg))
-            << ")";
-}
-
-void print_ld(std::ostream& ostream, NextWord const& args, std::string const& src)
-{
-    ostream << "LD ("
-            << hexify_wo_0x(to_u16(args.sarg, args.farg))
-            << "),"
-            << src;
-}
-
-void print_ld_dd_nn(std::ostream& ostream, std::string const& dest, NextWord const& args)
-{
-    ostream << "LD "
-            << dest
-            << ","
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg);
-}
-
-void print_ld_Mnn_dd(std::ostream& ostream, NextWord const& args, std::string const& src)
-{
-    ostream << "LD ("
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg)
-            << "),"
-            << src;
-}
-
-void print_ld_HL_sp_p_n(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "LD HL,SP+"
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("LR35902: LD")
 {
     SUBCASE("should load register/memory with value from register/memory")
@@ -795,16 +734,17 @@ TEST_CASE("LR35902: LD dd, nn")
 {
     cyc cycles = 0;
     u16 sp = 0xe;
-    u8 reg1 = 0xe;
-    u8 reg2 = 0;
+    RegisterFile registers;
     NextWord args = { .farg = 0x12, .sarg = 0x3a };
 
     SUBCASE("should load immediate into register pair")
     {
-        ld_dd_nn(reg1, reg2, args, cycles);
+        ld_dd_nn(registers, RegisterPair::DE, args, cycles);
 
-        CHECK_EQ(args.sarg, reg1);
-        CHECK_EQ(args.farg, reg2);
+        CHECK_EQ(args.sarg, registers.d());
+        CHECK_EQ(args.farg, registers.e());
+        CHECK_EQ(0, registers.bc());
+        CHECK_EQ(0, registers.hl());
     }
 
     SUBCASE("should load immediate into SP")
@@ -818,7 +758,7 @@ TEST_CASE("LR35902: LD dd, nn")
     {
         cycles = 0;
 
-        ld_dd_nn(reg1, reg2, args, cycles);
+        ld_dd_nn(registers, RegisterPair::BC, args, cycles);
 
         CHECK_EQ(10, cycles);
     }
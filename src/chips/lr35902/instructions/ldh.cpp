@@ -2,17 +2,13 @@
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 
 namespace emu::lr35902 {
 
 using emu::memory::EmulatorMemory;
 using emu::memory::NextByte;
 using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Load from high page into the accumulator
@@ -55,19 +51,4 @@ void ldh_Mn_A(EmulatorMemory<u16, u8>& memory, NextByte const& args, u8 acc_reg,
 
     cycles = 12;
 }
-
-void print_ldh_A_Mn(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "LDH A"
-            << ",("
-            << hexify_wo_0x(args.farg)
-            << ")";
-}
-
-void print_ldh_Mn_A(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "LDH ("
-            << hexify_wo_0x(args.farg)
-            << "), A";
-}
 }
@@ -1,6 +1,5 @@
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::lr35902 {
 
@@ -19,11 +18,6 @@ void nop(cyc& cycles)
     cycles = 4;
 }
 
-void print_nop(std::ostream& ostream)
-{
-    ostream << "NOP";
-}
-
 TEST_CASE("LR35902: NOP")
 {
     cyc cycles = 0;
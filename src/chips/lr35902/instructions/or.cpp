@@ -1,11 +1,8 @@
 #include "chips/lr35902/flags.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::memory {
 template<class A, class D>
@@ -16,7 +13,6 @@ namespace emu::lr35902 {
 
 using emu::memory::EmulatorMemory;
 using emu::memory::NextByte;
-using emu::util::string::hexify_wo_0x;
 
 void or_(u8& acc_reg, u8 value, Flags& flag_reg)
 {
@@ -91,18 +87,6 @@ void or_MHL(u8& acc_reg, u8 value, Flags& flag_reg, cyc& cycles)
     cycles = 7;
 }
 
-void print_or_r(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "OR "
-            << reg;
-}
-
-void print_or_n(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "OR "
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("LR35902: OR")
 {
     u8 acc_reg = 0;
@@ -4,8 +4,6 @@
 #include "doctest.h"
 #include "flags.h"
 #include "instruction_util.h"
-#include <iostream>
-#include <string>
 #include <vector>
 
 namespace emu::lr35902 {
@@ -145,17 +143,6 @@ void ret_nz(u16& pc, u16& sp, EmulatorMemory<u16, u8> const& memory, Flags const
     cycles += 8;
 }
 
-void print_ret(std::ostream& ostream)
-{
-    ostream << "RET";
-}
-
-void print_ret(std::ostream& ostream, std::string const& condition)
-{
-    ostream << "RET "
-            << condition;
-}
-
 TEST_CASE("LR35902: RET")
 {
     cyc cycles = 0;
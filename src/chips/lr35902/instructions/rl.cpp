@@ -6,12 +6,9 @@
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::lr35902 {
 
-using emu::memory::NextByte;
 using emu::util::byte::is_bit_set;
 using emu::util::byte::set_bit;
 
@@ -102,17 +99,6 @@ void rl_MHL(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc&
     cycles = 16;
 }
 
-void print_rla(std::ostream& ostream)
-{
-    ostream << "RLA";
-}
-
-void print_rl(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "RL "
-            << reg;
-}
-
 TEST_CASE("LR35902: RLA")
 {
     cyc cycles = 0;
@@ -6,12 +6,9 @@
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::lr35902 {
 
-using emu::memory::NextByte;
 using emu::util::byte::is_bit_set;
 using emu::util::byte::set_bit;
 
@@ -100,17 +97,6 @@ void rlc_MHL(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc&
     cycles = 16;
 }
 
-void print_rlca(std::ostream& ostream)
-{
-    ostream << "RLCA";
-}
-
-void print_rlc(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "RLC "
-            << reg;
-}
-
 TEST_CASE("LR35902: RLCA")
 {
     cyc cycles = 0;
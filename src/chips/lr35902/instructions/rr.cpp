@@ -5,8 +5,6 @@
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::lr35902 {
 
@@ -98,17 +96,6 @@ void rr_MHL(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc&
     cycles = 16;
 }
 
-void print_rra(std::ostream& ostream)
-{
-    ostream << "RRA";
-}
-
-void print_rr(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "RR "
-            << reg;
-}
-
 TEST_CASE("LR35902: RRA")
 {
     cyc cycles = 0;
@@ -2,12 +2,9 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::lr35902 {
 
-using emu::util::byte::is_bit_set;
-
 /**
  * Set carry flag
  * <ul>
@@ -30,11 +27,6 @@ void scf(Flags& flag_reg, cyc& cycles)
     cycles = 4;
 }
 
-void print_scf(std::ostream& ostream)
-{
-    ostream << "SCF";
-}
-
 TEST_CASE("LR35902: SCF")
 {
     cyc cycles = 0;
@@ -5,8 +5,6 @@
 #include "doctest.h"
 #include <cassert>
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::memory {
 template<class A, class D>
@@ -15,7 +13,6 @@ class EmulatorMemory;
 
 namespace emu::lr35902 {
 
-using emu::memory::NextByte;
 using emu::util::byte::set_bit;
 
 /**
@@ -63,16 +60,6 @@ void set_MHL(unsigned int bit_number, u16 hl_reg, EmulatorMemory<u16, u8>& memor
     cycles = 16;
 }
 
-void print_set(std::ostream& ostream, unsigned int bit_number, std::string const& src)
-{
-    assert(bit_number < 8);
-
-    ostream << "SET "
-            << bit_number
-            << ", "
-            << src;
-}
-
 TEST_CASE("LR35902: SET r")
 {
     cyc cycles = 0;
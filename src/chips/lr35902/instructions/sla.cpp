@@ -5,12 +5,9 @@
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
-#include <iostream>
-#include <string>
 
 namespace emu::lr35902 {
 
-using emu::memory::NextByte;
 using emu::util::byte::is_bit_set;
 
 void sla(u8& value, Flags& flag_reg)
@@ -71,10 +68,4 @@ void sla_MHL(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc&
 
     cycles = 16;
 }
-
-void print_sla(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "SLA "
-            << reg;
-}
 }
@@ -5,12 +5,9 @@
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
-#include <iostream>
-#include <string>
 
 namespace emu::lr35902 {
 
-using emu::memory::NextByte;
 using emu::util::byte::is_bit_set;
 using emu::util::byte::set_bit;
 
@@ -76,10 +73,4 @@ void sra_MHL(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc&
 
     cycles = 16;
 }
-
-void print_sra(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "SRA "
-            << reg;
-}
 }
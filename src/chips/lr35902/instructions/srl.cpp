@@ -5,14 +5,10 @@
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
-#include <iostream>
-#include <string>
 
 namespace emu::lr35902 {
 
-using emu::memory::NextByte;
 using emu::util::byte::is_bit_set;
-using emu::util::byte::set_bit;
 
 void srl(u8& value, Flags& flag_reg)
 {
@@ -73,10 +69,4 @@ void srl_MHL(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc&
 
     cycles = 16;
 }
-
-void print_srl(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "SRL "
-            << reg;
-}
 }
@@ -2,13 +2,9 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::lr35902 {
 
-using emu::memory::NextByte;
-using emu::util::byte::is_bit_set;
-
 /**
  * Stop processor and screen until button press
  * <ul>
@@ -26,9 +22,4 @@ void stop_0(cyc& cycles)
 {
     cycles = 4;
 }
-
-void print_stop(std::ostream& ostream)
-{
-    ostream << "STOP 0";
-}
 }
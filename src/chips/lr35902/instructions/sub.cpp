@@ -1,17 +1,13 @@
 #include "chips/lr35902/flags.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::lr35902 {
 
 using emu::memory::NextByte;
-using emu::util::string::hexify_wo_0x;
 
 void sub(u8& acc_reg, u8 value, Flags& flag_reg)
 {
@@ -81,18 +77,6 @@ void sub_MHL(u8& acc_reg, u8 value, Flags& flag_reg, cyc& cycles)
     cycles = 7;
 }
 
-void print_sub(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "SUB "
-            << reg;
-}
-
-void print_sub(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "SUB "
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("LR35902: SUB")
 {
     u8 acc_reg = 0;
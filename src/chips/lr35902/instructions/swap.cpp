@@ -3,8 +3,6 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 
 namespace emu::lr35902 {
 class Flags;
@@ -13,7 +11,6 @@ class Flags;
 namespace emu::lr35902 {
 
 using emu::memory::EmulatorMemory;
-using emu::memory::NextByte;
 using emu::util::byte::high_nibble;
 using emu::util::byte::low_nibble;
 
@@ -67,10 +64,4 @@ void swap_MHL(EmulatorMemory<u16, u8>& memory, u16 address, [[maybe_unused]] Fla
 
     cycles = 16;
 }
-
-void print_swap(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "SWAP "
-            << reg;
-}
 }
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "crosscutting/misc/register_file.h"
+#include "flags.h"
+#include <type_traits>
+
+namespace emu::lr35902 {
+
+/**
+ * The register pairs that can be used as one 16-bit operand, in the order they are encoded in the
+ * opcodes.
+ */
+enum class RegisterPair {
+    BC = 0,
+    DE = 1,
+    HL = 2
+};
+
+/**
+ * The general purpose registers of the LR35902.
+ */
+using RegisterFile = emu::misc::RegisterFile<Flags, RegisterPair>;
+
+static_assert(std::is_trivially_copyable_v<RegisterFile>, "The registers have to be copyable as one block of memory");
+}
@@ -1,11 +1,15 @@
 #include "wsg3.h"
+#include "crosscutting/benchmarking/benchmark.h"
 #include "voice.h"
+#include <cstddef>
 #include <fmt/core.h>
 #include <stdexcept>
 #include <utility>
 
 namespace emu::wsg3 {
 
+using emu::benchmarking::do_not_optimize;
+
 Wsg3::Wsg3(std::vector<Waveform> waveforms)
     : m_waveforms(std::move(waveforms))
 {
@@ -49,4 +53,28 @@ std::vector<i16> Wsg3::next_tick(std::vector<Voice>& voices)
 
     return buffer;
 }
+
+BENCHMARK("WSG3: next_tick")
+{
+    std::vector<Waveform> waveforms;
+    for (u8 waveform = 0; waveform < 16; ++waveform) {
+        std::vector<u8> samples;
+        for (u8 sample = 0; sample < 32; ++sample) {
+            samples.push_back(static_cast<u8>((sample + waveform) % 16));
+        }
+        waveforms.emplace_back(samples);
+    }
+    Wsg3 wsg3(waveforms);
+
+    std::vector<Voice> voices(3);
+    for (std::size_t i = 0; i < voices.size(); ++i) {
+        voices[i].waveform_number(static_cast<u8>(i));
+        voices[i].frequency(static_cast<u32>(0x1000 * (i + 1)));
+        voices[i].volume(15);
+    }
+
+    bench.run([&]() {
+        do_not_optimize(wsg3.next_tick(voices));
+    });
+}
 }
@@ -1,31 +1,147 @@
 #include "cpu.h"
 #include "chips/trivial/synacor/usings.h"
+#include "chips/trivial/synacor/words.h"
+#include "crosscutting/benchmarking/benchmark.h"
 #include "crosscutting/exceptions/unrecognized_opcode_exception.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/misc/uinteger.h"
-#include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
+#include "doctest.h"
 #include "instructions/instructions.h"
 #include "interfaces/in_observer.h"
 #include "interfaces/out_observer.h"
 #include <algorithm>
-#include <iostream>
+#include <stdexcept>
+#include <vector>
 
 namespace emu::synacor {
 
 using emu::exceptions::UnrecognizedOpcodeException;
-using emu::util::byte::high_byte;
-using emu::util::byte::low_byte;
-using emu::util::byte::to_u16;
-using emu::util::string::hexify;
+
+/**
+ * Indexed by the opcode. The operands are read into locals first, because the order in which
+ * function arguments are evaluated is unspecified.
+ */
+const std::array<Cpu::Instruction, 22> Cpu::s_instructions = {
+    [](Cpu& cpu) { // HALT
+        halt(cpu.m_is_halted);
+    },
+    [](Cpu& cpu) { // SET
+        const u16 a = cpu.next_word();
+        const u16 b = cpu.next_word();
+        set(cpu.m_words, a, b);
+    },
+    [](Cpu& cpu) { // PUSH
+        push(cpu.m_stack, cpu.m_words, cpu.next_word());
+    },
+    [](Cpu& cpu) { // POP
+        pop(cpu.m_stack, cpu.m_words, cpu.next_word());
+    },
+    [](Cpu& cpu) { // EQ
+        const u16 a = cpu.next_word();
+        const u16 b = cpu.next_word();
+        const u16 c = cpu.next_word();
+        eq(cpu.m_words, a, b, c);
+    },
+    [](Cpu& cpu) { // GT
+        const u16 a = cpu.next_word();
+        const u16 b = cpu.next_word();
+        const u16 c = cpu.next_word();
+        gt(cpu.m_words, a, b, c);
+    },
+    [](Cpu& cpu) { // JMP
+        const u16 a = cpu.next_word();
+        jmp(cpu.m_pc, cpu.m_words, a);
+    },
+    [](Cpu& cpu) { // JT
+        const u16 a = cpu.next_word();
+        const u16 b = cpu.next_word();
+        jt(cpu.m_pc, cpu.m_words, a, b);
+    },
+    [](Cpu& cpu) { // JF
+        const u16 a = cpu.next_word();
+        const u16 b = cpu.next_word();
+        jf(cpu.m_pc, cpu.m_words, a, b);
+    },
+    [](Cpu& cpu) { // ADD
+        const u16 a = cpu.next_word();
+        const u16 b = cpu.next_word();
+        const u16 c = cpu.next_word();
+        add(cpu.m_words, a, b, c);
+    },
+    [](Cpu& cpu) { // MULT
+        const u16 a = cpu.next_word();
+        const u16 b = cpu.next_word();
+        const u16 c = cpu.next_word();
+        mult(cpu.m_words, a, b, c);
+    },
+    [](Cpu& cpu) { // MOD
+        const u16 a = cpu.next_word();
+        const u16 b = cpu.next_word();
+        const u16 c = cpu.next_word();
+        mod(cpu.m_words, a, b, c);
+    },
+    [](Cpu& cpu) { // AND
+        const u16 a = cpu.next_word();
+        const u16 b = cpu.next_word();
+        const u16 c = cpu.next_word();
+        and_(cpu.m_words, a, b, c);
+    },
+    [](Cpu& cpu) { // OR
+        const u16 a = cpu.next_word();
+        const u16 b = cpu.next_word();
+        const u16 c = cpu.next_word();
+        or_(cpu.m_words, a, b, c);
+    },
+    [](Cpu& cpu) { // NOT
+        const u16 a = cpu.next_word();
+        const u16 b = cpu.next_word();
+        not_(cpu.m_words, a, b);
+    },
+    [](Cpu& cpu) { // RMEM
+        const u16 a = cpu.next_word();
+        const u16 b = cpu.next_word();
+        rmem(cpu.m_words, a, b);
+    },
+    [](Cpu& cpu) { // WMEM
+        const u16 a = cpu.next_word();
+        const u16 b = cpu.next_word();
+        wmem(cpu.m_words, a, b);
+    },
+    [](Cpu& cpu) { // CALL
+        const u16 a = cpu.next_word();
+        call(cpu.m_pc, cpu.m_stack, cpu.m_words, a);
+    },
+    [](Cpu& cpu) { // RET
+        ret(cpu.m_stack, cpu.m_pc, cpu.m_is_halted);
+    },
+    [](Cpu& cpu) { // OUT, the observers write the character to the terminal
+        const Data character(value_of(cpu.m_words, cpu.next_word()));
+        cpu.notify_out_observers(character);
+    },
+    [](Cpu& cpu) { // IN
+        const u16 a = cpu.next_word();
+        if (cpu.m_input.empty()) {
+            cpu.m_pc -= 2; // IN is run again when there is input
+            cpu.notify_in_observers();
+            return;
+        }
+        in(cpu.m_words, a, cpu.m_input.front());
+        cpu.m_input.pop_front();
+    },
+    [](Cpu&) { // NOOP
+        noop();
+    },
+};
 
 Cpu::Cpu(
     EmulatorMemory<Address, RawData>& memory,
     const Address initial_pc)
     : m_is_halted(false)
     , m_memory(memory)
-    , m_pc(initial_pc)
+    , m_initial_pc(static_cast<u16>(initial_pc.underlying()))
+    , m_pc(m_initial_pc)
 {
+    load_program();
 }
 
 Cpu::~Cpu()
@@ -60,12 +176,15 @@ void Cpu::remove_in_observer(InObserver* observer)
 
 bool Cpu::can_run_next_instruction() const
 {
-    return m_pc < Address(m_memory.size()) && !m_is_halted;
+    return m_pc < memory_size && !m_is_halted;
 }
 
 void Cpu::reset_state()
 {
-    m_pc = Address(0);
+    load_program();
+    m_pc = m_initial_pc;
+    m_stack.clear();
+    m_input.clear();
     m_is_halted = false;
 }
 
@@ -80,164 +199,63 @@ void Cpu::stop()
 
 void Cpu::next_instruction()
 {
-    m_opcode = Data(get_next_value().underlying());
-
-    print_debug(m_opcode);
-
-    switch (m_opcode.underlying()) {
-    case HALT:
-        halt(m_is_halted);
-        break;
-    case SET: {
-        const RawData farg = get_next_value();
-        const RawData sarg = get_next_value();
-        set(m_memory, farg, sarg);
-        break;
-    }
-    case PUSH: {
-        const RawData farg = get_next_value();
-        push(m_stack, m_memory, farg);
-        break;
-    }
-    case POP: {
-        const RawData farg = get_next_value();
-        pop(m_stack, m_memory, farg);
-        break;
-    }
-    case EQ: {
-        const RawData farg = get_next_value();
-        const RawData sarg = get_next_value();
-        const RawData targ = get_next_value();
-        eq(m_memory, farg, sarg, targ);
-        break;
-    }
-    case GT: {
-        const RawData farg = get_next_value();
-        const RawData sarg = get_next_value();
-        const RawData targ = get_next_value();
-        gt(m_memory, farg, sarg, targ);
-        break;
-    }
-    case JMP: {
-        const RawData farg = get_next_value();
-        jmp(m_pc, m_memory, farg);
-        break;
-    }
-    case JT: {
-        const RawData farg = get_next_value();
-        const RawData sarg = get_next_value();
-        jt(m_pc, m_memory, farg, sarg);
-        break;
-    }
-    case JF: {
-        const RawData farg = get_next_value();
-        const RawData sarg = get_next_value();
-        jf(m_pc, m_memory, farg, sarg);
-        break;
-    }
-    case ADD: {
-        const RawData farg = get_next_value();
-        const RawData sarg = get_next_value();
-        const RawData targ = get_next_value();
-        add(m_memory, farg, sarg, targ);
-        break;
-    }
-    case MULT: {
-        const RawData farg = get_next_value();
-        const RawData sarg = get_next_value();
-        const RawData targ = get_next_value();
-        mult(m_memory, farg, sarg, targ);
-        break;
-    }
-    case MOD: {
-        const RawData farg = get_next_value();
-        const RawData sarg = get_next_value();
-        const RawData targ = get_next_value();
-        mod(m_memory, farg, sarg, targ);
-        break;
-    }
-    case AND: {
-        const RawData farg = get_next_value();
-        const RawData sarg = get_next_value();
-        const RawData targ = get_next_value();
-        and_(m_memory, farg, sarg, targ);
-        break;
-    }
-    case OR: {
-        const RawData farg = get_next_value();
-        const RawData sarg = get_next_value();
-        const RawData targ = get_next_value();
-        or_(m_memory, farg, sarg, targ);
-        break;
-    }
-    case NOT: {
-        const RawData farg = get_next_value();
-        const RawData sarg = get_next_value();
-        not_(m_memory, farg, sarg);
-        break;
-    }
-    case RMEM: {
-        const RawData farg = get_next_value();
-        const RawData sarg = get_next_value();
-        rmem(m_memory, farg, sarg);
-        break;
-    }
-    case WMEM: {
-        const RawData farg = get_next_value();
-        const RawData sarg = get_next_value();
-        wmem(m_memory, farg, sarg);
-        break;
-    }
-    case CALL: {
-        const RawData farg = get_next_value();
-        call(m_pc, m_stack, farg);
-        break;
-    }
-    case RET: {
-        ret(m_stack, m_pc, m_is_halted);
-        break;
-    }
-    case OUT: {
-        const RawData farg = get_next_value();
-        out(Data(farg.underlying()));
-        notify_out_observers(Data(farg.underlying()));
-        break;
-    }
-    case IN: {
-        in(Address(get_next_value()), m_memory);
-        break;
-    }
-    case NOOP:
-        noop();
-        break;
-    default:
-        throw UnrecognizedOpcodeException(static_cast<u16>(m_opcode.underlying()));
+    const u16 opcode = next_word();
+    if (opcode >= s_instructions.size()) {
+        throw UnrecognizedOpcodeException(opcode);
     }
+
+    s_instructions[opcode](*this);
 }
 
-RawData Cpu::get_next_value()
+void Cpu::load_program()
 {
-    return m_memory.read(m_pc++);
+    if (m_memory.size() > memory_size) {
+        throw std::invalid_argument("The program does not fit in memory");
+    }
+
+    m_words.fill(0);
+    std::transform(m_memory.begin(), m_memory.end(), m_words.begin(),
+        [](RawData word) { return static_cast<u16>(word.underlying()); });
 }
 
-EmulatorMemory<Address, RawData>& Cpu::memory()
+u16 Cpu::next_word()
 {
-    return m_memory;
+    return m_words[m_pc++];
 }
 
 Address Cpu::pc() const
 {
-    return m_pc;
+    return Address(m_pc);
 }
 
 RawData Cpu::r0() const
 {
-    return m_memory.read(Address(32768));
+    return register_value(0);
+}
+
+RawData Cpu::register_value(std::size_t index) const
+{
+    return RawData(m_words[memory_size + index]);
+}
+
+void Cpu::set_register_value(std::size_t index, RawData value)
+{
+    m_words[memory_size + index] = static_cast<u16>(value.underlying()) & value_mask;
 }
 
-void Cpu::input([[maybe_unused]] Data value)
+RawData Cpu::word(std::size_t address) const
 {
-    //    m_r0 = value;
+    return RawData(m_words[address]);
+}
+
+void Cpu::return_from_routine()
+{
+    ret(m_stack, m_pc, m_is_halted);
+}
+
+void Cpu::input(Data value)
+{
+    m_input.push_back(static_cast<u16>(value.underlying()));
 }
 
 void Cpu::notify_out_observers(Data character)
@@ -254,22 +272,165 @@ void Cpu::notify_in_observers()
     }
 }
 
-void Cpu::print_debug([[maybe_unused]] Data opcode)
+class TestTerminal
+    : public OutObserver
+    , public InObserver {
+public:
+    std::vector<u16> m_output;
+    int m_input_requests = 0;
+
+    void out_changed(Data character) override
+    {
+        m_output.push_back(static_cast<u16>(character.underlying()));
+    }
+
+    void in_requested() override
+    {
+        ++m_input_requests;
+    }
+};
+
+TEST_CASE("Synacor: Cpu")
 {
-    if (false) {
-        std::cout << "pc=" << m_pc
-                  << ",op=" << opcode
-                  //                  << ",r0=" << m_r0.underlying()
-                  //                  << ",r1=" << m_r1.underlying()
-                  //                  << ",r2=" << m_r2.underlying()
-                  //                  << ",r3=" << m_r3.underlying()
-                  //                  << ",r4=" << m_r4.underlying()
-                  //                  << ",r5=" << m_r5.underlying()
-                  //                  << ",r6=" << m_r6.underlying()
-                  //                  << ",r7=" << m_r7.underlying()
-                  << "\n"
-                  << std::flush;
+    auto const run = [](Cpu& cpu) {
+        while (cpu.can_run_next_instruction()) {
+            cpu.next_instruction();
+        }
+    };
+
+    SUBCASE("should run the example program from the architecture specification")
+    {
+        EmulatorMemory<Address, RawData> memory;
+        memory.add(std::vector<RawData> {
+            RawData(1), RawData(32769), RawData(65), // SET r1 65
+            RawData(9), RawData(32768), RawData(32769), RawData(4), // ADD r0 r1 4
+            RawData(19), RawData(32768), // OUT r0
+            RawData(0) // HALT
+        });
+        TestTerminal terminal;
+        Cpu cpu(memory, Address(0));
+        cpu.add_out_observer(terminal);
+
+        run(cpu);
+
+        CHECK_EQ(RawData(69), cpu.r0());
+        CHECK_EQ(RawData(65), cpu.register_value(1));
+        REQUIRE_EQ(1, terminal.m_output.size());
+        CHECK_EQ(69, terminal.m_output[0]);
+    }
+
+    SUBCASE("should do the arithmetic modulo 32768")
+    {
+        EmulatorMemory<Address, RawData> memory;
+        memory.add(std::vector<RawData> {
+            RawData(9), RawData(32768), RawData(32758), RawData(15), // ADD r0 32758 15
+            RawData(10), RawData(32769), RawData(16384), RawData(3), // MULT r1 16384 3
+            RawData(14), RawData(32770), RawData(0), // NOT r2 0
+            RawData(11), RawData(32771), RawData(32767), RawData(10), // MOD r3 32767 10
+            RawData(0) // HALT
+        });
+        Cpu cpu(memory, Address(0));
+
+        run(cpu);
+
+        CHECK_EQ(RawData(5), cpu.register_value(0));
+        CHECK_EQ(RawData(16384), cpu.register_value(1));
+        CHECK_EQ(RawData(32767), cpu.register_value(2));
+        CHECK_EQ(RawData(7), cpu.register_value(3));
+    }
+
+    SUBCASE("should return to the instruction after CALL")
+    {
+        EmulatorMemory<Address, RawData> memory;
+        memory.add(std::vector<RawData> {
+            RawData(17), RawData(3), // CALL 3
+            RawData(0), // HALT
+            RawData(1), RawData(32768), RawData(42), // SET r0 42
+            RawData(18) // RET
+        });
+        Cpu cpu(memory, Address(0));
+
+        run(cpu);
+
+        CHECK_EQ(RawData(42), cpu.r0());
+        CHECK_EQ(Address(3), cpu.pc());
+    }
+
+    SUBCASE("should wait for input before running IN")
+    {
+        EmulatorMemory<Address, RawData> memory;
+        memory.add(std::vector<RawData> {
+            RawData(20), RawData(32768), // IN r0
+            RawData(0) // HALT
+        });
+        TestTerminal terminal;
+        Cpu cpu(memory, Address(0));
+        cpu.add_in_observer(terminal);
+
+        cpu.next_instruction();
+
+        CHECK_EQ(1, terminal.m_input_requests);
+        CHECK_EQ(Address(0), cpu.pc());
+
+        cpu.input(Data('a'));
+        cpu.next_instruction();
+
+        CHECK_EQ(1, terminal.m_input_requests);
+        CHECK_EQ(RawData('a'), cpu.r0());
+        CHECK_EQ(Address(2), cpu.pc());
+    }
+
+    SUBCASE("should start over from the program when reset")
+    {
+        EmulatorMemory<Address, RawData> memory;
+        memory.add(std::vector<RawData> {
+            RawData(16), RawData(0), RawData(0), // WMEM 0 0
+            RawData(0) // HALT
+        });
+        Cpu cpu(memory, Address(0));
+
+        run(cpu);
+        cpu.reset_state();
+        cpu.next_instruction();
+
+        CHECK_EQ(Address(3), cpu.pc());
+    }
+
+    SUBCASE("should return from a routine that was run by something other than the CPU")
+    {
+        EmulatorMemory<Address, RawData> memory;
+        memory.add(std::vector<RawData> {
+            RawData(16), RawData(7), RawData(42), // WMEM 7 42
+            RawData(17), RawData(6), // CALL 6
+            RawData(0), // HALT
+            RawData(21) // NOOP
+        });
+        Cpu cpu(memory, Address(0));
+
+        cpu.next_instruction();
+        cpu.next_instruction();
+        cpu.set_register_value(1, RawData(32769));
+        cpu.return_from_routine();
+
+        CHECK_EQ(Address(5), cpu.pc());
+        CHECK_EQ(RawData(1), cpu.register_value(1));
+        CHECK_EQ(RawData(42), cpu.word(7));
     }
 }
 
+BENCHMARK("Synacor: next_instruction")
+{
+    EmulatorMemory<Address, RawData> memory;
+    memory.add(std::vector<RawData> {
+        RawData(9), RawData(32768), RawData(32768), RawData(1), // ADD r0 r0 1
+        RawData(10), RawData(32769), RawData(32768), RawData(3), // MULT r1 r0 3
+        RawData(4), RawData(32770), RawData(32768), RawData(32769), // EQ r2 r0 r1
+        RawData(6), RawData(0) // JMP 0
+    });
+    Cpu cpu(memory, Address(0));
+
+    bench.run([&]() {
+        cpu.next_instruction();
+    });
+}
 }
@@ -1,10 +1,11 @@
 #pragma once
 
 #include "chips/trivial/synacor/usings.h"
-#include "crosscutting/memory/next_byte.h"
-#include "crosscutting/memory/next_word.h"
+#include "chips/trivial/synacor/words.h"
 #include "crosscutting/typedefs.h"
-#include <stack>
+#include <array>
+#include <cstddef>
+#include <deque>
 #include <vector>
 
 namespace emu::memory {
@@ -13,18 +14,18 @@ class EmulatorMemory;
 }
 namespace emu::synacor {
 class InObserver;
-enum class OutType;
-}
-namespace emu::synacor {
 class OutObserver;
 }
 
 namespace emu::synacor {
 
 using emu::memory::EmulatorMemory;
-using emu::memory::NextByte;
-using emu::memory::NextWord;
 
+/**
+ * Runs on plain 16-bit words instead of on Address and Data, which are only used at the boundary
+ * to the rest of the emulator. The program is copied into the words, so the memory it was loaded
+ * from is not changed by running it.
+ */
 class Cpu {
 public:
     Cpu(
@@ -51,32 +52,60 @@ public:
 
     void remove_in_observer(InObserver* observer);
 
-    EmulatorMemory<Address, RawData>& memory();
-
     [[nodiscard]] Address pc() const;
 
     [[nodiscard]] RawData r0() const;
 
+    [[nodiscard]] RawData register_value(std::size_t index) const;
+
+    void set_register_value(std::size_t index, RawData value);
+
+    /**
+     * Reads the CPU's own copy of the program, which differs from the memory it was loaded from when
+     * the program has changed itself.
+     *
+     * @param address is the address of the word
+     * @return the word
+     */
+    [[nodiscard]] RawData word(std::size_t address) const;
+
+    /**
+     * Returns from the routine that is running, like RET does, for when the routine has been run
+     * by something other than the CPU.
+     */
+    void return_from_routine();
+
+    /**
+     * Gives the CPU a character to read. The IN instruction waits for one if none have been given.
+     *
+     * @param value is the character
+     */
     void input(Data value);
 
 private:
+    using Instruction = void (*)(Cpu& cpu);
+
+    static const std::array<Instruction, 22> s_instructions;
+
     bool m_is_halted;
 
     EmulatorMemory<Address, RawData>& m_memory;
 
-    Data m_opcode { 0 };
-    Address m_pc;
-    std::stack<Address> m_stack;
+    Words m_words {};
+    u16 m_initial_pc;
+    u16 m_pc;
+    std::vector<u16> m_stack;
+    std::deque<u16> m_input;
 
     std::vector<OutObserver*> m_out_observers;
     std::vector<InObserver*> m_in_observers;
 
-    RawData get_next_value();
+    void load_program();
+
+    u16 next_word();
 
     void notify_out_observers(Data character);
 
     void notify_in_observers();
-
-    void print_debug(Data opcode);
 };
 }
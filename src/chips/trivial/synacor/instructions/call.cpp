@@ -1,13 +1,12 @@
 #include "chips/trivial/synacor/usings.h"
-#include "crosscutting/memory/emulator_memory.h"
+#include "chips/trivial/synacor/words.h"
 #include "crosscutting/misc/uinteger.h"
 #include "crosscutting/util/string_util.h"
 #include <iostream>
-#include <stack>
+#include <vector>
 
 namespace emu::synacor {
 
-using emu::memory::EmulatorMemory;
 using emu::util::string::hexify;
 
 /**
@@ -16,14 +15,15 @@ using emu::util::string::hexify;
  *   <li>Size: 2</li>
  * </ul>
  *
- * @param pc is the program counter, which will be mutated
+ * @param pc is the program counter, which already points to the next instruction, and will be mutated
  * @param stack is the stack, which will be mutated
+ * @param words is the memory and the registers
  * @param a is the address to jump to
  */
-void call(Address& pc, std::stack<Address>& stack, RawData a)
+void call(u16& pc, std::vector<u16>& stack, Words const& words, u16 a)
 {
-    stack.emplace(pc.underlying() + 1);
-    pc = Address(a.underlying());
+    stack.push_back(pc);
+    pc = value_of(words, a) & value_mask;
 }
 
 void print_call(std::ostream& ostream, RawData a)
@@ -1,12 +1,11 @@
 #include "chips/trivial/synacor/usings.h"
-#include "crosscutting/memory/emulator_memory.h"
+#include "chips/trivial/synacor/words.h"
 #include "crosscutting/misc/uinteger.h"
 #include "crosscutting/util/string_util.h"
 #include <iostream>
 
 namespace emu::synacor {
 
-using emu::memory::EmulatorMemory;
 using emu::util::string::hexify;
 
 /**
@@ -15,18 +14,14 @@ using emu::util::string::hexify;
  *   <li>Size: 4</li>
  * </ul>
  *
- * @param memory is the memory, which will be mutated
- * @param a is the value set to 0 or 1
- * @param b is the first operand to check for equality
- * @param c is the second operand to check for equality
+ * @param words is the memory and the registers, which will be mutated
+ * @param a is the register set to 0 or 1
+ * @param b is the first operand to compare
+ * @param c is the second operand to compare
  */
-void gt(EmulatorMemory<Address, RawData>& memory, RawData a, RawData b, RawData c)
+void gt(Words& words, u16 a, u16 b, u16 c)
 {
-    if (b > c) {
-        memory.write(Address(a.underlying()), RawData(1));
-    } else {
-        memory.write(Address(a.underlying()), RawData(0));
-    }
+    register_of(words, a) = value_of(words, b) > value_of(words, c) ? 1 : 0;
 }
 
 void print_gt(std::ostream& ostream, RawData a, RawData b, RawData c)
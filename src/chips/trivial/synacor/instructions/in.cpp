@@ -1,12 +1,11 @@
 #include "chips/trivial/synacor/usings.h"
-#include "crosscutting/memory/emulator_memory.h"
+#include "chips/trivial/synacor/words.h"
 #include "crosscutting/misc/uinteger.h"
 #include "crosscutting/util/string_util.h"
 #include <iostream>
 
 namespace emu::synacor {
 
-using emu::memory::EmulatorMemory;
 using emu::util::string::hexify;
 
 /**
@@ -20,12 +19,13 @@ using emu::util::string::hexify;
  *   <li>Size: 2</li>
  * </ul>
  *
- * @param a is address to write input to
- * @param memory is the memory, which will be mutated
+ * @param words is the memory and the registers, which will be mutated
+ * @param a is the register to write the input to
+ * @param character is the character that was read
  */
-void in(Address a, EmulatorMemory<Address, RawData>& memory)
+void in(Words& words, u16 a, u16 character)
 {
-    memory.write(a, RawData(1)); // TODO
+    register_of(words, a) = character & value_mask;
 }
 
 void print_in(std::ostream& ostream, RawData a)
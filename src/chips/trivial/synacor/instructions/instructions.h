@@ -1,8 +1,10 @@
 #pragma once
 
 #include "chips/trivial/synacor/usings.h"
-#include "crosscutting/memory/emulator_memory.h"
-#include <stack>
+#include "chips/trivial/synacor/words.h"
+#include "crosscutting/typedefs.h"
+#include <iosfwd>
+#include <vector>
 
 constexpr unsigned int HALT = 0x00;
 constexpr unsigned int SET = 0x01;
@@ -29,30 +31,27 @@ constexpr unsigned int NOOP = 0x15;
 
 namespace emu::synacor {
 
-using emu::memory::EmulatorMemory;
-
-void add(EmulatorMemory<Address, RawData>& memory, RawData a, RawData b, RawData c);
-void and_(EmulatorMemory<Address, RawData>& memory, RawData a, RawData b, RawData c);
-void call(Address& pc, std::stack<Address>& stack, RawData a);
-void eq(EmulatorMemory<Address, RawData>& memory, RawData a, RawData b, RawData c);
-void gt(EmulatorMemory<Address, RawData>& memory, RawData a, RawData b, RawData c);
+void add(Words& words, u16 a, u16 b, u16 c);
+void and_(Words& words, u16 a, u16 b, u16 c);
+void call(u16& pc, std::vector<u16>& stack, Words const& words, u16 a);
+void eq(Words& words, u16 a, u16 b, u16 c);
+void gt(Words& words, u16 a, u16 b, u16 c);
 void halt(bool& is_halted);
-void in(Address a, EmulatorMemory<Address, RawData>& memory);
-void jf(Address& pc, EmulatorMemory<Address, RawData> const& memory, RawData a, RawData b);
-void jmp(Address& pc, EmulatorMemory<Address, RawData> const& memory, RawData a);
-void jt(Address& pc, EmulatorMemory<Address, RawData> const& memory, RawData a, RawData b);
-void mod(EmulatorMemory<Address, RawData>& memory, RawData a, RawData b, RawData c);
-void mult(EmulatorMemory<Address, RawData>& memory, RawData a, RawData b, RawData c);
+void in(Words& words, u16 a, u16 character);
+void jf(u16& pc, Words const& words, u16 a, u16 b);
+void jmp(u16& pc, Words const& words, u16 a);
+void jt(u16& pc, Words const& words, u16 a, u16 b);
+void mod(Words& words, u16 a, u16 b, u16 c);
+void mult(Words& words, u16 a, u16 b, u16 c);
 void noop();
-void not_(EmulatorMemory<Address, RawData>& memory, RawData a, RawData b);
-void or_(EmulatorMemory<Address, RawData>& memory, RawData a, RawData b, RawData c);
-void out(Data character);
-void pop(std::stack<Address>& stack, EmulatorMemory<Address, RawData>& memory, RawData a);
-void push(std::stack<Address>& stack, EmulatorMemory<Address, RawData> const& memory, RawData a);
-void ret(std::stack<Address>& stack, Address& pc, bool& is_halted);
-void rmem(EmulatorMemory<Address, RawData>& memory, RawData a, RawData b);
-void set(EmulatorMemory<Address, RawData>& memory, RawData a, RawData b);
-void wmem(EmulatorMemory<Address, RawData>& memory, RawData a, RawData b);
+void not_(Words& words, u16 a, u16 b);
+void or_(Words& words, u16 a, u16 b, u16 c);
+void pop(std::vector<u16>& stack, Words& words, u16 a);
+void push(std::vector<u16>& stack, Words const& words, u16 a);
+void ret(std::vector<u16>& stack, u16& pc, bool& is_halted);
+void rmem(Words& words, u16 a, u16 b);
+void set(Words& words, u16 a, u16 b);
+void wmem(Words& words, u16 a, u16 b);
 
 void print_add(std::ostream& ostream, RawData a, RawData b, RawData c);
 void print_and(std::ostream& ostream, RawData a, RawData b, RawData c);
@@ -1,12 +1,11 @@
 #include "chips/trivial/synacor/usings.h"
-#include "crosscutting/memory/emulator_memory.h"
+#include "chips/trivial/synacor/words.h"
 #include "crosscutting/misc/uinteger.h"
 #include "crosscutting/util/string_util.h"
 #include <iostream>
 
 namespace emu::synacor {
 
-using emu::memory::EmulatorMemory;
 using emu::util::string::hexify;
 
 /**
@@ -16,20 +15,14 @@ using emu::util::string::hexify;
  * </ul>
  *
  * @param pc is the program counter, which will be modified
- * @param memory is the memory
+ * @param words is the memory and the registers
  * @param a is the value to check for zero
  * @param b is the address to jump to
  */
-void jf(Address& pc, EmulatorMemory<Address, RawData> const& memory, RawData a, RawData b)
+void jf(u16& pc, Words const& words, u16 a, u16 b)
 {
-    const RawData real_a = a >= RawData(32768) ? memory.read(Address(a)) : a;
-
-    if (real_a == RawData(0)) {
-        if (b >= RawData(32768)) {
-            pc = Address(memory.read(Address(b.underlying())));
-        } else {
-            pc = Address(b.underlying());
-        }
+    if (value_of(words, a) == 0) {
+        pc = value_of(words, b) & value_mask;
     }
 }
 
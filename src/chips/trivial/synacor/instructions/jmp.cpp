@@ -1,12 +1,11 @@
 #include "chips/trivial/synacor/usings.h"
-#include "crosscutting/memory/emulator_memory.h"
+#include "chips/trivial/synacor/words.h"
 #include "crosscutting/misc/uinteger.h"
 #include "crosscutting/util/string_util.h"
 #include <iostream>
 
 namespace emu::synacor {
 
-using emu::memory::EmulatorMemory;
 using emu::util::string::hexify;
 
 /**
@@ -16,14 +15,12 @@ using emu::util::string::hexify;
  * </ul>
  *
  * @param pc is the program counter, which will be modified
- * @param memory is the memory
+ * @param words is the memory and the registers
  * @param a is the address to jump to
  */
-void jmp(Address& pc, EmulatorMemory<Address, RawData> const& memory, RawData a)
+void jmp(u16& pc, Words const& words, u16 a)
 {
-    const RawData real_a = a >= RawData(32768) ? memory.read(Address(a)) : a;
-
-    pc = Address(real_a.underlying());
+    pc = value_of(words, a) & value_mask;
 }
 
 void print_jmp(std::ostream& ostream, RawData a)
@@ -1,12 +1,12 @@
 #include "chips/trivial/synacor/usings.h"
-#include "crosscutting/memory/emulator_memory.h"
+#include "chips/trivial/synacor/words.h"
 #include "crosscutting/misc/uinteger.h"
 #include "crosscutting/util/string_util.h"
 #include <iostream>
+#include <stdexcept>
 
 namespace emu::synacor {
 
-using emu::memory::EmulatorMemory;
 using emu::util::string::hexify;
 
 /**
@@ -15,16 +15,19 @@ using emu::util::string::hexify;
  *   <li>Size: 4</li>
  * </ul>
  *
- * @param memory is the memory, which will be mutated
- * @param a is the address of the register to store the mod result into
+ * @param words is the memory and the registers, which will be mutated
+ * @param a is the register to store the mod result into
  * @param b is the first operand to mod
  * @param c is the second operand to mod
  */
-void mod(EmulatorMemory<Address, RawData>& memory, RawData a, RawData b, RawData c)
+void mod(Words& words, u16 a, u16 b, u16 c)
 {
-    memory.write(
-        Address(a.underlying()),
-        RawData(Data(b.underlying() % c.underlying()).underlying()));
+    const u16 divisor = value_of(words, c);
+    if (divisor == 0) {
+        throw std::runtime_error("Cannot MOD by zero");
+    }
+
+    register_of(words, a) = value_of(words, b) % divisor;
 }
 
 void print_mod(std::ostream& ostream, RawData a, RawData b, RawData c)
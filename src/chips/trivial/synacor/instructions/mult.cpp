@@ -1,12 +1,11 @@
 #include "chips/trivial/synacor/usings.h"
-#include "crosscutting/memory/emulator_memory.h"
+#include "chips/trivial/synacor/words.h"
 #include "crosscutting/misc/uinteger.h"
 #include "crosscutting/util/string_util.h"
 #include <iostream>
 
 namespace emu::synacor {
 
-using emu::memory::EmulatorMemory;
 using emu::util::string::hexify;
 
 /**
@@ -15,16 +14,15 @@ using emu::util::string::hexify;
  *   <li>Size: 4</li>
  * </ul>
  *
- * @param memory is the memory, which will be mutated
- * @param a is the address of the register to store the product into
+ * @param words is the memory and the registers, which will be mutated
+ * @param a is the register to store the product into
  * @param b is the first operand to multiply
  * @param c is the second operand to multiply
  */
-void mult(EmulatorMemory<Address, RawData>& memory, RawData a, RawData b, RawData c)
+void mult(Words& words, u16 a, u16 b, u16 c)
 {
-    memory.write(
-        Address(a.underlying()),
-        RawData(Data(b.underlying() * c.underlying()).underlying()));
+    const u32 product = static_cast<u32>(value_of(words, b)) * value_of(words, c);
+    register_of(words, a) = static_cast<u16>(product & value_mask);
 }
 
 void print_mult(std::ostream& ostream, RawData a, RawData b, RawData c)
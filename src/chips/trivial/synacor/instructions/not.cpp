@@ -1,12 +1,11 @@
 #include "chips/trivial/synacor/usings.h"
-#include "crosscutting/memory/emulator_memory.h"
+#include "chips/trivial/synacor/words.h"
 #include "crosscutting/misc/uinteger.h"
 #include "crosscutting/util/string_util.h"
 #include <iostream>
 
 namespace emu::synacor {
 
-using emu::memory::EmulatorMemory;
 using emu::util::string::hexify;
 
 /**
@@ -15,16 +14,13 @@ using emu::util::string::hexify;
  *   <li>Size: 3</li>
  * </ul>
  *
- * @param memory is the memory, which will be mutated
- * @param a is the address of the register to store the not result into
- * @param b is the first operand to not
- * @param c is the second operand to not
+ * @param words is the memory and the registers, which will be mutated
+ * @param a is the register to store the not result into
+ * @param b is the operand to not
  */
-void not_(EmulatorMemory<Address, RawData>& memory, RawData a, RawData b)
+void not_(Words& words, u16 a, u16 b)
 {
-    memory.write(
-        Address(a.underlying()),
-        RawData(Data(~b.underlying()).underlying()));
+    register_of(words, a) = ~value_of(words, b) & value_mask;
 }
 
 void print_not(std::ostream& ostream, RawData a, RawData b)
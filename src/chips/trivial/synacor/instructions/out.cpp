@@ -7,20 +7,6 @@ namespace emu::synacor {
 
 using emu::util::string::hexify;
 
-/**
- * Write the character represented by ascii code <a> to the terminal
- * <ul>
- *   <li>Size: 2</li>
- * </ul>
- *
- * @param character is the character to print to the terminal
- */
-void out([[maybe_unused]] Data character)
-{
-    std::cout << static_cast<char>(character.underlying())
-              << std::flush;
-}
-
 std::string as_str(RawData character)
 {
     if (character.underlying() == 0x000a) {
@@ -1,13 +1,13 @@
 #include "chips/trivial/synacor/usings.h"
-#include "crosscutting/memory/emulator_memory.h"
+#include "chips/trivial/synacor/words.h"
 #include "crosscutting/misc/uinteger.h"
 #include "crosscutting/util/string_util.h"
 #include <iostream>
-#include <stack>
+#include <stdexcept>
+#include <vector>
 
 namespace emu::synacor {
 
-using emu::memory::EmulatorMemory;
 using emu::util::string::hexify;
 
 /**
@@ -17,21 +17,17 @@ using emu::util::string::hexify;
  * </ul>
  *
  * @param stack is the stack, which will be mutated
- * @param a is the place to write the top element to, which will be mutated
+ * @param words is the memory and the registers, which will be mutated
+ * @param a is the register to write the top element to
  */
-void pop(std::stack<Address>& stack, EmulatorMemory<Address, RawData>& memory, RawData a)
+void pop(std::vector<u16>& stack, Words& words, u16 a)
 {
     if (stack.empty()) {
         throw std::runtime_error("The stack is empty");
     }
 
-    if (a >= RawData(32768)) {
-        auto const stack_value = RawData(stack.top().underlying());
-        stack.pop();
-        memory.write(Address(a.underlying()), stack_value);
-    } else {
-        throw std::runtime_error("Cannot POP to a non-register");
-    }
+    register_of(words, a) = stack.back();
+    stack.pop_back();
 }
 
 void print_pop(std::ostream& ostream, RawData a)
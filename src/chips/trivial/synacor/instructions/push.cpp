@@ -1,13 +1,12 @@
 #include "chips/trivial/synacor/usings.h"
-#include "crosscutting/memory/emulator_memory.h"
+#include "chips/trivial/synacor/words.h"
 #include "crosscutting/misc/uinteger.h"
 #include "crosscutting/util/string_util.h"
 #include <iostream>
-#include <stack>
+#include <vector>
 
 namespace emu::synacor {
 
-using emu::memory::EmulatorMemory;
 using emu::util::string::hexify;
 
 /**
@@ -17,15 +16,12 @@ using emu::util::string::hexify;
  * </ul>
  *
  * @param stack is the stack, which will be mutated
+ * @param words is the memory and the registers
  * @param a is the value to push onto the stack
  */
-void push(std::stack<Address>& stack, EmulatorMemory<Address, RawData> const& memory, RawData a)
+void push(std::vector<u16>& stack, Words const& words, u16 a)
 {
-    if (a >= RawData(32768)) {
-        stack.emplace(memory.read(Address(a.underlying())).underlying());
-    } else {
-        stack.emplace(a.underlying());
-    }
+    stack.push_back(value_of(words, a));
 }
 
 void print_push(std::ostream& ostream, RawData a)
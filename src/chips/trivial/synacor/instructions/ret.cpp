@@ -1,7 +1,8 @@
 #include "chips/trivial/synacor/usings.h"
+#include "chips/trivial/synacor/words.h"
 #include "crosscutting/misc/uinteger.h"
 #include <iostream>
-#include <stack>
+#include <vector>
 
 namespace emu::synacor {
 
@@ -15,15 +16,15 @@ namespace emu::synacor {
  * @param pc is the program counter, which will be mutated
  * @param is_halted is the halted status, which will be mutated
  */
-void ret(std::stack<Address>& stack, Address& pc, bool& is_halted)
+void ret(std::vector<u16>& stack, u16& pc, bool& is_halted)
 {
     if (stack.empty()) {
         is_halted = true;
         return;
     }
 
-    pc = stack.top();
-    stack.pop();
+    pc = stack.back() & value_mask;
+    stack.pop_back();
 }
 
 void print_ret(std::ostream& ostream)
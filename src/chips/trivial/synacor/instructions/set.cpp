@@ -1,12 +1,11 @@
 #include "chips/trivial/synacor/usings.h"
-#include "crosscutting/memory/emulator_memory.h"
+#include "chips/trivial/synacor/words.h"
 #include "crosscutting/misc/uinteger.h"
 #include "crosscutting/util/string_util.h"
 #include <iostream>
 
 namespace emu::synacor {
 
-using emu::memory::EmulatorMemory;
 using emu::util::string::hexify;
 
 /**
@@ -15,13 +14,13 @@ using emu::util::string::hexify;
  *   <li>Size: 3</li>
  * </ul>
  *
- * @param memory is the memory, which will be mutated
+ * @param words is the memory and the registers, which will be mutated
  * @param a is the <a> register
  * @param b is the value to place into <a>
  */
-void set(EmulatorMemory<Address, RawData>& memory, RawData a, RawData b)
+void set(Words& words, u16 a, u16 b)
 {
-    memory.write(Address(a.underlying()), b);
+    register_of(words, a) = value_of(words, b);
 }
 
 void print_set(std::ostream& ostream, RawData a, RawData b)
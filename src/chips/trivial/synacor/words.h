@@ -0,0 +1,54 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+
+namespace emu::synacor {
+
+constexpr std::size_t memory_size = 32768;
+constexpr std::size_t register_count = 8;
+
+/**
+ * The arithmetic is modulo 32768, which is a power of two, so masking to 15 bits is enough.
+ */
+constexpr u16 value_mask = 0x7fff;
+
+/**
+ * The memory followed by the registers. An operand of 32768..32775 names a register, and is then
+ * also the index of that register, so operands can be looked up without translating them first.
+ */
+using Words = std::array<u16, memory_size + register_count>;
+
+/**
+ * @param words is the memory and the registers
+ * @param operand is a literal value, or the register to read the value from
+ * @return the value of the operand
+ */
+inline u16 value_of(Words const& words, u16 operand)
+{
+    if (operand < memory_size) {
+        return operand;
+    }
+    if (operand >= words.size()) {
+        throw std::invalid_argument("Invalid operand");
+    }
+
+    return words[operand];
+}
+
+/**
+ * @param words is the memory and the registers
+ * @param operand is the register to write to
+ * @return the register
+ */
+inline u16& register_of(Words& words, u16 operand)
+{
+    if (operand < memory_size || operand >= words.size()) {
+        throw std::runtime_error("Cannot write to a non-register");
+    }
+
+    return words[operand];
+}
+}
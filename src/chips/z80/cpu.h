@@ -3,8 +3,8 @@
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/memory/next_word.h"
 #include "crosscutting/typedefs.h"
-#include "flags.h"
 #include "interrupt_mode.h"
+#include "register_file.h"
 #include <cstddef>
 #include <cstdint>
 #include <vector>
@@ -13,6 +13,10 @@ namespace emu::memory {
 template<class A, class D>
 class EmulatorMemory;
 }
+namespace emu::misc {
+class StateReader;
+class StateWriter;
+}
 namespace emu::z80 {
 class InObserver;
 class OutObserver;
@@ -24,6 +28,8 @@ namespace emu::z80 {
 using emu::memory::EmulatorMemory;
 using emu::memory::NextByte;
 using emu::memory::NextWord;
+using emu::misc::StateReader;
+using emu::misc::StateWriter;
 
 class Cpu {
 public:
@@ -45,6 +51,12 @@ public:
 
     void set_state_manually(ManualState new_state);
 
+    [[nodiscard]] ManualState manual_state() const;
+
+    void save_state(StateWriter& writer) const;
+
+    void load_state(StateReader& reader);
+
     void add_out_observer(OutObserver& observer);
 
     void remove_out_observer(OutObserver* observer);
@@ -116,7 +128,7 @@ public:
     void input(u16 port, u8 value);
 
 private:
-    static constexpr unsigned int s_number_of_io_ports = UINT16_MAX;
+    static constexpr unsigned int s_number_of_io_ports = UINT16_MAX + 1;
 
     bool m_is_halted { false };
 
@@ -136,26 +148,9 @@ private:
     u8 m_opcode { 0 };
     u16 m_sp { 0xffff };
     u16 m_pc;
-    u8 m_acc_reg { 0xff };
-    u8 m_acc_p_reg { 0 };
-    u8 m_b_reg { 0 };
-    u8 m_b_p_reg { 0 };
-    u8 m_c_reg { 0 };
-    u8 m_c_p_reg { 0 };
-    u8 m_d_reg { 0 };
-    u8 m_d_p_reg { 0 };
-    u8 m_e_reg { 0 };
-    u8 m_e_p_reg { 0 };
-    u8 m_h_reg { 0 };
-    u8 m_h_p_reg { 0 };
-    u8 m_l_reg { 0 };
-    u8 m_l_p_reg { 0 };
-    u16 m_ix_reg { 0 };
-    u16 m_iy_reg { 0 };
+    RegisterFile m_registers;
     u8 m_i_reg { 0 };
     u8 m_r_reg { 0 };
-    Flags m_flag_reg;
-    Flags m_flag_p_reg;
     InterruptMode m_interrupt_mode { InterruptMode::ZERO };
 
     std::vector<OutObserver*> m_out_observers;
@@ -163,9 +158,9 @@ private:
 
     void next_bits_instruction(u8 bits_opcode, cyc& cycles);
 
-    void next_ixy_instruction(u8 ixy_opcode, u16& ixy_reg, cyc& cycles);
+    void next_ixy_instruction(u8 ixy_opcode, IndexRegister ixy, cyc& cycles);
 
-    void next_ixy_bits_instruction(NextWord args, u16& ixy_reg, cyc& cycles);
+    void next_ixy_bits_instruction(NextWord args, u16 ixy_reg, cyc& cycles);
 
     void next_extd_instruction(u8 extd_opcode, cyc& cycles);
 
@@ -181,7 +176,7 @@ private:
 
     NextWord get_next_word();
 
-    void notify_out_observers(u8 port);
+    void notify_out_observers(u16 port);
 
     void notify_in_observers(u16 port);
 
@@ -1,2456 +1,2134 @@
 #include "disassembler.h"
-#include "crosscutting/exceptions/unrecognized_opcode_exception.h"
+#include "crosscutting/benchmarking/benchmark.h"
 #include "crosscutting/memory/emulator_memory.h"
-#include "crosscutting/util/string_util.h"
+#include "crosscutting/util/byte_util.h"
+#include "doctest.h"
 #include "instructions/instructions.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
 
 namespace emu::z80 {
 
-using emu::exceptions::UnrecognizedOpcodeException;
-using emu::util::string::hexify;
-using emu::util::string::hexify_wo_0x;
+using emu::benchmarking::do_not_optimize;
+using emu::benchmarking::pseudo_random_bytes;
+using emu::debugger::ControlFlow;
+using emu::debugger::format_instruction;
+using emu::util::byte::to_u16;
 
-Disassembler::Disassembler(EmulatorMemory<u16, u8>& memory, std::ostream& ostream)
+// The length of each unprefixed instruction in bytes, indexed by opcode
+static constexpr std::array<u8, 256> s_instruction_lengths = {
+    1, 3, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+    2, 3, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1,
+    2, 3, 3, 1, 1, 1, 2, 1, 2, 1, 3, 1, 1, 1, 2, 1,
+    2, 3, 3, 1, 1, 1, 2, 1, 2, 1, 3, 1, 1, 1, 2, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 3, 3, 3, 1, 2, 1, 1, 1, 3, 2, 3, 3, 2, 1,
+    1, 1, 3, 2, 3, 1, 2, 1, 1, 1, 3, 2, 3, 2, 2, 1,
+    1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 2, 2, 1,
+    1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 2, 2, 1
+};
+
+// The length of each IX and IY instruction in bytes, prefix included, indexed by the opcode after the prefix
+static constexpr std::array<u8, 256> s_ixy_instruction_lengths = {
+    2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2,
+    2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2,
+    2, 4, 4, 2, 2, 2, 3, 2, 2, 2, 4, 2, 2, 2, 3, 2,
+    2, 2, 2, 2, 3, 3, 4, 2, 2, 2, 2, 2, 2, 2, 3, 2,
+    2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2,
+    2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2,
+    2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2,
+    3, 3, 3, 3, 3, 3, 2, 3, 2, 2, 2, 2, 2, 2, 3, 2,
+    2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2,
+    2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2,
+    2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2,
+    2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2
+};
+
+// The mnemonic of each unprefixed instruction, indexed by opcode
+// The operands are placeholders that are filled in from the bytes of the instruction, as
+// described in DecodedInstruction, and nullptr is an opcode that isn't an instruction
+static constexpr std::array<char const*, 256> s_mnemonics = {
+    "NOP", // 00
+    "LD BC,%w1", // 01
+    "LD (BC),A", // 02
+    "INC BC", // 03
+    "INC B", // 04
+    "DEC B", // 05
+    "LD B,%b1", // 06
+    "RLCA", // 07
+    "EX AF,AF'", // 08
+    "ADD HL, BC", // 09
+    "LD A,(BC)", // 0a
+    "DEC BC", // 0b
+    "INC C", // 0c
+    "DEC C", // 0d
+    "LD C,%b1", // 0e
+    "RRCA", // 0f
+    "DJNZ %s1", // 10
+    "LD DE,%w1", // 11
+    "LD (DE),A", // 12
+    "INC DE", // 13
+    "INC D", // 14
+    "DEC D", // 15
+    "LD D,%b1", // 16
+    "RLA", // 17
+    "JR %s1", // 18
+    "ADD HL, DE", // 19
+    "LD A,(DE)", // 1a
+    "DEC D", // 1b
+    "INC E", // 1c
+    "DEC E", // 1d
+    "LD E,%b1", // 1e
+    "RRA", // 1f
+    "JR NZ, %s1", // 20
+    "LD HL,%w1", // 21
+    "LD (%w1),HL", // 22
+    "INC HL", // 23
+    "INC H", // 24
+    "DEC H", // 25
+    "LD H,%b1", // 26
+    "DAA", // 27
+    "JR Z, %s1", // 28
+    "ADD HL, HL", // 29
+    "LD HL,(%w1)", // 2a
+    "DEC HL", // 2b
+    "INC L", // 2c
+    "DEC L", // 2d
+    "LD L,%b1", // 2e
+    "CPL", // 2f
+    "JR NC, %s1", // 30
+    "LD SP,%w1", // 31
+    "LD (%w1),A", // 32
+    "INC SP", // 33
+    "INC (HL)", // 34
+    "DEC (HL)", // 35
+    "LD (HL),%b1", // 36
+    "SCF", // 37
+    "JR C, %s1", // 38
+    "ADD HL, SP", // 39
+    "LD A,(%w1)", // 3a
+    "DEC SP", // 3b
+    "INC A", // 3c
+    "DEC A", // 3d
+    "LD A,%b1", // 3e
+    "CCF", // 3f
+    "LD B,B", // 40
+    "LD B,C", // 41
+    "LD B,D", // 42
+    "LD B,E", // 43
+    "LD B,H", // 44
+    "LD B,L", // 45
+    "LD B,(HL)", // 46
+    "LD B,A", // 47
+    "LD C,B", // 48
+    "LD C,C", // 49
+    "LD C,D", // 4a
+    "LD C,E", // 4b
+    "LD C,H", // 4c
+    "LD C,L", // 4d
+    "LD C,(HL)", // 4e
+    "LD C,A", // 4f
+    "LD D,B", // 50
+    "LD D,C", // 51
+    "LD D,D", // 52
+    "LD D,E", // 53
+    "LD D,H", // 54
+    "LD D,L", // 55
+    "LD D,(HL)", // 56
+    "LD D,A", // 57
+    "LD E,B", // 58
+    "LD E,C", // 59
+    "LD E,D", // 5a
+    "LD E,E", // 5b
+    "LD E,H", // 5c
+    "LD E,L", // 5d
+    "LD E,(HL)", // 5e
+    "LD E,A", // 5f
+    "LD H,B", // 60
+    "LD H,C", // 61
+    "LD H,D", // 62
+    "LD H,E", // 63
+    "LD H,H", // 64
+    "LD H,L", // 65
+    "LD H,(HL)", // 66
+    "LD H,A", // 67
+    "LD L,B", // 68
+    "LD L,C", // 69
+    "LD L,D", // 6a
+    "LD L,E", // 6b
+    "LD L,H", // 6c
+    "LD L,L", // 6d
+    "LD L,(HL)", // 6e
+    "LD L,A", // 6f
+    "LD (HL),B", // 70
+    "LD (HL),C", // 71
+    "LD (HL),D", // 72
+    "LD (HL),E", // 73
+    "LD (HL),H", // 74
+    "LD (HL),L", // 75
+    "HALT", // 76
+    "LD (HL),A", // 77
+    "LD A,B", // 78
+    "LD A,C", // 79
+    "LD A,D", // 7a
+    "LD A,E", // 7b
+    "LD A,H", // 7c
+    "LD A,L", // 7d
+    "LD A,(HL)", // 7e
+    "LD A,A", // 7f
+    "ADD A, B", // 80
+    "ADD A, C", // 81
+    "ADD A, D", // 82
+    "ADD A, E", // 83
+    "ADD A, H", // 84
+    "ADD A, L", // 85
+    "ADD A, (HL)", // 86
+    "ADD A, A", // 87
+    "ADC A, B", // 88
+    "ADC A, C", // 89
+    "ADC A, D", // 8a
+    "ADC A, E", // 8b
+    "ADC A, H", // 8c
+    "ADC A, L", // 8d
+    "ADC A, (HL)", // 8e
+    "ADC A, A", // 8f
+    "SUB B", // 90
+    "SUB C", // 91
+    "SUB D", // 92
+    "SUB E", // 93
+    "SUB H", // 94
+    "SUB L", // 95
+    "SUB (HL)", // 96
+    "SUB A", // 97
+    "SBC A, B", // 98
+    "SBC A, C", // 99
+    "SBC A, D", // 9a
+    "SBC A, E", // 9b
+    "SBC A, H", // 9c
+    "SBC A, L", // 9d
+    "SBC A, (HL)", // 9e
+    "SBC A, A", // 9f
+    "AND B", // a0
+    "AND C", // a1
+    "AND D", // a2
+    "AND E", // a3
+    "AND H", // a4
+    "AND L", // a5
+    "AND (HL)", // a6
+    "AND A", // a7
+    "XOR B", // a8
+    "XOR C", // a9
+    "XOR D", // aa
+    "XOR E", // ab
+    "XOR H", // ac
+    "XOR L", // ad
+    "XOR (HL)", // ae
+    "XOR A", // af
+    "OR B", // b0
+    "OR C", // b1
+    "OR D", // b2
+    "OR E", // b3
+    "OR H", // b4
+    "OR L", // b5
+    "OR (HL)", // b6
+    "OR A", // b7
+    "CP B", // b8
+    "CP C", // b9
+    "CP D", // ba
+    "CP E", // bb
+    "CP H", // bc
+    "CP L", // bd
+    "CP (HL)", // be
+    "CP A", // bf
+    "RET NZ", // c0
+    "POP BC", // c1
+    "JP NZ,%w1", // c2
+    "JP %w1", // c3
+    "CALL NZ, %w1", // c4
+    "PUSH BC", // c5
+    "ADD A, %b1", // c6
+    "RST 0", // c7
+    "RET Z", // c8
+    "RET", // c9
+    "JP Z,%w1", // ca
+    nullptr, // cb, the prefix of the bit instructions
+    "CALL Z, %w1", // cc
+    "CALL %w1", // cd
+    "ADC A, %b1", // ce
+    "RST 1", // cf
+    "RET NZ", // d0
+    "POP DE", // d1
+    "JP NC,%w1", // d2
+    "OUT %b1", // d3
+    "CALL NC, %w1", // d4
+    "PUSH DE", // d5
+    "SUB %b1", // d6
+    "RST 2", // d7
+    "RET C", // d8
+    "EXX", // d9
+    "JP C,%w1", // da
+    "IN A, (%b1)", // db
+    "CALL C, %w1", // dc
+    nullptr, // dd, the prefix of the IX instructions
+    "SBC A, %b1", // de
+    "RST 3", // df
+    "RET PO", // e0
+    "POP HL", // e1
+    "JP PO,%w1", // e2
+    "EX (SP),HL", // e3
+    "CALL PO, %w1", // e4
+    "PUSH HL", // e5
+    "AND %b1", // e6
+    "RST 4", // e7
+    "RET PE", // e8
+    "JP (HL)", // e9
+    "JP PE,%w1", // ea
+    "EX DE,HL", // eb
+    "CALL PE, %w1", // ec
+    nullptr, // ed, the prefix of the extended instructions
+    "XOR %b1", // ee
+    "RST 5", // ef
+    "RET P", // f0
+    "POP AF", // f1
+    "JP P,%w1", // f2
+    "DI", // f3
+    "CALL P, %w1", // f4
+    "PUSH AF", // f5
+    "OR %b1", // f6
+    "RST 6", // f7
+    "RET M", // f8
+    "LD SP,HL", // f9
+    "JP M,%w1", // fa
+    "EI", // fb
+    "CALL M, %w1", // fc
+    nullptr, // fd, the prefix of the IY instructions
+    "CP %b1", // fe
+    "RST 7", // ff
+};
+
+// The mnemonic of each bit instruction, after the CB prefix, indexed by opcode
+static constexpr std::array<char const*, 256> s_bits_mnemonics = {
+    "RLC B", // 00
+    "RLC C", // 01
+    "RLC D", // 02
+    "RLC E", // 03
+    "RLC H", // 04
+    "RLC L", // 05
+    "RLC (HL)", // 06
+    "RLC A", // 07
+    "RLC B", // 08
+    "RLC C", // 09
+    "RLC D", // 0a
+    "RLC E", // 0b
+    "RLC H", // 0c
+    "RLC L", // 0d
+    "RLC (HL)", // 0e
+    "RLC A", // 0f
+    "RL B", // 10
+    "RL C", // 11
+    "RL D", // 12
+    "RL E", // 13
+    "RL H", // 14
+    "RL L", // 15
+    "RL (HL)", // 16
+    "RL A", // 17
+    "RR B", // 18
+    "RR C", // 19
+    "RR D", // 1a
+    "RR E", // 1b
+    "RR H", // 1c
+    "RR L", // 1d
+    "RR (HL)", // 1e
+    "RR A", // 1f
+    "SLA B", // 20
+    "SLA C", // 21
+    "SLA D", // 22
+    "SLA E", // 23
+    "SLA H", // 24
+    "SLA L", // 25
+    "SLA (HL)", // 26
+    "SLA A", // 27
+    "SRA B", // 28
+    "SRA C", // 29
+    "SRA D", // 2a
+    "SRA E", // 2b
+    "SRA H", // 2c
+    "SRA L", // 2d
+    "SRA (HL)", // 2e
+    "SRA A", // 2f
+    "SLL B", // 30
+    "SLL C", // 31
+    "SLL D", // 32
+    "SLL E", // 33
+    "SLL H", // 34
+    "SLL L", // 35
+    "SLL (HL)", // 36
+    "SLL A", // 37
+    "SRL B", // 38
+    "SRL C", // 39
+    "SRL D", // 3a
+    "SRL E", // 3b
+    "SRL H", // 3c
+    "SRL L", // 3d
+    "SRL (HL)", // 3e
+    "SRL A", // 3f
+    "BIT 0, B", // 40
+    "BIT 0, C", // 41
+    "BIT 0, D", // 42
+    "BIT 0, E", // 43
+    "BIT 0, H", // 44
+    "BIT 0, L", // 45
+    "BIT 0, (HL)", // 46
+    "BIT 0, A", // 47
+    "BIT 1, B", // 48
+    "BIT 1, C", // 49
+    "BIT 1, D", // 4a
+    "BIT 1, E", // 4b
+    "BIT 1, H", // 4c
+    "BIT 1, L", // 4d
+    "BIT 1, (HL)", // 4e
+    "BIT 1, A", // 4f
+    "BIT 2, B", // 50
+    "BIT 2, C", // 51
+    "BIT 2, D", // 52
+    "BIT 2, E", // 53
+    "BIT 2, H", // 54
+    "BIT 2, L", // 55
+    "BIT 2, (HL)", // 56
+    "BIT 2, A", // 57
+    "BIT 3, B", // 58
+    "BIT 3, C", // 59
+    "BIT 3, D", // 5a
+    "BIT 3, E", // 5b
+    "BIT 3, H", // 5c
+    "BIT 3, L", // 5d
+    "BIT 3, (HL)", // 5e
+    "BIT 3, A", // 5f
+    "BIT 4, B", // 60
+    "BIT 4, C", // 61
+    "BIT 4, D", // 62
+    "BIT 4, E", // 63
+    "BIT 4, H", // 64
+    "BIT 4, L", // 65
+    "BIT 4, (HL)", // 66
+    "BIT 4, A", // 67
+    "BIT 5, B", // 68
+    "BIT 5, C", // 69
+    "BIT 5, D", // 6a
+    "BIT 5, E", // 6b
+    "BIT 5, H", // 6c
+    "BIT 5, L", // 6d
+    "BIT 5, (HL)", // 6e
+    "BIT 5, A", // 6f
+    "BIT 6, B", // 70
+    "BIT 6, C", // 71
+    "BIT 6, D", // 72
+    "BIT 6, E", // 73
+    "BIT 6, H", // 74
+    "BIT 6, L", // 75
+    "BIT 6, (HL)", // 76
+    "BIT 6, A", // 77
+    "BIT 7, B", // 78
+    "BIT 7, C", // 79
+    "BIT 7, D", // 7a
+    "BIT 7, E", // 7b
+    "BIT 7, H", // 7c
+    "BIT 7, L", // 7d
+    "BIT 7, (HL)", // 7e
+    "BIT 7, A", // 7f
+    "RES 0, B", // 80
+    "RES 0, C", // 81
+    "RES 0, D", // 82
+    "RES 0, E", // 83
+    "RES 0, H", // 84
+    "RES 0, L", // 85
+    "RES 0, (HL)", // 86
+    "RES 0, A", // 87
+    "RES 1, B", // 88
+    "RES 1, C", // 89
+    "RES 1, D", // 8a
+    "RES 1, E", // 8b
+    "RES 1, H", // 8c
+    "RES 1, L", // 8d
+    "RES 1, (HL)", // 8e
+    "RES 1, A", // 8f
+    "RES 2, B", // 90
+    "RES 2, C", // 91
+    "RES 2, D", // 92
+    "RES 2, E", // 93
+    "RES 2, H", // 94
+    "RES 2, L", // 95
+    "RES 2, (HL)", // 96
+    "RES 2, A", // 97
+    "RES 3, B", // 98
+    "RES 3, C", // 99
+    "RES 3, D", // 9a
+    "RES 3, E", // 9b
+    "RES 3, H", // 9c
+    "RES 3, L", // 9d
+    "RES 3, (HL)", // 9e
+    "RES 3, A", // 9f
+    "RES 4, B", // a0
+    "RES 4, C", // a1
+    "RES 4, D", // a2
+    "RES 4, E", // a3
+    "RES 4, H", // a4
+    "RES 4, L", // a5
+    "RES 4, (HL)", // a6
+    "RES 4, A", // a7
+    "RES 5, B", // a8
+    "RES 5, C", // a9
+    "RES 5, D", // aa
+    "RES 5, E", // ab
+    "RES 5, H", // ac
+    "RES 5, L", // ad
+    "RES 5, (HL)", // ae
+    "RES 5, A", // af
+    "RES 6, B", // b0
+    "RES 6, C", // b1
+    "RES 6, D", // b2
+    "RES 6, E", // b3
+    "RES 6, H", // b4
+    "RES 6, L", // b5
+    "RES 6, (HL)", // b6
+    "RES 6, A", // b7
+    "RES 7, B", // b8
+    "RES 7, C", // b9
+    "RES 7, D", // ba
+    "RES 7, E", // bb
+    "RES 7, H", // bc
+    "RES 7, L", // bd
+    "RES 7, (HL)", // be
+    "RES 7, A", // bf
+    "SET 0, B", // c0
+    "SET 0, C", // c1
+    "SET 0, D", // c2
+    "SET 0, E", // c3
+    "SET 0, H", // c4
+    "SET 0, L", // c5
+    "SET 0, (HL)", // c6
+    "SET 0, A", // c7
+    "SET 1, B", // c8
+    "SET 1, C", // c9
+    "SET 1, D", // ca
+    "SET 1, E", // cb
+    "SET 1, H", // cc
+    "SET 1, L", // cd
+    "SET 1, (HL)", // ce
+    "SET 1, A", // cf
+    "SET 2, B", // d0
+    "SET 2, C", // d1
+    "SET 2, D", // d2
+    "SET 2, E", // d3
+    "SET 2, H", // d4
+    "SET 2, L", // d5
+    "SET 2, (HL)", // d6
+    "SET 2, A", // d7
+    "SET 3, B", // d8
+    "SET 3, C", // d9
+    "SET 3, D", // da
+    "SET 3, E", // db
+    "SET 3, H", // dc
+    "SET 3, L", // dd
+    "SET 3, (HL)", // de
+    "SET 3, A", // df
+    "SET 4, B", // e0
+    "SET 4, C", // e1
+    "SET 4, D", // e2
+    "SET 4, E", // e3
+    "SET 4, H", // e4
+    "SET 4, L", // e5
+    "SET 4, (HL)", // e6
+    "SET 4, A", // e7
+    "SET 5, B", // e8
+    "SET 5, C", // e9
+    "SET 5, D", // ea
+    "SET 5, E", // eb
+    "SET 5, H", // ec
+    "SET 5, L", // ed
+    "SET 5, (HL)", // ee
+    "SET 5, A", // ef
+    "SET 6, B", // f0
+    "SET 6, C", // f1
+    "SET 6, D", // f2
+    "SET 6, E", // f3
+    "SET 6, H", // f4
+    "SET 6, L", // f5
+    "SET 6, (HL)", // f6
+    "SET 6, A", // f7
+    "SET 7, B", // f8
+    "SET 7, C", // f9
+    "SET 7, D", // fa
+    "SET 7, E", // fb
+    "SET 7, H", // fc
+    "SET 7, L", // fd
+    "SET 7, (HL)", // fe
+    "SET 7, A", // ff
+};
+
+// The mnemonic of each IX instruction, after the DD prefix, indexed by opcode
+static constexpr std::array<char const*, 256> s_ix_mnemonics = {
+    "0x00 (data)", // 00
+    "0x01 (data)", // 01
+    "0x02 (data)", // 02
+    "0x03 (data)", // 03
+    "INC B*", // 04
+    "DEC B*", // 05
+    "LD B,%b2*", // 06
+    "0x07 (data)", // 07
+    "0x08 (data)", // 08
+    "ADD IX, BC", // 09
+    "0x0a (data)", // 0a
+    "0x0b (data)", // 0b
+    "INC C*", // 0c
+    "DEC C*", // 0d
+    "LD C,%b2*", // 0e
+    "0x0f (data)", // 0f
+    "0x10 (data)", // 10
+    "0x11 (data)", // 11
+    "0x12 (data)", // 12
+    "0x13 (data)", // 13
+    "INC D*", // 14
+    "DEC D*", // 15
+    "LD D,%b2*", // 16
+    "0x17 (data)", // 17
+    "0x18 (data)", // 18
+    "ADD IX, DE", // 19
+    "0x1a (data)", // 1a
+    "0x1b (data)", // 1b
+    "INC E*", // 1c
+    "DEC E*", // 1d
+    "LD E,%b2*", // 1e
+    "0x1f (data)", // 1f
+    "0x20 (data)", // 20
+    "LD IX,%w2", // 21
+    "LD (%w2),IX", // 22
+    "INC IX", // 23
+    "INC IXH*", // 24
+    "DEC IXH*", // 25
+    "LD IXH,%b2*", // 26
+    "0x27 (data)", // 27
+    "0x28 (data)", // 28
+    "ADD IX, IX", // 29
+    "LD IX,(%w2)", // 2a
+    "DEC IX", // 2b
+    "INC IXL*", // 2c
+    "DEC IXL*", // 2d
+    "LD IXL,%b2*", // 2e
+    "0x2f (data)", // 2f
+    "0x30 (data)", // 30
+    "0x31 (data)", // 31
+    "0x32 (data)", // 32
+    "0x33 (data)", // 33
+    "INC (IX%d2)", // 34
+    "DEC (IX%d2)", // 35
+    "LD (IX%d2),%b3", // 36
+    "0x37 (data)", // 37
+    "0x38 (data)", // 38
+    "ADD IX, SP", // 39
+    "0x3a (data)", // 3a
+    "0x3b (data)", // 3b
+    "INC A*", // 3c
+    "DEC A*", // 3d
+    "LD A,%b2*", // 3e
+    "0x3f (data)", // 3f
+    "LD B,B*", // 40
+    "LD B,C*", // 41
+    "LD B,D*", // 42
+    "LD B,E*", // 43
+    "LD B,IXH*", // 44
+    "LD B,IXL*", // 45
+    "LD B,(IX%d2)", // 46
+    "LD B,A*", // 47
+    "LD C,B*", // 48
+    "LD C,C*", // 49
+    "LD C,D*", // 4a
+    "LD C,E*", // 4b
+    "LD C,IXH*", // 4c
+    "LD C,IXL*", // 4d
+    "LD C,(IX%d2)", // 4e
+    "LD C,A*", // 4f
+    "LD D,B*", // 50
+    "LD D,C*", // 51
+    "LD D,D*", // 52
+    "LD D,E*", // 53
+    "LD D,IXH*", // 54
+    "LD D,IXL*", // 55
+    "LD D,(IX%d2)", // 56
+    "LD D,A*", // 57
+    "LD E,B*", // 58
+    "LD E,C*", // 59
+    "LD E,D*", // 5a
+    "LD E,E*", // 5b
+    "LD E,IXH*", // 5c
+    "LD E,IXL*", // 5d
+    "LD E,(IX%d2)", // 5e
+    "LD E,A*", // 5f
+    "LD IXH,B*", // 60
+    "LD IXH,C*", // 61
+    "LD IXH,D*", // 62
+    "LD IXH,E*", // 63
+    "LD IXH,IXH*", // 64
+    "LD IXH,IXL*", // 65
+    "LD H,(IX%d2)", // 66
+    "LD IXH,A*", // 67
+    "LD IXL,B*", // 68
+    "LD IXL,C*", // 69
+    "LD IXL,D*", // 6a
+    "LD IXL,E*", // 6b
+    "LD IXL,IXH*", // 6c
+    "LD IXL,IXL*", // 6d
+    "LD L,(IX%d2)", // 6e
+    "LD IXL,A*", // 6f
+    "LD (IX%d2),B", // 70
+    "LD (IX%d2),C", // 71
+    "LD (IX%d2),D", // 72
+    "LD (IX%d2),E", // 73
+    "LD (IX%d2),H", // 74
+    "LD (IX%d2),L", // 75
+    "0x76 (data)", // 76
+    "LD (IX%d2),A", // 77
+    "LD A,B*", // 78
+    "LD A,C*", // 79
+    "LD A,D*", // 7a
+    "LD A,E*", // 7b
+    "LD A,IXH*", // 7c
+    "LD A,IXL*", // 7d
+    "LD A,(IX%d2)", // 7e
+    "LD A,A*", // 7f
+    "ADD A, B*", // 80
+    "ADD A, C*", // 81
+    "ADD A, D*", // 82
+    "ADD A, E*", // 83
+    "ADD A, IXH", // 84
+    "ADD A, IXL", // 85
+    "ADD A,(IX%d2)", // 86
+    "ADD A, A*", // 87
+    "ADC A, B*", // 88
+    "ADC A, C*", // 89
+    "ADC A, D*", // 8a
+    "ADC A, E*", // 8b
+    "ADC A, IXH*", // 8c
+    "ADC A, IXL", // 8d
+    "ADC A,(IX%d2)", // 8e
+    "ADC A, A*", // 8f
+    "SUB B*", // 90
+    "SUB C*", // 91
+    "SUB D*", // 92
+    "SUB E*", // 93
+    "SUB IXH", // 94
+    "SUB IXL", // 95
+    "SUB (IX%d2)", // 96
+    "SUB E*", // 97
+    "SBC A, B*", // 98
+    "SBC A, C*", // 99
+    "SBC A, D*", // 9a
+    "SBC A, E*", // 9b
+    "SBC A, IXH", // 9c
+    "SBC A, IXL", // 9d
+    "SBC A,(IX%d2)", // 9e
+    "SBC A, A*", // 9f
+    "AND B*", // a0
+    "AND C*", // a1
+    "AND D*", // a2
+    "AND E*", // a3
+    "AND IXH", // a4
+    "AND IXL", // a5
+    "AND (IX%d2)", // a6
+    "AND A*", // a7
+    "XOR B*", // a8
+    "XOR C*", // a9
+    "XOR D*", // aa
+    "XOR E*", // ab
+    "XOR IXH", // ac
+    "XOR IXL", // ad
+    "XOR (IX%d2)", // ae
+    "XOR A*", // af
+    "OR B*", // b0
+    "OR C*", // b1
+    "OR D*", // b2
+    "OR E*", // b3
+    "OR IXH", // b4
+    "OR IXL", // b5
+    "OR (IX%d2)", // b6
+    "OR A*", // b7
+    "CP B*", // b8
+    "CP C*", // b9
+    "CP D*", // ba
+    "CP E*", // bb
+    "CP IXH", // bc
+    "CP IXL", // bd
+    "CP (IX%d2)", // be
+    "CP A*", // bf
+    "0xc0 (data)", // c0
+    "0xc1 (data)", // c1
+    "0xc2 (data)", // c2
+    "0xc3 (data)", // c3
+    "0xc4 (data)", // c4
+    "0xc5 (data)", // c5
+    "0xc6 (data)", // c6
+    "0xc7 (data)", // c7
+    "0xc8 (data)", // c8
+    "0xc9 (data)", // c9
+    "0xca (data)", // ca
+    nullptr, // cb, the prefix of the IX bit instructions
+    "0xcc (data)", // cc
+    "0xcd (data)", // cd
+    "0xce (data)", // ce
+    "0xcf (data)", // cf
+    "0xd0 (data)", // d0
+    "0xd1 (data)", // d1
+    "0xd2 (data)", // d2
+    "0xd3 (data)", // d3
+    "0xd4 (data)", // d4
+    "0xd5 (data)", // d5
+    "0xd6 (data)", // d6
+    "0xd7 (data)", // d7
+    "0xd8 (data)", // d8
+    "0xd9 (data)", // d9
+    "0xda (data)", // da
+    "0xdb (data)", // db
+    "0xdc (data)", // dc
+    "0xdd (data)", // dd
+    "0xde (data)", // de
+    "0xdf (data)", // df
+    "0xe0 (data)", // e0
+    "POP IX", // e1
+    "0xe2 (data)", // e2
+    "EX (SP),IX", // e3
+    "0xe4 (data)", // e4
+    "PUSH IX", // e5
+    "0xe6 (data)", // e6
+    "0xe7 (data)", // e7
+    "0xe8 (data)", // e8
+    "JP (IX)", // e9
+    "0xea (data)", // ea
+    "0xeb (data)", // eb
+    "0xec (data)", // ec
+    "0xed (data)", // ed
+    "0xee (data)", // ee
+    "0xef (data)", // ef
+    "0xf0 (data)", // f0
+    "0xf1 (data)", // f1
+    "0xf2 (data)", // f2
+    "0xf3 (data)", // f3
+    "0xf4 (data)", // f4
+    "0xf5 (data)", // f5
+    "0xf6 (data)", // f6
+    "0xf7 (data)", // f7
+    "0xf8 (data)", // f8
+    "LD SP,IX", // f9
+    "0xfa (data)", // fa
+    "0xfb (data)", // fb
+    "0xfc (data)", // fc
+    "0xfd (data)", // fd
+    "0xfe (data)", // fe
+    "0xff (data)", // ff
+};
+
+// The mnemonic of each extended instruction, after the ED prefix, indexed by opcode
+static constexpr std::array<char const*, 256> s_extd_mnemonics = {
+    "0x00 (data)", // 00
+    "0x01 (data)", // 01
+    "0x02 (data)", // 02
+    "0x03 (data)", // 03
+    "0x04 (data)", // 04
+    "0x05 (data)", // 05
+    "0x06 (data)", // 06
+    "0x07 (data)", // 07
+    "0x08 (data)", // 08
+    "0x09 (data)", // 09
+    "0x0a (data)", // 0a
+    "0x0b (data)", // 0b
+    "0x0c (data)", // 0c
+    "0x0d (data)", // 0d
+    "0x0e (data)", // 0e
+    "0x0f (data)", // 0f
+    "0x10 (data)", // 10
+    "0x11 (data)", // 11
+    "0x12 (data)", // 12
+    "0x13 (data)", // 13
+    "0x14 (data)", // 14
+    "0x15 (data)", // 15
+    "0x16 (data)", // 16
+    "0x17 (data)", // 17
+    "0x18 (data)", // 18
+    "0x19 (data)", // 19
+    "0x1a (data)", // 1a
+    "0x1b (data)", // 1b
+    "0x1c (data)", // 1c
+    "0x1d (data)", // 1d
+    "0x1e (data)", // 1e
+    "0x1f (data)", // 1f
+    "0x20 (data)", // 20
+    "0x21 (data)", // 21
+    "0x22 (data)", // 22
+    "0x23 (data)", // 23
+    "0x24 (data)", // 24
+    "0x25 (data)", // 25
+    "0x26 (data)", // 26
+    "0x27 (data)", // 27
+    "0x28 (data)", // 28
+    "0x29 (data)", // 29
+    "0x2a (data)", // 2a
+    "0x2b (data)", // 2b
+    "0x2c (data)", // 2c
+    "0x2d (data)", // 2d
+    "0x2e (data)", // 2e
+    "0x2f (data)", // 2f
+    "0x30 (data)", // 30
+    "0x31 (data)", // 31
+    "0x32 (data)", // 32
+    "0x33 (data)", // 33
+    "0x34 (data)", // 34
+    "0x35 (data)", // 35
+    "0x36 (data)", // 36
+    "0x37 (data)", // 37
+    "0x38 (data)", // 38
+    "0x39 (data)", // 39
+    "0x3a (data)", // 3a
+    "0x3b (data)", // 3b
+    "0x3c (data)", // 3c
+    "0x3d (data)", // 3d
+    "0x3e (data)", // 3e
+    "0x3f (data)", // 3f
+    "IN B, (C)", // 40
+    "OUT (C),B", // 41
+    "SBC HL, BC", // 42
+    "LD (%w2),BC", // 43
+    "NEG", // 44
+    "RETN", // 45
+    "IM 0", // 46
+    "LD I,A", // 47
+    "IN C, (C)", // 48
+    "OUT (C),C", // 49
+    "ADC HL, BC", // 4a
+    "LD BC,(%w2)", // 4b
+    "NEG", // 4c
+    "RETI", // 4d
+    "IM 0", // 4e
+    "LD R,A", // 4f
+    "IN D, (C)", // 50
+    "OUT (C),D", // 51
+    "SBC HL, DE", // 52
+    "LD (%w2),DE", // 53
+    "NEG", // 54
+    "0x55 (data)", // 55
+    "IM 1", // 56
+    "LD A,I", // 57
+    "IN E, (C)", // 58
+    "OUT (C),E", // 59
+    "ADC HL, DE", // 5a
+    "LD DE,,(%w2)", // 5b
+    "NEG", // 5c
+    "0x5d (data)", // 5d
+    "IM 2", // 5e
+    "LD A,R", // 5f
+    "IN H, (C)", // 60
+    "OUT (C),H", // 61
+    "SBC HL, HL", // 62
+    "LD (%w2),HL*", // 63
+    "NEG", // 64
+    "0x65 (data)", // 65
+    "IM 0", // 66
+    "RRD", // 67
+    "IN L, (C)", // 68
+    "OUT (C),L", // 69
+    "ADC HL, HL", // 6a
+    "LD HL,,(%w2)*", // 6b
+    "NEG", // 6c
+    "0x6d (data)", // 6d
+    "0x6e (data)", // 6e
+    "RLD", // 6f
+    "IN (C)*", // 70
+    "OUT (C),0*", // 71
+    "SBC HL, SP", // 72
+    "LD (%w2),SP", // 73
+    "NEG", // 74
+    "0x75 (data)", // 75
+    "IM 1", // 76
+    "0x77 (data)", // 77
+    "IN A, (C)", // 78
+    "OUT (C),A", // 79
+    "ADC HL, SP", // 7a
+    "LD SP,(%w2)", // 7b
+    "NEG", // 7c
+    "0x7d (data)", // 7d
+    "IM 2", // 7e
+    "0x7f (data)", // 7f
+    "0x80 (data)", // 80
+    "0x81 (data)", // 81
+    "0x82 (data)", // 82
+    "0x83 (data)", // 83
+    "0x84 (data)", // 84
+    "0x85 (data)", // 85
+    "0x86 (data)", // 86
+    "0x87 (data)", // 87
+    "0x88 (data)", // 88
+    "0x89 (data)", // 89
+    "0x8a (data)", // 8a
+    "0x8b (data)", // 8b
+    "0x8c (data)", // 8c
+    "0x8d (data)", // 8d
+    "0x8e (data)", // 8e
+    "0x8f (data)", // 8f
+    "0x90 (data)", // 90
+    "0x91 (data)", // 91
+    "0x92 (data)", // 92
+    "0x93 (data)", // 93
+    "0x94 (data)", // 94
+    "0x95 (data)", // 95
+    "0x96 (data)", // 96
+    "0x97 (data)", // 97
+    "0x98 (data)", // 98
+    "0x99 (data)", // 99
+    "0x9a (data)", // 9a
+    "0x9b (data)", // 9b
+    "0x9c (data)", // 9c
+    "0x9d (data)", // 9d
+    "0x9e (data)", // 9e
+    "0x9f (data)", // 9f
+    "LDI", // a0
+    "CPI", // a1
+    "INI", // a2
+    "OUTI", // a3
+    "0xa4 (data)", // a4
+    "0xa5 (data)", // a5
+    "0xa6 (data)", // a6
+    "0xa7 (data)", // a7
+    "LDD", // a8
+    "CPD", // a9
+    "IND", // aa
+    "OUTD", // ab
+    "0xac (data)", // ac
+    "0xad (data)", // ad
+    "0xae (data)", // ae
+    "0xaf (data)", // af
+    "LDIR", // b0
+    "CPIR", // b1
+    "INIR", // b2
+    "OTIR", // b3
+    "0xb4 (data)", // b4
+    "0xb5 (data)", // b5
+    "0xb6 (data)", // b6
+    "0xb7 (data)", // b7
+    "LDDR", // b8
+    "CPDR", // b9
+    "INDR", // ba
+    "OTDR", // bb
+    "0xbc (data)", // bc
+    "0xbd (data)", // bd
+    "0xbe (data)", // be
+    "0xbf (data)", // bf
+    "0xc0 (data)", // c0
+    "0xc1 (data)", // c1
+    "0xc2 (data)", // c2
+    "0xc3 (data)", // c3
+    "0xc4 (data)", // c4
+    "0xc5 (data)", // c5
+    "0xc6 (data)", // c6
+    "0xc7 (data)", // c7
+    "0xc8 (data)", // c8
+    "0xc9 (data)", // c9
+    "0xca (data)", // ca
+    "0xcb (data)", // cb
+    "0xcc (data)", // cc
+    "0xcd (data)", // cd
+    "0xce (data)", // ce
+    "0xcf (data)", // cf
+    "0xd0 (data)", // d0
+    "0xd1 (data)", // d1
+    "0xd2 (data)", // d2
+    "0xd3 (data)", // d3
+    "0xd4 (data)", // d4
+    "0xd5 (data)", // d5
+    "0xd6 (data)", // d6
+    "0xd7 (data)", // d7
+    "0xd8 (data)", // d8
+    "0xd9 (data)", // d9
+    "0xda (data)", // da
+    "0xdb (data)", // db
+    "0xdc (data)", // dc
+    "0xdd (data)", // dd
+    "0xde (data)", // de
+    "0xdf (data)", // df
+    "0xe0 (data)", // e0
+    "0xe1 (data)", // e1
+    "0xe2 (data)", // e2
+    "0xe3 (data)", // e3
+    "0xe4 (data)", // e4
+    "0xe5 (data)", // e5
+    "0xe6 (data)", // e6
+    "0xe7 (data)", // e7
+    "0xe8 (data)", // e8
+    "0xe9 (data)", // e9
+    "0xea (data)", // ea
+    "0xeb (data)", // eb
+    "0xec (data)", // ec
+    "0xed (data)", // ed
+    "0xee (data)", // ee
+    "0xef (data)", // ef
+    "0xf0 (data)", // f0
+    "0xf1 (data)", // f1
+    "0xf2 (data)", // f2
+    "0xf3 (data)", // f3
+    "0xf4 (data)", // f4
+    "0xf5 (data)", // f5
+    "0xf6 (data)", // f6
+    "0xf7 (data)", // f7
+    "0xf8 (data)", // f8
+    "0xf9 (data)", // f9
+    "0xfa (data)", // fa
+    "0xfb (data)", // fb
+    "0xfc (data)", // fc
+    "0xfd (data)", // fd
+    "0xfe (data)", // fe
+    "0xff (data)", // ff
+};
+
+// The mnemonic of each IY instruction, after the FD prefix, indexed by opcode
+static constexpr std::array<char const*, 256> s_iy_mnemonics = {
+    "0x00 (data)", // 00
+    "0x01 (data)", // 01
+    "0x02 (data)", // 02
+    "0x03 (data)", // 03
+    "INC B*", // 04
+    "DEC B*", // 05
+    "LD B,%b2*", // 06
+    "0x07 (data)", // 07
+    "0x08 (data)", // 08
+    "ADD IY, BC", // 09
+    "0x0a (data)", // 0a
+    "0x0b (data)", // 0b
+    "INC C*", // 0c
+    "DEC C*", // 0d
+    "LD C,%b2*", // 0e
+    "0x0f (data)", // 0f
+    "0x10 (data)", // 10
+    "0x11 (data)", // 11
+    "0x12 (data)", // 12
+    "0x13 (data)", // 13
+    "INC D*", // 14
+    "DEC D*", // 15
+    "LD D,%b2*", // 16
+    "0x17 (data)", // 17
+    "0x18 (data)", // 18
+    "ADD IY, DE", // 19
+    "0x1a (data)", // 1a
+    "0x1b (data)", // 1b
+    "INC E*", // 1c
+    "DEC E*", // 1d
+    "LD E,%b2*", // 1e
+    "0x1f (data)", // 1f
+    "0x20 (data)", // 20
+    "LD IY,%w2", // 21
+    "LD (%w2),IY", // 22
+    "INC IY", // 23
+    "INC IYH*", // 24
+    "DEC IYH*", // 25
+    "LD IYH,%b2*", // 26
+    "0x27 (data)", // 27
+    "0x28 (data)", // 28
+    "ADD IY, IY", // 29
+    "LD IY,(%w2)", // 2a
+    "DEC IY", // 2b
+    "INC IYL*", // 2c
+    "DEC IYL*", // 2d
+    "LD IYL,%b2*", // 2e
+    "0x2f (data)", // 2f
+    "0x30 (data)", // 30
+    "0x31 (data)", // 31
+    "0x32 (data)", // 32
+    "0x33 (data)", // 33
+    "INC (IY%d2)", // 34
+    "DEC (IY%d2)", // 35
+    "LD (IY%d2),%b3", // 36
+    "0x37 (data)", // 37
+    "0x38 (data)", // 38
+    "ADD IY, SP", // 39
+    "0x3a (data)", // 3a
+    "0x3b (data)", // 3b
+    "INC A*", // 3c
+    "DEC A*", // 3d
+    "LD A,%b2*", // 3e
+    "0x3f (data)", // 3f
+    "LD B,B*", // 40
+    "LD B,C*", // 41
+    "LD B,D*", // 42
+    "LD B,E*", // 43
+    "LD B,IYH*", // 44
+    "LD B,IYL*", // 45
+    "LD B,(IY%d2)", // 46
+    "LD B,A*", // 47
+    "LD C,B*", // 48
+    "LD C,C*", // 49
+    "LD C,D*", // 4a
+    "LD C,E*", // 4b
+    "LD C,IYH*", // 4c
+    "LD C,IYL*", // 4d
+    "LD C,(IY%d2)", // 4e
+    "LD C,A*", // 4f
+    "LD D,B*", // 50
+    "LD D,C*", // 51
+    "LD D,D*", // 52
+    "LD D,E*", // 53
+    "LD D,IYH*", // 54
+    "LD D,IYL*", // 55
+    "LD D,(IY%d2)", // 56
+    "LD D,A*", // 57
+    "LD E,B*", // 58
+    "LD E,C*", // 59
+    "LD E,D*", // 5a
+    "LD E,E*", // 5b
+    "LD E,IYH*", // 5c
+    "LD E,IYL*", // 5d
+    "LD E,(IY%d2)", // 5e
+    "LD E,A*", // 5f
+    "LD IYH,B*", // 60
+    "LD IYH,C*", // 61
+    "LD IYH,D*", // 62
+    "LD IYH,E*", // 63
+    "LD IYH,IYH*", // 64
+    "LD IYH,IYL*", // 65
+    "LD H,(IY%d2)", // 66
+    "LD IYH,A*", // 67
+    "LD IYL,B*", // 68
+    "LD IYL,C*", // 69
+    "LD IYL,D*", // 6a
+    "LD IYL,E*", // 6b
+    "LD IYL,IYH*", // 6c
+    "LD IYL,IYL*", // 6d
+    "LD L,(IY%d2)", // 6e
+    "LD IYL,A*", // 6f
+    "LD (IY%d2),B", // 70
+    "LD (IY%d2),C", // 71
+    "LD (IY%d2),D", // 72
+    "LD (IY%d2),E", // 73
+    "LD (IY%d2),H", // 74
+    "LD (IY%d2),L", // 75
+    "0x76 (data)", // 76
+    "LD (IY%d2),A", // 77
+    "LD A,B*", // 78
+    "LD A,C*", // 79
+    "LD A,D*", // 7a
+    "LD A,E*", // 7b
+    "LD A,IYH*", // 7c
+    "LD A,IYL*", // 7d
+    "LD A,(IY%d2)", // 7e
+    "LD A,A*", // 7f
+    "ADD A, B*", // 80
+    "ADD A, C*", // 81
+    "ADD A, D*", // 82
+    "ADD A, E*", // 83
+    "ADD A, IYH", // 84
+    "ADD A, IYL", // 85
+    "ADD A,(IY%d2)", // 86
+    "ADD A, A*", // 87
+    "ADC A, B*", // 88
+    "ADC A, C*", // 89
+    "ADC A, D*", // 8a
+    "ADC A, E*", // 8b
+    "ADC A, IYH*", // 8c
+    "ADC A, IYL", // 8d
+    "ADC A,(IY%d2)", // 8e
+    "ADC A, A*", // 8f
+    "SUB B*", // 90
+    "SUB C*", // 91
+    "SUB D*", // 92
+    "SUB E*", // 93
+    "SUB IYH", // 94
+    "SUB IYL", // 95
+    "SUB (IY%d2)", // 96
+    "SUB E*", // 97
+    "SBC A, B*", // 98
+    "SBC A, C*", // 99
+    "SBC A, D*", // 9a
+    "SBC A, E*", // 9b
+    "SBC A, IYH", // 9c
+    "SBC A, IYL", // 9d
+    "SBC A,(IY%d2)", // 9e
+    "SBC A, A*", // 9f
+    "AND B*", // a0
+    "AND C*", // a1
+    "AND D*", // a2
+    "AND E*", // a3
+    "AND IYH", // a4
+    "AND IYL", // a5
+    "AND (IY%d2)", // a6
+    "AND A*", // a7
+    "XOR B*", // a8
+    "XOR C*", // a9
+    "XOR D*", // aa
+    "XOR E*", // ab
+    "XOR IYH", // ac
+    "XOR IYL", // ad
+    "XOR (IY%d2)", // ae
+    "XOR A*", // af
+    "OR B*", // b0
+    "OR C*", // b1
+    "OR D*", // b2
+    "OR E*", // b3
+    "OR IYH", // b4
+    "OR IYL", // b5
+    "OR (IY%d2)", // b6
+    "OR A*", // b7
+    "CP B*", // b8
+    "CP C*", // b9
+    "CP D*", // ba
+    "CP E*", // bb
+    "CP IYH", // bc
+    "CP IYL", // bd
+    "CP (IY%d2)", // be
+    "CP A*", // bf
+    "0xc0 (data)", // c0
+    "0xc1 (data)", // c1
+    "0xc2 (data)", // c2
+    "0xc3 (data)", // c3
+    "0xc4 (data)", // c4
+    "0xc5 (data)", // c5
+    "0xc6 (data)", // c6
+    "0xc7 (data)", // c7
+    "0xc8 (data)", // c8
+    "0xc9 (data)", // c9
+    "0xca (data)", // ca
+    nullptr, // cb, the prefix of the IY bit instructions
+    "0xcc (data)", // cc
+    "0xcd (data)", // cd
+    "0xce (data)", // ce
+    "0xcf (data)", // cf
+    "0xd0 (data)", // d0
+    "0xd1 (data)", // d1
+    "0xd2 (data)", // d2
+    "0xd3 (data)", // d3
+    "0xd4 (data)", // d4
+    "0xd5 (data)", // d5
+    "0xd6 (data)", // d6
+    "0xd7 (data)", // d7
+    "0xd8 (data)", // d8
+    "0xd9 (data)", // d9
+    "0xda (data)", // da
+    "0xdb (data)", // db
+    "0xdc (data)", // dc
+    "0xdd (data)", // dd
+    "0xde (data)", // de
+    "0xdf (data)", // df
+    "0xe0 (data)", // e0
+    "POP IY", // e1
+    "0xe2 (data)", // e2
+    "EX (SP),IY", // e3
+    "0xe4 (data)", // e4
+    "PUSH IY", // e5
+    "0xe6 (data)", // e6
+    "0xe7 (data)", // e7
+    "0xe8 (data)", // e8
+    "JP (IY)", // e9
+    "0xea (data)", // ea
+    "0xeb (data)", // eb
+    "0xec (data)", // ec
+    "0xed (data)", // ed
+    "0xee (data)", // ee
+    "0xef (data)", // ef
+    "0xf0 (data)", // f0
+    "0xf1 (data)", // f1
+    "0xf2 (data)", // f2
+    "0xf3 (data)", // f3
+    "0xf4 (data)", // f4
+    "0xf5 (data)", // f5
+    "0xf6 (data)", // f6
+    "0xf7 (data)", // f7
+    "0xf8 (data)", // f8
+    "LD SP,IY", // f9
+    "0xfa (data)", // fa
+    "0xfb (data)", // fb
+    "0xfc (data)", // fc
+    "0xfd (data)", // fd
+    "0xfe (data)", // fe
+    "0xff (data)", // ff
+};
+
+// The mnemonic of each IX bit instruction, after the DD CB prefix and the displacement, indexed by opcode
+static constexpr std::array<char const*, 256> s_ix_bits_mnemonics = {
+    "RLC (IX%d2),B", // 00
+    "RLC (IX%d2),C", // 01
+    "RLC (IX%d2),D", // 02
+    "RLC (IX%d2),E", // 03
+    "RLC (IX%d2),H", // 04
+    "RLC (IX%d2),L", // 05
+    "RLC (IX%d2)", // 06
+    "RLC (IX%d2),A", // 07
+    nullptr, // 08
+    nullptr, // 09
+    nullptr, // 0a
+    nullptr, // 0b
+    nullptr, // 0c
+    nullptr, // 0d
+    "RRC (IX%d2)", // 0e
+    nullptr, // 0f
+    "RL (IX%d2),B", // 10
+    "RL (IX%d2),C", // 11
+    "RL (IX%d2),D", // 12
+    "RL (IX%d2),E", // 13
+    "RL (IX%d2),H", // 14
+    "RL (IX%d2),L", // 15
+    "RL (IX%d2)", // 16
+    nullptr, // 17
+    nullptr, // 18
+    nullptr, // 19
+    nullptr, // 1a
+    nullptr, // 1b
+    nullptr, // 1c
+    nullptr, // 1d
+    "RR (IX%d2)", // 1e
+    nullptr, // 1f
+    nullptr, // 20
+    nullptr, // 21
+    nullptr, // 22
+    nullptr, // 23
+    nullptr, // 24
+    nullptr, // 25
+    "SLA 0, (IX%d2)", // 26
+    nullptr, // 27
+    nullptr, // 28
+    nullptr, // 29
+    nullptr, // 2a
+    nullptr, // 2b
+    nullptr, // 2c
+    nullptr, // 2d
+    "SRA 0, (IX%d2)", // 2e
+    nullptr, // 2f
+    nullptr, // 30
+    nullptr, // 31
+    nullptr, // 32
+    nullptr, // 33
+    nullptr, // 34
+    nullptr, // 35
+    "SLL 0, (IX%d2)", // 36
+    nullptr, // 37
+    nullptr, // 38
+    nullptr, // 39
+    nullptr, // 3a
+    nullptr, // 3b
+    nullptr, // 3c
+    nullptr, // 3d
+    "SRL 0, (IX%d2)", // 3e
+    nullptr, // 3f
+    nullptr, // 40
+    nullptr, // 41
+    nullptr, // 42
+    nullptr, // 43
+    nullptr, // 44
+    nullptr, // 45
+    "BIT 0, (IX%d2)", // 46
+    nullptr, // 47
+    nullptr, // 48
+    nullptr, // 49
+    nullptr, // 4a
+    nullptr, // 4b
+    nullptr, // 4c
+    nullptr, // 4d
+    "BIT 1, (IX%d2)", // 4e
+    nullptr, // 4f
+    nullptr, // 50
+    nullptr, // 51
+    nullptr, // 52
+    nullptr, // 53
+    nullptr, // 54
+    nullptr, // 55
+    "BIT 2, (IX%d2)", // 56
+    nullptr, // 57
+    nullptr, // 58
+    nullptr, // 59
+    nullptr, // 5a
+    nullptr, // 5b
+    nullptr, // 5c
+    nullptr, // 5d
+    "BIT 3, (IX%d2)", // 5e
+    nullptr, // 5f
+    nullptr, // 60
+    nullptr, // 61
+    nullptr, // 62
+    nullptr, // 63
+    nullptr, // 64
+    nullptr, // 65
+    "BIT 4, (IX%d2)", // 66
+    nullptr, // 67
+    nullptr, // 68
+    nullptr, // 69
+    nullptr, // 6a
+    nullptr, // 6b
+    nullptr, // 6c
+    nullptr, // 6d
+    "BIT 5, (IX%d2)", // 6e
+    nullptr, // 6f
+    nullptr, // 70
+    nullptr, // 71
+    nullptr, // 72
+    nullptr, // 73
+    nullptr, // 74
+    nullptr, // 75
+    "BIT 6, (IX%d2)", // 76
+    nullptr, // 77
+    nullptr, // 78
+    nullptr, // 79
+    nullptr, // 7a
+    nullptr, // 7b
+    nullptr, // 7c
+    nullptr, // 7d
+    "BIT 7, (IX%d2)", // 7e
+    nullptr, // 7f
+    nullptr, // 80
+    nullptr, // 81
+    nullptr, // 82
+    nullptr, // 83
+    nullptr, // 84
+    nullptr, // 85
+    "RES 0, (IX%d2)", // 86
+    nullptr, // 87
+    nullptr, // 88
+    nullptr, // 89
+    nullptr, // 8a
+    nullptr, // 8b
+    nullptr, // 8c
+    nullptr, // 8d
+    "RES 1, (IX%d2)", // 8e
+    nullptr, // 8f
+    nullptr, // 90
+    nullptr, // 91
+    nullptr, // 92
+    nullptr, // 93
+    nullptr, // 94
+    nullptr, // 95
+    "RES 2, (IX%d2)", // 96
+    nullptr, // 97
+    nullptr, // 98
+    nullptr, // 99
+    nullptr, // 9a
+    nullptr, // 9b
+    nullptr, // 9c
+    nullptr, // 9d
+    "RES 3, (IX%d2)", // 9e
+    nullptr, // 9f
+    nullptr, // a0
+    nullptr, // a1
+    nullptr, // a2
+    nullptr, // a3
+    nullptr, // a4
+    nullptr, // a5
+    "RES 4, (IX%d2)", // a6
+    nullptr, // a7
+    nullptr, // a8
+    nullptr, // a9
+    nullptr, // aa
+    nullptr, // ab
+    nullptr, // ac
+    nullptr, // ad
+    "RES 5, (IX%d2)", // ae
+    nullptr, // af
+    nullptr, // b0
+    nullptr, // b1
+    nullptr, // b2
+    nullptr, // b3
+    nullptr, // b4
+    nullptr, // b5
+    "RES 6, (IX%d2)", // b6
+    nullptr, // b7
+    nullptr, // b8
+    nullptr, // b9
+    nullptr, // ba
+    nullptr, // bb
+    nullptr, // bc
+    nullptr, // bd
+    "RES 7, (IX%d2)", // be
+    nullptr, // bf
+    nullptr, // c0
+    nullptr, // c1
+    nullptr, // c2
+    nullptr, // c3
+    nullptr, // c4
+    nullptr, // c5
+    "SET 0, (IX%d2)", // c6
+    nullptr, // c7
+    nullptr, // c8
+    nullptr, // c9
+    nullptr, // ca
+    nullptr, // cb
+    nullptr, // cc
+    nullptr, // cd
+    "SET 1, (IX%d2)", // ce
+    nullptr, // cf
+    nullptr, // d0
+    nullptr, // d1
+    nullptr, // d2
+    nullptr, // d3
+    nullptr, // d4
+    nullptr, // d5
+    "SET 2, (IX%d2)", // d6
+    nullptr, // d7
+    nullptr, // d8
+    nullptr, // d9
+    nullptr, // da
+    nullptr, // db
+    nullptr, // dc
+    nullptr, // dd
+    "SET 3, (IX%d2)", // de
+    nullptr, // df
+    nullptr, // e0
+    nullptr, // e1
+    nullptr, // e2
+    nullptr, // e3
+    nullptr, // e4
+    nullptr, // e5
+    "SET 4, (IX%d2)", // e6
+    nullptr, // e7
+    nullptr, // e8
+    nullptr, // e9
+    nullptr, // ea
+    nullptr, // eb
+    nullptr, // ec
+    nullptr, // ed
+    "SET 5, (IX%d2)", // ee
+    nullptr, // ef
+    nullptr, // f0
+    nullptr, // f1
+    nullptr, // f2
+    nullptr, // f3
+    nullptr, // f4
+    nullptr, // f5
+    "SET 6, (IX%d2)", // f6
+    nullptr, // f7
+    nullptr, // f8
+    nullptr, // f9
+    nullptr, // fa
+    nullptr, // fb
+    nullptr, // fc
+    nullptr, // fd
+    "SET 7, (IX%d2)", // fe
+    nullptr, // ff
+};
+
+// The mnemonic of each IY bit instruction, after the FD CB prefix and the displacement, indexed by opcode
+static constexpr std::array<char const*, 256> s_iy_bits_mnemonics = {
+    "RLC (IY%d2),B", // 00
+    "RLC (IY%d2),C", // 01
+    "RLC (IY%d2),D", // 02
+    "RLC (IY%d2),E", // 03
+    "RLC (IY%d2),H", // 04
+    "RLC (IY%d2),L", // 05
+    "RLC (IY%d2)", // 06
+    "RLC (IY%d2),A", // 07
+    nullptr, // 08
+    nullptr, // 09
+    nullptr, // 0a
+    nullptr, // 0b
+    nullptr, // 0c
+    nullptr, // 0d
+    "RRC (IY%d2)", // 0e
+    nullptr, // 0f
+    "RL (IY%d2),B", // 10
+    "RL (IY%d2),C", // 11
+    "RL (IY%d2),D", // 12
+    "RL (IY%d2),E", // 13
+    "RL (IY%d2),H", // 14
+    "RL (IY%d2),L", // 15
+    "RL (IY%d2)", // 16
+    nullptr, // 17
+    nullptr, // 18
+    nullptr, // 19
+    nullptr, // 1a
+    nullptr, // 1b
+    nullptr, // 1c
+    nullptr, // 1d
+    "RR (IY%d2)", // 1e
+    nullptr, // 1f
+    nullptr, // 20
+    nullptr, // 21
+    nullptr, // 22
+    nullptr, // 23
+    nullptr, // 24
+    nullptr, // 25
+    "SLA 0, (IY%d2)", // 26
+    nullptr, // 27
+    nullptr, // 28
+    nullptr, // 29
+    nullptr, // 2a
+    nullptr, // 2b
+    nullptr, // 2c
+    nullptr, // 2d
+    "SRA 0, (IY%d2)", // 2e
+    nullptr, // 2f
+    nullptr, // 30
+    nullptr, // 31
+    nullptr, // 32
+    nullptr, // 33
+    nullptr, // 34
+    nullptr, // 35
+    "SLL 0, (IY%d2)", // 36
+    nullptr, // 37
+    nullptr, // 38
+    nullptr, // 39
+    nullptr, // 3a
+    nullptr, // 3b
+    nullptr, // 3c
+    nullptr, // 3d
+    "SRL 0, (IY%d2)", // 3e
+    nullptr, // 3f
+    nullptr, // 40
+    nullptr, // 41
+    nullptr, // 42
+    nullptr, // 43
+    nullptr, // 44
+    nullptr, // 45
+    "BIT 0, (IY%d2)", // 46
+    nullptr, // 47
+    nullptr, // 48
+    nullptr, // 49
+    nullptr, // 4a
+    nullptr, // 4b
+    nullptr, // 4c
+    nullptr, // 4d
+    "BIT 1, (IY%d2)", // 4e
+    nullptr, // 4f
+    nullptr, // 50
+    nullptr, // 51
+    nullptr, // 52
+    nullptr, // 53
+    nullptr, // 54
+    nullptr, // 55
+    "BIT 2, (IY%d2)", // 56
+    nullptr, // 57
+    nullptr, // 58
+    nullptr, // 59
+    nullptr, // 5a
+    nullptr, // 5b
+    nullptr, // 5c
+    nullptr, // 5d
+    "BIT 3, (IY%d2)", // 5e
+    nullptr, // 5f
+    nullptr, // 60
+    nullptr, // 61
+    nullptr, // 62
+    nullptr, // 63
+    nullptr, // 64
+    nullptr, // 65
+    "BIT 4, (IY%d2)", // 66
+    nullptr, // 67
+    nullptr, // 68
+    nullptr, // 69
+    nullptr, // 6a
+    nullptr, // 6b
+    nullptr, // 6c
+    nullptr, // 6d
+    "BIT 5, (IY%d2)", // 6e
+    nullptr, // 6f
+    nullptr, // 70
+    nullptr, // 71
+    nullptr, // 72
+    nullptr, // 73
+    nullptr, // 74
+    nullptr, // 75
+    "BIT 6, (IY%d2)", // 76
+    nullptr, // 77
+    nullptr, // 78
+    nullptr, // 79
+    nullptr, // 7a
+    nullptr, // 7b
+    nullptr, // 7c
+    nullptr, // 7d
+    "BIT 7, (IY%d2)", // 7e
+    nullptr, // 7f
+    nullptr, // 80
+    nullptr, // 81
+    nullptr, // 82
+    nullptr, // 83
+    nullptr, // 84
+    nullptr, // 85
+    "RES 0, (IY%d2)", // 86
+    nullptr, // 87
+    nullptr, // 88
+    nullptr, // 89
+    nullptr, // 8a
+    nullptr, // 8b
+    nullptr, // 8c
+    nullptr, // 8d
+    "RES 1, (IY%d2)", // 8e
+    nullptr, // 8f
+    nullptr, // 90
+    nullptr, // 91
+    nullptr, // 92
+    nullptr, // 93
+    nullptr, // 94
+    nullptr, // 95
+    "RES 2, (IY%d2)", // 96
+    nullptr, // 97
+    nullptr, // 98
+    nullptr, // 99
+    nullptr, // 9a
+    nullptr, // 9b
+    nullptr, // 9c
+    nullptr, // 9d
+    "RES 3, (IY%d2)", // 9e
+    nullptr, // 9f
+    nullptr, // a0
+    nullptr, // a1
+    nullptr, // a2
+    nullptr, // a3
+    nullptr, // a4
+    nullptr, // a5
+    "RES 4, (IY%d2)", // a6
+    nullptr, // a7
+    nullptr, // a8
+    nullptr, // a9
+    nullptr, // aa
+    nullptr, // ab
+    nullptr, // ac
+    nullptr, // ad
+    "RES 5, (IY%d2)", // ae
+    nullptr, // af
+    nullptr, // b0
+    nullptr, // b1
+    nullptr, // b2
+    nullptr, // b3
+    nullptr, // b4
+    nullptr, // b5
+    "RES 6, (IY%d2)", // b6
+    nullptr, // b7
+    nullptr, // b8
+    nullptr, // b9
+    nullptr, // ba
+    nullptr, // bb
+    nullptr, // bc
+    nullptr, // bd
+    "RES 7, (IY%d2)", // be
+    nullptr, // bf
+    nullptr, // c0
+    nullptr, // c1
+    nullptr, // c2
+    nullptr, // c3
+    nullptr, // c4
+    nullptr, // c5
+    "SET 0, (IY%d2)", // c6
+    nullptr, // c7
+    nullptr, // c8
+    nullptr, // c9
+    nullptr, // ca
+    nullptr, // cb
+    nullptr, // cc
+    nullptr, // cd
+    "SET 1, (IY%d2)", // ce
+    nullptr, // cf
+    nullptr, // d0
+    nullptr, // d1
+    nullptr, // d2
+    nullptr, // d3
+    nullptr, // d4
+    nullptr, // d5
+    "SET 2, (IY%d2)", // d6
+    nullptr, // d7
+    nullptr, // d8
+    nullptr, // d9
+    nullptr, // da
+    nullptr, // db
+    nullptr, // dc
+    nullptr, // dd
+    "SET 3, (IY%d2)", // de
+    nullptr, // df
+    nullptr, // e0
+    nullptr, // e1
+    nullptr, // e2
+    nullptr, // e3
+    nullptr, // e4
+    nullptr, // e5
+    "SET 4, (IY%d2)", // e6
+    nullptr, // e7
+    nullptr, // e8
+    nullptr, // e9
+    nullptr, // ea
+    nullptr, // eb
+    nullptr, // ec
+    nullptr, // ed
+    "SET 5, (IY%d2)", // ee
+    nullptr, // ef
+    nullptr, // f0
+    nullptr, // f1
+    nullptr, // f2
+    nullptr, // f3
+    nullptr, // f4
+    nullptr, // f5
+    "SET 6, (IY%d2)", // f6
+    nullptr, // f7
+    nullptr, // f8
+    nullptr, // f9
+    nullptr, // fa
+    nullptr, // fb
+    nullptr, // fc
+    nullptr, // fd
+    "SET 7, (IY%d2)", // fe
+    nullptr, // ff
+};
+
+Disassembler::Disassembler(EmulatorMemory<u16, u8> const& memory, std::ostream& ostream)
     : m_memory(memory)
     , m_memory_size(memory.size())
-    , m_pc(0)
-    , m_opcode(0)
     , m_ostream(ostream)
 {
 }
 
 void Disassembler::disassemble()
 {
-    while (m_pc < m_memory_size) {
-        print_next_instruction();
+    std::string line;
+    for (std::size_t address = 0; address < m_memory_size;) {
+        const DecodedInstruction<u16, u8> instruction = decode(m_memory, static_cast<u16>(address));
+        format_instruction(instruction, line);
+        line.push_back('\n');
+        m_ostream << line;
+
+        // An opcode that isn't an instruction is listed as a data byte, so the next line is the next byte
+        address += instruction.m_mnemonic == nullptr ? 1 : instruction.m_length;
     }
 }
 
-void Disassembler::print_next_instruction()
+DecodedInstruction<u16, u8> Disassembler::decode(EmulatorMemory<u16, u8> const& memory, u16 address)
 {
-    m_ostream << hexify_wo_0x(m_pc, 4) << "\t\t";
+    DecodedInstruction<u16, u8> instruction { .m_address = address, .m_length = 0, .m_bytes = {} };
 
-    m_opcode = get_next_byte().farg;
-
-    switch (m_opcode) {
-    case NOP:
-        print_nop(m_ostream);
-        break;
-    case LD_BC_nn:
-        print_ld_dd_nn(m_ostream, "BC", get_next_word());
-        break;
-    case LD_MBC_A:
-        print_ld(m_ostream, "(BC)", "A");
-        break;
-    case INC_BC:
-        print_inc(m_ostream, "BC");
-        break;
-    case INC_B:
-        print_inc(m_ostream, "B");
-        break;
-    case DEC_B:
-        print_dec(m_ostream, "B");
-        break;
-    case LD_B_n:
-        print_ld(m_ostream, "B", get_next_byte());
-        break;
-    case RLCA:
-        print_rlca(m_ostream);
-        break;
-    case EX_AF_AFP:
-        print_ex(m_ostream, "AF", "AF'");
-        break;
-    case ADD_HL_BC:
-        print_add(m_ostream, "HL", "BC");
-        break;
-    case LD_A_MBC:
-        print_ld(m_ostream, "A", "(BC)");
-        break;
-    case DEC_BC:
-        print_dec(m_ostream, "BC");
-        break;
-    case INC_C:
-        print_inc(m_ostream, "C");
-        break;
-    case DEC_C:
-        print_dec(m_ostream, "C");
-        break;
-    case LD_C_n:
-        print_ld(m_ostream, "C", get_next_byte());
-        break;
-    case RRCA:
-        print_rrca(m_ostream);
-        break;
-    case DJNZ:
-        print_djnz(m_ostream, get_next_byte());
-        break;
-    case LD_DE_nn:
-        print_ld_dd_nn(m_ostream, "DE", get_next_word());
-        break;
-    case LD_MDE_A:
-        print_ld(m_ostream, "(DE)", "A");
-        break;
-    case INC_DE:
-        print_inc(m_ostream, "DE");
+    const u8 opcode = memory.read(address);
+    switch (opcode) {
+    case BITS:
+        instruction.m_length = 2;
+        instruction.m_mnemonic = s_bits_mnemonics[memory.read(static_cast<u16>(address + 1))];
         break;
-    case INC_D:
-        print_inc(m_ostream, "D");
+    case IX:
+    case IY: {
+        const u8 ixy_opcode = memory.read(static_cast<u16>(address + 1));
+        instruction.m_length = s_ixy_instruction_lengths[ixy_opcode];
+        if (ixy_opcode == IXY_BITS) { // The opcode comes after the displacement
+            const u8 bits_opcode = memory.read(static_cast<u16>(address + 3));
+            instruction.m_mnemonic = opcode == IX ? s_ix_bits_mnemonics[bits_opcode] : s_iy_bits_mnemonics[bits_opcode];
+        } else {
+            instruction.m_mnemonic = opcode == IX ? s_ix_mnemonics[ixy_opcode] : s_iy_mnemonics[ixy_opcode];
+        }
         break;
-    case DEC_D:
-        print_dec(m_ostream, "D");
+    }
+    case EXTD: {
+        const u8 extd_opcode = memory.read(static_cast<u16>(address + 1));
+        // Only the LD (nn),dd and LD dd,(nn) instructions have operands
+        instruction.m_length = (extd_opcode & 0xc7) == 0x43 ? 4 : 2;
+        instruction.m_mnemonic = s_extd_mnemonics[extd_opcode];
         break;
-    case LD_D_n:
-        print_ld(m_ostream, "D", get_next_byte());
+    }
+    default:
+        instruction.m_length = s_instruction_lengths[opcode];
+        instruction.m_mnemonic = s_mnemonics[opcode];
         break;
-    case RLA:
-        print_rla(m_ostream);
+    }
+
+    for (std::size_t i = 0; i < instruction.m_length; ++i) {
+        instruction.m_bytes[i] = memory.read(static_cast<u16>(address + i));
+    }
+
+    decode_control_flow(instruction);
+
+    return instruction;
+}
+
+void Disassembler::decode_control_flow(DecodedInstruction<u16, u8>& instruction)
+{
+    const u8 opcode = instruction.m_bytes[0];
+    const u16 word = to_u16(instruction.m_bytes[2], instruction.m_bytes[1]);
+    const u16 relative = static_cast<u16>(instruction.m_address + 2 + static_cast<i8>(instruction.m_bytes[1]));
+
+    switch (opcode) {
+    case JP:
+        instruction.m_control_flow = ControlFlow::Jump;
+        instruction.m_target = word;
         break;
     case JR_e:
-        print_jr(m_ostream, get_next_byte());
-        break;
-    case ADD_HL_DE:
-        print_add(m_ostream, "HL", "DE");
-        break;
-    case LD_A_MDE:
-        print_ld(m_ostream, "A", "(DE)");
+        instruction.m_control_flow = ControlFlow::Jump;
+        instruction.m_target = relative;
         break;
-    case DEC_DE:
-        print_dec(m_ostream, "D");
-        break;
-    case INC_E:
-        print_inc(m_ostream, "E");
-        break;
-    case DEC_E:
-        print_dec(m_ostream, "E");
-        break;
-    case LD_E_n:
-        print_ld(m_ostream, "E", get_next_byte());
-        break;
-    case RRA:
-        print_rra(m_ostream);
+    case JP_NZ:
+    case JP_Z:
+    case JP_NC:
+    case JP_C:
+    case JP_PO:
+    case JP_PE:
+    case JP_P:
+    case JP_M:
+        instruction.m_control_flow = ControlFlow::ConditionalJump;
+        instruction.m_target = word;
         break;
+    case DJNZ:
     case JR_NZ_e:
-        print_jr(m_ostream, "NZ", get_next_byte());
-        break;
-    case LD_HL_nn:
-        print_ld_dd_nn(m_ostream, "HL", get_next_word());
-        break;
-    case LD_Mnn_HL:
-        print_ld_Mnn_dd(m_ostream, get_next_word(), "HL");
-        break;
-    case INC_HL:
-        print_inc(m_ostream, "HL");
-        break;
-    case INC_H:
-        print_inc(m_ostream, "H");
-        break;
-    case DEC_H:
-        print_dec(m_ostream, "H");
-        break;
-    case LD_H_n:
-        print_ld(m_ostream, "H", get_next_byte());
-        break;
-    case DAA:
-        print_daa(m_ostream);
-        break;
     case JR_Z_e:
-        print_jr(m_ostream, "Z", get_next_byte());
-        break;
-    case ADD_HL_HL:
-        print_add(m_ostream, "HL", "HL");
-        break;
-    case LD_HL_Mnn:
-        print_ld(m_ostream, "HL", get_next_word());
-        break;
-    case DEC_HL:
-        print_dec(m_ostream, "HL");
-        break;
-    case INC_L:
-        print_inc(m_ostream, "L");
-        break;
-    case DEC_L:
-        print_dec(m_ostream, "L");
-        break;
-    case LD_L_n:
-        print_ld(m_ostream, "L", get_next_byte());
-        break;
-    case CPL:
-        print_cpl(m_ostream);
-        break;
     case JR_NC_e:
-        print_jr(m_ostream, "NC", get_next_byte());
-        break;
-    case LD_SP_nn:
-        print_ld_dd_nn(m_ostream, "SP", get_next_word());
-        break;
-    case LD_Mnn_A:
-        print_ld_Mnn_dd(m_ostream, get_next_word(), "A");
-        break;
-    case INC_SP:
-        print_inc(m_ostream, "SP");
-        break;
-    case INC_MHL:
-        print_inc(m_ostream, "(HL)");
-        break;
-    case DEC_MHL:
-        print_dec(m_ostream, "(HL)");
-        break;
-    case LD_MHL_n:
-        print_ld(m_ostream, "(HL)", get_next_byte());
-        break;
-    case SCF:
-        print_scf(m_ostream);
-        break;
     case JR_C_e:
-        print_jr(m_ostream, "C", get_next_byte());
-        break;
-    case ADD_HL_SP:
-        print_add(m_ostream, "HL", "SP");
-        break;
-    case LD_A_Mnn:
-        print_ld(m_ostream, "A", get_next_word());
-        break;
-    case DEC_SP:
-        print_dec(m_ostream, "SP");
-        break;
-    case INC_A:
-        print_inc(m_ostream, "A");
-        break;
-    case DEC_A:
-        print_dec(m_ostream, "A");
-        break;
-    case LD_A_n:
-        print_ld(m_ostream, "A", get_next_byte());
-        break;
-    case CCF:
-        print_ccf(m_ostream);
-        break;
-    case LD_B_B:
-        print_ld(m_ostream, "B", "B");
-        break;
-    case LD_B_C:
-        print_ld(m_ostream, "B", "C");
-        break;
-    case LD_B_D:
-        print_ld(m_ostream, "B", "D");
-        break;
-    case LD_B_E:
-        print_ld(m_ostream, "B", "E");
-        break;
-    case LD_B_H:
-        print_ld(m_ostream, "B", "H");
-        break;
-    case LD_B_L:
-        print_ld(m_ostream, "B", "L");
-        break;
-    case LD_B_MHL:
-        print_ld(m_ostream, "B", "(HL)");
-        break;
-    case LD_B_A:
-        print_ld(m_ostream, "B", "A");
-        break;
-    case LD_C_B:
-        print_ld(m_ostream, "C", "B");
-        break;
-    case LD_C_C:
-        print_ld(m_ostream, "C", "C");
-        break;
-    case LD_C_D:
-        print_ld(m_ostream, "C", "D");
-        break;
-    case LD_C_E:
-        print_ld(m_ostream, "C", "E");
-        break;
-    case LD_C_H:
-        print_ld(m_ostream, "C", "H");
-        break;
-    case LD_C_L:
-        print_ld(m_ostream, "C", "L");
-        break;
-    case LD_C_MHL:
-        print_ld(m_ostream, "C", "(HL)");
-        break;
-    case LD_C_A:
-        print_ld(m_ostream, "C", "A");
-        break;
-    case LD_D_B:
-        print_ld(m_ostream, "D", "B");
-        break;
-    case LD_D_C:
-        print_ld(m_ostream, "D", "C");
-        break;
-    case LD_D_D:
-        print_ld(m_ostream, "D", "D");
-        break;
-    case LD_D_E:
-        print_ld(m_ostream, "D", "E");
-        break;
-    case LD_D_H:
-        print_ld(m_ostream, "D", "H");
-        break;
-    case LD_D_L:
-        print_ld(m_ostream, "D", "L");
-        break;
-    case LD_D_MHL:
-        print_ld(m_ostream, "D", "(HL)");
-        break;
-    case LD_D_A:
-        print_ld(m_ostream, "D", "A");
-        break;
-    case LD_E_B:
-        print_ld(m_ostream, "E", "B");
-        break;
-    case LD_E_C:
-        print_ld(m_ostream, "E", "C");
-        break;
-    case LD_E_D:
-        print_ld(m_ostream, "E", "D");
-        break;
-    case LD_E_E:
-        print_ld(m_ostream, "E", "E");
-        break;
-    case LD_E_H:
-        print_ld(m_ostream, "E", "H");
-        break;
-    case LD_E_L:
-        print_ld(m_ostream, "E", "L");
-        break;
-    case LD_E_MHL:
-        print_ld(m_ostream, "E", "(HL)");
-        break;
-    case LD_E_A:
-        print_ld(m_ostream, "E", "A");
-        break;
-    case LD_H_B:
-        print_ld(m_ostream, "H", "B");
-        break;
-    case LD_H_C:
-        print_ld(m_ostream, "H", "C");
-        break;
-    case LD_H_D:
-        print_ld(m_ostream, "H", "D");
-        break;
-    case LD_H_E:
-        print_ld(m_ostream, "H", "E");
-        break;
-    case LD_H_H:
-        print_ld(m_ostream, "H", "H");
-        break;
-    case LD_H_L:
-        print_ld(m_ostream, "H", "L");
-        break;
-    case LD_H_MHL:
-        print_ld(m_ostream, "H", "(HL)");
-        break;
-    case LD_H_A:
-        print_ld(m_ostream, "H", "A");
-        break;
-    case LD_L_B:
-        print_ld(m_ostream, "L", "B");
-        break;
-    case LD_L_C:
-        print_ld(m_ostream, "L", "C");
-        break;
-    case LD_L_D:
-        print_ld(m_ostream, "L", "D");
-        break;
-    case LD_L_E:
-        print_ld(m_ostream, "L", "E");
-        break;
-    case LD_L_H:
-        print_ld(m_ostream, "L", "H");
-        break;
-    case LD_L_L:
-        print_ld(m_ostream, "L", "L");
-        break;
-    case LD_L_MHL:
-        print_ld(m_ostream, "L", "(HL)");
-        break;
-    case LD_L_A:
-        print_ld(m_ostream, "L", "A");
-        break;
-    case LD_MHL_B:
-        print_ld(m_ostream, "(HL)", "B");
-        break;
-    case LD_MHL_C:
-        print_ld(m_ostream, "(HL)", "C");
-        break;
-    case LD_MHL_D:
-        print_ld(m_ostream, "(HL)", "D");
-        break;
-    case LD_MHL_E:
-        print_ld(m_ostream, "(HL)", "E");
-        break;
-    case LD_MHL_H:
-        print_ld(m_ostream, "(HL)", "H");
-        break;
-    case LD_MHL_L:
-        print_ld(m_ostream, "(HL)", "L");
-        break;
-    case HALT:
-        print_halt(m_ostream);
-        break;
-    case LD_MHL_A:
-        print_ld(m_ostream, "(HL)", "A");
-        break;
-    case LD_A_B:
-        print_ld(m_ostream, "A", "B");
-        break;
-    case LD_A_C:
-        print_ld(m_ostream, "A", "C");
-        break;
-    case LD_A_D:
-        print_ld(m_ostream, "A", "D");
-        break;
-    case LD_A_E:
-        print_ld(m_ostream, "A", "E");
-        break;
-    case LD_A_H:
-        print_ld(m_ostream, "A", "H");
-        break;
-    case LD_A_L:
-        print_ld(m_ostream, "A", "L");
-        break;
-    case LD_A_MHL:
-        print_ld(m_ostream, "A", "(HL)");
-        break;
-    case LD_A_A:
-        print_ld(m_ostream, "A", "A");
-        break;
-    case ADD_A_B:
-        print_add(m_ostream, "A", "B");
-        break;
-    case ADD_A_C:
-        print_add(m_ostream, "A", "C");
-        break;
-    case ADD_A_D:
-        print_add(m_ostream, "A", "D");
-        break;
-    case ADD_A_E:
-        print_add(m_ostream, "A", "E");
-        break;
-    case ADD_A_H:
-        print_add(m_ostream, "A", "H");
-        break;
-    case ADD_A_L:
-        print_add(m_ostream, "A", "L");
-        break;
-    case ADD_A_MHL:
-        print_add(m_ostream, "A", "(HL)");
-        break;
-    case ADD_A_A:
-        print_add(m_ostream, "A", "A");
-        break;
-    case ADC_A_B:
-        print_adc_r_s(m_ostream, "A", "B");
-        break;
-    case ADC_A_C:
-        print_adc_r_s(m_ostream, "A", "C");
-        break;
-    case ADC_A_D:
-        print_adc_r_s(m_ostream, "A", "D");
-        break;
-    case ADC_A_E:
-        print_adc_r_s(m_ostream, "A", "E");
-        break;
-    case ADC_A_H:
-        print_adc_r_s(m_ostream, "A", "H");
-        break;
-    case ADC_A_L:
-        print_adc_r_s(m_ostream, "A", "L");
-        break;
-    case ADC_A_MHL:
-        print_adc_r_s(m_ostream, "A", "(HL)");
-        break;
-    case ADC_A_A:
-        print_adc_r_s(m_ostream, "A", "A");
-        break;
-    case SUB_B:
-        print_sub(m_ostream, "B");
-        break;
-    case SUB_C:
-        print_sub(m_ostream, "C");
-        break;
-    case SUB_D:
-        print_sub(m_ostream, "D");
-        break;
-    case SUB_E:
-        print_sub(m_ostream, "E");
-        break;
-    case SUB_H:
-        print_sub(m_ostream, "H");
-        break;
-    case SUB_L:
-        print_sub(m_ostream, "L");
-        break;
-    case SUB_MHL:
-        print_sub(m_ostream, "(HL)");
-        break;
-    case SUB_A:
-        print_sub(m_ostream, "A");
-        break;
-    case SBC_A_B:
-        print_sbc_r_s(m_ostream, "A", "B");
-        break;
-    case SBC_A_C:
-        print_sbc_r_s(m_ostream, "A", "C");
-        break;
-    case SBC_A_D:
-        print_sbc_r_s(m_ostream, "A", "D");
-        break;
-    case SBC_A_E:
-        print_sbc_r_s(m_ostream, "A", "E");
-        break;
-    case SBC_A_H:
-        print_sbc_r_s(m_ostream, "A", "H");
-        break;
-    case SBC_A_L:
-        print_sbc_r_s(m_ostream, "A", "L");
-        break;
-    case SBC_A_MHL:
-        print_sbc_r_s(m_ostream, "A", "(HL)");
-        break;
-    case SBC_A_A:
-        print_sbc_r_s(m_ostream, "A", "A");
-        break;
-    case AND_B:
-        print_and_r(m_ostream, "B");
-        break;
-    case AND_C:
-        print_and_r(m_ostream, "C");
-        break;
-    case AND_D:
-        print_and_r(m_ostream, "D");
-        break;
-    case AND_E:
-        print_and_r(m_ostream, "E");
-        break;
-    case AND_H:
-        print_and_r(m_ostream, "H");
-        break;
-    case AND_L:
-        print_and_r(m_ostream, "L");
-        break;
-    case AND_MHL:
-        print_and_r(m_ostream, "(HL)");
-        break;
-    case AND_A:
-        print_and_r(m_ostream, "A");
-        break;
-    case XOR_B:
-        print_xor_r(m_ostream, "B");
-        break;
-    case XOR_C:
-        print_xor_r(m_ostream, "C");
-        break;
-    case XOR_D:
-        print_xor_r(m_ostream, "D");
-        break;
-    case XOR_E:
-        print_xor_r(m_ostream, "E");
-        break;
-    case XOR_H:
-        print_xor_r(m_ostream, "H");
-        break;
-    case XOR_L:
-        print_xor_r(m_ostream, "L");
-        break;
-    case XOR_MHL:
-        print_xor_r(m_ostream, "(HL)");
-        break;
-    case XOR_A:
-        print_xor_r(m_ostream, "A");
-        break;
-    case OR_B:
-        print_or_r(m_ostream, "B");
-        break;
-    case OR_C:
-        print_or_r(m_ostream, "C");
-        break;
-    case OR_D:
-        print_or_r(m_ostream, "D");
-        break;
-    case OR_E:
-        print_or_r(m_ostream, "E");
-        break;
-    case OR_H:
-        print_or_r(m_ostream, "H");
-        break;
-    case OR_L:
-        print_or_r(m_ostream, "L");
-        break;
-    case OR_MHL:
-        print_or_r(m_ostream, "(HL)");
-        break;
-    case OR_A:
-        print_or_r(m_ostream, "A");
-        break;
-    case CP_B:
-        print_cp(m_ostream, "B");
-        break;
-    case CP_C:
-        print_cp(m_ostream, "C");
-        break;
-    case CP_D:
-        print_cp(m_ostream, "D");
-        break;
-    case CP_E:
-        print_cp(m_ostream, "E");
-        break;
-    case CP_H:
-        print_cp(m_ostream, "H");
-        break;
-    case CP_L:
-        print_cp(m_ostream, "L");
-        break;
-    case CP_MHL:
-        print_cp(m_ostream, "(HL)");
-        break;
-    case CP_A:
-        print_cp(m_ostream, "A");
-        break;
-    case RET_NZ:
-        print_ret(m_ostream, "NZ");
-        break;
-    case POP_BC:
-        print_pop(m_ostream, "BC");
-        break;
-    case JP_NZ:
-        print_jp_cc_nn(m_ostream, get_next_word(), "NZ");
-        break;
-    case JP:
-        print_jp_nn(m_ostream, get_next_word());
+        instruction.m_control_flow = ControlFlow::ConditionalJump;
+        instruction.m_target = relative;
         break;
+    case CALL:
     case CALL_NZ:
-        print_call_cc_nn(m_ostream, get_next_word(), "NZ");
-        break;
-    case PUSH_BC:
-        print_push(m_ostream, "BC");
-        break;
-    case ADD_A_n:
-        print_add_r_n(m_ostream, "A", get_next_byte());
+    case CALL_Z:
+    case CALL_NC:
+    case CALL_C:
+    case CALL_PO:
+    case CALL_PE:
+    case CALL_P:
+    case CALL_M:
+        instruction.m_control_flow = ControlFlow::Call;
+        instruction.m_target = word;
         break;
     case RST_0:
-        print_rst(m_ostream, 0);
+    case RST_1:
+    case RST_2:
+    case RST_3:
+    case RST_4:
+    case RST_5:
+    case RST_6:
+    case RST_7:
+        instruction.m_control_flow = ControlFlow::Call;
+        instruction.m_target = opcode & 0x38;
         break;
+    case RET_NZ:
     case RET_Z:
-        print_ret(m_ostream, "Z");
+    case RET_NC:
+    case RET_C:
+    case RET_PO:
+    case RET_PE:
+    case RET_P:
+    case RET_M:
+        instruction.m_control_flow = ControlFlow::ConditionalReturn;
         break;
     case RET:
-        print_ret(m_ostream);
+        instruction.m_control_flow = ControlFlow::Return;
         break;
-    case JP_Z:
-        print_jp_cc_nn(m_ostream, get_next_word(), "Z");
+    case JP_MHL:
+        instruction.m_control_flow = ControlFlow::IndirectJump;
         break;
-    case BITS:
-        print_next_bits_instruction(get_next_byte().farg);
+    case IX:
+    case IY:
+        if (instruction.m_bytes[1] == JP_MIXY) {
+            instruction.m_control_flow = ControlFlow::IndirectJump;
+        }
         break;
-    case CALL_Z:
-        print_call_cc_nn(m_ostream, get_next_word(), "Z");
-        break;
-    case CALL:
-        print_call_nn(m_ostream, get_next_word());
-        break;
-    case ADC_A_n:
-        print_adc_r_n(m_ostream, "A", get_next_byte());
-        break;
-    case RST_1:
-        print_rst(m_ostream, 1);
-        break;
-    case RET_NC:
-        print_ret(m_ostream, "NZ");
-        break;
-    case POP_DE:
-        print_pop(m_ostream, "DE");
-        break;
-    case JP_NC:
-        print_jp_cc_nn(m_ostream, get_next_word(), "NC");
-        break;
-    case OUT:
-        print_out(m_ostream, get_next_byte());
-        break;
-    case CALL_NC:
-        print_call_cc_nn(m_ostream, get_next_word(), "NC");
-        break;
-    case PUSH_DE:
-        print_push(m_ostream, "DE");
-        break;
-    case SUB_n:
-        print_sub(m_ostream, get_next_byte());
-        break;
-    case RST_2:
-        print_rst(m_ostream, 2);
-        break;
-    case RET_C:
-        print_ret(m_ostream, "C");
-        break;
-    case EXX:
-        print_exx(m_ostream);
-        break;
-    case JP_C:
-        print_jp_cc_nn(m_ostream, get_next_word(), "C");
-        break;
-    case IN:
-        print_in(m_ostream, get_next_byte());
-        break;
-    case CALL_C:
-        print_call_cc_nn(m_ostream, get_next_word(), "C");
-        break;
-    case IX:
-        print_next_ixy_instruction(get_next_byte().farg, "IX");
-        break;
-    case SBC_A_n:
-        print_sbc_r_n(m_ostream, "A", get_next_byte());
-        break;
-    case RST_3:
-        print_rst(m_ostream, 3);
-        break;
-    case RET_PO:
-        print_ret(m_ostream, "PO");
-        break;
-    case POP_HL:
-        print_pop(m_ostream, "HL");
-        break;
-    case JP_PO:
-        print_jp_cc_nn(m_ostream, get_next_word(), "PO");
-        break;
-    case EX_MSP_HL:
-        print_ex(m_ostream, "(SP)", "HL");
-        break;
-    case CALL_PO:
-        print_call_cc_nn(m_ostream, get_next_word(), "PO");
-        break;
-    case PUSH_HL:
-        print_push(m_ostream, "HL");
-        break;
-    case AND_n:
-        print_and_n(m_ostream, get_next_byte());
-        break;
-    case RST_4:
-        print_rst(m_ostream, 4);
-        break;
-    case RET_PE:
-        print_ret(m_ostream, "PE");
-        break;
-    case JP_MHL:
-        print_jp_Mss(m_ostream, "HL");
-        break;
-    case JP_PE:
-        print_jp_cc_nn(m_ostream, get_next_word(), "PE");
-        break;
-    case EX_DE_HL:
-        print_ex(m_ostream, "DE", "HL");
-        break;
-    case CALL_PE:
-        print_call_cc_nn(m_ostream, get_next_word(), "PE");
-        break;
-    case EXTD:
-        print_next_extd_instruction(get_next_byte().farg);
-        break;
-    case XOR_n:
-        print_xor_n(m_ostream, get_next_byte());
-        break;
-    case RST_5:
-        print_rst(m_ostream, 5);
-        break;
-    case RET_P:
-        print_ret(m_ostream, "P");
-        break;
-    case POP_AF:
-        print_pop(m_ostream, "AF");
-        break;
-    case JP_P:
-        print_jp_cc_nn(m_ostream, get_next_word(), "P");
-        break;
-    case DI:
-        print_di(m_ostream);
-        break;
-    case CALL_P:
-        print_call_cc_nn(m_ostream, get_next_word(), "P");
-        break;
-    case PUSH_AF:
-        print_push(m_ostream, "AF");
-        break;
-    case OR_n:
-        print_or_n(m_ostream, get_next_byte());
-        break;
-    case RST_6:
-        print_rst(m_ostream, 6);
-        break;
-    case RET_M:
-        print_ret(m_ostream, "M");
-        break;
-    case LD_SP_HL:
-        print_ld(m_ostream, "SP", "HL");
-        break;
-    case JP_M:
-        print_jp_cc_nn(m_ostream, get_next_word(), "M");
-        break;
-    case EI:
-        print_ei(m_ostream);
-        break;
-    case CALL_M:
-        print_call_cc_nn(m_ostream, get_next_word(), "M");
-        break;
-    case IY:
-        print_next_ixy_instruction(get_next_byte().farg, "IY");
-        break;
-    case CP_n:
-        print_cp(m_ostream, get_next_byte());
-        break;
-    case RST_7:
-        print_rst(m_ostream, 7);
-        break;
-    default:
-        throw UnrecognizedOpcodeException(m_opcode);
-    }
-
-    m_ostream << "\n";
-}
-
-void Disassembler::print_next_bits_instruction(u8 bits_opcode)
-{
-    switch (bits_opcode) {
-    case RLC_B:
-        print_rlc(m_ostream, "B");
-        break;
-    case RLC_C:
-        print_rlc(m_ostream, "C");
-        break;
-    case RLC_D:
-        print_rlc(m_ostream, "D");
-        break;
-    case RLC_E:
-        print_rlc(m_ostream, "E");
-        break;
-    case RLC_H:
-        print_rlc(m_ostream, "H");
-        break;
-    case RLC_L:
-        print_rlc(m_ostream, "L");
-        break;
-    case RLC_MHL:
-        print_rlc(m_ostream, "(HL)");
-        break;
-    case RLC_A:
-        print_rlc(m_ostream, "A");
-        break;
-    case RRC_B:
-        print_rrc(m_ostream, "B");
-        break;
-    case RRC_C:
-        print_rrc(m_ostream, "C");
-        break;
-    case RRC_D:
-        print_rrc(m_ostream, "D");
-        break;
-    case RRC_E:
-        print_rrc(m_ostream, "E");
-        break;
-    case RRC_H:
-        print_rrc(m_ostream, "H");
-        break;
-    case RRC_L:
-        print_rrc(m_ostream, "L");
-        break;
-    case RRC_MHL:
-        print_rrc(m_ostream, "(HL)");
-        break;
-    case RRC_A:
-        print_rrc(m_ostream, "A");
-        break;
-    case RL_B:
-        print_rl(m_ostream, "B");
-        break;
-    case RL_C:
-        print_rl(m_ostream, "C");
-        break;
-    case RL_D:
-        print_rl(m_ostream, "D");
-        break;
-    case RL_E:
-        print_rl(m_ostream, "E");
-        break;
-    case RL_H:
-        print_rl(m_ostream, "H");
-        break;
-    case RL_L:
-        print_rl(m_ostream, "L");
-        break;
-    case RL_MHL:
-        print_rl(m_ostream, "(HL)");
-        break;
-    case RL_A:
-        print_rl(m_ostream, "A");
-        break;
-    case RR_B:
-        print_rr(m_ostream, "B");
-        break;
-    case RR_C:
-        print_rr(m_ostream, "C");
-        break;
-    case RR_D:
-        print_rr(m_ostream, "D");
-        break;
-    case RR_E:
-        print_rr(m_ostream, "E");
-        break;
-    case RR_H:
-        print_rr(m_ostream, "H");
-        break;
-    case RR_L:
-        print_rr(m_ostream, "L");
-        break;
-    case RR_MHL:
-        print_rr(m_ostream, "(HL)");
-        break;
-    case RR_A:
-        print_rr(m_ostream, "A");
-        break;
-    case SLA_B:
-        print_sla(m_ostream, "B");
-        break;
-    case SLA_C:
-        print_sla(m_ostream, "C");
-        break;
-    case SLA_D:
-        print_sla(m_ostream, "D");
-        break;
-    case SLA_E:
-        print_sla(m_ostream, "E");
-        break;
-    case SLA_H:
-        print_sla(m_ostream, "H");
-        break;
-    case SLA_L:
-        print_sla(m_ostream, "L");
-        break;
-    case SLA_MHL:
-        print_sla(m_ostream, "(HL)");
-        break;
-    case SLA_A:
-        print_sla(m_ostream, "A");
-        break;
-    case SRA_B:
-        print_sra(m_ostream, "B");
-        break;
-    case SRA_C:
-        print_sra(m_ostream, "C");
-        break;
-    case SRA_D:
-        print_sra(m_ostream, "D");
-        break;
-    case SRA_E:
-        print_sra(m_ostream, "E");
-        break;
-    case SRA_H:
-        print_sra(m_ostream, "H");
-        break;
-    case SRA_L:
-        print_sra(m_ostream, "L");
-        break;
-    case SRA_MHL:
-        print_sra(m_ostream, "(HL)");
-        break;
-    case SRA_A:
-        print_sra(m_ostream, "A");
-        break;
-    case SLL_B_UNDOC:
-        print_sll(m_ostream, "B");
-        break;
-    case SLL_C_UNDOC:
-        print_sll(m_ostream, "C");
-        break;
-    case SLL_D_UNDOC:
-        print_sll(m_ostream, "D");
-        break;
-    case SLL_E_UNDOC:
-        print_sll(m_ostream, "E");
-        break;
-    case SLL_H_UNDOC:
-        print_sll(m_ostream, "H");
-        break;
-    case SLL_L_UNDOC:
-        print_sll(m_ostream, "L");
-        break;
-    case SLL_MHL_UNDOC:
-        print_sll(m_ostream, "(HL)");
-        break;
-    case SLL_A_UNDOC:
-        print_sll(m_ostream, "A");
-        break;
-    case SRL_B:
-        print_srl(m_ostream, "B");
-        break;
-    case SRL_C:
-        print_srl(m_ostream, "C");
-        break;
-    case SRL_D:
-        print_srl(m_ostream, "D");
-        break;
-    case SRL_E:
-        print_srl(m_ostream, "E");
-        break;
-    case SRL_H:
-        print_srl(m_ostream, "H");
-        break;
-    case SRL_L:
-        print_srl(m_ostream, "L");
-        break;
-    case SRL_MHL:
-        print_srl(m_ostream, "(HL)");
-        break;
-    case SRL_A:
-        print_srl(m_ostream, "A");
-        break;
-    case BIT_0_B:
-        print_bit(m_ostream, 0, "B");
-        break;
-    case BIT_0_C:
-        print_bit(m_ostream, 0, "C");
-        break;
-    case BIT_0_D:
-        print_bit(m_ostream, 0, "D");
-        break;
-    case BIT_0_E:
-        print_bit(m_ostream, 0, "E");
-        break;
-    case BIT_0_H:
-        print_bit(m_ostream, 0, "H");
-        break;
-    case BIT_0_L:
-        print_bit(m_ostream, 0, "L");
-        break;
-    case BIT_0_MHL:
-        print_bit(m_ostream, 0, "(HL)");
-        break;
-    case BIT_0_A:
-        print_bit(m_ostream, 0, "A");
-        break;
-    case BIT_1_B:
-        print_bit(m_ostream, 1, "B");
-        break;
-    case BIT_1_C:
-        print_bit(m_ostream, 1, "C");
-        break;
-    case BIT_1_D:
-        print_bit(m_ostream, 1, "D");
-        break;
-    case BIT_1_E:
-        print_bit(m_ostream, 1, "E");
-        break;
-    case BIT_1_H:
-        print_bit(m_ostream, 1, "H");
-        break;
-    case BIT_1_L:
-        print_bit(m_ostream, 1, "L");
-        break;
-    case BIT_1_MHL:
-        print_bit(m_ostream, 1, "(HL)");
-        break;
-    case BIT_1_A:
-        print_bit(m_ostream, 1, "A");
-        break;
-    case BIT_2_B:
-        print_bit(m_ostream, 2, "B");
-        break;
-    case BIT_2_C:
-        print_bit(m_ostream, 2, "C");
-        break;
-    case BIT_2_D:
-        print_bit(m_ostream, 2, "D");
-        break;
-    case BIT_2_E:
-        print_bit(m_ostream, 2, "E");
-        break;
-    case BIT_2_H:
-        print_bit(m_ostream, 2, "H");
-        break;
-    case BIT_2_L:
-        print_bit(m_ostream, 2, "L");
-        break;
-    case BIT_2_MHL:
-        print_bit(m_ostream, 2, "(HL)");
-        break;
-    case BIT_2_A:
-        print_bit(m_ostream, 2, "A");
-        break;
-    case BIT_3_B:
-        print_bit(m_ostream, 3, "B");
-        break;
-    case BIT_3_C:
-        print_bit(m_ostream, 3, "C");
-        break;
-    case BIT_3_D:
-        print_bit(m_ostream, 3, "D");
-        break;
-    case BIT_3_E:
-        print_bit(m_ostream, 3, "E");
-        break;
-    case BIT_3_H:
-        print_bit(m_ostream, 3, "H");
-        break;
-    case BIT_3_L:
-        print_bit(m_ostream, 3, "L");
-        break;
-    case BIT_3_MHL:
-        print_bit(m_ostream, 3, "(HL)");
-        break;
-    case BIT_3_A:
-        print_bit(m_ostream, 3, "A");
-        break;
-    case BIT_4_B:
-        print_bit(m_ostream, 4, "B");
-        break;
-    case BIT_4_C:
-        print_bit(m_ostream, 4, "C");
-        break;
-    case BIT_4_D:
-        print_bit(m_ostream, 4, "D");
-        break;
-    case BIT_4_E:
-        print_bit(m_ostream, 4, "E");
-        break;
-    case BIT_4_H:
-        print_bit(m_ostream, 4, "H");
-        break;
-    case BIT_4_L:
-        print_bit(m_ostream, 4, "L");
-        break;
-    case BIT_4_MHL:
-        print_bit(m_ostream, 4, "(HL)");
-        break;
-    case BIT_4_A:
-        print_bit(m_ostream, 4, "A");
-        break;
-    case BIT_5_B:
-        print_bit(m_ostream, 5, "B");
-        break;
-    case BIT_5_C:
-        print_bit(m_ostream, 5, "C");
-        break;
-    case BIT_5_D:
-        print_bit(m_ostream, 5, "D");
-        break;
-    case BIT_5_E:
-        print_bit(m_ostream, 5, "E");
-        break;
-    case BIT_5_H:
-        print_bit(m_ostream, 5, "H");
-        break;
-    case BIT_5_L:
-        print_bit(m_ostream, 5, "L");
-        break;
-    case BIT_5_MHL:
-        print_bit(m_ostream, 5, "(HL)");
-        break;
-    case BIT_5_A:
-        print_bit(m_ostream, 5, "A");
-        break;
-    case BIT_6_B:
-        print_bit(m_ostream, 6, "B");
-        break;
-    case BIT_6_C:
-        print_bit(m_ostream, 6, "C");
-        break;
-    case BIT_6_D:
-        print_bit(m_ostream, 6, "D");
-        break;
-    case BIT_6_E:
-        print_bit(m_ostream, 6, "E");
-        break;
-    case BIT_6_H:
-        print_bit(m_ostream, 6, "H");
-        break;
-    case BIT_6_L:
-        print_bit(m_ostream, 6, "L");
-        break;
-    case BIT_6_MHL:
-        print_bit(m_ostream, 6, "(HL)");
-        break;
-    case BIT_6_A:
-        print_bit(m_ostream, 6, "A");
-        break;
-    case BIT_7_B:
-        print_bit(m_ostream, 7, "B");
-        break;
-    case BIT_7_C:
-        print_bit(m_ostream, 7, "C");
-        break;
-    case BIT_7_D:
-        print_bit(m_ostream, 7, "D");
-        break;
-    case BIT_7_E:
-        print_bit(m_ostream, 7, "E");
-        break;
-    case BIT_7_H:
-        print_bit(m_ostream, 7, "H");
-        break;
-    case BIT_7_L:
-        print_bit(m_ostream, 7, "L");
-        break;
-    case BIT_7_MHL:
-        print_bit(m_ostream, 7, "(HL)");
-        break;
-    case BIT_7_A:
-        print_bit(m_ostream, 7, "A");
-        break;
-    case RES_0_B:
-        print_res(m_ostream, 0, "B");
-        break;
-    case RES_0_C:
-        print_res(m_ostream, 0, "C");
-        break;
-    case RES_0_D:
-        print_res(m_ostream, 0, "D");
-        break;
-    case RES_0_E:
-        print_res(m_ostream, 0, "E");
-        break;
-    case RES_0_H:
-        print_res(m_ostream, 0, "H");
-        break;
-    case RES_0_L:
-        print_res(m_ostream, 0, "L");
-        break;
-    case RES_0_MHL:
-        print_res(m_ostream, 0, "(HL)");
-        break;
-    case RES_0_A:
-        print_res(m_ostream, 0, "A");
-        break;
-    case RES_1_B:
-        print_res(m_ostream, 1, "B");
-        break;
-    case RES_1_C:
-        print_res(m_ostream, 1, "C");
-        break;
-    case RES_1_D:
-        print_res(m_ostream, 1, "D");
-        break;
-    case RES_1_E:
-        print_res(m_ostream, 1, "E");
-        break;
-    case RES_1_H:
-        print_res(m_ostream, 1, "H");
-        break;
-    case RES_1_L:
-        print_res(m_ostream, 1, "L");
-        break;
-    case RES_1_MHL:
-        print_res(m_ostream, 1, "(HL)");
-        break;
-    case RES_1_A:
-        print_res(m_ostream, 1, "A");
-        break;
-    case RES_2_B:
-        print_res(m_ostream, 2, "B");
-        break;
-    case RES_2_C:
-        print_res(m_ostream, 2, "C");
-        break;
-    case RES_2_D:
-        print_res(m_ostream, 2, "D");
-        break;
-    case RES_2_E:
-        print_res(m_ostream, 2, "E");
-        break;
-    case RES_2_H:
-        print_res(m_ostream, 2, "H");
-        break;
-    case RES_2_L:
-        print_res(m_ostream, 2, "L");
-        break;
-    case RES_2_MHL:
-        print_res(m_ostream, 2, "(HL)");
-        break;
-    case RES_2_A:
-        print_res(m_ostream, 2, "A");
-        break;
-    case RES_3_B:
-        print_res(m_ostream, 3, "B");
-        break;
-    case RES_3_C:
-        print_res(m_ostream, 3, "C");
-        break;
-    case RES_3_D:
-        print_res(m_ostream, 3, "D");
-        break;
-    case RES_3_E:
-        print_res(m_ostream, 3, "E");
-        break;
-    case RES_3_H:
-        print_res(m_ostream, 3, "H");
-        break;
-    case RES_3_L:
-        print_res(m_ostream, 3, "L");
-        break;
-    case RES_3_MHL:
-        print_res(m_ostream, 3, "(HL)");
-        break;
-    case RES_3_A:
-        print_res(m_ostream, 3, "A");
-        break;
-    case RES_4_B:
-        print_res(m_ostream, 4, "B");
-        break;
-    case RES_4_C:
-        print_res(m_ostream, 4, "C");
-        break;
-    case RES_4_D:
-        print_res(m_ostream, 4, "D");
-        break;
-    case RES_4_E:
-        print_res(m_ostream, 4, "E");
-        break;
-    case RES_4_H:
-        print_res(m_ostream, 4, "H");
-        break;
-    case RES_4_L:
-        print_res(m_ostream, 4, "L");
-        break;
-    case RES_4_MHL:
-        print_res(m_ostream, 4, "(HL)");
-        break;
-    case RES_4_A:
-        print_res(m_ostream, 4, "A");
-        break;
-    case RES_5_B:
-        print_res(m_ostream, 5, "B");
-        break;
-    case RES_5_C:
-        print_res(m_ostream, 5, "C");
-        break;
-    case RES_5_D:
-        print_res(m_ostream, 5, "D");
-        break;
-    case RES_5_E:
-        print_res(m_ostream, 5, "E");
-        break;
-    case RES_5_H:
-        print_res(m_ostream, 5, "H");
-        break;
-    case RES_5_L:
-        print_res(m_ostream, 5, "L");
-        break;
-    case RES_5_MHL:
-        print_res(m_ostream, 5, "(HL)");
-        break;
-    case RES_5_A:
-        print_res(m_ostream, 5, "A");
-        break;
-    case RES_6_B:
-        print_res(m_ostream, 6, "B");
-        break;
-    case RES_6_C:
-        print_res(m_ostream, 6, "C");
-        break;
-    case RES_6_D:
-        print_res(m_ostream, 6, "D");
-        break;
-    case RES_6_E:
-        print_res(m_ostream, 6, "E");
-        break;
-    case RES_6_H:
-        print_res(m_ostream, 6, "H");
-        break;
-    case RES_6_L:
-        print_res(m_ostream, 6, "L");
-        break;
-    case RES_6_MHL:
-        print_res(m_ostream, 6, "(HL)");
-        break;
-    case RES_6_A:
-        print_res(m_ostream, 6, "A");
-        break;
-    case RES_7_B:
-        print_res(m_ostream, 7, "B");
-        break;
-    case RES_7_C:
-        print_res(m_ostream, 7, "C");
-        break;
-    case RES_7_D:
-        print_res(m_ostream, 7, "D");
-        break;
-    case RES_7_E:
-        print_res(m_ostream, 7, "E");
-        break;
-    case RES_7_H:
-        print_res(m_ostream, 7, "H");
-        break;
-    case RES_7_L:
-        print_res(m_ostream, 7, "L");
-        break;
-    case RES_7_MHL:
-        print_res(m_ostream, 7, "(HL)");
-        break;
-    case RES_7_A:
-        print_res(m_ostream, 7, "A");
-        break;
-    case SET_0_B:
-        print_set(m_ostream, 0, "B");
-        break;
-    case SET_0_C:
-        print_set(m_ostream, 0, "C");
-        break;
-    case SET_0_D:
-        print_set(m_ostream, 0, "D");
-        break;
-    case SET_0_E:
-        print_set(m_ostream, 0, "E");
-        break;
-    case SET_0_H:
-        print_set(m_ostream, 0, "H");
-        break;
-    case SET_0_L:
-        print_set(m_ostream, 0, "L");
-        break;
-    case SET_0_MHL:
-        print_set(m_ostream, 0, "(HL)");
-        break;
-    case SET_0_A:
-        print_set(m_ostream, 0, "A");
-        break;
-    case SET_1_B:
-        print_set(m_ostream, 1, "B");
-        break;
-    case SET_1_C:
-        print_set(m_ostream, 1, "C");
-        break;
-    case SET_1_D:
-        print_set(m_ostream, 1, "D");
-        break;
-    case SET_1_E:
-        print_set(m_ostream, 1, "E");
-        break;
-    case SET_1_H:
-        print_set(m_ostream, 1, "H");
-        break;
-    case SET_1_L:
-        print_set(m_ostream, 1, "L");
-        break;
-    case SET_1_MHL:
-        print_set(m_ostream, 1, "(HL)");
-        break;
-    case SET_1_A:
-        print_set(m_ostream, 1, "A");
-        break;
-    case SET_2_B:
-        print_set(m_ostream, 2, "B");
-        break;
-    case SET_2_C:
-        print_set(m_ostream, 2, "C");
-        break;
-    case SET_2_D:
-        print_set(m_ostream, 2, "D");
-        break;
-    case SET_2_E:
-        print_set(m_ostream, 2, "E");
-        break;
-    case SET_2_H:
-        print_set(m_ostream, 2, "H");
-        break;
-    case SET_2_L:
-        print_set(m_ostream, 2, "L");
-        break;
-    case SET_2_MHL:
-        print_set(m_ostream, 2, "(HL)");
-        break;
-    case SET_2_A:
-        print_set(m_ostream, 2, "A");
-        break;
-    case SET_3_B:
-        print_set(m_ostream, 3, "B");
-        break;
-    case SET_3_C:
-        print_set(m_ostream, 3, "C");
-        break;
-    case SET_3_D:
-        print_set(m_ostream, 3, "D");
-        break;
-    case SET_3_E:
-        print_set(m_ostream, 3, "E");
-        break;
-    case SET_3_H:
-        print_set(m_ostream, 3, "H");
-        break;
-    case SET_3_L:
-        print_set(m_ostream, 3, "L");
-        break;
-    case SET_3_MHL:
-        print_set(m_ostream, 3, "(HL)");
-        break;
-    case SET_3_A:
-        print_set(m_ostream, 3, "A");
-        break;
-    case SET_4_B:
-        print_set(m_ostream, 4, "B");
-        break;
-    case SET_4_C:
-        print_set(m_ostream, 4, "C");
-        break;
-    case SET_4_D:
-        print_set(m_ostream, 4, "D");
-        break;
-    case SET_4_E:
-        print_set(m_ostream, 4, "E");
-        break;
-    case SET_4_H:
-        print_set(m_ostream, 4, "H");
-        break;
-    case SET_4_L:
-        print_set(m_ostream, 4, "L");
-        break;
-    case SET_4_MHL:
-        print_set(m_ostream, 4, "(HL)");
-        break;
-    case SET_4_A:
-        print_set(m_ostream, 4, "A");
-        break;
-    case SET_5_B:
-        print_set(m_ostream, 5, "B");
-        break;
-    case SET_5_C:
-        print_set(m_ostream, 5, "C");
-        break;
-    case SET_5_D:
-        print_set(m_ostream, 5, "D");
-        break;
-    case SET_5_E:
-        print_set(m_ostream, 5, "E");
-        break;
-    case SET_5_H:
-        print_set(m_ostream, 5, "H");
-        break;
-    case SET_5_L:
-        print_set(m_ostream, 5, "L");
-        break;
-    case SET_5_MHL:
-        print_set(m_ostream, 5, "(HL)");
-        break;
-    case SET_5_A:
-        print_set(m_ostream, 5, "A");
-        break;
-    case SET_6_B:
-        print_set(m_ostream, 6, "B");
-        break;
-    case SET_6_C:
-        print_set(m_ostream, 6, "C");
-        break;
-    case SET_6_D:
-        print_set(m_ostream, 6, "D");
-        break;
-    case SET_6_E:
-        print_set(m_ostream, 6, "E");
-        break;
-    case SET_6_H:
-        print_set(m_ostream, 6, "H");
-        break;
-    case SET_6_L:
-        print_set(m_ostream, 6, "L");
-        break;
-    case SET_6_MHL:
-        print_set(m_ostream, 6, "(HL)");
-        break;
-    case SET_6_A:
-        print_set(m_ostream, 6, "A");
-        break;
-    case SET_7_B:
-        print_set(m_ostream, 7, "B");
-        break;
-    case SET_7_C:
-        print_set(m_ostream, 7, "C");
-        break;
-    case SET_7_D:
-        print_set(m_ostream, 7, "D");
-        break;
-    case SET_7_E:
-        print_set(m_ostream, 7, "E");
-        break;
-    case SET_7_H:
-        print_set(m_ostream, 7, "H");
-        break;
-    case SET_7_L:
-        print_set(m_ostream, 7, "L");
-        break;
-    case SET_7_MHL:
-        print_set(m_ostream, 7, "(HL)");
-        break;
-    case SET_7_A:
-        print_set(m_ostream, 7, "A");
-        break;
-    default:
-        m_ostream << hexify(bits_opcode) << " (data)";
-        break;
-    }
-}
-
-void Disassembler::print_next_ixy_instruction(u8 ixy_opcode, std::string const& ixy_reg)
-{
-    switch (ixy_opcode) {
-    case INC_B_UNDOC:
-        print_inc_undocumented(m_ostream, "B");
-        break;
-    case DEC_B_UNDOC:
-        print_dec_undocumented(m_ostream, "B");
-        break;
-    case LD_B_n_UNDOC:
-        print_ld_undocumented(m_ostream, "B", get_next_byte());
-        break;
-    case ADD_IXY_BC:
-        print_add(m_ostream, ixy_reg, "BC");
-        break;
-    case INC_C_UNDOC:
-        print_inc_undocumented(m_ostream, "C");
-        break;
-    case DEC_C_UNDOC:
-        print_dec_undocumented(m_ostream, "C");
-        break;
-    case LD_C_n_UNDOC:
-        print_ld_undocumented(m_ostream, "C", get_next_byte());
-        break;
-    case INC_D_UNDOC:
-        print_inc_undocumented(m_ostream, "D");
-        break;
-    case DEC_D_UNDOC:
-        print_dec_undocumented(m_ostream, "D");
-        break;
-    case LD_D_n_UNDOC:
-        print_ld_undocumented(m_ostream, "D", get_next_byte());
-        break;
-    case ADD_IXY_DE:
-        print_add(m_ostream, ixy_reg, "DE");
-        break;
-    case INC_E_UNDOC:
-        print_inc_undocumented(m_ostream, "E");
-        break;
-    case DEC_E_UNDOC:
-        print_dec_undocumented(m_ostream, "E");
-        break;
-    case LD_E_n_UNDOC:
-        print_ld_undocumented(m_ostream, "E", get_next_byte());
-        break;
-    case LD_IXY_nn:
-        print_ld_dd_nn(m_ostream, ixy_reg, get_next_word());
-        break;
-    case LD_Mnn_IXY:
-        print_ld_Mnn_dd(m_ostream, get_next_word(), ixy_reg);
-        break;
-    case INC_IXY:
-        print_inc(m_ostream, ixy_reg);
-        break;
-    case INC_IXH_UNDOC:
-        print_inc_undocumented(m_ostream, ixy_reg + "H");
-        break;
-    case DEC_IXH_UNDOC:
-        print_dec_undocumented(m_ostream, ixy_reg + "H");
-        break;
-    case LD_IXYH_n_UNDOC:
-        print_ld_undocumented(m_ostream, ixy_reg + "H", get_next_byte());
-        break;
-    case ADD_IXY_IXY:
-        print_add(m_ostream, ixy_reg, ixy_reg);
-        break;
-    case LD_IXY_Mnn:
-        print_ld(m_ostream, ixy_reg, get_next_word());
-        break;
-    case DEC_IXY:
-        print_dec(m_ostream, ixy_reg);
-        break;
-    case INC_IXL_UNDOC:
-        print_inc_undocumented(m_ostream, ixy_reg + "L");
-        break;
-    case DEC_IXL_UNDOC:
-        print_dec_undocumented(m_ostream, ixy_reg + "L");
-        break;
-    case LD_IXYL_n_UNDOC:
-        print_ld_undocumented(m_ostream, ixy_reg + "L", get_next_byte());
-        break;
-    case INC_MIXY_P_n:
-        print_inc_MixyPn(m_ostream, ixy_reg, get_next_byte());
-        break;
-    case DEC_MIXY_P_n:
-        print_dec_MixyPn(m_ostream, ixy_reg, get_next_byte());
-        break;
-    case LD_MIXY_P_n_d:
-        print_ld_MixyPd_n(m_ostream, ixy_reg, get_next_word());
-        break;
-    case ADD_IXY_SP:
-        print_add(m_ostream, ixy_reg, "SP");
-        break;
-    case INC_A_UNDOC:
-        print_inc_undocumented(m_ostream, "A");
-        break;
-    case DEC_A_UNDOC:
-        print_dec_undocumented(m_ostream, "A");
-        break;
-    case LD_A_n_UNDOC:
-        print_ld_undocumented(m_ostream, "A", get_next_byte());
-        break;
-    case LD_B_B_UNDOC:
-        print_ld_undocumented(m_ostream, "B", "B");
-        break;
-    case LD_B_C_UNDOC:
-        print_ld_undocumented(m_ostream, "B", "C");
-        break;
-    case LD_B_D_UNDOC:
-        print_ld_undocumented(m_ostream, "B", "D");
-        break;
-    case LD_B_E_UNDOC:
-        print_ld_undocumented(m_ostream, "B", "E");
-        break;
-    case LD_B_IXYH_UNDOC:
-        print_ld_undocumented(m_ostream, "B", ixy_reg + "H");
-        break;
-    case LD_B_IXYL_UNDOC:
-        print_ld_undocumented(m_ostream, "B", ixy_reg + "L");
-        break;
-    case LD_B_MIXY_P_n:
-        print_ld_r_MixyPn(m_ostream, "B", ixy_reg, get_next_byte());
-        break;
-    case LD_B_A_UNDOC:
-        print_ld_undocumented(m_ostream, "B", "A");
-        break;
-    case LD_C_B_UNDOC:
-        print_ld_undocumented(m_ostream, "C", "B");
-        break;
-    case LD_C_C_UNDOC:
-        print_ld_undocumented(m_ostream, "C", "C");
-        break;
-    case LD_C_D_UNDOC:
-        print_ld_undocumented(m_ostream, "C", "D");
-        break;
-    case LD_C_E_UNDOC:
-        print_ld_undocumented(m_ostream, "C", "E");
-        break;
-    case LD_C_IXYH_UNDOC:
-        print_ld_undocumented(m_ostream, "C", ixy_reg + "H");
-        break;
-    case LD_C_IXYL_UNDOC:
-        print_ld_undocumented(m_ostream, "C", ixy_reg + "L");
-        break;
-    case LD_C_MIXY_P_n:
-        print_ld_r_MixyPn(m_ostream, "C", ixy_reg, get_next_byte());
-        break;
-    case LD_C_A_UNDOC:
-        print_ld_undocumented(m_ostream, "C", "A");
-        break;
-    case LD_D_B_UNDOC:
-        print_ld_undocumented(m_ostream, "D", "B");
-        break;
-    case LD_D_C_UNDOC:
-        print_ld_undocumented(m_ostream, "D", "C");
-        break;
-    case LD_D_D_UNDOC:
-        print_ld_undocumented(m_ostream, "D", "D");
-        break;
-    case LD_D_E_UNDOC:
-        print_ld_undocumented(m_ostream, "D", "E");
-        break;
-    case LD_D_IXYH_UNDOC:
-        print_ld_undocumented(m_ostream, "D", ixy_reg + "H");
-        break;
-    case LD_D_IXYL_UNDOC:
-        print_ld_undocumented(m_ostream, "D", ixy_reg + "L");
-        break;
-    case LD_D_MIXY_P_n:
-        print_ld_r_MixyPn(m_ostream, "D", ixy_reg, get_next_byte());
-        break;
-    case LD_D_A_UNDOC:
-        print_ld_undocumented(m_ostream, "D", "A");
-        break;
-    case LD_E_B_UNDOC:
-        print_ld_undocumented(m_ostream, "E", "B");
-        break;
-    case LD_E_C_UNDOC:
-        print_ld_undocumented(m_ostream, "E", "C");
-        break;
-    case LD_E_D_UNDOC:
-        print_ld_undocumented(m_ostream, "E", "D");
-        break;
-    case LD_E_E_UNDOC:
-        print_ld_undocumented(m_ostream, "E", "E");
-        break;
-    case LD_E_IXYH_UNDOC:
-        print_ld_undocumented(m_ostream, "E", ixy_reg + "H");
-        break;
-    case LD_E_IXYL_UNDOC:
-        print_ld_undocumented(m_ostream, "E", ixy_reg + "L");
-        break;
-    case LD_E_MIXY_P_n:
-        print_ld_r_MixyPn(m_ostream, "E", ixy_reg, get_next_byte());
-        break;
-    case LD_E_A_UNDOC:
-        print_ld_undocumented(m_ostream, "E", "A");
-        break;
-    case LD_IXYH_B_UNDOC:
-        print_ld_undocumented(m_ostream, ixy_reg + "H", "B");
-        break;
-    case LD_IXYH_C_UNDOC:
-        print_ld_undocumented(m_ostream, ixy_reg + "H", "C");
-        break;
-    case LD_IXYH_D_UNDOC:
-        print_ld_undocumented(m_ostream, ixy_reg + "H", "D");
-        break;
-    case LD_IXYH_E_UNDOC:
-        print_ld_undocumented(m_ostream, ixy_reg + "H", "E");
-        break;
-    case LD_IXYH_IXYH_UNDOC:
-        print_ld_undocumented(m_ostream, ixy_reg + "H", ixy_reg + "H");
-        break;
-    case LD_IXYH_IXYL_UNDOC:
-        print_ld_undocumented(m_ostream, ixy_reg + "H", ixy_reg + "L");
-        break;
-    case LD_H_MIXY_P_n:
-        print_ld_r_MixyPn(m_ostream, "H", ixy_reg, get_next_byte());
-        break;
-    case LD_IXYH_A_UNDOC:
-        print_ld_undocumented(m_ostream, ixy_reg + "H", "A");
-        break;
-    case LD_IXYL_B_UNDOC:
-        print_ld_undocumented(m_ostream, ixy_reg + "L", "B");
-        break;
-    case LD_IXYL_C_UNDOC:
-        print_ld_undocumented(m_ostream, ixy_reg + "L", "C");
-        break;
-    case LD_IXYL_D_UNDOC:
-        print_ld_undocumented(m_ostream, ixy_reg + "L", "D");
-        break;
-    case LD_IXYL_E_UNDOC:
-        print_ld_undocumented(m_ostream, ixy_reg + "L", "E");
-        break;
-    case LD_IXYL_IXYH_UNDOC:
-        print_ld_undocumented(m_ostream, ixy_reg + "L", ixy_reg + "H");
-        break;
-    case LD_IXYL_IXYL_UNDOC:
-        print_ld_undocumented(m_ostream, ixy_reg + "L", ixy_reg + "L");
-        break;
-    case LD_L_MIXY_P_n:
-        print_ld_r_MixyPn(m_ostream, "L", ixy_reg, get_next_byte());
-        break;
-    case LD_IXYL_A_UNDOC:
-        print_ld_undocumented(m_ostream, ixy_reg + "L", "A");
-        break;
-    case LD_MIXY_P_n_B:
-        print_ld_MixyPd_r(m_ostream, ixy_reg, get_next_byte(), "B");
-        break;
-    case LD_MIXY_P_n_C:
-        print_ld_MixyPd_r(m_ostream, ixy_reg, get_next_byte(), "C");
-        break;
-    case LD_MIXY_P_n_D:
-        print_ld_MixyPd_r(m_ostream, ixy_reg, get_next_byte(), "D");
-        break;
-    case LD_MIXY_P_n_E:
-        print_ld_MixyPd_r(m_ostream, ixy_reg, get_next_byte(), "E");
-        break;
-    case LD_MIXY_P_n_H:
-        print_ld_MixyPd_r(m_ostream, ixy_reg, get_next_byte(), "H");
-        break;
-    case LD_MIXY_P_n_L:
-        print_ld_MixyPd_r(m_ostream, ixy_reg, get_next_byte(), "L");
-        break;
-    case LD_MIXY_P_n_A:
-        print_ld_MixyPd_r(m_ostream, ixy_reg, get_next_byte(), "A");
-        break;
-    case LD_A_B_UNDOC:
-        print_ld_undocumented(m_ostream, "A", "B");
-        break;
-    case LD_A_C_UNDOC:
-        print_ld_undocumented(m_ostream, "A", "C");
-        break;
-    case LD_A_D_UNDOC:
-        print_ld_undocumented(m_ostream, "A", "D");
-        break;
-    case LD_A_E_UNDOC:
-        print_ld_undocumented(m_ostream, "A", "E");
-        break;
-    case LD_A_IXYH_UNDOC:
-        print_ld_undocumented(m_ostream, "A", ixy_reg + "H");
-        break;
-    case LD_A_IXYL_UNDOC:
-        print_ld_undocumented(m_ostream, "A", ixy_reg + "L");
-        break;
-    case LD_A_MIXY_P_n:
-        print_ld_r_MixyPn(m_ostream, "A", ixy_reg, get_next_byte());
-        break;
-    case LD_A_A_UNDOC:
-        print_ld_undocumented(m_ostream, "A", "A");
-        break;
-    case ADD_A_B_UNDOC:
-        print_add_undocumented(m_ostream, "A", "B");
-        break;
-    case ADD_A_C_UNDOC:
-        print_add_undocumented(m_ostream, "A", "C");
-        break;
-    case ADD_A_D_UNDOC:
-        print_add_undocumented(m_ostream, "A", "D");
-        break;
-    case ADD_A_E_UNDOC:
-        print_add_undocumented(m_ostream, "A", "E");
-        break;
-    case ADD_A_IXYH_UNDOC:
-        print_add(m_ostream, "A", ixy_reg + "H");
-        break;
-    case ADD_A_IXYL_UNDOC:
-        print_add(m_ostream, "A", ixy_reg + "L");
-        break;
-    case ADD_A_MIXY_P_n:
-        print_add_MixyPn(m_ostream, "A", ixy_reg, get_next_byte());
-        break;
-    case ADD_A_A_UNDOC:
-        print_add_undocumented(m_ostream, "A", "A");
-        break;
-    case ADC_A_B_UNDOC:
-        print_adc_r_s_undocumented(m_ostream, "A", "B");
-        break;
-    case ADC_A_C_UNDOC:
-        print_adc_r_s_undocumented(m_ostream, "A", "C");
-        break;
-    case ADC_A_D_UNDOC:
-        print_adc_r_s_undocumented(m_ostream, "A", "D");
-        break;
-    case ADC_A_E_UNDOC:
-        print_adc_r_s_undocumented(m_ostream, "A", "E");
-        break;
-    case ADC_A_IXYH_UNDOC:
-        print_adc_r_s_undocumented(m_ostream, "A", ixy_reg + "H");
-        break;
-    case ADC_A_IXYL_UNDOC:
-        print_adc_r_s(m_ostream, "A", ixy_reg + "L");
-        break;
-    case ADC_A_MIXY_P_n:
-        print_adc_MixyPn(m_ostream, "A", ixy_reg, get_next_byte());
-        break;
-    case ADC_A_A_UNDOC:
-        print_adc_r_s_undocumented(m_ostream, "A", "A");
-        break;
-    case SUB_B_UNDOC:
-        print_sub_undocumented(m_ostream, "B");
-        break;
-    case SUB_C_UNDOC:
-        print_sub_undocumented(m_ostream, "C");
-        break;
-    case SUB_D_UNDOC:
-        print_sub_undocumented(m_ostream, "D");
-        break;
-    case SUB_E_UNDOC:
-        print_sub_undocumented(m_ostream, "E");
-        break;
-    case SUB_IXYH_UNDOC:
-        print_sub(m_ostream, ixy_reg + "H");
-        break;
-    case SUB_IXYL_UNDOC:
-        print_sub(m_ostream, ixy_reg + "L");
-        break;
-    case SUB_MIXY_P_n:
-        print_sub_MixyPn(m_ostream, ixy_reg, get_next_byte());
-        break;
-    case SUB_A_UNDOC:
-        print_sub_undocumented(m_ostream, "E");
-        break;
-    case SBC_A_B_UNDOC:
-        print_sbc_r_s_undocumented(m_ostream, "A", "B");
-        break;
-    case SBC_A_C_UNDOC:
-        print_sbc_r_s_undocumented(m_ostream, "A", "C");
-        break;
-    case SBC_A_D_UNDOC:
-        print_sbc_r_s_undocumented(m_ostream, "A", "D");
-        break;
-    case SBC_A_E_UNDOC:
-        print_sbc_r_s_undocumented(m_ostream, "A", "E");
-        break;
-    case SBC_A_IXYH_UNDOC:
-        print_sbc_r_s(m_ostream, "A", ixy_reg + "H");
-        break;
-    case SBC_A_IXYL_UNDOC:
-        print_sbc_r_s(m_ostream, "A", ixy_reg + "L");
-        break;
-    case SBC_A_MIXY_P_n:
-        print_sbc_MixyPn(m_ostream, "A", ixy_reg, get_next_byte());
-        break;
-    case SBC_A_A_UNDOC:
-        print_sbc_r_s_undocumented(m_ostream, "A", "A");
-        break;
-    case AND_B_UNDOC:
-        print_and_r_undocumented(m_ostream, "B");
-        break;
-    case AND_C_UNDOC:
-        print_and_r_undocumented(m_ostream, "C");
-        break;
-    case AND_D_UNDOC:
-        print_and_r_undocumented(m_ostream, "D");
-        break;
-    case AND_E_UNDOC:
-        print_and_r_undocumented(m_ostream, "E");
-        break;
-    case AND_IXYH_UNDOC:
-        print_and_r(m_ostream, ixy_reg + "H");
-        break;
-    case AND_IXYL_UNDOC:
-        print_and_r(m_ostream, ixy_reg + "L");
-        break;
-    case AND_MIXY_P_n:
-        print_and_MixyPn(m_ostream, ixy_reg, get_next_byte());
-        break;
-    case AND_A_UNDOC:
-        print_and_r_undocumented(m_ostream, "A");
-        break;
-    case XOR_B_UNDOC:
-        print_xor_r_undocumented(m_ostream, "B");
-        break;
-    case XOR_C_UNDOC:
-        print_xor_r_undocumented(m_ostream, "C");
-        break;
-    case XOR_D_UNDOC:
-        print_xor_r_undocumented(m_ostream, "D");
-        break;
-    case XOR_E_UNDOC:
-        print_xor_r_undocumented(m_ostream, "E");
-        break;
-    case XOR_IXYH_UNDOC:
-        print_xor_r(m_ostream, ixy_reg + "H");
-        break;
-    case XOR_IXYL_UNDOC:
-        print_xor_r(m_ostream, ixy_reg + "L");
-        break;
-    case XOR_MIXY_P_n:
-        print_xor_MixyPn(m_ostream, ixy_reg, get_next_byte());
-        break;
-    case XOR_A_UNDOC:
-        print_xor_r_undocumented(m_ostream, "A");
-        break;
-    case OR_B_UNDOC:
-        print_or_r_undocumented(m_ostream, "B");
-        break;
-    case OR_C_UNDOC:
-        print_or_r_undocumented(m_ostream, "C");
-        break;
-    case OR_D_UNDOC:
-        print_or_r_undocumented(m_ostream, "D");
-        break;
-    case OR_E_UNDOC:
-        print_or_r_undocumented(m_ostream, "E");
-        break;
-    case OR_IXYH_UNDOC:
-        print_or_r(m_ostream, ixy_reg + "H");
-        break;
-    case OR_IXYL_UNDOC:
-        print_or_r(m_ostream, ixy_reg + "L");
-        break;
-    case OR_MIXY_P_n:
-        print_or_MixyPn(m_ostream, ixy_reg, get_next_byte());
-        break;
-    case OR_A_UNDOC:
-        print_or_r_undocumented(m_ostream, "A");
-        break;
-    case CP_B_UNDOC:
-        print_cp_undocumented(m_ostream, "B");
-        break;
-    case CP_C_UNDOC:
-        print_cp_undocumented(m_ostream, "C");
-        break;
-    case CP_D_UNDOC:
-        print_cp_undocumented(m_ostream, "D");
-        break;
-    case CP_E_UNDOC:
-        print_cp_undocumented(m_ostream, "E");
-        break;
-    case CP_IXYH_UNDOC:
-        print_cp(m_ostream, ixy_reg + "H");
-        break;
-    case CP_IXYL_UNDOC:
-        print_cp(m_ostream, ixy_reg + "L");
-        break;
-    case CP_MIXY_P_n:
-        print_cp_MixyPn(m_ostream, ixy_reg, get_next_byte());
-        break;
-    case CP_A_UNDOC:
-        print_cp_undocumented(m_ostream, "A");
-        break;
-    case IXY_BITS:
-        print_next_ixy_bits_instruction(get_next_word(), ixy_reg);
-        break;
-    case POP_IXY:
-        print_pop(m_ostream, ixy_reg);
-        break;
-    case EX_MSP_IX:
-        print_ex(m_ostream, "(SP)", ixy_reg);
-        break;
-    case PUSH_IXY:
-        print_push(m_ostream, ixy_reg);
-        break;
-    case JP_MIXY:
-        print_jp_Mss(m_ostream, ixy_reg);
-        break;
-    case LD_SP_IXY:
-        print_ld(m_ostream, "SP", ixy_reg);
+    case EXTD:
+        switch (instruction.m_bytes[1]) {
+        case RETN:
+        case RETI:
+        case RETN_UNDOC1:
+        case RETN_UNDOC2:
+        case RETN_UNDOC3:
+        case RETN_UNDOC4:
+            instruction.m_control_flow = ControlFlow::Return;
+            break;
+        default:
+            break;
+        }
         break;
     default:
-        m_ostream << hexify(ixy_opcode) << " (data)";
         break;
     }
 }
 
-void Disassembler::print_next_ixy_bits_instruction(NextWord args, std::string const& ixy_reg)
+TEST_CASE("Z80: Disassembler")
 {
-    u8 d = args.farg;
-    u8 ixy_bits_opcode = args.sarg;
+    SUBCASE("should only refer to the bytes of the instruction in the mnemonics")
+    {
+        for (auto const& prefix : std::vector<std::vector<u8>> { {}, { BITS }, { IX }, { EXTD }, { IY }, { IX, IXY_BITS, 0x00 }, { IY, IXY_BITS, 0x00 } }) {
+            for (unsigned int opcode = 0; opcode <= 0xff; ++opcode) {
+                std::vector<u8> program = prefix;
+                program.push_back(opcode);
+                program.resize(8, 0);
+                EmulatorMemory<u16, u8> memory;
+                memory.add(program);
 
-    switch (ixy_bits_opcode) {
-    case RLC_MIXY_P_n_B_UNDOC1:
-        print_rlc_MixyPn_r(m_ostream, ixy_reg, d, "B");
-        break;
-    case RLC_MIXY_P_n_C_UNDOC1:
-        print_rlc_MixyPn_r(m_ostream, ixy_reg, d, "C");
-        break;
-    case RLC_MIXY_P_n_D_UNDOC1:
-        print_rlc_MixyPn_r(m_ostream, ixy_reg, d, "D");
-        break;
-    case RLC_MIXY_P_n_E_UNDOC1:
-        print_rlc_MixyPn_r(m_ostream, ixy_reg, d, "E");
-        break;
-    case RLC_MIXY_P_n_H_UNDOC1:
-        print_rlc_MixyPn_r(m_ostream, ixy_reg, d, "H");
-        break;
-    case RLC_MIXY_P_n_L_UNDOC1:
-        print_rlc_MixyPn_r(m_ostream, ixy_reg, d, "L");
-        break;
-    case RLC_MIXY_P_n:
-        print_rlc_MixyPn(m_ostream, ixy_reg, d);
-        break;
-    case RLC_MIXY_P_n_A_UNDOC1:
-        print_rlc_MixyPn_r(m_ostream, ixy_reg, d, "A");
-        break;
-    case RRC_MIXY_P_n:
-        print_rrc_MixyPn(m_ostream, ixy_reg, d);
-        break;
-    case RL_MIXY_P_n_B_UNDOC:
-        print_rl_MixyPn_r(m_ostream, ixy_reg, d, "B");
-        break;
-    case RL_MIXY_P_n_C_UNDOC:
-        print_rl_MixyPn_r(m_ostream, ixy_reg, d, "C");
-        break;
-    case RL_MIXY_P_n_D_UNDOC:
-        print_rl_MixyPn_r(m_ostream, ixy_reg, d, "D");
-        break;
-    case RL_MIXY_P_n_E_UNDOC:
-        print_rl_MixyPn_r(m_ostream, ixy_reg, d, "E");
-        break;
-    case RL_MIXY_P_n_H_UNDOC:
-        print_rl_MixyPn_r(m_ostream, ixy_reg, d, "H");
-        break;
-    case RL_MIXY_P_n_L_UNDOC:
-        print_rl_MixyPn_r(m_ostream, ixy_reg, d, "L");
-        break;
-    case RL_MIXY_P_n:
-        print_rl_MixyPn(m_ostream, ixy_reg, d);
-        break;
-    case RR_MIXY_P_n:
-        print_rr_MixyPn(m_ostream, ixy_reg, d);
-        break;
-    case SLA_MIXY_P_n:
-        print_sla_MixyPn(m_ostream, 0, ixy_reg, d);
-        break;
-    case SRA_MIXY_P_n:
-        print_sra_MixyPn(m_ostream, 0, ixy_reg, d);
-        break;
-    case SLL_MIXY_P_n:
-        print_sll_MixyPn(m_ostream, 0, ixy_reg, d);
-        break;
-    case SRL_MIXY_P_n:
-        print_srl_MixyPn(m_ostream, 0, ixy_reg, d);
-        break;
-    case BIT_0_MIXY_P_n:
-        print_bit_MixyPn(m_ostream, 0, ixy_reg, d);
-        break;
-    case BIT_1_MIXY_P_n:
-        print_bit_MixyPn(m_ostream, 1, ixy_reg, d);
-        break;
-    case BIT_2_MIXY_P_n:
-        print_bit_MixyPn(m_ostream, 2, ixy_reg, d);
-        break;
-    case BIT_3_MIXY_P_n:
-        print_bit_MixyPn(m_ostream, 3, ixy_reg, d);
-        break;
-    case BIT_4_MIXY_P_n:
-        print_bit_MixyPn(m_ostream, 4, ixy_reg, d);
-        break;
-    case BIT_5_MIXY_P_n:
-        print_bit_MixyPn(m_ostream, 5, ixy_reg, d);
-        break;
-    case BIT_6_MIXY_P_n:
-        print_bit_MixyPn(m_ostream, 6, ixy_reg, d);
-        break;
-    case BIT_7_MIXY_P_n:
-        print_bit_MixyPn(m_ostream, 7, ixy_reg, d);
-        break;
-    case RES_0_MIXY_P_n:
-        print_res_MixyPn(m_ostream, 0, ixy_reg, d);
-        break;
-    case RES_1_MIXY_P_n:
-        print_res_MixyPn(m_ostream, 1, ixy_reg, d);
-        break;
-    case RES_2_MIXY_P_n:
-        print_res_MixyPn(m_ostream, 2, ixy_reg, d);
-        break;
-    case RES_3_MIXY_P_n:
-        print_res_MixyPn(m_ostream, 3, ixy_reg, d);
-        break;
-    case RES_4_MIXY_P_n:
-        print_res_MixyPn(m_ostream, 4, ixy_reg, d);
-        break;
-    case RES_5_MIXY_P_n:
-        print_res_MixyPn(m_ostream, 5, ixy_reg, d);
-        break;
-    case RES_6_MIXY_P_n:
-        print_res_MixyPn(m_ostream, 6, ixy_reg, d);
-        break;
-    case RES_7_MIXY_P_n:
-        print_res_MixyPn(m_ostream, 7, ixy_reg, d);
-        break;
-    case SET_0_MIXY_P_n:
-        print_set_MixyPn(m_ostream, 0, ixy_reg, d);
-        break;
-    case SET_1_MIXY_P_n:
-        print_set_MixyPn(m_ostream, 1, ixy_reg, d);
-        break;
-    case SET_2_MIXY_P_n:
-        print_set_MixyPn(m_ostream, 2, ixy_reg, d);
-        break;
-    case SET_3_MIXY_P_n:
-        print_set_MixyPn(m_ostream, 3, ixy_reg, d);
-        break;
-    case SET_4_MIXY_P_n:
-        print_set_MixyPn(m_ostream, 4, ixy_reg, d);
-        break;
-    case SET_5_MIXY_P_n:
-        print_set_MixyPn(m_ostream, 5, ixy_reg, d);
-        break;
-    case SET_6_MIXY_P_n:
-        print_set_MixyPn(m_ostream, 6, ixy_reg, d);
-        break;
-    case SET_7_MIXY_P_n:
-        print_set_MixyPn(m_ostream, 7, ixy_reg, d);
-        break;
-    default:
-        throw UnrecognizedOpcodeException(ixy_bits_opcode, "IX/IY bits instructions");
+                DecodedInstruction<u16, u8> instruction = Disassembler::decode(memory, 0);
+                std::string line;
+                format_instruction(instruction, line);
+
+                std::fill(instruction.m_bytes.begin() + static_cast<std::ptrdiff_t>(instruction.m_length), instruction.m_bytes.end(), 0xff);
+                std::string line_with_other_bytes_after;
+                format_instruction(instruction, line_with_other_bytes_after);
+
+                CHECK_EQ(line, line_with_other_bytes_after);
+            }
+        }
     }
-}
 
-void Disassembler::print_next_extd_instruction(u8 extd_opcode)
-{
-    switch (extd_opcode) {
-    case IN_B_C:
-        print_in_r_r(m_ostream, "B", "C");
-        break;
-    case OUT_C_B:
-        print_out_r_r(m_ostream, "C", "B");
-        break;
-    case SBC_HL_BC:
-        print_sbc_r_s(m_ostream, "HL", "BC");
-        break;
-    case LD_Mnn_BC:
-        print_ld_Mnn_dd(m_ostream, get_next_word(), "BC");
-        break;
-    case NEG_UNDOC1:
-    case NEG_UNDOC2:
-    case NEG_UNDOC3:
-    case NEG_UNDOC4:
-    case NEG_UNDOC5:
-    case NEG_UNDOC6:
-    case NEG_UNDOC7:
-    case NEG:
-        print_neg(m_ostream);
-        break;
-    case RETN:
-        print_retn(m_ostream);
-        break;
-    case LD_I_A:
-        print_ld(m_ostream, "I", "A");
-        break;
-    case IM_0_1:
-    case IM_0_2:
-    case IM_0_3:
-        print_im(m_ostream, 0);
-        break;
-    case IN_C_C:
-        print_in_r_r(m_ostream, "C", "C");
-        break;
-    case OUT_C_C:
-        print_out_r_r(m_ostream, "C", "C");
-        break;
-    case ADC_HL_BC:
-        print_adc_r_s(m_ostream, "HL", "BC");
-        break;
-    case LD_BC_Mnn:
-        print_ld(m_ostream, "BC", get_next_word());
-        break;
-    case RETI:
-        print_reti(m_ostream);
-        break;
-    case LD_R_A:
-        print_ld(m_ostream, "R", "A");
-        break;
-    case IN_D_C:
-        print_in_r_r(m_ostream, "D", "C");
-        break;
-    case OUT_C_D:
-        print_out_r_r(m_ostream, "C", "D");
-        break;
-    case SBC_HL_DE:
-        print_sbc_r_s(m_ostream, "HL", "DE");
-        break;
-    case LD_Mnn_DE:
-        print_ld_Mnn_dd(m_ostream, get_next_word(), "DE");
-        break;
-    case IM_2_0:
-    case IM_2_1:
-        print_im(m_ostream, 2);
-        break;
-    case LD_A_R:
-        print_ld(m_ostream, "A", "R");
-        break;
-    case IN_H_C:
-        print_in_r_r(m_ostream, "H", "C");
-        break;
-    case OUT_C_H:
-        print_out_r_r(m_ostream, "C", "H");
-        break;
-    case SBC_HL_HL:
-        print_sbc_r_s(m_ostream, "HL", "HL");
-        break;
-    case LD_Mnn_HL_UNDOC:
-        print_ld_Mnn_dd_undocumented(m_ostream, get_next_word(), "HL");
-        break;
-    case SBC_HL_SP:
-        print_sbc_r_s(m_ostream, "HL", "SP");
-        break;
-    case IM_1_1:
-    case IM_1_2:
-        print_im(m_ostream, 1);
-        break;
-    case LD_A_I:
-        print_ld(m_ostream, "A", "I");
-        break;
-    case IN_A_C:
-        print_in_r_r(m_ostream, "A", "C");
-        break;
-    case OUT_C_A:
-        print_out_r_r(m_ostream, "C", "A");
-        break;
-    case IN_E_C:
-        print_in_r_r(m_ostream, "E", "C");
-        break;
-    case OUT_C_E:
-        print_out_r_r(m_ostream, "C", "E");
-        break;
-    case ADC_HL_DE:
-        print_adc_r_s(m_ostream, "HL", "DE");
-        break;
-    case LD_DE_Mnn:
-        print_ld_dd_Mnn(m_ostream, "DE", get_next_word());
-        break;
-    case RRD:
-        print_rrd(m_ostream);
-        break;
-    case IN_L_C:
-        print_in_r_r(m_ostream, "L", "C");
-        break;
-    case OUT_C_L:
-        print_out_r_r(m_ostream, "C", "L");
-        break;
-    case ADC_HL_HL:
-        print_adc_r_s(m_ostream, "HL", "HL");
-        break;
-    case LD_HL_Mnn_UNDOC:
-        print_ld_dd_Mnn_undocumented(m_ostream, "HL", get_next_word());
-        break;
-    case RLD:
-        print_rld(m_ostream);
-        break;
-    case IN_C:
-        print_in_undocumented(m_ostream, "(C)");
-        break;
-    case OUT_C_0:
-        print_out_r_r_undocumented(m_ostream, "C", "0");
-        break;
-    case LD_Mnn_SP:
-        print_ld_Mnn_dd(m_ostream, get_next_word(), "SP");
-        break;
-    case ADC_HL_SP:
-        print_adc_r_s(m_ostream, "HL", "SP");
-        break;
-    case LD_SP_Mnn:
-        print_ld(m_ostream, "SP", get_next_word());
-        break;
-    case LDI:
-        print_ldi(m_ostream);
-        break;
-    case CPI:
-        print_cpi(m_ostream);
-        break;
-    case INI:
-        print_ini(m_ostream);
-        break;
-    case OUTI:
-        print_outi(m_ostream);
-        break;
-    case LDD:
-        print_ldd(m_ostream);
-        break;
-    case CPD:
-        print_cpd(m_ostream);
-        break;
-    case IND:
-        print_ind(m_ostream);
-        break;
-    case OUTD:
-        print_outd(m_ostream);
-        break;
-    case LDIR:
-        print_ldir(m_ostream);
-        break;
-    case CPIR:
-        print_cpir(m_ostream);
-        break;
-    case INIR:
-        print_inir(m_ostream);
-        break;
-    case OTIR:
-        print_otir(m_ostream);
-        break;
-    case LDDR:
-        print_lddr(m_ostream);
-        break;
-    case CPDR:
-        print_cpdr(m_ostream);
-        break;
-    case INDR:
-        print_indr(m_ostream);
-        break;
-    case OTDR:
-        print_otdr(m_ostream);
-        break;
-    default:
-        m_ostream << hexify(extd_opcode) << " (data)";
-        break;
+    SUBCASE("should list one line per instruction")
+    {
+        EmulatorMemory<u16, u8> memory;
+        memory.add({ LD_BC_nn, 0x34, 0x12, IX, LD_MIXY_P_n_d, 0xfb, 0x0a, IX, IXY_BITS, 0x01, 0x08 });
+        std::stringstream ss;
+
+        Disassembler(memory, ss).disassemble();
+
+        CHECK_EQ("0000\t\tLD BC,1234\n0003\t\tLD (IX-5),0a\n0007\t\tdb dd\n0008\t\tRLC C\n000a\t\tEX AF,AF'\n", ss.str());
     }
-}
 
-NextByte Disassembler::get_next_byte()
-{
-    return {
-        .farg = m_memory.read(m_pc++)
-    };
+    SUBCASE("should fill in the operands when the instruction is formatted")
+    {
+        EmulatorMemory<u16, u8> memory;
+        memory.add({ IX, LD_MIXY_P_n_d, 0xfb, 0x0a, DJNZ, 0xfe });
+        std::string line;
+
+        format_instruction(Disassembler::decode(memory, 0), line);
+        CHECK_EQ("0000\t\tLD (IX-5),0a", line);
+        format_instruction(Disassembler::decode(memory, 4), line);
+        CHECK_EQ("0004\t\tDJNZ -02", line);
+    }
+
+    SUBCASE("should decode where the execution continues after jumps, calls and returns")
+    {
+        EmulatorMemory<u16, u8> memory;
+        memory.add({ JR_e, 0xfe, DJNZ, 0x04, IX, JP_MIXY, EXTD, RETI, CALL_NZ, 0x00, 0x40, RST_7, EXTD, LD_Mnn_BC, 0x00, 0x00 });
+
+        CHECK_EQ(ControlFlow::Jump, Disassembler::decode(memory, 0).m_control_flow);
+        CHECK_EQ(0x0000, Disassembler::decode(memory, 0).m_target);
+        CHECK_EQ(ControlFlow::ConditionalJump, Disassembler::decode(memory, 2).m_control_flow);
+        CHECK_EQ(0x0008, Disassembler::decode(memory, 2).m_target);
+        CHECK_EQ(ControlFlow::IndirectJump, Disassembler::decode(memory, 4).m_control_flow);
+        CHECK_EQ(ControlFlow::Return, Disassembler::decode(memory, 6).m_control_flow);
+        CHECK_EQ(ControlFlow::Call, Disassembler::decode(memory, 8).m_control_flow);
+        CHECK_EQ(0x4000, Disassembler::decode(memory, 8).m_target);
+        CHECK_EQ(ControlFlow::Call, Disassembler::decode(memory, 11).m_control_flow);
+        CHECK_EQ(0x0038, Disassembler::decode(memory, 11).m_target);
+        CHECK_EQ(ControlFlow::Sequential, Disassembler::decode(memory, 12).m_control_flow);
+    }
 }
 
-NextWord Disassembler::get_next_word()
+/**
+ * The ROM is filled with pseudo-random bytes, so that every kind of instruction is disassembled.
+ * The last bytes are zero, so that no instruction is cut off by the end of the ROM.
+ */
+BENCHMARK("Z80: Disassembler, 16 KB ROM")
 {
-    return {
-        .farg = m_memory.read(m_pc++),
-        .sarg = m_memory.read(m_pc++)
-    };
+    std::vector<u8> rom = pseudo_random_bytes(16 * 1024);
+    std::fill(rom.end() - 4, rom.end(), 0);
+
+    EmulatorMemory<u16, u8> memory;
+    memory.add(rom);
+
+    bench.run([&]() {
+        std::stringstream ss;
+        Disassembler disassembler(memory, ss);
+        disassembler.disassemble();
+        do_not_optimize(ss);
+    });
 }
 }
@@ -1,11 +1,9 @@
 #pragma once
 
-#include "crosscutting/memory/next_byte.h"
-#include "crosscutting/memory/next_word.h"
+#include "crosscutting/debugging/decoded_instruction.h"
 #include "crosscutting/typedefs.h"
 #include <cstddef>
 #include <iosfwd>
-#include <string>
 
 namespace emu::memory {
 template<class A, class D>
@@ -14,35 +12,30 @@ class EmulatorMemory;
 
 namespace emu::z80 {
 
+using emu::debugger::DecodedInstruction;
 using emu::memory::EmulatorMemory;
-using emu::memory::NextByte;
-using emu::memory::NextWord;
 
 class Disassembler {
 public:
-    Disassembler(EmulatorMemory<u16, u8>& memory, std::ostream& iostream);
+    Disassembler(EmulatorMemory<u16, u8> const& memory, std::ostream& iostream);
 
     void disassemble();
 
+    /**
+     * Decodes the instruction at the given address without formatting it. The mnemonic is kept
+     * in the instruction, so the line can be formatted later with format_instruction.
+     *
+     * @param memory is the memory to decode from
+     * @param address is the address of the instruction
+     * @return the decoded instruction
+     */
+    static DecodedInstruction<u16, u8> decode(EmulatorMemory<u16, u8> const& memory, u16 address);
+
 private:
-    EmulatorMemory<u16, u8>& m_memory;
+    EmulatorMemory<u16, u8> const& m_memory;
     std::size_t m_memory_size;
-    u16 m_pc;
-    u8 m_opcode;
     std::ostream& m_ostream;
 
-    void print_next_instruction();
-
-    void print_next_bits_instruction(u8 bits_opcode);
-
-    void print_next_ixy_instruction(u8 ixy_opcode, std::string const& ixy_reg);
-
-    void print_next_ixy_bits_instruction(NextWord args, std::string const& ixy_reg);
-
-    void print_next_extd_instruction(u8 extd_opcode);
-
-    NextByte get_next_byte();
-
-    NextWord get_next_word();
+    static void decode_control_flow(DecodedInstruction<u16, u8>& instruction);
 };
 }
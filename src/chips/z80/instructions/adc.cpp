@@ -3,12 +3,9 @@
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
@@ -16,7 +13,6 @@ using emu::memory::NextByte;
 using emu::util::byte::high_byte;
 using emu::util::byte::low_byte;
 using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 void adc(u8& acc_reg, u8 value, Flags& flag_reg)
 {
@@ -192,45 +188,6 @@ void adc_A_ixy_h_or_l(u8& acc_reg, u8 ixy_reg_h_or_l, Flags& flag_reg, cyc& cycl
 
 /******************************** END OF FUNCTIONS FOR UNDOCUMENTED INSTRUCTIONS **********************************/
 
-void print_adc_r_s(std::ostream& ostream, std::string const& dest, std::string const& src)
-{
-    ostream << "ADC "
-            << dest
-            << ", "
-            << src;
-}
-
-void print_adc_r_s_undocumented(std::ostream& ostream, std::string const& dest, std::string const& src)
-{
-    ostream << "ADC "
-            << dest
-            << ", "
-            << src
-            << "*";
-}
-
-void print_adc_r_n(std::ostream& ostream, std::string const& reg, NextByte const& args)
-{
-    ostream << "ADC "
-            << reg
-            << ", "
-            << hexify_wo_0x(args.farg);
-}
-
-void print_adc_MixyPn(std::ostream& ostream, std::string const& reg, std::string const& ixy_reg, NextByte const& args)
-{
-    const i8 signed_value = static_cast<i8>(args.farg);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "ADC "
-            << reg
-            << ",("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << ")";
-}
-
 TEST_CASE("Z80: ADC (8-bit)")
 {
     u8 acc_reg = 0;
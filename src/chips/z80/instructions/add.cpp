@@ -1,14 +1,12 @@
 #include "chips/z80/flags.h"
+#include "chips/z80/register_file.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
@@ -16,7 +14,6 @@ using emu::memory::NextByte;
 using emu::util::byte::high_byte;
 using emu::util::byte::low_byte;
 using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 void add(u8& acc_reg, u8 value, Flags& flag_reg)
 {
@@ -199,14 +196,16 @@ void add_HL_ss(u8& h_reg, u8& l_reg, u16 value, Flags& flag_reg, cyc& cycles)
  *   <li>Condition bits affected: carry, half carry, add/subtract</li>
  * </ul>
  *
- * @param ixy_reg is the IX or IY register, which will be mutated
+ * @param registers is the register file, where the index register and the flags will be mutated
+ * @param ixy is the index register to add to
  * @param value_to_add contains the argument that should be added to IX or IY
- * @param flag_reg is the flag register, which will be mutated
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void add_ixy_pp(u16& ixy_reg, u16 value_to_add, Flags& flag_reg, cyc& cycles)
+void add_ixy_pp(RegisterFile& registers, IndexRegister ixy, u16 value_to_add, cyc& cycles)
 {
-    add(ixy_reg, value_to_add, flag_reg);
+    u16 ixy_reg = registers.index(ixy);
+    add(ixy_reg, value_to_add, registers.f());
+    registers.set_index(ixy, ixy_reg);
 
     cycles = 15;
 }
@@ -236,46 +235,6 @@ void add_A_r_undoc(u8& acc_reg, u8 value, Flags& flag_reg, cyc& cycles)
 
 /******************************** END OF FUNCTIONS FOR UNDOCUMENTED INSTRUCTIONS **********************************/
 
-void print_add(std::ostream& ostream, std::string const& dest, std::string const& src)
-{
-    ostream << "ADD "
-            << dest
-            << ", "
-            << src;
-}
-
-void print_add_undocumented(std::ostream& ostream, std::string const& dest, std::string const& src)
-{
-    ostream << "ADD "
-            << dest
-            << ", "
-            << src
-            << "*";
-}
-
-void print_add_r_n(std::ostream& ostream, std::string const& reg, NextByte const& args)
-{
-    ostream << "ADD "
-            << reg
-            << ", "
-            << hexify_wo_0x(args.farg);
-}
-
-void print_add_MixyPn(std::ostream& ostream, std::string const& reg, std::string const& ixy_reg,
-    NextByte const& args)
-{
-    const i8 signed_value = static_cast<i8>(args.farg);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "ADD "
-            << reg
-            << ",("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << ")";
-}
-
 TEST_CASE("Z80: ADD")
 {
     u8 acc_reg = 0;
@@ -2,17 +2,13 @@
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
 using emu::memory::EmulatorMemory;
 using emu::memory::NextByte;
-using emu::util::string::hexify_wo_0x;
 
 void and_(u8& acc_reg, u8 value, Flags& flag_reg)
 {
@@ -181,38 +177,6 @@ void and_ixy_h_or_l(u8& acc_reg, u8 ixy_reg_h_or_l, Flags& flag_reg, cyc& cycles
 
 /******************************** END OF FUNCTIONS FOR UNDOCUMENTED INSTRUCTIONS **********************************/
 
-void print_and_r(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "AND "
-            << reg;
-}
-
-void print_and_r_undocumented(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "AND "
-            << reg
-            << "*";
-}
-
-void print_and_n(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "AND "
-            << hexify_wo_0x(args.farg);
-}
-
-void print_and_MixyPn(std::ostream& ostream, std::string const& ixy_reg, NextByte const& args)
-{
-    const i8 signed_value = static_cast<i8>(args.farg);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "AND "
-            << "("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << ")";
-}
-
 TEST_CASE("Z80: AND")
 {
     u8 acc_reg = 0;
@@ -6,13 +6,10 @@
 #include "instruction_util.h"
 #include <cassert>
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
 using emu::util::byte::is_bit_set;
-using emu::util::byte::set_bit;
 
 void bit(unsigned int bit_number, u8 reg, Flags& flag_reg)
 {
@@ -127,32 +124,6 @@ void bit_MixyPd(unsigned int bit_number, u16 ixy_reg, u8 d, EmulatorMemory<u16,
     cycles = 20;
 }
 
-void print_bit(std::ostream& ostream, unsigned int bit_number, std::string const& src)
-{
-    assert(bit_number < 8);
-
-    ostream << "BIT "
-            << bit_number
-            << ", "
-            << src;
-}
-
-void print_bit_MixyPn(std::ostream& ostream, unsigned int bit_number, std::string const& ixy_reg, u8 d)
-{
-    assert(bit_number < 8);
-
-    const i8 signed_value = static_cast<i8>(d);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "BIT "
-            << bit_number
-            << ", ("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << ")";
-}
-
 TEST_CASE("Z80: BIT r")
 {
     cyc cycles = 0;
@@ -2,19 +2,15 @@
 #include "crosscutting/memory/next_word.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include "flags.h"
 #include "instruction_util.h"
-#include <iostream>
-#include <string>
 #include <vector>
 
 namespace emu::z80 {
 
 using emu::memory::NextWord;
 using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Call
@@ -246,22 +242,6 @@ void call_m(u16& pc, u16& sp, EmulatorMemory<u16, u8>& memory, NextWord const& a
     }
 }
 
-void print_call_nn(std::ostream& ostream, NextWord const& args)
-{
-    ostream << "CALL "
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg);
-}
-
-void print_call_cc_nn(std::ostream& ostream, NextWord const& args, std::string const& condition)
-{
-    ostream << "CALL "
-            << condition
-            << ", "
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg);
-}
-
 TEST_CASE("Z80: CALL")
 {
     cyc cycles = 0;
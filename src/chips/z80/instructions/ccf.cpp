@@ -2,7 +2,6 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::z80 {
 
@@ -47,11 +46,6 @@ void ccf(Flags& flag_reg, u8 acc_reg, cyc& cycles)
     cycles = 4;
 }
 
-void print_ccf(std::ostream& ostream)
-{
-    ostream << "CCF";
-}
-
 TEST_CASE("Z80: CCF")
 {
     cyc cycles = 0;
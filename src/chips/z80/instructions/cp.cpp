@@ -3,18 +3,14 @@
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
 using emu::memory::NextByte;
 using emu::util::byte::is_bit_set;
-using emu::util::string::hexify_wo_0x;
 
 void cp(u8& acc_reg, u8 value, Flags& flag_reg)
 {
@@ -173,38 +169,6 @@ void cp_ixy_h_or_l(u8& acc_reg, u8 ixy_reg_h_or_l, Flags& flag_reg, cyc& cycles)
 
 /******************************** END OF FUNCTIONS FOR UNDOCUMENTED INSTRUCTIONS **********************************/
 
-void print_cp(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "CP "
-            << reg;
-}
-
-void print_cp_undocumented(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "CP "
-            << reg
-            << "*";
-}
-
-void print_cp(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "CP "
-            << hexify_wo_0x(args.farg);
-}
-
-void print_cp_MixyPn(std::ostream& ostream, std::string const& ixy_reg, NextByte const& args)
-{
-    const i8 signed_value = static_cast<i8>(args.farg);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "CP "
-            << "("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << ")";
-}
-
 TEST_CASE("Z80: CP")
 {
     u8 acc_reg = 0;
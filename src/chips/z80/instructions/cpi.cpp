@@ -3,7 +3,6 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::z80 {
 
@@ -74,9 +73,4 @@ void cpi(u8& b_reg, u8& c_reg, u8& h_reg, u8& l_reg, u8 acc_reg, EmulatorMemory<
 
     cycles = 16;
 }
-
-void print_cpi(std::ostream& ostream)
-{
-    ostream << "CPI";
-}
 }
@@ -3,7 +3,6 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::z80 {
 
@@ -80,9 +79,4 @@ void cpir(u16& pc, u8& b_reg, u8& c_reg, u8& h_reg, u8& l_reg, u8 acc_reg, Emula
         pc -= 2;
     }
 }
-
-void print_cpir(std::ostream& ostream)
-{
-    ostream << "CPIR";
-}
 }
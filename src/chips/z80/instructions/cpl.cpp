@@ -3,7 +3,6 @@
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
 #include <cstdint>
-#include <iostream>
 
 namespace emu::z80 {
 
@@ -44,11 +43,6 @@ void cpl(u8& acc_reg, Flags& flag_reg, cyc& cycles)
     cycles = 4;
 }
 
-void print_cpl(std::ostream& ostream)
-{
-    ostream << "CPL";
-}
-
 TEST_CASE("Z80: CPL")
 {
     SUBCASE("should complement the accumulator and always set half carry and add/subtract flags")
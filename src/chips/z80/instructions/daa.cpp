@@ -3,12 +3,9 @@
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
-#include <iostream>
 
 namespace emu::z80 {
 
-using emu::util::byte::is_bit_set;
-
 /**
  * Decimal adjust accumulator
  * <ul>
@@ -64,11 +61,6 @@ void daa(u8& acc_reg, Flags& flag_reg, cyc& cycles)
     cycles = 4;
 }
 
-void print_daa(std::ostream& ostream)
-{
-    ostream << "DAA";
-}
-
 TEST_CASE("Z80: DAA")
 {
     cyc cycles = 0;
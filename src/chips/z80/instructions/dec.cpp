@@ -1,4 +1,5 @@
 #include "chips/z80/flags.h"
+#include "chips/z80/register_file.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
@@ -6,16 +7,11 @@
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
 using emu::memory::NextByte;
 using emu::util::byte::borrow_from;
-using emu::util::byte::high_byte;
-using emu::util::byte::low_byte;
-using emu::util::byte::to_u16;
 
 void dec_u8(u8& reg, Flags& flag_reg)
 {
@@ -81,17 +77,13 @@ void dec_MHL(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc&
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param reg1 is the first register in the register pair, which will be mutated
- * @param reg2 is the second register in the register pair, which will be mutated
+ * @param registers is the register file, which will be mutated
+ * @param ss is the register pair to decrement
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void dec_ss(u8& reg1, u8& reg2, cyc& cycles)
+void dec_ss(RegisterFile& registers, RegisterPair ss, cyc& cycles)
 {
-    u16 val = to_u16(reg1, reg2);
-    --val;
-
-    reg2 = low_byte(val);
-    reg1 = high_byte(val);
+    registers.set_pair(ss, registers.pair(ss) - 1);
 
     cycles = 6;
 }
@@ -124,66 +116,17 @@ void dec_sp(u16& sp, cyc& cycles)
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param ixy_reg is either the IX or IY register, which will be mutated
+ * @param registers is the register file, which will be mutated
+ * @param ixy is the index register to decrement
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void dec_ixy(u16& ixy_reg, cyc& cycles)
+void dec_ixy(RegisterFile& registers, IndexRegister ixy, cyc& cycles)
 {
-    --ixy_reg;
+    registers.set_index(ixy, registers.index(ixy) - 1);
 
     cycles = 10;
 }
 
-/**
- * Decrement IXH/IYH
- * <ul>
- *   <li>Size: 2</li>
- *   <li>Cycles: 6</li>
- *   <li>States: 8</li>
- *   <li>Condition bits affected: half carry, zero, sign, parity/overflow, add/subtract</li>
- * </ul>
- *
- * @param ixy_reg is the IX or IY register
- * @param flag_reg is the flag register, which will be mutated
- * @param cycles is the number of cycles variable, which will be mutated
- */
-void dec_ixyh(u16& ixy_reg, Flags& flag_reg, cyc& cycles)
-{
-    u8 ixyh = high_byte(ixy_reg);
-    const u8 ixyl = low_byte(ixy_reg);
-
-    dec_u8(ixyh, flag_reg);
-
-    ixy_reg = to_u16(ixyh, ixyl);
-
-    cycles = 8;
-}
-
-/**
- * Decrement IXL/IYL
- * <ul>
- *   <li>Size: 2</li>
- *   <li>Cycles: 6</li>
- *   <li>States: 8</li>
- *   <li>Condition bits affected: half carry, zero, sign, parity/overflow, add/subtract</li>
- * </ul>
- *
- * @param ixy_reg is the IX or IY register
- * @param flag_reg is the flag register, which will be mutated
- * @param cycles is the number of cycles variable, which will be mutated
- */
-void dec_ixyl(u16& ixy_reg, Flags& flag_reg, cyc& cycles)
-{
-    const u8 ixyh = high_byte(ixy_reg);
-    u8 ixyl = low_byte(ixy_reg);
-
-    dec_u8(ixyl, flag_reg);
-
-    ixy_reg = to_u16(ixyh, ixyl);
-
-    cycles = 8;
-}
-
 /**
  * Decrement value in memory pointed to by IX or IY plus d
  * <ul>
@@ -235,32 +178,6 @@ void dec_r_undoc(u8& reg, Flags& flag_reg, cyc& cycles)
 
 /******************************** END OF FUNCTIONS FOR UNDOCUMENTED INSTRUCTIONS **********************************/
 
-void print_dec(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "DEC "
-            << reg;
-}
-
-void print_dec_undocumented(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "DEC "
-            << reg
-            << "*";
-}
-
-void print_dec_MixyPn(std::ostream& ostream, std::string const& ixy_reg, NextByte const& args)
-{
-    const i8 signed_value = static_cast<i8>(args.farg);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "DEC "
-            << "("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << ")";
-}
-
 TEST_CASE("Z80: DEC (8-bit)")
 {
     SUBCASE("should decrease value by 1")
@@ -300,14 +217,31 @@ TEST_CASE("Z80: DEC r")
 
 TEST_CASE("Z80: DEC ss")
 {
+    SUBCASE("should decrease register pair")
+    {
+        cyc cycles = 0;
+        RegisterFile registers;
+        registers.set_pair(RegisterPair::DE, 0x1200);
+
+        dec_ss(registers, RegisterPair::DE, cycles);
+
+        CHECK_EQ(0x11, registers.d());
+        CHECK_EQ(0xff, registers.e());
+        CHECK_EQ(0, registers.bc());
+        CHECK_EQ(0, registers.hl());
+
+        dec_ss(registers, RegisterPair::BC, cycles);
+
+        CHECK_EQ(UINT16_MAX, registers.bc());
+    }
+
     SUBCASE("should use 6 cycles")
     {
         cyc cycles = 0;
-        u8 reg1 = UINT8_MAX;
-        u8 reg2 = UINT8_MAX;
+        RegisterFile registers;
         u16 sp = UINT8_MAX;
 
-        dec_ss(reg1, reg2, cycles);
+        dec_ss(registers, RegisterPair::BC, cycles);
 
         CHECK_EQ(6, cycles);
 
@@ -337,13 +271,23 @@ TEST_CASE("Z80: DEC (HL)")
 TEST_CASE("Z80: DEC (IX or IY)")
 {
     cyc cycles = 0;
-    u16 ix = 0;
+    RegisterFile registers;
+
+    SUBCASE("should decrease IY")
+    {
+        registers.set_index(IndexRegister::IY, 0x1200);
+
+        dec_ixy(registers, IndexRegister::IY, cycles);
+
+        CHECK_EQ(0x11ff, registers.iy());
+        CHECK_EQ(0, registers.ix());
+    }
 
     SUBCASE("should use 10 cycles")
     {
         cycles = 0;
 
-        dec_ixy(ix, cycles);
+        dec_ixy(registers, IndexRegister::IX, cycles);
 
         CHECK_EQ(10, cycles);
     }
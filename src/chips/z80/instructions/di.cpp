@@ -1,6 +1,5 @@
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::z80 {
 /**
@@ -24,11 +23,6 @@ void di(bool& iff1, bool& iff2, cyc& cycles)
     cycles = 4;
 }
 
-void print_di(std::ostream& ostream)
-{
-    ostream << "DI";
-}
-
 TEST_CASE("Z80: DI")
 {
     cyc cycles = 0;
@@ -1,14 +1,10 @@
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
 using emu::memory::NextByte;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Decrement register and jump if not zero
@@ -36,12 +32,6 @@ void djnz(u8& b_reg, u16& pc, NextByte const& args, cyc& cycles)
     }
 }
 
-void print_djnz(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "DJNZ "
-            << hexify_wo_0x(static_cast<i8>(args.farg));
-}
-
 TEST_CASE("Z80: DJNZ")
 {
     cyc cycles = 0;
@@ -1,10 +1,9 @@
 #include "chips/z80/flags.h"
+#include "chips/z80/register_file.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
@@ -22,22 +21,12 @@ using emu::util::byte::to_u16;
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param acc_reg is the accumulator, which will be mutated
- * @param flag_reg is the flag register, which will be mutated
- * @param acc_p_reg is the alternate accumulator, which will be mutated
- * @param flag_p_reg is the alternate flag register, which will be mutated
+ * @param registers is the register file, where AF and AF' will change places
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void ex(u8& acc_reg, Flags& flag_reg, u8& acc_p_reg, Flags& flag_p_reg, cyc& cycles)
+void ex(RegisterFile& registers, cyc& cycles)
 {
-    const u8 acc_temp = acc_reg;
-    acc_reg = acc_p_reg;
-    acc_p_reg = acc_temp;
-
-    Flags flags_temp;
-    flags_temp = flag_reg;
-    flag_reg = flag_p_reg;
-    flag_p_reg = flags_temp;
+    registers.exchange_af();
 
     cycles = 4;
 }
@@ -86,12 +75,15 @@ void ex_msp_hl(u16 sp, EmulatorMemory<u16, u8>& memory, u8& h_reg, u8& l_reg, cy
  *
  * @param sp is the stack pointer
  * @param memory is the memory, which will be mutated
- * @param ixy_reg is the IX or IY register, which will be mutated
+ * @param registers is the register file, where the index register will be mutated
+ * @param ixy is the index register to exchange
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void ex_msp_ixy(u16 sp, EmulatorMemory<u16, u8>& memory, u16& ixy_reg, cyc& cycles)
+void ex_msp_ixy(u16 sp, EmulatorMemory<u16, u8>& memory, RegisterFile& registers, IndexRegister ixy, cyc& cycles)
 {
+    u16 ixy_reg = registers.index(ixy);
     ex_msp_dd(sp, memory, ixy_reg);
+    registers.set_index(ixy, ixy_reg);
 
     cycles = 23;
 }
@@ -105,32 +97,18 @@ void ex_msp_ixy(u16 sp, EmulatorMemory<u16, u8>& memory, u16& ixy_reg, cyc& cycl
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param h_reg is the H register, which will be mutated
- * @param l_reg is the L register, which will be mutated
- * @param d_reg is the D register, which will be mutated
- * @param e_reg is the E register, which will be mutated
+ * @param registers is the register file, which will be mutated
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void ex_de_hl(u8& h_reg, u8& l_reg, u8& d_reg, u8& e_reg, cyc& cycles)
+void ex_de_hl(RegisterFile& registers, cyc& cycles)
 {
-    const u8 h = h_reg;
-    const u8 l = l_reg;
-    h_reg = d_reg;
-    l_reg = e_reg;
-    d_reg = h;
-    e_reg = l;
+    const u16 de = registers.de();
+    registers.set_pair(RegisterPair::DE, registers.hl());
+    registers.set_pair(RegisterPair::HL, de);
 
     cycles = 4;
 }
 
-void print_ex(std::ostream& ostream, std::string const& reg, std::string const& comp_reg)
-{
-    ostream << "EX "
-            << reg
-            << ","
-            << comp_reg;
-}
-
 TEST_CASE("Z80: EX")
 {
     cyc cycles = 0;
@@ -139,18 +117,22 @@ TEST_CASE("Z80: EX")
     {
         cycles = 0;
 
-        u8 acc_reg = 10;
-        Flags flag_reg;
-        flag_reg.set_carry_flag();
+        RegisterFile registers;
+        registers.a() = 10;
+        registers.f().reset();
+        registers.f().set_carry_flag();
 
-        u8 acc_p_reg = 4;
-        Flags flag_p_reg;
-        flag_p_reg.set_half_carry_flag();
+        registers.a_p() = 4;
+        registers.f_p().reset();
+        registers.f_p().set_half_carry_flag();
 
-        ex(acc_reg, flag_reg, acc_p_reg, flag_p_reg, cycles);
+        ex(registers, cycles);
 
-        CHECK_EQ(4, acc_reg);
-        CHECK_EQ(10, acc_p_reg);
+        Flags const& flag_reg = registers.f();
+        Flags const& flag_p_reg = registers.f_p();
+
+        CHECK_EQ(4, registers.a());
+        CHECK_EQ(10, registers.a_p());
 
         CHECK_EQ(false, flag_reg.is_carry_flag_set());
         CHECK_EQ(true, flag_reg.is_half_carry_flag_set());
@@ -171,15 +153,9 @@ TEST_CASE("Z80: EX")
     {
         cycles = 0;
 
-        u8 acc_reg = 10;
-        Flags flag_reg;
-        flag_reg.set_carry_flag();
-
-        u8 acc_p_reg = 4;
-        Flags flag_p_reg;
-        flag_reg.set_half_carry_flag();
+        RegisterFile registers;
 
-        ex(acc_reg, flag_reg, acc_p_reg, flag_p_reg, cycles);
+        ex(registers, cycles);
 
         CHECK_EQ(4, cycles);
     }
@@ -228,12 +204,13 @@ TEST_CASE("Z80: EX (SP), IX")
     {
         EmulatorMemory<u16, u8> memory;
         memory.add({ 0x90, 0x48 });
-        u16 ix_reg = 0x3988;
+        RegisterFile registers;
+        registers.set_index(IndexRegister::IX, 0x3988);
         u8 sp = 0x00;
 
-        ex_msp_ixy(sp, memory, ix_reg, cycles);
+        ex_msp_ixy(sp, memory, registers, IndexRegister::IX, cycles);
 
-        CHECK_EQ(0x4890, ix_reg);
+        CHECK_EQ(0x4890, registers.ix());
         CHECK_EQ(0x88, memory.read(sp));
         CHECK_EQ(0x39, memory.read(sp + 1));
     }
@@ -243,10 +220,11 @@ TEST_CASE("Z80: EX (SP), IX")
         cycles = 0;
         EmulatorMemory<u16, u8> memory;
         memory.add({ 0x33, 0x44 });
-        u16 ix_reg = 0x1122;
+        RegisterFile registers;
+        registers.set_index(IndexRegister::IX, 0x1122);
         u8 sp = 0x00;
 
-        ex_msp_ixy(sp, memory, ix_reg, cycles);
+        ex_msp_ixy(sp, memory, registers, IndexRegister::IX, cycles);
 
         CHECK_EQ(23, cycles);
     }
@@ -258,29 +236,26 @@ TEST_CASE("Z80: EX DE, HL")
 
     SUBCASE("should exchange HL with DE")
     {
-        u8 h_reg = 0x11;
-        u8 l_reg = 0x22;
-        u8 d_reg = 0x33;
-        u8 e_reg = 0x44;
+        RegisterFile registers;
+        registers.set_pair(RegisterPair::HL, 0x1122);
+        registers.set_pair(RegisterPair::DE, 0x3344);
 
-        ex_de_hl(h_reg, l_reg, d_reg, e_reg, cycles);
+        ex_de_hl(registers, cycles);
 
-        CHECK_EQ(0x33, h_reg);
-        CHECK_EQ(0x44, l_reg);
-        CHECK_EQ(0x11, d_reg);
-        CHECK_EQ(0x22, e_reg);
+        CHECK_EQ(0x33, registers.h());
+        CHECK_EQ(0x44, registers.l());
+        CHECK_EQ(0x11, registers.d());
+        CHECK_EQ(0x22, registers.e());
     }
 
     SUBCASE("should use 4 cycles")
     {
         cycles = 0;
 
-        u8 h_reg = 0x11;
-        u8 l_reg = 0x22;
-        u8 d_reg = 0;
-        u8 e_reg = 0;
+        RegisterFile registers;
+        registers.set_pair(RegisterPair::HL, 0x1122);
 
-        ex_de_hl(h_reg, l_reg, d_reg, e_reg, cycles);
+        ex_de_hl(registers, cycles);
 
         CHECK_EQ(4, cycles);
     }
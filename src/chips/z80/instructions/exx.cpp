@@ -1,6 +1,6 @@
+#include "chips/z80/register_file.h"
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::z80 {
 
@@ -13,127 +13,65 @@ namespace emu::z80 {
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param b_reg is the b register, which will be mutated
- * @param c_reg is the c register, which will be mutated
- * @param b_p_reg is the b' register, which will be mutated
- * @param c_p_reg is the c' register, which will be mutated
- * @param d_reg is the d register, which will be mutated
- * @param e_reg is the e register, which will be mutated
- * @param d_p_reg is the d' register, which will be mutated
- * @param e_p_reg is the e' register, which will be mutated
- * @param h_reg is the h register, which will be mutated
- * @param l_reg is the l register, which will be mutated
- * @param h_p_reg is the h' register, which will be mutated
- * @param l_p_reg is the l' register, which will be mutated
+ * @param registers is the register file, where BC, DE and HL will change places with BC', DE' and HL'
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void exx(
-    u8& b_reg, u8& c_reg, u8& b_p_reg, u8& c_p_reg,
-    u8& d_reg, u8& e_reg, u8& d_p_reg, u8& e_p_reg,
-    u8& h_reg, u8& l_reg, u8& h_p_reg, u8& l_p_reg,
-    cyc& cycles)
+void exx(RegisterFile& registers, cyc& cycles)
 {
-    u8 temp = b_reg;
-    b_reg = b_p_reg;
-    b_p_reg = temp;
-
-    temp = c_reg;
-    c_reg = c_p_reg;
-    c_p_reg = temp;
-
-    temp = d_reg;
-    d_reg = d_p_reg;
-    d_p_reg = temp;
-
-    temp = e_reg;
-    e_reg = e_p_reg;
-    e_p_reg = temp;
-
-    temp = h_reg;
-    h_reg = h_p_reg;
-    h_p_reg = temp;
-
-    temp = l_reg;
-    l_reg = l_p_reg;
-    l_p_reg = temp;
+    registers.exchange_bc_de_hl();
 
     cycles = 4;
 }
 
-void print_exx(std::ostream& ostream)
-{
-    ostream << "EXX";
-}
-
 TEST_CASE("Z80: EXX")
 {
     cyc cycles = 0;
 
-    SUBCASE("should exchange AF with AF'")
+    SUBCASE("should exchange BC, DE and HL with BC', DE' and HL'")
     {
         cycles = 0;
 
-        u8 b_reg = 10;
-        u8 c_reg = 5;
-        u8 b_p_reg = 56;
-        u8 c_p_reg = 72;
-
-        u8 d_reg = 88;
-        u8 e_reg = 22;
-        u8 d_p_reg = 123;
-        u8 e_p_reg = 54;
-
-        u8 h_reg = 0;
-        u8 l_reg = 0;
-        u8 h_p_reg = 90;
-        u8 l_p_reg = 234;
-
-        exx(
-            b_reg, c_reg, b_p_reg, c_p_reg,
-            d_reg, e_reg, d_p_reg, e_p_reg,
-            h_reg, l_reg, h_p_reg, l_p_reg,
-            cycles);
-
-        CHECK_EQ(56, b_reg);
-        CHECK_EQ(72, c_reg);
-        CHECK_EQ(10, b_p_reg);
-        CHECK_EQ(5, c_p_reg);
-
-        CHECK_EQ(123, d_reg);
-        CHECK_EQ(54, e_reg);
-        CHECK_EQ(88, d_p_reg);
-        CHECK_EQ(22, e_p_reg);
-
-        CHECK_EQ(90, h_reg);
-        CHECK_EQ(234, l_reg);
-        CHECK_EQ(0, h_p_reg);
-        CHECK_EQ(0, l_p_reg);
+        RegisterFile registers;
+        registers.b() = 10;
+        registers.c() = 5;
+        registers.b_p() = 56;
+        registers.c_p() = 72;
+
+        registers.d() = 88;
+        registers.e() = 22;
+        registers.d_p() = 123;
+        registers.e_p() = 54;
+
+        registers.h() = 0;
+        registers.l() = 0;
+        registers.h_p() = 90;
+        registers.l_p() = 234;
+
+        exx(registers, cycles);
+
+        CHECK_EQ(56, registers.b());
+        CHECK_EQ(72, registers.c());
+        CHECK_EQ(10, registers.b_p());
+        CHECK_EQ(5, registers.c_p());
+
+        CHECK_EQ(123, registers.d());
+        CHECK_EQ(54, registers.e());
+        CHECK_EQ(88, registers.d_p());
+        CHECK_EQ(22, registers.e_p());
+
+        CHECK_EQ(90, registers.h());
+        CHECK_EQ(234, registers.l());
+        CHECK_EQ(0, registers.h_p());
+        CHECK_EQ(0, registers.l_p());
     }
 
     SUBCASE("should use 4 cycles")
     {
         cycles = 0;
 
-        u8 b_reg = 10;
-        u8 c_reg = 5;
-        u8 b_p_reg = 56;
-        u8 c_p_reg = 72;
-
-        u8 d_reg = 88;
-        u8 e_reg = 22;
-        u8 d_p_reg = 123;
-        u8 e_p_reg = 54;
-
-        u8 h_reg = 0;
-        u8 l_reg = 0;
-        u8 h_p_reg = 90;
-        u8 l_p_reg = 234;
-
-        exx(
-            b_reg, c_reg, b_p_reg, c_p_reg,
-            d_reg, e_reg, d_p_reg, e_p_reg,
-            h_reg, l_reg, h_p_reg, l_p_reg,
-            cycles);
+        RegisterFile registers;
+
+        exx(registers, cycles);
 
         CHECK_EQ(4, cycles);
     }
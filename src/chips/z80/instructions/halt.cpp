@@ -1,6 +1,5 @@
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::z80 {
 /**
@@ -22,11 +21,6 @@ void halt(bool& is_halted, cyc& cycles)
     cycles = 4;
 }
 
-void print_halt(std::ostream& ostream)
-{
-    ostream << "HALT";
-}
-
 TEST_CASE("Z80: HALT")
 {
     cyc cycles = 0;
@@ -1,7 +1,6 @@
 #include "chips/z80/interrupt_mode.h"
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::z80 {
 
@@ -25,12 +24,6 @@ void im(InterruptMode& interrupt_mode, InterruptMode value, cyc& cycles)
     cycles = 8;
 }
 
-void print_im(std::ostream& ostream, unsigned int interrupt_mode)
-{
-    ostream << "IM "
-            << interrupt_mode;
-}
-
 TEST_CASE("Z80: IM")
 {
     cyc cycles = 0;
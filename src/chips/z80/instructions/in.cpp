@@ -1,18 +1,14 @@
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include "flags.h"
-#include <iostream>
-#include <string>
 #include <vector>
 
 namespace emu::z80 {
 
 using emu::memory::NextByte;
 using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Input from port using immediate value
@@ -64,29 +60,6 @@ void in_r_C(u8& reg, u8 b_reg, u8 c_reg, std::vector<u8> io, Flags& flag_reg, cy
     cycles = 12;
 }
 
-void print_in(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "IN A, ("
-            << hexify_wo_0x(args.farg)
-            << ")";
-}
-
-void print_in_undocumented(std::ostream& ostream, std::string const& dest)
-{
-    ostream << "IN "
-            << dest
-            << "*";
-}
-
-void print_in_r_r(std::ostream& ostream, std::string const& dest, std::string const& src)
-{
-    ostream << "IN "
-            << dest
-            << ", ("
-            << src
-            << ")";
-}
-
 TEST_CASE("Z80: IN A, (n)")
 {
     cyc cycles = 0;
@@ -1,4 +1,5 @@
 #include "chips/z80/flags.h"
+#include "chips/z80/register_file.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
@@ -6,15 +7,10 @@
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
 using emu::memory::NextByte;
-using emu::util::byte::high_byte;
-using emu::util::byte::low_byte;
-using emu::util::byte::to_u16;
 
 void inc(u8& reg, Flags& flag_reg)
 {
@@ -101,17 +97,13 @@ void inc_MHL(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc&
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param reg1 is the first register in the register pair, which will be mutated
- * @param reg2 is the second register in the register pair, which will be mutated
+ * @param registers is the register file, which will be mutated
+ * @param ss is the register pair to increment
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void inc_ss(u8& reg1, u8& reg2, cyc& cycles)
+void inc_ss(RegisterFile& registers, RegisterPair ss, cyc& cycles)
 {
-    u16 val = to_u16(reg1, reg2);
-    ++val;
-
-    reg2 = low_byte(val);
-    reg1 = high_byte(val);
+    registers.set_pair(ss, registers.pair(ss) + 1);
 
     cycles = 6;
 }
@@ -144,66 +136,17 @@ void inc_sp(u16& sp, cyc& cycles)
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param ixy_reg is the IX or IY register, which will be mutated
+ * @param registers is the register file, which will be mutated
+ * @param ixy is the index register to increment
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void inc_ixy(u16& ixy_reg, cyc& cycles)
+void inc_ixy(RegisterFile& registers, IndexRegister ixy, cyc& cycles)
 {
-    ++ixy_reg;
+    registers.set_index(ixy, registers.index(ixy) + 1);
 
     cycles = 10;
 }
 
-/**
- * Increment IXH/IYH
- * <ul>
- *   <li>Size: 2</li>
- *   <li>Cycles: 6</li>
- *   <li>States: 8</li>
- *   <li>Condition bits affected: half carry, zero, sign, parity/overflow, add/subtract</li>
- * </ul>
- *
- * @param ixy_reg is the IX or IY register
- * @param flag_reg is the flag register, which will be mutated
- * @param cycles is the number of cycles variable, which will be mutated
- */
-void inc_ixyh(u16& ixy_reg, Flags& flag_reg, cyc& cycles)
-{
-    u8 ixyh = high_byte(ixy_reg);
-    const u8 ixyl = low_byte(ixy_reg);
-
-    inc(ixyh, flag_reg);
-
-    ixy_reg = to_u16(ixyh, ixyl);
-
-    cycles = 8;
-}
-
-/**
- * Increment IXL/IYL
- * <ul>
- *   <li>Size: 2</li>
- *   <li>Cycles: 6</li>
- *   <li>States: 8</li>
- *   <li>Condition bits affected: half carry, zero, sign, parity/overflow, add/subtract</li>
- * </ul>
- *
- * @param ixy_reg is the IX or IY register
- * @param flag_reg is the flag register, which will be mutated
- * @param cycles is the number of cycles variable, which will be mutated
- */
-void inc_ixyl(u16& ixy_reg, Flags& flag_reg, cyc& cycles)
-{
-    const u8 ixyh = high_byte(ixy_reg);
-    u8 ixyl = low_byte(ixy_reg);
-
-    inc(ixyl, flag_reg);
-
-    ixy_reg = to_u16(ixyh, ixyl);
-
-    cycles = 8;
-}
-
 /**
  * Increment value in memory pointed to by IX or IY plus d
  * <ul>
@@ -231,32 +174,6 @@ void inc_MixyPd(u16 ixy_reg, NextByte const& args, EmulatorMemory<u16, u8>& memo
     cycles = 23;
 }
 
-void print_inc(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "INC "
-            << reg;
-}
-
-void print_inc_undocumented(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "INC "
-            << reg
-            << "*";
-}
-
-void print_inc_MixyPn(std::ostream& ostream, std::string const& ixy_reg, NextByte const& args)
-{
-    const i8 signed_value = static_cast<i8>(args.farg);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "INC "
-            << "("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << ")";
-}
-
 TEST_CASE("Z80: INC")
 {
     SUBCASE("should increase register or memory")
@@ -397,8 +314,7 @@ TEST_CASE("Z80: INC r")
 TEST_CASE("Z80: INC ss")
 {
     cyc cycles = 0;
-    u8 reg1 = 0;
-    u8 reg2 = 0;
+    RegisterFile registers;
     u8 expected_reg1 = 0;
     u8 expected_reg2;
     u16 sp = 0;
@@ -406,19 +322,30 @@ TEST_CASE("Z80: INC ss")
     SUBCASE("should increase register pair")
     {
         for (int i = 0; i < UINT16_MAX; ++i) {
-            inc_ss(reg1, reg2, cycles);
+            inc_ss(registers, RegisterPair::BC, cycles);
 
-            if (reg2 % (UINT8_MAX + 1) == 0 && i != 0) {
+            if (registers.c() % (UINT8_MAX + 1) == 0 && i != 0) {
                 ++expected_reg1;
             }
 
             expected_reg2 = i + 1;
 
-            CHECK_EQ(expected_reg1, reg1);
-            CHECK_EQ(expected_reg2, reg2);
+            CHECK_EQ(expected_reg1, registers.b());
+            CHECK_EQ(expected_reg2, registers.c());
         }
     }
 
+    SUBCASE("should only increase the given register pair")
+    {
+        registers.set_pair(RegisterPair::HL, UINT16_MAX);
+
+        inc_ss(registers, RegisterPair::HL, cycles);
+
+        CHECK_EQ(0, registers.hl());
+        CHECK_EQ(0, registers.bc());
+        CHECK_EQ(0, registers.de());
+    }
+
     SUBCASE("should increase SP")
     {
         for (u16 expected_sp = 0; expected_sp < UINT16_MAX; ++expected_sp) {
@@ -434,7 +361,7 @@ TEST_CASE("Z80: INC ss")
     {
         cycles = 0;
 
-        inc_ss(reg1, reg2, cycles);
+        inc_ss(registers, RegisterPair::DE, cycles);
 
         CHECK_EQ(6, cycles);
 
@@ -462,16 +389,16 @@ TEST_CASE("Z80: INC (HL)")
 TEST_CASE("Z80: INC (IX or IY)")
 {
     cyc cycles = 0;
-    u16 ix = 0;
+    RegisterFile registers;
 
     SUBCASE("should increase IX")
     {
         for (u16 expected_ix = 0; expected_ix < UINT16_MAX; ++expected_ix) {
-            ix = expected_ix;
+            registers.set_index(IndexRegister::IX, expected_ix);
 
-            inc_ixy(ix, cycles);
+            inc_ixy(registers, IndexRegister::IX, cycles);
 
-            CHECK_EQ(expected_ix + 1, ix);
+            CHECK_EQ(expected_ix + 1, registers.ix());
         }
     }
 
@@ -479,7 +406,7 @@ TEST_CASE("Z80: INC (IX or IY)")
     {
         cycles = 0;
 
-        inc_ixy(ix, cycles);
+        inc_ixy(registers, IndexRegister::IX, cycles);
 
         CHECK_EQ(10, cycles);
     }
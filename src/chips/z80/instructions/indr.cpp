@@ -3,7 +3,6 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
 #include <vector>
 
 namespace emu::z80 {
@@ -59,11 +58,6 @@ void indr(u16& pc, u8& b_reg, u8 c_reg, u8& h_reg, u8& l_reg, EmulatorMemory<u16
     }
 }
 
-void print_indr(std::ostream& ostream)
-{
-    ostream << "INDR";
-}
-
 TEST_CASE("Z80: INDR")
 {
     cyc cycles = 0;
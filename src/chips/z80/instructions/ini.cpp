@@ -3,7 +3,6 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
 #include <vector>
 
 namespace emu::z80 {
@@ -53,11 +52,6 @@ void ini(u8& b_reg, u8 c_reg, u8& h_reg, u8& l_reg, EmulatorMemory<u16, u8>& mem
     cycles = 16;
 }
 
-void print_ini(std::ostream& ostream)
-{
-    ostream << "INI";
-}
-
 TEST_CASE("Z80: INI")
 {
     cyc cycles = 0;
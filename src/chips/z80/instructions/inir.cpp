@@ -3,7 +3,6 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
 #include <vector>
 
 namespace emu::z80 {
@@ -59,11 +58,6 @@ void inir(u16& pc, u8& b_reg, u8 c_reg, u8& h_reg, u8& l_reg, EmulatorMemory<u16
     }
 }
 
-void print_inir(std::ostream& ostream)
-{
-    ostream << "INIR";
-}
-
 TEST_CASE("Z80: INIR")
 {
     cyc cycles = 0;
@@ -2,11 +2,11 @@
 
 #include "chips/z80/flags.h"
 #include "chips/z80/interrupt_mode.h"
+#include "chips/z80/register_file.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/memory/next_word.h"
 #include "crosscutting/typedefs.h"
-#include <string>
 #include <vector>
 
 // @formatter:off
@@ -840,7 +840,7 @@ void add_A_n(u8& acc_reg, NextByte const& args, Flags& flag_reg, cyc& cycles);
 void add_A_r(u8& acc_reg, u8 value, Flags& flag_reg, cyc& cycles);
 void add_A_r_undoc(u8& acc_reg, u8 value, Flags& flag_reg, cyc& cycles);
 void add_HL_ss(u8& h_reg, u8& l_reg, u16 value, Flags& flag_reg, cyc& cycles);
-void add_ixy_pp(u16& ix_reg, u16 value_to_add, Flags& flag_reg, cyc& cycles);
+void add_ixy_pp(RegisterFile& registers, IndexRegister ixy, u16 value_to_add, cyc& cycles);
 void and_MixyPd(u8& acc_reg, u16 ixy_reg, NextByte const& args, EmulatorMemory<u16, u8>& memory, Flags& flag_reg, cyc& cycles);
 void and_MHL(u8& acc_reg, u8 value, Flags& flag_reg, cyc& cycles);
 void and_n(u8& acc_reg, NextByte const& args, Flags& flag_reg, cyc& cycles);
@@ -874,33 +874,29 @@ void cpl(u8& acc_reg, Flags& flag_reg, cyc& cycles);
 void daa(u8& acc_reg, Flags& flag_reg, cyc& cycles);
 void dec_r(u8& reg, Flags& flag_reg, cyc& cycles);
 void dec_r_undoc(u8& reg, Flags& flag_reg, cyc& cycles);
-void dec_ss(u8& reg1, u8& reg2, cyc& cycles);
+void dec_ss(RegisterFile& registers, RegisterPair ss, cyc& cycles);
 void dec_sp(u16& sp, cyc& cycles);
 void dec_MHL(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc& cycles);
-void dec_ixy(u16& ix_or_iy, cyc& cycles);
-void dec_ixyh(u16& ixy_reg, Flags& flag_reg, cyc& cycles);
-void dec_ixyl(u16& ixy_reg, Flags& flag_reg, cyc& cycles);
+void dec_ixy(RegisterFile& registers, IndexRegister ixy, cyc& cycles);
 void dec_MixyPd(u16 ixy_reg, NextByte const& args, EmulatorMemory<u16, u8>& memory, Flags& flag_reg, cyc& cycles);
 void di(bool& iff1, bool& iff2, cyc& cycles);
 void djnz(u8& b_reg, u16& pc, NextByte const& args, cyc& cycles);
 void ei(bool& iff1, bool& iff2, cyc& cycles);
-void ex(u8& acc_reg, Flags& flag_reg, u8& acc_p_reg, Flags& flag_p_reg, cyc& cycles);
-void ex_de_hl(u8& h_reg, u8& l_reg, u8& d_reg, u8& e_reg, cyc& cycles);
+void ex(RegisterFile& registers, cyc& cycles);
+void ex_de_hl(RegisterFile& registers, cyc& cycles);
 void ex_msp_hl(u16 sp, EmulatorMemory<u16, u8>& memory, u8& h_reg, u8& l_reg, cyc& cycles);
-void ex_msp_ixy(u16 sp, EmulatorMemory<u16, u8>& memory, u16& ixy_reg, cyc& cycles);
-void exx(u8& b_reg, u8& c_reg, u8& b_p_reg, u8& c_p_reg, u8& d_reg, u8& e_reg, u8& d_p_reg, u8& e_p_reg, u8& h_reg, u8& l_reg, u8& h_p_reg, u8& l_p_reg, cyc& cycles);
+void ex_msp_ixy(u16 sp, EmulatorMemory<u16, u8>& memory, RegisterFile& registers, IndexRegister ixy, cyc& cycles);
+void exx(RegisterFile& registers, cyc& cycles);
 void halt(bool& is_halted, cyc& cycles);
 void im(InterruptMode& interrupt_mode, InterruptMode value, cyc& cycles);
 void in_A_n(u8& acc_reg, NextByte const& args, std::vector<u8> io, cyc& cycles);
 void in_r_C(u8& reg, u8 b_reg, u8 c_reg, std::vector<u8> io, Flags& flag_reg, cyc& cycles);
 void inc_r(u8& reg, Flags& flag_reg, cyc& cycles);
 void inc_r_undoc(u8& reg, Flags& flag_reg, cyc& cycles);
-void inc_ss(u8& reg1, u8& reg2, cyc& cycles);
+void inc_ss(RegisterFile& registers, RegisterPair ss, cyc& cycles);
 void inc_MHL(EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_reg, cyc& cycles);
 void inc_sp(u16& sp, cyc& cycles);
-void inc_ixy(u16& ixy_reg, cyc& cycles);
-void inc_ixyh(u16& ixy_reg, Flags& flag_reg, cyc& cycles);
-void inc_ixyl(u16& ixy_reg, Flags& flag_reg, cyc& cycles);
+void inc_ixy(RegisterFile& registers, IndexRegister ixy, cyc& cycles);
 void inc_MixyPd(u16 ixy_reg, NextByte const& args, EmulatorMemory<u16, u8>& memory, Flags& flag_reg, cyc& cycles);
 void ind(u8& b_reg, u8 c_reg, u8& h_reg, u8& l_reg, EmulatorMemory<u16, u8>& memory, Flags& flag_reg, std::vector<u8> io, cyc& cycles);
 void indr(u16& pc, u8& b_reg, u8 c_reg, u8& h_reg, u8& l_reg, EmulatorMemory<u16, u8>& memory, Flags& flag_reg, std::vector<u8> io, cyc& cycles);
@@ -934,14 +930,10 @@ void ld_I_A(u8& i_reg, u8 acc_reg, cyc& cycles);
 void ld_R_A(u8& r_reg, u8 acc_reg, cyc& cycles);
 void ld_A_R(u8& acc_reg, u8 r_reg, Flags& flag_reg, bool iff2, cyc& cycles);
 void ld_HL_Mnn(u8& h_reg, u8& l_reg, EmulatorMemory<u16, u8> const& memory, NextWord const& args, cyc& cycles);
-void ld_dd_nn(u8& reg1, u8& reg2, NextWord const& args, cyc& cycles);
-void ld_ixy_nn(u16& ixy_reg, NextWord const& args, cyc& cycles);
+void ld_dd_nn(RegisterFile& registers, RegisterPair dd, NextWord const& args, cyc& cycles);
+void ld_ixy_nn(RegisterFile& registers, IndexRegister ixy, NextWord const& args, cyc& cycles);
 void ld_dd_Mnn(u8& reg1, u8& reg2, NextWord const& args, EmulatorMemory<u16, u8> const& memory, cyc& cycles);
-void ld_ixy_Mnn(u16& ixy_reg, NextWord const& args, EmulatorMemory<u16, u8> const& memory, cyc& cycles);
-void ld_ixyh_n(u16& ixy_reg, NextByte const& args, cyc& cycles);
-void ld_ixyl_n(u16& ixy_reg, NextByte const& args, cyc& cycles);
-void ld_ixyh_r_undoc(u16& ixy_reg, u8 value, cyc& cycles);
-void ld_ixyl_r_undoc(u16& ixy_reg, u8 value, cyc& cycles);
+void ld_ixy_Mnn(RegisterFile& registers, IndexRegister ixy, NextWord const& args, EmulatorMemory<u16, u8> const& memory, cyc& cycles);
 void ld_r_MixyPd(u8& reg, u16 ixy_reg, NextByte const& args, EmulatorMemory<u16, u8> const& memory, cyc& cycles);
 void ld_MHL_n(EmulatorMemory<u16, u8>& memory, u16 address, NextByte const& args, cyc& cycles);
 void ld_MHL_r(EmulatorMemory<u16, u8>& memory, u16 address, u8 value, cyc& cycles);
@@ -976,11 +968,11 @@ void outd(u8& b_reg, u8 c_reg, u8& h_reg, u8& l_reg, EmulatorMemory<u16, u8>& me
 void otdr(u16& pc, u8& b_reg, u8 c_reg, u8& h_reg, u8& l_reg, EmulatorMemory<u16, u8>& memory, Flags& flag_reg, std::vector<u8> io, cyc& cycles);
 void otir(u16& pc, u8& b_reg, u8 c_reg, u8& h_reg, u8& l_reg, EmulatorMemory<u16, u8>& memory, Flags& flag_reg, std::vector<u8> io, cyc& cycles);
 void outi(u8& b_reg, u8 c_reg, u8& h_reg, u8& l_reg, EmulatorMemory<u16, u8>& memory, Flags& flag_reg, std::vector<u8> io, cyc& cycles);
-void pop(u8& reg1, u8& reg2, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles);
-void pop_af(Flags& flag_reg, u8& acc_reg, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles);
-void pop_ixy(u16& ix_iy_reg, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles);
-void push_qq(u8 reg1, u8 reg2, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles);
-void push_af(Flags const& flag_reg, u8 acc_reg, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles);
+void pop(RegisterFile& registers, RegisterPair qq, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles);
+void pop_af(RegisterFile& registers, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles);
+void pop_ixy(RegisterFile& registers, IndexRegister ixy, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles);
+void push_qq(RegisterFile const& registers, RegisterPair qq, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles);
+void push_af(RegisterFile const& registers, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles);
 void push_ixy(u16 ixy_reg, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles);
 void res_r(unsigned int bit_number, u8& reg, cyc& cycles);
 void res_MHL(unsigned int bit_number, u16 hl_reg, EmulatorMemory<u16, u8>& memory, cyc& cycles);
@@ -1064,136 +1056,5 @@ void xor_r_undoc(u8& acc_reg, u8 value, Flags& flag_reg, cyc& cycles);
 void xor_MHL(u8& acc_reg, u8 value, Flags& flag_reg, cyc& cycles);
 void xor_MixyPd(u8& acc_reg, u16 ixy_reg, NextByte const& args, EmulatorMemory<u16, u8>& memory, Flags& flag_reg, cyc& cycles);
 void xor_ixy_h_or_l(u8& acc_reg, u8 ixy_reg_h_or_l, Flags& flag_reg, cyc& cycles);
-
-void print_adc_r_s(std::ostream& ostream, std::string const& dest, std::string const& src);
-void print_adc_r_s_undocumented(std::ostream& ostream, std::string const& dest, std::string const& src);
-void print_adc_r_n(std::ostream& ostream, std::string const& reg, NextByte const& args);
-void print_adc_MixyPn(std::ostream& ostream, std::string const& reg, std::string const& ixy_reg, NextByte const& args);
-void print_add(std::ostream& ostream, std::string const& dest, std::string const& src);
-void print_add_undocumented(std::ostream& ostream, std::string const& dest, std::string const& src);
-void print_add_r_n(std::ostream& ostream, std::string const& reg, NextByte const& args);
-void print_and_r(std::ostream& ostream, std::string const& reg);
-void print_and_r_undocumented(std::ostream& ostream, std::string const& reg);
-void print_and_MixyPn(std::ostream& ostream, std::string const& ixy_reg, NextByte const& args);
-void print_and_n(std::ostream& ostream, NextByte const& args);
-void print_add_MixyPn(std::ostream& ostream, std::string const& reg, std::string const& ixy_reg, NextByte const& args);
-void print_bit(std::ostream& ostream, unsigned int bit_number, std::string const& src);
-void print_bit_MixyPn(std::ostream& ostream, unsigned int bit_number, std::string const& ixy_reg, u8 d);
-void print_call_nn(std::ostream& ostream, NextWord const& args);
-void print_call_cc_nn(std::ostream& ostream, NextWord const& args, std::string const& condition);
-void print_ccf(std::ostream& ostream);
-void print_cp(std::ostream& ostream, std::string const& reg);
-void print_cp_undocumented(std::ostream& ostream, std::string const& reg);
-void print_cp(std::ostream& ostream, NextByte const& args);
-void print_cp_MixyPn(std::ostream& ostream, std::string const& ixy_reg, NextByte const& args);
-void print_cpd(std::ostream& ostream);
-void print_cpdr(std::ostream& ostream);
-void print_cpi(std::ostream& ostream);
-void print_cpir(std::ostream& ostream);
-void print_cpl(std::ostream& ostream);
-void print_daa(std::ostream& ostream);
-void print_di(std::ostream& ostream);
-void print_djnz(std::ostream& ostream, NextByte const& args);
-void print_dec(std::ostream& ostream, std::string const& reg);
-void print_dec_undocumented(std::ostream& ostream, std::string const& reg);
-void print_dec_MixyPn(std::ostream& ostream, std::string const& ixy_reg, NextByte const& args);
-void print_ei(std::ostream& ostream);
-void print_ex(std::ostream& ostream, std::string const& reg, std::string const& comp_reg);
-void print_exx(std::ostream& ostream);
-void print_halt(std::ostream& ostream);
-void print_im(std::ostream& ostream, unsigned int interrupt_mode);
-void print_in(std::ostream& ostream, NextByte const& args);
-void print_in_undocumented(std::ostream& ostream, std::string const& dest);
-void print_in_r_r(std::ostream& ostream, std::string const& dest, std::string const& src);
-void print_inc(std::ostream& ostream, std::string const& reg);
-void print_inc_MixyPn(std::ostream& ostream, std::string const& ixy_reg, NextByte const& args);
-void print_inc_undocumented(std::ostream& ostream, std::string const& reg);
-void print_ind(std::ostream& ostream);
-void print_indr(std::ostream& ostream);
-void print_ini(std::ostream& ostream);
-void print_inir(std::ostream& ostream);
-void print_jp_nn(std::ostream& ostream, NextWord const& args);
-void print_jp_cc_nn(std::ostream& ostream, NextWord const& args, std::string const& condition);
-void print_jp_Mss(std::ostream& ostream, std::string const& reg);
-void print_jr(std::ostream& ostream, NextByte const& args);
-void print_jr(std::ostream& ostream, std::string const& condition, NextByte const& args);
-void print_ld(std::ostream& ostream, std::string const& dest, std::string const& src);
-void print_ld_undocumented(std::ostream& ostream, std::string const& dest, std::string const& src);
-void print_ld(std::ostream& ostream, std::string const& dest, NextByte const& args);
-void print_ld_undocumented(std::ostream& ostream, std::string const& dest, NextByte const& args);
-void print_ld(std::ostream& ostream, std::string const& dest, NextWord const& args);
-void print_ld_dd_nn(std::ostream& ostream, std::string const& reg, NextWord const& args);
-void print_ld_Mnn_dd(std::ostream& ostream, NextWord const& args, std::string const& src);
-void print_ld_Mnn_dd_undocumented(std::ostream& ostream, NextWord const& args, std::string const& src);
-void print_ld_dd_Mnn(std::ostream& ostream, std::string const& dest, NextWord const& args);
-void print_ld_dd_Mnn_undocumented(std::ostream& ostream, std::string const& dest, NextWord const& args);
-void print_ld_MixyPd_n(std::ostream& ostream, std::string const& ixy_reg, NextWord const& args);
-void print_ld_MixyPd_r(std::ostream& ostream, std::string const& ixy_reg, NextByte const& args, std::string const& reg);
-void print_ld_r_MixyPn(std::ostream& ostream, std::string const& dest, std::string const& ixy_reg, NextByte const& args);
-void print_ldd(std::ostream& ostream);
-void print_lddr(std::ostream& ostream);
-void print_ldi(std::ostream& ostream);
-void print_ldir(std::ostream& ostream);
-void print_neg(std::ostream& ostream);
-void print_nop(std::ostream& ostream);
-void print_or_r(std::ostream& ostream, std::string const& reg);
-void print_or_r_undocumented(std::ostream& ostream, std::string const& reg);
-void print_or_MixyPn(std::ostream& ostream, std::string const& ixy_reg, NextByte const& args);
-void print_or_n(std::ostream& ostream, NextByte const& args);
-void print_pop(std::ostream& ostream, std::string const& reg);
-void print_push(std::ostream& ostream, std::string const& reg);
-void print_out(std::ostream& ostream, NextByte const& args);
-void print_out_r_r(std::ostream& ostream, std::string const& dest, std::string const& src);
-void print_out_r_r_undocumented(std::ostream& ostream, std::string const& dest, std::string const& src);
-void print_outd(std::ostream& ostream);
-void print_outi(std::ostream& ostream);
-void print_otdr(std::ostream& ostream);
-void print_otir(std::ostream& ostream);
-void print_res(std::ostream& ostream, unsigned int bit_number, std::string const& src);
-void print_res_MixyPn(std::ostream& ostream, unsigned int bit_number, std::string const& ixy_reg, u8 d);
-void print_ret(std::ostream& ostream);
-void print_ret(std::ostream& ostream, std::string const& condition);
-void print_reti(std::ostream& ostream);
-void print_retn(std::ostream& ostream);
-void print_rla(std::ostream& ostream);
-void print_rl(std::ostream& ostream, std::string const& reg);
-void print_rl_MixyPn(std::ostream& ostream, std::string const& ixy_reg, u8 d);
-void print_rl_MixyPn_r(std::ostream& ostream, std::string const& ixy_reg, u8 d, std::string const& reg);
-void print_rlc(std::ostream& ostream, std::string const& reg);
-void print_rlc_MixyPn(std::ostream& ostream, std::string const& ixy_reg, u8 d);
-void print_rlc_MixyPn_r(std::ostream& ostream, std::string const& ixy_reg, u8 d, std::string const& reg);
-void print_rlca(std::ostream& ostream);
-void print_rld(std::ostream& ostream);
-void print_rst(std::ostream& ostream, int number);
-void print_rr(std::ostream& ostream, std::string const& reg);
-void print_rr_MixyPn(std::ostream& ostream, std::string const& ixy_reg, u8 d);
-void print_rra(std::ostream& ostream);
-void print_rrc(std::ostream& ostream, std::string const& reg);
-void print_rrc_MixyPn(std::ostream& ostream, std::string const& ixy_reg, u8 d);
-void print_rrca(std::ostream& ostream);
-void print_rrd(std::ostream& ostream);
-void print_sbc_r_s(std::ostream& ostream, std::string const& dest, std::string const& src);
-void print_sbc_r_s_undocumented(std::ostream& ostream, std::string const& dest, std::string const& src);
-void print_sbc_r_n(std::ostream& ostream, std::string const& reg, NextByte const& args);
-void print_sbc_MixyPn(std::ostream& ostream, std::string const& reg, std::string const& ixy_reg, NextByte const& args);
-void print_scf(std::ostream& ostream);
-void print_set(std::ostream& ostream, unsigned int bit_number, std::string const& src);
-void print_set_MixyPn(std::ostream& ostream, unsigned int bit_number, std::string const& ixy_reg, u8 d);
-void print_sla(std::ostream& ostream, std::string const& reg);
-void print_sla_MixyPn(std::ostream& ostream, unsigned int bit_number, std::string const& ixy_reg, u8 d);
-void print_sra(std::ostream& ostream, std::string const& reg);
-void print_sra_MixyPn(std::ostream& ostream, unsigned int bit_number, std::string const& ixy_reg, u8 d);
-void print_sll(std::ostream& ostream, std::string const& reg);
-void print_sll_MixyPn(std::ostream& ostream, unsigned int bit_number, std::string const& ixy_reg, u8 d);
-void print_srl(std::ostream& ostream, std::string const& reg);
-void print_srl_MixyPn(std::ostream& ostream, unsigned int bit_number, std::string const& ixy_reg, u8 d);
-void print_sub(std::ostream& ostream, std::string const& reg);
-void print_sub_undocumented(std::ostream& ostream, std::string const& reg);
-void print_sub(std::ostream& ostream, NextByte const& args);
-void print_sub_MixyPn(std::ostream& ostream, std::string const& ixy_reg, NextByte const& args);
-void print_xor_r(std::ostream& ostream, std::string const& reg);
-void print_xor_r_undocumented(std::ostream& ostream, std::string const& reg);
-void print_xor_n(std::ostream& ostream, NextByte const& args);
-void print_xor_MixyPn(std::ostream& ostream, std::string const& ixy_reg, NextByte const& args);
 }
 // @formatter:on
@@ -2,16 +2,12 @@
 #include "crosscutting/memory/next_word.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
 using emu::memory::NextWord;
 using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Jump
@@ -257,30 +253,6 @@ void jp_ixy(u16& pc, u16 ixy_reg, cyc& cycles)
     cycles = 8;
 }
 
-void print_jp_nn(std::ostream& ostream, NextWord const& args)
-{
-    ostream << "JP "
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg);
-}
-
-void print_jp_cc_nn(std::ostream& ostream, NextWord const& args, std::string const& condition)
-{
-    ostream << "JP "
-            << condition
-            << ","
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg);
-}
-
-void print_jp_Mss(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "JP "
-            << "("
-            << reg
-            << ")";
-}
-
 TEST_CASE("Z80: JP")
 {
     cyc cycles = 0;
@@ -2,16 +2,11 @@
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
 using emu::memory::NextByte;
-using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Jump relative
@@ -137,20 +132,6 @@ void jr_nz(u16& pc, NextByte const& args, Flags const& flag_reg, cyc& cycles)
     cycles += 7;
 }
 
-void print_jr(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "JR "
-            << hexify_wo_0x(static_cast<i8>(args.farg));
-}
-
-void print_jr(std::ostream& ostream, std::string const& condition, NextByte const& args)
-{
-    ostream << "JR "
-            << condition
-            << ", "
-            << hexify_wo_0x(static_cast<i8>(args.farg));
-}
-
 TEST_CASE("Z80: JR")
 {
     cyc cycles = 0;
@@ -1,13 +1,11 @@
 #include "chips/z80/flags.h"
+#include "chips/z80/register_file.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/memory/next_word.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 #include <vector>
 
 namespace emu::z80 {
@@ -18,7 +16,6 @@ using emu::memory::NextWord;
 using emu::util::byte::high_byte;
 using emu::util::byte::low_byte;
 using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 void ld(u8& to, u8 value)
 {
@@ -356,15 +353,14 @@ void ld_HL_Mnn(u8& h_reg, u8& l_reg, EmulatorMemory<u16, u8> const& memory, Next
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param reg1 is the first register to load into, which will be mutated
- * @param reg2 is the second register to load into, which will be mutated
+ * @param registers is the register file, which will be mutated
+ * @param dd is the register pair to load into
  * @param args contains value to load into the registers
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void ld_dd_nn(u8& reg1, u8& reg2, NextWord const& args, cyc& cycles)
+void ld_dd_nn(RegisterFile& registers, RegisterPair dd, NextWord const& args, cyc& cycles)
 {
-    reg1 = args.sarg;
-    reg2 = args.farg;
+    registers.set_pair(dd, to_u16(args.sarg, args.farg));
 
     cycles = 10;
 }
@@ -378,67 +374,18 @@ void ld_dd_nn(u8& reg1, u8& reg2, NextWord const& args, cyc& cycles)
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param ixy_reg is the IX or IY register to load into, which will be mutated
+ * @param registers is the register file, where the index register will be mutated
+ * @param ixy is the index register to load into
  * @param args contains value to load into the registers
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void ld_ixy_nn(u16& ixy_reg, NextWord const& args, cyc& cycles)
+void ld_ixy_nn(RegisterFile& registers, IndexRegister ixy, NextWord const& args, cyc& cycles)
 {
-    ixy_reg = to_u16(args.sarg, args.farg);
+    registers.set_index(ixy, to_u16(args.sarg, args.farg));
 
     cycles = 14;
 }
 
-/**
- * Load immediate value into IXH/IYH
- * <ul>
- *   <li>Size: 3</li>
- *   <li>Cycles: 2</li>
- *   <li>States: 11</li>
- *   <li>Condition bits affected: none</li>
- * </ul>
- *
- * @param ixy_reg is the IX or IY register to load into, which will be mutated
- * @param args contains value to load into the register
- * @param cycles is the number of cycles variable, which will be mutated
- */
-void ld_ixyh_n(u16& ixy_reg, NextByte const& args, cyc& cycles)
-{
-    u8 hi = high_byte(ixy_reg);
-    const u8 lo = low_byte(ixy_reg);
-
-    ld(hi, args.farg);
-
-    ixy_reg = to_u16(hi, lo);
-
-    cycles = 11;
-}
-
-/**
- * Load immediate value into IXH/IYH
- * <ul>
- *   <li>Size: 3</li>
- *   <li>Cycles: 2</li>
- *   <li>States: 11</li>
- *   <li>Condition bits affected: none</li>
- * </ul>
- *
- * @param ixy_reg is the IX or IY register to load into, which will be mutated
- * @param args contains value to load into the register
- * @param cycles is the number of cycles variable, which will be mutated
- */
-void ld_ixyl_n(u16& ixy_reg, NextByte const& args, cyc& cycles)
-{
-    const u8 hi = high_byte(ixy_reg);
-    u8 lo = low_byte(ixy_reg);
-
-    ld(lo, args.farg);
-
-    ixy_reg = to_u16(hi, lo);
-
-    cycles = 11;
-}
-
 /**
  * Load register pair with the value at a memory location
  * <ul>
@@ -472,15 +419,16 @@ void ld_dd_Mnn(u8& hi_reg, u8& lo_reg, NextWord const& args, EmulatorMemory<u16,
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param ixy_reg is the IX or IY register to load into, which will be mutated
+ * @param registers is the register file, where the index register will be mutated
+ * @param ixy is the index register to load into
  * @param args contains the address to load from
  * @param memory is the memory, which will be mutated
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void ld_ixy_Mnn(u16& ixy_reg, NextWord const& args, EmulatorMemory<u16, u8> const& memory, cyc& cycles)
+void ld_ixy_Mnn(RegisterFile& registers, IndexRegister ixy, NextWord const& args, EmulatorMemory<u16, u8> const& memory, cyc& cycles)
 {
     const u16 address = to_u16(args.sarg, args.farg);
-    ixy_reg = to_u16(memory.read(address + 1), memory.read(address));
+    registers.set_index(ixy, to_u16(memory.read(address + 1), memory.read(address)));
 
     cycles = 20;
 }
@@ -759,56 +707,6 @@ void ld_r_r_undoc(u8& to, u8 value, cyc& cycles)
     cycles = 8;
 }
 
-/**
- * Load from register to IXH or IYH (undocumented)
- * <ul>
- *   <li>Size: 2</li>
- *   <li>Cycles: 2</li>
- *   <li>States: 8</li>
- *   <li>Condition bits affected: none</li>
- * </ul>
- *
- * @param ixy_reg is the IX or IY register, which will be mutated
- * @param value is the value to move into to
- * @param cycles is the number of cycles variable, which will be mutated
- */
-void ld_ixyh_r_undoc(u16& ixy_reg, u8 value, cyc& cycles)
-{
-    u8 ixyh = high_byte(ixy_reg);
-    const u8 ixyl = low_byte(ixy_reg);
-
-    ld(ixyh, value);
-
-    ixy_reg = to_u16(ixyh, ixyl);
-
-    cycles = 8;
-}
-
-/**
- * Load from register to IXL or IYL (undocumented)
- * <ul>
- *   <li>Size: 2</li>
- *   <li>Cycles: 2</li>
- *   <li>States: 8</li>
- *   <li>Condition bits affected: none</li>
- * </ul>
- *
- * @param ixy_reg is the IX or IY register, which will be mutated
- * @param value is the value to move into to
- * @param cycles is the number of cycles variable, which will be mutated
- */
-void ld_ixyl_r_undoc(u16& ixy_reg, u8 value, cyc& cycles)
-{
-    const u8 ixyh = high_byte(ixy_reg);
-    u8 ixyl = low_byte(ixy_reg);
-
-    ld(ixyl, value);
-
-    ixy_reg = to_u16(ixyh, ixyl);
-
-    cycles = 8;
-}
-
 /**
  * Load immediate into register (undocumented)
  * <ul>
@@ -831,142 +729,6 @@ void ld_r_n_undoc(u8& to, NextByte const& args, cyc& cycles)
 
 /******************************** END OF FUNCTIONS FOR UNDOCUMENTED INSTRUCTIONS **********************************/
 
-void print_ld(std::ostream& ostream, std::string const& dest, std::string const& src)
-{
-    ostream << "LD "
-            << dest
-            << ","
-            << src;
-}
-
-void print_ld_undocumented(std::ostream& ostream, std::string const& dest, std::string const& src)
-{
-    ostream << "LD "
-            << dest
-            << ","
-            << src
-            << "*";
-}
-
-void print_ld(std::ostream& ostream, std::string const& dest, NextByte const& args)
-{
-    ostream << "LD "
-            << dest
-            << ","
-            << hexify_wo_0x(args.farg);
-}
-
-void print_ld_undocumented(std::ostream& ostream, std::string const& dest, NextByte const& args)
-{
-    ostream << "LD "
-            << dest
-            << ","
-            << hexify_wo_0x(args.farg)
-            << "*";
-}
-
-void print_ld(std::ostream& ostream, std::string const& dest, NextWord const& args)
-{
-    ostream << "LD "
-            << dest
-            << ",("
-            << hexify_wo_0x(to_u16(args.sarg, args.farg))
-            << ")";
-}
-
-void print_ld_dd_nn(std::ostream& ostream, std::string const& dest, NextWord const& args)
-{
-    ostream << "LD "
-            << dest
-            << ","
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg);
-}
-
-void print_ld_Mnn_dd(std::ostream& ostream, NextWord const& args, std::string const& src)
-{
-    ostream << "LD ("
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg)
-            << "),"
-            << src;
-}
-
-void print_ld_Mnn_dd_undocumented(std::ostream& ostream, NextWord const& args, std::string const& src)
-{
-    ostream << "LD ("
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg)
-            << "),"
-            << src
-            << "*";
-}
-
-void print_ld_dd_Mnn(std::ostream& ostream, std::string const& dest, NextWord const& args)
-{
-    ostream << "LD "
-            << dest
-            << ","
-            << ",("
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg)
-            << ")";
-}
-
-void print_ld_dd_Mnn_undocumented(std::ostream& ostream, std::string const& dest, NextWord const& args)
-{
-    ostream << "LD "
-            << dest
-            << ","
-            << ",("
-            << hexify_wo_0x(args.sarg)
-            << hexify_wo_0x(args.farg)
-            << ")"
-            << "*";
-}
-
-void print_ld_MixyPd_n(std::ostream& ostream, std::string const& ixy_reg, NextWord const& args)
-{
-    const i8 signed_value = static_cast<i8>(args.farg);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "LD "
-            << "("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << "),"
-            << hexify_wo_0x(args.sarg);
-}
-
-void print_ld_MixyPd_r(std::ostream& ostream, std::string const& ixy_reg, NextByte const& args, std::string const& reg)
-{
-    const i8 signed_value = static_cast<i8>(args.farg);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "LD "
-            << "("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << "),"
-            << reg;
-}
-
-void print_ld_r_MixyPn(std::ostream& ostream, std::string const& dest, std::string const& ixy_reg, NextByte const& args)
-{
-    const i8 signed_value = static_cast<i8>(args.farg);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "LD "
-            << dest
-            << ",("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << ")";
-}
-
 TEST_CASE("Z80: LD")
 {
     SUBCASE("should load register/memory with value from register/memory")
@@ -1097,16 +859,17 @@ TEST_CASE("Z80: LD dd, nn")
 {
     cyc cycles = 0;
     u16 sp = 0xe;
-    u8 reg1 = 0xe;
-    u8 reg2 = 0;
+    RegisterFile registers;
     NextWord args = { .farg = 0x12, .sarg = 0x3a };
 
     SUBCASE("should load immediate into register pair")
     {
-        ld_dd_nn(reg1, reg2, args, cycles);
+        ld_dd_nn(registers, RegisterPair::DE, args, cycles);
 
-        CHECK_EQ(args.sarg, reg1);
-        CHECK_EQ(args.farg, reg2);
+        CHECK_EQ(args.sarg, registers.d());
+        CHECK_EQ(args.farg, registers.e());
+        CHECK_EQ(0, registers.bc());
+        CHECK_EQ(0, registers.hl());
     }
 
     SUBCASE("should load immediate into SP")
@@ -1120,7 +883,7 @@ TEST_CASE("Z80: LD dd, nn")
     {
         cycles = 0;
 
-        ld_dd_nn(reg1, reg2, args, cycles);
+        ld_dd_nn(registers, RegisterPair::BC, args, cycles);
 
         CHECK_EQ(10, cycles);
     }
@@ -3,7 +3,6 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::z80 {
 
@@ -76,11 +75,6 @@ void ldd(u8& b_reg, u8& c_reg, u8& d_reg, u8& e_reg, u8& h_reg, u8& l_reg, u8 ac
     cycles = 16;
 }
 
-void print_ldd(std::ostream& ostream)
-{
-    ostream << "LDD";
-}
-
 TEST_CASE("Z80: LDD")
 {
     SUBCASE("should load memory at DE with value in HL and then decrement")
@@ -3,7 +3,6 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::z80 {
 
@@ -77,9 +76,4 @@ void lddr(u16& pc, u8& b_reg, u8& c_reg, u8& d_reg, u8& e_reg, u8& h_reg, u8& l_
         pc -= 2;
     }
 }
-
-void print_lddr(std::ostream& ostream)
-{
-    ostream << "LDDR";
-}
 }
@@ -3,7 +3,6 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::z80 {
 
@@ -79,11 +78,6 @@ void ldir(u16& pc, u8& b_reg, u8& c_reg, u8& d_reg, u8& e_reg, u8& h_reg, u8& l_
     }
 }
 
-void print_ldir(std::ostream& ostream)
-{
-    ostream << "LDIR";
-}
-
 TEST_CASE("Z80: LDIR")
 {
     cyc cycles = 0;
@@ -4,12 +4,9 @@
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
 
 namespace emu::z80 {
 
-using emu::util::byte::borrow_from;
-
 /**
  * Negate
  * <ul>
@@ -32,11 +29,6 @@ void neg(u8& acc_reg, Flags& flag_reg, cyc& cycles)
     cycles = 8;
 }
 
-void print_neg(std::ostream& ostream)
-{
-    ostream << "NEG";
-}
-
 TEST_CASE("Z80: NEG")
 {
     cyc cycles = 0;
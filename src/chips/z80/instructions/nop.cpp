@@ -1,6 +1,5 @@
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::z80 {
 /**
@@ -18,11 +17,6 @@ void nop(cyc& cycles)
     cycles = 4;
 }
 
-void print_nop(std::ostream& ostream)
-{
-    ostream << "NOP";
-}
-
 TEST_CASE("Z80: NOP")
 {
     cyc cycles = 0;
@@ -1,17 +1,13 @@
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 #include <vector>
 
 namespace emu::z80 {
 
 using emu::memory::NextByte;
 using emu::util::byte::to_u16;
-using emu::util::string::hexify_wo_0x;
 
 /**
  * Output to port using immediate value
@@ -56,35 +52,10 @@ void out_C_r(u8 b_reg, u8 c_reg, u8 reg, std::vector<u8>& io, cyc& cycles)
     cycles = 12;
 }
 
-void print_out(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "OUT "
-            << hexify_wo_0x(args.farg);
-}
-
-void print_out_r_r(std::ostream& ostream, std::string const& dest, std::string const& src)
-{
-    ostream << "OUT "
-            << "("
-            << dest
-            << "),"
-            << src;
-}
-
-void print_out_r_r_undocumented(std::ostream& ostream, std::string const& dest, std::string const& src)
-{
-    ostream << "OUT "
-            << "("
-            << dest
-            << "),"
-            << src
-            << "*";
-}
-
 TEST_CASE("Z80: OUT (n), A")
 {
     cyc cycles = 0;
-    std::vector<u8> io = { 0, 2, 4, 6, 8, 10 };
+    std::vector<u8> io(UINT16_MAX + 1);
     NextByte args = { .farg = 0x1 };
     u8 acc_reg = 100;
 
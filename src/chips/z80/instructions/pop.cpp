@@ -1,10 +1,8 @@
-#include "chips/z80/flags.h"
+#include "chips/z80/register_file.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 #include <vector>
 
 namespace emu::z80 {
@@ -21,16 +19,18 @@ using emu::util::byte::to_u16;
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param reg1 is the first register to pop to, which will be mutated
- * @param reg2 is the second register to pop to, which will be mutated
+ * @param registers is the register file, which will be mutated
+ * @param qq is the register pair to pop to
  * @param sp is the stack pointer, which will be mutated
  * @param memory is the memory
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void pop(u8& reg1, u8& reg2, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles)
+void pop(RegisterFile& registers, RegisterPair qq, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles)
 {
-    reg2 = memory.read(sp++);
-    reg1 = memory.read(sp++);
+    const u8 lo = memory.read(sp++);
+    const u8 hi = memory.read(sp++);
+
+    registers.set_pair(qq, to_u16(hi, lo));
 
     cycles = 10;
 }
@@ -44,15 +44,17 @@ void pop(u8& reg1, u8& reg2, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc
  *   <li>Condition bits affected: carry, half carry, zero, sign, parity/overflow, add/subtract</li>
  * </ul>
  *
- * @param flag_reg is the flag register
+ * @param registers is the register file, where A and F will be mutated
  * @param sp is the stack pointer, which will be mutated
  * @param memory is the memory
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void pop_af(Flags& flag_reg, u8& acc_reg, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles)
+void pop_af(RegisterFile& registers, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles)
 {
-    flag_reg.from_u8(memory.read(sp++));
-    acc_reg = memory.read(sp++);
+    const u8 lo = memory.read(sp++);
+    const u8 hi = memory.read(sp++);
+
+    registers.set_af(to_u16(hi, lo));
 
     cycles = 10;
 }
@@ -66,27 +68,22 @@ void pop_af(Flags& flag_reg, u8& acc_reg, u16& sp, EmulatorMemory<u16, u8> const
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param ix_reg is the IX register register, which will be mutated
+ * @param registers is the register file, where the index register will be mutated
+ * @param ixy is the index register to pop into
  * @param sp is the stack pointer, which will be mutated
  * @param memory is the memory
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void pop_ixy(u16& ix_iy_reg, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles)
+void pop_ixy(RegisterFile& registers, IndexRegister ixy, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles)
 {
     const u8 lo = memory.read(sp++);
     const u8 hi = memory.read(sp++);
 
-    ix_iy_reg = to_u16(hi, lo);
+    registers.set_index(ixy, to_u16(hi, lo));
 
     cycles = 14;
 }
 
-void print_pop(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "POP "
-            << reg;
-}
-
 TEST_CASE("Z80: POP qq")
 {
     cyc cycles = 0;
@@ -96,31 +93,32 @@ TEST_CASE("Z80: POP qq")
 
     SUBCASE("should pop register from stack")
     {
-        u8 reg1 = 0xaa;
-        u8 reg2 = 0xbb;
+        RegisterFile registers;
         u16 sp = 0x03;
 
-        pop(reg1, reg2, sp, memory, cycles);
+        pop(registers, RegisterPair::HL, sp, memory, cycles);
 
-        CHECK_EQ(memory.read(0x03), reg2);
-        CHECK_EQ(memory.read(0x04), reg1);
+        CHECK_EQ(memory.read(0x03), registers.l());
+        CHECK_EQ(memory.read(0x04), registers.h());
+        CHECK_EQ(0, registers.bc());
+        CHECK_EQ(0, registers.de());
         CHECK_EQ(0x05, sp);
     }
 
     SUBCASE("should pop AF from the stack")
     {
-        Flags flag_reg;
-        u8 acc_reg = 0xaa;
+        RegisterFile registers;
+        registers.a() = 0xaa;
         u16 sp = 0x03;
 
-        pop_af(flag_reg, acc_reg, sp, memory, cycles);
+        pop_af(registers, sp, memory, cycles);
 
-        CHECK_EQ(true, flag_reg.is_carry_flag_set());
-        CHECK_EQ(true, flag_reg.is_zero_flag_set());
-        CHECK_EQ(true, flag_reg.is_parity_overflow_flag_set());
-        CHECK_EQ(true, flag_reg.is_half_carry_flag_set());
-        CHECK_EQ(true, flag_reg.is_sign_flag_set());
-        CHECK_EQ(0x05, acc_reg);
+        CHECK_EQ(true, registers.f().is_carry_flag_set());
+        CHECK_EQ(true, registers.f().is_zero_flag_set());
+        CHECK_EQ(true, registers.f().is_parity_overflow_flag_set());
+        CHECK_EQ(true, registers.f().is_half_carry_flag_set());
+        CHECK_EQ(true, registers.f().is_sign_flag_set());
+        CHECK_EQ(0x05, registers.a());
         CHECK_EQ(0x05, sp);
     }
 
@@ -128,11 +126,10 @@ TEST_CASE("Z80: POP qq")
     {
         cycles = 0;
 
-        u8 reg1 = 0;
-        u8 reg2 = 0;
+        RegisterFile registers;
         u16 sp = 0x03;
 
-        pop(reg1, reg2, sp, memory, cycles);
+        pop(registers, RegisterPair::BC, sp, memory, cycles);
 
         CHECK_EQ(10, cycles);
     }
@@ -149,10 +146,10 @@ TEST_CASE("Z80: POP IX/IY")
     {
         cycles = 0;
 
-        u16 ix = 0x1234;
+        RegisterFile registers;
         u16 sp = 0x03;
 
-        pop_ixy(ix, sp, memory, cycles);
+        pop_ixy(registers, IndexRegister::IX, sp, memory, cycles);
 
         CHECK_EQ(14, cycles);
     }
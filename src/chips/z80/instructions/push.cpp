@@ -1,10 +1,8 @@
-#include "chips/z80/flags.h"
+#include "chips/z80/register_file.h"
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
-#include <string>
 #include <vector>
 
 namespace emu::z80 {
@@ -22,16 +20,17 @@ using emu::util::byte::low_byte;
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param reg1 is the first register to place in memory
- * @param reg2 is the second register to place in memory
+ * @param registers is the register file
+ * @param qq is the register pair to place in memory
  * @param sp is the stack pointer, which will be mutated
  * @param memory is the memory, which will be mutated
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void push_qq(u8 reg1, u8 reg2, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles)
+void push_qq(RegisterFile const& registers, RegisterPair qq, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles)
 {
-    memory.write(--sp, reg1);
-    memory.write(--sp, reg2);
+    const u16 value = registers.pair(qq);
+    memory.write(--sp, high_byte(value));
+    memory.write(--sp, low_byte(value));
 
     cycles = 11;
 }
@@ -45,16 +44,16 @@ void push_qq(u8 reg1, u8 reg2, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cy
  *   <li>Condition bits affected: none</li>
  * </ul>
  *
- * @param flag_reg is the flag register
- * @param acc_reg is the accumulator register
+ * @param registers is the register file, which contains A and F
  * @param sp is the stack pointer, which will be mutated
  * @param memory is the memory, which will be mutated
  * @param cycles is the number of cycles variable, which will be mutated
  */
-void push_af(Flags const& flag_reg, u8 acc_reg, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles)
+void push_af(RegisterFile const& registers, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles)
 {
-    memory.write(--sp, acc_reg);
-    memory.write(--sp, flag_reg.to_u8());
+    const u16 af = registers.af();
+    memory.write(--sp, high_byte(af));
+    memory.write(--sp, low_byte(af));
 
     cycles = 11;
 }
@@ -81,50 +80,45 @@ void push_ixy(u16 ixy_reg, u16& sp, EmulatorMemory<u16, u8>& memory, cyc& cycles
     cycles = 15;
 }
 
-void print_push(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "PUSH "
-            << reg;
-}
-
 TEST_CASE("Z80: PUSH qq")
 {
     cyc cycles = 0;
 
     SUBCASE("should push registers onto the stack")
     {
-        u8 reg1 = 0xaa;
-        u8 reg2 = 0xbb;
+        RegisterFile registers;
+        registers.d() = 0xaa;
+        registers.e() = 0xbb;
         u16 sp = 0x03;
 
         EmulatorMemory<u16, u8> memory;
         memory.add(std::vector<u8> { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 });
 
-        push_qq(reg1, reg2, sp, memory, cycles);
+        push_qq(registers, RegisterPair::DE, sp, memory, cycles);
 
-        CHECK_EQ(reg1, memory.read(0x2));
-        CHECK_EQ(reg2, memory.read(0x1));
+        CHECK_EQ(0xaa, memory.read(0x2));
+        CHECK_EQ(0xbb, memory.read(0x1));
         CHECK_EQ(0x01, sp);
     }
 
     SUBCASE("should push AF onto the stack")
     {
-        Flags flag_reg;
-        flag_reg.set_carry_flag();
-        flag_reg.set_zero_flag();
-        flag_reg.set_sign_flag();
-        flag_reg.set_parity_overflow_flag();
-        flag_reg.set_half_carry_flag();
-        u8 acc_reg = 0xbb;
+        RegisterFile registers;
+        registers.f().set_carry_flag();
+        registers.f().set_zero_flag();
+        registers.f().set_sign_flag();
+        registers.f().set_parity_overflow_flag();
+        registers.f().set_half_carry_flag();
+        registers.a() = 0xbb;
         u16 sp = 0x03;
 
         EmulatorMemory<u16, u8> memory;
         memory.add(std::vector<u8> { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 });
 
-        push_af(flag_reg, acc_reg, sp, memory, cycles);
+        push_af(registers, sp, memory, cycles);
 
-        CHECK_EQ(acc_reg, memory.read(0x2));
-        CHECK_EQ(flag_reg.to_u8(), memory.read(0x1));
+        CHECK_EQ(registers.a(), memory.read(0x2));
+        CHECK_EQ(registers.f().to_u8(), memory.read(0x1));
         CHECK_EQ(0x01, sp);
     }
 
@@ -132,14 +126,13 @@ TEST_CASE("Z80: PUSH qq")
     {
         cycles = 0;
 
-        const u8 reg1 = 0;
-        const u8 reg2 = 0;
+        const RegisterFile registers;
         u16 sp = 0x03;
 
         EmulatorMemory<u16, u8> memory;
         memory.add(std::vector<u8> { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 });
 
-        push_qq(reg1, reg2, sp, memory, cycles);
+        push_qq(registers, RegisterPair::BC, sp, memory, cycles);
 
         CHECK_EQ(11, cycles);
     }
@@ -5,8 +5,6 @@
 #include "doctest.h"
 #include <cassert>
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::memory {
 template<class A, class D>
@@ -15,7 +13,6 @@ class EmulatorMemory;
 
 namespace emu::z80 {
 
-using emu::memory::NextByte;
 using emu::util::byte::unset_bit;
 
 /**
@@ -87,32 +84,6 @@ void res_MixyPd(unsigned int bit_number, u16 ixy_reg, u8 d, EmulatorMemory<u16,
     cycles = 23;
 }
 
-void print_res(std::ostream& ostream, unsigned int bit_number, std::string const& src)
-{
-    assert(bit_number < 8);
-
-    ostream << "RES "
-            << bit_number
-            << ", "
-            << src;
-}
-
-void print_res_MixyPn(std::ostream& ostream, unsigned int bit_number, std::string const& ixy_reg, u8 d)
-{
-    assert(bit_number < 8);
-
-    const i8 signed_value = static_cast<i8>(d);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "RES "
-            << bit_number
-            << ", ("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << ")";
-}
-
 TEST_CASE("Z80: RES r")
 {
     cyc cycles = 0;
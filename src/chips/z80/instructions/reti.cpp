@@ -1,6 +1,5 @@
 #include "crosscutting/typedefs.h"
 #include "instruction_util.h"
-#include <iostream>
 
 namespace emu::memory {
 template<class A, class D>
@@ -30,9 +29,4 @@ void reti(u16& pc, u16& sp, EmulatorMemory<u16, u8> const& memory, cyc& cycles)
 
     cycles = 14;
 }
-
-void print_reti(std::ostream& ostream)
-{
-    ostream << "RETI";
-}
 }
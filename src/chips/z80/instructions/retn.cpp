@@ -1,6 +1,5 @@
 #include "crosscutting/typedefs.h"
 #include "instruction_util.h"
-#include <iostream>
 
 namespace emu::memory {
 template<class A, class D>
@@ -32,9 +31,4 @@ void retn(u16& pc, u16& sp, EmulatorMemory<u16, u8> const& memory, bool& iff1, b
 
     cycles = 14;
 }
-
-void print_retn(std::ostream& ostream)
-{
-    ostream << "RETN";
-}
 }
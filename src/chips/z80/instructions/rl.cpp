@@ -6,12 +6,9 @@
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
-using emu::memory::NextByte;
 using emu::util::byte::is_bit_set;
 using emu::util::byte::set_bit;
 
@@ -171,44 +168,6 @@ void rl_MixyPd_r(u8& reg, u16 ixy_reg, u8 d, EmulatorMemory<u16, u8>& memory, Fl
     cycles = 23;
 }
 
-void print_rla(std::ostream& ostream)
-{
-    ostream << "RLA";
-}
-
-void print_rl(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "RL "
-            << reg;
-}
-
-void print_rl_MixyPn(std::ostream& ostream, std::string const& ixy_reg, u8 d)
-{
-    const i8 signed_value = static_cast<i8>(d);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "RL "
-            << "("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << ")";
-}
-
-void print_rl_MixyPn_r(std::ostream& ostream, std::string const& ixy_reg, u8 d, std::string const& reg)
-{
-    const i8 signed_value = static_cast<i8>(d);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "RL "
-            << "("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << "),"
-            << reg;
-}
-
 TEST_CASE("Z80: RLA")
 {
     cyc cycles = 0;
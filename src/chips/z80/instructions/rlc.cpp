@@ -6,12 +6,9 @@
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
-using emu::memory::NextByte;
 using emu::util::byte::is_bit_set;
 using emu::util::byte::set_bit;
 
@@ -169,44 +166,6 @@ void rlc_MixyPd_r(u8& reg, u16 ixy_reg, u8 d, EmulatorMemory<u16, u8>& memory, F
     cycles = 23;
 }
 
-void print_rlca(std::ostream& ostream)
-{
-    ostream << "RLCA";
-}
-
-void print_rlc(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "RLC "
-            << reg;
-}
-
-void print_rlc_MixyPn(std::ostream& ostream, std::string const& ixy_reg, u8 d)
-{
-    const i8 signed_value = static_cast<i8>(d);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "RLC "
-            << "("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << ")";
-}
-
-void print_rlc_MixyPn_r(std::ostream& ostream, std::string const& ixy_reg, u8 d, std::string const& reg)
-{
-    const i8 signed_value = static_cast<i8>(d);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "RLC "
-            << "("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << "),"
-            << reg;
-}
-
 TEST_CASE("Z80: RLCA")
 {
     cyc cycles = 0;
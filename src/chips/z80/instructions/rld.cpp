@@ -2,7 +2,6 @@
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::z80 {
 
@@ -44,9 +43,4 @@ void rld(u8& acc_reg, EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_
 
     cycles = 18;
 }
-
-void print_rld(std::ostream& ostream)
-{
-    ostream << "RLD";
-}
 }
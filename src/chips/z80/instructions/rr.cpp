@@ -5,8 +5,6 @@
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
@@ -133,30 +131,6 @@ void rr_MixyPd(u16 ixy_reg, u8 d, EmulatorMemory<u16, u8>& memory, Flags& flag_r
     cycles = 23;
 }
 
-void print_rra(std::ostream& ostream)
-{
-    ostream << "RRA";
-}
-
-void print_rr(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "RR "
-            << reg;
-}
-
-void print_rr_MixyPn(std::ostream& ostream, std::string const& ixy_reg, u8 d)
-{
-    const i8 signed_value = static_cast<i8>(d);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "RR "
-            << "("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << ")";
-}
-
 TEST_CASE("Z80: RRA")
 {
     cyc cycles = 0;
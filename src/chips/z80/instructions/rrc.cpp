@@ -6,12 +6,9 @@
 #include "doctest.h"
 #include "instruction_util.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
-using emu::memory::NextByte;
 using emu::util::byte::is_bit_set;
 using emu::util::byte::set_bit;
 
@@ -169,30 +166,6 @@ void rrc_MixyPd_r(u8& reg, u16 ixy_reg, u8 d, EmulatorMemory<u16, u8>& memory, F
     cycles = 23;
 }
 
-void print_rrca(std::ostream& ostream)
-{
-    ostream << "RRCA";
-}
-
-void print_rrc(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "RLC "
-            << reg;
-}
-
-void print_rrc_MixyPn(std::ostream& ostream, std::string const& ixy_reg, u8 d)
-{
-    const i8 signed_value = static_cast<i8>(d);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "RRC "
-            << "("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << ")";
-}
-
 TEST_CASE("Z80: RRCA")
 {
     cyc cycles = 0;
@@ -3,13 +3,10 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::z80 {
 
 using emu::memory::EmulatorMemory;
-using emu::util::byte::is_bit_set;
-using emu::util::byte::set_bit;
 
 /**
  * Rotate right digit
@@ -48,11 +45,6 @@ void rrd(u8& acc_reg, EmulatorMemory<u16, u8>& memory, u16 address, Flags& flag_
     cycles = 18;
 }
 
-void print_rrd(std::ostream& ostream)
-{
-    ostream << "RRD";
-}
-
 TEST_CASE("Z80: RRD")
 {
     cyc cycles = 0;
@@ -2,7 +2,6 @@
 #include "crosscutting/typedefs.h"
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
-#include <iostream>
 
 namespace emu::z80 {
 
@@ -42,11 +41,6 @@ void scf(Flags& flag_reg, u8 acc_reg, cyc& cycles)
     cycles = 4;
 }
 
-void print_scf(std::ostream& ostream)
-{
-    ostream << "SCF";
-}
-
 TEST_CASE("Z80: SCF")
 {
     cyc cycles = 0;
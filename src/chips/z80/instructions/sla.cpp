@@ -5,12 +5,9 @@
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
-using emu::memory::NextByte;
 using emu::util::byte::is_bit_set;
 
 void sla(u8& value, Flags& flag_reg)
@@ -130,24 +127,4 @@ void sla_MixyPd_r(u8& reg, u16 ixy_reg, u8 d, EmulatorMemory<u16, u8>& memory, F
 
     cycles = 23;
 }
-
-void print_sla(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "SLA "
-            << reg;
-}
-
-void print_sla_MixyPn(std::ostream& ostream, unsigned int bit_number, std::string const& ixy_reg, u8 d)
-{
-    const i8 signed_value = static_cast<i8>(d);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "SLA "
-            << bit_number
-            << ", ("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << ")";
-}
 }
@@ -5,12 +5,9 @@
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
-using emu::memory::NextByte;
 using emu::util::byte::is_bit_set;
 using emu::util::byte::set_bit;
 
@@ -137,23 +134,4 @@ void sll_MixyPd_r_undoc(u8& reg, u16 ixy_reg, u8 d, EmulatorMemory<u16, u8>& mem
 
 /******************************** END OF FUNCTIONS FOR UNDOCUMENTED INSTRUCTIONS **********************************/
 
-void print_sll(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "SLL "
-            << reg;
-}
-
-void print_sll_MixyPn(std::ostream& ostream, unsigned int bit_number, std::string const& ixy_reg, u8 d)
-{
-    const i8 signed_value = static_cast<i8>(d);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "SLL "
-            << bit_number
-            << ", ("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << ")";
-}
 }
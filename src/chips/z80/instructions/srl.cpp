@@ -5,14 +5,10 @@
 #include "crosscutting/util/byte_util.h"
 #include "doctest.h"
 #include "instruction_util.h"
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
-using emu::memory::NextByte;
 using emu::util::byte::is_bit_set;
-using emu::util::byte::set_bit;
 
 void srl(u8& value, Flags& flag_reg)
 {
@@ -132,24 +128,4 @@ void srl_MixyPd_r(u8& reg, u16 ixy_reg, u8 d, EmulatorMemory<u16, u8>& memory, F
 
     cycles = 23;
 }
-
-void print_srl(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "SRL "
-            << reg;
-}
-
-void print_srl_MixyPn(std::ostream& ostream, unsigned int bit_number, std::string const& ixy_reg, u8 d)
-{
-    const i8 signed_value = static_cast<i8>(d);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "SRL "
-            << bit_number
-            << ", ("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << ")";
-}
 }
@@ -2,17 +2,13 @@
 #include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/memory/next_byte.h"
 #include "crosscutting/typedefs.h"
-#include "crosscutting/util/string_util.h"
 #include "doctest.h"
 #include <cstdint>
-#include <iostream>
-#include <string>
 
 namespace emu::z80 {
 
 using emu::memory::EmulatorMemory;
 using emu::memory::NextByte;
-using emu::util::string::hexify_wo_0x;
 
 void xor_(u8& acc_reg, u8 value, Flags& flag_reg)
 {
@@ -165,38 +161,6 @@ void xor_ixy_h_or_l(u8& acc_reg, u8 ixy_reg_h_or_l, Flags& flag_reg, cyc& cycles
 
 /******************************** END OF FUNCTIONS FOR UNDOCUMENTED INSTRUCTIONS **********************************/
 
-void print_xor_r(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "XOR "
-            << reg;
-}
-
-void print_xor_r_undocumented(std::ostream& ostream, std::string const& reg)
-{
-    ostream << "XOR "
-            << reg
-            << "*";
-}
-
-void print_xor_n(std::ostream& ostream, NextByte const& args)
-{
-    ostream << "XOR "
-            << hexify_wo_0x(args.farg);
-}
-
-void print_xor_MixyPn(std::ostream& ostream, std::string const& ixy_reg, NextByte const& args)
-{
-    const i8 signed_value = static_cast<i8>(args.farg);
-    const std::string plus_or_minus = (signed_value >= 0) ? "+" : "";
-
-    ostream << "XOR "
-            << "("
-            << ixy_reg
-            << plus_or_minus
-            << +signed_value
-            << ")";
-}
-
 TEST_CASE("Z80: XOR")
 {
     u8 acc_reg = 0;
@@ -0,0 +1,153 @@
+#include "register_file.h"
+#include "doctest.h"
+#include <cstring>
+
+namespace emu::z80 {
+
+RegisterFile::RegisterFile()
+{
+    reset();
+}
+
+void RegisterFile::reset()
+{
+    m_pairs.fill(0);
+    m_acc = { 0xff, 0 };
+    m_flags[0].from_u8(0xff);
+    m_flags[1].from_u8(0x00);
+    m_index.fill(0);
+    m_bank = 0;
+    m_af_bank = 0;
+}
+
+TEST_CASE("Z80: RegisterFile")
+{
+    SUBCASE("should start with A and F set and everything else cleared")
+    {
+        RegisterFile registers;
+
+        CHECK_EQ(0xff, registers.a());
+        CHECK_EQ(0xff, registers.f().to_u8());
+        CHECK_EQ(0, registers.a_p());
+        CHECK_EQ(0, registers.f_p().to_u8());
+        CHECK_EQ(0, registers.bc());
+        CHECK_EQ(0, registers.de());
+        CHECK_EQ(0, registers.hl());
+        CHECK_EQ(0, registers.ix());
+        CHECK_EQ(0, registers.iy());
+    }
+
+    SUBCASE("should see the same value in a pair and in its two registers")
+    {
+        RegisterFile registers;
+
+        for (auto const pair : { RegisterPair::BC, RegisterPair::DE, RegisterPair::HL }) {
+            registers.set_pair(pair, 0x1234);
+        }
+        registers.c() = 0x78;
+        registers.d() = 0x9a;
+        registers.h() = 0xcd;
+
+        CHECK_EQ(0x12, registers.b());
+        CHECK_EQ(0x34, registers.e());
+        CHECK_EQ(0x34, registers.l());
+        CHECK_EQ(0x1278, registers.bc());
+        CHECK_EQ(0x9a34, registers.de());
+        CHECK_EQ(0xcd34, registers.pair(RegisterPair::HL));
+    }
+
+    SUBCASE("should exchange BC, DE and HL with BC', DE' and HL'")
+    {
+        RegisterFile registers;
+        registers.set_pair(RegisterPair::BC, 0x1122);
+        registers.set_pair(RegisterPair::DE, 0x3344);
+        registers.set_pair(RegisterPair::HL, 0x5566);
+        registers.b_p() = 0x77;
+        registers.l_p() = 0x88;
+
+        registers.exchange_bc_de_hl();
+
+        CHECK_EQ(0x7700, registers.bc());
+        CHECK_EQ(0x0000, registers.de());
+        CHECK_EQ(0x0088, registers.hl());
+        CHECK_EQ(0x11, registers.b_p());
+        CHECK_EQ(0x22, registers.c_p());
+        CHECK_EQ(0x33, registers.d_p());
+        CHECK_EQ(0x44, registers.e_p());
+        CHECK_EQ(0x55, registers.h_p());
+        CHECK_EQ(0x66, registers.l_p());
+        CHECK_EQ(0xff, registers.a());
+
+        registers.exchange_bc_de_hl();
+
+        CHECK_EQ(0x1122, registers.bc());
+        CHECK_EQ(0x3344, registers.de());
+        CHECK_EQ(0x5566, registers.hl());
+    }
+
+    SUBCASE("should exchange AF with AF'")
+    {
+        RegisterFile registers;
+        registers.a_p() = 0x42;
+        registers.set_pair(RegisterPair::BC, 0x1234);
+
+        registers.exchange_af();
+
+        CHECK_EQ(0x42, registers.a());
+        CHECK_EQ(0, registers.f().to_u8());
+        CHECK_EQ(0xff, registers.a_p());
+        CHECK_EQ(0xff, registers.f_p().to_u8());
+        CHECK_EQ(0x1234, registers.bc());
+    }
+
+    SUBCASE("should see the same value in IX and IY and in their two halves")
+    {
+        RegisterFile registers;
+
+        registers.set_index(IndexRegister::IX, 0x1234);
+        registers.iyh() = 0x56;
+        registers.iyl() = 0x78;
+        ++registers.index_low(IndexRegister::IX);
+
+        CHECK_EQ(0x12, registers.ixh());
+        CHECK_EQ(0x35, registers.ixl());
+        CHECK_EQ(0x1235, registers.ix());
+        CHECK_EQ(0x5678, registers.iy());
+        CHECK_EQ(0x5678, registers.index(IndexRegister::IY));
+    }
+
+    SUBCASE("should see the same value in AF and in A and F")
+    {
+        RegisterFile registers;
+
+        registers.set_af(0x12d7);
+        registers.exchange_af();
+        registers.a() = 0x34;
+        registers.f().from_u8(0x00);
+        registers.exchange_af();
+
+        CHECK_EQ(0x12, registers.a());
+        CHECK_EQ(0xd7, registers.f().to_u8());
+        CHECK_EQ(0x12d7, registers.af());
+    }
+
+    SUBCASE("should be restored from a copy of its memory")
+    {
+        RegisterFile registers;
+        registers.set_pair(RegisterPair::HL, 0xbeef);
+        registers.set_index(IndexRegister::IX, 0x4000);
+        registers.exchange_bc_de_hl();
+        registers.exchange_af();
+
+        RegisterFile snapshot;
+        std::memcpy(&snapshot, &registers, sizeof(RegisterFile));
+        registers.reset();
+
+        CHECK_EQ(0, snapshot.hl());
+        CHECK_EQ(0xbe, snapshot.h_p());
+        CHECK_EQ(0xef, snapshot.l_p());
+        CHECK_EQ(0x4000, snapshot.ix());
+        CHECK_EQ(0xff, snapshot.a_p());
+    }
+}
+}
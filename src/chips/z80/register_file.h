@@ -0,0 +1,382 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include "flags.h"
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace emu::z80 {
+
+/**
+ * The register pairs that can be used as one 16-bit operand, in the order they are encoded in the
+ * opcodes.
+ */
+enum class RegisterPair {
+    BC = 0,
+    DE = 1,
+    HL = 2
+};
+
+/**
+ * The index registers, which take the place of HL in the instructions with a DD or an FD prefix.
+ */
+enum class IndexRegister {
+    IX = 0,
+    IY = 1
+};
+
+/**
+ * The general purpose registers of the Z80, packed next to each other.
+ *
+ * Unlike the 8080 and the LR35902, the Z80 has an alternate copy of A, F, BC, DE and HL. BC, DE and
+ * HL of both sets are stored as two banks in one array, and EXX only flips which bank is the main
+ * one. A and F have their own index, since EX AF, AF' swaps them without touching the other pairs.
+ * The alternate set is reached through the _p accessors. IX and IY are stored low byte first like
+ * the other pairs, so that ixh(), ixl(), iyh() and iyl() are views of the same bytes as ix() and
+ * iy(), and the instructions with a DD or an FD prefix can pick the index register with an
+ * IndexRegister.
+ */
+class RegisterFile {
+public:
+    RegisterFile();
+
+    u8& a()
+    {
+        return m_acc[m_af_bank];
+    }
+
+    u8& b()
+    {
+        return m_pairs[m_bank + s_b];
+    }
+
+    u8& c()
+    {
+        return m_pairs[m_bank + s_c];
+    }
+
+    u8& d()
+    {
+        return m_pairs[m_bank + s_d];
+    }
+
+    u8& e()
+    {
+        return m_pairs[m_bank + s_e];
+    }
+
+    u8& h()
+    {
+        return m_pairs[m_bank + s_h];
+    }
+
+    u8& l()
+    {
+        return m_pairs[m_bank + s_l];
+    }
+
+    Flags& f()
+    {
+        return m_flags[m_af_bank];
+    }
+
+    u8& ixh()
+    {
+        return index_high(IndexRegister::IX);
+    }
+
+    u8& ixl()
+    {
+        return index_low(IndexRegister::IX);
+    }
+
+    u8& iyh()
+    {
+        return index_high(IndexRegister::IY);
+    }
+
+    u8& iyl()
+    {
+        return index_low(IndexRegister::IY);
+    }
+
+    [[nodiscard]] u8 a() const
+    {
+        return m_acc[m_af_bank];
+    }
+
+    [[nodiscard]] u8 b() const
+    {
+        return m_pairs[m_bank + s_b];
+    }
+
+    [[nodiscard]] u8 c() const
+    {
+        return m_pairs[m_bank + s_c];
+    }
+
+    [[nodiscard]] u8 d() const
+    {
+        return m_pairs[m_bank + s_d];
+    }
+
+    [[nodiscard]] u8 e() const
+    {
+        return m_pairs[m_bank + s_e];
+    }
+
+    [[nodiscard]] u8 h() const
+    {
+        return m_pairs[m_bank + s_h];
+    }
+
+    [[nodiscard]] u8 l() const
+    {
+        return m_pairs[m_bank + s_l];
+    }
+
+    [[nodiscard]] Flags const& f() const
+    {
+        return m_flags[m_af_bank];
+    }
+
+    [[nodiscard]] u8 ixh() const
+    {
+        return index_high(IndexRegister::IX);
+    }
+
+    [[nodiscard]] u8 ixl() const
+    {
+        return index_low(IndexRegister::IX);
+    }
+
+    [[nodiscard]] u8 iyh() const
+    {
+        return index_high(IndexRegister::IY);
+    }
+
+    [[nodiscard]] u8 iyl() const
+    {
+        return index_low(IndexRegister::IY);
+    }
+
+    u8& a_p()
+    {
+        return m_acc[alternate_af_bank()];
+    }
+
+    u8& b_p()
+    {
+        return m_pairs[alternate_bank() + s_b];
+    }
+
+    u8& c_p()
+    {
+        return m_pairs[alternate_bank() + s_c];
+    }
+
+    u8& d_p()
+    {
+        return m_pairs[alternate_bank() + s_d];
+    }
+
+    u8& e_p()
+    {
+        return m_pairs[alternate_bank() + s_e];
+    }
+
+    u8& h_p()
+    {
+        return m_pairs[alternate_bank() + s_h];
+    }
+
+    u8& l_p()
+    {
+        return m_pairs[alternate_bank() + s_l];
+    }
+
+    Flags& f_p()
+    {
+        return m_flags[alternate_af_bank()];
+    }
+
+    [[nodiscard]] u8 a_p() const
+    {
+        return m_acc[alternate_af_bank()];
+    }
+
+    [[nodiscard]] u8 b_p() const
+    {
+        return m_pairs[alternate_bank() + s_b];
+    }
+
+    [[nodiscard]] u8 c_p() const
+    {
+        return m_pairs[alternate_bank() + s_c];
+    }
+
+    [[nodiscard]] u8 d_p() const
+    {
+        return m_pairs[alternate_bank() + s_d];
+    }
+
+    [[nodiscard]] u8 e_p() const
+    {
+        return m_pairs[alternate_bank() + s_e];
+    }
+
+    [[nodiscard]] u8 h_p() const
+    {
+        return m_pairs[alternate_bank() + s_h];
+    }
+
+    [[nodiscard]] u8 l_p() const
+    {
+        return m_pairs[alternate_bank() + s_l];
+    }
+
+    [[nodiscard]] Flags const& f_p() const
+    {
+        return m_flags[alternate_af_bank()];
+    }
+
+    [[nodiscard]] u16 pair(RegisterPair pair) const
+    {
+        const std::size_t low = low_byte_index(pair);
+        return static_cast<u16>(m_pairs[low] | (m_pairs[low + 1] << 8));
+    }
+
+    void set_pair(RegisterPair pair, u16 value)
+    {
+        const std::size_t low = low_byte_index(pair);
+        m_pairs[low] = static_cast<u8>(value);
+        m_pairs[low + 1] = static_cast<u8>(value >> 8);
+    }
+
+    [[nodiscard]] u16 bc() const
+    {
+        return pair(RegisterPair::BC);
+    }
+
+    [[nodiscard]] u16 de() const
+    {
+        return pair(RegisterPair::DE);
+    }
+
+    [[nodiscard]] u16 hl() const
+    {
+        return pair(RegisterPair::HL);
+    }
+
+    [[nodiscard]] u16 af() const
+    {
+        return static_cast<u16>((a() << 8) | f().to_u8());
+    }
+
+    void set_af(u16 value)
+    {
+        a() = static_cast<u8>(value >> 8);
+        f().from_u8(static_cast<u8>(value));
+    }
+
+    u8& index_high(IndexRegister ixy)
+    {
+        return m_index[low_byte_index(ixy) + 1];
+    }
+
+    u8& index_low(IndexRegister ixy)
+    {
+        return m_index[low_byte_index(ixy)];
+    }
+
+    [[nodiscard]] u8 index_high(IndexRegister ixy) const
+    {
+        return m_index[low_byte_index(ixy) + 1];
+    }
+
+    [[nodiscard]] u8 index_low(IndexRegister ixy) const
+    {
+        return m_index[low_byte_index(ixy)];
+    }
+
+    [[nodiscard]] u16 index(IndexRegister ixy) const
+    {
+        const std::size_t low = low_byte_index(ixy);
+        return static_cast<u16>(m_index[low] | (m_index[low + 1] << 8));
+    }
+
+    void set_index(IndexRegister ixy, u16 value)
+    {
+        const std::size_t low = low_byte_index(ixy);
+        m_index[low] = static_cast<u8>(value);
+        m_index[low + 1] = static_cast<u8>(value >> 8);
+    }
+
+    [[nodiscard]] u16 ix() const
+    {
+        return index(IndexRegister::IX);
+    }
+
+    [[nodiscard]] u16 iy() const
+    {
+        return index(IndexRegister::IY);
+    }
+
+    /**
+     * Makes AF' the main AF, and AF the alternate, as done by EX AF, AF'.
+     */
+    void exchange_af()
+    {
+        m_af_bank = alternate_af_bank();
+    }
+
+    /**
+     * Makes BC', DE' and HL' the main BC, DE and HL, and the other way around, as done by EXX.
+     */
+    void exchange_bc_de_hl()
+    {
+        m_bank = alternate_bank();
+    }
+
+    void reset();
+
+private:
+    static constexpr std::size_t s_c = 0;
+    static constexpr std::size_t s_b = 1;
+    static constexpr std::size_t s_e = 2;
+    static constexpr std::size_t s_d = 3;
+    static constexpr std::size_t s_l = 4;
+    static constexpr std::size_t s_h = 5;
+    static constexpr std::size_t s_bank_size = 6;
+
+    std::array<u8, 2 * s_bank_size> m_pairs;
+    std::array<u8, 2> m_acc;
+    std::array<Flags, 2> m_flags;
+    std::array<u8, 4> m_index; // IX and then IY
+    std::size_t m_bank;    // Where in m_pairs the main BC, DE and HL start
+    std::size_t m_af_bank; // Which of the two A and F are the main ones
+
+    [[nodiscard]] std::size_t alternate_bank() const
+    {
+        return s_bank_size - m_bank;
+    }
+
+    [[nodiscard]] std::size_t alternate_af_bank() const
+    {
+        return 1 - m_af_bank;
+    }
+
+    [[nodiscard]] std::size_t low_byte_index(RegisterPair pair) const
+    {
+        return m_bank + 2 * static_cast<std::size_t>(pair);
+    }
+
+    static std::size_t low_byte_index(IndexRegister ixy)
+    {
+        return 2 * static_cast<std::size_t>(ixy);
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<RegisterFile>, "The registers have to be copyable as one block of memory");
+}
@@ -0,0 +1,123 @@
+#include "blep_synthesizer.h"
+#include "doctest.h"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace emu::audio {
+
+BlepSynthesizer::BlepSynthesizer(u64 clock_frequency, u32 sample_rate)
+    : m_samples_per_clock_cycle(static_cast<double>(sample_rate) / static_cast<double>(clock_frequency))
+    , m_deltas(s_kernel_width, 0)
+{
+    constexpr double half_width = s_kernel_width / 2.0;
+
+    for (std::size_t phase = 0; phase < s_number_of_phases; ++phase) {
+        const double fraction = static_cast<double>(phase) / s_number_of_phases;
+
+        double sum = 0;
+        std::array<double, s_kernel_width> kernel {};
+        for (std::size_t tap = 0; tap < s_kernel_width; ++tap) {
+            const double x = static_cast<double>(tap) - half_width - fraction;
+            const double sinc = x == 0 ? 1.0 : std::sin(std::numbers::pi * s_cutoff * x) / (std::numbers::pi * s_cutoff * x);
+            const double window = 0.42 + 0.5 * std::cos(std::numbers::pi * x / half_width) + 0.08 * std::cos(2 * std::numbers::pi * x / half_width);
+            kernel[tap] = sinc * std::max(0.0, window);
+            sum += kernel[tap];
+        }
+
+        // Every step has to end up at exactly the delta, whatever the phase
+        for (std::size_t tap = 0; tap < s_kernel_width; ++tap) {
+            m_kernels[phase][tap] = static_cast<float>(kernel[tap] / sum);
+        }
+    }
+}
+
+void BlepSynthesizer::add_step(cyc clock_cycle, float delta)
+{
+    const double position = m_sample_offset + static_cast<double>(clock_cycle) * m_samples_per_clock_cycle;
+    const auto sample = static_cast<std::size_t>(position);
+    const auto phase = static_cast<std::size_t>((position - static_cast<double>(sample)) * s_number_of_phases);
+
+    if (m_deltas.size() < sample + s_kernel_width) {
+        m_deltas.resize(sample + s_kernel_width, 0);
+    }
+
+    std::array<float, s_kernel_width> const& kernel = m_kernels[phase];
+    for (std::size_t tap = 0; tap < s_kernel_width; ++tap) {
+        m_deltas[sample + tap] += delta * kernel[tap];
+    }
+}
+
+void BlepSynthesizer::end_block(cyc clock_cycles, std::vector<i16>& output)
+{
+    const double end = m_sample_offset + static_cast<double>(clock_cycles) * m_samples_per_clock_cycle;
+    const auto number_of_samples = static_cast<std::size_t>(end);
+
+    if (m_deltas.size() < number_of_samples + s_kernel_width) {
+        m_deltas.resize(number_of_samples + s_kernel_width, 0);
+    }
+
+    for (std::size_t sample = 0; sample < number_of_samples; ++sample) {
+        m_level += m_deltas[sample];
+        m_output = m_level - m_previous_level + s_dc_blocker_pole * m_output;
+        m_previous_level = m_level;
+        output.push_back(static_cast<i16>(std::clamp(std::lround(m_output), -32768L, 32767L)));
+    }
+
+    // The tails of the steps near the end of the block are kept for the next block
+    m_deltas.erase(m_deltas.begin(), m_deltas.begin() + static_cast<std::ptrdiff_t>(number_of_samples));
+    m_sample_offset = end - static_cast<double>(number_of_samples);
+}
+
+TEST_CASE("crosscutting: BlepSynthesizer")
+{
+    constexpr u64 clock_frequency = 3494400; // 69888 T-states per frame at 50 frames per second
+    constexpr u32 sample_rate = 44100;
+    constexpr cyc clock_cycles_per_frame = 69888;
+
+    BlepSynthesizer synthesizer(clock_frequency, sample_rate);
+    std::vector<i16> samples;
+
+    SUBCASE("should be silent without steps")
+    {
+        synthesizer.end_block(clock_cycles_per_frame, samples);
+
+        CHECK_EQ(882, samples.size());
+        CHECK(std::all_of(samples.begin(), samples.end(), [](i16 sample) { return sample == 0; }));
+    }
+
+    SUBCASE("should carry the part of a sample that is left over to the next block")
+    {
+        for (int i = 0; i < 3; ++i) {
+            synthesizer.end_block(clock_cycles_per_frame / 3, samples);
+        }
+
+        CHECK_EQ(882, samples.size());
+    }
+
+    SUBCASE("should rise to the level of the step and then fall back to zero")
+    {
+        synthesizer.add_step(clock_cycles_per_frame / 2, 10000);
+        synthesizer.end_block(clock_cycles_per_frame, samples);
+
+        CHECK_EQ(0, samples[400]);
+        const i16 peak = *std::max_element(samples.begin(), samples.end());
+        CHECK_GT(peak, 9000);
+        CHECK_LT(peak, 11000);
+        CHECK_LT(samples.back(), peak);
+    }
+
+    SUBCASE("should place a step after the end of the block in the next block")
+    {
+        synthesizer.add_step(clock_cycles_per_frame + 800, 10000);
+        synthesizer.end_block(clock_cycles_per_frame, samples);
+
+        CHECK(std::all_of(samples.begin(), samples.end(), [](i16 sample) { return sample == 0; }));
+
+        samples.clear();
+        synthesizer.end_block(clock_cycles_per_frame, samples);
+
+        CHECK_GT(*std::max_element(samples.begin(), samples.end()), 9000);
+    }
+}
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace emu::audio {
+
+/**
+ * Turns a signal that only changes in steps, like a beeper, into samples without aliasing. Every
+ * step is added as a band-limited step (BLEP) at its exact time, so a step that happens between
+ * two samples is heard as happening between them, and the work is per step and per sample instead
+ * of per emulated cycle.
+ *
+ * The steps are added as the derivative of a windowed sinc, one kernel per fraction of a sample,
+ * and the samples are the running sum of that. The DC is filtered away, as a speaker would.
+ */
+class BlepSynthesizer {
+public:
+    /**
+     * @param clock_frequency is the frequency of the clock that the steps are timestamped with, in Hz
+     * @param sample_rate is the sample rate of the output, in Hz
+     */
+    BlepSynthesizer(u64 clock_frequency, u32 sample_rate);
+
+    /**
+     * @param clock_cycle is when the step happens, in clock cycles since the start of the block.
+     *                    Can be after the end of the block, which puts it in the next block.
+     * @param delta is how much the level changes
+     */
+    void add_step(cyc clock_cycle, float delta);
+
+    /**
+     * Ends the block, and appends the samples that are done. A sample that is only partly in the
+     * block is left for the next block, so the blocks don't need to be a whole number of samples.
+     *
+     * @param clock_cycles is the length of the block, in clock cycles
+     * @param output is where the samples are appended
+     */
+    void end_block(cyc clock_cycles, std::vector<i16>& output);
+
+private:
+    static constexpr std::size_t s_kernel_width = 16;
+    static constexpr std::size_t s_number_of_phases = 32;
+    static constexpr double s_cutoff = 0.9; // Of the Nyquist frequency, which leaves room for the filter to roll off
+    static constexpr float s_dc_blocker_pole = 0.999f;
+
+    double m_samples_per_clock_cycle;
+    std::array<std::array<float, s_kernel_width>, s_number_of_phases> m_kernels {};
+
+    std::vector<float> m_deltas;  // The differences between the samples, from the start of the block
+    double m_sample_offset { 0 }; // How far into the first sample the block starts
+
+    float m_level { 0 };
+    float m_previous_level { 0 };
+    float m_output { 0 };
+};
+}
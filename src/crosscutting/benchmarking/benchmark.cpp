@@ -0,0 +1,73 @@
+#include "benchmark.h"
+#include "crosscutting/typedefs.h"
+#include "doctest.h"
+
+namespace emu::benchmarking {
+
+bool Bench::has_run() const
+{
+    return m_has_run;
+}
+
+double Bench::ns_per_operation() const
+{
+    return m_ns_per_operation;
+}
+
+std::vector<BenchmarkCase>& benchmark_cases()
+{
+    static std::vector<BenchmarkCase> cases;
+
+    return cases;
+}
+
+bool register_benchmark(char const* name, BenchmarkFunction function)
+{
+    benchmark_cases().push_back({ .m_name = name, .m_function = function });
+
+    return true;
+}
+
+std::vector<u8> pseudo_random_bytes(std::size_t count)
+{
+    std::vector<u8> bytes(count);
+    u32 seed = 1;
+    for (u8& byte : bytes) {
+        seed = seed * 1103515245 + 12345;
+        byte = static_cast<u8>(seed >> 16);
+    }
+
+    return bytes;
+}
+
+TEST_CASE("crosscutting: Bench")
+{
+    SUBCASE("should not have a result before it has run")
+    {
+        Bench bench;
+
+        CHECK_FALSE(bench.has_run());
+    }
+
+    SUBCASE("should find the time of one operation")
+    {
+        Bench bench;
+        unsigned int operations = 0;
+
+        bench.run([&]() {
+            ++operations;
+            do_not_optimize(operations);
+        });
+
+        CHECK(bench.has_run());
+        CHECK_GT(operations, 0);
+        CHECK_GT(bench.ns_per_operation(), 0.0);
+    }
+
+    SUBCASE("should give the same pseudo-random bytes every time")
+    {
+        CHECK_EQ(pseudo_random_bytes(64), pseudo_random_bytes(64));
+        CHECK_NE(pseudo_random_bytes(64), std::vector<u8>(64, 0));
+    }
+}
+}
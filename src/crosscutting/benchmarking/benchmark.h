@@ -0,0 +1,116 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace emu::benchmarking {
+
+/**
+ * Times the operation of one benchmark. The operation is run in batches that are long enough for
+ * the clock to be accurate, and the median batch is what's reported, so that a batch that was
+ * interrupted by something else on the machine doesn't skew the result.
+ */
+class Bench {
+public:
+    /**
+     * @param operation is what to time, which should do one thing, like run one instruction or
+     *                  draw one frame, so that the result is the time it takes to do it once
+     */
+    template<class Operation>
+    void run(Operation&& operation)
+    {
+        std::size_t batch_size = 1;
+        while (time_batch(operation, batch_size) < s_min_batch_time) {
+            batch_size *= 2;
+        }
+
+        std::vector<double> ns_per_operation;
+        for (std::size_t batch = 0; batch < s_number_of_batches; ++batch) {
+            const std::chrono::nanoseconds batch_time = time_batch(operation, batch_size);
+            ns_per_operation.push_back(static_cast<double>(batch_time.count()) / static_cast<double>(batch_size));
+        }
+
+        std::nth_element(ns_per_operation.begin(), ns_per_operation.begin() + s_number_of_batches / 2, ns_per_operation.end());
+        m_ns_per_operation = ns_per_operation[s_number_of_batches / 2];
+        m_has_run = true;
+    }
+
+    [[nodiscard]] bool has_run() const;
+
+    [[nodiscard]] double ns_per_operation() const;
+
+private:
+    static constexpr std::chrono::nanoseconds s_min_batch_time = std::chrono::milliseconds(10);
+    static constexpr std::size_t s_number_of_batches = 9;
+
+    bool m_has_run { false };
+    double m_ns_per_operation { 0 };
+
+    template<class Operation>
+    static std::chrono::nanoseconds time_batch(Operation& operation, std::size_t batch_size)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < batch_size; ++i) {
+            operation();
+        }
+
+        return std::chrono::steady_clock::now() - start;
+    }
+};
+
+using BenchmarkFunction = void (*)(Bench& bench);
+
+struct BenchmarkCase {
+    std::string m_name;
+    BenchmarkFunction m_function;
+};
+
+/**
+ * @return every benchmark that has been registered with BENCHMARK, in the order they were registered
+ */
+std::vector<BenchmarkCase>& benchmark_cases();
+
+bool register_benchmark(char const* name, BenchmarkFunction function);
+
+/**
+ * @return bytes that look random, but are the same every time, so that the benchmarks always
+ *         work on the same data
+ */
+std::vector<u8> pseudo_random_bytes(std::size_t count);
+
+/**
+ * Makes the compiler treat the value as used, so that the work done to compute it isn't optimized
+ * away from a benchmark.
+ */
+template<class T>
+inline void do_not_optimize(T const& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile(""
+                 :
+                 : "r,m"(value)
+                 : "memory");
+#else
+    static volatile char const* sink;
+    sink = reinterpret_cast<char const*>(&value);
+#endif
+}
+}
+
+#define EMU_BENCHMARK_CONCAT_IMPL(first, second) first##second
+#define EMU_BENCHMARK_CONCAT(first, second) EMU_BENCHMARK_CONCAT_IMPL(first, second)
+#define EMU_BENCHMARK_IMPL(function, name)                                                                          \
+    static void function(emu::benchmarking::Bench& bench);                                                        \
+    [[maybe_unused]] static const bool EMU_BENCHMARK_CONCAT(function, _is_registered)                             \
+        = emu::benchmarking::register_benchmark(name, function);                                                  \
+    static void function(emu::benchmarking::Bench& bench)
+
+/**
+ * Registers a benchmark the same way as TEST_CASE registers a test, so that benchmarks can be put
+ * next to the code they measure. The body is given a Bench called bench, and has to call bench.run.
+ */
+#define BENCHMARK(name) EMU_BENCHMARK_IMPL(EMU_BENCHMARK_CONCAT(emu_benchmark_, __COUNTER__), name)
@@ -0,0 +1,294 @@
+#include "benchmark_runner.h"
+#include "benchmark.h"
+#include "crosscutting/exceptions/rom_file_not_found_exception.h"
+#include "crosscutting/misc/json_reader.h"
+#include "doctest.h"
+#include <filesystem>
+#include <fmt/core.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace emu::benchmarking {
+
+using emu::exceptions::RomFileNotFoundException;
+using emu::misc::JsonReader;
+using emu::misc::JsonToken;
+
+BenchmarkRunner::BenchmarkRunner(std::vector<std::string> filters)
+    : m_filters(std::move(filters))
+{
+}
+
+std::vector<BenchmarkResult> BenchmarkRunner::run() const
+{
+    std::vector<BenchmarkResult> results;
+
+    for (BenchmarkCase const& benchmark_case : benchmark_cases()) {
+        if (!is_selected(benchmark_case.m_name)) {
+            continue;
+        }
+
+        Bench bench;
+        benchmark_case.m_function(bench);
+        if (!bench.has_run()) {
+            throw std::runtime_error(fmt::format("The benchmark {} never called run", benchmark_case.m_name));
+        }
+
+        results.push_back({ .m_name = benchmark_case.m_name, .m_ns_per_operation = bench.ns_per_operation() });
+        std::cout << fmt::format("{:<{}}{:>14.2f} ns\n", benchmark_case.m_name, s_name_width, bench.ns_per_operation());
+    }
+
+    return results;
+}
+
+void BenchmarkRunner::save(std::string const& path, std::vector<BenchmarkResult> const& results)
+{
+    std::ofstream out(path, std::ios::out | std::ios::trunc);
+    write_baseline(out, results);
+    if (!out) {
+        throw std::runtime_error(fmt::format("Unable to write the baseline to {}", path));
+    }
+}
+
+std::vector<BenchmarkResult> BenchmarkRunner::load(std::string const& path)
+{
+    if (!std::filesystem::exists(path)) {
+        throw RomFileNotFoundException(path);
+    }
+
+    std::ifstream in(path);
+    return read_baseline(in);
+}
+
+void BenchmarkRunner::write_baseline(std::ostream& stream, std::vector<BenchmarkResult> const& results)
+{
+    stream << "{\n    \"benchmarks\": [";
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        std::string escaped_name;
+        for (char c : results[i].m_name) {
+            if (c == '"' || c == '\\') {
+                escaped_name += '\\';
+            }
+            escaped_name += c;
+        }
+
+        stream << (i == 0 ? "\n" : ",\n")
+               << fmt::format(
+                      "        {{ \"name\": \"{}\", \"ns_per_operation\": {:.2f} }}",
+                      escaped_name,
+                      results[i].m_ns_per_operation);
+    }
+
+    stream << "\n    ]\n}\n";
+}
+
+/**
+ * Reads a baseline that was written by write_baseline. Keys it doesn't know about are skipped, so
+ * that more can be stored for each benchmark later without breaking the baselines.
+ */
+std::vector<BenchmarkResult> BenchmarkRunner::read_baseline(std::istream& stream)
+{
+    JsonReader reader(stream);
+    std::vector<BenchmarkResult> baseline;
+
+    if (reader.next() != JsonToken::BeginObject) {
+        throw std::invalid_argument("The baseline has to be a JSON object");
+    }
+
+    for (JsonToken token = reader.next(); token == JsonToken::Key; token = reader.next()) {
+        if (reader.text() != "benchmarks") {
+            reader.skip(reader.next());
+            continue;
+        }
+
+        if (reader.next() != JsonToken::BeginArray) {
+            throw std::invalid_argument("The benchmarks of the baseline have to be an array");
+        }
+
+        for (JsonToken element = reader.next(); element != JsonToken::EndArray; element = reader.next()) {
+            if (element != JsonToken::BeginObject) {
+                throw std::invalid_argument("Each benchmark of the baseline has to be an object");
+            }
+
+            BenchmarkResult result { .m_name = "", .m_ns_per_operation = -1 };
+            for (JsonToken field = reader.next(); field == JsonToken::Key; field = reader.next()) {
+                const std::string key = reader.text();
+                const JsonToken value = reader.next();
+                if (key == "name" && value == JsonToken::String) {
+                    result.m_name = reader.text();
+                } else if (key == "ns_per_operation" && value == JsonToken::Number) {
+                    result.m_ns_per_operation = reader.number();
+                } else {
+                    reader.skip(value);
+                }
+            }
+
+            if (result.m_name.empty() || result.m_ns_per_operation < 0) {
+                throw std::invalid_argument("Each benchmark of the baseline has to have a name and a ns_per_operation");
+            }
+            baseline.push_back(result);
+        }
+    }
+
+    return baseline;
+}
+
+bool BenchmarkRunner::compare(
+    std::vector<BenchmarkResult> const& results,
+    std::vector<BenchmarkResult> const& baseline,
+    double threshold,
+    std::ostream& stream)
+{
+    std::unordered_map<std::string, double> baseline_by_name;
+    for (BenchmarkResult const& result : baseline) {
+        baseline_by_name[result.m_name] = result.m_ns_per_operation;
+    }
+
+    std::size_t regressions = 0;
+    stream << fmt::format("\n{:<{}}{:>17}{:>17}{:>10}\n", "Benchmark", s_name_width, "Baseline", "Result", "Change");
+
+    for (BenchmarkResult const& result : results) {
+        const auto baseline_result = baseline_by_name.find(result.m_name);
+        if (baseline_result == baseline_by_name.end()) {
+            stream << fmt::format("{:<{}}{:>17}{:>14.2f} ns{:>10}\n", result.m_name, s_name_width, "", result.m_ns_per_operation, "new");
+            continue;
+        }
+
+        const double old_ns = baseline_result->second;
+        const double change = old_ns > 0 ? (result.m_ns_per_operation - old_ns) / old_ns * 100 : 0;
+        const bool is_regression = change > threshold;
+        if (is_regression) {
+            ++regressions;
+        }
+
+        stream << fmt::format(
+            "{:<{}}{:>14.2f} ns{:>14.2f} ns{:>+9.1f}%{}\n",
+            result.m_name,
+            s_name_width,
+            old_ns,
+            result.m_ns_per_operation,
+            change,
+            is_regression ? "  REGRESSED" : "");
+    }
+
+    if (regressions == 0) {
+        stream << fmt::format("\nNo benchmark is more than {}% slower than the baseline\n", threshold);
+    } else {
+        stream << fmt::format("\n{} benchmark(s) are more than {}% slower than the baseline\n", regressions, threshold);
+    }
+
+    return regressions == 0;
+}
+
+bool BenchmarkRunner::matches(std::string const& name, std::string const& pattern)
+{
+    std::size_t n = 0;
+    std::size_t p = 0;
+    std::size_t star = std::string::npos; // Where in the pattern the last * was
+    std::size_t star_n = 0;               // Where in the name the last * started matching
+
+    while (n < name.size()) {
+        if (p < pattern.size() && pattern[p] == '*') {
+            star = p++;
+            star_n = n;
+        } else if (p < pattern.size() && pattern[p] == name[n]) {
+            ++p;
+            ++n;
+        } else if (star != std::string::npos) {
+            p = star + 1;
+            n = ++star_n;
+        } else {
+            return false;
+        }
+    }
+
+    while (p < pattern.size() && pattern[p] == '*') {
+        ++p;
+    }
+
+    return p == pattern.size();
+}
+
+bool BenchmarkRunner::is_selected(std::string const& name) const
+{
+    if (m_filters.empty()) {
+        return true;
+    }
+
+    for (std::string const& filter : m_filters) {
+        if (matches(name, filter)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+TEST_CASE("crosscutting: BenchmarkRunner")
+{
+    SUBCASE("should match names with wildcards")
+    {
+        CHECK(BenchmarkRunner::matches("Z80: next_instruction", "Z80*"));
+        CHECK(BenchmarkRunner::matches("Z80: next_instruction", "*next*"));
+        CHECK(BenchmarkRunner::matches("Z80: next_instruction", "Z80: next_instruction"));
+        CHECK(BenchmarkRunner::matches("", "*"));
+        CHECK_FALSE(BenchmarkRunner::matches("Z80: next_instruction", "8080*"));
+        CHECK_FALSE(BenchmarkRunner::matches("Z80: next_instruction", "Z80"));
+    }
+
+    SUBCASE("should read the baseline it has written")
+    {
+        const std::vector<BenchmarkResult> results = {
+            { .m_name = "crosscutting: \"quoted\"", .m_ns_per_operation = 1.25 },
+            { .m_name = "Z80: next_instruction", .m_ns_per_operation = 30 },
+        };
+
+        std::stringstream stream;
+        BenchmarkRunner::write_baseline(stream, results);
+        const std::vector<BenchmarkResult> baseline = BenchmarkRunner::read_baseline(stream);
+
+        REQUIRE_EQ(2, baseline.size());
+        CHECK_EQ("crosscutting: \"quoted\"", baseline[0].m_name);
+        CHECK_EQ(1.25, baseline[0].m_ns_per_operation);
+        CHECK_EQ("Z80: next_instruction", baseline[1].m_name);
+        CHECK_EQ(30.0, baseline[1].m_ns_per_operation);
+    }
+
+    SUBCASE("should skip keys it doesn't know about")
+    {
+        std::istringstream stream(R"({ "machine": { "cores": 8 }, "benchmarks": [ { "name": "a", "runs": [1, 2], "ns_per_operation": 2 } ] })");
+
+        const std::vector<BenchmarkResult> baseline = BenchmarkRunner::read_baseline(stream);
+
+        REQUIRE_EQ(1, baseline.size());
+        CHECK_EQ("a", baseline[0].m_name);
+        CHECK_EQ(2.0, baseline[0].m_ns_per_operation);
+    }
+
+    SUBCASE("should throw when a benchmark has no time")
+    {
+        std::istringstream stream(R"({ "benchmarks": [ { "name": "a" } ] })");
+
+        CHECK_THROWS_AS(BenchmarkRunner::read_baseline(stream), std::invalid_argument);
+    }
+
+    SUBCASE("should only find regressions above the threshold")
+    {
+        const std::vector<BenchmarkResult> baseline = {
+            { .m_name = "a", .m_ns_per_operation = 100 },
+            { .m_name = "b", .m_ns_per_operation = 100 },
+        };
+        std::ostringstream stream;
+
+        CHECK(BenchmarkRunner::compare({ { .m_name = "a", .m_ns_per_operation = 109 } }, baseline, 10, stream));
+        CHECK(BenchmarkRunner::compare({ { .m_name = "b", .m_ns_per_operation = 50 } }, baseline, 10, stream));
+        CHECK(BenchmarkRunner::compare({ { .m_name = "c", .m_ns_per_operation = 500 } }, baseline, 10, stream));
+        CHECK_FALSE(BenchmarkRunner::compare({ { .m_name = "a", .m_ns_per_operation = 111 } }, baseline, 10, stream));
+    }
+}
+}
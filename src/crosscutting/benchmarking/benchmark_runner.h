@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace emu::benchmarking {
+
+struct BenchmarkResult {
+    std::string m_name;
+    double m_ns_per_operation;
+};
+
+/**
+ * Runs the registered benchmarks, and stores and compares their results. The results are stored as
+ * JSON baselines, so that a later run can be compared with them to find out if anything has become
+ * slower.
+ *
+ * The baseline in benchmarks/baseline.json belongs to the latest commit, and is stored again by the
+ * commits that change how fast the emulators run.
+ */
+class BenchmarkRunner {
+public:
+    /**
+     * @param filters is the names of the benchmarks to run, where * matches anything, or empty to
+     *                run every benchmark
+     */
+    explicit BenchmarkRunner(std::vector<std::string> filters);
+
+    /**
+     * Runs the benchmarks one at a time, and prints the result of each as soon as it's done.
+     *
+     * @return the results, in the order the benchmarks were registered
+     */
+    std::vector<BenchmarkResult> run() const;
+
+    static void save(std::string const& path, std::vector<BenchmarkResult> const& results);
+
+    static std::vector<BenchmarkResult> load(std::string const& path);
+
+    static void write_baseline(std::ostream& stream, std::vector<BenchmarkResult> const& results);
+
+    static std::vector<BenchmarkResult> read_baseline(std::istream& stream);
+
+    /**
+     * Prints how much each result has changed since the baseline. Benchmarks that aren't in the
+     * baseline are shown as new, and are never regressions.
+     *
+     * @param results is the results of this run
+     * @param baseline is the results to compare with
+     * @param threshold is how many percent slower than the baseline a benchmark can get before
+     *                  it's a regression
+     * @param stream is where to print the comparison
+     * @return true if none of the benchmarks regressed
+     */
+    static bool compare(
+        std::vector<BenchmarkResult> const& results,
+        std::vector<BenchmarkResult> const& baseline,
+        double threshold,
+        std::ostream& stream);
+
+    static bool matches(std::string const& name, std::string const& pattern);
+
+private:
+    static constexpr std::size_t s_name_width = 56;
+
+    std::vector<std::string> m_filters;
+
+    [[nodiscard]] bool is_selected(std::string const& name) const;
+};
+}
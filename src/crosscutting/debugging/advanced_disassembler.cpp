@@ -1,18 +1,368 @@
 #include "advanced_disassembler.h"
-
+#include "doctest.h"
+#include <algorithm>
+#include <cstddef>
 #include <utility>
 
 namespace emu::debugger {
 
-AdvancedDisassembler::AdvancedDisassembler(std::vector<DisassembledLine> lines)
+AdvancedDisassembler::AdvancedDisassembler(
+    u16 first_address,
+    u16 last_address,
+    std::function<DecodedInstruction<u16, u8>(u16)> decoder,
+    std::vector<u16> const& entry_points)
+    : m_first_address(first_address)
+    , m_last_address(last_address)
+    , m_decoder(std::move(decoder))
+    , m_blocks_covering(static_cast<std::size_t>(last_address - first_address) + 1, 0)
+    , m_instructions_starting(static_cast<std::size_t>(last_address - first_address) + 1, 0)
+{
+    for (u16 entry_point : entry_points) {
+        add_entry_point(entry_point);
+    }
+}
+
+void AdvancedDisassembler::add_entry_point(u16 address)
+{
+    if (is_in_range(address) && m_instructions_starting[index(address)] == 0) {
+        m_pending.push_back(address);
+    }
+}
+
+void AdvancedDisassembler::attach_dirty_ranges(std::shared_ptr<DirtyRanges> dirty_ranges)
+{
+    m_dirty_ranges = std::move(dirty_ranges);
+}
+
+void AdvancedDisassembler::invalidate(std::size_t first, std::size_t last)
+{
+    first = std::max(first, static_cast<std::size_t>(m_first_address));
+    last = std::min(last, static_cast<std::size_t>(m_last_address));
+    if (first > last) {
+        return;
+    }
+
+    const auto covering_begin = m_blocks_covering.begin() + static_cast<std::ptrdiff_t>(index(static_cast<u16>(first)));
+    const auto covering_end = m_blocks_covering.begin() + static_cast<std::ptrdiff_t>(index(static_cast<u16>(last))) + 1;
+    if (std::all_of(covering_begin, covering_end, [](u8 count) { return count == 0; })) { // Only data has changed
+        return;
+    }
+
+    for (auto block = m_blocks.begin(); block != m_blocks.end() && block->first <= last;) {
+        if (block->second.end_address() > first) {
+            m_pending.push_back(block->first);
+            block = remove_block(block);
+        } else {
+            ++block;
+        }
+    }
+}
+
+void AdvancedDisassembler::analyze()
+{
+    invalidate_dirty_ranges();
+
+    while (!m_pending.empty()) {
+        const u16 address = m_pending.back();
+        m_pending.pop_back();
+        analyze_block(address);
+    }
+}
+
+std::vector<u16> const& AdvancedDisassembler::addresses()
+{
+    analyze();
+
+    if (m_is_listing_outdated) {
+        build_listing();
+        m_is_listing_outdated = false;
+    }
+
+    return m_addresses;
+}
+
+bool AdvancedDisassembler::is_code(u16 address) const
+{
+    return is_in_range(address) && m_blocks_covering[index(address)] > 0;
+}
+
+std::map<u16, BasicBlock> const& AdvancedDisassembler::blocks() const
+{
+    return m_blocks;
+}
+
+void AdvancedDisassembler::invalidate_dirty_ranges()
+{
+    if (!m_dirty_ranges || m_dirty_ranges->is_empty()) {
+        return;
+    }
+
+    m_dirty_ranges->take(m_changed_ranges);
+    for (auto const& range : m_changed_ranges) {
+        invalidate(range.m_first, range.m_last);
+    }
+}
+
+void AdvancedDisassembler::build_listing()
 {
-    parse_disassembled_lines(std::move(lines));
+    m_addresses.clear();
+
+    std::size_t next = m_first_address;
+    for (auto const& [first_address, block] : m_blocks) {
+        if (first_address < next) { // Overlaps the previous block
+            continue;
+        }
+
+        for (; next < first_address; ++next) {
+            m_addresses.push_back(static_cast<u16>(next));
+        }
+        for (auto const& instruction : block.instructions()) {
+            m_addresses.push_back(instruction.m_address);
+        }
+        next = block.end_address();
+    }
+
+    for (; next <= m_last_address; ++next) {
+        m_addresses.push_back(static_cast<u16>(next));
+    }
 }
-void AdvancedDisassembler::parse_disassembled_lines(std::vector<DisassembledLine> lines)
+
+void AdvancedDisassembler::analyze_block(u16 address)
 {
-    // Find all entry points
-    //  After entry point, one exit point
+    if (!is_in_range(address) || m_blocks.contains(address)) {
+        return;
+    }
+
+    auto containing = block_containing(address);
+    if (containing != m_blocks.end() && containing->second.has_instruction_at(address)) {
+        m_blocks.emplace(address, containing->second.split(address));
+        m_is_listing_outdated = true;
+        return;
+    }
+
+    BasicBlock block(address);
+
+    for (std::size_t current = address; is_in_range(current);) {
+        if (current != address && m_blocks_covering[index(static_cast<u16>(current))] > 0) { // Runs into known code
+            block.add_successor(static_cast<u16>(current));
+            m_pending.push_back(static_cast<u16>(current));
+            break;
+        }
+
+        const DecodedInstruction<u16, u8> instruction = m_decoder(static_cast<u16>(current));
+        const std::size_t next = current + instruction.m_length;
+        if (!is_in_range(next - 1)) {
+            break;
+        }
+
+        block.add_instruction(instruction);
+
+        bool is_end_of_block = true;
+        switch (instruction.m_control_flow) {
+        case ControlFlow::Sequential:
+            is_end_of_block = false;
+            break;
+        case ControlFlow::Call:
+            m_pending.push_back(instruction.m_target);
+            is_end_of_block = false;
+            break;
+        case ControlFlow::Jump:
+            block.add_successor(instruction.m_target);
+            break;
+        case ControlFlow::ConditionalJump:
+            block.add_successor(instruction.m_target);
+            block.add_successor(static_cast<u16>(next));
+            break;
+        case ControlFlow::ConditionalReturn:
+            block.add_successor(static_cast<u16>(next));
+            break;
+        case ControlFlow::Return:
+        case ControlFlow::IndirectJump:
+            break;
+        }
+
+        if (is_end_of_block) {
+            m_pending.insert(m_pending.end(), block.successors().begin(), block.successors().end());
+            break;
+        }
+
+        current = next;
+    }
+
+    if (!block.is_empty()) {
+        insert_block(std::move(block));
+    }
+}
+
+void AdvancedDisassembler::insert_block(BasicBlock block)
+{
+    for (auto const& instruction : block.instructions()) {
+        ++m_instructions_starting[index(instruction.m_address)];
+        for (std::size_t i = 0; i < instruction.m_length; ++i) {
+            ++m_blocks_covering[index(static_cast<u16>(instruction.m_address + i))];
+        }
+    }
+
+    m_blocks.emplace(block.first_address(), std::move(block));
+    m_is_listing_outdated = true;
+}
+
+std::map<u16, BasicBlock>::iterator AdvancedDisassembler::remove_block(std::map<u16, BasicBlock>::iterator block)
+{
+    for (auto const& instruction : block->second.instructions()) {
+        --m_instructions_starting[index(instruction.m_address)];
+        for (std::size_t i = 0; i < instruction.m_length; ++i) {
+            --m_blocks_covering[index(static_cast<u16>(instruction.m_address + i))];
+        }
+    }
+
+    m_is_listing_outdated = true;
+
+    return m_blocks.erase(block);
+}
+
+std::map<u16, BasicBlock>::iterator AdvancedDisassembler::block_containing(u16 address)
+{
+    auto block = m_blocks.upper_bound(address);
+    if (block == m_blocks.begin()) {
+        return m_blocks.end();
+    }
+
+    --block;
+
+    return block->second.contains(address) ? block : m_blocks.end();
+}
+
+bool AdvancedDisassembler::is_in_range(std::size_t address) const
+{
+    return m_first_address <= address && address <= m_last_address;
+}
+
+std::size_t AdvancedDisassembler::index(u16 address) const
+{
+    return static_cast<std::size_t>(address - m_first_address);
+}
+
+/*
+ * A made up instruction set for the tests:
+ * 0x00: NOP, 0x01 nn: JP nn, 0x02 nn: JP Z,nn, 0x03: RET, 0x04 nn: CALL nn and 0x05 nn: JP (nn)
+ */
+static DecodedInstruction<u16, u8> decode_for_test(std::vector<u8> const& memory, u16 address)
+{
+    const u8 opcode = memory[address];
+    DecodedInstruction<u16, u8> instruction { .m_address = address, .m_length = opcode == 0x00 || opcode == 0x03 ? 1u : 3u, .m_bytes = {} };
+
+    for (std::size_t i = 0; i < instruction.m_length && address + i < memory.size(); ++i) {
+        instruction.m_bytes[i] = memory[address + i];
+    }
+
+    const u16 target = static_cast<u16>(instruction.m_bytes[1] | (instruction.m_bytes[2] << 8));
+    switch (opcode) {
+    case 0x01:
+        instruction.m_control_flow = ControlFlow::Jump;
+        instruction.m_target = target;
+        break;
+    case 0x02:
+        instruction.m_control_flow = ControlFlow::ConditionalJump;
+        instruction.m_target = target;
+        break;
+    case 0x03:
+        instruction.m_control_flow = ControlFlow::Return;
+        break;
+    case 0x04:
+        instruction.m_control_flow = ControlFlow::Call;
+        instruction.m_target = target;
+        break;
+    case 0x05:
+        instruction.m_control_flow = ControlFlow::IndirectJump;
+        break;
+    default:
+        break;
+    }
+
+    return instruction;
+}
+
+TEST_CASE("crosscutting: AdvancedDisassembler")
+{
+    std::vector<u8> memory = {
+        0x00,             // 0000: NOP
+        0x04, 0x0b, 0x00, // 0001: CALL 000b
+        0x02, 0x0a, 0x00, // 0004: JP Z,000a
+        0x01, 0x00, 0x00, // 0007: JP 0000
+        0x03,             // 000a: RET
+        0x00,             // 000b: NOP
+        0x03,             // 000c: RET
+        0x01, 0x01, 0x00  // 000d: JP 0001, which isn't reachable
+    };
+
+    std::size_t number_of_decodes = 0;
+    AdvancedDisassembler disassembler(
+        0x0000,
+        static_cast<u16>(memory.size() - 1),
+        [&](u16 address) {
+            ++number_of_decodes;
+            return decode_for_test(memory, address);
+        },
+        { 0x0000 });
+    auto dirty_ranges = std::make_shared<DirtyRanges>(memory.size());
+    disassembler.attach_dirty_ranges(dirty_ranges);
+
+    std::vector<u16> addresses = disassembler.addresses();
+
+    SUBCASE("should only disassemble what is reachable from the entry points")
+    {
+        CHECK_EQ(std::vector<u16> { 0x0000, 0x0001, 0x0004, 0x0007, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f }, addresses);
+        CHECK(disassembler.is_code(0x000c));
+        CHECK_FALSE(disassembler.is_code(0x000d));
+    }
+
+    SUBCASE("should end the blocks at jumps and returns, and not at calls")
+    {
+        auto const& blocks = disassembler.blocks();
+
+        REQUIRE_EQ(4, blocks.size());
+        CHECK_EQ(3, blocks.at(0x0000).instructions().size());
+        CHECK_EQ(std::vector<u16> { 0x000a, 0x0007 }, blocks.at(0x0000).successors());
+        CHECK_EQ(1, blocks.at(0x0007).instructions().size());
+        CHECK_EQ(std::vector<u16> { 0x0000 }, blocks.at(0x0007).successors());
+        CHECK_EQ(1, blocks.at(0x000a).instructions().size());
+        CHECK(blocks.at(0x000a).successors().empty());
+        CHECK_EQ(2, blocks.at(0x000b).instructions().size());
+    }
+
+    SUBCASE("should find new code when an entry point is added, and split the blocks it jumps into")
+    {
+        disassembler.add_entry_point(0x000d);
+        addresses = disassembler.addresses();
+
+        auto const& blocks = disassembler.blocks();
+
+        REQUIRE_EQ(6, blocks.size());
+        CHECK(disassembler.is_code(0x000f));
+        CHECK_EQ(1, blocks.at(0x0000).instructions().size());
+        CHECK_EQ(std::vector<u16> { 0x0001 }, blocks.at(0x0000).successors());
+        CHECK_EQ(2, blocks.at(0x0001).instructions().size());
+        CHECK_EQ(std::vector<u16> { 0x000a, 0x0007 }, blocks.at(0x0001).successors());
+    }
+
+    SUBCASE("should only analyze the changed blocks again when the memory changes")
+    {
+        memory[0x000e] = 0x03; // Data, so nothing has to be analyzed again
+        dirty_ranges->mark(0x000e);
+        number_of_decodes = 0;
+        addresses = disassembler.addresses();
+
+        CHECK_EQ(0, number_of_decodes);
+
+        memory[0x000c] = 0x05; // RET -> JP (nn), which makes 000d to 000e code
+        dirty_ranges->mark(0x000c);
+        number_of_decodes = 0;
+        addresses = disassembler.addresses();
 
-    m_control_flow_graph_head = BasicBlock(std::move(lines));
+        CHECK_EQ(2, number_of_decodes); // The changed block has two instructions
+        CHECK_EQ(std::vector<u16> { 0x0000, 0x0001, 0x0004, 0x0007, 0x000a, 0x000b, 0x000c, 0x000f }, addresses);
+        CHECK(disassembler.is_code(0x000e));
+    }
 }
 }
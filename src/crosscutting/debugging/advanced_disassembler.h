@@ -1,16 +1,108 @@
 #pragma once
 
 #include "basic_block.h"
+#include "crosscutting/memory/dirty_ranges.h"
+#include "crosscutting/typedefs.h"
+#include "decoded_instruction.h"
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
 
 namespace emu::debugger {
 
+using emu::memory::DirtyRanges;
+
+/**
+ * Disassembles by following the control flow from the entry points, instead of decoding the whole
+ * address range as if everything was code. The result is a control flow graph of basic blocks,
+ * and the bytes that are not reached from any entry point are listed as data.
+ *
+ * The analysis is incremental. Entry points can be added at any time, for example when the PC is
+ * seen somewhere new, and when code is overwritten, only the blocks that contain the changed bytes
+ * are thrown away and analyzed again. The changed bytes are found from the dirty ranges the memory
+ * marks its writes in, so nothing is decoded again when only data has been written to.
+ */
 class AdvancedDisassembler {
 public:
-    explicit AdvancedDisassembler(std::vector<DisassembledLine> lines);
+    /**
+     * @param first_address is the first address to disassemble
+     * @param last_address is the last address to disassemble
+     * @param decoder decodes the instruction at an address
+     * @param entry_points are the addresses the execution is known to start at, like the reset and interrupt vectors
+     */
+    AdvancedDisassembler(
+        u16 first_address,
+        u16 last_address,
+        std::function<DecodedInstruction<u16, u8>(u16)> decoder,
+        std::vector<u16> const& entry_points);
+
+    void add_entry_point(u16 address);
+
+    /**
+     * @param dirty_ranges is where the memory marks what has been written to, which is taken and
+     *                     invalidated before every analysis
+     */
+    void attach_dirty_ranges(std::shared_ptr<DirtyRanges> dirty_ranges);
+
+    /**
+     * Throws away the blocks that contain any of the addresses, so they are analyzed again. To be
+     * called when the memory at the addresses has changed.
+     *
+     * @param first is the first address that has changed
+     * @param last is the last address that has changed
+     */
+    void invalidate(std::size_t first, std::size_t last);
+
+    /**
+     * Analyzes the entry points that have been added and the blocks that have been invalidated
+     * since the last analysis.
+     */
+    void analyze();
+
+    /**
+     * Brings the analysis up to date and finds the address of every line in the listing. Code is
+     * listed one instruction per line and data one byte per line. The listing is only built again
+     * when the blocks have changed.
+     *
+     * @return the addresses of the lines, in order
+     */
+    [[nodiscard]] std::vector<u16> const& addresses();
+
+    [[nodiscard]] bool is_code(u16 address) const;
+
+    [[nodiscard]] std::map<u16, BasicBlock> const& blocks() const;
 
 private:
-    BasicBlock m_control_flow_graph_head;
+    u16 m_first_address;
+    u16 m_last_address;
+    std::function<DecodedInstruction<u16, u8>(u16)> m_decoder;
+
+    std::map<u16, BasicBlock> m_blocks;
+    std::vector<u16> m_pending;
+    std::vector<u8> m_blocks_covering;        // Number of blocks covering each address
+    std::vector<u8> m_instructions_starting; // Number of instructions starting at each address
+
+    std::shared_ptr<DirtyRanges> m_dirty_ranges;
+    std::vector<DirtyRanges::Range> m_changed_ranges;
+
+    std::vector<u16> m_addresses;
+    bool m_is_listing_outdated { true };
+
+    void invalidate_dirty_ranges();
+
+    void build_listing();
+
+    void analyze_block(u16 address);
+
+    void insert_block(BasicBlock block);
+
+    std::map<u16, BasicBlock>::iterator remove_block(std::map<u16, BasicBlock>::iterator block);
+
+    std::map<u16, BasicBlock>::iterator block_containing(u16 address);
+
+    [[nodiscard]] bool is_in_range(std::size_t address) const;
 
-    void parse_disassembled_lines(std::vector<DisassembledLine> lines);
+    [[nodiscard]] std::size_t index(u16 address) const;
 };
 }
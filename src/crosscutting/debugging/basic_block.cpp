@@ -1,12 +1,82 @@
 #include "basic_block.h"
+#include <algorithm>
 #include <utility>
 
 namespace emu::debugger {
 
-BasicBlock::BasicBlock() = default;
+BasicBlock::BasicBlock()
+    : BasicBlock(0)
+{
+}
+
+BasicBlock::BasicBlock(u16 first_address)
+    : m_first_address(first_address)
+    , m_end_address(first_address)
+{
+}
+
+void BasicBlock::add_instruction(DecodedInstruction<u16, u8> const& instruction)
+{
+    m_instructions.push_back(instruction);
+    m_end_address = instruction.m_address + instruction.m_length;
+}
+
+void BasicBlock::add_successor(u16 address)
+{
+    m_successors.push_back(address);
+}
+
+BasicBlock BasicBlock::split(u16 address)
+{
+    auto const first_in_new_block = std::find_if(m_instructions.begin(), m_instructions.end(),
+        [&](DecodedInstruction<u16, u8> const& instruction) { return instruction.m_address == address; });
+
+    BasicBlock new_block(address);
+    std::for_each(first_in_new_block, m_instructions.end(),
+        [&](DecodedInstruction<u16, u8> const& instruction) { new_block.add_instruction(instruction); });
+    new_block.m_successors = std::move(m_successors);
+
+    m_instructions.erase(first_in_new_block, m_instructions.end());
+    m_end_address = address;
+    m_successors = { address };
+
+    return new_block;
+}
+
+u16 BasicBlock::first_address() const
+{
+    return m_first_address;
+}
+
+std::size_t BasicBlock::end_address() const
+{
+    return m_end_address;
+}
+
+bool BasicBlock::contains(u16 address) const
+{
+    return m_first_address <= address && address < m_end_address;
+}
+
+bool BasicBlock::has_instruction_at(u16 address) const
+{
+    return contains(address)
+        && std::any_of(m_instructions.begin(), m_instructions.end(),
+            [&](DecodedInstruction<u16, u8> const& instruction) { return instruction.m_address == address; });
+}
+
+bool BasicBlock::is_empty() const
+{
+    return m_instructions.empty();
+}
+
+std::vector<DecodedInstruction<u16, u8>> const& BasicBlock::instructions() const
+{
+    return m_instructions;
+}
 
-BasicBlock::BasicBlock(std::vector<DisassembledLine> lines)
-    : m_lines(std::move(lines))
+std::vector<u16> const& BasicBlock::successors() const
 {
+    return m_successors;
 }
 }
@@ -1,17 +1,57 @@
 #pragma once
 
-#include "disassembled_line.h"
+#include "crosscutting/typedefs.h"
+#include "decoded_instruction.h"
+#include <cstddef>
 #include <vector>
 
 namespace emu::debugger {
 
+/**
+ * A run of instructions that is only entered at the first instruction and only left after the last.
+ * The successors are the addresses the execution can continue at when the block is left.
+ */
 class BasicBlock {
 public:
     BasicBlock();
 
-    explicit BasicBlock(std::vector<DisassembledLine> lines);
+    explicit BasicBlock(u16 first_address);
+
+    void add_instruction(DecodedInstruction<u16, u8> const& instruction);
+
+    void add_successor(u16 address);
+
+    /**
+     * Splits the block in two at an instruction boundary. This block keeps the instructions before
+     * the address, and continues at the address. The new block gets the rest and the successors.
+     *
+     * @param address is the address of the first instruction in the new block
+     * @return the new block
+     */
+    BasicBlock split(u16 address);
+
+    [[nodiscard]] u16 first_address() const;
+
+    /**
+     * @return the address after the last byte in the block, which is past the address space if the
+     *         block ends at the last address
+     */
+    [[nodiscard]] std::size_t end_address() const;
+
+    [[nodiscard]] bool contains(u16 address) const;
+
+    [[nodiscard]] bool has_instruction_at(u16 address) const;
+
+    [[nodiscard]] bool is_empty() const;
+
+    [[nodiscard]] std::vector<DecodedInstruction<u16, u8>> const& instructions() const;
+
+    [[nodiscard]] std::vector<u16> const& successors() const;
 
 private:
-    std::vector<DisassembledLine> m_lines;
+    u16 m_first_address;
+    std::size_t m_end_address;
+    std::vector<DecodedInstruction<u16, u8>> m_instructions;
+    std::vector<u16> m_successors;
 };
 }
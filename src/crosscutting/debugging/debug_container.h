@@ -1,11 +1,15 @@
 #pragma once
 
 #include "crosscutting/audio/waveform.h"
+#include "crosscutting/memory/emulator_memory.h"
 #include "crosscutting/typedefs.h"
+#include "decoded_instruction.h"
 #include "disassembled_line.h"
+#include <cstddef>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <span>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -22,6 +26,7 @@ namespace emu::debugger {
 
 using emu::gui::Sprite;
 using emu::gui::Tile;
+using emu::memory::EmulatorMemory;
 using emu::wsg3::Waveform;
 
 template<class D>
@@ -47,7 +52,7 @@ public:
     {
     }
 
-    [[nodiscard]] std::string name() const
+    [[nodiscard]] std::string const& name() const
     {
         return m_name;
     }
@@ -89,7 +94,7 @@ public:
     {
     }
 
-    [[nodiscard]] std::string name() const
+    [[nodiscard]] std::string const& name() const
     {
         return m_name;
     }
@@ -99,7 +104,7 @@ public:
         return m_value_retriever();
     }
 
-    [[nodiscard]] std::vector<std::tuple<std::string, unsigned int>> flag_names() const
+    [[nodiscard]] std::vector<std::tuple<std::string, unsigned int>> const& flag_names() const
     {
         return m_flag_names;
     }
@@ -137,7 +142,7 @@ public:
     {
     }
 
-    [[nodiscard]] std::string name() const
+    [[nodiscard]] std::string const& name() const
     {
         return m_name;
     }
@@ -157,7 +162,7 @@ public:
         return m_is_divided_into_bits;
     }
 
-    [[nodiscard]] std::vector<std::tuple<std::string, unsigned int>> bit_names() const
+    [[nodiscard]] std::vector<std::tuple<std::string, unsigned int>> const& bit_names() const
     {
         return m_bit_names;
     }
@@ -170,27 +175,132 @@ private:
     bool m_is_divided_into_bits;
 };
 
+/**
+ * The memory as the CPU sees it. The retriever returns a view of the memory instead of a copy, and
+ * the view has to stay valid until the retriever is called again. The memory can only be edited
+ * from the memory editor when a writer is given, which writes to the memory the way the CPU does.
+ *
+ * @tparam D is the data type
+ */
 template<class D>
 class MemoryDebugContainer {
 public:
     MemoryDebugContainer() = default;
 
-    explicit MemoryDebugContainer(std::function<std::vector<D>()> value_retriever)
+    explicit MemoryDebugContainer(std::function<std::span<D const>()> value_retriever)
     {
         m_value_retriever = std::move(value_retriever);
     }
 
-    [[nodiscard]] std::vector<D> value() const
+    MemoryDebugContainer(
+        std::function<std::span<D const>()> value_retriever,
+        std::function<void(std::size_t, D)> writer)
+        : m_value_retriever(std::move(value_retriever))
+        , m_writer(std::move(writer))
+        , m_is_writable(true)
+    {
+    }
+
+    [[nodiscard]] std::span<D const> value() const
     {
         return m_value_retriever();
     }
 
+    void write(std::size_t address, D value) const
+    {
+        m_writer(address, value);
+    }
+
+    [[nodiscard]] bool is_writable() const
+    {
+        return m_is_writable;
+    }
+
+private:
+    std::function<std::span<D const>()> m_value_retriever;
+    std::function<void(std::size_t, D)> m_writer;
+    bool m_is_writable { false };
+};
+
+/**
+ * Disassembles the program one instruction at a time. The addresses of the lines are retrieved when
+ * the snapshot is taken, and the lines are decoded and formatted from the memory in the snapshot.
+ * Nothing is formatted until it is asked for, and a line is formatted into a buffer the caller
+ * keeps, so the disassembly pane only has to format the visible lines, without allocating.
+ *
+ * @tparam A is the address type
+ * @tparam D is the data type
+ */
+template<class A, class D>
+class DisassemblyDebugContainer {
+public:
+    DisassemblyDebugContainer() = default;
+
+    DisassemblyDebugContainer(
+        std::function<std::vector<A> const&()> addresses_retriever,
+        std::function<DecodedInstruction<A, D>(EmulatorMemory<A, D> const&, A)> decoder,
+        std::function<void(EmulatorMemory<A, D> const&, A, std::string&)> formatter)
+        : m_addresses_retriever(std::move(addresses_retriever))
+        , m_decoder(std::move(decoder))
+        , m_formatter(std::move(formatter))
+    {
+    }
+
+    /**
+     * @return the address of every line in the listing, in order
+     */
+    [[nodiscard]] std::vector<A> const& addresses() const
+    {
+        return m_addresses_retriever();
+    }
+
+    [[nodiscard]] DecodedInstruction<A, D> decode(EmulatorMemory<A, D> const& memory, A address) const
+    {
+        return m_decoder(memory, address);
+    }
+
+    /**
+     * Formats the line at the address, replacing what was in the line before.
+     */
+    void line(EmulatorMemory<A, D> const& memory, A address, std::string& line) const
+    {
+        m_formatter(memory, address, line);
+    }
+
 private:
-    std::function<std::vector<D>()> m_value_retriever;
+    std::function<std::vector<A> const&()> m_addresses_retriever;
+    std::function<DecodedInstruction<A, D>(EmulatorMemory<A, D> const&, A)> m_decoder;
+    std::function<void(EmulatorMemory<A, D> const&, A, std::string&)> m_formatter;
 };
 
 /**
- * Contains the data that is used in the debugging panes.
+ * The values the debugging panes show, taken from the machine once per frame after the CPU has run.
+ * The registers and the IO are in the order they were added to the debug container, and the
+ * vectors keep their capacity between snapshots, so taking a snapshot doesn't allocate. The memory
+ * is a copy, so the disassembly is formatted from the memory as it was when the snapshot was taken.
+ *
+ * @tparam A is the address type
+ * @tparam D is the data type
+ */
+template<class A, class D>
+struct DebugSnapshot {
+    std::vector<D> m_registers_main;
+    std::vector<D> m_registers_alternate; // Only for the registers that have an alternate
+    D m_flag_register { 0 };
+    std::vector<bool> m_is_io_active;
+    std::vector<D> m_io;
+    EmulatorMemory<A, D> m_memory;
+    std::vector<A> m_disassembly_addresses;
+    A m_pc { 0 };
+    A m_sp { 0 };
+    bool m_is_interrupted { false };
+    std::string m_interrupt_mode;
+};
+
+/**
+ * Contains the data that is used in the debugging panes. The registers, flags, IO, memory,
+ * disassembly, PC, SP and interrupts are read by the panes from the snapshot, which the session
+ * takes once per frame, instead of being retrieved again by every pane that draws them.
  *
  * @tparam A is the address type
  * @tparam D is the data type
@@ -214,7 +324,7 @@ public:
         }
     }
 
-    std::vector<RegisterDebugContainer<D>> registers()
+    [[nodiscard]] std::vector<RegisterDebugContainer<D>> const& registers() const
     {
         return m_register_retrievers;
     }
@@ -230,7 +340,7 @@ public:
         m_is_flag_register_set = true;
     }
 
-    [[nodiscard]] FlagRegisterDebugContainer<D> flag_register() const
+    [[nodiscard]] FlagRegisterDebugContainer<D> const& flag_register() const
     {
         return m_flag_register_retriever;
     }
@@ -246,7 +356,7 @@ public:
         m_is_io_set = true;
     }
 
-    [[nodiscard]] std::vector<IoDebugContainer<D>> io() const
+    [[nodiscard]] std::vector<IoDebugContainer<D>> const& io() const
     {
         return m_io_retrievers;
     }
@@ -262,7 +372,7 @@ public:
         m_is_memory_set = true;
     }
 
-    [[nodiscard]] MemoryDebugContainer<D> memory() const
+    [[nodiscard]] MemoryDebugContainer<D> const& memory() const
     {
         return m_memory_retriever;
     }
@@ -352,6 +462,22 @@ public:
         return m_is_disassembled_program_set;
     }
 
+    void add_disassembly(DisassemblyDebugContainer<A, D> const& disassembly)
+    {
+        m_disassembly = disassembly;
+        m_is_disassembly_set = true;
+    }
+
+    [[nodiscard]] DisassemblyDebugContainer<A, D> const& disassembly() const
+    {
+        return m_disassembly;
+    }
+
+    [[nodiscard]] bool is_disassembly_set() const
+    {
+        return m_is_disassembly_set;
+    }
+
     void add_tilemap(std::vector<std::vector<std::shared_ptr<Tile>>> tiles)
     {
         m_tiles = std::move(tiles);
@@ -425,6 +551,72 @@ public:
         return m_is_file_content_set;
     }
 
+    /**
+     * Called by the panes that read from the snapshot, so it is taken the next time the session asks
+     * for it. Nothing is retrieved from the machine when no pane is shown.
+     */
+    void request_snapshot()
+    {
+        m_is_snapshot_requested = true;
+    }
+
+    /**
+     * Retrieves everything the snapshot has from the machine, if a pane has asked for it since the
+     * last time. Called by the session once per frame, after the CPU has run.
+     */
+    void take_snapshot()
+    {
+        if (!m_is_snapshot_requested) {
+            return;
+        }
+        m_is_snapshot_requested = false;
+
+        m_snapshot.m_registers_main.clear();
+        m_snapshot.m_registers_alternate.clear();
+        for (auto const& reg : m_register_retrievers) {
+            m_snapshot.m_registers_main.push_back(reg.main());
+            if (reg.is_alternate_set()) {
+                m_snapshot.m_registers_alternate.push_back(reg.alternate());
+            }
+        }
+
+        if (m_is_flag_register_set) {
+            m_snapshot.m_flag_register = m_flag_register_retriever.value();
+        }
+
+        m_snapshot.m_is_io_active.clear();
+        m_snapshot.m_io.clear();
+        for (auto const& io : m_io_retrievers) {
+            m_snapshot.m_is_io_active.push_back(io.is_active());
+            m_snapshot.m_io.push_back(io.value());
+        }
+
+        if (m_is_memory_set) {
+            m_snapshot.m_memory.clear();
+            m_snapshot.m_memory.add(m_memory_retriever.value());
+        }
+        if (m_is_disassembly_set) {
+            m_snapshot.m_disassembly_addresses = m_disassembly.addresses();
+        }
+        if (m_is_pc_set) {
+            m_snapshot.m_pc = m_pc_retriever();
+        }
+        if (m_is_sp_set) {
+            m_snapshot.m_sp = m_sp_retriever();
+        }
+        if (m_is_interrupted_set) {
+            m_snapshot.m_is_interrupted = m_is_interrupted_retriever();
+        }
+        if (m_is_interrupt_mode_set) {
+            m_snapshot.m_interrupt_mode = m_interrupt_mode_retriever();
+        }
+    }
+
+    [[nodiscard]] DebugSnapshot<A, D> const& snapshot() const
+    {
+        return m_snapshot;
+    }
+
 private:
     std::vector<RegisterDebugContainer<D>> m_register_retrievers;
     bool m_has_alternate_registers { false };
@@ -453,6 +645,9 @@ private:
     std::vector<DisassembledLine<A, B>> m_disassembled_program;
     bool m_is_disassembled_program_set { false };
 
+    DisassemblyDebugContainer<A, D> m_disassembly;
+    bool m_is_disassembly_set { false };
+
     std::vector<std::vector<std::shared_ptr<Tile>>> m_tiles;
     bool m_is_tilemap_set { false };
 
@@ -469,5 +664,8 @@ private:
 
     std::function<std::string()> m_file_content_retriever;
     bool m_is_file_content_set { false };
+
+    DebugSnapshot<A, D> m_snapshot;
+    bool m_is_snapshot_requested { false };
 };
 }
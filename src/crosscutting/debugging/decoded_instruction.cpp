@@ -0,0 +1,129 @@
+#include "decoded_instruction.h"
+#include "crosscutting/util/string_util.h"
+#include "doctest.h"
+#include <algorithm>
+
+namespace emu::debugger {
+
+using emu::util::string::hexify_wo_0x_to;
+
+static constexpr std::size_t s_max_number_length = 4;
+
+/**
+ * Appends a number to the line.
+ *
+ * @param line is the line to append to
+ * @param kind is the kind of placeholder the number is written for
+ * @param bytes are the bytes of the instruction
+ * @param index is the index of the first byte of the number
+ */
+static void append_number(std::string& line, char kind, std::array<u8, DecodedInstruction<u16, u8>::s_max_length> const& bytes, std::size_t index)
+{
+    char buffer[s_max_number_length + 1];
+    char* end = buffer;
+
+    switch (kind) {
+    case 'b':
+        end = hexify_wo_0x_to(buffer, bytes[index], 2);
+        break;
+    case 'w':
+        end = hexify_wo_0x_to(buffer, static_cast<unsigned int>(bytes[index] | (bytes[index + 1] << 8)), 4);
+        break;
+    case 'd': {
+        const int value = static_cast<i8>(bytes[index]);
+        *end++ = value < 0 ? '-' : '+';
+        unsigned int rest = static_cast<unsigned int>(value < 0 ? -value : value);
+        char* const digits = end;
+        do {
+            *end++ = static_cast<char>('0' + rest % 10);
+            rest /= 10;
+        } while (rest > 0);
+        std::reverse(digits, end);
+        break;
+    }
+    case 's': {
+        const int value = static_cast<i8>(bytes[index]);
+        if (value < 0) {
+            *end++ = '-';
+        }
+        end = hexify_wo_0x_to(end, static_cast<unsigned int>(value < 0 ? -value : value), 2);
+        break;
+    }
+    default:
+        break;
+    }
+
+    line.append(buffer, end);
+}
+
+void format_instruction(DecodedInstruction<u16, u8> const& instruction, std::string& line)
+{
+    if (instruction.m_mnemonic == nullptr) {
+        format_data_byte(instruction.m_address, instruction.m_bytes[0], line);
+        return;
+    }
+
+    char address[s_max_number_length];
+    line.assign(address, hexify_wo_0x_to(address, instruction.m_address, 4));
+    line.append("\t\t");
+
+    for (char const* c = instruction.m_mnemonic; *c != '\0'; ++c) {
+        if (*c == '%') {
+            append_number(line, c[1], instruction.m_bytes, static_cast<std::size_t>(c[2] - '0'));
+            c += 2;
+        } else {
+            line.push_back(*c);
+        }
+    }
+}
+
+void format_data_byte(u16 address, u8 value, std::string& line)
+{
+    char buffer[s_max_number_length];
+    line.assign(buffer, hexify_wo_0x_to(buffer, address, 4));
+    line.append("\t\tdb ");
+    line.append(buffer, hexify_wo_0x_to(buffer, value, 2));
+}
+
+TEST_CASE("crosscutting: format_instruction")
+{
+    std::string line = "what was there before";
+
+    SUBCASE("should fill in the placeholders from the bytes")
+    {
+        const DecodedInstruction<u16, u8> instruction {
+            .m_address = 0x1234,
+            .m_length = 4,
+            .m_bytes = { 0xdd, 0x36, 0xfb, 0x0a },
+            .m_mnemonic = "LD (IX%d2),%b3 ; %w2 %s2"
+        };
+
+        format_instruction(instruction, line);
+
+        CHECK_EQ("1234\t\tLD (IX-5),0a ; 0afb -05", line);
+    }
+
+    SUBCASE("should write a sign in front of positive displacements")
+    {
+        const DecodedInstruction<u16, u8> instruction {
+            .m_address = 0x0000,
+            .m_length = 3,
+            .m_bytes = { 0xdd, 0x7e, 0x7f },
+            .m_mnemonic = "LD A,(IX%d2)"
+        };
+
+        format_instruction(instruction, line);
+
+        CHECK_EQ("0000\t\tLD A,(IX+127)", line);
+    }
+
+    SUBCASE("should format an instruction without a mnemonic as a data byte")
+    {
+        const DecodedInstruction<u16, u8> instruction { .m_address = 0xffff, .m_length = 1, .m_bytes = { 0xd3 } };
+
+        format_instruction(instruction, line);
+
+        CHECK_EQ("ffff\t\tdb d3", line);
+    }
+}
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <array>
+#include <cstddef>
+#include <string>
+
+namespace emu::debugger {
+
+/**
+ * How the execution continues after an instruction.
+ */
+enum class ControlFlow {
+    Sequential,        // Continues with the next instruction
+    Jump,              // Continues at the target
+    ConditionalJump,   // Continues at the target or with the next instruction
+    Call,              // Calls the target and continues with the next instruction when it returns
+    ConditionalReturn, // Returns or continues with the next instruction
+    Return,            // Returns to an address that is only known at runtime
+    IndirectJump       // Jumps to an address that is only known at runtime
+};
+
+/**
+ * An instruction as decoded by a disassembler. The opcode, including any prefix, is in the first
+ * bytes and the operands follow it, the same way as they are in memory.
+ *
+ * The text of the instruction is not built when it is decoded. Instead, the mnemonic points to a
+ * constant pattern of the mnemonic and its operands, where the operand values are placeholders that
+ * refer to the bytes. Decoding is then cheap, and a listing formats only the lines it shows, into
+ * a buffer it reuses. The placeholders are a % followed by the kind of value and the index of its
+ * first byte:
+ * <ul>
+ *   <li>%b: the byte as two hex digits</li>
+ *   <li>%w: the byte and the next as a little-endian word of four hex digits</li>
+ *   <li>%d: the byte as a signed decimal number, always with its sign</li>
+ *   <li>%s: the byte as signed hex digits, with a minus sign only when it's negative</li>
+ * </ul>
+ *
+ * @tparam A is the address type
+ * @tparam D is the data type
+ */
+template<class A, class D>
+struct DecodedInstruction {
+    static constexpr std::size_t s_max_length = 4;
+
+    A m_address;
+    std::size_t m_length;
+    std::array<D, s_max_length> m_bytes;
+    ControlFlow m_control_flow { ControlFlow::Sequential };
+    A m_target { 0 };                   // Only used by jumps and calls
+    char const* m_mnemonic { nullptr }; // Null when the disassembler doesn't know the instruction
+};
+
+/**
+ * Formats an instruction as a line in a listing, which is the address followed by the mnemonic and
+ * the operands. An instruction without a mnemonic is formatted as a data byte.
+ *
+ * @param instruction is the instruction to format
+ * @param line is where the line is put, replacing what was there, so that a buffer that is reused
+ *             for every line keeps its capacity
+ */
+void format_instruction(DecodedInstruction<u16, u8> const& instruction, std::string& line);
+
+/**
+ * Formats a byte that is not disassembled as an instruction, so that every listing shows data the
+ * same way.
+ *
+ * @param address is the address of the byte
+ * @param value is the byte
+ * @param line is where the line is put, replacing what was there
+ */
+void format_data_byte(u16 address, u8 value, std::string& line);
+}
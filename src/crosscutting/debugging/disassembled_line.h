@@ -35,23 +35,15 @@ private:
     A m_address;
     std::string m_full_line;
 
-    static A address_from_disassembly_line(std::string line)
+    static A address_from_disassembly_line(std::string const& line)
     {
-        const std::string delimiter = "\t";
-        std::size_t pos;
-        std::string token;
-        std::vector<std::string> split;
-        while ((pos = line.find(delimiter)) != std::string::npos) {
-            token = line.substr(0, pos);
-            split.push_back(token);
-            line.erase(0, pos + delimiter.length());
-        }
+        const std::size_t end_of_address = line.find('\t');
 
-        if (split.empty()) {
+        if (end_of_address == std::string::npos) {
             throw std::runtime_error("Programming error: no elements in split disassembler line");
         }
 
-        return A(std::stoi(split[0], nullptr, B));
+        return A(std::stoi(line.substr(0, end_of_address), nullptr, B));
     }
 };
 }
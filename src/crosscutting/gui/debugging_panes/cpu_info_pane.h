@@ -4,14 +4,15 @@
 #include "crosscutting/util/byte_util.h"
 #include "crosscutting/util/string_util.h"
 #include "imgui.h"
-#include <ostream>
-#include <string>
 
 namespace emu::gui {
 
 using emu::debugger::DebugContainer;
+using emu::debugger::DebugSnapshot;
 using emu::util::byte::is_bit_set;
-using emu::util::string::hexify;
+using emu::util::string::decimalify_to;
+using emu::util::string::hexify_to;
+using emu::util::string::s_max_hexify_length;
 
 template<class A, class D, std::size_t B>
 class CpuInfoPane {
@@ -34,6 +35,10 @@ public:
         if (!m_is_debug_container_set) {
             ImGui::Text("The debug container is not provided this pane.");
         } else {
+            m_debug_container->request_snapshot();
+            DebugSnapshot<A, D> const& snapshot = m_debug_container->snapshot();
+            auto const& registers = m_debug_container->registers();
+
             ImGui::Text("Registers:");
             ImGui::Separator();
             if (m_debug_container->has_alternate_registers()) {
@@ -42,52 +47,34 @@ public:
                 ImGui::SameLine(s_margin_main_right, ImGui::GetStyle().ItemInnerSpacing.x);
                 ImGui::Text("Alternate");
             }
-            for (auto const& reg : m_debug_container->registers()) {
-                const std::string name = reg.name();
-                const D main = reg.main();
+            std::size_t alternate_index = 0;
+            for (std::size_t i = 0; i < registers.size() && i < snapshot.m_registers_main.size(); ++i) {
+                auto const& reg = registers[i];
+                const D main = snapshot.m_registers_main[i];
 
-                ImGui::Text("%s", name.c_str());
+                ImGui::TextUnformatted(reg.name().c_str());
                 ImGui::SameLine(s_margin_title_right, ImGui::GetStyle().ItemInnerSpacing.x);
-                if (m_debug_container->is_decimal()) {
-                    std::stringstream ss;
-                    ss << main;
-                    ImGui::Text("%s", ss.str().c_str());
-                } else {
-                    ImGui::Text("%s", hexify(main).c_str());
-                }
+                draw_value(main);
 
                 if (reg.is_alternate_set()) {
-                    const D alternate = reg.alternate();
+                    const D alternate = snapshot.m_registers_alternate[alternate_index++];
                     ImGui::SameLine(s_margin_main_right, ImGui::GetStyle().ItemInnerSpacing.x);
-                    if (m_debug_container->is_decimal()) {
-                        std::stringstream ss;
-                        ss << alternate;
-                        ImGui::Text("%s", ss.str().c_str());
-                    } else {
-                        ImGui::Text("%s", hexify(alternate).c_str());
-                    }
+                    draw_value(alternate);
                 }
             }
             if (m_debug_container->is_flag_register_set()) {
-                const std::string name = m_debug_container->flag_register().name();
-                const D value = m_debug_container->flag_register().value();
+                const D value = snapshot.m_flag_register;
 
                 ImGui::Separator();
-                ImGui::Text("%s", name.c_str());
+                ImGui::TextUnformatted(m_debug_container->flag_register().name().c_str());
                 ImGui::SameLine(s_margin_title_right, ImGui::GetStyle().ItemInnerSpacing.x);
-                if (m_debug_container->is_decimal()) {
-                    std::stringstream ss;
-                    ss << value;
-                    ImGui::Text("%s", ss.str().c_str());
-                } else {
-                    ImGui::Text("%s", hexify(value).c_str());
-                }
+                draw_value(value);
                 ImGui::SameLine(200.0f, ImGui::GetStyle().ItemInnerSpacing.x);
 
                 float offset = 0.0f;
                 for (auto const& bit : m_debug_container->flag_register().flag_names()) {
                     auto& [bit_name, bit_number] = bit;
-                    ImGui::Text("%s", is_bit_set(value, bit_number) ? bit_name.c_str() : "-");
+                    ImGui::TextUnformatted(is_bit_set(value, bit_number) ? bit_name.c_str() : "-");
                     offset += 10.0f;
                     ImGui::SameLine(200.0f + offset, ImGui::GetStyle().ItemInnerSpacing.x);
                 }
@@ -97,37 +84,25 @@ public:
                 ImGui::Separator();
                 ImGui::Text("PC:");
                 ImGui::SameLine(s_margin_title_right, ImGui::GetStyle().ItemInnerSpacing.x);
-                if (m_debug_container->is_decimal()) {
-                    std::stringstream ss;
-                    ss << m_debug_container->pc();
-                    ImGui::Text("%s", ss.str().c_str());
-                } else {
-                    ImGui::Text("%s", hexify(m_debug_container->pc()).c_str());
-                }
+                draw_value(snapshot.m_pc);
             }
             if (m_debug_container->is_sp_set()) {
                 ImGui::Separator();
                 ImGui::Text("SP:");
                 ImGui::SameLine(s_margin_title_right, ImGui::GetStyle().ItemInnerSpacing.x);
-                if (m_debug_container->is_decimal()) {
-                    std::stringstream ss;
-                    ss << m_debug_container->sp();
-                    ImGui::Text("%s", ss.str().c_str());
-                } else {
-                    ImGui::Text("%s", hexify(m_debug_container->sp()).c_str());
-                }
+                draw_value(snapshot.m_sp);
             }
             if (m_debug_container->is_interrupted_set()) {
                 ImGui::Separator();
                 ImGui::Text("Interrupted:");
                 ImGui::SameLine(s_margin_title_right, ImGui::GetStyle().ItemInnerSpacing.x);
-                ImGui::Text("%i", m_debug_container->is_interrupted());
+                ImGui::Text("%i", snapshot.m_is_interrupted);
             }
             if (m_debug_container->is_interrupt_mode_set()) {
                 ImGui::Separator();
                 ImGui::Text("Interrupt mode:");
                 ImGui::SameLine(s_margin_title_right, ImGui::GetStyle().ItemInnerSpacing.x);
-                ImGui::Text("%s", m_debug_container->interrupt_mode().c_str());
+                ImGui::TextUnformatted(snapshot.m_interrupt_mode.c_str());
             }
         }
 
@@ -138,6 +113,20 @@ private:
     static constexpr float s_margin_title_right = 120.0f;
     static constexpr float s_margin_main_right = 240.0f;
 
+    /**
+     * Formats the value on the stack, since the registers are drawn every frame.
+     */
+    template<class V>
+    static void draw_value(V value)
+    {
+        char buffer[s_max_hexify_length];
+        if constexpr (B == 10) {
+            ImGui::TextUnformatted(buffer, decimalify_to(buffer, value));
+        } else {
+            ImGui::TextUnformatted(buffer, hexify_to(buffer, value));
+        }
+    }
+
     std::shared_ptr<DebugContainer<A, D, B>> m_debug_container;
     bool m_is_debug_container_set { false };
 };
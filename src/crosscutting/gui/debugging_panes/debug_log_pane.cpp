@@ -1,16 +1,14 @@
 #include "debug_log_pane.h"
-#include "crosscutting/logging//logger.h"
-#include "crosscutting/util/string_util.h"
-#include <chrono>
+#include "crosscutting/logging/log_record.h"
+#include "crosscutting/logging/logger.h"
 #include <fmt/chrono.h> // IWYU pragma: keep
-#include <fmt/core.h>
-#include <string>
+#include <fmt/format.h>
+#include <iterator>
 #include <utility>
 
 namespace emu::gui {
 
-using emu::util::string::append;
-using emu::util::string::prepend;
+using emu::logging::level_name;
 
 DebugLogPane::DebugLogPane()
     : m_is_logger_set(false)
@@ -19,6 +17,13 @@ DebugLogPane::DebugLogPane()
     clear();
 }
 
+DebugLogPane::~DebugLogPane()
+{
+    if (m_is_logger_set) {
+        m_logger->remove_log_observer(this);
+    }
+}
+
 void DebugLogPane::attach_logger(std::shared_ptr<Logger> logger)
 {
     m_logger = std::move(logger);
@@ -33,17 +38,17 @@ void DebugLogPane::clear()
     m_line_offsets.push_back(0);
 }
 
-void DebugLogPane::add_log_with_timestamp(char const* fmt, va_list args)
+void DebugLogPane::move_added_lines()
 {
-    auto now = std::chrono::system_clock::now();
-    add_log(prepend(fmt::format("{:%Y-%m-%d %H:%M:%OS}: ", now), fmt).c_str(), args);
-}
+    std::lock_guard lock(m_added_lines_mutex);
+    if (m_added_lines.empty()) {
+        return;
+    }
 
-void DebugLogPane::add_log(char const* fmt, va_list args)
-{
     int old_size = m_buf.size();
 
-    m_buf.appendfv(fmt, args);
+    m_buf.append(m_added_lines.data(), m_added_lines.data() + m_added_lines.size());
+    m_added_lines.clear();
 
     for (int new_size = m_buf.size(); old_size < new_size; old_size++) {
         if (m_buf[old_size] == '\n') {
@@ -54,6 +59,8 @@ void DebugLogPane::add_log(char const* fmt, va_list args)
 
 void DebugLogPane::draw(char const* title, bool* p_open)
 {
+    move_added_lines();
+
     if (!ImGui::Begin(title, p_open)) {
         ImGui::End();
         return;
@@ -130,8 +137,10 @@ void DebugLogPane::draw(char const* title, bool* p_open)
     ImGui::End();
 }
 
-void DebugLogPane::log_element_added(char const* fmt, va_list args)
+void DebugLogPane::log_element_added(LogRecord const& record)
 {
-    add_log_with_timestamp(append("\n", fmt).c_str(), args);
+    std::lock_guard lock(m_added_lines_mutex);
+    fmt::format_to(std::back_inserter(m_added_lines), "{:%Y-%m-%d %H:%M:%OS}: [{}] {}\n",
+        record.m_time, level_name(record.m_level), record.m_message.data());
 }
 }
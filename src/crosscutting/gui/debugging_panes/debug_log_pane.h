@@ -2,29 +2,36 @@
 
 #include "crosscutting/logging/log_observer.h"
 #include "imgui.h"
-#include <cstdarg>
 #include <memory>
+#include <mutex>
+#include <string>
 
 namespace emu::logging {
 class Logger;
 }
+namespace emu::logging {
+struct LogRecord;
+}
 
 namespace emu::gui {
 
 using emu::logging::Logger;
 using emu::logging::LogObserver;
+using emu::logging::LogRecord;
 
 class DebugLogPane : public LogObserver {
 public:
     DebugLogPane();
 
+    ~DebugLogPane() override;
+
     void attach_logger(std::shared_ptr<Logger> logger);
 
     void draw(char const* title, bool* p_open = nullptr);
 
     void clear();
 
-    void log_element_added(char const* fmt, va_list args) override;
+    void log_element_added(LogRecord const& record) override;
 
 private:
     std::shared_ptr<Logger> m_logger;
@@ -35,8 +42,10 @@ private:
     ImVector<int> m_line_offsets;
     bool m_should_autoscroll;
 
-    void add_log_with_timestamp(char const* fmt, va_list args);
+    // The lines the logger has added since the last draw, which are moved to m_buf on the GUI thread
+    std::string m_added_lines;
+    std::mutex m_added_lines_mutex;
 
-    void add_log(char const* fmt, va_list args);
+    void move_added_lines();
 };
 }
@@ -5,6 +5,9 @@
 #include "crosscutting/debugging/debugger.h"
 #include "crosscutting/logging/logger.h"
 #include "crosscutting/typedefs.h"
+#include "crosscutting/util/string_util.h"
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <vector>
@@ -21,9 +24,10 @@ namespace emu::gui {
 
 using emu::debugger::Breakpoint;
 using emu::debugger::DebugContainer;
+using emu::debugger::DebugSnapshot;
 using emu::debugger::Debugger;
-using emu::debugger::DisassembledLine;
 using emu::logging::Logger;
+using emu::util::string::hexify;
 
 template<class A, class D, std::size_t B>
 class DisassemblyPane {
@@ -61,7 +65,7 @@ public:
             ImGui::Text("The debug container is not provided this pane.");
         } else if (!m_is_logger_set) {
             ImGui::Text("The logger is not provided this pane.");
-        } else if (!m_debug_container->is_disassembled_program_set()) {
+        } else if (!m_debug_container->is_disassembled_program_set() && !m_debug_container->is_disassembly_set()) {
             ImGui::Text("Disassembled program is not provided to this pane.");
         } else {
             reset_temp_state();
@@ -86,6 +90,8 @@ private:
     bool m_is_debug_container_set { false };
     bool m_is_logger_set { false };
     std::vector<std::string> m_content;
+    std::vector<A> m_addresses;
+    std::string m_line; // Reused by every visible line, so that drawing a frame doesn't allocate
 
     char m_address_to_goto_str[max_address_size] { "00000000" }; // NOLINT
     A m_address_to_goto { 0 };
@@ -207,66 +213,110 @@ private:
 
     void draw_addresses()
     {
-        if (m_debug_container->is_disassembled_program_set()) {
-            A const pc = m_debug_container->pc();
-
-            ImGui::BeginChild(
-                "disassembled_code_child",
-                ImVec2(ImGui::GetContentRegionAvail().x, ImGui::GetContentRegionAvail().y),
-                false, ImGuiWindowFlags_HorizontalScrollbar);
-
+        if (!m_debug_container->is_disassembly_set() && m_addresses.size() != m_debug_container->disassembled_program().size()) {
+            m_addresses.clear();
             for (auto const& line : m_debug_container->disassembled_program()) {
-                A const address = line.address();
-                std::string const& full_line = line.full_line();
-                bool const is_currently_looking_at_pc = address == pc;
+                m_addresses.push_back(line.address());
+            }
+        }
 
-                if (m_is_following_pc && is_currently_looking_at_pc) {
-                    ImGui::SetScrollHereY(0.25f);
+        m_debug_container->request_snapshot();
+        DebugSnapshot<A, D> const& snapshot = m_debug_container->snapshot();
+        std::vector<A> const& addresses = m_debug_container->is_disassembly_set()
+            ? snapshot.m_disassembly_addresses
+            : m_addresses;
+        A const pc = snapshot.m_pc;
+        float const line_height = ImGui::GetTextLineHeightWithSpacing();
+
+        ImGui::BeginChild(
+            "disassembled_code_child",
+            ImVec2(ImGui::GetContentRegionAvail().x, ImGui::GetContentRegionAvail().y),
+            false, ImGuiWindowFlags_HorizontalScrollbar);
+
+        scroll_to_row(addresses, line_height, pc);
+
+        // Only the visible lines are formatted, so the full listing is never built
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(addresses.size()), line_height);
+
+        while (clipper.Step()) {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+                A const address = addresses[static_cast<std::size_t>(row)];
+                if (m_debug_container->is_disassembly_set()) {
+                    m_debug_container->disassembly().line(snapshot.m_memory, address, m_line);
+                    draw_line(address, m_line, address == pc);
                 } else {
-                    bool const is_scrolling_due_to_goto_pc = m_is_going_to_pc && is_currently_looking_at_pc;
-                    bool const is_scrolling_due_to_given_address = m_is_going_to_address && address == m_address_to_goto;
-                    bool const is_scrolling_due_to_goto_bp = m_is_going_to_breakpoint && address == m_bp_address_to_goto;
-                    if (is_scrolling_due_to_goto_pc || is_scrolling_due_to_given_address || is_scrolling_due_to_goto_bp) {
-                        ImGui::SetScrollHereY(0.25f);
-                    }
+                    draw_line(address, m_debug_container->disassembled_program()[static_cast<std::size_t>(row)].full_line(), address == pc);
                 }
+            }
+        }
 
-                if (is_currently_looking_at_pc) {
-                    ImGui::PushStyleColor(ImGuiCol_Text, IM_COL32(0, 255, 0, 255));
-                }
+        clipper.End();
 
-                bool const is_breakpoint = m_debugger->has_breakpoint(address);
-                if (ImGui::Selectable(full_line.c_str(), is_breakpoint, ImGuiSelectableFlags_AllowDoubleClick)) {
-                    if (ImGui::IsMouseDoubleClicked(0)) {
-                        if (is_breakpoint) {
-                            m_debugger->remove_breakpoint(address);
-                            if (m_debug_container->is_decimal()) {
-                                std::stringstream ss;
-                                ss << address;
-                                m_logger->info("Removing breakpoint: %s", ss.str().c_str());
-                            } else {
-                                m_logger->info("Removing breakpoint: 0x%04x", address);
-                            }
-                        } else {
-                            m_debugger->add_breakpoint(address, Breakpoint<A, B>(line));
-                            if (m_debug_container->is_decimal()) {
-                                std::stringstream ss;
-                                ss << address;
-                                m_logger->info("Adding breakpoint: %s", ss.str().c_str());
-                            } else {
-                                m_logger->info("Adding breakpoint: 0x%04x", address);
-                            }
-                        }
-                    }
-                }
+        ImGui::EndChild();
+    }
+
+    void scroll_to_row(std::vector<A> const& addresses, float line_height, A pc)
+    {
+        bool is_scrolling = true;
+        A address_to_scroll_to { 0 };
+        if (m_is_following_pc || m_is_going_to_pc) {
+            address_to_scroll_to = pc;
+        } else if (m_is_going_to_address) {
+            address_to_scroll_to = m_address_to_goto;
+        } else if (m_is_going_to_breakpoint) {
+            address_to_scroll_to = m_bp_address_to_goto;
+        } else {
+            is_scrolling = false;
+        }
+
+        if (!is_scrolling) {
+            return;
+        }
+
+        auto const it = std::lower_bound(addresses.begin(), addresses.end(), address_to_scroll_to);
+        if (it == addresses.end() || *it != address_to_scroll_to) {
+            return;
+        }
 
-                if (is_currently_looking_at_pc) {
-                    ImGui::PopStyleColor();
+        float const row = static_cast<float>(std::distance(addresses.begin(), it));
+        ImGui::SetScrollY(std::max(0.0f, row * line_height - 0.25f * ImGui::GetWindowHeight()));
+    }
+
+    void draw_line(A address, std::string const& full_line, bool is_currently_looking_at_pc)
+    {
+        if (is_currently_looking_at_pc) {
+            ImGui::PushStyleColor(ImGuiCol_Text, IM_COL32(0, 255, 0, 255));
+        }
+
+        bool const is_breakpoint = m_debugger->has_breakpoint(address);
+        if (ImGui::Selectable(full_line.c_str(), is_breakpoint, ImGuiSelectableFlags_AllowDoubleClick)) {
+            if (ImGui::IsMouseDoubleClicked(0)) {
+                if (is_breakpoint) {
+                    m_debugger->remove_breakpoint(address);
+                    if (m_debug_container->is_decimal()) {
+                        std::stringstream ss;
+                        ss << address;
+                        m_logger->info("Removing breakpoint: %s", ss.str().c_str());
+                    } else {
+                        m_logger->info("Removing breakpoint: 0x%04x", address);
+                    }
+                } else {
+                    m_debugger->add_breakpoint(address, Breakpoint<A, B>(address, full_line));
+                    if (m_debug_container->is_decimal()) {
+                        std::stringstream ss;
+                        ss << address;
+                        m_logger->info("Adding breakpoint: %s", ss.str().c_str());
+                    } else {
+                        m_logger->info("Adding breakpoint: 0x%04x", address);
+                    }
                 }
             }
+        }
 
-            ImGui::EndChild();
+        if (is_currently_looking_at_pc) {
+            ImGui::PopStyleColor();
         }
-    };
+    }
 };
 }
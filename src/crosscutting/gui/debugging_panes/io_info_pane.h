@@ -8,8 +8,10 @@
 namespace emu::gui {
 
 using emu::debugger::DebugContainer;
+using emu::debugger::DebugSnapshot;
 using emu::util::byte::is_bit_set;
-using emu::util::string::hexify;
+using emu::util::string::hexify_to;
+using emu::util::string::s_max_hexify_length;
 
 template<class A, class D, std::size_t B>
 class IoInfoPane {
@@ -34,22 +36,27 @@ public:
         } else if (!m_debug_container->is_io_set()) {
             ImGui::Text("IO is not provided to this pane.");
         } else {
+            m_debug_container->request_snapshot();
+            DebugSnapshot<A, D> const& snapshot = m_debug_container->snapshot();
+            auto const& ios = m_debug_container->io();
+
             ImGui::Text("IO:");
             ImGui::Separator();
-            for (auto const& io : m_debug_container->io()) {
-                const std::string name = io.name();
-                bool const is_active = io.is_active();
-                const D new_value = io.value();
+            for (std::size_t i = 0; i < ios.size() && i < snapshot.m_io.size(); ++i) {
+                auto const& io = ios[i];
+                bool const is_active = snapshot.m_is_io_active[i];
+                const D new_value = snapshot.m_io[i];
                 bool const is_divided_into_bits = io.is_divided_into_bits();
 
-                ImGui::Text("%s", name.c_str());
+                ImGui::TextUnformatted(io.name().c_str());
 
                 if (is_active) {
                     ImGui::SameLine(250.0f, ImGui::GetStyle().ItemInnerSpacing.x);
                     ImGui::Text("x");
 
+                    char buffer[s_max_hexify_length];
                     ImGui::SameLine(300.0f, ImGui::GetStyle().ItemInnerSpacing.x);
-                    ImGui::Text("%s", hexify(new_value).c_str());
+                    ImGui::TextUnformatted(buffer, hexify_to(buffer, new_value));
                 }
 
                 if (is_divided_into_bits) {
@@ -3,6 +3,9 @@
 #include "crosscutting/debugging/debug_container.h"
 #include "crosscutting/typedefs.h"
 #include "imgui_memory_editor.h"
+#include <cstddef>
+#include <utility>
+#include <vector>
 
 namespace emu::gui {
 
@@ -11,7 +14,11 @@ using emu::debugger::DebugContainer;
 template<class A, class D, std::size_t B>
 class MemoryEditorPane {
 public:
-    MemoryEditorPane() = default;
+    MemoryEditorPane()
+    {
+        // The editor edits a copy of the memory, so the edits are written back to the memory afterwards
+        m_memory_editor.WriteFn = &MemoryEditorPane::record_write;
+    }
 
     void attach_debug_container(std::shared_ptr<DebugContainer<A, D, B>> debug_container)
     {
@@ -31,17 +38,35 @@ public:
         } else if (!m_debug_container->is_memory_set()) {
             ImGui::Text("Memory is not provided to this pane.");
         } else {
-            m_memory_editor.DrawContents(
-                m_debug_container->memory().value().data(),
-                m_debug_container->memory().value().size());
+            m_debug_container->request_snapshot();
+            auto const& memory = m_debug_container->snapshot().m_memory;
+            m_contents.assign(memory.begin(), memory.end());
+
+            m_memory_editor.ReadOnly = !m_debug_container->memory().is_writable();
+            m_memory_editor.DrawContents(m_contents.data(), m_contents.size());
+
+            for (auto const& [address, value] : s_pending_writes) {
+                m_debug_container->memory().write(address, value);
+            }
+            s_pending_writes.clear();
         }
 
         ImGui::End();
     }
 
 private:
+    // The editor can't tell the write handler which pane it belongs to, but every pane writes back
+    // its edits right after drawing, so the panes can share the edits that are waiting
+    inline static std::vector<std::pair<std::size_t, D>> s_pending_writes;
+
     MemoryEditor m_memory_editor;
+    std::vector<D> m_contents;
     std::shared_ptr<DebugContainer<A, D, B>> m_debug_container;
     bool m_is_debug_container_set { false };
+
+    static void record_write([[maybe_unused]] ImU8* data, std::size_t address, ImU8 value)
+    {
+        s_pending_writes.emplace_back(address, value);
+    }
 };
 }
@@ -1,4 +1,5 @@
 #include "framebuffer.h"
+#include "crosscutting/benchmarking/benchmark.h"
 #include "crosscutting/typedefs.h"
 #include "gui/graphics/color.h"
 #include <algorithm>
@@ -8,6 +9,12 @@
 
 namespace emu::gui {
 
+using emu::benchmarking::do_not_optimize;
+
+// The size of the screen of Pacman
+static constexpr unsigned int s_benchmark_height = 288;
+static constexpr unsigned int s_benchmark_width = 224;
+
 Framebuffer::Framebuffer(unsigned int height, unsigned int width, Color init_color)
     : m_height(height)
     , m_width(width)
@@ -70,4 +77,30 @@ unsigned int Framebuffer::width() const
 {
     return m_width;
 }
+
+BENCHMARK("crosscutting: Framebuffer set")
+{
+    Framebuffer framebuffer(s_benchmark_height, s_benchmark_width, Color::black());
+    const Color color = Color::white();
+    unsigned int row = 0;
+    unsigned int col = 0;
+
+    bench.run([&]() {
+        framebuffer.set(row, col, color);
+        if (++col == s_benchmark_width) {
+            col = 0;
+            row = (row + 1) % s_benchmark_height;
+        }
+    });
+    do_not_optimize(framebuffer);
+}
+
+BENCHMARK("crosscutting: Framebuffer to_output_vector")
+{
+    Framebuffer framebuffer(s_benchmark_height, s_benchmark_width, Color::black());
+
+    bench.run([&]() {
+        do_not_optimize(framebuffer.to_output_vector());
+    });
+}
 }
@@ -1,4 +1,5 @@
 #include "tile.h"
+#include "crosscutting/benchmarking/benchmark.h"
 #include "gui/graphics/color.h"
 #include "gui/graphics/framebuffer.h"
 #include <cstdint>
@@ -7,6 +8,8 @@
 
 namespace emu::gui {
 
+using emu::benchmarking::do_not_optimize;
+
 Tile::Tile(std::size_t height, std::size_t width)
     : m_height(height)
     , m_width(width)
@@ -62,4 +65,26 @@ UninitializedTile::UninitializedTile()
     : Tile(0, 0)
 {
 }
+
+BENCHMARK("crosscutting: Tile map_to_framebuffer")
+{
+    constexpr unsigned int tile_size = 8;
+    constexpr unsigned int rows_of_tiles = 36;
+    constexpr unsigned int cols_of_tiles = 28;
+
+    Tile tile(tile_size, tile_size);
+    for (std::size_t row = 0; row < tile_size; ++row) {
+        for (std::size_t col = 0; col < tile_size; ++col) {
+            tile.set(row, col, (row + col) % 2 == 0 ? Color::white() : Color::black());
+        }
+    }
+    Framebuffer framebuffer(rows_of_tiles * tile_size, cols_of_tiles * tile_size, Color::black());
+    unsigned int tile_idx = 0;
+
+    bench.run([&]() {
+        tile.map_to_framebuffer(framebuffer, tile_idx / cols_of_tiles * tile_size, tile_idx % cols_of_tiles * tile_size);
+        tile_idx = (tile_idx + 1) % (rows_of_tiles * cols_of_tiles);
+    });
+    do_not_optimize(framebuffer);
+}
 }
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "crosscutting/benchmarking/benchmark.h"
+
+namespace emu::gui {
+
+using emu::benchmarking::Bench;
+using emu::benchmarking::do_not_optimize;
+
+/**
+ * A GUI without a window that the benchmarks can draw frames with. Drawing a frame is timed without
+ * the printing of the hash that update_screen does.
+ *
+ * @tparam Headless is the headless GUI of the application
+ */
+template<class Headless>
+class GuiForBenchmark : public Headless {
+public:
+    /**
+     * Times how long create_framebuffer takes to draw a frame.
+     *
+     * @param bench is the benchmark to time with
+     * @param args are passed to create_framebuffer, and are the same for every frame
+     */
+    template<class... Args>
+    void run_create_framebuffer(Bench& bench, Args const&... args)
+    {
+        bench.run([&]() {
+            do_not_optimize(this->create_framebuffer(args...));
+        });
+    }
+};
+}
@@ -0,0 +1,16 @@
+#include "headless_gui.h"
+#include "crosscutting/util/hash_util.h"
+#include <fmt/core.h>
+#include <iostream>
+
+namespace emu::gui {
+
+using emu::util::hash::fnv1a;
+
+void print_frame_hash(u64 frame, std::vector<u32> const& framebuffer)
+{
+    const u64 hash = fnv1a(reinterpret_cast<u8 const*>(framebuffer.data()), framebuffer.size() * sizeof(u32));
+
+    std::cout << fmt::format("{} {:016x}\n", frame, hash);
+}
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace emu::debugger {
+template<class A, class D, std::size_t B>
+class DebugContainer;
+template<class A, std::size_t B>
+class Debugger;
+}
+namespace emu::logging {
+class Logger;
+}
+
+namespace emu::gui {
+
+using emu::debugger::DebugContainer;
+using emu::debugger::Debugger;
+using emu::logging::Logger;
+
+/**
+ * Prints the number and a hash of a frame on its own line.
+ */
+void print_frame_hash(u64 frame, std::vector<u32> const& framebuffer);
+
+/**
+ * The part of a GUI without a window that is the same for every application. It keeps the
+ * observers, ignores the debugger, and has print_frame_hash for the application's update_screen,
+ * which is the only part that has to be written for each application.
+ *
+ * @tparam Gui is the GUI of the application, which is derived from
+ * @tparam GuiObserver is the observer of the application's GUI
+ */
+template<class Gui, class GuiObserver>
+class HeadlessGui : public Gui {
+public:
+    void add_gui_observer(GuiObserver& observer) override
+    {
+        m_gui_observers.push_back(&observer);
+    }
+
+    void remove_gui_observer(GuiObserver* observer) override
+    {
+        m_gui_observers.erase(
+            std::remove(m_gui_observers.begin(), m_gui_observers.end(), observer),
+            m_gui_observers.end());
+    }
+
+    void update_debug_only() override
+    {
+    }
+
+    void attach_debugger([[maybe_unused]] std::shared_ptr<Debugger<u16, 16>> debugger) override
+    {
+    }
+
+    void attach_debug_container([[maybe_unused]] std::shared_ptr<DebugContainer<u16, u8, 16>> debug_container) override
+    {
+    }
+
+    void attach_logger([[maybe_unused]] std::shared_ptr<Logger> logger) override
+    {
+    }
+
+protected:
+    void print_frame_hash(std::vector<u32> const& framebuffer)
+    {
+        emu::gui::print_frame_hash(m_frame++, framebuffer);
+    }
+
+private:
+    u64 m_frame { 0 };
+
+    std::vector<GuiObserver*> m_gui_observers;
+};
+}
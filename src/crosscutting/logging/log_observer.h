@@ -1,6 +1,6 @@
 #pragma once
 
-#include <string>
+#include "log_record.h"
 
 namespace emu::logging {
 
@@ -8,6 +8,11 @@ class LogObserver {
 public:
     virtual ~LogObserver() = default;
 
-    virtual void log_element_added(char const* fmt, va_list args) = 0;
+    /**
+     * Called on the thread of the logger, not on the thread that logged the message.
+     *
+     * @param record is the message that was logged
+     */
+    virtual void log_element_added(LogRecord const& record) = 0;
 };
 }
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+namespace emu::logging {
+
+enum class LogLevel {
+    Debug,
+    Info,
+    Warning
+};
+
+[[nodiscard]] constexpr char const* level_name(LogLevel level)
+{
+    switch (level) {
+    case LogLevel::Debug:
+        return "DEBUG";
+    case LogLevel::Info:
+        return "INFO";
+    case LogLevel::Warning:
+        return "WARNING";
+    }
+
+    return "";
+}
+
+/**
+ * A log message, which is formatted when it is logged, so nothing refers to the arguments after that.
+ * Messages that are too long are cut off.
+ */
+struct LogRecord {
+    static constexpr std::size_t s_max_message_length = 256;
+
+    LogLevel m_level { LogLevel::Info };
+    std::chrono::system_clock::time_point m_time;
+    std::array<char, s_max_message_length> m_message {}; // Null-terminated
+};
+}
@@ -0,0 +1,103 @@
+#include "log_ring_buffer.h"
+#include "doctest.h"
+#include <cstring>
+#include <string>
+
+namespace emu::logging {
+
+LogRecord* LogRingBuffer::begin_write()
+{
+    const std::size_t write_index = m_write_index.load(std::memory_order_relaxed);
+    if (write_index - m_read_index.load(std::memory_order_acquire) == s_capacity) {
+        return nullptr;
+    }
+
+    return &m_records[write_index % s_capacity];
+}
+
+void LogRingBuffer::end_write()
+{
+    m_write_index.fetch_add(1, std::memory_order_release);
+}
+
+LogRecord const* LogRingBuffer::begin_read()
+{
+    const std::size_t read_index = m_read_index.load(std::memory_order_relaxed);
+    if (read_index == m_write_index.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+
+    return &m_records[read_index % s_capacity];
+}
+
+void LogRingBuffer::end_read()
+{
+    m_read_index.fetch_add(1, std::memory_order_release);
+}
+
+bool LogRingBuffer::is_empty() const
+{
+    return m_read_index.load(std::memory_order_acquire) == m_write_index.load(std::memory_order_acquire);
+}
+
+TEST_CASE("crosscutting: LogRingBuffer")
+{
+    auto const write = [](LogRingBuffer& buffer, char const* message) {
+        LogRecord* record = buffer.begin_write();
+        if (record == nullptr) {
+            return false;
+        }
+        std::strncpy(record->m_message.data(), message, record->m_message.size() - 1);
+        buffer.end_write();
+        return true;
+    };
+
+    SUBCASE("should read the records in the order they were written")
+    {
+        LogRingBuffer buffer;
+        write(buffer, "first");
+        write(buffer, "second");
+
+        LogRecord const* record = buffer.begin_read();
+        REQUIRE(record != nullptr);
+        CHECK_EQ(std::string("first"), record->m_message.data());
+        buffer.end_read();
+
+        record = buffer.begin_read();
+        REQUIRE(record != nullptr);
+        CHECK_EQ(std::string("second"), record->m_message.data());
+        buffer.end_read();
+
+        CHECK(buffer.begin_read() == nullptr);
+        CHECK(buffer.is_empty());
+    }
+
+    SUBCASE("should not write when the buffer is full")
+    {
+        LogRingBuffer buffer;
+        std::size_t written = 0;
+        while (write(buffer, "message")) {
+            ++written;
+        }
+
+        CHECK_EQ(512, written);
+
+        REQUIRE(buffer.begin_read() != nullptr);
+        buffer.end_read();
+        CHECK(write(buffer, "message"));
+    }
+
+    SUBCASE("should keep reading across the end of the buffer")
+    {
+        LogRingBuffer buffer;
+        for (int i = 0; i < 1000; ++i) {
+            REQUIRE(write(buffer, i % 2 == 0 ? "even" : "odd"));
+
+            LogRecord const* record = buffer.begin_read();
+            REQUIRE(record != nullptr);
+            CHECK_EQ(std::string(i % 2 == 0 ? "even" : "odd"), record->m_message.data());
+            buffer.end_read();
+        }
+    }
+}
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "log_record.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace emu::logging {
+
+/**
+ * A fixed number of log records shared by one thread that logs and one thread that consumes the
+ * records. Neither of them locks or allocates, so the thread that logs is never held up by the
+ * consumer. When the consumer falls behind and the buffer is full, new records are not written.
+ *
+ * A record is written in place between begin_write() and end_write(), and read in place between
+ * begin_read() and end_read().
+ */
+class LogRingBuffer {
+public:
+    /**
+     * @return the record to write to, or nullptr if the buffer is full
+     */
+    [[nodiscard]] LogRecord* begin_write();
+
+    void end_write();
+
+    /**
+     * @return the oldest record, or nullptr if the buffer is empty
+     */
+    [[nodiscard]] LogRecord const* begin_read();
+
+    void end_read();
+
+    [[nodiscard]] bool is_empty() const;
+
+private:
+    static constexpr std::size_t s_capacity = 512; // A power of two, so the indices can wrap around
+    static constexpr std::size_t s_cache_line_size = 64;
+
+    std::array<LogRecord, s_capacity> m_records;
+
+    // On separate cache lines, so the two threads don't invalidate each other's index
+    alignas(s_cache_line_size) std::atomic<std::size_t> m_write_index { 0 };
+    alignas(s_cache_line_size) std::atomic<std::size_t> m_read_index { 0 };
+};
+}
@@ -1,41 +1,172 @@
 #include "logger.h"
 #include "crosscutting/logging/log_observer.h"
-#include "crosscutting/util/string_util.h"
+#include "doctest.h"
 #include <algorithm>
 #include <cstdarg>
+#include <cstdio>
 #include <string>
+#include <vector>
 
 namespace emu::logging {
 
-using emu::util::string::prepend;
+Logger::Logger()
+{
+#ifdef EMU_HAS_LOG_THREAD
+    m_consumer = std::thread([this]() { consume(); });
+#endif
+}
 
-Logger::Logger() = default;
+Logger::~Logger()
+{
+#ifdef EMU_HAS_LOG_THREAD
+    m_is_stopping.store(true, std::memory_order_release);
+    m_wake_ups.fetch_add(1, std::memory_order_release);
+    m_wake_ups.notify_one();
+    m_consumer.join();
+#endif
+}
 
 void Logger::add_log_observer(LogObserver& observer)
 {
+    std::lock_guard lock(m_log_observers_mutex);
     m_log_observers.push_back(&observer);
 }
 
 [[maybe_unused]] void Logger::remove_log_observer(LogObserver* observer)
 {
+    std::lock_guard lock(m_log_observers_mutex);
     m_log_observers.erase(
         std::remove(m_log_observers.begin(), m_log_observers.end(), observer),
         m_log_observers.end());
 }
 
-void Logger::info(char const* fmt, ...)
+void Logger::flush()
 {
-    va_list args;
+#ifdef EMU_HAS_LOG_THREAD
+    while (!m_records.is_empty()) {
+        std::this_thread::yield();
+    }
+#endif
+}
+
+void Logger::log(LogLevel level, char const* fmt, ...)
+{
+    LogRecord* record = m_records.begin_write();
+    if (record == nullptr) {
+        m_dropped_records.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
 
+    record->m_level = level;
+    record->m_time = std::chrono::system_clock::now();
+
+    va_list args;
     va_start(args, fmt);
-    notify_log_observers(prepend("[INFO] ", fmt).c_str(), args);
+    std::vsnprintf(record->m_message.data(), record->m_message.size(), fmt, args);
     va_end(args);
+
+    m_records.end_write();
+
+#ifdef EMU_HAS_LOG_THREAD
+    m_wake_ups.fetch_add(1, std::memory_order_release);
+    m_wake_ups.notify_one();
+#else
+    notify_log_observers();
+#endif
+}
+
+#ifdef EMU_HAS_LOG_THREAD
+void Logger::consume()
+{
+    while (!m_is_stopping.load(std::memory_order_acquire)) {
+        const unsigned int wake_ups = m_wake_ups.load(std::memory_order_acquire);
+        notify_log_observers();
+        m_wake_ups.wait(wake_ups, std::memory_order_acquire);
+    }
+
+    notify_log_observers();
+}
+#endif
+
+/**
+ * A record is only given back to the ring buffer after the observers have seen it, so flush() can
+ * wait for the ring buffer to become empty.
+ */
+void Logger::notify_log_observers()
+{
+    std::lock_guard lock(m_log_observers_mutex);
+
+    if (const unsigned int dropped_records = m_dropped_records.exchange(0, std::memory_order_relaxed); dropped_records > 0) {
+        LogRecord record;
+        record.m_level = LogLevel::Warning;
+        record.m_time = std::chrono::system_clock::now();
+        std::snprintf(record.m_message.data(), record.m_message.size(),
+            "%u log messages were dropped, because they came faster than they could be shown", dropped_records);
+
+        for (LogObserver* observer : m_log_observers) {
+            observer->log_element_added(record);
+        }
+    }
+
+    for (LogRecord const* record = m_records.begin_read(); record != nullptr; record = m_records.begin_read()) {
+        for (LogObserver* observer : m_log_observers) {
+            observer->log_element_added(*record);
+        }
+        m_records.end_read();
+    }
 }
 
-void Logger::notify_log_observers(char const* fmt, va_list args)
+class TestLogObserver : public LogObserver {
+public:
+    std::vector<std::string> m_lines;
+
+    void log_element_added(LogRecord const& record) override
+    {
+        m_lines.push_back(std::string("[") + level_name(record.m_level) + "] " + record.m_message.data());
+    }
+};
+
+TEST_CASE("crosscutting: Logger")
 {
-    for (LogObserver* observer : m_log_observers) {
-        observer->log_element_added(fmt, args);
+    SUBCASE("should format the messages and hand them to the observers")
+    {
+        TestLogObserver observer;
+        Logger logger;
+        logger.add_log_observer(observer);
+
+        logger.info("Breakpoint hit: 0x%04x", 0x10a8);
+        logger.warning("%s", "Unknown port");
+        logger.flush();
+
+        REQUIRE_EQ(2, observer.m_lines.size());
+        CHECK_EQ("[INFO] Breakpoint hit: 0x10a8", observer.m_lines[0]);
+        CHECK_EQ("[WARNING] Unknown port", observer.m_lines[1]);
+    }
+
+    SUBCASE("should cut off messages that are too long")
+    {
+        TestLogObserver observer;
+        Logger logger;
+        logger.add_log_observer(observer);
+
+        const std::string long_message(1000, 'x');
+        logger.info("%s", long_message.c_str());
+        logger.flush();
+
+        REQUIRE_EQ(1, observer.m_lines.size());
+        CHECK_EQ(std::string("[INFO] ") + std::string(LogRecord::s_max_message_length - 1, 'x'), observer.m_lines[0]);
+    }
+
+    SUBCASE("should not hand messages below the minimum level to the observers")
+    {
+        TestLogObserver observer;
+        Logger logger;
+        logger.add_log_observer(observer);
+
+        logger.debug("Only shown when debug messages are compiled in");
+        logger.flush();
+
+        CHECK_EQ(Logger::s_minimum_level <= LogLevel::Debug ? 1 : 0, observer.m_lines.size());
     }
 }
 }
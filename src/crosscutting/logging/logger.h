@@ -1,28 +1,101 @@
 #pragma once
 
-#include <cstdarg>
+#include "log_record.h"
+#include "log_ring_buffer.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
 #include <vector>
 
+/*
+ * The least severe level that is logged: 0 is debug, 1 is info and 2 is warning. The calls to the
+ * levels below it are compiled away, so they can be left in the code.
+ */
+#ifndef EMU_MINIMUM_LOG_LEVEL
+#define EMU_MINIMUM_LOG_LEVEL 1
+#endif
+
+#if !defined(__EMSCRIPTEN__)
+#define EMU_HAS_LOG_THREAD
+#endif
+
 namespace emu::logging {
 class LogObserver;
 }
 
 namespace emu::logging {
 
+/**
+ * Formats the log messages into records right away, but hands them to the observers on a thread of
+ * its own. Logging therefore never waits for the debug log pane, a file or anything else that shows
+ * the log. Only one thread is supposed to log, which is the thread the emulation runs on.
+ *
+ * When the observers fall too far behind, the messages are dropped instead of waiting for them,
+ * and the observers are told how many were dropped.
+ */
 class Logger {
 
 public:
+    static constexpr LogLevel s_minimum_level = static_cast<LogLevel>(EMU_MINIMUM_LOG_LEVEL);
+
     Logger();
 
+    ~Logger();
+
+    Logger(Logger const&) = delete;
+
+    Logger& operator=(Logger const&) = delete;
+
     void add_log_observer(LogObserver& observer);
 
     [[maybe_unused]] void remove_log_observer(LogObserver* observer);
 
-    void info(char const* fmt, ...);
+    template<class... Args>
+    void debug(char const* fmt, Args... args)
+    {
+        if constexpr (s_minimum_level <= LogLevel::Debug) {
+            log(LogLevel::Debug, fmt, args...);
+        }
+    }
+
+    template<class... Args>
+    void info(char const* fmt, Args... args)
+    {
+        if constexpr (s_minimum_level <= LogLevel::Info) {
+            log(LogLevel::Info, fmt, args...);
+        }
+    }
+
+    template<class... Args>
+    void warning(char const* fmt, Args... args)
+    {
+        if constexpr (s_minimum_level <= LogLevel::Warning) {
+            log(LogLevel::Warning, fmt, args...);
+        }
+    }
+
+    /**
+     * Waits until the observers have been given every message that has been logged so far.
+     */
+    void flush();
 
 private:
+    LogRingBuffer m_records;
+    std::atomic<unsigned int> m_dropped_records { 0 };
+
     std::vector<LogObserver*> m_log_observers;
+    std::mutex m_log_observers_mutex; // Never taken by the thread that logs
+
+#ifdef EMU_HAS_LOG_THREAD
+    std::atomic<unsigned int> m_wake_ups { 0 };
+    std::atomic<bool> m_is_stopping { false };
+    std::thread m_consumer;
+
+    void consume();
+#endif
+
+    void log(LogLevel level, char const* fmt, ...);
 
-    void notify_log_observers(char const* fmt, va_list args);
+    void notify_log_observers();
 };
 }
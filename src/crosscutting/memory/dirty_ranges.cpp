@@ -0,0 +1,158 @@
+#include "dirty_ranges.h"
+#include "doctest.h"
+#include <algorithm>
+#include <bit>
+
+namespace emu::memory {
+
+DirtyRanges::DirtyRanges(std::size_t size)
+    : m_size(size)
+    , m_words((size + s_bits_per_word - 1) / s_bits_per_word, 0)
+{
+}
+
+void DirtyRanges::mark(std::size_t first, std::size_t last)
+{
+    if (first > last) {
+        return;
+    }
+
+    const std::size_t first_word = first / s_bits_per_word;
+    const std::size_t last_word = last / s_bits_per_word;
+    const u64 from_first = ~static_cast<u64>(0) << (first % s_bits_per_word);
+    const u64 to_last = ~static_cast<u64>(0) >> (s_bits_per_word - 1 - last % s_bits_per_word);
+
+    if (first_word == last_word) {
+        m_words[first_word] |= from_first & to_last;
+    } else {
+        m_words[first_word] |= from_first;
+        std::fill(m_words.begin() + static_cast<std::ptrdiff_t>(first_word + 1), m_words.begin() + static_cast<std::ptrdiff_t>(last_word), ~static_cast<u64>(0));
+        m_words[last_word] |= to_last;
+    }
+    m_is_empty = false;
+}
+
+bool DirtyRanges::is_empty() const
+{
+    return m_is_empty;
+}
+
+void DirtyRanges::take(std::vector<Range>& ranges)
+{
+    ranges.clear();
+    if (m_is_empty) {
+        return;
+    }
+
+    bool is_in_range = false;
+    std::size_t first = 0;
+
+    for (std::size_t word_index = 0; word_index < m_words.size(); ++word_index) {
+        const u64 word = m_words[word_index];
+        m_words[word_index] = 0;
+
+        // Every step finds where the current range of marked or unmarked addresses ends
+        for (std::size_t bit = 0; bit < s_bits_per_word;) {
+            const u64 rest = (is_in_range ? ~word : word) >> bit;
+            if (rest == 0) {
+                break;
+            }
+
+            bit += static_cast<std::size_t>(std::countr_zero(rest));
+            if (is_in_range) {
+                ranges.push_back({ first, word_index * s_bits_per_word + bit - 1 });
+            } else {
+                first = word_index * s_bits_per_word + bit;
+            }
+            is_in_range = !is_in_range;
+        }
+    }
+
+    if (is_in_range) {
+        ranges.push_back({ first, m_size - 1 });
+    }
+
+    m_is_empty = true;
+}
+
+TEST_CASE("crosscutting: DirtyRanges")
+{
+    DirtyRanges dirty_ranges(0x10000);
+    std::vector<DirtyRanges::Range> ranges;
+
+    SUBCASE("should have no ranges when nothing has been marked")
+    {
+        dirty_ranges.take(ranges);
+
+        CHECK(dirty_ranges.is_empty());
+        CHECK(ranges.empty());
+    }
+
+    SUBCASE("should join the marked addresses into ranges, also across words")
+    {
+        dirty_ranges.mark(0x0000);
+        dirty_ranges.mark(0x0002);
+        dirty_ranges.mark(0x0003);
+        dirty_ranges.mark(0x0003);
+        dirty_ranges.mark(0x003e, 0x0081);
+        dirty_ranges.mark(0xffff);
+
+        CHECK_FALSE(dirty_ranges.is_empty());
+        dirty_ranges.take(ranges);
+
+        REQUIRE_EQ(4, ranges.size());
+        CHECK_EQ(0x0000, ranges[0].m_first);
+        CHECK_EQ(0x0000, ranges[0].m_last);
+        CHECK_EQ(0x0002, ranges[1].m_first);
+        CHECK_EQ(0x0003, ranges[1].m_last);
+        CHECK_EQ(0x003e, ranges[2].m_first);
+        CHECK_EQ(0x0081, ranges[2].m_last);
+        CHECK_EQ(0xffff, ranges[3].m_first);
+        CHECK_EQ(0xffff, ranges[3].m_last);
+    }
+
+    SUBCASE("should unmark the addresses when they are taken")
+    {
+        dirty_ranges.mark(0x1000, 0x1fff);
+        dirty_ranges.take(ranges);
+        dirty_ranges.mark(0x4000);
+        dirty_ranges.take(ranges);
+
+        REQUIRE_EQ(1, ranges.size());
+        CHECK_EQ(0x4000, ranges[0].m_first);
+        CHECK_EQ(0x4000, ranges[0].m_last);
+    }
+
+    SUBCASE("should mark every address of a range, also when it starts and ends inside words")
+    {
+        dirty_ranges.mark(0x0005, 0x0005);
+        dirty_ranges.mark(0x0041, 0x007e);
+        dirty_ranges.mark(0x00c0, 0x00ff);
+        dirty_ranges.mark(0x0123, 0x4000);
+        dirty_ranges.mark(0x0300, 0x0200);
+
+        dirty_ranges.take(ranges);
+
+        REQUIRE_EQ(4, ranges.size());
+        CHECK_EQ(0x0005, ranges[0].m_first);
+        CHECK_EQ(0x0005, ranges[0].m_last);
+        CHECK_EQ(0x0041, ranges[1].m_first);
+        CHECK_EQ(0x007e, ranges[1].m_last);
+        CHECK_EQ(0x00c0, ranges[2].m_first);
+        CHECK_EQ(0x00ff, ranges[2].m_last);
+        CHECK_EQ(0x0123, ranges[3].m_first);
+        CHECK_EQ(0x4000, ranges[3].m_last);
+    }
+
+    SUBCASE("should end the last range at the last address when the size isn't a whole number of words")
+    {
+        DirtyRanges small(10);
+        small.mark(8, 9);
+        small.take(ranges);
+
+        REQUIRE_EQ(1, ranges.size());
+        CHECK_EQ(8, ranges[0].m_first);
+        CHECK_EQ(9, ranges[0].m_last);
+    }
+}
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <cstddef>
+#include <vector>
+
+namespace emu::memory {
+
+/**
+ * Remembers which addresses have changed since the last time they were taken, so that what is
+ * derived from the memory, like the disassembly, only has to be redone where the memory has changed.
+ *
+ * Every address is one bit, so marking an address is cheap enough to be done on every write, and
+ * an address that is written to many times is still only taken once.
+ */
+class DirtyRanges {
+public:
+    struct Range {
+        std::size_t m_first;
+        std::size_t m_last;
+    };
+
+    /**
+     * @param size is the number of addresses, starting at 0, that can be marked
+     */
+    explicit DirtyRanges(std::size_t size);
+
+    void mark(std::size_t address)
+    {
+        m_words[address / s_bits_per_word] |= static_cast<u64>(1) << (address % s_bits_per_word);
+        m_is_empty = false;
+    }
+
+    /**
+     * Marks a range of addresses a whole word at a time, so that marking a switched bank is cheap.
+     * Nothing is marked when the range is empty.
+     *
+     * @param first is the first address to mark
+     * @param last is the last address to mark, which is marked too
+     */
+    void mark(std::size_t first, std::size_t last);
+
+    [[nodiscard]] bool is_empty() const;
+
+    /**
+     * Finds the marked addresses, and unmarks them.
+     *
+     * @param ranges is where the marked addresses are put as ranges of consecutive addresses, in
+     *               order and replacing what was there
+     */
+    void take(std::vector<Range>& ranges);
+
+private:
+    static constexpr std::size_t s_bits_per_word = 64;
+
+    std::size_t m_size;
+    std::vector<u64> m_words;
+    bool m_is_empty { true };
+};
+}
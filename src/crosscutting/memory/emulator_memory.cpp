@@ -1,9 +1,18 @@
 #include "emulator_memory.h"
+#include "crosscutting/benchmarking/benchmark.h"
 #include "crosscutting/typedefs.h"
 #include "doctest.h"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
 
 namespace emu::memory {
 
+using emu::benchmarking::Bench;
+using emu::benchmarking::do_not_optimize;
+
 void dummy()
 {
     // To force the cpp file to be compiled and the tests to be registered.
@@ -98,5 +107,197 @@ TEST_CASE("crosscutting: EmulatorMemory")
 
         CHECK_EQ(15, memory.size());
     }
+    SUBCASE("should restore a saved part of the memory")
+    {
+        EmulatorMemory<u16, u8> memory;
+
+        const std::vector<u8> input = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+        memory.add(input);
+
+        std::vector<u8> state;
+        StateWriter writer(state);
+        memory.save_state(writer, 2, 8);
+
+        CHECK_EQ(6, state.size());
+
+        for (std::size_t i = 0; i < input.size(); ++i) {
+            memory.write(static_cast<u16>(i), 0);
+        }
+
+        StateReader reader(state);
+        memory.load_state(reader, 2, 8);
+
+        for (std::size_t i = 0; i < input.size(); ++i) {
+            const u16 address = static_cast<u16>(i);
+            if (address >= 2 && address < 8) {
+                CHECK_EQ(input[i], memory.read(address));
+            } else {
+                CHECK_EQ(0, memory.read(address));
+            }
+        }
+    }
+
+    SUBCASE("should read a mapped file without copying it, and ignore writes to it")
+    {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "emu_emulator_memory_test.bin";
+        const std::vector<u8> input = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        {
+            std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<char const*>(input.data()), static_cast<std::streamsize>(input.size()));
+        }
+
+        auto mapped_file = std::make_shared<MappedFile const>(path.string());
+        EmulatorMemory<u16, u8> memory;
+        memory.add_read_only(mapped_file);
+
+        CHECK_EQ(input.size(), memory.size());
+        CHECK_EQ(mapped_file->bytes().data(), memory.begin());
+
+        memory.write(5, 100);
+
+        for (std::size_t i = 0; i < input.size(); ++i) {
+            const u16 address = static_cast<u16>(i);
+            CHECK_EQ(input[i], memory.read(address));
+        }
+
+        CHECK_EQ(input, std::vector<u8>(memory.begin(), memory.end()));
+
+        std::filesystem::remove(path);
+    }
+
+    SUBCASE("should read its own contents after being copied")
+    {
+        EmulatorMemory<u16, u8> memory;
+        memory.add({ 1, 2, 3 });
+
+        EmulatorMemory<u16, u8> copy(memory);
+        memory.write(1, 100);
+        copy.add({ 4 });
+
+        CHECK_EQ(100, memory.read(1));
+        CHECK_EQ(2, copy.read(1));
+        CHECK_EQ(4, copy.read(3));
+        CHECK_NE(memory.begin(), copy.begin());
+    }
+
+    SUBCASE("should mark what is written and restored in the dirty ranges")
+    {
+        EmulatorMemory<u16, u8> memory;
+        memory.add(std::vector<u8>(16, 0));
+        auto dirty_ranges = std::make_shared<DirtyRanges>(16);
+        memory.attach_dirty_ranges(dirty_ranges);
+
+        std::vector<u8> state;
+        StateWriter writer(state);
+        memory.save_state(writer, 12, 16);
+
+        memory.write(3, 1);
+        memory.direct_write(5, 1);
+        StateReader reader(state);
+        memory.load_state(reader, 12, 16);
+
+        std::vector<DirtyRanges::Range> ranges;
+        dirty_ranges->take(ranges);
+
+        REQUIRE_EQ(2, ranges.size());
+        CHECK_EQ(3, ranges[0].m_first);
+        CHECK_EQ(3, ranges[0].m_last);
+        CHECK_EQ(12, ranges[1].m_first);
+        CHECK_EQ(15, ranges[1].m_last);
+        CHECK_EQ(1, memory.read(3));
+    }
+
+    SUBCASE("should stop marking when the dirty ranges are detached")
+    {
+        EmulatorMemory<u16, u8> memory;
+        memory.add(std::vector<u8>(16, 0));
+        auto dirty_ranges = std::make_shared<DirtyRanges>(16);
+        memory.attach_dirty_ranges(dirty_ranges);
+
+        memory.attach_dirty_ranges(nullptr);
+        memory.write(3, 1);
+
+        CHECK(dirty_ranges->is_empty());
+        CHECK_EQ(1, memory.read(3));
+    }
+}
+
+/**
+ * A memory mapper like the ones the applications have, where writes to the ROM are ignored.
+ */
+class MemoryMapperForBenchmark : public MemoryMappedIo<u16, u8> {
+public:
+    explicit MemoryMapperForBenchmark(EmulatorMemory<u16, u8>& memory)
+        : m_memory(memory)
+    {
+    }
+
+    u8 read(u16 address) override
+    {
+        return m_memory.direct_read(address);
+    }
+
+    void write(u16 address, u8 value) override
+    {
+        if (address >= s_rom_size) {
+            m_memory.direct_write(address, value);
+        }
+    }
+
+private:
+    static constexpr u16 s_rom_size = 0x4000;
+
+    EmulatorMemory<u16, u8>& m_memory;
+};
+
+static void read_for_benchmark(Bench& bench, bool is_mapped)
+{
+    EmulatorMemory<u16, u8> memory;
+    memory.add(std::vector<u8>(UINT16_MAX + 1, 0));
+    if (is_mapped) {
+        memory.attach_memory_mapper(std::make_shared<MemoryMapperForBenchmark>(memory));
+    }
+
+    u16 address = 0;
+    bench.run([&]() {
+        do_not_optimize(memory.read(address++));
+    });
+}
+
+static void write_for_benchmark(Bench& bench, bool is_mapped)
+{
+    EmulatorMemory<u16, u8> memory;
+    memory.add(std::vector<u8>(UINT16_MAX + 1, 0));
+    if (is_mapped) {
+        memory.attach_memory_mapper(std::make_shared<MemoryMapperForBenchmark>(memory));
+    }
+
+    u16 address = 0;
+    bench.run([&]() {
+        memory.write(address, static_cast<u8>(address));
+        ++address;
+    });
+    do_not_optimize(memory.begin());
+}
+
+BENCHMARK("crosscutting: EmulatorMemory read")
+{
+    read_for_benchmark(bench, false);
+}
+
+BENCHMARK("crosscutting: EmulatorMemory read, with a memory mapper")
+{
+    read_for_benchmark(bench, true);
+}
+
+BENCHMARK("crosscutting: EmulatorMemory write")
+{
+    write_for_benchmark(bench, false);
+}
+
+BENCHMARK("crosscutting: EmulatorMemory write, with a memory mapper")
+{
+    write_for_benchmark(bench, true);
 }
 }
@@ -1,12 +1,20 @@
 #pragma once
 
+#include "crosscutting/memory/dirty_ranges.h"
+#include "crosscutting/memory/mapped_file.h"
 #include "crosscutting/memory/memory_mapped_io.h" // IWYU pragma: keep
+#include "crosscutting/misc/state_stream.h"
 #include <cstddef>
 #include <memory>
+#include <span>
+#include <stdexcept>
 #include <vector>
 
 namespace emu::memory {
 
+using emu::misc::StateReader;
+using emu::misc::StateWriter;
+
 void dummy();
 
 template<class A, class D>
@@ -14,30 +22,115 @@ class EmulatorMemory {
 public:
     EmulatorMemory() = default;
 
+    EmulatorMemory(EmulatorMemory const& other)
+        : m_memory(other.m_memory)
+        , m_read_only(other.m_read_only)
+        , m_read_only_file(other.m_read_only_file)
+        , m_contents(other.m_is_read_only ? m_read_only.data() : m_memory.data())
+        , m_is_read_only(other.m_is_read_only)
+        , m_memory_mapper(other.m_memory_mapper)
+        , m_memory_mapper_is_attached(other.m_memory_mapper_is_attached)
+        , m_dirty_ranges(other.m_dirty_ranges)
+        , m_is_write_observed(other.m_is_write_observed)
+    {
+    }
+
+    // Moving keeps the buffer of the vector, so what is read from is still right
+    EmulatorMemory(EmulatorMemory&& other) noexcept = default;
+
+    EmulatorMemory& operator=(EmulatorMemory const& other)
+    {
+        return *this = EmulatorMemory(other);
+    }
+
+    EmulatorMemory& operator=(EmulatorMemory&& other) noexcept = default;
+
+    ~EmulatorMemory() = default;
+
     void add(std::vector<D> const& to_add)
     {
-        const std::size_t current_size = m_memory.size();
+        m_memory.insert(m_memory.end(), to_add.begin(), to_add.end());
+        m_contents = m_memory.data();
+    }
 
-        for (std::size_t i = current_size, j = 0; i < current_size + to_add.size(); ++i, ++j) {
-            m_memory.push_back(to_add[j]);
+    // A template, so braced lists still go to the vector overload instead of being ambiguous
+    template<std::size_t extent>
+    void add(std::span<D const, extent> to_add)
+    {
+        m_memory.insert(m_memory.end(), to_add.begin(), to_add.end());
+        m_contents = m_memory.data();
+    }
+
+    /**
+     * Makes the memory a read-only view of a mapped file, so that it's read straight from the
+     * mapped pages instead of from a copy. Writes are ignored, the same way as writes to ROM are.
+     * Only meant for memory that is nothing but ROM, so the memory has to be empty. There is nothing
+     * to write to, so direct_write must not be used on it.
+     *
+     * @param file is the file to view, which is kept alive by the memory
+     */
+    void add_read_only(std::shared_ptr<MappedFile const> file)
+    {
+        if (!m_memory.empty()) {
+            throw std::invalid_argument("Read-only memory can't be combined with other memory");
         }
+
+        m_read_only = file->bytes();
+        m_read_only_file = std::move(file);
+        m_contents = m_read_only.data();
+        m_is_read_only = true;
+        m_is_write_observed = true;
     }
 
     void attach_memory_mapper(std::shared_ptr<MemoryMappedIo<A, D>> memory_mapper)
     {
         m_memory_mapper = std::move(memory_mapper);
         m_memory_mapper_is_attached = true;
+        m_is_write_observed = true;
+    }
+
+    /**
+     * Marks every address that is written to from now on, so that what is derived from the memory
+     * knows what has changed. Writes that bypass this memory, like the direct writes of a memory
+     * mapper, are not seen.
+     *
+     * @param dirty_ranges is where the addresses are marked, which has to cover the address space,
+     *                     or nullptr to stop marking them
+     */
+    void attach_dirty_ranges(std::shared_ptr<DirtyRanges> dirty_ranges)
+    {
+        m_dirty_ranges = std::move(dirty_ranges);
+        m_is_write_observed = m_memory_mapper_is_attached || m_dirty_ranges;
+    }
+
+    /**
+     * Marks addresses as changed without them being written to, like when a memory mapper switches
+     * banks. Does nothing when no dirty ranges are attached.
+     *
+     * @param first is the first address that has changed
+     * @param last is the last address that has changed
+     */
+    void mark_dirty(std::size_t first, std::size_t last)
+    {
+        if (m_dirty_ranges) {
+            m_dirty_ranges->mark(first, last);
+        }
     }
 
-    std::size_t size()
+    [[nodiscard]] std::size_t size() const
     {
         dummy();
-        return m_memory.size();
+        return size_of_contents();
     }
 
     void clear()
     {
         m_memory.clear();
+        m_read_only = {};
+        m_read_only_file.reset();
+        m_contents = m_memory.data();
+        m_is_read_only = false;
+        m_is_write_observed = m_memory_mapper_is_attached || m_dirty_ranges;
     }
 
     /**
@@ -49,22 +142,16 @@ public:
      */
     EmulatorMemory<A, D> slice(std::size_t from, std::size_t to)
     {
-        std::vector<D> data;
-
-        for (std::size_t i = from; i < to; ++i) {
-            data.push_back(m_memory[i]);
-        }
-
         EmulatorMemory sliced_memory;
-        sliced_memory.add(data);
+        sliced_memory.add(std::span<D const>(begin() + from, begin() + to));
 
         return sliced_memory;
     }
 
     void write(A address, D value)
     {
-        if (m_memory_mapper_is_attached) {
-            m_memory_mapper->write(address, value);
+        if (m_is_write_observed) {
+            observed_write(address, value);
         } else {
             direct_write(address, value);
         }
@@ -86,32 +173,78 @@ public:
 
     [[nodiscard]] D direct_read(A address) const
     {
-        return m_memory[static_cast<typename std::vector<D>::size_type>(address)];
+        return m_contents[static_cast<std::size_t>(address)];
     }
 
-    typename std::vector<D>::iterator begin()
+    /**
+     * Saves a part of the memory. Parts that never change, like ROM, can be left out.
+     *
+     * @param writer is the state to save to
+     * @param from is the index to start from
+     * @param to is the index to save until
+     */
+    void save_state(StateWriter& writer, std::size_t from, std::size_t to) const
     {
-        return m_memory.begin();
+        writer.write(begin() + from, to - from);
     }
 
-    typename std::vector<D>::iterator end()
+    /**
+     * Restores a part of the memory that was saved with save_state. Read-only memory never
+     * changes, so it's never restored.
+     *
+     * @param reader is the state to restore from
+     * @param from is the index to start from
+     * @param to is the index to restore until
+     */
+    void load_state(StateReader& reader, std::size_t from, std::size_t to)
     {
-        return m_memory.end();
+        if (m_is_read_only) {
+            return;
+        }
+
+        reader.read(m_memory.data() + from, to - from);
+        if (from < to) {
+            mark_dirty(from, to - 1);
+        }
     }
 
-    [[nodiscard]] typename std::vector<D>::const_iterator begin() const
+    [[nodiscard]] D const* begin() const
     {
-        return m_memory.begin();
+        return m_contents;
     }
 
-    [[nodiscard]] typename std::vector<D>::const_iterator end() const
+    [[nodiscard]] D const* end() const
     {
-        return m_memory.end();
+        return begin() + size_of_contents();
     }
 
 private:
     std::vector<D> m_memory;
+    std::span<D const> m_read_only;
+    std::shared_ptr<MappedFile const> m_read_only_file;
+    D const* m_contents { nullptr }; // Where reads are read from, which is either the vector or the mapped file
+    bool m_is_read_only { false };
     std::shared_ptr<MemoryMappedIo<A, D>> m_memory_mapper;
     bool m_memory_mapper_is_attached { false };
+    std::shared_ptr<DirtyRanges> m_dirty_ranges;
+    bool m_is_write_observed { false }; // Writes have to go through more than a direct write
+
+    void observed_write(A address, D value)
+    {
+        if (m_dirty_ranges) {
+            m_dirty_ranges->mark(static_cast<std::size_t>(address));
+        }
+
+        if (m_memory_mapper_is_attached) {
+            m_memory_mapper->write(address, value);
+        } else if (!m_is_read_only) {
+            direct_write(address, value);
+        }
+    }
+
+    [[nodiscard]] std::size_t size_of_contents() const
+    {
+        return m_is_read_only ? m_read_only.size() : m_memory.size();
+    }
 };
 }
@@ -0,0 +1,109 @@
+#include "mapped_file.h"
+#include "crosscutting/exceptions/rom_file_not_found_exception.h"
+#include "crosscutting/util/file_util.h"
+#include "doctest.h"
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#if !defined(__EMSCRIPTEN__) && !defined(_WIN32)
+#define EMU_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace emu::memory {
+
+using emu::exceptions::RomFileNotFoundException;
+using emu::util::file::read_file_into_vector;
+
+MappedFile::MappedFile(std::string const& path)
+{
+#ifdef EMU_HAS_MMAP
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        throw RomFileNotFoundException(path);
+    }
+
+    struct stat file_status { };
+    if (fstat(fd, &file_status) == -1) {
+        close(fd);
+        throw RomFileNotFoundException(path);
+    }
+
+    m_size = static_cast<std::size_t>(file_status.st_size);
+
+    if (m_size > 0) {
+        void* mapped = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd); // The mapping keeps the file alive
+
+        if (mapped == MAP_FAILED) {
+            throw std::runtime_error("Could not map " + path + " into memory");
+        }
+
+        m_data = static_cast<u8 const*>(mapped);
+        m_is_mapped = true;
+    } else {
+        close(fd); // Empty files can't be mapped, but there is nothing to read anyway
+    }
+#else
+    m_fallback = read_file_into_vector(path);
+    m_data = m_fallback.data();
+    m_size = m_fallback.size();
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef EMU_HAS_MMAP
+    if (m_is_mapped) {
+        munmap(const_cast<u8*>(m_data), m_size);
+    }
+#endif
+}
+
+std::span<u8 const> MappedFile::bytes() const
+{
+    return { m_data, m_size };
+}
+
+std::size_t MappedFile::size() const
+{
+    return m_size;
+}
+
+TEST_CASE("crosscutting: MappedFile")
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "emu_mapped_file_test.bin";
+    const std::vector<u8> contents = { 0x00, 0x01, 0x7f, 0x80, 0xfe, 0xff };
+
+    {
+        std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<char const*>(contents.data()), static_cast<std::streamsize>(contents.size()));
+    }
+
+    SUBCASE("should have the same bytes as the file")
+    {
+        MappedFile mapped_file(path.string());
+
+        CHECK_EQ(contents.size(), mapped_file.size());
+        CHECK_EQ(contents, std::vector<u8>(mapped_file.bytes().begin(), mapped_file.bytes().end()));
+    }
+
+    SUBCASE("should have the same bytes as when the file is read into a vector")
+    {
+        MappedFile mapped_file(path.string());
+
+        CHECK_EQ(read_file_into_vector(path.string()), std::vector<u8>(mapped_file.bytes().begin(), mapped_file.bytes().end()));
+    }
+
+    SUBCASE("should throw when the file doesn't exist")
+    {
+        CHECK_THROWS_AS(MappedFile((path.string() + ".missing")), RomFileNotFoundException);
+    }
+
+    std::filesystem::remove(path);
+}
+}
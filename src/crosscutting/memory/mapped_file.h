@@ -0,0 +1,42 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace emu::memory {
+
+/**
+ * A read-only file that is mapped into memory, so the bytes are read straight from the page cache
+ * instead of being copied into a buffer first. Pages are only read from disk when they are used,
+ * which makes the startup of emulators with large ROMs faster.
+ *
+ * Where mapping isn't available, like in the browser, the file is read into memory instead.
+ */
+class MappedFile {
+public:
+    /**
+     * @param path is the path to the file to map
+     * @throws RomFileNotFoundException if the file can't be opened
+     */
+    explicit MappedFile(std::string const& path);
+
+    ~MappedFile();
+
+    MappedFile(MappedFile const&) = delete;
+
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    [[nodiscard]] std::span<u8 const> bytes() const;
+
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    u8 const* m_data { nullptr };
+    std::size_t m_size { 0 };
+    bool m_is_mapped { false };
+    std::vector<u8> m_fallback;
+};
+}
@@ -0,0 +1,111 @@
+#include "mapped_save_file.h"
+#include "doctest.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#if !defined(__EMSCRIPTEN__) && !defined(_WIN32)
+#define EMU_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace emu::memory {
+
+MappedSaveFile::MappedSaveFile(std::string path, std::size_t size)
+    : m_path(std::move(path))
+    , m_size(size)
+{
+    if (m_size == 0) {
+        return;
+    }
+
+#ifdef EMU_HAS_MMAP
+    const int fd = open(m_path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd == -1) {
+        throw std::runtime_error("Could not open the save file " + m_path);
+    }
+
+    struct stat file_status { };
+    if (fstat(fd, &file_status) == -1
+        || (static_cast<std::size_t>(file_status.st_size) < m_size && ftruncate(fd, static_cast<off_t>(m_size)) == -1)) {
+        close(fd);
+        throw std::runtime_error("Could not resize the save file " + m_path);
+    }
+
+    void* mapped = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd); // The mapping keeps the file alive
+
+    if (mapped == MAP_FAILED) {
+        throw std::runtime_error("Could not map the save file " + m_path + " into memory");
+    }
+
+    m_data = static_cast<u8*>(mapped);
+    m_is_mapped = true;
+#else
+    m_fallback.resize(m_size, 0);
+    std::ifstream file(m_path, std::ios::in | std::ios::binary);
+    if (file.is_open()) {
+        file.read(reinterpret_cast<char*>(m_fallback.data()), static_cast<std::streamsize>(m_size));
+    }
+    m_data = m_fallback.data();
+#endif
+}
+
+MappedSaveFile::~MappedSaveFile()
+{
+#ifdef EMU_HAS_MMAP
+    if (m_is_mapped) {
+        munmap(m_data, m_size);
+    }
+#else
+    if (m_size > 0) {
+        std::ofstream file(m_path, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<char const*>(m_fallback.data()), static_cast<std::streamsize>(m_size));
+    }
+#endif
+}
+
+std::span<u8> MappedSaveFile::bytes() const
+{
+    return { m_data, m_size };
+}
+
+TEST_CASE("crosscutting: MappedSaveFile")
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "emu_mapped_save_file_test.sav";
+    std::filesystem::remove(path);
+
+    SUBCASE("should create a zero-filled file when there is none")
+    {
+        {
+            MappedSaveFile save_file(path.string(), 0x2000);
+
+            CHECK_EQ(0x2000, save_file.bytes().size());
+            CHECK(std::all_of(save_file.bytes().begin(), save_file.bytes().end(), [](u8 value) { return value == 0; }));
+        }
+
+        CHECK_EQ(0x2000, std::filesystem::file_size(path));
+    }
+
+    SUBCASE("should keep what was written for the next time the file is mapped")
+    {
+        {
+            MappedSaveFile save_file(path.string(), 0x2000);
+            save_file.bytes()[0x0000] = 0x12;
+            save_file.bytes()[0x1fff] = 0x34;
+        }
+
+        MappedSaveFile save_file(path.string(), 0x2000);
+
+        CHECK_EQ(0x12, save_file.bytes()[0x0000]);
+        CHECK_EQ(0x34, save_file.bytes()[0x1fff]);
+    }
+
+    std::filesystem::remove(path);
+}
+}
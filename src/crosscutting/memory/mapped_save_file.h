@@ -0,0 +1,42 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace emu::memory {
+
+/**
+ * A file that is mapped into memory for both reading and writing, like the battery-backed RAM of a
+ * cartridge. Writes go straight to the mapped pages, and the OS writes them back to the file, so
+ * nothing is lost if the emulator is closed without saving.
+ *
+ * Where mapping isn't available, like in the browser, the file is read into memory instead and
+ * written back when the object is destroyed.
+ */
+class MappedSaveFile {
+public:
+    /**
+     * @param path is the path to the file, which is created if it doesn't exist
+     * @param size is the size of the file, which is zero-filled if it's shorter than that
+     */
+    MappedSaveFile(std::string path, std::size_t size);
+
+    ~MappedSaveFile();
+
+    MappedSaveFile(MappedSaveFile const&) = delete;
+
+    MappedSaveFile& operator=(MappedSaveFile const&) = delete;
+
+    [[nodiscard]] std::span<u8> bytes() const;
+
+private:
+    std::string m_path;
+    u8* m_data { nullptr };
+    std::size_t m_size;
+    bool m_is_mapped { false };
+    std::vector<u8> m_fallback;
+};
+}
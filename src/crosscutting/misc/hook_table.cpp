@@ -0,0 +1,167 @@
+#include "hook_table.h"
+#include "doctest.h"
+#include <stdexcept>
+#include <utility>
+
+namespace emu::misc {
+
+void HookTable::add_hook(std::size_t address, Hook hook)
+{
+    if (address >= m_is_hooked.size()) {
+        m_is_hooked.resize(address + 1);
+    }
+
+    m_is_hooked[address] = true;
+    m_hooks.insert_or_assign(address, std::move(hook));
+}
+
+void HookTable::remove_hook(std::size_t address)
+{
+    if (address < m_is_hooked.size()) {
+        m_is_hooked[address] = false;
+    }
+
+    m_hooks.erase(address);
+}
+
+cyc HookTable::run_hook(std::size_t address)
+{
+    auto const hook = m_hooks.find(address);
+    if (hook == m_hooks.end()) {
+        throw std::invalid_argument("There is no hook at the address");
+    }
+
+    return hook->second();
+}
+
+class TestCpu {
+public:
+    u16 m_pc { 0 };
+    int m_instructions_run { 0 };
+
+    [[nodiscard]] u16 pc() const
+    {
+        return m_pc;
+    }
+
+    cyc next_instruction()
+    {
+        ++m_pc;
+        ++m_instructions_run;
+        return 4;
+    }
+};
+
+class UntimedTestCpu {
+public:
+    u16 m_pc { 0 };
+    int m_instructions_run { 0 };
+
+    [[nodiscard]] u16 pc() const
+    {
+        return m_pc;
+    }
+
+    void next_instruction()
+    {
+        ++m_pc;
+        ++m_instructions_run;
+    }
+};
+
+TEST_CASE("crosscutting: HookTable")
+{
+    SUBCASE("should run the next instruction when there is no hook at the PC")
+    {
+        HookTable hooks;
+        TestCpu cpu;
+
+        CHECK_EQ(4, hooks.next_instruction(cpu));
+        CHECK_EQ(1, cpu.m_instructions_run);
+    }
+
+    SUBCASE("should run the hook instead of the routine when the hook moves the PC")
+    {
+        HookTable hooks;
+        TestCpu cpu;
+        hooks.add_hook(0, [&]() {
+            cpu.m_pc = 0x1234;
+            return 100;
+        });
+
+        CHECK_EQ(100, hooks.next_instruction(cpu));
+        CHECK_EQ(0x1234, cpu.m_pc);
+        CHECK_EQ(0, cpu.m_instructions_run);
+    }
+
+    SUBCASE("should run the instruction after the hook when the hook leaves the PC alone")
+    {
+        HookTable hooks;
+        TestCpu cpu;
+        int hook_runs = 0;
+        hooks.add_hook(0, [&]() {
+            ++hook_runs;
+            return 10;
+        });
+
+        CHECK_EQ(14, hooks.next_instruction(cpu));
+        CHECK_EQ(1, hook_runs);
+        CHECK_EQ(1, cpu.m_instructions_run);
+    }
+
+    SUBCASE("should not run removed hooks")
+    {
+        HookTable hooks;
+        TestCpu cpu;
+        hooks.add_hook(0, []() { return 10; });
+        hooks.remove_hook(0);
+
+        CHECK_FALSE(hooks.has_hook(0));
+        CHECK_EQ(4, hooks.next_instruction(cpu));
+        CHECK_THROWS_AS(hooks.run_hook(0), std::invalid_argument);
+    }
+
+    SUBCASE("should only count the cycles of the hook when the CPU isn't timed")
+    {
+        HookTable hooks;
+        UntimedTestCpu cpu;
+        hooks.add_hook(0, []() { return 10; });
+
+        CHECK_EQ(10, hooks.next_instruction(cpu));
+        CHECK_EQ(0, hooks.next_instruction(cpu));
+        CHECK_EQ(2, cpu.m_instructions_run);
+    }
+}
+
+TEST_CASE("crosscutting: RoutineMemo")
+{
+    SUBCASE("should only compute a result once per key")
+    {
+        RoutineMemo<u32, u16> memo;
+        int computations = 0;
+        auto const compute = [&]() {
+            ++computations;
+            return static_cast<u16>(42);
+        };
+
+        CHECK_EQ(42, memo.find_or_compute(7, compute));
+        CHECK_EQ(42, memo.find_or_compute(7, compute));
+        CHECK_EQ(1, computations);
+        CHECK_EQ(1, memo.size());
+    }
+
+    SUBCASE("should allow computing other keys while computing a result")
+    {
+        RoutineMemo<u64, u64> memo;
+        std::function<u64(u64)> fibonacci = [&](u64 n) {
+            return memo.find_or_compute(n, [&]() {
+                return n < 2 ? n : fibonacci(n - 1) + fibonacci(n - 2);
+            });
+        };
+
+        CHECK_EQ(12586269025, fibonacci(50));
+        CHECK_EQ(51, memo.size());
+        CHECK_EQ(std::optional<u64>(55), memo.find(10));
+    }
+}
+}
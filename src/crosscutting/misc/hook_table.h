@@ -0,0 +1,135 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace emu::misc {
+
+/**
+ * Routines of the guest program that are run natively instead of being emulated. A hook is added
+ * at the address of a routine, and is run when the PC gets there, before the instruction at that
+ * address. It reads and changes the registers and memory through the CPU and memory it captured,
+ * and returns how many cycles the routine would have taken.
+ *
+ * A hook that moves the PC has run the routine in place of the guest, typically by returning from
+ * it. A hook that leaves the PC alone is followed by the instruction at its address, so it can also
+ * be put in front of a routine that has been patched down to a RET.
+ *
+ * Whether an address has a hook is looked up in a bit per address, because it's checked before
+ * every instruction.
+ */
+class HookTable {
+public:
+    using Hook = std::function<cyc()>;
+
+    void add_hook(std::size_t address, Hook hook);
+
+    void remove_hook(std::size_t address);
+
+    [[nodiscard]] bool has_hook(std::size_t address) const
+    {
+        return address < m_is_hooked.size() && m_is_hooked[address];
+    }
+
+    /**
+     * @param address is the address of the hook
+     * @return the cycles the hook says its routine would have taken
+     */
+    cyc run_hook(std::size_t address);
+
+    /**
+     * Runs the hook at the PC if there is one, and then the next instruction unless the hook moved
+     * the PC.
+     *
+     * @param cpu is the CPU, which has a pc() and a next_instruction() that returns the cycles, or
+     *            nothing if the CPU isn't timed
+     * @return the cycles of the hook and of the instruction
+     */
+    template<class Cpu>
+    cyc next_instruction(Cpu& cpu)
+    {
+        const auto pc = static_cast<std::size_t>(cpu.pc());
+        if (!has_hook(pc)) {
+            return run_instruction(cpu);
+        }
+
+        const cyc hook_cycles = run_hook(pc);
+        if (static_cast<std::size_t>(cpu.pc()) != pc) {
+            return hook_cycles;
+        }
+
+        return hook_cycles + run_instruction(cpu);
+    }
+
+private:
+    std::vector<bool> m_is_hooked;
+    std::unordered_map<std::size_t, Hook> m_hooks;
+
+    template<class Cpu>
+    static cyc run_instruction(Cpu& cpu)
+    {
+        if constexpr (std::is_void_v<decltype(cpu.next_instruction())>) {
+            cpu.next_instruction();
+            return 0;
+        } else {
+            return cpu.next_instruction();
+        }
+    }
+};
+
+/**
+ * Remembers the results of a routine that only depends on its arguments, so that a hook for it only
+ * has to work out each result once. The arguments are packed into the key by the hook.
+ *
+ * @tparam Key is what the arguments are packed into
+ * @tparam Result is what the routine returns, in registers or in memory
+ */
+template<class Key, class Result>
+class RoutineMemo {
+public:
+    /**
+     * @param key is the packed arguments
+     * @param compute works out the result when it's not remembered yet, and may call find_or_compute
+     *                for other keys
+     * @return the result for the arguments
+     */
+    template<class Compute>
+    Result find_or_compute(Key key, Compute compute)
+    {
+        if (auto const found = m_results.find(key); found != m_results.end()) {
+            return found->second;
+        }
+
+        Result result = compute();
+        m_results.insert_or_assign(key, result);
+        return result;
+    }
+
+    [[nodiscard]] std::optional<Result> find(Key key) const
+    {
+        if (auto const found = m_results.find(key); found != m_results.end()) {
+            return found->second;
+        }
+
+        return std::nullopt;
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return m_results.size();
+    }
+
+    void clear()
+    {
+        m_results.clear();
+    }
+
+private:
+    std::unordered_map<Key, Result> m_results;
+};
+}
@@ -0,0 +1,195 @@
+#include "input_movie.h"
+#include "crosscutting/misc/state_stream.h"
+#include "crosscutting/util/file_util.h"
+#include "doctest.h"
+#include <filesystem>
+#include <fmt/core.h>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+namespace emu::misc {
+
+using emu::util::file::read_file_into_vector;
+
+InputMovie::InputMovie()
+    : m_is_replaying(false)
+{
+}
+
+InputMovie::InputMovie(std::string const& path)
+    : m_is_replaying(true)
+{
+    const std::vector<u8> file = read_file_into_vector(path);
+    StateReader reader(file);
+
+    try {
+        if (reader.read<u32>() != s_magic) {
+            throw std::invalid_argument(fmt::format("{} is not an input movie", path));
+        }
+        if (reader.read<u32>() != s_version) {
+            throw std::invalid_argument(fmt::format("{} was recorded by an unsupported version", path));
+        }
+
+        m_input_size = reader.read<u32>();
+        m_number_of_frames = reader.read<u64>();
+        const u64 number_of_changes = reader.read<u64>();
+
+        for (u64 i = 0; i < number_of_changes; ++i) {
+            Change change { .m_frame = reader.read<u64>(), .m_input = std::vector<u8>(m_input_size) };
+            reader.read(change.m_input.data(), change.m_input.size());
+            m_changes.push_back(std::move(change));
+        }
+    } catch (std::out_of_range const&) {
+        throw std::invalid_argument(fmt::format("{} is truncated", path));
+    }
+}
+
+void InputMovie::record(std::vector<u8> const& input)
+{
+    if (m_changes.empty()) {
+        m_input_size = input.size();
+        m_changes.push_back({ .m_frame = m_frame, .m_input = input });
+    } else if (input != m_changes.back().m_input) {
+        m_changes.push_back({ .m_frame = m_frame, .m_input = input });
+    }
+
+    m_number_of_frames = ++m_frame;
+}
+
+bool InputMovie::replay(std::vector<u8>& input)
+{
+    bool is_changed = false;
+
+    if (m_next_change < m_changes.size() && m_changes[m_next_change].m_frame == m_frame) {
+        if (input.size() != m_input_size) {
+            throw std::invalid_argument(
+                fmt::format("The input movie has {} bytes of input per frame, but the machine has {}", m_input_size, input.size()));
+        }
+
+        input = m_changes[m_next_change].m_input;
+        ++m_next_change;
+        is_changed = true;
+    }
+
+    ++m_frame;
+
+    return is_changed;
+}
+
+void InputMovie::save(std::string const& path) const
+{
+    std::vector<u8> file;
+    StateWriter writer(file);
+    writer.write(s_magic);
+    writer.write(s_version);
+    writer.write(static_cast<u32>(m_input_size));
+    writer.write(m_number_of_frames);
+    writer.write(static_cast<u64>(m_changes.size()));
+    for (auto const& change : m_changes) {
+        writer.write(change.m_frame);
+        writer.write(change.m_input.data(), change.m_input.size());
+    }
+
+    std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<char const*>(file.data()), static_cast<std::streamsize>(file.size()));
+    if (!out) {
+        throw std::runtime_error(fmt::format("Unable to write the input movie to {}", path));
+    }
+}
+
+bool InputMovie::is_replaying() const
+{
+    return m_is_replaying;
+}
+
+bool InputMovie::is_finished() const
+{
+    return m_is_replaying && m_frame >= m_number_of_frames;
+}
+
+u64 InputMovie::frame() const
+{
+    return m_frame;
+}
+
+u64 InputMovie::number_of_frames() const
+{
+    return m_number_of_frames;
+}
+
+TEST_CASE("crosscutting: InputMovie")
+{
+    const std::string path = (std::filesystem::temp_directory_path() / "emu_input_movie_test.inp").string();
+
+    SUBCASE("should replay the recorded input on the same frames")
+    {
+        const std::vector<std::vector<u8>> inputs = {
+            { 0xff, 0x00 },
+            { 0xff, 0x00 },
+            { 0xfe, 0x00 },
+            { 0xfe, 0x00 },
+            { 0xfe, 0x01 },
+            { 0xff, 0x00 }
+        };
+
+        InputMovie recording;
+        for (auto const& input : inputs) {
+            recording.record(input);
+        }
+        recording.save(path);
+
+        InputMovie replay(path);
+        CHECK(replay.is_replaying());
+        CHECK_EQ(inputs.size(), replay.number_of_frames());
+
+        std::vector<u8> input = { 0x00, 0x00 };
+        for (auto const& expected : inputs) {
+            CHECK_FALSE(replay.is_finished());
+            replay.replay(input);
+            CHECK_EQ(expected, input);
+        }
+
+        CHECK(replay.is_finished());
+    }
+
+    SUBCASE("should only store the frames where the input changed")
+    {
+        InputMovie recording;
+        recording.record({ 0x01 });
+        recording.record({ 0x01 });
+        recording.record({ 0x02 });
+        recording.save(path);
+
+        InputMovie replay(path);
+        std::vector<u8> input = { 0x00 };
+        CHECK(replay.replay(input));
+        CHECK_FALSE(replay.replay(input));
+        CHECK(replay.replay(input));
+        CHECK_EQ(0x02, input[0]);
+    }
+
+    SUBCASE("should not load a file that isn't an input movie")
+    {
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << "not a movie";
+
+        CHECK_THROWS_AS(InputMovie { path }, std::invalid_argument);
+    }
+
+    SUBCASE("should not load a truncated input movie")
+    {
+        InputMovie recording;
+        recording.record({ 0x01, 0x02, 0x03 });
+        recording.record({ 0x04, 0x05, 0x06 });
+        recording.save(path);
+
+        std::vector<u8> file = read_file_into_vector(path);
+        file.pop_back();
+        std::ofstream(path, std::ios::binary | std::ios::trunc).write(reinterpret_cast<char const*>(file.data()), static_cast<std::streamsize>(file.size()));
+
+        CHECK_THROWS_AS(InputMovie { path }, std::invalid_argument);
+    }
+
+    std::filesystem::remove(path);
+}
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace emu::misc {
+
+/**
+ * A recording of the input to a machine, which can be replayed to run the exact same session
+ * again.
+ *
+ * The input is whatever the input devices feed the machine (input ports, keyboard rows, ...),
+ * serialized into a few bytes. It is sampled once per emulated frame, but only the frames where it
+ * changed are stored, together with the number of the frame.
+ */
+class InputMovie {
+public:
+    /**
+     * Creates an empty movie to record into.
+     */
+    InputMovie();
+
+    /**
+     * Loads a recorded movie to replay.
+     *
+     * @param path is the path of the movie file
+     */
+    explicit InputMovie(std::string const& path);
+
+    /**
+     * Records the input of the next frame.
+     *
+     * @param input is the input the machine has in this frame
+     */
+    void record(std::vector<u8> const& input);
+
+    /**
+     * Replays the input of the next frame.
+     *
+     * @param input is the input the machine has now, and is set to the recorded input if it changed in this frame
+     * @return true if the input changed in this frame, false otherwise
+     */
+    bool replay(std::vector<u8>& input);
+
+    void save(std::string const& path) const;
+
+    [[nodiscard]] bool is_replaying() const;
+
+    [[nodiscard]] bool is_finished() const;
+
+    [[nodiscard]] u64 frame() const;
+
+    [[nodiscard]] u64 number_of_frames() const;
+
+private:
+    struct Change {
+        u64 m_frame;
+        std::vector<u8> m_input;
+    };
+
+    static constexpr u32 s_magic = 0x564f4d49; // "IMOV" when read as little-endian bytes
+    static constexpr u32 s_version = 1;
+
+    bool m_is_replaying;
+    u64 m_frame { 0 };
+    u64 m_number_of_frames { 0 };
+    std::size_t m_input_size { 0 };
+    std::size_t m_next_change { 0 };
+    std::vector<Change> m_changes;
+};
+}
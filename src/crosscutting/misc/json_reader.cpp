@@ -0,0 +1,427 @@
+#include "json_reader.h"
+#include "doctest.h"
+#include <charconv>
+#include <fmt/core.h>
+#include <sstream>
+#include <stdexcept>
+#include <system_error>
+
+namespace emu::misc {
+
+JsonReader::JsonReader(std::istream& stream)
+    : m_stream(stream)
+    , m_buffer(s_buffer_size)
+{
+}
+
+JsonToken JsonReader::next()
+{
+    skip_whitespace();
+    int c = peek();
+
+    if (c == ']' || c == '}') {
+        get();
+        return end_container(static_cast<char>(c));
+    }
+
+    if (c == s_end_of_stream && !m_containers.empty()) {
+        fail("Unexpected end of the document");
+    }
+
+    if (m_has_value) {
+        if (m_containers.empty()) {
+            if (c != s_end_of_stream) {
+                fail("Expected the end of the document");
+            }
+            return JsonToken::End;
+        } else if (c != ',') {
+            fail("Expected , or the end of an array or object");
+        }
+
+        get();
+        skip_whitespace();
+        c = peek();
+        m_has_value = false;
+        m_has_comma = true;
+    }
+
+    if (c == s_end_of_stream) {
+        fail("Unexpected end of the document");
+    }
+
+    if (!m_containers.empty() && m_containers.back() == '{' && !m_has_key) {
+        if (c != '"') {
+            fail("Expected a key");
+        }
+        read_string();
+        skip_whitespace();
+        if (get() != ':') {
+            fail("Expected : after the key");
+        }
+        m_has_key = true;
+        m_has_comma = false;
+        return JsonToken::Key;
+    }
+
+    m_has_key = false;
+    m_has_comma = false;
+
+    switch (c) {
+    case '[':
+    case '{':
+        get();
+        m_containers.push_back(static_cast<char>(c));
+        return c == '[' ? JsonToken::BeginArray : JsonToken::BeginObject;
+    case '"':
+        read_string();
+        m_has_value = true;
+        return JsonToken::String;
+    case 't':
+        read_literal("true");
+        m_has_value = true;
+        return JsonToken::True;
+    case 'f':
+        read_literal("false");
+        m_has_value = true;
+        return JsonToken::False;
+    case 'n':
+        read_literal("null");
+        m_has_value = true;
+        return JsonToken::Null;
+    default:
+        if (c == '-' || (c >= '0' && c <= '9')) {
+            read_number();
+            m_has_value = true;
+            return JsonToken::Number;
+        }
+        fail(fmt::format("Unexpected character: {}", static_cast<char>(c)));
+    }
+}
+
+void JsonReader::skip(JsonToken token)
+{
+    if (token != JsonToken::BeginArray && token != JsonToken::BeginObject) {
+        return;
+    }
+
+    for (std::size_t depth = 1; depth > 0;) {
+        switch (next()) {
+        case JsonToken::BeginArray:
+        case JsonToken::BeginObject:
+            ++depth;
+            break;
+        case JsonToken::EndArray:
+        case JsonToken::EndObject:
+            --depth;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+std::string const& JsonReader::text() const
+{
+    return m_text;
+}
+
+i64 JsonReader::integer() const
+{
+    i64 value = 0;
+    auto const [end, error] = std::from_chars(m_text.data(), m_text.data() + m_text.size(), value);
+    if (error != std::errc() || end != m_text.data() + m_text.size()) {
+        fail(fmt::format("Expected an integer, but got {}", m_text));
+    }
+
+    return value;
+}
+
+double JsonReader::number() const
+{
+    double value = 0;
+    auto const [end, error] = std::from_chars(m_text.data(), m_text.data() + m_text.size(), value);
+    if (error != std::errc() || end != m_text.data() + m_text.size()) {
+        fail(fmt::format("Expected a number, but got {}", m_text));
+    }
+
+    return value;
+}
+
+int JsonReader::peek()
+{
+    if (m_position == m_size) {
+        m_offset += m_size;
+        m_stream.read(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_size = static_cast<std::size_t>(m_stream.gcount());
+        m_position = 0;
+
+        if (m_size == 0) {
+            return s_end_of_stream;
+        }
+    }
+
+    return static_cast<unsigned char>(m_buffer[m_position]);
+}
+
+int JsonReader::get()
+{
+    const int c = peek();
+    if (c != s_end_of_stream) {
+        ++m_position;
+    }
+
+    return c;
+}
+
+void JsonReader::skip_whitespace()
+{
+    for (int c = peek(); c == ' ' || c == '\n' || c == '\r' || c == '\t'; c = peek()) {
+        get();
+    }
+}
+
+JsonToken JsonReader::end_container(char bracket)
+{
+    const char opening = bracket == ']' ? '[' : '{';
+    if (m_containers.empty() || m_containers.back() != opening) {
+        fail(fmt::format("Unexpected {}", bracket));
+    } else if (m_has_comma || m_has_key) {
+        fail(fmt::format("Expected a value before {}", bracket));
+    }
+
+    m_containers.pop_back();
+    m_has_value = true;
+
+    return bracket == ']' ? JsonToken::EndArray : JsonToken::EndObject;
+}
+
+void JsonReader::read_string()
+{
+    get(); // The opening quote
+    m_text.clear();
+
+    while (true) {
+        const int c = get();
+        if (c == s_end_of_stream) {
+            fail("Unexpected end of the document in a string");
+        } else if (c == '"') {
+            return;
+        } else if (c != '\\') {
+            m_text += static_cast<char>(c);
+            continue;
+        }
+
+        switch (const int escaped = get()) {
+        case '"':
+        case '\\':
+        case '/':
+            m_text += static_cast<char>(escaped);
+            break;
+        case 'b':
+            m_text += '\b';
+            break;
+        case 'f':
+            m_text += '\f';
+            break;
+        case 'n':
+            m_text += '\n';
+            break;
+        case 'r':
+            m_text += '\r';
+            break;
+        case 't':
+            m_text += '\t';
+            break;
+        case 'u': {
+            u32 code_point = read_hex_digits();
+            if (code_point >= 0xd800 && code_point <= 0xdbff) {
+                if (get() != '\\' || get() != 'u') {
+                    fail("Expected the second half of a surrogate pair");
+                }
+                code_point = 0x10000 + ((code_point - 0xd800) << 10) + (read_hex_digits() - 0xdc00);
+            }
+            append_code_point(code_point);
+            break;
+        }
+        default:
+            fail("Unknown escape in a string");
+        }
+    }
+}
+
+void JsonReader::read_number()
+{
+    m_text.clear();
+
+    for (int c = peek(); c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E' || (c >= '0' && c <= '9'); c = peek()) {
+        m_text += static_cast<char>(get());
+    }
+}
+
+void JsonReader::read_literal(std::string const& literal)
+{
+    for (char expected : literal) {
+        if (get() != expected) {
+            fail(fmt::format("Expected {}", literal));
+        }
+    }
+}
+
+void JsonReader::append_code_point(u32 code_point)
+{
+    if (code_point < 0x80) {
+        m_text += static_cast<char>(code_point);
+    } else if (code_point < 0x800) {
+        m_text += static_cast<char>(0xc0 | (code_point >> 6));
+        m_text += static_cast<char>(0x80 | (code_point & 0x3f));
+    } else if (code_point < 0x10000) {
+        m_text += static_cast<char>(0xe0 | (code_point >> 12));
+        m_text += static_cast<char>(0x80 | ((code_point >> 6) & 0x3f));
+        m_text += static_cast<char>(0x80 | (code_point & 0x3f));
+    } else {
+        m_text += static_cast<char>(0xf0 | (code_point >> 18));
+        m_text += static_cast<char>(0x80 | ((code_point >> 12) & 0x3f));
+        m_text += static_cast<char>(0x80 | ((code_point >> 6) & 0x3f));
+        m_text += static_cast<char>(0x80 | (code_point & 0x3f));
+    }
+}
+
+u32 JsonReader::read_hex_digits()
+{
+    u32 value = 0;
+    for (int i = 0; i < 4; ++i) {
+        const int c = get();
+        value <<= 4;
+        if (c >= '0' && c <= '9') {
+            value |= static_cast<u32>(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            value |= static_cast<u32>(c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+            value |= static_cast<u32>(c - 'A' + 10);
+        } else {
+            fail("Expected four hex digits after \\u");
+        }
+    }
+
+    return value;
+}
+
+void JsonReader::fail(std::string const& reason) const
+{
+    throw std::runtime_error(fmt::format("{} at byte {} of the JSON", reason, m_offset + m_position));
+}
+
+TEST_CASE("crosscutting: JsonReader")
+{
+    SUBCASE("should read every kind of token")
+    {
+        std::istringstream stream(R"( {"a": [1, -2.5e3, "x"], "b": {}, "c": [true, false, null]} )");
+        JsonReader reader(stream);
+
+        CHECK_EQ(JsonToken::BeginObject, reader.next());
+        CHECK_EQ(JsonToken::Key, reader.next());
+        CHECK_EQ("a", reader.text());
+        CHECK_EQ(JsonToken::BeginArray, reader.next());
+        CHECK_EQ(JsonToken::Number, reader.next());
+        CHECK_EQ(1, reader.integer());
+        CHECK_EQ(JsonToken::Number, reader.next());
+        CHECK_EQ("-2.5e3", reader.text());
+        CHECK_EQ(JsonToken::String, reader.next());
+        CHECK_EQ("x", reader.text());
+        CHECK_EQ(JsonToken::EndArray, reader.next());
+        CHECK_EQ(JsonToken::Key, reader.next());
+        CHECK_EQ("b", reader.text());
+        CHECK_EQ(JsonToken::BeginObject, reader.next());
+        CHECK_EQ(JsonToken::EndObject, reader.next());
+        CHECK_EQ(JsonToken::Key, reader.next());
+        CHECK_EQ(JsonToken::BeginArray, reader.next());
+        CHECK_EQ(JsonToken::True, reader.next());
+        CHECK_EQ(JsonToken::False, reader.next());
+        CHECK_EQ(JsonToken::Null, reader.next());
+        CHECK_EQ(JsonToken::EndArray, reader.next());
+        CHECK_EQ(JsonToken::EndObject, reader.next());
+        CHECK_EQ(JsonToken::End, reader.next());
+    }
+
+    SUBCASE("should resolve the escapes of strings")
+    {
+        std::istringstream stream(R"(["a\"b\\c\/\n", "æ😀"])");
+        JsonReader reader(stream);
+
+        reader.next();
+        reader.next();
+        CHECK_EQ("a\"b\\c/\n", reader.text());
+        reader.next();
+        CHECK_EQ("\xc3\xa6\xf0\x9f\x98\x80", reader.text());
+    }
+
+    SUBCASE("should skip whole arrays and objects")
+    {
+        std::istringstream stream(R"([{"a": [[1], {"b": 2}]}, 3])");
+        JsonReader reader(stream);
+
+        reader.next();
+        reader.skip(reader.next());
+        CHECK_EQ(JsonToken::Number, reader.next());
+        CHECK_EQ(3, reader.integer());
+        CHECK_EQ(JsonToken::EndArray, reader.next());
+    }
+
+    SUBCASE("should read documents that are larger than the buffer")
+    {
+        std::string document = "[";
+        for (int i = 0; i < 100000; ++i) {
+            document += (i == 0 ? "" : ",") + std::to_string(i);
+        }
+        document += "]";
+        std::istringstream stream(document);
+        JsonReader reader(stream);
+
+        reader.next();
+        i64 sum = 0;
+        for (JsonToken token = reader.next(); token == JsonToken::Number; token = reader.next()) {
+            sum += reader.integer();
+        }
+        CHECK_EQ(4999950000, sum);
+    }
+
+    SUBCASE("should throw on malformed JSON")
+    {
+        for (char const* malformed : { "[1 2]", "[1,]", "{\"a\" 1}", "{1: 2}", "[1}", "]", "[tru]", "\"a", "[" }) {
+            std::istringstream stream(malformed);
+            JsonReader reader(stream);
+
+            CHECK_THROWS_AS(
+                [&]() {
+                    while (reader.next() != JsonToken::End) {
+                    }
+                }(),
+                std::runtime_error);
+        }
+    }
+
+    SUBCASE("should throw when the number is not an integer")
+    {
+        std::istringstream stream("[1.5]");
+        JsonReader reader(stream);
+
+        reader.next();
+        reader.next();
+        CHECK_THROWS_AS((void)reader.integer(), std::runtime_error);
+    }
+
+    SUBCASE("should read numbers with a fraction and an exponent")
+    {
+        std::istringstream stream("[1.5, -2e3, 7]");
+        JsonReader reader(stream);
+
+        reader.next();
+        reader.next();
+        CHECK_EQ(1.5, reader.number());
+        reader.next();
+        CHECK_EQ(-2000.0, reader.number());
+        reader.next();
+        CHECK_EQ(7.0, reader.number());
+    }
+}
+}
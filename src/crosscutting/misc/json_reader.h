@@ -0,0 +1,96 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace emu::misc {
+
+enum class JsonToken {
+    BeginArray,
+    EndArray,
+    BeginObject,
+    EndObject,
+    Key,
+    String,
+    Number,
+    True,
+    False,
+    Null,
+    End
+};
+
+/**
+ * Reads JSON one token at a time, straight from a stream, so that a document never has to be in
+ * memory all at once. Only a small buffer and the nesting of the arrays and objects are kept, which
+ * makes it possible to read files that are larger than the memory.
+ */
+class JsonReader {
+public:
+    explicit JsonReader(std::istream& stream);
+
+    /**
+     * @return the next token, or End when the document has been read
+     */
+    JsonToken next();
+
+    /**
+     * Skips the rest of a value, which is the whole array or object if the token begins one.
+     *
+     * @param token is the token that was returned for the first part of the value
+     */
+    void skip(JsonToken token);
+
+    /**
+     * @return the key, string or number that was read last, with the escapes of strings resolved
+     */
+    [[nodiscard]] std::string const& text() const;
+
+    /**
+     * @return the number that was read last, which has to be an integer
+     */
+    [[nodiscard]] i64 integer() const;
+
+    /**
+     * @return the number that was read last, which can have a fraction and an exponent
+     */
+    [[nodiscard]] double number() const;
+
+private:
+    static constexpr std::size_t s_buffer_size = 1 << 16;
+    static constexpr int s_end_of_stream = -1;
+
+    std::istream& m_stream;
+    std::vector<char> m_buffer;
+    std::size_t m_position { 0 };
+    std::size_t m_size { 0 };
+    std::size_t m_offset { 0 };     // How far into the stream the buffer begins
+    std::vector<char> m_containers; // The brackets of the arrays and objects that are open
+    bool m_has_value { false };     // If a value has been read since the last comma or bracket
+    bool m_has_comma { false };     // If a comma has been read since the last value
+    bool m_has_key { false };       // If a key has been read since the last value in an object
+    std::string m_text;
+
+    int peek();
+
+    int get();
+
+    void skip_whitespace();
+
+    JsonToken end_container(char bracket);
+
+    void read_string();
+
+    void read_number();
+
+    void read_literal(std::string const& literal);
+
+    void append_code_point(u32 code_point);
+
+    u32 read_hex_digits();
+
+    [[noreturn]] void fail(std::string const& reason) const;
+};
+}
@@ -0,0 +1,103 @@
+#include "port_decoder.h"
+#include "doctest.h"
+
+namespace emu::misc {
+
+void PortCapture::capture(u8 port, u8 value)
+{
+    if (m_frame_of_values[port] != m_frame) {
+        m_frame_of_values[port] = m_frame;
+        m_values[port] = value;
+    } else {
+        m_values[port] |= value;
+    }
+}
+
+void PortCapture::clear()
+{
+    if (++m_frame == 0) { // Wrapped around, so old frame numbers could be taken for the current one
+        m_frame_of_values.fill(0);
+        m_frame = 1;
+    }
+}
+
+bool PortCapture::contains(u8 port) const
+{
+    return m_frame_of_values[port] == m_frame;
+}
+
+u8 PortCapture::operator[](u8 port) const
+{
+    return contains(port) ? m_values[port] : 0;
+}
+
+enum class TestDevice {
+    None,
+    Ula,
+    SoundChipRegister,
+    SoundChipData
+};
+
+TEST_CASE("crosscutting: PortDecoder")
+{
+    PortDecoder<TestDevice> decoder(TestDevice::None);
+    decoder.add(TestDevice::Ula, 0x0001, 0x0000);
+    decoder.add(TestDevice::SoundChipRegister, 0xc002, 0xc000);
+    decoder.add(TestDevice::SoundChipData, 0xc002, 0x8000);
+
+    SUBCASE("should decode only the address lines in the mask")
+    {
+        CHECK_EQ(TestDevice::Ula, decoder.decode(0xfefe));
+        CHECK_EQ(TestDevice::Ula, decoder.decode(0x0010));
+        CHECK_EQ(TestDevice::SoundChipRegister, decoder.decode(0xfffd));
+        CHECK_EQ(TestDevice::SoundChipRegister, decoder.decode(0xc001));
+        CHECK_EQ(TestDevice::SoundChipData, decoder.decode(0xbffd));
+    }
+
+    SUBCASE("should decode the ports no device answers as unmapped")
+    {
+        CHECK_EQ(TestDevice::None, decoder.decode(0x7ffd));
+        CHECK_EQ(TestDevice::None, decoder.decode(0xffff));
+    }
+
+    SUBCASE("should let the device added first answer when several match")
+    {
+        CHECK_EQ(TestDevice::Ula, decoder.decode(0xfffc));
+    }
+
+    SUBCASE("should not take more than 16 devices")
+    {
+        for (int i = 0; i < 13; ++i) {
+            decoder.add(TestDevice::Ula, 0x00ff, 0x0000);
+        }
+
+        CHECK_THROWS_AS(decoder.add(TestDevice::Ula, 0x00ff, 0x0000), std::invalid_argument);
+    }
+}
+
+TEST_CASE("crosscutting: PortCapture")
+{
+    PortCapture capture;
+
+    SUBCASE("should OR together the values written to a port")
+    {
+        capture.capture(0xfe, 0x01);
+        capture.capture(0xfe, 0x10);
+
+        CHECK(capture.contains(0xfe));
+        CHECK_EQ(0x11, capture[0xfe]);
+        CHECK_FALSE(capture.contains(0xfd));
+    }
+
+    SUBCASE("should forget the values when cleared")
+    {
+        capture.capture(0xfe, 0x01);
+        capture.clear();
+        capture.capture(0xfe, 0x10);
+
+        CHECK_EQ(0x10, capture[0xfe]);
+        capture.clear();
+        CHECK_FALSE(capture.contains(0xfe));
+    }
+}
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace emu::misc {
+
+/**
+ * Finds the device that answers an IN or an OUT. Most machines only look at some of the address
+ * lines of a port, so a device is added with a mask of the lines it looks at and what they have to
+ * be, and it answers every port that matches.
+ *
+ * The devices that can answer are looked up in a table indexed by the low byte of the port, so only
+ * the devices that also look at the high byte have their mask checked when the port is used. When
+ * several devices match a port, the one added first answers.
+ *
+ * @tparam Device is what the machine calls its devices, typically an enum
+ */
+template<class Device>
+class PortDecoder {
+public:
+    /**
+     * @param unmapped is what is decoded for the ports no device answers
+     */
+    explicit PortDecoder(Device unmapped)
+        : m_unmapped(unmapped)
+    {
+    }
+
+    /**
+     * @param device is the device that answers the ports
+     * @param mask is the address lines the device looks at
+     * @param value is what the address lines have to be
+     * @throws std::invalid_argument if there are too many devices already
+     */
+    void add(Device device, u16 mask, u16 value)
+    {
+        if (m_devices.size() == s_max_devices) {
+            throw std::invalid_argument("A port decoder cannot have more than 16 devices");
+        }
+
+        const auto slot = static_cast<unsigned int>(m_devices.size());
+        m_devices.push_back({ device, mask, static_cast<u16>(value & mask) });
+
+        for (std::size_t low_byte = 0; low_byte < m_candidates.size(); ++low_byte) {
+            if ((low_byte & mask & 0xff) == (value & mask & 0xff)) {
+                m_candidates[low_byte] |= static_cast<u16>(1u << slot);
+            }
+        }
+    }
+
+    [[nodiscard]] Device decode(u16 port) const
+    {
+        for (u16 candidates = m_candidates[port & 0xff]; candidates != 0; candidates &= static_cast<u16>(candidates - 1)) {
+            Slot const& slot = m_devices[static_cast<std::size_t>(std::countr_zero(candidates))];
+            if ((port & slot.m_mask) == slot.m_value) {
+                return slot.m_device;
+            }
+        }
+
+        return m_unmapped;
+    }
+
+private:
+    static constexpr std::size_t s_max_devices = 16;
+
+    struct Slot {
+        Device m_device;
+        u16 m_mask;
+        u16 m_value;
+    };
+
+    Device m_unmapped;
+    std::vector<Slot> m_devices;
+    std::array<u16, 256> m_candidates {}; // A bit per device that can answer ports with the low byte
+};
+
+/**
+ * The values written to each port during a frame, for the debugger. Writes to the same port are
+ * OR-ed together. Clearing doesn't touch the values, since the ports that have been written to in
+ * the current frame are the ones marked with the current frame number.
+ */
+class PortCapture {
+public:
+    void capture(u8 port, u8 value);
+
+    void clear();
+
+    [[nodiscard]] bool contains(u8 port) const;
+
+    /**
+     * @param port is a port that has been written to in the current frame
+     * @return the values written to the port, OR-ed together
+     */
+    [[nodiscard]] u8 operator[](u8 port) const;
+
+private:
+    std::array<u8, 256> m_values {};
+    std::array<u32, 256> m_frame_of_values {};
+    u32 m_frame { 1 };
+};
+}
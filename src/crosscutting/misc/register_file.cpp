@@ -0,0 +1,72 @@
+#include "register_file.h"
+#include "doctest.h"
+#include <cstring>
+#include <type_traits>
+
+namespace emu::misc {
+
+class FlagsForTest {
+public:
+    void reset()
+    {
+        m_value = 0;
+    }
+
+    u8 m_value { 0xff };
+};
+
+enum class RegisterPairForTest {
+    BC = 0,
+    DE = 1,
+    HL = 2
+};
+
+using RegisterFileForTest = RegisterFile<FlagsForTest, RegisterPairForTest>;
+
+static_assert(std::is_trivially_copyable_v<RegisterFileForTest>, "The registers have to be copyable as one block of memory");
+
+TEST_CASE("crosscutting: RegisterFile")
+{
+    SUBCASE("should start with every register cleared")
+    {
+        const RegisterFileForTest registers;
+
+        CHECK_EQ(0, registers.a());
+        CHECK_EQ(0, registers.f().m_value);
+        CHECK_EQ(0, registers.bc());
+        CHECK_EQ(0, registers.de());
+        CHECK_EQ(0, registers.hl());
+    }
+
+    SUBCASE("should see the same value in a pair and in its two registers")
+    {
+        RegisterFileForTest registers;
+
+        registers.set_pair(RegisterPairForTest::BC, 0x1234);
+        registers.d() = 0x56;
+        registers.e() = 0x78;
+        registers.set_pair(RegisterPairForTest::HL, 0x9abc);
+
+        CHECK_EQ(0x12, registers.b());
+        CHECK_EQ(0x34, registers.c());
+        CHECK_EQ(0x5678, registers.de());
+        CHECK_EQ(0x9a, registers.h());
+        CHECK_EQ(0xbc, registers.l());
+    }
+
+    SUBCASE("should be restored from a copy of its memory")
+    {
+        RegisterFileForTest registers;
+        registers.a() = 0x42;
+        registers.set_pair(RegisterPairForTest::DE, 0xbeef);
+
+        RegisterFileForTest snapshot;
+        std::memcpy(&snapshot, &registers, sizeof(RegisterFileForTest));
+        registers.reset();
+
+        CHECK_EQ(0x42, snapshot.a());
+        CHECK_EQ(0xbeef, snapshot.de());
+        CHECK_EQ(0, registers.de());
+    }
+}
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <array>
+#include <cstddef>
+
+namespace emu::misc {
+
+/**
+ * The general purpose registers of an 8-bit CPU with the register pairs BC, DE and HL, packed next
+ * to each other. Each pair is stored with its low byte first, so that the compiler can read or write
+ * it as one 16-bit value on little-endian machines. Everything is in one trivially copyable object,
+ * so a snapshot of the registers is a plain copy.
+ *
+ * @tparam Flags is the flag register of the CPU, which has a reset()
+ * @tparam RegisterPair is the CPU's enum of its register pairs, where BC is 0, DE is 1 and HL is 2
+ */
+template<class Flags, class RegisterPair>
+class RegisterFile {
+public:
+    RegisterFile()
+    {
+        reset();
+    }
+
+    u8& a()
+    {
+        return m_acc;
+    }
+
+    u8& b()
+    {
+        return m_pairs[s_b];
+    }
+
+    u8& c()
+    {
+        return m_pairs[s_c];
+    }
+
+    u8& d()
+    {
+        return m_pairs[s_d];
+    }
+
+    u8& e()
+    {
+        return m_pairs[s_e];
+    }
+
+    u8& h()
+    {
+        return m_pairs[s_h];
+    }
+
+    u8& l()
+    {
+        return m_pairs[s_l];
+    }
+
+    Flags& f()
+    {
+        return m_flags;
+    }
+
+    [[nodiscard]] u8 a() const
+    {
+        return m_acc;
+    }
+
+    [[nodiscard]] u8 b() const
+    {
+        return m_pairs[s_b];
+    }
+
+    [[nodiscard]] u8 c() const
+    {
+        return m_pairs[s_c];
+    }
+
+    [[nodiscard]] u8 d() const
+    {
+        return m_pairs[s_d];
+    }
+
+    [[nodiscard]] u8 e() const
+    {
+        return m_pairs[s_e];
+    }
+
+    [[nodiscard]] u8 h() const
+    {
+        return m_pairs[s_h];
+    }
+
+    [[nodiscard]] u8 l() const
+    {
+        return m_pairs[s_l];
+    }
+
+    [[nodiscard]] Flags const& f() const
+    {
+        return m_flags;
+    }
+
+    [[nodiscard]] u16 pair(RegisterPair pair) const
+    {
+        const std::size_t low = low_byte_index(pair);
+        return static_cast<u16>(m_pairs[low] | (m_pairs[low + 1] << 8));
+    }
+
+    void set_pair(RegisterPair pair, u16 value)
+    {
+        const std::size_t low = low_byte_index(pair);
+        m_pairs[low] = static_cast<u8>(value);
+        m_pairs[low + 1] = static_cast<u8>(value >> 8);
+    }
+
+    [[nodiscard]] u16 bc() const
+    {
+        return pair(RegisterPair::BC);
+    }
+
+    [[nodiscard]] u16 de() const
+    {
+        return pair(RegisterPair::DE);
+    }
+
+    [[nodiscard]] u16 hl() const
+    {
+        return pair(RegisterPair::HL);
+    }
+
+    void reset()
+    {
+        m_pairs.fill(0);
+        m_acc = 0;
+        m_flags.reset();
+    }
+
+private:
+    static constexpr std::size_t s_c = 0;
+    static constexpr std::size_t s_b = 1;
+    static constexpr std::size_t s_e = 2;
+    static constexpr std::size_t s_d = 3;
+    static constexpr std::size_t s_l = 4;
+    static constexpr std::size_t s_h = 5;
+
+    std::array<u8, 6> m_pairs;
+    u8 m_acc;
+    Flags m_flags;
+
+    static std::size_t low_byte_index(RegisterPair pair)
+    {
+        return 2 * static_cast<std::size_t>(pair);
+    }
+};
+}
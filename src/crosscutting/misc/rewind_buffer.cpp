@@ -0,0 +1,305 @@
+#include "rewind_buffer.h"
+#include "doctest.h"
+#include <algorithm>
+#include <utility>
+
+namespace emu::misc {
+
+RewindBuffer::RewindBuffer(std::size_t memory_cap, std::size_t keyframe_interval)
+    : m_memory_cap(memory_cap)
+    , m_keyframe_interval(std::max(keyframe_interval, static_cast<std::size_t>(1)))
+{
+}
+
+void RewindBuffer::push(std::vector<u8> const& state)
+{
+    if (m_groups.empty()
+        || state.size() != m_keyframe.size()
+        || m_groups.back().m_deltas.size() + 1 >= m_keyframe_interval) {
+        start_group(state);
+    } else {
+        std::vector<u8> delta;
+        encode(state, m_keyframe, delta);
+        m_memory_usage += delta.size();
+        m_groups.back().m_deltas.push_back(std::move(delta));
+    }
+
+    ++m_number_of_frames;
+
+    evict_oldest_groups();
+}
+
+bool RewindBuffer::pop(std::vector<u8>& state)
+{
+    if (m_groups.empty()) {
+        return false;
+    }
+
+    Group& newest = m_groups.back();
+
+    if (!newest.m_deltas.empty()) {
+        state = m_keyframe;
+        decode(newest.m_deltas.back(), state);
+        m_memory_usage -= newest.m_deltas.back().size();
+        newest.m_deltas.pop_back();
+    } else {
+        state = m_keyframe;
+        m_memory_usage -= newest.m_keyframe.size();
+        m_groups.pop_back();
+
+        if (m_groups.empty()) {
+            m_keyframe.clear();
+        } else {
+            m_keyframe.assign(m_groups.back().m_state_size, 0);
+            decode(m_groups.back().m_keyframe, m_keyframe);
+        }
+    }
+
+    --m_number_of_frames;
+
+    return true;
+}
+
+void RewindBuffer::clear()
+{
+    m_groups.clear();
+    m_keyframe.clear();
+    m_memory_usage = 0;
+    m_number_of_frames = 0;
+}
+
+bool RewindBuffer::is_empty() const
+{
+    return m_groups.empty();
+}
+
+std::size_t RewindBuffer::number_of_frames() const
+{
+    return m_number_of_frames;
+}
+
+std::size_t RewindBuffer::memory_usage() const
+{
+    return m_memory_usage;
+}
+
+void RewindBuffer::start_group(std::vector<u8> const& state)
+{
+    m_scratch.assign(state.size(), 0);
+
+    Group group;
+    group.m_state_size = state.size();
+    encode(state, m_scratch, group.m_keyframe);
+    m_memory_usage += group.m_keyframe.size();
+    m_groups.push_back(std::move(group));
+
+    m_keyframe = state;
+}
+
+void RewindBuffer::evict_oldest_groups()
+{
+    while (m_memory_usage > m_memory_cap && m_groups.size() > 1) {
+        m_memory_usage -= group_size(m_groups.front());
+        m_number_of_frames -= 1 + m_groups.front().m_deltas.size();
+        m_groups.pop_front();
+    }
+}
+
+std::size_t RewindBuffer::group_size(Group const& group)
+{
+    std::size_t size = group.m_keyframe.size();
+    for (auto const& delta : group.m_deltas) {
+        size += delta.size();
+    }
+
+    return size;
+}
+
+static void write_length(std::vector<u8>& encoded, std::size_t length)
+{
+    while (length >= 0x80) {
+        encoded.push_back(static_cast<u8>(length | 0x80));
+        length >>= 7;
+    }
+    encoded.push_back(static_cast<u8>(length));
+}
+
+static std::size_t read_length(std::vector<u8> const& encoded, std::size_t& position)
+{
+    std::size_t length = 0;
+    unsigned int shift = 0;
+    u8 byte;
+
+    do {
+        byte = encoded[position++];
+        length |= static_cast<std::size_t>(byte & 0x7f) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+
+    return length;
+}
+
+/**
+ * Encodes state XOR base as a sequence of (number of zeros, number of literals, literals). Only
+ * runs of at least a few zeros end a literal run, as shorter runs cost more to encode than to
+ * store as literals.
+ */
+void RewindBuffer::encode(std::vector<u8> const& state, std::vector<u8> const& base, std::vector<u8>& encoded)
+{
+    static constexpr std::size_t min_zero_run = 4;
+
+    encoded.clear();
+
+    const std::size_t size = state.size();
+    std::size_t i = 0;
+
+    while (i < size) {
+        const std::size_t zeros_start = i;
+        while (i < size && state[i] == base[i]) {
+            ++i;
+        }
+        const std::size_t zeros = i - zeros_start;
+
+        const std::size_t literals_start = i;
+        std::size_t literals_end = i;
+        std::size_t unchanged_in_a_row = 0;
+        while (i < size && unchanged_in_a_row < min_zero_run) {
+            if (state[i] == base[i]) {
+                ++unchanged_in_a_row;
+            } else {
+                unchanged_in_a_row = 0;
+                literals_end = i + 1;
+            }
+            ++i;
+        }
+        i = literals_end;
+
+        write_length(encoded, zeros);
+        write_length(encoded, literals_end - literals_start);
+        for (std::size_t j = literals_start; j < literals_end; ++j) {
+            encoded.push_back(state[j] ^ base[j]);
+        }
+    }
+
+    encoded.shrink_to_fit();
+}
+
+void RewindBuffer::decode(std::vector<u8> const& encoded, std::vector<u8>& target)
+{
+    std::size_t position = 0;
+    std::size_t i = 0;
+
+    while (position < encoded.size()) {
+        i += read_length(encoded, position);
+
+        const std::size_t literals = read_length(encoded, position);
+        for (std::size_t j = 0; j < literals; ++j) {
+            target[i++] ^= encoded[position++];
+        }
+    }
+}
+
+TEST_CASE("crosscutting: RewindBuffer")
+{
+    SUBCASE("should pop states in the reverse order of pushing")
+    {
+        RewindBuffer buffer(1024 * 1024, 4);
+
+        std::vector<std::vector<u8>> states;
+        for (u8 frame = 0; frame < 10; ++frame) {
+            std::vector<u8> state(256, 0xaa);
+            state[frame] = frame;
+            state[100 + frame] = static_cast<u8>(frame * 3);
+            states.push_back(state);
+            buffer.push(state);
+        }
+
+        CHECK_EQ(10, buffer.number_of_frames());
+
+        std::vector<u8> popped;
+        for (auto it = states.rbegin(); it != states.rend(); ++it) {
+            REQUIRE(buffer.pop(popped));
+            CHECK_EQ(*it, popped);
+        }
+
+        CHECK(buffer.is_empty());
+        CHECK_FALSE(buffer.pop(popped));
+    }
+
+    SUBCASE("should be possible to push again after popping")
+    {
+        RewindBuffer buffer(1024 * 1024, 3);
+
+        std::vector<u8> state(64, 0);
+        for (u8 frame = 0; frame < 7; ++frame) {
+            state[0] = frame;
+            buffer.push(state);
+        }
+
+        std::vector<u8> popped;
+        buffer.pop(popped);
+        buffer.pop(popped);
+        buffer.pop(popped);
+        CHECK_EQ(4, popped[0]);
+
+        state[0] = 42;
+        buffer.push(state);
+
+        buffer.pop(popped);
+        CHECK_EQ(42, popped[0]);
+        buffer.pop(popped);
+        CHECK_EQ(3, popped[0]);
+    }
+
+    SUBCASE("should store frames with few changes compactly")
+    {
+        RewindBuffer buffer(1024 * 1024, 60);
+
+        std::vector<u8> state(0x10000, 0);
+        for (std::size_t i = 0; i < state.size(); ++i) {
+            state[i] = static_cast<u8>(i * 7);
+        }
+
+        for (int frame = 0; frame < 60; ++frame) {
+            state[0x4000 + frame] = static_cast<u8>(frame);
+            buffer.push(state);
+        }
+
+        CHECK_LT(buffer.memory_usage(), 0x10000 + 60 * 80);
+    }
+
+    SUBCASE("should drop the oldest frames when going above the memory cap")
+    {
+        RewindBuffer buffer(4096, 2);
+
+        std::vector<u8> state(1024, 0);
+        for (u8 frame = 0; frame < 20; ++frame) {
+            for (std::size_t i = 0; i < state.size(); ++i) {
+                state[i] = static_cast<u8>(i + frame);
+            }
+            buffer.push(state);
+        }
+
+        CHECK_LE(buffer.memory_usage(), 4096);
+        CHECK_LT(buffer.number_of_frames(), 20);
+
+        std::vector<u8> popped;
+        buffer.pop(popped);
+        CHECK_EQ(state, popped);
+    }
+
+    SUBCASE("should start a new keyframe when the size of the state changes")
+    {
+        RewindBuffer buffer(1024 * 1024, 10);
+
+        buffer.push(std::vector<u8>(16, 1));
+        buffer.push(std::vector<u8>(32, 2));
+
+        std::vector<u8> popped;
+        buffer.pop(popped);
+        CHECK_EQ(std::vector<u8>(32, 2), popped);
+        buffer.pop(popped);
+        CHECK_EQ(std::vector<u8>(16, 1), popped);
+    }
+}
+}
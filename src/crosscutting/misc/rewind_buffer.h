@@ -0,0 +1,72 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+namespace emu::misc {
+
+/**
+ * Keeps a history of machine states, one per frame, so that the emulation can be stepped backwards.
+ *
+ * One out of every m_keyframe_interval frames is stored as a keyframe, and the frames in between
+ * are stored as the XOR of the frame and the keyframe. Most of the memory of a machine doesn't change from one
+ * frame to the next, so the XOR is mostly zeros, which are run-length encoded away. Restoring a
+ * frame is therefore never more work than decoding one keyframe and one delta.
+ *
+ * When the history grows past the memory cap, the oldest keyframe is dropped together with its
+ * deltas.
+ */
+class RewindBuffer {
+public:
+    RewindBuffer(std::size_t memory_cap, std::size_t keyframe_interval);
+
+    void push(std::vector<u8> const& state);
+
+    /**
+     * Removes the newest state from the history.
+     *
+     * @param state is where the newest state is put
+     * @return true if there was a state to pop, false if the history is empty
+     */
+    bool pop(std::vector<u8>& state);
+
+    void clear();
+
+    [[nodiscard]] bool is_empty() const;
+
+    [[nodiscard]] std::size_t number_of_frames() const;
+
+    [[nodiscard]] std::size_t memory_usage() const;
+
+private:
+    struct Group {
+        std::size_t m_state_size;
+        std::vector<u8> m_keyframe;
+        std::vector<std::vector<u8>> m_deltas;
+    };
+
+    std::size_t m_memory_cap;
+    std::size_t m_keyframe_interval;
+    std::size_t m_memory_usage { 0 };
+    std::size_t m_number_of_frames { 0 };
+
+    std::deque<Group> m_groups;
+
+    // The decoded keyframe of the newest group.
+    std::vector<u8> m_keyframe;
+
+    std::vector<u8> m_scratch;
+
+    void start_group(std::vector<u8> const& state);
+
+    void evict_oldest_groups();
+
+    [[nodiscard]] static std::size_t group_size(Group const& group);
+
+    static void encode(std::vector<u8> const& state, std::vector<u8> const& base, std::vector<u8>& encoded);
+
+    static void decode(std::vector<u8> const& encoded, std::vector<u8>& target);
+};
+}
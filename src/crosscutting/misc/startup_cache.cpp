@@ -0,0 +1,150 @@
+#include "startup_cache.h"
+#include "crosscutting/misc/state_stream.h"
+#include "crosscutting/util/file_util.h"
+#include "crosscutting/util/hash_util.h"
+#include "doctest.h"
+#include <filesystem>
+#include <fmt/core.h>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+namespace emu::misc {
+
+using emu::util::file::read_file_into_vector;
+using emu::util::hash::fnv1a;
+
+StartupCache::StartupCache(std::string const& directory, std::string const& machine_name, u64 key)
+    : m_key(key)
+    , m_path((std::filesystem::path(directory) / fmt::format("{}_{:016x}.state", machine_name, key)).string())
+{
+}
+
+bool StartupCache::load(std::vector<u8>& state) const
+{
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(m_path, error)) {
+        return false;
+    }
+
+    const std::vector<u8> file = read_file_into_vector(m_path);
+    StateReader reader(file);
+
+    try {
+        if (reader.read<u32>() != s_magic || reader.read<u32>() != s_version || reader.read<u64>() != m_key) {
+            return false;
+        }
+
+        const u64 size = reader.read<u64>();
+        const u64 checksum = reader.read<u64>();
+
+        state.resize(size);
+        reader.read(state.data(), state.size());
+
+        return fnv1a(state.data(), state.size()) == checksum;
+    } catch (std::out_of_range const&) {
+        return false;
+    }
+}
+
+bool StartupCache::store(std::vector<u8> const& state) const
+{
+    std::vector<u8> file;
+    StateWriter writer(file);
+    writer.write(s_magic);
+    writer.write(s_version);
+    writer.write(m_key);
+    writer.write(static_cast<u64>(state.size()));
+    writer.write(fnv1a(state.data(), state.size()));
+    writer.write(state.data(), state.size());
+
+    std::error_code error;
+    const std::filesystem::path path(m_path);
+    const std::filesystem::path temporary_path(m_path + ".tmp");
+
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path(), error);
+        if (error) {
+            return false;
+        }
+    }
+
+    {
+        std::ofstream out(temporary_path, std::ios::out | std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<char const*>(file.data()), static_cast<std::streamsize>(file.size()));
+        if (!out) {
+            return false;
+        }
+    }
+
+    std::filesystem::rename(temporary_path, path, error);
+
+    return !error;
+}
+
+std::string const& StartupCache::path() const
+{
+    return m_path;
+}
+
+TEST_CASE("crosscutting: StartupCache")
+{
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "emu_startup_cache_test";
+    std::filesystem::remove_all(directory);
+
+    SUBCASE("should not find anything in an empty cache")
+    {
+        StartupCache cache(directory.string(), "test", 0x1234);
+
+        std::vector<u8> state;
+        CHECK_FALSE(cache.load(state));
+    }
+
+    SUBCASE("should load what was stored")
+    {
+        StartupCache cache(directory.string(), "test", 0x1234);
+
+        std::vector<u8> stored(1000);
+        for (std::size_t i = 0; i < stored.size(); ++i) {
+            stored[i] = static_cast<u8>(i * 13);
+        }
+
+        REQUIRE(cache.store(stored));
+
+        std::vector<u8> loaded;
+        REQUIRE(cache.load(loaded));
+        CHECK_EQ(stored, loaded);
+    }
+
+    SUBCASE("should not load a state stored with another key")
+    {
+        StartupCache cache(directory.string(), "test", 0x1234);
+        REQUIRE(cache.store(std::vector<u8>(10, 1)));
+
+        StartupCache other_cache(directory.string(), "test", 0x5678);
+
+        std::vector<u8> loaded;
+        CHECK_FALSE(other_cache.load(loaded));
+    }
+
+    SUBCASE("should not load a truncated or corrupted cache file")
+    {
+        StartupCache cache(directory.string(), "test", 0x1234);
+        REQUIRE(cache.store(std::vector<u8>(100, 1)));
+
+        std::vector<u8> file = read_file_into_vector(cache.path());
+
+        std::vector<u8> loaded;
+
+        file.back() ^= 0xff;
+        std::ofstream(cache.path(), std::ios::binary | std::ios::trunc).write(reinterpret_cast<char const*>(file.data()), static_cast<std::streamsize>(file.size()));
+        CHECK_FALSE(cache.load(loaded));
+
+        file.resize(file.size() / 2);
+        std::ofstream(cache.path(), std::ios::binary | std::ios::trunc).write(reinterpret_cast<char const*>(file.data()), static_cast<std::streamsize>(file.size()));
+        CHECK_FALSE(cache.load(loaded));
+    }
+
+    std::filesystem::remove_all(directory);
+}
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <string>
+#include <vector>
+
+namespace emu::misc {
+
+/**
+ * Keeps the state of a machine at the point where it has finished booting, so that later launches
+ * can restore that state instead of running the boot again.
+ *
+ * The cache file is named after the machine and a key, which is a hash of the ROMs and of anything
+ * else that changes what the boot ends up with. Loading another ROM set therefore never restores a
+ * state made by the old one, it just doesn't find a cache file.
+ */
+class StartupCache {
+public:
+    StartupCache(std::string const& directory, std::string const& machine_name, u64 key);
+
+    /**
+     * Reads the cached state, if there is one.
+     *
+     * @param state is where the cached state is put
+     * @return true if a valid cached state was found, false if it is missing, truncated or was made with another key
+     */
+    bool load(std::vector<u8>& state) const;
+
+    /**
+     * Writes the state to the cache. The file is written next to the cache file first and then
+     * renamed, so a launch that is cut short never leaves a half-written cache file behind.
+     *
+     * @param state is the state to cache
+     * @return true if the state was written, false otherwise
+     */
+    bool store(std::vector<u8> const& state) const;
+
+    [[nodiscard]] std::string const& path() const;
+
+private:
+    static constexpr u32 s_magic = 0x43545353; // "SSTC" when read as little-endian bytes
+    static constexpr u32 s_version = 2;
+
+    u64 m_key;
+    std::string m_path;
+};
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace emu::misc {
+
+/**
+ * Serializes machine state into a flat byte buffer. The components of a machine (CPU, memory,
+ * memory-mapped IO, ...) write themselves into the same buffer, in the same order as they are
+ * read back by StateReader. The buffer has no headers or tags, so two states of the same machine
+ * always have the same length, which is what makes them cheap to diff.
+ */
+class StateWriter {
+public:
+    explicit StateWriter(std::vector<u8>& buffer)
+        : m_buffer(buffer)
+    {
+    }
+
+    template<class T>
+    void write(T value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        write(&value, 1);
+    }
+
+    template<class T>
+    void write(T const* values, std::size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        const std::size_t offset = m_buffer.size();
+        m_buffer.resize(offset + count * sizeof(T));
+        std::memcpy(m_buffer.data() + offset, values, count * sizeof(T));
+    }
+
+private:
+    std::vector<u8>& m_buffer;
+};
+
+class StateReader {
+public:
+    explicit StateReader(std::vector<u8> const& buffer)
+        : m_buffer(buffer)
+    {
+    }
+
+    template<class T>
+    T read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        T value;
+        read(&value, 1);
+
+        return value;
+    }
+
+    template<class T>
+    void read(T* values, std::size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        if (m_position + count * sizeof(T) > m_buffer.size()) {
+            throw std::out_of_range("Tried to read past the end of the state buffer");
+        }
+
+        std::memcpy(values, m_buffer.data() + m_position, count * sizeof(T));
+        m_position += count * sizeof(T);
+    }
+
+private:
+    std::vector<u8> const& m_buffer;
+    std::size_t m_position { 0 };
+};
+}
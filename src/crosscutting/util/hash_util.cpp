@@ -0,0 +1,45 @@
+#include "hash_util.h"
+#include "crosscutting/typedefs.h"
+#include "doctest.h"
+#include <vector>
+
+namespace emu::util::hash {
+
+static constexpr u64 fnv1a_prime = 0x100000001b3;
+
+u64 fnv1a(u8 const* data, std::size_t size, u64 initial)
+{
+    u64 result = initial;
+    for (std::size_t i = 0; i < size; ++i) {
+        result ^= data[i];
+        result *= fnv1a_prime;
+    }
+
+    return result;
+}
+
+TEST_CASE("crosscutting: hash-util")
+{
+    SUBCASE("should hash with 64-bit FNV-1a")
+    {
+        const std::vector<u8> empty;
+        const std::vector<u8> a = { 'a' };
+        const std::vector<u8> foobar = { 'f', 'o', 'o', 'b', 'a', 'r' };
+
+        CHECK_EQ(0xcbf29ce484222325, fnv1a(empty.data(), empty.size()));
+        CHECK_EQ(0xaf63dc4c8601ec8c, fnv1a(a.data(), a.size()));
+        CHECK_EQ(0x85944171f73967e8, fnv1a(foobar.data(), foobar.size()));
+    }
+
+    SUBCASE("should hash several pieces of data into the same hash as the pieces put together")
+    {
+        const std::vector<u8> foo = { 'f', 'o', 'o' };
+        const std::vector<u8> bar = { 'b', 'a', 'r' };
+        const std::vector<u8> foobar = { 'f', 'o', 'o', 'b', 'a', 'r' };
+
+        CHECK_EQ(
+            fnv1a(foobar.data(), foobar.size()),
+            fnv1a(bar.data(), bar.size(), fnv1a(foo.data(), foo.size())));
+    }
+}
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "crosscutting/typedefs.h"
+#include <cstddef>
+
+namespace emu::util::hash {
+
+inline constexpr u64 fnv1a_offset_basis = 0xcbf29ce484222325;
+
+/**
+ * Hashes data with 64-bit FNV-1a. Several pieces of data can be hashed into one hash by passing
+ * the previous hash as the initial value.
+ */
+u64 fnv1a(u8 const* data, std::size_t size, u64 initial = fnv1a_offset_basis);
+}
@@ -0,0 +1,79 @@
+#include "parallel_util.h"
+#include "doctest.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace emu::util::parallel {
+
+unsigned int parallel_for_each(std::size_t count, std::function<std::function<bool(std::size_t)>()> const& make_worker)
+{
+    std::atomic<std::size_t> next_index { 0 };
+    std::atomic<bool> is_stopped { false };
+
+    auto const take_indices = [&]() {
+        const std::function<bool(std::size_t)> work = make_worker();
+        for (std::size_t index = next_index++; index < count && !is_stopped; index = next_index++) {
+            if (!work(index)) {
+                is_stopped = true;
+            }
+        }
+    };
+
+    const unsigned int thread_count = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::thread> threads;
+    for (unsigned int i = 1; i < thread_count; ++i) {
+        threads.emplace_back(take_indices);
+    }
+    take_indices();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    return thread_count;
+}
+
+unsigned int parallel_for_each(std::size_t count, std::function<void(std::size_t)> const& work)
+{
+    return parallel_for_each(count, [&]() {
+        return [&](std::size_t index) {
+            work(index);
+            return true;
+        };
+    });
+}
+
+TEST_CASE("crosscutting: parallel-util")
+{
+    SUBCASE("should do the work for every index once")
+    {
+        std::vector<std::atomic<int>> times_done(10000);
+
+        parallel_for_each(times_done.size(), [&](std::size_t index) {
+            ++times_done[index];
+        });
+
+        CHECK(std::all_of(times_done.begin(), times_done.end(), [](std::atomic<int> const& times) { return times == 1; }));
+    }
+
+    SUBCASE("should give every thread its own worker, and stop taking indices when the work returns false")
+    {
+        std::atomic<unsigned int> workers_made { 0 };
+        std::atomic<std::size_t> highest_index { 0 };
+
+        const unsigned int thread_count = parallel_for_each(1000000, [&]() -> std::function<bool(std::size_t)> {
+            ++workers_made;
+            return [&](std::size_t index) {
+                std::size_t highest = highest_index;
+                while (index > highest && !highest_index.compare_exchange_weak(highest, index)) {
+                }
+                return index < 10;
+            };
+        });
+
+        CHECK_EQ(thread_count, workers_made.load());
+        CHECK_LT(highest_index.load(), 10 + thread_count);
+    }
+}
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace emu::util::parallel {
+
+/**
+ * Does work for every index from 0 up to count, spread over the hardware threads with the calling
+ * thread as one of them. Each thread takes the next index that hasn't been taken yet, so indices
+ * that take long don't hold up the others.
+ *
+ * @param count is the number of indices
+ * @param make_worker is called once on every thread, and gives the work that thread does for the
+ *                    indices it takes, so that every thread can have its own state, like a CPU. When
+ *                    the work returns false, no more indices are taken by any thread
+ * @return the number of threads the work was spread over
+ */
+unsigned int parallel_for_each(std::size_t count, std::function<std::function<bool(std::size_t)>()> const& make_worker);
+
+/**
+ * Does work for every index from 0 up to count, for work that needs no state of its own.
+ *
+ * @param count is the number of indices
+ * @param work is what is done for every index
+ * @return the number of threads the work was spread over
+ */
+unsigned int parallel_for_each(std::size_t count, std::function<void(std::size_t)> const& work);
+}
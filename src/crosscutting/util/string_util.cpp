@@ -1,70 +1,95 @@
 #include "string_util.h"
 #include "crosscutting/typedefs.h"
+#include "doctest.h"
 #include <algorithm>
+#include <array>
 #include <cctype>
 #include <cstdlib>
-#include <cstring>
 #include <fmt/core.h>
-#include <iomanip>
 #include <stdexcept>
 #include <tuple>
 
 namespace emu::util::string {
 
+char* hexify_wo_0x_to(char* out, unsigned int val, int width)
+{
+    static constexpr std::array<char, 16> hex_digits = {
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+    };
+
+    int length = 1;
+    while (length < 8 && (val >> (4 * length)) != 0) {
+        ++length;
+    }
+    length = std::max(length, width);
+
+    for (int i = length - 1; i >= 0; --i) {
+        out[i] = hex_digits[val & 0xf];
+        val >>= 4;
+    }
+
+    return out + length;
+}
+
+char* hexify_to(char* out, u8 val)
+{
+    *out++ = '0';
+    *out++ = 'x';
+
+    return hexify_wo_0x_to(out, val, 2);
+}
+
+char* hexify_to(char* out, u16 val)
+{
+    *out++ = '0';
+    *out++ = 'x';
+
+    return hexify_wo_0x_to(out, val, 4);
+}
+
+// The strings are short enough to fit in std::string without it allocating
+
 std::string hexify(u8 val)
 {
-    std::stringstream ss;
-    ss << "0x" << std::setfill('0') << std::setw(2) << std::hex << static_cast<int>(val);
-    std::string return_val = ss.str();
+    char buffer[s_max_hexify_length];
 
-    return return_val;
+    return { buffer, hexify_to(buffer, val) };
 }
 
 std::string hexify(u16 val)
 {
-    std::stringstream ss;
-    ss << "0x" << std::setfill('0') << std::setw(4) << std::hex << val;
+    char buffer[s_max_hexify_length];
 
-    return ss.str();
+    return { buffer, hexify_to(buffer, val) };
 }
 
 std::string hexify_wo_0x(u8 val)
 {
-    std::stringstream ss;
-    ss << std::setfill('0') << std::setw(2) << std::hex << static_cast<int>(val);
-    std::string return_val = ss.str();
-
-    return return_val;
+    return hexify_wo_0x(val, 2);
 }
 
 std::string hexify_wo_0x(i8 val)
 {
     if (val >= 0) {
         return hexify_wo_0x(static_cast<u8>(val));
-    } else {
-        u8 uval = static_cast<u8>(abs(val));
-        std::stringstream ss;
-        ss << "-" << hexify_wo_0x(uval);
-        return ss.str();
     }
+
+    char buffer[s_max_hexify_length];
+    buffer[0] = '-';
+
+    return { buffer, hexify_wo_0x_to(buffer + 1, static_cast<u8>(abs(val)), 2) };
 }
 
 std::string hexify_wo_0x(u16 val)
 {
-    std::stringstream ss;
-    ss << std::setfill('0') << std::setw(4) << std::hex << static_cast<int>(val);
-    std::string return_val = ss.str();
-
-    return return_val;
+    return hexify_wo_0x(val, 4);
 }
 
 std::string hexify_wo_0x(unsigned int val, int width)
 {
-    std::stringstream ss;
-    ss << std::setfill('0') << std::setw(width) << std::hex << static_cast<int>(val);
-    std::string return_val = ss.str();
+    char buffer[s_max_hexify_length];
 
-    return return_val;
+    return { buffer, hexify_wo_0x_to(buffer, val, width) };
 }
 
 std::string find_short_executable_name(std::string name)
@@ -127,36 +152,12 @@ std::string_view trim(std::string_view s)
 
 std::string prepend(std::string prefix, char const* txt)
 {
-    char* out = new char[strlen(txt) + prefix.size() + 1];
-
-    for (std::size_t i = 0; i < prefix.size(); ++i) {
-        out[i] = prefix[i];
-    }
-
-    for (std::size_t i = prefix.size(); i < strlen(txt) + prefix.size(); ++i) {
-        out[i] = txt[i - prefix.size()];
-    }
-
-    out[strlen(txt) + prefix.size()] = '\0';
-
-    return { out };
+    return prefix.append(txt);
 }
 
 std::string append(std::string postfix, char const* txt)
 {
-    char* out = new char[strlen(txt) + postfix.size() + 1];
-
-    for (std::size_t i = 0; i < strlen(txt); ++i) {
-        out[i] = txt[i];
-    }
-
-    for (std::size_t i = strlen(txt); i < strlen(txt) + postfix.size(); ++i) {
-        out[i] = postfix[i - strlen(txt)];
-    }
-
-    out[strlen(txt) + postfix.size()] = '\0';
-
-    return { out };
+    return std::string(txt).append(postfix);
 }
 
 bool is_alphanumeric(std::string const& str)
@@ -168,4 +169,49 @@ bool is_alpha(std::string const& str)
 {
     return std::find_if(str.begin(), str.end(), [](char const& c) { return !isalpha(c); }) == str.end();
 }
+
+TEST_CASE("crosscutting: hexify")
+{
+    SUBCASE("should pad with zeros to the width of the type")
+    {
+        CHECK_EQ("0x0a", hexify(static_cast<u8>(0x0a)));
+        CHECK_EQ("0x00ff", hexify(static_cast<u16>(0x00ff)));
+        CHECK_EQ("0a", hexify_wo_0x(static_cast<u8>(0x0a)));
+        CHECK_EQ("beef", hexify_wo_0x(static_cast<u16>(0xbeef)));
+        CHECK_EQ("0x063", hexify(emu::misc::UInteger<100>(99)));
+        CHECK_EQ("0x07fff", hexify(emu::misc::UInteger<32768>(0x7fff)));
+    }
+
+    SUBCASE("should write every digit when the value is wider than the width")
+    {
+        CHECK_EQ("1234", hexify_wo_0x(0x1234u, 2));
+        CHECK_EQ("00001", hexify_wo_0x(0x1u, 5));
+        CHECK_EQ("ffffffff", hexify_wo_0x(0xffffffffu, 1));
+    }
+
+    SUBCASE("should write negative values with a minus")
+    {
+        CHECK_EQ("-01", hexify_wo_0x(static_cast<i8>(-1)));
+        CHECK_EQ("-80", hexify_wo_0x(static_cast<i8>(-128)));
+        CHECK_EQ("7f", hexify_wo_0x(static_cast<i8>(127)));
+    }
+
+    SUBCASE("should write decimals padded like UInteger is printed")
+    {
+        char buffer[s_max_hexify_length];
+
+        CHECK_EQ("0007", std::string(buffer, decimalify_to(buffer, emu::misc::UInteger<1000>(7))));
+        CHECK_EQ("099", std::string(buffer, decimalify_to(buffer, emu::misc::UInteger<100>(99))));
+    }
+
+    SUBCASE("should write to the buffer without terminating it")
+    {
+        char buffer[s_max_hexify_length] = { 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x' };
+        char* end = hexify_to(buffer, static_cast<u8>(0xc3));
+
+        CHECK_EQ(4, end - buffer);
+        CHECK_EQ("0xc3", std::string(buffer, end));
+        CHECK_EQ('x', buffer[4]);
+    }
+}
 }
@@ -3,7 +3,6 @@
 #include "crosscutting/misc/uinteger.h"
 #include "crosscutting/typedefs.h"
 #include <cstddef>
-#include <iomanip>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -11,6 +10,78 @@
 
 namespace emu::util::string {
 
+/**
+ * The most characters the hexify_to functions write, which is 0x followed by eight hex digits.
+ */
+constexpr std::size_t s_max_hexify_length = 10;
+
+/**
+ * Writes the value as hex digits, padded with zeros to the width. Nothing is allocated, so this is
+ * what the disassemblers and the debugging panes format with.
+ *
+ * @param out is where the digits are written, which needs room for at least eight characters
+ * @param val is the value to write
+ * @param width is the smallest number of digits, at most eight
+ * @return one past the last character written
+ */
+char* hexify_wo_0x_to(char* out, unsigned int val, int width);
+
+/**
+ * @param out is where the characters are written, which needs room for four characters
+ * @param val is the value to write as 0x followed by two hex digits
+ * @return one past the last character written
+ */
+char* hexify_to(char* out, u8 val);
+
+/**
+ * @param out is where the characters are written, which needs room for six characters
+ * @param val is the value to write as 0x followed by four hex digits
+ * @return one past the last character written
+ */
+char* hexify_to(char* out, u16 val);
+
+/**
+ * @return the number of decimal digits in the largest value of UInteger<M>, which it is padded to when printed
+ */
+template<std::size_t M>
+constexpr int uinteger_width()
+{
+    int width = 1;
+    for (std::size_t rest = M / 10; rest > 0; rest /= 10) {
+        ++width;
+    }
+
+    return width;
+}
+
+template<std::size_t M>
+char* hexify_to(char* out, emu::misc::UInteger<M> val)
+{
+    *out++ = '0';
+    *out++ = 'x';
+
+    return hexify_wo_0x_to(out, static_cast<unsigned int>(val.underlying()), uinteger_width<M>());
+}
+
+/**
+ * Writes the value in decimal, padded with zeros the same way as when it is printed to a stream.
+ *
+ * @param out is where the digits are written, which needs room for as many digits as M has
+ * @param val is the value to write
+ * @return one past the last character written
+ */
+template<std::size_t M>
+char* decimalify_to(char* out, emu::misc::UInteger<M> val)
+{
+    u64 rest = val.underlying();
+    for (int i = uinteger_width<M>() - 1; i >= 0; --i) {
+        out[i] = static_cast<char>('0' + rest % 10);
+        rest /= 10;
+    }
+
+    return out + uinteger_width<M>();
+}
+
 std::string hexify(u8 val);
 
 std::string hexify(u16 val);
@@ -18,10 +89,9 @@ std::string hexify(u16 val);
 template<std::size_t M>
 std::string hexify(emu::misc::UInteger<M> val)
 {
-    std::stringstream ss;
-    ss << "0x" << std::setfill('0') << std::setw(4) << std::hex << val;
+    char buffer[s_max_hexify_length];
 
-    return ss.str();
+    return { buffer, hexify_to(buffer, val) };
 }
 
 std::string hexify_wo_0x(u8 val);